@@ -33,6 +33,25 @@ void affinity_set::add(int cpu)
 }
 
 
+// Returns the (i mod count)-th CPU in the set, or -1 if the set is empty.
+int affinity_set::get_cpu(int i)
+{
+    int count = 0;
+    for (int icpu=0; icpu < CPU_SETSIZE; ++icpu) {
+        if ( CPU_ISSET( icpu, &set ))
+            ++count;
+    }
+    if (count == 0)
+        return -1;
+    i %= count;
+    for (int icpu=0; icpu < CPU_SETSIZE; ++icpu) {
+        if ( CPU_ISSET( icpu, &set ) && i-- == 0 )
+            return icpu;
+    }
+    return -1;
+}
+
+
 int affinity_set::get_affinity()
 {
     return sched_getaffinity( 0, sizeof(set), &set);
@@ -31,6 +31,8 @@ public:
 
     void add(int cpu);
 
+    int get_cpu(int i);
+
     int get_affinity();
 
     int set_affinity();
@@ -10,6 +10,8 @@
        @author Raffaele Solca
 */
 
+#include <unistd.h>
+
 #include "magma_internal.h"
 
 #define applyQver 113
@@ -189,6 +191,32 @@ magma_int_t magma_bulge_get_blkcnt(magma_int_t n, magma_int_t nb, magma_int_t Vb
 }
 
 
+/******************************************************************************/
+// Returns the number of consecutive bulge chasing steps a thread executes
+// as one group in hb2st. A group reuses the tiles it touches, so its working
+// set, about grsiz tiles of lda-by-nb elements, should fit in half the L2
+// cache. The group is limited so each thread still gets a few groups per
+// sweep. Returns 1 or an even number, as required by the V storage.
+magma_int_t magma_bulge_get_grsiz(magma_int_t n, magma_int_t nb, magma_int_t lda, magma_int_t elemsize, magma_int_t threads)
+{
+    long l2 = 0;
+    #ifdef _SC_LEVEL2_CACHE_SIZE
+    l2 = sysconf( _SC_LEVEL2_CACHE_SIZE );
+    #endif
+    if (l2 <= 0)
+        l2 = 256*1024;
+
+    magma_int_t nbtiles = magma_ceildiv( n, nb );
+    magma_int_t tile    = max( lda*nb*elemsize, 1 );
+    magma_int_t grsiz   = (l2/2) / tile;
+    grsiz = min( grsiz, (2*nbtiles) / max( 3*threads, 1 ) );
+    grsiz = min( grsiz, 8 );
+    if (grsiz < 2)
+        return 1;
+    return grsiz - grsiz % 2;
+}
+
+
 /******************************************************************************/
 magma_int_t magma_bulge_getlwstg1(magma_int_t n, magma_int_t nb, magma_int_t *lda2)
 {
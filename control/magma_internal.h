@@ -83,6 +83,7 @@
     @see magma_queue_get_hip_stream
     @see magma_queue_get_hipblas_handle
     @see magma_queue_get_hipsparse_handle
+    @see magma_queue_get_host_stream
 
     @ingroup magma_queue
 *******************************************************************************/
@@ -119,6 +120,12 @@ public:
         }
     }
     
+    #ifdef HAVE_HOST
+    /// @return worker thread executing the operations of this queue;
+    /// requires the host backend.
+    magma_host_stream_t host_stream() { return stream__; }
+    #endif
+
     #ifdef HAVE_HIP
     
     hipStream_t      hip_stream()      { return stream__; };
@@ -202,6 +209,10 @@ protected:
     cusparseHandle_t cusparse__;    // associated cuSparse handle
     #endif // HAVE_CUBLAS
 
+    #ifdef HAVE_HOST
+    magma_host_stream_t stream__;   // associated worker thread
+    #endif
+
     #ifdef HAVE_HIP
     hipStream_t      stream__;
     //rocblas_handle rocblas__;
@@ -9,6 +9,7 @@
 */
 
 #include "thread_queue.hpp"
+#include "affinity.h"
 
 // If err, prints error and throws exception.
 static void check( int err )
@@ -32,13 +33,25 @@ static void check( int err )
     Typical use:
     A main thread creates the queue and tells it to launch worker threads. Then
     the main thread inserts (pushes) tasks into the queue. Threads will execute
-    the tasks. No dependencies are tracked. The main thread can sync the queue,
+    the tasks. The main thread can sync the queue,
     waiting for all current tasks to finish, and then insert more tasks into the
     queue. When finished, the main thread calls quit or simply destructs the
     queue, which will exit all worker threads.
     
     Tasks are sub-classes of magma_task. They must implement the run() function.
     
+    Each thread has its own deque of ready tasks, with its own lock. Tasks
+    pushed by the main thread are dealt round-robin to the deques; a thread
+    takes tasks from the front of its deque and, when that is empty, steals
+    from the back of the other deques. With one thread, tasks pushed without
+    dependencies execute in the order they were pushed.
+    
+    Dependencies:
+    push_task( task, ndep, dep ) returns an id for the task, and the task does
+    not execute before the tasks with ids dep[0], ..., dep[ndep-1] finish.
+    This replaces a sync() between a group of tasks and the tasks that
+    consume their results. wait( id ) blocks until one task finishes.
+    
     Example
     -------
     @code
@@ -74,6 +87,13 @@ static void check( int err )
                 queue.push_task( new task2( i, j ));
             }
         }
+        queue.sync();
+        
+        // task2( i, i ) waits for task1( i ) only
+        for( int i=0; i < n; ++i ) {
+            magma_task_id_t id = queue.push_task( new task1( i ), 0, NULL );
+            queue.push_task( new task2( i, i ), 1, &id );
+        }
         queue.quit();  // [optional] explicitly exit worker threads
     }
     @endcode
@@ -86,29 +106,179 @@ static void check( int err )
 *******************************************************************************/
 
 
+/******************************************************************************/
+// Pooled storage for tasks.
+// Tasks up to task_block_size bytes are carved from fixed-size blocks. Each
+// thread keeps a cache of free blocks; a task is usually allocated by the
+// main thread and freed by a worker, so caches exchange blocks in batches
+// through a global free list, and the global lock is taken once per batch.
+
+static const size_t task_block_size = 256;
+static const int    task_batch      = 32;
+
+struct magma_task_block
+{
+    magma_task_block* next;
+};
+
+static pthread_mutex_t   g_task_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static magma_task_block* g_task_pool       = NULL;
+
+class magma_task_cache
+{
+public:
+    magma_task_cache():
+        head ( NULL ),
+        count( 0 )
+    {}
+
+    // returns blocks to the global free list when the thread exits
+    ~magma_task_cache()
+    {
+        give( count );
+    }
+
+    void* get()
+    {
+        if ( head == NULL ) {
+            take( task_batch );
+        }
+        if ( head == NULL ) {
+            return ::operator new( task_block_size );
+        }
+        magma_task_block* block = head;
+        head = block->next;
+        count -= 1;
+        return block;
+    }
+
+    void put( void* ptr )
+    {
+        magma_task_block* block = (magma_task_block*) ptr;
+        block->next = head;
+        head = block;
+        count += 1;
+        if ( count > 2*task_batch ) {
+            give( task_batch );
+        }
+    }
+
+private:
+    // moves up to cnt blocks from the global free list to this cache
+    void take( int cnt )
+    {
+        check( pthread_mutex_lock( &g_task_pool_mutex ));
+        while( cnt > 0 && g_task_pool != NULL ) {
+            magma_task_block* block = g_task_pool;
+            g_task_pool = block->next;
+            block->next = head;
+            head = block;
+            count += 1;
+            cnt -= 1;
+        }
+        check( pthread_mutex_unlock( &g_task_pool_mutex ));
+    }
+
+    // moves cnt blocks from this cache to the global free list
+    void give( int cnt )
+    {
+        if ( cnt <= 0 ) {
+            return;
+        }
+        magma_task_block* first = head;
+        magma_task_block* last  = head;
+        for( int i=1; i < cnt; ++i ) {
+            last = last->next;
+        }
+        head = last->next;
+        count -= cnt;
+        check( pthread_mutex_lock( &g_task_pool_mutex ));
+        last->next = g_task_pool;
+        g_task_pool = first;
+        check( pthread_mutex_unlock( &g_task_pool_mutex ));
+    }
+
+    magma_task_block* head;   ///<  free blocks
+    int               count;  ///<  number of free blocks
+};
+
+static thread_local magma_task_cache t_task_cache;
+
+
+/***************************************************************************//**
+    Allocates a task from the task pool; tasks larger than a pool block use
+    the global operator new.
+*******************************************************************************/
+void* magma_task::operator new( size_t size )
+{
+    if ( size > task_block_size ) {
+        return ::operator new( size );
+    }
+    return t_task_cache.get();
+}
+
+
+/***************************************************************************//**
+    Returns a task to the task pool of the calling thread.
+    For a polymorphic delete, size is the size of the dynamic type.
+*******************************************************************************/
+void magma_task::operator delete( void* ptr, size_t size )
+{
+    if ( ptr == NULL ) {
+        return;
+    }
+    if ( size > task_block_size ) {
+        ::operator delete( ptr );
+        return;
+    }
+    t_task_cache.put( ptr );
+}
+
+
+/******************************************************************************/
+// Queue and index of the worker that the calling thread is, if any.
+static thread_local const magma_thread_queue* t_queue = NULL;
+static thread_local magma_int_t               t_index = -1;
+
+
 /***************************************************************************//**
     Thread's main routine, executed by pthread_create.
     Executes tasks from queue (given as arg), until a NULL task is returned.
     Deletes each task when it is done.
-    @param[in,out] arg    magma_thread_queue to get tasks from.
+    @param[in,out] arg    worker of magma_thread_queue to get tasks from.
 *******************************************************************************/
 extern "C"
 void* magma_thread_main( void* arg )
 {
-    magma_thread_queue* queue = (magma_thread_queue*) arg;
+    magma_thread_queue::worker_t* worker = (magma_thread_queue::worker_t*) arg;
+    magma_thread_queue* queue = worker->queue;
     magma_task* task;
     
+    #ifndef MAGMA_NOAFFINITY
+    if ( worker->cpu >= 0 ) {
+        affinity_set set( worker->cpu );
+        if ( set.set_affinity() != 0 ) {
+            fprintf( stderr, "Error in sched_setaffinity (thread %lld, cpu %lld)\n",
+                     (long long) worker->index, (long long) worker->cpu );
+        }
+    }
+    #endif
+    
+    t_queue = queue;
+    t_index = worker->index;
     while( true ) {
-        task = queue->pop_task();
+        task = queue->pop_task( worker );
         if ( task == NULL ) {
             break;
         }
         
         task->run();
-        queue->task_done();
+        queue->task_done( task );
         delete task;
         task = NULL;
     }
+    t_queue = NULL;
+    t_index = -1;
     
     return NULL;  // implicitly does pthread_exit
 }
@@ -118,15 +288,23 @@ void* magma_thread_main( void* arg )
     Creates queue with NO threads. Use launch() to create threads.
 *******************************************************************************/
 magma_thread_queue::magma_thread_queue():
-    q        (),
     quit_flag( false ),
     ntask    ( 0     ),
+    nready   ( 0     ),
+    nidle    ( 0     ),
+    next     ( 0     ),
+    last_id  ( 0     ),
+    pending  (),
+    nwait    ( 0     ),
     threads  ( NULL  ),
+    workers  ( NULL  ),
     nthread  ( 0     )
 {
     check( pthread_mutex_init( &mutex,      NULL ));
     check( pthread_cond_init(  &cond,       NULL ));
     check( pthread_cond_init(  &cond_ntask, NULL ));
+    check( pthread_mutex_init( &dep_mutex,  NULL ));
+    check( pthread_cond_init(  &dep_cond,   NULL ));
 }
 
 
@@ -139,23 +317,54 @@ magma_thread_queue::~magma_thread_queue()
     check( pthread_mutex_destroy( &mutex ));
     check( pthread_cond_destroy( &cond ));
     check( pthread_cond_destroy( &cond_ntask ));
+    check( pthread_mutex_destroy( &dep_mutex ));
+    check( pthread_cond_destroy( &dep_cond ));
 }
 
 
 /***************************************************************************//**
     Creates threads.
     @param[in] in_nthread    Number of threads to launch.
+    @param[in] pin           If true, thread i is pinned to the i-th CPU
+                             (modulo the number of CPUs) that the calling
+                             thread may run on.
+                             Ignored if compiled with MAGMA_NOAFFINITY.
 *******************************************************************************/
-void magma_thread_queue::launch( magma_int_t in_nthread )
+void magma_thread_queue::launch( magma_int_t in_nthread, bool pin )
 {
     assert( threads == NULL );  // else launch was called previously
     nthread = in_nthread;
     if ( nthread < 1 ) {
         nthread = 1;
     }
+    
+    // CPUs available to the calling thread
+    std::vector< magma_int_t > cpus;
+    #ifndef MAGMA_NOAFFINITY
+    if ( pin ) {
+        cpu_set_t set;
+        CPU_ZERO( &set );
+        if ( sched_getaffinity( 0, sizeof(set), &set ) == 0 ) {
+            for( int cpu=0; cpu < CPU_SETSIZE; ++cpu ) {
+                if ( CPU_ISSET( cpu, &set )) {
+                    cpus.push_back( cpu );
+                }
+            }
+        }
+    }
+    #endif
+    
+    workers = new worker_t[ nthread ];
+    for( magma_int_t i=0; i < nthread; ++i ) {
+        workers[i].queue = this;
+        workers[i].index = i;
+        workers[i].cpu   = (cpus.empty() ? -1 : cpus[ i % cpus.size() ]);
+        check( pthread_mutex_init( &workers[i].mutex, NULL ));
+    }
+    
     threads = new pthread_t[ nthread ];
     for( magma_int_t i=0; i < nthread; ++i ) {
-        check( pthread_create( &threads[i], NULL, magma_thread_main, this ));
+        check( pthread_create( &threads[i], NULL, magma_thread_main, &workers[i] ));
         //printf( "launch %d (%lx)\n", i, (long) threads[i] );
     }
 }
@@ -164,61 +373,215 @@ void magma_thread_queue::launch( magma_int_t in_nthread )
 /***************************************************************************//**
     Add task to queue. Task must be allocated with C++ new.
     Increments number of outstanding tasks.
-    Signals threads that are waiting in pop_task().
     @param[in] task    Task to queue.
 *******************************************************************************/
 void magma_thread_queue::push_task( magma_task* task )
 {
-    check( pthread_mutex_lock( &mutex ));
     if ( quit_flag ) {
         fprintf( stderr, "Error: push_task() called after quit()\n" );
         throw std::exception();
     }
-    q.push( task );
+    task->id = 0;
     ntask += 1;
-    //printf( "push; ntask %d\n", ntask );
-    check( pthread_cond_broadcast( &cond ));
-    check( pthread_mutex_unlock( &mutex ));
+    //printf( "push; ntask %d\n", ntask.load() );
+    ready_task( task );
 }
 
 
 /***************************************************************************//**
-    Get next task from queue.
-    @return next task, blocking until a task is inserted if necesary.
-    @return NULL if queue is empty *and* quit() has been called.
+    Add task to queue, to execute after tasks it depends on have finished.
+    Task must be allocated with C++ new.
+    Increments number of outstanding tasks.
+    
+    @param[in] task    Task to queue.
+    @param[in] ndep    Number of tasks that task depends on.
+    @param[in] dep     Array of ndep ids, returned by earlier calls to push_task
+                       on this queue. Ids of tasks that already finished, and
+                       ids <= 0, are ignored.
+    @return id of task, to use in dep of later tasks or in wait().
+*******************************************************************************/
+magma_task_id_t magma_thread_queue::push_task(
+    magma_task* task, magma_int_t ndep, const magma_task_id_t* dep )
+{
+    if ( quit_flag ) {
+        fprintf( stderr, "Error: push_task() called after quit()\n" );
+        throw std::exception();
+    }
+    ntask += 1;
+    
+    check( pthread_mutex_lock( &dep_mutex ));
+    magma_task_id_t id = ++last_id;
+    task->id   = id;
+    task->ndep = 0;
+    for( magma_int_t i=0; i < ndep; ++i ) {
+        if ( dep[i] > 0 ) {
+            auto iter = pending.find( dep[i] );
+            if ( iter != pending.end() ) {
+                iter->second->successors.push_back( task );
+                task->ndep += 1;
+            }
+        }
+    }
+    pending[ id ] = task;
+    bool ready = (task->ndep == 0);
+    check( pthread_mutex_unlock( &dep_mutex ));
+    
+    if ( ready ) {
+        ready_task( task );
+    }
+    return id;
+}
+
+
+/***************************************************************************//**
+    Puts task, whose dependencies are satisfied, in a thread's deque.
+    A task made ready by a worker thread of this queue goes to the front of
+    that thread's deque, so it executes next on the same thread;
+    other tasks go round-robin to the back of the deques.
+    Signals a thread that is waiting in pop_task(), if any.
+    @param[in] task    Task to queue.
+*******************************************************************************/
+void magma_thread_queue::ready_task( magma_task* task )
+{
+    assert( workers != NULL );  // else launch was not called
+    if ( t_queue == this ) {
+        worker_t* worker = &workers[ t_index ];
+        check( pthread_mutex_lock( &worker->mutex ));
+        worker->tasks.push_front( task );
+        check( pthread_mutex_unlock( &worker->mutex ));
+    }
+    else {
+        worker_t* worker = &workers[ (next++) % nthread ];
+        check( pthread_mutex_lock( &worker->mutex ));
+        worker->tasks.push_back( task );
+        check( pthread_mutex_unlock( &worker->mutex ));
+    }
+    // nready is incremented before nidle is read, and pop_task increments
+    // nidle before reading nready, so either this sees the idle thread
+    // or the idle thread sees the task.
+    nready += 1;
+    if ( nidle > 0 ) {
+        check( pthread_mutex_lock( &mutex ));
+        check( pthread_cond_signal( &cond ));
+        check( pthread_mutex_unlock( &mutex ));
+    }
+}
+
+
+/***************************************************************************//**
+    Get next task for a thread: from the front of its own deque, else stolen
+    from the back of another thread's deque.
+    @return next task, blocking until a task is ready if necesary.
+    @return NULL if no task is ready *and* quit() has been called.
     
     This does *not* decrement number of outstanding tasks;
     thread should call task_done() when task is completed.
+    
+    @param[in,out] worker    Worker of the calling thread.
 *******************************************************************************/
-magma_task* magma_thread_queue::pop_task()
+magma_task* magma_thread_queue::pop_task( worker_t* worker )
 {
+    const int spin = 1000;
     magma_task* task = NULL;
-    check( pthread_mutex_lock( &mutex ));
-    while( q.empty() && ! quit_flag ) {
-        check( pthread_cond_wait( &cond, &mutex ));
-    }
-    // q has item or quit is set (or both)
-    if ( ! q.empty()) {
-        task = q.front();
-        q.pop();
+    while( true ) {
+        check( pthread_mutex_lock( &worker->mutex ));
+        if ( ! worker->tasks.empty() ) {
+            task = worker->tasks.front();
+            worker->tasks.pop_front();
+        }
+        check( pthread_mutex_unlock( &worker->mutex ));
+        
+        for( magma_int_t k=1; k < nthread && task == NULL; ++k ) {
+            worker_t* victim = &workers[ (worker->index + k) % nthread ];
+            check( pthread_mutex_lock( &victim->mutex ));
+            if ( ! victim->tasks.empty() ) {
+                task = victim->tasks.back();
+                victim->tasks.pop_back();
+            }
+            check( pthread_mutex_unlock( &victim->mutex ));
+        }
+        
+        if ( task != NULL ) {
+            nready -= 1;
+            //printf( "pop;  ntask %d\n", ntask.load() );
+            return task;
+        }
+        
+        // briefly spin, as the next task is often pushed right away,
+        // then sleep until a task is ready or quit is set
+        for( int i=0; i < spin && nready == 0 && ! quit_flag; ++i ) {}
+        if ( nready > 0 ) {
+            continue;
+        }
+        bool done = false;
+        check( pthread_mutex_lock( &mutex ));
+        nidle += 1;
+        while( nready == 0 && ! quit_flag ) {
+            check( pthread_cond_wait( &cond, &mutex ));
+        }
+        nidle -= 1;
+        done = (nready == 0);  // so quit_flag is set
+        check( pthread_mutex_unlock( &mutex ));
+        if ( done ) {
+            return NULL;
+        }
     }
-    //printf( "pop;  ntask %d\n", ntask );
-    check( pthread_mutex_unlock( &mutex ));
-    return task;
 }
 
 
 /***************************************************************************//**
     Marks task as finished, decrementing number of outstanding tasks.
-    Signals threads that are waiting in sync().
+    Tasks waiting only for this task become ready.
+    Signals threads that are waiting in sync() or wait().
+    @param[in,out] task    Task that finished.
 *******************************************************************************/
-void magma_thread_queue::task_done()
+void magma_thread_queue::task_done( magma_task* task )
 {
-    check( pthread_mutex_lock( &mutex ));
-    ntask -= 1;
-    //printf( "fini; ntask %d\n", ntask );
-    check( pthread_cond_broadcast( &cond_ntask ));
-    check( pthread_mutex_unlock( &mutex ));
+    if ( task->id != 0 ) {
+        std::vector< magma_task* > successors;
+        check( pthread_mutex_lock( &dep_mutex ));
+        pending.erase( task->id );
+        successors.swap( task->successors );
+        size_t nready_succ = 0;
+        for( size_t i=0; i < successors.size(); ++i ) {
+            successors[i]->ndep -= 1;
+            if ( successors[i]->ndep == 0 ) {
+                successors[ nready_succ++ ] = successors[i];
+            }
+        }
+        if ( nwait > 0 ) {
+            check( pthread_cond_broadcast( &dep_cond ));
+        }
+        check( pthread_mutex_unlock( &dep_mutex ));
+        
+        for( size_t i=0; i < nready_succ; ++i ) {
+            ready_task( successors[i] );
+        }
+    }
+    
+    if ( --ntask == 0 ) {
+        //printf( "fini; ntask %d\n", ntask.load() );
+        check( pthread_mutex_lock( &mutex ));
+        check( pthread_cond_broadcast( &cond_ntask ));
+        check( pthread_mutex_unlock( &mutex ));
+    }
+}
+
+
+/***************************************************************************//**
+    Block until the task with the given id has finished.
+    Must not be called from a task executing in this queue.
+    @param[in] id    Id returned by push_task( task, ndep, dep ).
+*******************************************************************************/
+void magma_thread_queue::wait( magma_task_id_t id )
+{
+    check( pthread_mutex_lock( &dep_mutex ));
+    nwait += 1;
+    while( pending.count( id ) > 0 ) {
+        check( pthread_cond_wait( &dep_cond, &dep_mutex ));
+    }
+    nwait -= 1;
+    check( pthread_mutex_unlock( &dep_mutex ));
 }
 
 
@@ -229,19 +592,20 @@ void magma_thread_queue::task_done()
 void magma_thread_queue::sync()
 {
     check( pthread_mutex_lock( &mutex ));
-    //printf( "sync; ntask %d [start]\n", ntask );
+    //printf( "sync; ntask %d [start]\n", ntask.load() );
     while( ntask > 0 ) {
         check( pthread_cond_wait( &cond_ntask, &mutex ));
-        //printf( "sync; ntask %d\n", ntask );
+        //printf( "sync; ntask %d\n", ntask.load() );
     }
-    //printf( "sync; ntask %d [done]\n", ntask );
+    //printf( "sync; ntask %d [done]\n", ntask.load() );
     check( pthread_mutex_unlock( &mutex ));
 }
 
 
 /***************************************************************************//**
-    Sets quit_flag, so pop_task() will return NULL once queue is empty,
-    telling threads to exit.
+    Sets quit_flag, so pop_task() will return NULL once no tasks are ready,
+    telling threads to exit. Tasks that become ready when a running task
+    finishes are executed by that task's thread before it exits.
     Signals all threads that are waiting in pop_task().
     Waits for all threads to exit (i.e., joins them).
     It is safe to call quit multiple times -- the first time all the threads are
@@ -253,7 +617,7 @@ void magma_thread_queue::quit()
     // first, set quit_flag and signal waiting threads
     bool join = true;
     check( pthread_mutex_lock( &mutex ));
-    //printf( "quit %d\n", quit_flag );
+    //printf( "quit %d\n", quit_flag.load() );
     if ( quit_flag ) {
         join = false;  // quit previously called; don't join again.
     }
@@ -272,6 +636,12 @@ void magma_thread_queue::quit()
         }
         delete[] threads;
         threads = NULL;
+        
+        for( magma_int_t i=0; i < nthread; ++i ) {
+            check( pthread_mutex_destroy( &workers[i].mutex ));
+        }
+        delete[] workers;
+        workers = NULL;
     }
 }
 
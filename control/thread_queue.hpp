@@ -11,7 +11,10 @@
 #ifndef MAGMA_THREAD_HPP
 #define MAGMA_THREAD_HPP
 
-#include <queue>
+#include <atomic>
+#include <deque>
+#include <unordered_map>
+#include <vector>
 
 #include "magma_internal.h"
 
@@ -20,19 +23,37 @@
 extern "C"
 void* magma_thread_main( void* arg );
 
+/// Identifies a task pushed with magma_thread_queue::push_task( task, ndep, dep ).
+/// Ids are positive; 0 is never a task, so it can be used for "no dependency".
+typedef long long magma_task_id_t;
+
 
 /***************************************************************************//**
     Super class for tasks used with \ref magma_thread_queue.
     Each task should sub-class this and implement the run() method.
+    Tasks are allocated from a pool of fixed-size blocks, so allocating
+    (with new) and deleting small tasks does not go to the system heap.
     @ingroup magma_thread
 *******************************************************************************/
 class magma_task
 {
 public:
-    magma_task() {}
+    magma_task():
+        id  ( 0 ),
+        ndep( 0 )
+    {}
     virtual ~magma_task() {}
-    
+
     virtual void run() = 0;  // pure virtual function to execute task
+
+    static void* operator new( size_t size );
+    static void  operator delete( void* ptr, size_t size );
+
+private:
+    friend class magma_thread_queue;
+    magma_task_id_t id;                     ///<  id if dependencies are tracked, else 0
+    magma_int_t     ndep;                   ///<  number of unfinished tasks this task depends on
+    std::vector< magma_task* > successors;  ///<  tasks that depend on this task
 };
 
 
@@ -42,28 +63,52 @@ class magma_thread_queue
 public:
     magma_thread_queue();
     ~magma_thread_queue();
-    
-    void launch( magma_int_t in_nthread );
+
+    void launch( magma_int_t in_nthread, bool pin=false );
     void push_task( magma_task* task );
+    magma_task_id_t push_task( magma_task* task, magma_int_t ndep, const magma_task_id_t* dep );
+    void wait( magma_task_id_t id );
     void sync();
     void quit();
-    
+
 protected:
     friend void* magma_thread_main( void* arg );
-    magma_task* pop_task();
-    void task_done();
-    
+
+    /// Per-thread deque of ready tasks. The owner takes from the front,
+    /// other threads steal from the back.
+    struct worker_t {
+        magma_thread_queue*       queue;
+        magma_int_t               index;  ///<  index of thread, 0, ..., nthread-1
+        magma_int_t               cpu;    ///<  CPU the thread is pinned to, or -1
+        pthread_mutex_t           mutex;  ///<  mutex lock for tasks
+        std::deque< magma_task* > tasks;  ///<  ready tasks
+    };
+
+    magma_task* pop_task( worker_t* worker );
+    void task_done( magma_task* task );
+    void ready_task( magma_task* task );
+
     magma_int_t get_thread_index( pthread_t thread ) const;
-    
+
 private:
-    std::queue< magma_task* > q;  ///<  queue of tasks
-    bool            quit_flag;    ///<  quit() sets this to true; after this, pop returns NULL
-    magma_int_t     ntask;        ///<  number of unfinished tasks (in queue or currently executing)
-    pthread_mutex_t mutex;        ///<  mutex lock for queue, quit, ntask
-    pthread_cond_t  cond;         ///<  condition variable for changes to queue and quit (see push, pop, quit)
-    pthread_cond_t  cond_ntask;   ///<  condition variable for changes to ntask (see sync, task_done)
-    pthread_t*      threads;      ///<  array of threads
-    magma_int_t     nthread;      ///<  number of threads
+    std::atomic< bool >        quit_flag;  ///<  quit() sets this to true; after this, pop returns NULL once no tasks are ready
+    std::atomic< magma_int_t > ntask;      ///<  number of unfinished tasks (waiting, ready, or currently executing)
+    std::atomic< magma_int_t > nready;     ///<  number of tasks in the worker deques
+    std::atomic< magma_int_t > nidle;      ///<  number of threads waiting in pop_task()
+    std::atomic< unsigned >    next;       ///<  round-robin counter for tasks pushed by other threads
+    pthread_mutex_t mutex;                 ///<  mutex lock for sleeping threads and sync
+    pthread_cond_t  cond;                  ///<  condition variable for changes to nready and quit (see ready_task, pop, quit)
+    pthread_cond_t  cond_ntask;            ///<  condition variable for changes to ntask (see sync, task_done)
+
+    magma_task_id_t last_id;               ///<  id of last task pushed with dependencies
+    std::unordered_map< magma_task_id_t, magma_task* > pending;  ///<  unfinished tasks pushed with dependencies
+    pthread_mutex_t dep_mutex;             ///<  mutex lock for last_id, pending, and each task's ndep and successors
+    pthread_cond_t  dep_cond;              ///<  condition variable for changes to pending (see wait, task_done)
+    magma_int_t     nwait;                 ///<  number of threads in wait()
+
+    pthread_t*      threads;               ///<  array of threads
+    worker_t*       workers;               ///<  array of per-thread deques
+    magma_int_t     nthread;               ///<  number of threads
 };
 
 #endif        //  #ifndef MAGMA_THREAD_HPP
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from include/magma_zbulge.h, normal z -> d, Sat Mar 27 20:33:18 2021
+       @generated from include/magma_zbulge.h, normal z -> d, Fri Oct 16 19:59:21 2026
 */
 
 #ifndef MAGMA_DBULGE_H
@@ -28,6 +28,16 @@ magma_dbulge_applyQ_v2(
     double *T, magma_int_t ldt, 
     magma_int_t *info);
 
+magma_int_t
+magma_dbulge_applyQ_cpu(
+    magma_side_t side, 
+    magma_int_t NE, magma_int_t n, 
+    magma_int_t nb, magma_int_t Vblksiz, 
+    double *E, magma_int_t lde, 
+    double *V, magma_int_t ldv, 
+    double *T, magma_int_t ldt, 
+    magma_int_t *info);
+
 magma_int_t
 magma_dbulge_applyQ_v2_m(
     magma_int_t ngpu, magma_side_t side, 
@@ -20,7 +20,7 @@
 
 
 // each implementation of MAGMA defines HAVE_* appropriately.
-#if ! defined(HAVE_CUBLAS) && ! defined(HAVE_clBLAS) && ! defined(HAVE_MIC) && ! defined(HAVE_HIP)
+#if ! defined(HAVE_CUBLAS) && ! defined(HAVE_clBLAS) && ! defined(HAVE_MIC) && ! defined(HAVE_HIP) && ! defined(HAVE_HOST)
 // Pytorch requires that the error commented out below is not produced and that HAVE_CUBLAS is defined:
 // #error No 'HAVE_*' macros were set! (defaulting to CUBLAS)
 #define HAVE_CUBLAS
@@ -385,6 +385,131 @@ typedef double real_Double_t;
     }
     #endif 
 
+#elif defined(HAVE_HOST)
+
+    /* Host backend: the "device" is the CPU itself. Device memory is host
+     * memory, and each queue is a worker thread that executes the operations
+     * enqueued on it in FIFO order, calling the host BLAS.
+     */
+
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+
+    // opaque queue, worker thread, and event types
+    struct magma_queue;
+    struct magma_host_stream;
+    struct magma_event;
+    typedef struct magma_queue*       magma_queue_t;
+    typedef struct magma_host_stream* magma_host_stream_t;
+    typedef struct magma_event*       magma_event_t;
+    typedef int                       magma_device_t;
+
+    // placeholder until FP16 is supported
+    typedef short            magmaHalf;
+
+    // there is no device code, so the CUDA function qualifiers are empty
+    #ifndef __host__
+    #define __host__
+    #endif
+    #ifndef __device__
+    #define __device__
+    #endif
+
+    magma_host_stream_t magma_queue_get_host_stream( magma_queue_t queue );
+
+    /* double complex, same data layout as the Fortran COMPLEX*16 of the host BLAS */
+    typedef struct {
+
+        // real, imag components
+        double x, y;
+
+    } magmaDoubleComplex;
+
+    /* functionality macros */
+    #define MAGMA_Z_MAKE(r, i)   ((magmaDoubleComplex){(double)(r), (double)(i)})
+    #define MAGMA_Z_REAL(a) (a).x
+    #define MAGMA_Z_IMAG(a) (a).y
+    #define MAGMA_Z_ADD(a, b) magmaCadd(a, b)
+    #define MAGMA_Z_SUB(a, b) magmaCsub(a, b)
+    #define MAGMA_Z_MUL(a, b) magmaCmul(a, b)
+    #define MAGMA_Z_DIV(a, b) magmaCdiv(a, b)
+    #define MAGMA_Z_ABS(a) (hypot(MAGMA_Z_REAL(a), MAGMA_Z_IMAG(a)))
+    #define MAGMA_Z_ABS1(a) (fabs(MAGMA_Z_REAL(a)) + fabs(MAGMA_Z_IMAG(a)))
+    #define MAGMA_Z_CONJ(a) magmaConj(a)
+
+    /* basic arithmetic functions */
+    static inline magmaDoubleComplex magmaCadd(magmaDoubleComplex a, magmaDoubleComplex b) {
+        return MAGMA_Z_MAKE(a.x+b.x, a.y+b.y);
+    }
+    static inline magmaDoubleComplex magmaCsub(magmaDoubleComplex a, magmaDoubleComplex b) {
+        return MAGMA_Z_MAKE(a.x-b.x, a.y-b.y);
+    }
+    static inline magmaDoubleComplex magmaCmul(magmaDoubleComplex a, magmaDoubleComplex b) {
+        return MAGMA_Z_MAKE(a.x*b.x - a.y*b.y, a.x*b.y + a.y*b.x);
+    }
+    static inline magmaDoubleComplex magmaCdiv(magmaDoubleComplex a, magmaDoubleComplex b) {
+        double sqabs = b.x*b.x + b.y*b.y;
+        return MAGMA_Z_MAKE(
+            (a.x * b.x + a.y * b.y) / sqabs,
+            (a.y * b.x - a.x * b.y) / sqabs
+        );
+    }
+    static inline magmaDoubleComplex magmaConj(magmaDoubleComplex a) {
+        return MAGMA_Z_MAKE(a.x, -a.y);
+    }
+    static inline magmaDoubleComplex magmaCfma(magmaDoubleComplex a, magmaDoubleComplex b, magmaDoubleComplex c) {
+        return magmaCadd(magmaCmul(a, b), c);
+    }
+
+    /* float complex, same data layout as the Fortran COMPLEX of the host BLAS */
+    typedef struct {
+
+        // real, imag components
+        float x, y;
+
+    } magmaFloatComplex;
+
+    /* functionality macros */
+    #define MAGMA_C_MAKE(r, i)   ((magmaFloatComplex){(float)(r), (float)(i)})
+    #define MAGMA_C_REAL(a) (a).x
+    #define MAGMA_C_IMAG(a) (a).y
+    #define MAGMA_C_ADD(a, b) magmaCaddf(a, b)
+    #define MAGMA_C_SUB(a, b) magmaCsubf(a, b)
+    #define MAGMA_C_MUL(a, b) magmaCmulf(a, b)
+    #define MAGMA_C_DIV(a, b) magmaCdivf(a, b)
+    #define MAGMA_C_ABS(a) (hypotf(MAGMA_C_REAL(a), MAGMA_C_IMAG(a)))
+    #define MAGMA_C_ABS1(a) (fabsf(MAGMA_C_REAL(a)) + fabsf(MAGMA_C_IMAG(a)))
+    #define MAGMA_C_CONJ(a) magmaConjf(a)
+
+    /* basic arithmetic functions */
+    static inline magmaFloatComplex magmaCaddf(magmaFloatComplex a, magmaFloatComplex b) {
+        return MAGMA_C_MAKE(a.x+b.x, a.y+b.y);
+    }
+    static inline magmaFloatComplex magmaCsubf(magmaFloatComplex a, magmaFloatComplex b) {
+        return MAGMA_C_MAKE(a.x-b.x, a.y-b.y);
+    }
+    static inline magmaFloatComplex magmaCmulf(magmaFloatComplex a, magmaFloatComplex b) {
+        return MAGMA_C_MAKE(a.x*b.x - a.y*b.y, a.x*b.y + a.y*b.x);
+    }
+    static inline magmaFloatComplex magmaCdivf(magmaFloatComplex a, magmaFloatComplex b) {
+        float sqabs = b.x*b.x + b.y*b.y;
+        return MAGMA_C_MAKE(
+            (a.x * b.x + a.y * b.y) / sqabs,
+            (a.y * b.x - a.x * b.y) / sqabs
+        );
+    }
+    static inline magmaFloatComplex magmaConjf(magmaFloatComplex a) {
+        return MAGMA_C_MAKE(a.x, -a.y);
+    }
+    static inline magmaFloatComplex magmaCfmaf(magmaFloatComplex a, magmaFloatComplex b, magmaFloatComplex c) {
+        return magmaCaddf(magmaCmulf(a, b), c);
+    }
+
+    #ifdef __cplusplus
+    }
+    #endif
+
 #elif defined(HAVE_clBLAS)
     #include <clBLAS.h>
 
@@ -468,7 +593,7 @@ typedef double real_Double_t;
     }
     #endif
 #else
-    #error "One of HAVE_CUBLAS, HAVE_HIP, HAVE_clBLAS, or HAVE_MIC must be defined. For example, add -DHAVE_CUBLAS to CFLAGS, or #define HAVE_CUBLAS before #include <magma.h>. In MAGMA, this happens in Makefile."
+    #error "One of HAVE_CUBLAS, HAVE_HIP, HAVE_HOST, HAVE_clBLAS, or HAVE_MIC must be defined. For example, add -DHAVE_CUBLAS to CFLAGS, or #define HAVE_CUBLAS before #include <magma.h>. In MAGMA, this happens in Makefile."
 #endif
 
 #ifdef __cplusplus
@@ -788,7 +913,11 @@ typedef enum {
     Magma_CSRCOO       = 629,
     Magma_CUCSR        = 630,
     Magma_COOLIST      = 631,
-    Magma_CSR5         = 632
+    Magma_CSR5         = 632,
+    Magma_CSRMP        = 633,
+    Magma_AUTO         = 634,
+    Magma_STENCIL      = 635,
+    Magma_VBCSR        = 636
 } magma_storage_t;
 
 
@@ -850,7 +979,9 @@ typedef enum {
     Magma_VBJACOBI     = 508,
     Magma_PARDISO      = 509,
     Magma_SYNCFREESOLVE= 510,
-    Magma_ILUT         = 511
+    Magma_ILUT         = 511,
+    Magma_CACG         = 512,
+    Magma_PIPEGMRES    = 513
 } magma_solver_type;
 
 typedef enum {
@@ -880,7 +1011,8 @@ typedef enum {
     Magma_DCOMPLEX     = 501,
     Magma_FCOMPLEX     = 502,
     Magma_DOUBLE       = 503,
-    Magma_FLOAT        = 504
+    Magma_FLOAT        = 504,
+    Magma_HALF         = 505
 } magma_precision;
 
 typedef enum {
@@ -892,6 +1024,18 @@ typedef enum {
     Magma_UNITDIAGCOL  = 516, // to be deprecated
 } magma_scale_t;
 
+typedef enum {
+    Magma_NOREORDER         = 521,
+    Magma_RCM               = 522,
+    Magma_MINDEGREE         = 523,
+    Magma_NESTEDDISSECTION  = 524
+} magma_reorder_t;
+
+typedef enum {
+    Magma_TUNE_ANALYZE      = 531,
+    Magma_TUNE_BENCHMARK    = 532
+} magma_tune_t;
+
 
 typedef enum {
     Magma_SOLVE        = 801,
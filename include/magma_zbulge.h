@@ -28,6 +28,16 @@ magma_zbulge_applyQ_v2(
     magmaDoubleComplex *T, magma_int_t ldt, 
     magma_int_t *info);
 
+magma_int_t
+magma_zbulge_applyQ_cpu(
+    magma_side_t side, 
+    magma_int_t NE, magma_int_t n, 
+    magma_int_t nb, magma_int_t Vblksiz, 
+    magmaDoubleComplex *E, magma_int_t lde, 
+    magmaDoubleComplex *V, magma_int_t ldv, 
+    magmaDoubleComplex *T, magma_int_t ldt, 
+    magma_int_t *info);
+
 magma_int_t
 magma_zbulge_applyQ_v2_m(
     magma_int_t ngpu, magma_side_t side, 
@@ -0,0 +1,3080 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from interface_host/blas_z_v2.cpp, normal z -> c, Fri Oct 16 19:39:54 2026
+*/
+#include "host_stream.hpp"
+#include "error.h"
+
+#define COMPLEX
+
+#define PRECISION_c
+
+#ifdef HAVE_HOST
+
+// In the host backend, device memory is host memory and each queue is a
+// worker thread. BLAS routines that update device memory push a task to the
+// queue's worker thread, which calls the host BLAS; routines that return a
+// value wait for the queue first, then call the host BLAS directly.
+
+#ifdef REAL
+// modified Givens rotations are not in magma_clapack.h
+#define blasf77_crotm      FORTRAN_NAME( crotm,  CROTM  )
+#define blasf77_crotmg     FORTRAN_NAME( crotmg, CROTMG )
+
+extern "C"
+void blasf77_crotm(  const magma_int_t *n,
+                     float *x, const magma_int_t *incx,
+                     float *y, const magma_int_t *incy,
+                     const float *param );
+
+extern "C"
+void blasf77_crotmg( float *d1, float *d2,
+                     float *x1, const float *y1,
+                     float *param );
+#endif // REAL
+
+// =============================================================================
+// Level 1 BLAS
+
+/***************************************************************************//**
+    @return Index of element of vector x having max. absolute value;
+            \f$ \text{argmax}_i\; | real(x_i) | + | imag(x_i) | \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_iamax
+*******************************************************************************/
+extern "C" magma_int_t
+magma_icamax(
+    magma_int_t n,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return blasf77_icamax( &n, dx, &incx );
+}
+
+
+/***************************************************************************//**
+    @return Index of element of vector x having min. absolute value;
+            \f$ \text{argmin}_i\; | real(x_i) | + | imag(x_i) | \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_iamin
+*******************************************************************************/
+extern "C" magma_int_t
+magma_icamin(
+    magma_int_t n,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    // BLAS has no icamin; like icamax, this returns a 1-based index
+    magma_int_t result = 0;
+    float minval = 0;
+    for( magma_int_t i=0; i < n; ++i ) {
+        float val = MAGMA_C_ABS1( dx[ i*incx ] );
+        if ( i == 0 || val < minval ) {
+            minval = val;
+            result = i + 1;
+        }
+    }
+    return result;
+}
+
+
+/***************************************************************************//**
+    @return Sum of absolute values of vector x;
+            \f$ \sum_i | real(x_i) | + | imag(x_i) | \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_asum
+*******************************************************************************/
+extern "C" float
+magma_scasum(
+    magma_int_t n,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_scasum( n, dx, incx );
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to caxpy (on the worker thread of a queue)
+class magma_caxpy_task: public magma_task
+{
+public:
+    magma_caxpy_task(
+        magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_ptr       in_dy, magma_int_t in_incy
+    ):
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_caxpy( &n, &alpha, dx, &incx, dy, &incy );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Constant times a vector plus a vector; \f$ y = \alpha x + y \f$.
+
+    @param[in]
+    n       Number of elements in vectors x and y. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_axpy
+*******************************************************************************/
+extern "C" void
+magma_caxpy(
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_caxpy_task(
+        n, alpha, dx, incx, dy, incy ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to ccopy (on the worker thread of a queue)
+class magma_ccopy_task: public magma_task
+{
+public:
+    magma_ccopy_task(
+        magma_int_t in_n,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_ptr       in_dy, magma_int_t in_incy
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy )
+    {}
+
+    virtual void run()
+    {
+        blasf77_ccopy( &n, dx, &incx, dy, &incy );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Copy vector x to vector y; \f$ y = x \f$.
+
+    @param[in]
+    n       Number of elements in vectors x and y. n >= 0.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[out]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_copy
+*******************************************************************************/
+extern "C" void
+magma_ccopy(
+    magma_int_t n,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_ccopy_task(
+        n, dx, incx, dy, incy ));
+}
+
+
+#ifdef COMPLEX
+/***************************************************************************//**
+    @return Dot product of vectors x and y; \f$ x^H y \f$.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma__dot
+*******************************************************************************/
+extern "C"
+magmaFloatComplex magma_cdotc(
+    magma_int_t n,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex_const_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_cdotc( n, dx, incx, dy, incy );
+}
+#endif // COMPLEX
+
+
+/***************************************************************************//**
+    @return Dot product (unconjugated) of vectors x and y; \f$ x^T y \f$.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma__dot
+*******************************************************************************/
+extern "C"
+magmaFloatComplex magma_cdotu(
+    magma_int_t n,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex_const_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_cdotu( n, dx, incx, dy, incy );
+}
+
+
+/***************************************************************************//**
+    @return 2-norm of vector x; \f$ \text{sqrt}( x^H x ) \f$.
+            Avoids unnecesary over/underflow.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_nrm2
+*******************************************************************************/
+extern "C" float
+magma_scnrm2(
+    magma_int_t n,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_scnrm2( n, dx, incx );
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to crot (on the worker thread of a queue)
+class magma_crot_task: public magma_task
+{
+public:
+    magma_crot_task(
+        magma_int_t in_n,
+        magmaFloatComplex_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_ptr in_dy, magma_int_t in_incy,
+        float in_c, magmaFloatComplex in_s
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy ),
+        c   ( in_c    ),
+        s   ( in_s    )
+    {}
+
+    virtual void run()
+    {
+        blasf77_crot( &n, dx, &incx, dy, &incy, &c, &s );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaFloatComplex_ptr       dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_ptr       dy;
+    magma_int_t                  incy;
+    float                       c;
+    magmaFloatComplex           s;
+};
+
+
+/***************************************************************************//**
+    Apply Givens plane rotation, where cos (c) is real and sin (s) is complex.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in,out]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+            On output, overwritten with c*x + s*y.
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+            On output, overwritten with -conj(s)*x + c*y.
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    c       float. cosine.
+
+    @param[in]
+    s       COMPLEX. sine. c and s define a rotation
+            [ c         s ]  where c*c + s*conj(s) = 1.
+            [ -conj(s)  c ]
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_rot
+*******************************************************************************/
+extern "C" void
+magma_crot(
+    magma_int_t n,
+    magmaFloatComplex_ptr dx, magma_int_t incx,
+    magmaFloatComplex_ptr dy, magma_int_t incy,
+    float c, magmaFloatComplex s,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_crot_task(
+        n, dx, incx, dy, incy, c, s ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to csrot (on the worker thread of a queue)
+class magma_csrot_task: public magma_task
+{
+public:
+    magma_csrot_task(
+        magma_int_t in_n,
+        magmaFloatComplex_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_ptr in_dy, magma_int_t in_incy,
+        float in_c, float in_s
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy ),
+        c   ( in_c    ),
+        s   ( in_s    )
+    {}
+
+    virtual void run()
+    {
+        blasf77_csrot( &n, dx, &incx, dy, &incy, &c, &s );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaFloatComplex_ptr       dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_ptr       dy;
+    magma_int_t                  incy;
+    float                       c;
+    float                       s;
+};
+
+
+/***************************************************************************//**
+    Apply Givens plane rotation, where cos (c) and sin (s) are real.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in,out]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+            On output, overwritten with c*x + s*y.
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+            On output, overwritten with -conj(s)*x + c*y.
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    c       float. cosine.
+
+    @param[in]
+    s       float. sine. c and s define a rotation
+            [  c  s ]  where c*c + s*s = 1.
+            [ -s  c ]
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_rot
+*******************************************************************************/
+extern "C" void
+magma_csrot(
+    magma_int_t n,
+    magmaFloatComplex_ptr dx, magma_int_t incx,
+    magmaFloatComplex_ptr dy, magma_int_t incy,
+    float c, float s,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_csrot_task(
+        n, dx, incx, dy, incy, c, s ));
+}
+#endif // COMPLEX
+
+
+/***************************************************************************//**
+    Generate a Givens plane rotation.
+    The rotation annihilates the second entry of the vector, such that:
+
+        (  c  s ) * ( a ) = ( r )
+        ( -s  c )   ( b )   ( 0 )
+
+    where \f$ c^2 + s^2 = 1 \f$ and \f$ r = a^2 + b^2 \f$.
+    Further, this computes z such that
+
+                { (sqrt(1 - z^2), z),    if |z| < 1,
+        (c,s) = { (0, 1),                if |z| = 1,
+                { (1/z, sqrt(1 - z^2)),  if |z| > 1.
+
+    @param[in]
+    a       On input, entry to be modified.
+            On output, updated to r by applying the rotation.
+
+    @param[in,out]
+    b       On input, entry to be annihilated.
+            On output, set to z.
+
+    @param[in]
+    c       On output, cosine of rotation.
+
+    @param[in,out]
+    s       On output, sine of rotation.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_rotg
+*******************************************************************************/
+extern "C" void
+magma_crotg(
+    magmaFloatComplex *a, magmaFloatComplex *b,
+    float             *c, magmaFloatComplex *s,
+    magma_queue_t queue )
+{
+    // a, b, c, s are on the host, as with CUBLAS_POINTER_MODE_HOST
+    magma_queue_sync( queue );
+    blasf77_crotg( a, b, c, s );
+}
+
+
+#ifdef REAL
+// ---------------------------------------------
+// stores arguments and executes call to crotm (on the worker thread of a queue)
+class magma_crotm_task: public magma_task
+{
+public:
+    magma_crotm_task(
+        magma_int_t in_n,
+        float *in_dx, magma_int_t in_incx,
+        float *in_dy, magma_int_t in_incy,
+        const float *in_param
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy )
+    {
+        // param is on the host and may change before the task runs
+        for( int i=0; i < 5; ++i ) {
+            param[i] = in_param[i];
+        }
+    }
+
+    virtual void run()
+    {
+        blasf77_crotm( &n, dx, &incx, dy, &incy, param );
+    }
+
+private:
+    magma_int_t n;
+    float     *dx;
+    magma_int_t incx;
+    float     *dy;
+    magma_int_t incy;
+    float      param[5];
+};
+
+
+/***************************************************************************//**
+    Apply modified plane rotation.
+
+    @ingroup magma_rotm
+*******************************************************************************/
+extern "C" void
+magma_crotm(
+    magma_int_t n,
+    float *dx, magma_int_t incx,
+    float *dy, magma_int_t incy,
+    const float *param,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_crotm_task(
+        n, dx, incx, dy, incy, param ));
+}
+#endif // REAL
+
+
+#ifdef REAL
+/***************************************************************************//**
+    Generate modified plane rotation.
+
+    @ingroup magma_rotmg
+*******************************************************************************/
+extern "C" void
+magma_crotmg(
+    float *d1, float       *d2,
+    float *x1, const float *y1,
+    float *param,
+    magma_queue_t queue )
+{
+    // d1, d2, x1, y1, param are on the host, as with CUBLAS_POINTER_MODE_HOST
+    magma_queue_sync( queue );
+    blasf77_crotmg( d1, d2, x1, y1, param );
+}
+#endif // REAL
+
+
+// ---------------------------------------------
+// stores arguments and executes call to cscal (on the worker thread of a queue)
+class magma_cscal_task: public magma_task
+{
+public:
+    magma_cscal_task(
+        magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_ptr in_dx, magma_int_t in_incx
+    ):
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_cscal( &n, &alpha, dx, &incx );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Scales a vector by a constant; \f$ x = \alpha x \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in,out]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_scal
+*******************************************************************************/
+extern "C" void
+magma_cscal(
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_cscal_task(
+        n, alpha, dx, incx ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to csscal (on the worker thread of a queue)
+class magma_csscal_task: public magma_task
+{
+public:
+    magma_csscal_task(
+        magma_int_t in_n,
+        float in_alpha,
+        magmaFloatComplex_ptr in_dx, magma_int_t in_incx
+    ):
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_csscal( &n, &alpha, dx, &incx );
+    }
+
+private:
+    magma_int_t                  n;
+    float                       alpha;
+    magmaFloatComplex_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Scales a vector by a real constant; \f$ x = \alpha x \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$ (real)
+
+    @param[in,out]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_scal
+*******************************************************************************/
+extern "C" void
+magma_csscal(
+    magma_int_t n,
+    float alpha,
+    magmaFloatComplex_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_csscal_task(
+        n, alpha, dx, incx ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to cswap (on the worker thread of a queue)
+class magma_cswap_task: public magma_task
+{
+public:
+    magma_cswap_task(
+        magma_int_t in_n,
+        magmaFloatComplex_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_ptr in_dy, magma_int_t in_incy
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy )
+    {}
+
+    virtual void run()
+    {
+        blasf77_cswap( &n, dx, &incx, dy, &incy );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaFloatComplex_ptr       dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Swap vector x and y; \f$ x <-> y \f$.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in,out]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_swap
+*******************************************************************************/
+extern "C" void
+magma_cswap(
+    magma_int_t n,
+    magmaFloatComplex_ptr dx, magma_int_t incx,
+    magmaFloatComplex_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_cswap_task(
+        n, dx, incx, dy, incy ));
+}
+
+
+// =============================================================================
+// Level 2 BLAS
+
+// ---------------------------------------------
+// stores arguments and executes call to cgemv (on the worker thread of a queue)
+class magma_cgemv_task: public magma_task
+{
+public:
+    magma_cgemv_task(
+        magma_trans_t in_transA,
+        magma_int_t in_m, magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex in_beta,
+        magmaFloatComplex_ptr       in_dy, magma_int_t in_incy
+    ):
+        transA( in_transA ),
+        m     ( in_m      ),
+        n     ( in_n      ),
+        alpha ( in_alpha  ),
+        dA    ( in_dA     ),
+        ldda  ( in_ldda   ),
+        dx    ( in_dx     ),
+        incx  ( in_incx   ),
+        beta  ( in_beta   ),
+        dy    ( in_dy     ),
+        incy  ( in_incy   )
+    {}
+
+    virtual void run()
+    {
+        blasf77_cgemv( lapack_trans_const( transA ), &m, &n,
+                       &alpha, dA, &ldda,
+                               dx, &incx,
+                       &beta,  dy, &incy );
+    }
+
+private:
+    magma_trans_t                transA;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex           beta;
+    magmaFloatComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Perform matrix-vector product.
+        \f$ y = \alpha A   x + \beta y \f$  (transA == MagmaNoTrans), or \n
+        \f$ y = \alpha A^T x + \beta y \f$  (transA == MagmaTrans),   or \n
+        \f$ y = \alpha A^H x + \beta y \f$  (transA == MagmaConjTrans).
+
+    @param[in]
+    transA  Operation to perform on A.
+
+    @param[in]
+    m       Number of rows of A. m >= 0.
+
+    @param[in]
+    n       Number of columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array of dimension (ldda,n), ldda >= max(1,m).
+            The m-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            If transA == MagmaNoTrans, the n element vector x of dimension (1 + (n-1)*incx); \n
+            otherwise,                 the m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dy      COMPLEX array on the device.
+            If transA == MagmaNoTrans, the m element vector y of dimension (1 + (m-1)*incy); \n
+            otherwise,                 the n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_gemv
+*******************************************************************************/
+extern "C" void
+magma_cgemv(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_cgemv_task(
+        transA, m, n, alpha, dA, ldda, dx, incx, beta, dy, incy ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to cgerc (on the worker thread of a queue)
+class magma_cgerc_task: public magma_task
+{
+public:
+    magma_cgerc_task(
+        magma_int_t in_m, magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_const_ptr in_dy, magma_int_t in_incy,
+        magmaFloatComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_cgerc( &m, &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+    }
+
+private:
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_const_ptr dy;
+    magma_int_t                  incy;
+    magmaFloatComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform rank-1 update, \f$ A = \alpha x y^H + A \f$.
+
+    @param[in]
+    m       Number of rows of A. m >= 0.
+
+    @param[in]
+    n       Number of columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      COMPLEX array on the device.
+            The m-by-n matrix A of dimension (ldda,n), ldda >= max(1,m).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_ger
+*******************************************************************************/
+extern "C" void
+magma_cgerc(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex_const_ptr dy, magma_int_t incy,
+    magmaFloatComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_cgerc_task(
+        m, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to cgeru (on the worker thread of a queue)
+class magma_cgeru_task: public magma_task
+{
+public:
+    magma_cgeru_task(
+        magma_int_t in_m, magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_const_ptr in_dy, magma_int_t in_incy,
+        magmaFloatComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_cgeru( &m, &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+    }
+
+private:
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_const_ptr dy;
+    magma_int_t                  incy;
+    magmaFloatComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform rank-1 update (unconjugated), \f$ A = \alpha x y^T + A \f$.
+
+    @param[in]
+    m       Number of rows of A. m >= 0.
+
+    @param[in]
+    n       Number of columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      COMPLEX array of dimension (ldda,n), ldda >= max(1,m).
+            The m-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_ger
+*******************************************************************************/
+extern "C" void
+magma_cgeru(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex_const_ptr dy, magma_int_t incy,
+    magmaFloatComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_cgeru_task(
+        m, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to chemv (on the worker thread of a queue)
+class magma_chemv_task: public magma_task
+{
+public:
+    magma_chemv_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex in_beta,
+        magmaFloatComplex_ptr       in_dy, magma_int_t in_incy
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        beta ( in_beta  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_chemv( lapack_uplo_const( uplo ), &n,
+                       &alpha, dA, &ldda,
+                               dx, &incx,
+                       &beta,  dy, &incy );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex           beta;
+    magmaFloatComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian matrix-vector product, \f$ y = \alpha A x + \beta y, \f$
+    where \f$ A \f$ is Hermitian.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_hemv
+*******************************************************************************/
+extern "C" void
+magma_chemv(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_chemv_task(
+        uplo, n, alpha, dA, ldda, dx, incx, beta, dy, incy ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to cher (on the worker thread of a queue)
+class magma_cher_task: public magma_task
+{
+public:
+    magma_cher_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        float in_alpha,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_cher( lapack_uplo_const( uplo ), &n,
+                      &alpha, dx, &incx,
+                              dA, &ldda );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    float                       alpha;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian rank-1 update, \f$ A = \alpha x x^H + A, \f$
+    where \f$ A \f$ is Hermitian.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dA      COMPLEX array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_her
+*******************************************************************************/
+extern "C" void
+magma_cher(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    float alpha,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_cher_task(
+        uplo, n, alpha, dx, incx, dA, ldda ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to cher2 (on the worker thread of a queue)
+class magma_cher2_task: public magma_task
+{
+public:
+    magma_cher2_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_const_ptr in_dy, magma_int_t in_incy,
+        magmaFloatComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_cher2( lapack_uplo_const( uplo ), &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_const_ptr dy;
+    magma_int_t                  incy;
+    magmaFloatComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian rank-2 update, \f$ A = \alpha x y^H + conj(\alpha) y x^H + A, \f$
+    where \f$ A \f$ is Hermitian.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      COMPLEX array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_her2
+*******************************************************************************/
+extern "C" void
+magma_cher2(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex_const_ptr dy, magma_int_t incy,
+    magmaFloatComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_cher2_task(
+        uplo, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to csymv (on the worker thread of a queue)
+class magma_csymv_task: public magma_task
+{
+public:
+    magma_csymv_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex in_beta,
+        magmaFloatComplex_ptr       in_dy, magma_int_t in_incy
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        beta ( in_beta  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  )
+    {}
+
+    virtual void run()
+    {
+#ifdef COMPLEX
+        lapackf77_csymv( lapack_uplo_const( uplo ), &n,
+                         &alpha, dA, &ldda,
+                                 dx, &incx,
+                         &beta,  dy, &incy );
+#else
+        blasf77_chemv( lapack_uplo_const( uplo ), &n,
+                       &alpha, dA, &ldda,
+                               dx, &incx,
+                       &beta,  dy, &incy );
+#endif
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex           beta;
+    magmaFloatComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric matrix-vector product, \f$ y = \alpha A x + \beta y, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_symv
+*******************************************************************************/
+extern "C" void
+magma_csymv(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_csymv_task(
+        uplo, n, alpha, dA, ldda, dx, incx, beta, dy, incy ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to csyr (on the worker thread of a queue)
+class magma_csyr_task: public magma_task
+{
+public:
+    magma_csyr_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+#ifdef COMPLEX
+        lapackf77_csyr( lapack_uplo_const( uplo ), &n,
+                        &alpha, dx, &incx,
+                                dA, &ldda );
+#else
+        blasf77_cher( lapack_uplo_const( uplo ), &n,
+                      &alpha, dx, &incx,
+                              dA, &ldda );
+#endif
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-1 update, \f$ A = \alpha x x^T + A, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dA      COMPLEX array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syr
+*******************************************************************************/
+extern "C" void
+magma_csyr(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_csyr_task(
+        uplo, n, alpha, dx, incx, dA, ldda ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to csyr2 (on the worker thread of a queue)
+class magma_csyr2_task: public magma_task
+{
+public:
+    magma_csyr2_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaFloatComplex_const_ptr in_dy, magma_int_t in_incy,
+        magmaFloatComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+#ifdef COMPLEX
+        // there is no complex symmetric rank-2 update in BLAS or LAPACK;
+        // use csyr2k with k = 1, which needs x and y with unit stride
+        const magmaFloatComplex c_one = MAGMA_C_ONE;
+        const magma_int_t ione = 1;
+        magmaFloatComplex *x = (magmaFloatComplex*) dx;
+        magmaFloatComplex *y = (magmaFloatComplex*) dy;
+        if ( incx != 1 || incy != 1 ) {
+            x = new magmaFloatComplex[ 2*n ];
+            y = x + n;
+            blasf77_ccopy( &n, dx, &incx, x, &ione );
+            blasf77_ccopy( &n, dy, &incy, y, &ione );
+        }
+        blasf77_csyr2k( lapack_uplo_const( uplo ), MagmaNoTransStr, &n, &ione,
+                        &alpha, x, &n,
+                                y, &n,
+                        &c_one, dA, &ldda );
+        if ( x != dx ) {
+            delete[] x;
+        }
+#else
+        blasf77_cher2( lapack_uplo_const( uplo ), &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+#endif
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaFloatComplex_const_ptr dy;
+    magma_int_t                  incy;
+    magmaFloatComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-2 update, \f$ A = \alpha x y^T + \alpha y x^T + A, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      COMPLEX array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syr2
+*******************************************************************************/
+extern "C" void
+magma_csyr2(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex_const_ptr dy, magma_int_t incy,
+    magmaFloatComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_csyr2_task(
+        uplo, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to ctrmv (on the worker thread of a queue)
+class magma_ctrmv_task: public magma_task
+{
+public:
+    magma_ctrmv_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_n,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_ptr       in_dx, magma_int_t in_incx
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        n    ( in_n     ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_ctrmv( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       lapack_diag_const( diag ), &n,
+                       dA, &ldda,
+                       dx, &incx );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  n;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Perform triangular matrix-vector product.
+        \f$ x = A   x \f$  (trans == MagmaNoTrans), or \n
+        \f$ x = A^T x \f$  (trans == MagmaTrans),   or \n
+        \f$ x = A^H x \f$  (trans == MagmaConjTrans).
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    dA      COMPLEX array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      COMPLEX array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trmv
+*******************************************************************************/
+extern "C" void
+magma_ctrmv(
+    magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t n,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_ptr       dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_ctrmv_task(
+        uplo, trans, diag, n, dA, ldda, dx, incx ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to ctrsv (on the worker thread of a queue)
+class magma_ctrsv_task: public magma_task
+{
+public:
+    magma_ctrsv_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_n,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_ptr       in_dx, magma_int_t in_incx
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        n    ( in_n     ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_ctrsv( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       lapack_diag_const( diag ), &n,
+                       dA, &ldda,
+                       dx, &incx );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  n;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Solve triangular matrix-vector system (one right-hand side).
+        \f$ A   x = b \f$  (trans == MagmaNoTrans), or \n
+        \f$ A^T x = b \f$  (trans == MagmaTrans),   or \n
+        \f$ A^H x = b \f$  (trans == MagmaConjTrans).
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    dA      COMPLEX array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in,out]
+    dx      COMPLEX array on the device.
+            On entry, the n element RHS vector b of dimension (1 + (n-1)*incx).
+            On exit, overwritten with the solution vector x.
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trsv
+*******************************************************************************/
+extern "C" void
+magma_ctrsv(
+    magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t n,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_ptr       dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_ctrsv_task(
+        uplo, trans, diag, n, dA, ldda, dx, incx ));
+}
+
+
+// =============================================================================
+// Level 3 BLAS
+
+// ---------------------------------------------
+// stores arguments and executes call to cgemm (on the worker thread of a queue)
+class magma_cgemm_task: public magma_task
+{
+public:
+    magma_cgemm_task(
+        magma_trans_t in_transA, magma_trans_t in_transB,
+        magma_int_t in_m, magma_int_t in_n, magma_int_t in_k,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_const_ptr in_dB, magma_int_t in_lddb,
+        magmaFloatComplex in_beta,
+        magmaFloatComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        transA( in_transA ),
+        transB( in_transB ),
+        m     ( in_m      ),
+        n     ( in_n      ),
+        k     ( in_k      ),
+        alpha ( in_alpha  ),
+        dA    ( in_dA     ),
+        ldda  ( in_ldda   ),
+        dB    ( in_dB     ),
+        lddb  ( in_lddb   ),
+        beta  ( in_beta   ),
+        dC    ( in_dC     ),
+        lddc  ( in_lddc   )
+    {}
+
+    virtual void run()
+    {
+        blasf77_cgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k,
+                       &alpha, dA, &ldda,
+                               dB, &lddb,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_trans_t                transA;
+    magma_trans_t                transB;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_const_ptr dB;
+    magma_int_t                  lddb;
+    magmaFloatComplex           beta;
+    magmaFloatComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform matrix-matrix product, \f$ C = \alpha op(A) op(B) + \beta C \f$.
+
+    @param[in]
+    transA  Operation op(A) to perform on matrix A.
+
+    @param[in]
+    transB  Operation op(B) to perform on matrix B.
+
+    @param[in]
+    m       Number of rows of C and op(A). m >= 0.
+
+    @param[in]
+    n       Number of columns of C and op(B). n >= 0.
+
+    @param[in]
+    k       Number of columns of op(A) and rows of op(B). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array on the device.
+            If transA == MagmaNoTrans, the m-by-k matrix A of dimension (ldda,k), ldda >= max(1,m); \n
+            otherwise,                 the k-by-m matrix A of dimension (ldda,m), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX array on the device.
+            If transB == MagmaNoTrans, the k-by-n matrix B of dimension (lddb,n), lddb >= max(1,k); \n
+            otherwise,                 the n-by-k matrix B of dimension (lddb,k), lddb >= max(1,n).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX array on the device.
+            The m-by-n matrix C of dimension (lddc,n), lddc >= max(1,m).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_gemm
+*******************************************************************************/
+extern "C" void
+magma_cgemm(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dB, magma_int_t lddb,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_cgemm_task(
+        transA, transB, m, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to chemm (on the worker thread of a queue)
+class magma_chemm_task: public magma_task
+{
+public:
+    magma_chemm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo,
+        magma_int_t in_m, magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_const_ptr in_dB, magma_int_t in_lddb,
+        magmaFloatComplex in_beta,
+        magmaFloatComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_chemm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_const_ptr dB;
+    magma_int_t                  lddb;
+    magmaFloatComplex           beta;
+    magmaFloatComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian matrix-matrix product.
+        \f$ C = \alpha A B + \beta C \f$ (side == MagmaLeft), or \n
+        \f$ C = \alpha B A + \beta C \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is Hermitian.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    m       Number of rows of C. m >= 0.
+
+    @param[in]
+    n       Number of columns of C. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array on the device.
+            If side == MagmaLeft, the m-by-m Hermitian matrix A of dimension (ldda,m), ldda >= max(1,m); \n
+            otherwise,            the n-by-n Hermitian matrix A of dimension (ldda,n), ldda >= max(1,n).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX array on the device.
+            The m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX array on the device.
+            The m-by-n matrix C of dimension (lddc,n), lddc >= max(1,m).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_hemm
+*******************************************************************************/
+extern "C" void
+magma_chemm(
+    magma_side_t side, magma_uplo_t uplo,
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dB, magma_int_t lddb,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_chemm_task(
+        side, uplo, m, n, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to cherk (on the worker thread of a queue)
+class magma_cherk_task: public magma_task
+{
+public:
+    magma_cherk_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        float in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        float in_beta,
+        magmaFloatComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_cherk( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       &n, &k,
+                       &alpha, dA, &ldda,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    float                       alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    float                       beta;
+    magmaFloatComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian rank-k update.
+        \f$ C = \alpha A A^H + \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^H A + \beta C \f$ (trans == MagmaConjTrans), \n
+    where \f$ C \f$ is Hermitian.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A (for MagmaNoTrans)
+            or rows of A (for MagmaConjTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX array on the device.
+            The n-by-n Hermitian matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_herk
+*******************************************************************************/
+extern "C" void
+magma_cherk(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    float alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    float beta,
+    magmaFloatComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_cherk_task(
+        uplo, trans, n, k, alpha, dA, ldda, beta, dC, lddc ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to cher2k (on the worker thread of a queue)
+class magma_cher2k_task: public magma_task
+{
+public:
+    magma_cher2k_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_const_ptr in_dB, magma_int_t in_lddb,
+        float in_beta,
+        magmaFloatComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_cher2k( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                        &n, &k,
+                        &alpha, dA, &ldda,
+                                dB, &lddb,
+                        &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_const_ptr dB;
+    magma_int_t                  lddb;
+    float                       beta;
+    magmaFloatComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian rank-2k update.
+        \f$ C = \alpha A B^H + \alpha B A^H \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^H B + \alpha B^H A \beta C \f$ (trans == MagmaConjTrans), \n
+    where \f$ C \f$ is Hermitian.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A and B.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A and B (for MagmaNoTrans)
+            or rows of A and B (for MagmaConjTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix B of dimension (lddb,k), lddb >= max(1,n); \n
+            otherwise,                the k-by-n matrix B of dimension (lddb,n), lddb >= max(1,k).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX array on the device.
+            The n-by-n Hermitian matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_her2k
+*******************************************************************************/
+extern "C" void
+magma_cher2k(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dB, magma_int_t lddb,
+    float beta,
+    magmaFloatComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_cher2k_task(
+        uplo, trans, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to csymm (on the worker thread of a queue)
+class magma_csymm_task: public magma_task
+{
+public:
+    magma_csymm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo,
+        magma_int_t in_m, magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_const_ptr in_dB, magma_int_t in_lddb,
+        magmaFloatComplex in_beta,
+        magmaFloatComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_csymm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_const_ptr dB;
+    magma_int_t                  lddb;
+    magmaFloatComplex           beta;
+    magmaFloatComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric matrix-matrix product.
+        \f$ C = \alpha A B + \beta C \f$ (side == MagmaLeft), or \n
+        \f$ C = \alpha B A + \beta C \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    m       Number of rows of C. m >= 0.
+
+    @param[in]
+    n       Number of columns of C. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array on the device.
+            If side == MagmaLeft, the m-by-m symmetric matrix A of dimension (ldda,m), ldda >= max(1,m); \n
+            otherwise,            the n-by-n symmetric matrix A of dimension (ldda,n), ldda >= max(1,n).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX array on the device.
+            The m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX array on the device.
+            The m-by-n matrix C of dimension (lddc,n), lddc >= max(1,m).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_symm
+*******************************************************************************/
+extern "C" void
+magma_csymm(
+    magma_side_t side, magma_uplo_t uplo,
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dB, magma_int_t lddb,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_csymm_task(
+        side, uplo, m, n, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to csyrk (on the worker thread of a queue)
+class magma_csyrk_task: public magma_task
+{
+public:
+    magma_csyrk_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex in_beta,
+        magmaFloatComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_csyrk( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       &n, &k,
+                       &alpha, dA, &ldda,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex           beta;
+    magmaFloatComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-k update.
+        \f$ C = \alpha A A^T + \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^T A + \beta C \f$ (trans == MagmaTrans),      \n
+    where \f$ C \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A (for MagmaNoTrans)
+            or rows of A (for MagmaTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX array on the device.
+            The n-by-n symmetric matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syrk
+*******************************************************************************/
+extern "C" void
+magma_csyrk(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_csyrk_task(
+        uplo, trans, n, k, alpha, dA, ldda, beta, dC, lddc ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to csyr2k (on the worker thread of a queue)
+class magma_csyr2k_task: public magma_task
+{
+public:
+    magma_csyr2k_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_const_ptr in_dB, magma_int_t in_lddb,
+        magmaFloatComplex in_beta,
+        magmaFloatComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_csyr2k( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                        &n, &k,
+                        &alpha, dA, &ldda,
+                                dB, &lddb,
+                        &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_const_ptr dB;
+    magma_int_t                  lddb;
+    magmaFloatComplex           beta;
+    magmaFloatComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-2k update.
+        \f$ C = \alpha A B^T + \alpha B A^T \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^T B + \alpha B^T A \beta C \f$ (trans == MagmaTrans),      \n
+    where \f$ C \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A and B.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A and B (for MagmaNoTrans)
+            or rows of A and B (for MagmaTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix B of dimension (lddb,k), lddb >= max(1,n); \n
+            otherwise,                the k-by-n matrix B of dimension (lddb,n), lddb >= max(1,k).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX array on the device.
+            The n-by-n symmetric matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syr2k
+*******************************************************************************/
+extern "C" void
+magma_csyr2k(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dB, magma_int_t lddb,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_csyr2k_task(
+        uplo, trans, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to ctrmm (on the worker thread of a queue)
+class magma_ctrmm_task: public magma_task
+{
+public:
+    magma_ctrmm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_m, magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_ptr       in_dB, magma_int_t in_lddb
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_ctrmm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       lapack_trans_const( trans ), lapack_diag_const( diag ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_ptr       dB;
+    magma_int_t                  lddb;
+};
+
+
+/***************************************************************************//**
+    Perform triangular matrix-matrix product.
+        \f$ B = \alpha op(A) B \f$ (side == MagmaLeft), or \n
+        \f$ B = \alpha B op(A) \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is triangular.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether A is upper or lower triangular.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    m       Number of rows of B. m >= 0.
+
+    @param[in]
+    n       Number of columns of B. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array on the device.
+            If side == MagmaLeft, the n-by-n triangular matrix A of dimension (ldda,n), ldda >= max(1,n); \n
+            otherwise,            the m-by-m triangular matrix A of dimension (ldda,m), ldda >= max(1,m).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX array on the device.
+            The m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trmm
+*******************************************************************************/
+extern "C" void
+magma_ctrmm(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_ctrmm_task(
+        side, uplo, trans, diag, m, n, alpha, dA, ldda, dB, lddb ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to ctrsm (on the worker thread of a queue)
+class magma_ctrsm_task: public magma_task
+{
+public:
+    magma_ctrsm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_m, magma_int_t in_n,
+        magmaFloatComplex in_alpha,
+        magmaFloatComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaFloatComplex_ptr       in_dB, magma_int_t in_lddb
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_ctrsm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       lapack_trans_const( trans ), lapack_diag_const( diag ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaFloatComplex           alpha;
+    magmaFloatComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaFloatComplex_ptr       dB;
+    magma_int_t                  lddb;
+};
+
+
+/***************************************************************************//**
+    Solve triangular matrix-matrix system (multiple right-hand sides).
+        \f$ op(A) X = \alpha B \f$ (side == MagmaLeft), or \n
+        \f$ X op(A) = \alpha B \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is triangular.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether A is upper or lower triangular.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    m       Number of rows of B. m >= 0.
+
+    @param[in]
+    n       Number of columns of B. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX array on the device.
+            If side == MagmaLeft, the m-by-m triangular matrix A of dimension (ldda,m), ldda >= max(1,m); \n
+            otherwise,            the n-by-n triangular matrix A of dimension (ldda,n), ldda >= max(1,n).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in,out]
+    dB      COMPLEX array on the device.
+            On entry, m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+            On exit, overwritten with the solution matrix X.
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magma_ctrsm(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_ctrsm_task(
+        side, uplo, trans, diag, m, n, alpha, dA, ldda, dB, lddb ));
+}
+
+#endif // HAVE_HOST
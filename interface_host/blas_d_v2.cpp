@@ -0,0 +1,3080 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from interface_host/blas_z_v2.cpp, normal z -> d, Fri Oct 16 19:39:54 2026
+*/
+#include "host_stream.hpp"
+#include "error.h"
+
+#define REAL
+
+#define PRECISION_d
+
+#ifdef HAVE_HOST
+
+// In the host backend, device memory is host memory and each queue is a
+// worker thread. BLAS routines that update device memory push a task to the
+// queue's worker thread, which calls the host BLAS; routines that return a
+// value wait for the queue first, then call the host BLAS directly.
+
+#ifdef REAL
+// modified Givens rotations are not in magma_dlapack.h
+#define blasf77_drotm      FORTRAN_NAME( drotm,  DROTM  )
+#define blasf77_drotmg     FORTRAN_NAME( drotmg, DROTMG )
+
+extern "C"
+void blasf77_drotm(  const magma_int_t *n,
+                     double *x, const magma_int_t *incx,
+                     double *y, const magma_int_t *incy,
+                     const double *param );
+
+extern "C"
+void blasf77_drotmg( double *d1, double *d2,
+                     double *x1, const double *y1,
+                     double *param );
+#endif // REAL
+
+// =============================================================================
+// Level 1 BLAS
+
+/***************************************************************************//**
+    @return Index of element of vector x having max. absolute value;
+            \f$ \text{argmax}_i\; | real(x_i) | + | imag(x_i) | \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_iamax
+*******************************************************************************/
+extern "C" magma_int_t
+magma_idamax(
+    magma_int_t n,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return blasf77_idamax( &n, dx, &incx );
+}
+
+
+/***************************************************************************//**
+    @return Index of element of vector x having min. absolute value;
+            \f$ \text{argmin}_i\; | real(x_i) | + | imag(x_i) | \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_iamin
+*******************************************************************************/
+extern "C" magma_int_t
+magma_idamin(
+    magma_int_t n,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    // BLAS has no idamin; like idamax, this returns a 1-based index
+    magma_int_t result = 0;
+    double minval = 0;
+    for( magma_int_t i=0; i < n; ++i ) {
+        double val = MAGMA_D_ABS1( dx[ i*incx ] );
+        if ( i == 0 || val < minval ) {
+            minval = val;
+            result = i + 1;
+        }
+    }
+    return result;
+}
+
+
+/***************************************************************************//**
+    @return Sum of absolute values of vector x;
+            \f$ \sum_i | real(x_i) | + | imag(x_i) | \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_asum
+*******************************************************************************/
+extern "C" double
+magma_dasum(
+    magma_int_t n,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_dasum( n, dx, incx );
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to daxpy (on the worker thread of a queue)
+class magma_daxpy_task: public magma_task
+{
+public:
+    magma_daxpy_task(
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_ptr       in_dy, magma_int_t in_incy
+    ):
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_daxpy( &n, &alpha, dx, &incx, dy, &incy );
+    }
+
+private:
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDouble_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Constant times a vector plus a vector; \f$ y = \alpha x + y \f$.
+
+    @param[in]
+    n       Number of elements in vectors x and y. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_axpy
+*******************************************************************************/
+extern "C" void
+magma_daxpy(
+    magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magmaDouble_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_daxpy_task(
+        n, alpha, dx, incx, dy, incy ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dcopy (on the worker thread of a queue)
+class magma_dcopy_task: public magma_task
+{
+public:
+    magma_dcopy_task(
+        magma_int_t in_n,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_ptr       in_dy, magma_int_t in_incy
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dcopy( &n, dx, &incx, dy, &incy );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDouble_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Copy vector x to vector y; \f$ y = x \f$.
+
+    @param[in]
+    n       Number of elements in vectors x and y. n >= 0.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[out]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_copy
+*******************************************************************************/
+extern "C" void
+magma_dcopy(
+    magma_int_t n,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magmaDouble_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dcopy_task(
+        n, dx, incx, dy, incy ));
+}
+
+
+#ifdef COMPLEX
+/***************************************************************************//**
+    @return Dot product of vectors x and y; \f$ x^H y \f$.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma__dot
+*******************************************************************************/
+extern "C"
+double magma_ddot(
+    magma_int_t n,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magmaDouble_const_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_ddot( n, dx, incx, dy, incy );
+}
+#endif // COMPLEX
+
+
+/***************************************************************************//**
+    @return Dot product (unconjugated) of vectors x and y; \f$ x^T y \f$.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma__dot
+*******************************************************************************/
+extern "C"
+double magma_ddot(
+    magma_int_t n,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magmaDouble_const_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_ddot( n, dx, incx, dy, incy );
+}
+
+
+/***************************************************************************//**
+    @return 2-norm of vector x; \f$ \text{sqrt}( x^H x ) \f$.
+            Avoids unnecesary over/underflow.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_nrm2
+*******************************************************************************/
+extern "C" double
+magma_dnrm2(
+    magma_int_t n,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_dnrm2( n, dx, incx );
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to drot (on the worker thread of a queue)
+class magma_drot_task: public magma_task
+{
+public:
+    magma_drot_task(
+        magma_int_t in_n,
+        magmaDouble_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_ptr in_dy, magma_int_t in_incy,
+        double in_c, double in_s
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy ),
+        c   ( in_c    ),
+        s   ( in_s    )
+    {}
+
+    virtual void run()
+    {
+        blasf77_drot( &n, dx, &incx, dy, &incy, &c, &s );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaDouble_ptr       dx;
+    magma_int_t                  incx;
+    magmaDouble_ptr       dy;
+    magma_int_t                  incy;
+    double                       c;
+    double           s;
+};
+
+
+/***************************************************************************//**
+    Apply Givens plane rotation, where cos (c) is real and sin (s) is real.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in,out]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+            On output, overwritten with c*x + s*y.
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+            On output, overwritten with -conj(s)*x + c*y.
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    c       double. cosine.
+
+    @param[in]
+    s       DOUBLE PRECISION. sine. c and s define a rotation
+            [ c         s ]  where c*c + s*conj(s) = 1.
+            [ -conj(s)  c ]
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_rot
+*******************************************************************************/
+extern "C" void
+magma_drot(
+    magma_int_t n,
+    magmaDouble_ptr dx, magma_int_t incx,
+    magmaDouble_ptr dy, magma_int_t incy,
+    double c, double s,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_drot_task(
+        n, dx, incx, dy, incy, c, s ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to drot (on the worker thread of a queue)
+class magma_drot_task: public magma_task
+{
+public:
+    magma_drot_task(
+        magma_int_t in_n,
+        magmaDouble_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_ptr in_dy, magma_int_t in_incy,
+        double in_c, double in_s
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy ),
+        c   ( in_c    ),
+        s   ( in_s    )
+    {}
+
+    virtual void run()
+    {
+        blasf77_drot( &n, dx, &incx, dy, &incy, &c, &s );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaDouble_ptr       dx;
+    magma_int_t                  incx;
+    magmaDouble_ptr       dy;
+    magma_int_t                  incy;
+    double                       c;
+    double                       s;
+};
+
+
+/***************************************************************************//**
+    Apply Givens plane rotation, where cos (c) and sin (s) are real.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in,out]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+            On output, overwritten with c*x + s*y.
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+            On output, overwritten with -conj(s)*x + c*y.
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    c       double. cosine.
+
+    @param[in]
+    s       double. sine. c and s define a rotation
+            [  c  s ]  where c*c + s*s = 1.
+            [ -s  c ]
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_rot
+*******************************************************************************/
+extern "C" void
+magma_drot(
+    magma_int_t n,
+    magmaDouble_ptr dx, magma_int_t incx,
+    magmaDouble_ptr dy, magma_int_t incy,
+    double c, double s,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_drot_task(
+        n, dx, incx, dy, incy, c, s ));
+}
+#endif // COMPLEX
+
+
+/***************************************************************************//**
+    Generate a Givens plane rotation.
+    The rotation annihilates the second entry of the vector, such that:
+
+        (  c  s ) * ( a ) = ( r )
+        ( -s  c )   ( b )   ( 0 )
+
+    where \f$ c^2 + s^2 = 1 \f$ and \f$ r = a^2 + b^2 \f$.
+    Further, this computes z such that
+
+                { (sqrt(1 - z^2), z),    if |z| < 1,
+        (c,s) = { (0, 1),                if |z| = 1,
+                { (1/z, sqrt(1 - z^2)),  if |z| > 1.
+
+    @param[in]
+    a       On input, entry to be modified.
+            On output, updated to r by applying the rotation.
+
+    @param[in,out]
+    b       On input, entry to be annihilated.
+            On output, set to z.
+
+    @param[in]
+    c       On output, cosine of rotation.
+
+    @param[in,out]
+    s       On output, sine of rotation.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_rotg
+*******************************************************************************/
+extern "C" void
+magma_drotg(
+    double *a, double *b,
+    double             *c, double *s,
+    magma_queue_t queue )
+{
+    // a, b, c, s are on the host, as with CUBLAS_POINTER_MODE_HOST
+    magma_queue_sync( queue );
+    blasf77_drotg( a, b, c, s );
+}
+
+
+#ifdef REAL
+// ---------------------------------------------
+// stores arguments and executes call to drotm (on the worker thread of a queue)
+class magma_drotm_task: public magma_task
+{
+public:
+    magma_drotm_task(
+        magma_int_t in_n,
+        double *in_dx, magma_int_t in_incx,
+        double *in_dy, magma_int_t in_incy,
+        const double *in_param
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy )
+    {
+        // param is on the host and may change before the task runs
+        for( int i=0; i < 5; ++i ) {
+            param[i] = in_param[i];
+        }
+    }
+
+    virtual void run()
+    {
+        blasf77_drotm( &n, dx, &incx, dy, &incy, param );
+    }
+
+private:
+    magma_int_t n;
+    double     *dx;
+    magma_int_t incx;
+    double     *dy;
+    magma_int_t incy;
+    double      param[5];
+};
+
+
+/***************************************************************************//**
+    Apply modified plane rotation.
+
+    @ingroup magma_rotm
+*******************************************************************************/
+extern "C" void
+magma_drotm(
+    magma_int_t n,
+    double *dx, magma_int_t incx,
+    double *dy, magma_int_t incy,
+    const double *param,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_drotm_task(
+        n, dx, incx, dy, incy, param ));
+}
+#endif // REAL
+
+
+#ifdef REAL
+/***************************************************************************//**
+    Generate modified plane rotation.
+
+    @ingroup magma_rotmg
+*******************************************************************************/
+extern "C" void
+magma_drotmg(
+    double *d1, double       *d2,
+    double *x1, const double *y1,
+    double *param,
+    magma_queue_t queue )
+{
+    // d1, d2, x1, y1, param are on the host, as with CUBLAS_POINTER_MODE_HOST
+    magma_queue_sync( queue );
+    blasf77_drotmg( d1, d2, x1, y1, param );
+}
+#endif // REAL
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dscal (on the worker thread of a queue)
+class magma_dscal_task: public magma_task
+{
+public:
+    magma_dscal_task(
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_ptr in_dx, magma_int_t in_incx
+    ):
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dscal( &n, &alpha, dx, &incx );
+    }
+
+private:
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Scales a vector by a constant; \f$ x = \alpha x \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in,out]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_scal
+*******************************************************************************/
+extern "C" void
+magma_dscal(
+    magma_int_t n,
+    double alpha,
+    magmaDouble_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dscal_task(
+        n, alpha, dx, incx ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to dscal (on the worker thread of a queue)
+class magma_dscal_task: public magma_task
+{
+public:
+    magma_dscal_task(
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_ptr in_dx, magma_int_t in_incx
+    ):
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dscal( &n, &alpha, dx, &incx );
+    }
+
+private:
+    magma_int_t                  n;
+    double                       alpha;
+    magmaDouble_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Scales a vector by a real constant; \f$ x = \alpha x \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$ (real)
+
+    @param[in,out]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_scal
+*******************************************************************************/
+extern "C" void
+magma_dscal(
+    magma_int_t n,
+    double alpha,
+    magmaDouble_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dscal_task(
+        n, alpha, dx, incx ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dswap (on the worker thread of a queue)
+class magma_dswap_task: public magma_task
+{
+public:
+    magma_dswap_task(
+        magma_int_t in_n,
+        magmaDouble_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_ptr in_dy, magma_int_t in_incy
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dswap( &n, dx, &incx, dy, &incy );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaDouble_ptr       dx;
+    magma_int_t                  incx;
+    magmaDouble_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Swap vector x and y; \f$ x <-> y \f$.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in,out]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_swap
+*******************************************************************************/
+extern "C" void
+magma_dswap(
+    magma_int_t n,
+    magmaDouble_ptr dx, magma_int_t incx,
+    magmaDouble_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dswap_task(
+        n, dx, incx, dy, incy ));
+}
+
+
+// =============================================================================
+// Level 2 BLAS
+
+// ---------------------------------------------
+// stores arguments and executes call to dgemv (on the worker thread of a queue)
+class magma_dgemv_task: public magma_task
+{
+public:
+    magma_dgemv_task(
+        magma_trans_t in_transA,
+        magma_int_t in_m, magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        double in_beta,
+        magmaDouble_ptr       in_dy, magma_int_t in_incy
+    ):
+        transA( in_transA ),
+        m     ( in_m      ),
+        n     ( in_n      ),
+        alpha ( in_alpha  ),
+        dA    ( in_dA     ),
+        ldda  ( in_ldda   ),
+        dx    ( in_dx     ),
+        incx  ( in_incx   ),
+        beta  ( in_beta   ),
+        dy    ( in_dy     ),
+        incy  ( in_incy   )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dgemv( lapack_trans_const( transA ), &m, &n,
+                       &alpha, dA, &ldda,
+                               dx, &incx,
+                       &beta,  dy, &incy );
+    }
+
+private:
+    magma_trans_t                transA;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    double           beta;
+    magmaDouble_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Perform matrix-vector product.
+        \f$ y = \alpha A   x + \beta y \f$  (transA == MagmaNoTrans), or \n
+        \f$ y = \alpha A^T x + \beta y \f$  (transA == MagmaTrans),   or \n
+        \f$ y = \alpha A^H x + \beta y \f$  (transA == MagmaConjTrans).
+
+    @param[in]
+    transA  Operation to perform on A.
+
+    @param[in]
+    m       Number of rows of A. m >= 0.
+
+    @param[in]
+    n       Number of columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array of dimension (ldda,n), ldda >= max(1,m).
+            The m-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            If transA == MagmaNoTrans, the n element vector x of dimension (1 + (n-1)*incx); \n
+            otherwise,                 the m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dy      DOUBLE PRECISION array on the device.
+            If transA == MagmaNoTrans, the m element vector y of dimension (1 + (m-1)*incy); \n
+            otherwise,                 the n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_gemv
+*******************************************************************************/
+extern "C" void
+magma_dgemv(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    double beta,
+    magmaDouble_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dgemv_task(
+        transA, m, n, alpha, dA, ldda, dx, incx, beta, dy, incy ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to dger (on the worker thread of a queue)
+class magma_dger_task: public magma_task
+{
+public:
+    magma_dger_task(
+        magma_int_t in_m, magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_const_ptr in_dy, magma_int_t in_incy,
+        magmaDouble_ptr       in_dA, magma_int_t in_ldda
+    ):
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dger( &m, &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+    }
+
+private:
+    magma_int_t                  m;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDouble_const_ptr dy;
+    magma_int_t                  incy;
+    magmaDouble_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform rank-1 update, \f$ A = \alpha x y^H + A \f$.
+
+    @param[in]
+    m       Number of rows of A. m >= 0.
+
+    @param[in]
+    n       Number of columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      DOUBLE PRECISION array on the device.
+            The m-by-n matrix A of dimension (ldda,n), ldda >= max(1,m).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_ger
+*******************************************************************************/
+extern "C" void
+magma_dger(
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magmaDouble_const_ptr dy, magma_int_t incy,
+    magmaDouble_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dger_task(
+        m, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dger (on the worker thread of a queue)
+class magma_dger_task: public magma_task
+{
+public:
+    magma_dger_task(
+        magma_int_t in_m, magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_const_ptr in_dy, magma_int_t in_incy,
+        magmaDouble_ptr       in_dA, magma_int_t in_ldda
+    ):
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dger( &m, &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+    }
+
+private:
+    magma_int_t                  m;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDouble_const_ptr dy;
+    magma_int_t                  incy;
+    magmaDouble_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform rank-1 update (unconjugated), \f$ A = \alpha x y^T + A \f$.
+
+    @param[in]
+    m       Number of rows of A. m >= 0.
+
+    @param[in]
+    n       Number of columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      DOUBLE PRECISION array of dimension (ldda,n), ldda >= max(1,m).
+            The m-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_ger
+*******************************************************************************/
+extern "C" void
+magma_dger(
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magmaDouble_const_ptr dy, magma_int_t incy,
+    magmaDouble_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dger_task(
+        m, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to dsymv (on the worker thread of a queue)
+class magma_dsymv_task: public magma_task
+{
+public:
+    magma_dsymv_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        double in_beta,
+        magmaDouble_ptr       in_dy, magma_int_t in_incy
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        beta ( in_beta  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dsymv( lapack_uplo_const( uplo ), &n,
+                       &alpha, dA, &ldda,
+                               dx, &incx,
+                       &beta,  dy, &incy );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    double           beta;
+    magmaDouble_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric matrix-vector product, \f$ y = \alpha A x + \beta y, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_hemv
+*******************************************************************************/
+extern "C" void
+magma_dsymv(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    double beta,
+    magmaDouble_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsymv_task(
+        uplo, n, alpha, dA, ldda, dx, incx, beta, dy, incy ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to dsyr (on the worker thread of a queue)
+class magma_dsyr_task: public magma_task
+{
+public:
+    magma_dsyr_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dsyr( lapack_uplo_const( uplo ), &n,
+                      &alpha, dx, &incx,
+                              dA, &ldda );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    double                       alpha;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDouble_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-1 update, \f$ A = \alpha x x^H + A, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dA      DOUBLE PRECISION array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_her
+*******************************************************************************/
+extern "C" void
+magma_dsyr(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magmaDouble_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsyr_task(
+        uplo, n, alpha, dx, incx, dA, ldda ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to dsyr2 (on the worker thread of a queue)
+class magma_dsyr2_task: public magma_task
+{
+public:
+    magma_dsyr2_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_const_ptr in_dy, magma_int_t in_incy,
+        magmaDouble_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dsyr2( lapack_uplo_const( uplo ), &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDouble_const_ptr dy;
+    magma_int_t                  incy;
+    magmaDouble_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-2 update, \f$ A = \alpha x y^H + conj(\alpha) y x^H + A, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      DOUBLE PRECISION array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_her2
+*******************************************************************************/
+extern "C" void
+magma_dsyr2(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magmaDouble_const_ptr dy, magma_int_t incy,
+    magmaDouble_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsyr2_task(
+        uplo, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dsymv (on the worker thread of a queue)
+class magma_dsymv_task: public magma_task
+{
+public:
+    magma_dsymv_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        double in_beta,
+        magmaDouble_ptr       in_dy, magma_int_t in_incy
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        beta ( in_beta  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  )
+    {}
+
+    virtual void run()
+    {
+#ifdef COMPLEX
+        lapackf77_dsymv( lapack_uplo_const( uplo ), &n,
+                         &alpha, dA, &ldda,
+                                 dx, &incx,
+                         &beta,  dy, &incy );
+#else
+        blasf77_dsymv( lapack_uplo_const( uplo ), &n,
+                       &alpha, dA, &ldda,
+                               dx, &incx,
+                       &beta,  dy, &incy );
+#endif
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    double           beta;
+    magmaDouble_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric matrix-vector product, \f$ y = \alpha A x + \beta y, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_symv
+*******************************************************************************/
+extern "C" void
+magma_dsymv(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    double beta,
+    magmaDouble_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsymv_task(
+        uplo, n, alpha, dA, ldda, dx, incx, beta, dy, incy ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dsyr (on the worker thread of a queue)
+class magma_dsyr_task: public magma_task
+{
+public:
+    magma_dsyr_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+#ifdef COMPLEX
+        lapackf77_dsyr( lapack_uplo_const( uplo ), &n,
+                        &alpha, dx, &incx,
+                                dA, &ldda );
+#else
+        blasf77_dsyr( lapack_uplo_const( uplo ), &n,
+                      &alpha, dx, &incx,
+                              dA, &ldda );
+#endif
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDouble_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-1 update, \f$ A = \alpha x x^T + A, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dA      DOUBLE PRECISION array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syr
+*******************************************************************************/
+extern "C" void
+magma_dsyr(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magmaDouble_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsyr_task(
+        uplo, n, alpha, dx, incx, dA, ldda ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dsyr2 (on the worker thread of a queue)
+class magma_dsyr2_task: public magma_task
+{
+public:
+    magma_dsyr2_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dx, magma_int_t in_incx,
+        magmaDouble_const_ptr in_dy, magma_int_t in_incy,
+        magmaDouble_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+#ifdef COMPLEX
+        // there is no real symmetric rank-2 update in BLAS or LAPACK;
+        // use dsyr2k with k = 1, which needs x and y with unit stride
+        const double c_one = MAGMA_D_ONE;
+        const magma_int_t ione = 1;
+        double *x = (double*) dx;
+        double *y = (double*) dy;
+        if ( incx != 1 || incy != 1 ) {
+            x = new double[ 2*n ];
+            y = x + n;
+            blasf77_dcopy( &n, dx, &incx, x, &ione );
+            blasf77_dcopy( &n, dy, &incy, y, &ione );
+        }
+        blasf77_dsyr2k( lapack_uplo_const( uplo ), MagmaNoTransStr, &n, &ione,
+                        &alpha, x, &n,
+                                y, &n,
+                        &c_one, dA, &ldda );
+        if ( x != dx ) {
+            delete[] x;
+        }
+#else
+        blasf77_dsyr2( lapack_uplo_const( uplo ), &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+#endif
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDouble_const_ptr dy;
+    magma_int_t                  incy;
+    magmaDouble_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-2 update, \f$ A = \alpha x y^T + \alpha y x^T + A, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      DOUBLE PRECISION array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      DOUBLE PRECISION array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syr2
+*******************************************************************************/
+extern "C" void
+magma_dsyr2(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dx, magma_int_t incx,
+    magmaDouble_const_ptr dy, magma_int_t incy,
+    magmaDouble_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsyr2_task(
+        uplo, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dtrmv (on the worker thread of a queue)
+class magma_dtrmv_task: public magma_task
+{
+public:
+    magma_dtrmv_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_n,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_ptr       in_dx, magma_int_t in_incx
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        n    ( in_n     ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dtrmv( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       lapack_diag_const( diag ), &n,
+                       dA, &ldda,
+                       dx, &incx );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  n;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Perform triangular matrix-vector product.
+        \f$ x = A   x \f$  (trans == MagmaNoTrans), or \n
+        \f$ x = A^T x \f$  (trans == MagmaTrans),   or \n
+        \f$ x = A^H x \f$  (trans == MagmaConjTrans).
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    dA      DOUBLE PRECISION array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      DOUBLE PRECISION array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trmv
+*******************************************************************************/
+extern "C" void
+magma_dtrmv(
+    magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t n,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr       dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dtrmv_task(
+        uplo, trans, diag, n, dA, ldda, dx, incx ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dtrsv (on the worker thread of a queue)
+class magma_dtrsv_task: public magma_task
+{
+public:
+    magma_dtrsv_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_n,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_ptr       in_dx, magma_int_t in_incx
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        n    ( in_n     ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dtrsv( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       lapack_diag_const( diag ), &n,
+                       dA, &ldda,
+                       dx, &incx );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  n;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Solve triangular matrix-vector system (one right-hand side).
+        \f$ A   x = b \f$  (trans == MagmaNoTrans), or \n
+        \f$ A^T x = b \f$  (trans == MagmaTrans),   or \n
+        \f$ A^H x = b \f$  (trans == MagmaConjTrans).
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    dA      DOUBLE PRECISION array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in,out]
+    dx      DOUBLE PRECISION array on the device.
+            On entry, the n element RHS vector b of dimension (1 + (n-1)*incx).
+            On exit, overwritten with the solution vector x.
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trsv
+*******************************************************************************/
+extern "C" void
+magma_dtrsv(
+    magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t n,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr       dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dtrsv_task(
+        uplo, trans, diag, n, dA, ldda, dx, incx ));
+}
+
+
+// =============================================================================
+// Level 3 BLAS
+
+// ---------------------------------------------
+// stores arguments and executes call to dgemm (on the worker thread of a queue)
+class magma_dgemm_task: public magma_task
+{
+public:
+    magma_dgemm_task(
+        magma_trans_t in_transA, magma_trans_t in_transB,
+        magma_int_t in_m, magma_int_t in_n, magma_int_t in_k,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_const_ptr in_dB, magma_int_t in_lddb,
+        double in_beta,
+        magmaDouble_ptr       in_dC, magma_int_t in_lddc
+    ):
+        transA( in_transA ),
+        transB( in_transB ),
+        m     ( in_m      ),
+        n     ( in_n      ),
+        k     ( in_k      ),
+        alpha ( in_alpha  ),
+        dA    ( in_dA     ),
+        ldda  ( in_ldda   ),
+        dB    ( in_dB     ),
+        lddb  ( in_lddb   ),
+        beta  ( in_beta   ),
+        dC    ( in_dC     ),
+        lddc  ( in_lddc   )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k,
+                       &alpha, dA, &ldda,
+                               dB, &lddb,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_trans_t                transA;
+    magma_trans_t                transB;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_const_ptr dB;
+    magma_int_t                  lddb;
+    double           beta;
+    magmaDouble_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform matrix-matrix product, \f$ C = \alpha op(A) op(B) + \beta C \f$.
+
+    @param[in]
+    transA  Operation op(A) to perform on matrix A.
+
+    @param[in]
+    transB  Operation op(B) to perform on matrix B.
+
+    @param[in]
+    m       Number of rows of C and op(A). m >= 0.
+
+    @param[in]
+    n       Number of columns of C and op(B). n >= 0.
+
+    @param[in]
+    k       Number of columns of op(A) and rows of op(B). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array on the device.
+            If transA == MagmaNoTrans, the m-by-k matrix A of dimension (ldda,k), ldda >= max(1,m); \n
+            otherwise,                 the k-by-m matrix A of dimension (ldda,m), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      DOUBLE PRECISION array on the device.
+            If transB == MagmaNoTrans, the k-by-n matrix B of dimension (lddb,n), lddb >= max(1,k); \n
+            otherwise,                 the n-by-k matrix B of dimension (lddb,k), lddb >= max(1,n).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      DOUBLE PRECISION array on the device.
+            The m-by-n matrix C of dimension (lddc,n), lddc >= max(1,m).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_gemm
+*******************************************************************************/
+extern "C" void
+magma_dgemm(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_const_ptr dB, magma_int_t lddb,
+    double beta,
+    magmaDouble_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dgemm_task(
+        transA, transB, m, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to dsymm (on the worker thread of a queue)
+class magma_dsymm_task: public magma_task
+{
+public:
+    magma_dsymm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo,
+        magma_int_t in_m, magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_const_ptr in_dB, magma_int_t in_lddb,
+        double in_beta,
+        magmaDouble_ptr       in_dC, magma_int_t in_lddc
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dsymm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_const_ptr dB;
+    magma_int_t                  lddb;
+    double           beta;
+    magmaDouble_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric matrix-matrix product.
+        \f$ C = \alpha A B + \beta C \f$ (side == MagmaLeft), or \n
+        \f$ C = \alpha B A + \beta C \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    m       Number of rows of C. m >= 0.
+
+    @param[in]
+    n       Number of columns of C. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array on the device.
+            If side == MagmaLeft, the m-by-m symmetric matrix A of dimension (ldda,m), ldda >= max(1,m); \n
+            otherwise,            the n-by-n symmetric matrix A of dimension (ldda,n), ldda >= max(1,n).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      DOUBLE PRECISION array on the device.
+            The m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      DOUBLE PRECISION array on the device.
+            The m-by-n matrix C of dimension (lddc,n), lddc >= max(1,m).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_hemm
+*******************************************************************************/
+extern "C" void
+magma_dsymm(
+    magma_side_t side, magma_uplo_t uplo,
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_const_ptr dB, magma_int_t lddb,
+    double beta,
+    magmaDouble_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsymm_task(
+        side, uplo, m, n, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to dsyrk (on the worker thread of a queue)
+class magma_dsyrk_task: public magma_task
+{
+public:
+    magma_dsyrk_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        double in_beta,
+        magmaDouble_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dsyrk( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       &n, &k,
+                       &alpha, dA, &ldda,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    double                       alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    double                       beta;
+    magmaDouble_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-k update.
+        \f$ C = \alpha A A^H + \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^H A + \beta C \f$ (trans == MagmaConjTrans), \n
+    where \f$ C \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A (for MagmaNoTrans)
+            or rows of A (for MagmaConjTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      DOUBLE PRECISION array on the device.
+            The n-by-n symmetric matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_herk
+*******************************************************************************/
+extern "C" void
+magma_dsyrk(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    double beta,
+    magmaDouble_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsyrk_task(
+        uplo, trans, n, k, alpha, dA, ldda, beta, dC, lddc ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to dsyr2k (on the worker thread of a queue)
+class magma_dsyr2k_task: public magma_task
+{
+public:
+    magma_dsyr2k_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_const_ptr in_dB, magma_int_t in_lddb,
+        double in_beta,
+        magmaDouble_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dsyr2k( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                        &n, &k,
+                        &alpha, dA, &ldda,
+                                dB, &lddb,
+                        &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_const_ptr dB;
+    magma_int_t                  lddb;
+    double                       beta;
+    magmaDouble_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-2k update.
+        \f$ C = \alpha A B^H + \alpha B A^H \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^H B + \alpha B^H A \beta C \f$ (trans == MagmaConjTrans), \n
+    where \f$ C \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A and B.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A and B (for MagmaNoTrans)
+            or rows of A and B (for MagmaConjTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      DOUBLE PRECISION array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix B of dimension (lddb,k), lddb >= max(1,n); \n
+            otherwise,                the k-by-n matrix B of dimension (lddb,n), lddb >= max(1,k).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      DOUBLE PRECISION array on the device.
+            The n-by-n symmetric matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_her2k
+*******************************************************************************/
+extern "C" void
+magma_dsyr2k(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_const_ptr dB, magma_int_t lddb,
+    double beta,
+    magmaDouble_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsyr2k_task(
+        uplo, trans, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dsymm (on the worker thread of a queue)
+class magma_dsymm_task: public magma_task
+{
+public:
+    magma_dsymm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo,
+        magma_int_t in_m, magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_const_ptr in_dB, magma_int_t in_lddb,
+        double in_beta,
+        magmaDouble_ptr       in_dC, magma_int_t in_lddc
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dsymm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_const_ptr dB;
+    magma_int_t                  lddb;
+    double           beta;
+    magmaDouble_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric matrix-matrix product.
+        \f$ C = \alpha A B + \beta C \f$ (side == MagmaLeft), or \n
+        \f$ C = \alpha B A + \beta C \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    m       Number of rows of C. m >= 0.
+
+    @param[in]
+    n       Number of columns of C. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array on the device.
+            If side == MagmaLeft, the m-by-m symmetric matrix A of dimension (ldda,m), ldda >= max(1,m); \n
+            otherwise,            the n-by-n symmetric matrix A of dimension (ldda,n), ldda >= max(1,n).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      DOUBLE PRECISION array on the device.
+            The m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      DOUBLE PRECISION array on the device.
+            The m-by-n matrix C of dimension (lddc,n), lddc >= max(1,m).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_symm
+*******************************************************************************/
+extern "C" void
+magma_dsymm(
+    magma_side_t side, magma_uplo_t uplo,
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_const_ptr dB, magma_int_t lddb,
+    double beta,
+    magmaDouble_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsymm_task(
+        side, uplo, m, n, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dsyrk (on the worker thread of a queue)
+class magma_dsyrk_task: public magma_task
+{
+public:
+    magma_dsyrk_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        double in_beta,
+        magmaDouble_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dsyrk( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       &n, &k,
+                       &alpha, dA, &ldda,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    double           beta;
+    magmaDouble_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-k update.
+        \f$ C = \alpha A A^T + \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^T A + \beta C \f$ (trans == MagmaTrans),      \n
+    where \f$ C \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A (for MagmaNoTrans)
+            or rows of A (for MagmaTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      DOUBLE PRECISION array on the device.
+            The n-by-n symmetric matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syrk
+*******************************************************************************/
+extern "C" void
+magma_dsyrk(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    double beta,
+    magmaDouble_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsyrk_task(
+        uplo, trans, n, k, alpha, dA, ldda, beta, dC, lddc ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dsyr2k (on the worker thread of a queue)
+class magma_dsyr2k_task: public magma_task
+{
+public:
+    magma_dsyr2k_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_const_ptr in_dB, magma_int_t in_lddb,
+        double in_beta,
+        magmaDouble_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dsyr2k( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                        &n, &k,
+                        &alpha, dA, &ldda,
+                                dB, &lddb,
+                        &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_const_ptr dB;
+    magma_int_t                  lddb;
+    double           beta;
+    magmaDouble_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-2k update.
+        \f$ C = \alpha A B^T + \alpha B A^T \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^T B + \alpha B^T A \beta C \f$ (trans == MagmaTrans),      \n
+    where \f$ C \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A and B.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A and B (for MagmaNoTrans)
+            or rows of A and B (for MagmaTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      DOUBLE PRECISION array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix B of dimension (lddb,k), lddb >= max(1,n); \n
+            otherwise,                the k-by-n matrix B of dimension (lddb,n), lddb >= max(1,k).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      DOUBLE PRECISION array on the device.
+            The n-by-n symmetric matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syr2k
+*******************************************************************************/
+extern "C" void
+magma_dsyr2k(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_const_ptr dB, magma_int_t lddb,
+    double beta,
+    magmaDouble_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dsyr2k_task(
+        uplo, trans, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dtrmm (on the worker thread of a queue)
+class magma_dtrmm_task: public magma_task
+{
+public:
+    magma_dtrmm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_m, magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_ptr       in_dB, magma_int_t in_lddb
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dtrmm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       lapack_trans_const( trans ), lapack_diag_const( diag ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_ptr       dB;
+    magma_int_t                  lddb;
+};
+
+
+/***************************************************************************//**
+    Perform triangular matrix-matrix product.
+        \f$ B = \alpha op(A) B \f$ (side == MagmaLeft), or \n
+        \f$ B = \alpha B op(A) \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is triangular.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether A is upper or lower triangular.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    m       Number of rows of B. m >= 0.
+
+    @param[in]
+    n       Number of columns of B. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array on the device.
+            If side == MagmaLeft, the n-by-n triangular matrix A of dimension (ldda,n), ldda >= max(1,n); \n
+            otherwise,            the m-by-m triangular matrix A of dimension (ldda,m), ldda >= max(1,m).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      DOUBLE PRECISION array on the device.
+            The m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trmm
+*******************************************************************************/
+extern "C" void
+magma_dtrmm(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dtrmm_task(
+        side, uplo, trans, diag, m, n, alpha, dA, ldda, dB, lddb ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to dtrsm (on the worker thread of a queue)
+class magma_dtrsm_task: public magma_task
+{
+public:
+    magma_dtrsm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_m, magma_int_t in_n,
+        double in_alpha,
+        magmaDouble_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDouble_ptr       in_dB, magma_int_t in_lddb
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_dtrsm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       lapack_trans_const( trans ), lapack_diag_const( diag ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    double           alpha;
+    magmaDouble_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDouble_ptr       dB;
+    magma_int_t                  lddb;
+};
+
+
+/***************************************************************************//**
+    Solve triangular matrix-matrix system (multiple right-hand sides).
+        \f$ op(A) X = \alpha B \f$ (side == MagmaLeft), or \n
+        \f$ X op(A) = \alpha B \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is triangular.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether A is upper or lower triangular.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    m       Number of rows of B. m >= 0.
+
+    @param[in]
+    n       Number of columns of B. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      DOUBLE PRECISION array on the device.
+            If side == MagmaLeft, the m-by-m triangular matrix A of dimension (ldda,m), ldda >= max(1,m); \n
+            otherwise,            the n-by-n triangular matrix A of dimension (ldda,n), ldda >= max(1,n).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in,out]
+    dB      DOUBLE PRECISION array on the device.
+            On entry, m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+            On exit, overwritten with the solution matrix X.
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magma_dtrsm(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_dtrsm_task(
+        side, uplo, trans, diag, m, n, alpha, dA, ldda, dB, lddb ));
+}
+
+#endif // HAVE_HOST
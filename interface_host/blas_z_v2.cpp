@@ -0,0 +1,3080 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @precisions normal z -> s d c
+*/
+#include "host_stream.hpp"
+#include "error.h"
+
+#define COMPLEX
+
+#define PRECISION_z
+
+#ifdef HAVE_HOST
+
+// In the host backend, device memory is host memory and each queue is a
+// worker thread. BLAS routines that update device memory push a task to the
+// queue's worker thread, which calls the host BLAS; routines that return a
+// value wait for the queue first, then call the host BLAS directly.
+
+#ifdef REAL
+// modified Givens rotations are not in magma_zlapack.h
+#define blasf77_zrotm      FORTRAN_NAME( zrotm,  ZROTM  )
+#define blasf77_zrotmg     FORTRAN_NAME( zrotmg, ZROTMG )
+
+extern "C"
+void blasf77_zrotm(  const magma_int_t *n,
+                     double *x, const magma_int_t *incx,
+                     double *y, const magma_int_t *incy,
+                     const double *param );
+
+extern "C"
+void blasf77_zrotmg( double *d1, double *d2,
+                     double *x1, const double *y1,
+                     double *param );
+#endif // REAL
+
+// =============================================================================
+// Level 1 BLAS
+
+/***************************************************************************//**
+    @return Index of element of vector x having max. absolute value;
+            \f$ \text{argmax}_i\; | real(x_i) | + | imag(x_i) | \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_iamax
+*******************************************************************************/
+extern "C" magma_int_t
+magma_izamax(
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return blasf77_izamax( &n, dx, &incx );
+}
+
+
+/***************************************************************************//**
+    @return Index of element of vector x having min. absolute value;
+            \f$ \text{argmin}_i\; | real(x_i) | + | imag(x_i) | \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_iamin
+*******************************************************************************/
+extern "C" magma_int_t
+magma_izamin(
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    // BLAS has no izamin; like izamax, this returns a 1-based index
+    magma_int_t result = 0;
+    double minval = 0;
+    for( magma_int_t i=0; i < n; ++i ) {
+        double val = MAGMA_Z_ABS1( dx[ i*incx ] );
+        if ( i == 0 || val < minval ) {
+            minval = val;
+            result = i + 1;
+        }
+    }
+    return result;
+}
+
+
+/***************************************************************************//**
+    @return Sum of absolute values of vector x;
+            \f$ \sum_i | real(x_i) | + | imag(x_i) | \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_asum
+*******************************************************************************/
+extern "C" double
+magma_dzasum(
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_dzasum( n, dx, incx );
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zaxpy (on the worker thread of a queue)
+class magma_zaxpy_task: public magma_task
+{
+public:
+    magma_zaxpy_task(
+        magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_ptr       in_dy, magma_int_t in_incy
+    ):
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zaxpy( &n, &alpha, dx, &incx, dy, &incy );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Constant times a vector plus a vector; \f$ y = \alpha x + y \f$.
+
+    @param[in]
+    n       Number of elements in vectors x and y. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_axpy
+*******************************************************************************/
+extern "C" void
+magma_zaxpy(
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zaxpy_task(
+        n, alpha, dx, incx, dy, incy ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zcopy (on the worker thread of a queue)
+class magma_zcopy_task: public magma_task
+{
+public:
+    magma_zcopy_task(
+        magma_int_t in_n,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_ptr       in_dy, magma_int_t in_incy
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zcopy( &n, dx, &incx, dy, &incy );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Copy vector x to vector y; \f$ y = x \f$.
+
+    @param[in]
+    n       Number of elements in vectors x and y. n >= 0.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[out]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_copy
+*******************************************************************************/
+extern "C" void
+magma_zcopy(
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zcopy_task(
+        n, dx, incx, dy, incy ));
+}
+
+
+#ifdef COMPLEX
+/***************************************************************************//**
+    @return Dot product of vectors x and y; \f$ x^H y \f$.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma__dot
+*******************************************************************************/
+extern "C"
+magmaDoubleComplex magma_zdotc(
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_const_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_zdotc( n, dx, incx, dy, incy );
+}
+#endif // COMPLEX
+
+
+/***************************************************************************//**
+    @return Dot product (unconjugated) of vectors x and y; \f$ x^T y \f$.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma__dot
+*******************************************************************************/
+extern "C"
+magmaDoubleComplex magma_zdotu(
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_const_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_zdotu( n, dx, incx, dy, incy );
+}
+
+
+/***************************************************************************//**
+    @return 2-norm of vector x; \f$ \text{sqrt}( x^H x ) \f$.
+            Avoids unnecesary over/underflow.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_nrm2
+*******************************************************************************/
+extern "C" double
+magma_dznrm2(
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_queue_sync( queue );
+    return magma_cblas_dznrm2( n, dx, incx );
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zrot (on the worker thread of a queue)
+class magma_zrot_task: public magma_task
+{
+public:
+    magma_zrot_task(
+        magma_int_t in_n,
+        magmaDoubleComplex_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_ptr in_dy, magma_int_t in_incy,
+        double in_c, magmaDoubleComplex in_s
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy ),
+        c   ( in_c    ),
+        s   ( in_s    )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zrot( &n, dx, &incx, dy, &incy, &c, &s );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaDoubleComplex_ptr       dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_ptr       dy;
+    magma_int_t                  incy;
+    double                       c;
+    magmaDoubleComplex           s;
+};
+
+
+/***************************************************************************//**
+    Apply Givens plane rotation, where cos (c) is real and sin (s) is complex.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in,out]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+            On output, overwritten with c*x + s*y.
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+            On output, overwritten with -conj(s)*x + c*y.
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    c       double. cosine.
+
+    @param[in]
+    s       COMPLEX_16. sine. c and s define a rotation
+            [ c         s ]  where c*c + s*conj(s) = 1.
+            [ -conj(s)  c ]
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_rot
+*******************************************************************************/
+extern "C" void
+magma_zrot(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_ptr dy, magma_int_t incy,
+    double c, magmaDoubleComplex s,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zrot_task(
+        n, dx, incx, dy, incy, c, s ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to zdrot (on the worker thread of a queue)
+class magma_zdrot_task: public magma_task
+{
+public:
+    magma_zdrot_task(
+        magma_int_t in_n,
+        magmaDoubleComplex_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_ptr in_dy, magma_int_t in_incy,
+        double in_c, double in_s
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy ),
+        c   ( in_c    ),
+        s   ( in_s    )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zdrot( &n, dx, &incx, dy, &incy, &c, &s );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaDoubleComplex_ptr       dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_ptr       dy;
+    magma_int_t                  incy;
+    double                       c;
+    double                       s;
+};
+
+
+/***************************************************************************//**
+    Apply Givens plane rotation, where cos (c) and sin (s) are real.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in,out]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+            On output, overwritten with c*x + s*y.
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+            On output, overwritten with -conj(s)*x + c*y.
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    c       double. cosine.
+
+    @param[in]
+    s       double. sine. c and s define a rotation
+            [  c  s ]  where c*c + s*s = 1.
+            [ -s  c ]
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_rot
+*******************************************************************************/
+extern "C" void
+magma_zdrot(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_ptr dy, magma_int_t incy,
+    double c, double s,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zdrot_task(
+        n, dx, incx, dy, incy, c, s ));
+}
+#endif // COMPLEX
+
+
+/***************************************************************************//**
+    Generate a Givens plane rotation.
+    The rotation annihilates the second entry of the vector, such that:
+
+        (  c  s ) * ( a ) = ( r )
+        ( -s  c )   ( b )   ( 0 )
+
+    where \f$ c^2 + s^2 = 1 \f$ and \f$ r = a^2 + b^2 \f$.
+    Further, this computes z such that
+
+                { (sqrt(1 - z^2), z),    if |z| < 1,
+        (c,s) = { (0, 1),                if |z| = 1,
+                { (1/z, sqrt(1 - z^2)),  if |z| > 1.
+
+    @param[in]
+    a       On input, entry to be modified.
+            On output, updated to r by applying the rotation.
+
+    @param[in,out]
+    b       On input, entry to be annihilated.
+            On output, set to z.
+
+    @param[in]
+    c       On output, cosine of rotation.
+
+    @param[in,out]
+    s       On output, sine of rotation.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_rotg
+*******************************************************************************/
+extern "C" void
+magma_zrotg(
+    magmaDoubleComplex *a, magmaDoubleComplex *b,
+    double             *c, magmaDoubleComplex *s,
+    magma_queue_t queue )
+{
+    // a, b, c, s are on the host, as with CUBLAS_POINTER_MODE_HOST
+    magma_queue_sync( queue );
+    blasf77_zrotg( a, b, c, s );
+}
+
+
+#ifdef REAL
+// ---------------------------------------------
+// stores arguments and executes call to zrotm (on the worker thread of a queue)
+class magma_zrotm_task: public magma_task
+{
+public:
+    magma_zrotm_task(
+        magma_int_t in_n,
+        double *in_dx, magma_int_t in_incx,
+        double *in_dy, magma_int_t in_incy,
+        const double *in_param
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy )
+    {
+        // param is on the host and may change before the task runs
+        for( int i=0; i < 5; ++i ) {
+            param[i] = in_param[i];
+        }
+    }
+
+    virtual void run()
+    {
+        blasf77_zrotm( &n, dx, &incx, dy, &incy, param );
+    }
+
+private:
+    magma_int_t n;
+    double     *dx;
+    magma_int_t incx;
+    double     *dy;
+    magma_int_t incy;
+    double      param[5];
+};
+
+
+/***************************************************************************//**
+    Apply modified plane rotation.
+
+    @ingroup magma_rotm
+*******************************************************************************/
+extern "C" void
+magma_zrotm(
+    magma_int_t n,
+    double *dx, magma_int_t incx,
+    double *dy, magma_int_t incy,
+    const double *param,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zrotm_task(
+        n, dx, incx, dy, incy, param ));
+}
+#endif // REAL
+
+
+#ifdef REAL
+/***************************************************************************//**
+    Generate modified plane rotation.
+
+    @ingroup magma_rotmg
+*******************************************************************************/
+extern "C" void
+magma_zrotmg(
+    double *d1, double       *d2,
+    double *x1, const double *y1,
+    double *param,
+    magma_queue_t queue )
+{
+    // d1, d2, x1, y1, param are on the host, as with CUBLAS_POINTER_MODE_HOST
+    magma_queue_sync( queue );
+    blasf77_zrotmg( d1, d2, x1, y1, param );
+}
+#endif // REAL
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zscal (on the worker thread of a queue)
+class magma_zscal_task: public magma_task
+{
+public:
+    magma_zscal_task(
+        magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_ptr in_dx, magma_int_t in_incx
+    ):
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zscal( &n, &alpha, dx, &incx );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Scales a vector by a constant; \f$ x = \alpha x \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in,out]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_scal
+*******************************************************************************/
+extern "C" void
+magma_zscal(
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zscal_task(
+        n, alpha, dx, incx ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to zdscal (on the worker thread of a queue)
+class magma_zdscal_task: public magma_task
+{
+public:
+    magma_zdscal_task(
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDoubleComplex_ptr in_dx, magma_int_t in_incx
+    ):
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zdscal( &n, &alpha, dx, &incx );
+    }
+
+private:
+    magma_int_t                  n;
+    double                       alpha;
+    magmaDoubleComplex_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Scales a vector by a real constant; \f$ x = \alpha x \f$.
+
+    @param[in]
+    n       Number of elements in vector x. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$ (real)
+
+    @param[in,out]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx > 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_scal
+*******************************************************************************/
+extern "C" void
+magma_zdscal(
+    magma_int_t n,
+    double alpha,
+    magmaDoubleComplex_ptr dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zdscal_task(
+        n, alpha, dx, incx ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zswap (on the worker thread of a queue)
+class magma_zswap_task: public magma_task
+{
+public:
+    magma_zswap_task(
+        magma_int_t in_n,
+        magmaDoubleComplex_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_ptr in_dy, magma_int_t in_incy
+    ):
+        n   ( in_n    ),
+        dx  ( in_dx   ),
+        incx( in_incx ),
+        dy  ( in_dy   ),
+        incy( in_incy )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zswap( &n, dx, &incx, dy, &incy );
+    }
+
+private:
+    magma_int_t                  n;
+    magmaDoubleComplex_ptr       dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Swap vector x and y; \f$ x <-> y \f$.
+
+    @param[in]
+    n       Number of elements in vector x and y. n >= 0.
+
+    @param[in,out]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_swap
+*******************************************************************************/
+extern "C" void
+magma_zswap(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zswap_task(
+        n, dx, incx, dy, incy ));
+}
+
+
+// =============================================================================
+// Level 2 BLAS
+
+// ---------------------------------------------
+// stores arguments and executes call to zgemv (on the worker thread of a queue)
+class magma_zgemv_task: public magma_task
+{
+public:
+    magma_zgemv_task(
+        magma_trans_t in_transA,
+        magma_int_t in_m, magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex in_beta,
+        magmaDoubleComplex_ptr       in_dy, magma_int_t in_incy
+    ):
+        transA( in_transA ),
+        m     ( in_m      ),
+        n     ( in_n      ),
+        alpha ( in_alpha  ),
+        dA    ( in_dA     ),
+        ldda  ( in_ldda   ),
+        dx    ( in_dx     ),
+        incx  ( in_incx   ),
+        beta  ( in_beta   ),
+        dy    ( in_dy     ),
+        incy  ( in_incy   )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zgemv( lapack_trans_const( transA ), &m, &n,
+                       &alpha, dA, &ldda,
+                               dx, &incx,
+                       &beta,  dy, &incy );
+    }
+
+private:
+    magma_trans_t                transA;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex           beta;
+    magmaDoubleComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Perform matrix-vector product.
+        \f$ y = \alpha A   x + \beta y \f$  (transA == MagmaNoTrans), or \n
+        \f$ y = \alpha A^T x + \beta y \f$  (transA == MagmaTrans),   or \n
+        \f$ y = \alpha A^H x + \beta y \f$  (transA == MagmaConjTrans).
+
+    @param[in]
+    transA  Operation to perform on A.
+
+    @param[in]
+    m       Number of rows of A. m >= 0.
+
+    @param[in]
+    n       Number of columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array of dimension (ldda,n), ldda >= max(1,m).
+            The m-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            If transA == MagmaNoTrans, the n element vector x of dimension (1 + (n-1)*incx); \n
+            otherwise,                 the m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dy      COMPLEX_16 array on the device.
+            If transA == MagmaNoTrans, the m element vector y of dimension (1 + (m-1)*incy); \n
+            otherwise,                 the n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_gemv
+*******************************************************************************/
+extern "C" void
+magma_zgemv(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zgemv_task(
+        transA, m, n, alpha, dA, ldda, dx, incx, beta, dy, incy ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to zgerc (on the worker thread of a queue)
+class magma_zgerc_task: public magma_task
+{
+public:
+    magma_zgerc_task(
+        magma_int_t in_m, magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_const_ptr in_dy, magma_int_t in_incy,
+        magmaDoubleComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zgerc( &m, &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+    }
+
+private:
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_const_ptr dy;
+    magma_int_t                  incy;
+    magmaDoubleComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform rank-1 update, \f$ A = \alpha x y^H + A \f$.
+
+    @param[in]
+    m       Number of rows of A. m >= 0.
+
+    @param[in]
+    n       Number of columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      COMPLEX_16 array on the device.
+            The m-by-n matrix A of dimension (ldda,n), ldda >= max(1,m).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_ger
+*******************************************************************************/
+extern "C" void
+magma_zgerc(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_const_ptr dy, magma_int_t incy,
+    magmaDoubleComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zgerc_task(
+        m, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zgeru (on the worker thread of a queue)
+class magma_zgeru_task: public magma_task
+{
+public:
+    magma_zgeru_task(
+        magma_int_t in_m, magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_const_ptr in_dy, magma_int_t in_incy,
+        magmaDoubleComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zgeru( &m, &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+    }
+
+private:
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_const_ptr dy;
+    magma_int_t                  incy;
+    magmaDoubleComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform rank-1 update (unconjugated), \f$ A = \alpha x y^T + A \f$.
+
+    @param[in]
+    m       Number of rows of A. m >= 0.
+
+    @param[in]
+    n       Number of columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      COMPLEX_16 array of dimension (ldda,n), ldda >= max(1,m).
+            The m-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_ger
+*******************************************************************************/
+extern "C" void
+magma_zgeru(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_const_ptr dy, magma_int_t incy,
+    magmaDoubleComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zgeru_task(
+        m, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to zhemv (on the worker thread of a queue)
+class magma_zhemv_task: public magma_task
+{
+public:
+    magma_zhemv_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex in_beta,
+        magmaDoubleComplex_ptr       in_dy, magma_int_t in_incy
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        beta ( in_beta  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zhemv( lapack_uplo_const( uplo ), &n,
+                       &alpha, dA, &ldda,
+                               dx, &incx,
+                       &beta,  dy, &incy );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex           beta;
+    magmaDoubleComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian matrix-vector product, \f$ y = \alpha A x + \beta y, \f$
+    where \f$ A \f$ is Hermitian.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_hemv
+*******************************************************************************/
+extern "C" void
+magma_zhemv(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zhemv_task(
+        uplo, n, alpha, dA, ldda, dx, incx, beta, dy, incy ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to zher (on the worker thread of a queue)
+class magma_zher_task: public magma_task
+{
+public:
+    magma_zher_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        double in_alpha,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zher( lapack_uplo_const( uplo ), &n,
+                      &alpha, dx, &incx,
+                              dA, &ldda );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    double                       alpha;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian rank-1 update, \f$ A = \alpha x x^H + A, \f$
+    where \f$ A \f$ is Hermitian.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dA      COMPLEX_16 array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_her
+*******************************************************************************/
+extern "C" void
+magma_zher(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    double alpha,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zher_task(
+        uplo, n, alpha, dx, incx, dA, ldda ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to zher2 (on the worker thread of a queue)
+class magma_zher2_task: public magma_task
+{
+public:
+    magma_zher2_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_const_ptr in_dy, magma_int_t in_incy,
+        magmaDoubleComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zher2( lapack_uplo_const( uplo ), &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_const_ptr dy;
+    magma_int_t                  incy;
+    magmaDoubleComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian rank-2 update, \f$ A = \alpha x y^H + conj(\alpha) y x^H + A, \f$
+    where \f$ A \f$ is Hermitian.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      COMPLEX_16 array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_her2
+*******************************************************************************/
+extern "C" void
+magma_zher2(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_const_ptr dy, magma_int_t incy,
+    magmaDoubleComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zher2_task(
+        uplo, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zsymv (on the worker thread of a queue)
+class magma_zsymv_task: public magma_task
+{
+public:
+    magma_zsymv_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex in_beta,
+        magmaDoubleComplex_ptr       in_dy, magma_int_t in_incy
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        beta ( in_beta  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  )
+    {}
+
+    virtual void run()
+    {
+#ifdef COMPLEX
+        lapackf77_zsymv( lapack_uplo_const( uplo ), &n,
+                         &alpha, dA, &ldda,
+                                 dx, &incx,
+                         &beta,  dy, &incy );
+#else
+        blasf77_zhemv( lapack_uplo_const( uplo ), &n,
+                       &alpha, dA, &ldda,
+                               dx, &incx,
+                       &beta,  dy, &incy );
+#endif
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex           beta;
+    magmaDoubleComplex_ptr       dy;
+    magma_int_t                  incy;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric matrix-vector product, \f$ y = \alpha A x + \beta y, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The m element vector x of dimension (1 + (m-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_symv
+*******************************************************************************/
+extern "C" void
+magma_zsymv(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zsymv_task(
+        uplo, n, alpha, dA, ldda, dx, incx, beta, dy, incy ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zsyr (on the worker thread of a queue)
+class magma_zsyr_task: public magma_task
+{
+public:
+    magma_zsyr_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+#ifdef COMPLEX
+        lapackf77_zsyr( lapack_uplo_const( uplo ), &n,
+                        &alpha, dx, &incx,
+                                dA, &ldda );
+#else
+        blasf77_zher( lapack_uplo_const( uplo ), &n,
+                      &alpha, dx, &incx,
+                              dA, &ldda );
+#endif
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-1 update, \f$ A = \alpha x x^T + A, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in,out]
+    dA      COMPLEX_16 array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syr
+*******************************************************************************/
+extern "C" void
+magma_zsyr(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zsyr_task(
+        uplo, n, alpha, dx, incx, dA, ldda ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zsyr2 (on the worker thread of a queue)
+class magma_zsyr2_task: public magma_task
+{
+public:
+    magma_zsyr2_task(
+        magma_uplo_t in_uplo,
+        magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dx, magma_int_t in_incx,
+        magmaDoubleComplex_const_ptr in_dy, magma_int_t in_incy,
+        magmaDoubleComplex_ptr       in_dA, magma_int_t in_ldda
+    ):
+        uplo ( in_uplo  ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dx   ( in_dx    ),
+        incx ( in_incx  ),
+        dy   ( in_dy    ),
+        incy ( in_incy  ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  )
+    {}
+
+    virtual void run()
+    {
+#ifdef COMPLEX
+        // there is no complex symmetric rank-2 update in BLAS or LAPACK;
+        // use zsyr2k with k = 1, which needs x and y with unit stride
+        const magmaDoubleComplex c_one = MAGMA_Z_ONE;
+        const magma_int_t ione = 1;
+        magmaDoubleComplex *x = (magmaDoubleComplex*) dx;
+        magmaDoubleComplex *y = (magmaDoubleComplex*) dy;
+        if ( incx != 1 || incy != 1 ) {
+            x = new magmaDoubleComplex[ 2*n ];
+            y = x + n;
+            blasf77_zcopy( &n, dx, &incx, x, &ione );
+            blasf77_zcopy( &n, dy, &incy, y, &ione );
+        }
+        blasf77_zsyr2k( lapack_uplo_const( uplo ), MagmaNoTransStr, &n, &ione,
+                        &alpha, x, &n,
+                                y, &n,
+                        &c_one, dA, &ldda );
+        if ( x != dx ) {
+            delete[] x;
+        }
+#else
+        blasf77_zher2( lapack_uplo_const( uplo ), &n,
+                       &alpha, dx, &incx,
+                               dy, &incy,
+                               dA, &ldda );
+#endif
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dx;
+    magma_int_t                  incx;
+    magmaDoubleComplex_const_ptr dy;
+    magma_int_t                  incy;
+    magmaDoubleComplex_ptr       dA;
+    magma_int_t                  ldda;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-2 update, \f$ A = \alpha x y^T + \alpha y x^T + A, \f$
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    dy      COMPLEX_16 array on the device.
+            The n element vector y of dimension (1 + (n-1)*incy).
+
+    @param[in]
+    incy    Stride between consecutive elements of dy. incy != 0.
+
+    @param[in,out]
+    dA      COMPLEX_16 array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syr2
+*******************************************************************************/
+extern "C" void
+magma_zsyr2(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex_const_ptr dy, magma_int_t incy,
+    magmaDoubleComplex_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zsyr2_task(
+        uplo, n, alpha, dx, incx, dy, incy, dA, ldda ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to ztrmv (on the worker thread of a queue)
+class magma_ztrmv_task: public magma_task
+{
+public:
+    magma_ztrmv_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_n,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_ptr       in_dx, magma_int_t in_incx
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        n    ( in_n     ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_ztrmv( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       lapack_diag_const( diag ), &n,
+                       dA, &ldda,
+                       dx, &incx );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  n;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Perform triangular matrix-vector product.
+        \f$ x = A   x \f$  (trans == MagmaNoTrans), or \n
+        \f$ x = A^T x \f$  (trans == MagmaTrans),   or \n
+        \f$ x = A^H x \f$  (trans == MagmaConjTrans).
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    dA      COMPLEX_16 array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dx      COMPLEX_16 array on the device.
+            The n element vector x of dimension (1 + (n-1)*incx).
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trmv
+*******************************************************************************/
+extern "C" void
+magma_ztrmv(
+    magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_ztrmv_task(
+        uplo, trans, diag, n, dA, ldda, dx, incx ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to ztrsv (on the worker thread of a queue)
+class magma_ztrsv_task: public magma_task
+{
+public:
+    magma_ztrsv_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_n,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_ptr       in_dx, magma_int_t in_incx
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        n    ( in_n     ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dx   ( in_dx    ),
+        incx ( in_incx  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_ztrsv( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       lapack_diag_const( diag ), &n,
+                       dA, &ldda,
+                       dx, &incx );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  n;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_ptr       dx;
+    magma_int_t                  incx;
+};
+
+
+/***************************************************************************//**
+    Solve triangular matrix-vector system (one right-hand side).
+        \f$ A   x = b \f$  (trans == MagmaNoTrans), or \n
+        \f$ A^T x = b \f$  (trans == MagmaTrans),   or \n
+        \f$ A^H x = b \f$  (trans == MagmaConjTrans).
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    n       Number of rows and columns of A. n >= 0.
+
+    @param[in]
+    dA      COMPLEX_16 array of dimension (ldda,n), ldda >= max(1,n).
+            The n-by-n matrix A, on the device.
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in,out]
+    dx      COMPLEX_16 array on the device.
+            On entry, the n element RHS vector b of dimension (1 + (n-1)*incx).
+            On exit, overwritten with the solution vector x.
+
+    @param[in]
+    incx    Stride between consecutive elements of dx. incx != 0.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trsv
+*******************************************************************************/
+extern "C" void
+magma_ztrsv(
+    magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dx, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_ztrsv_task(
+        uplo, trans, diag, n, dA, ldda, dx, incx ));
+}
+
+
+// =============================================================================
+// Level 3 BLAS
+
+// ---------------------------------------------
+// stores arguments and executes call to zgemm (on the worker thread of a queue)
+class magma_zgemm_task: public magma_task
+{
+public:
+    magma_zgemm_task(
+        magma_trans_t in_transA, magma_trans_t in_transB,
+        magma_int_t in_m, magma_int_t in_n, magma_int_t in_k,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_const_ptr in_dB, magma_int_t in_lddb,
+        magmaDoubleComplex in_beta,
+        magmaDoubleComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        transA( in_transA ),
+        transB( in_transB ),
+        m     ( in_m      ),
+        n     ( in_n      ),
+        k     ( in_k      ),
+        alpha ( in_alpha  ),
+        dA    ( in_dA     ),
+        ldda  ( in_ldda   ),
+        dB    ( in_dB     ),
+        lddb  ( in_lddb   ),
+        beta  ( in_beta   ),
+        dC    ( in_dC     ),
+        lddc  ( in_lddc   )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k,
+                       &alpha, dA, &ldda,
+                               dB, &lddb,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_trans_t                transA;
+    magma_trans_t                transB;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_const_ptr dB;
+    magma_int_t                  lddb;
+    magmaDoubleComplex           beta;
+    magmaDoubleComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform matrix-matrix product, \f$ C = \alpha op(A) op(B) + \beta C \f$.
+
+    @param[in]
+    transA  Operation op(A) to perform on matrix A.
+
+    @param[in]
+    transB  Operation op(B) to perform on matrix B.
+
+    @param[in]
+    m       Number of rows of C and op(A). m >= 0.
+
+    @param[in]
+    n       Number of columns of C and op(B). n >= 0.
+
+    @param[in]
+    k       Number of columns of op(A) and rows of op(B). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array on the device.
+            If transA == MagmaNoTrans, the m-by-k matrix A of dimension (ldda,k), ldda >= max(1,m); \n
+            otherwise,                 the k-by-m matrix A of dimension (ldda,m), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX_16 array on the device.
+            If transB == MagmaNoTrans, the k-by-n matrix B of dimension (lddb,n), lddb >= max(1,k); \n
+            otherwise,                 the n-by-k matrix B of dimension (lddb,k), lddb >= max(1,n).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX_16 array on the device.
+            The m-by-n matrix C of dimension (lddc,n), lddc >= max(1,m).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_gemm
+*******************************************************************************/
+extern "C" void
+magma_zgemm(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dB, magma_int_t lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zgemm_task(
+        transA, transB, m, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to zhemm (on the worker thread of a queue)
+class magma_zhemm_task: public magma_task
+{
+public:
+    magma_zhemm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo,
+        magma_int_t in_m, magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_const_ptr in_dB, magma_int_t in_lddb,
+        magmaDoubleComplex in_beta,
+        magmaDoubleComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zhemm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_const_ptr dB;
+    magma_int_t                  lddb;
+    magmaDoubleComplex           beta;
+    magmaDoubleComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian matrix-matrix product.
+        \f$ C = \alpha A B + \beta C \f$ (side == MagmaLeft), or \n
+        \f$ C = \alpha B A + \beta C \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is Hermitian.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    m       Number of rows of C. m >= 0.
+
+    @param[in]
+    n       Number of columns of C. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array on the device.
+            If side == MagmaLeft, the m-by-m Hermitian matrix A of dimension (ldda,m), ldda >= max(1,m); \n
+            otherwise,            the n-by-n Hermitian matrix A of dimension (ldda,n), ldda >= max(1,n).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX_16 array on the device.
+            The m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX_16 array on the device.
+            The m-by-n matrix C of dimension (lddc,n), lddc >= max(1,m).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_hemm
+*******************************************************************************/
+extern "C" void
+magma_zhemm(
+    magma_side_t side, magma_uplo_t uplo,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dB, magma_int_t lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zhemm_task(
+        side, uplo, m, n, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to zherk (on the worker thread of a queue)
+class magma_zherk_task: public magma_task
+{
+public:
+    magma_zherk_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        double in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        double in_beta,
+        magmaDoubleComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zherk( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       &n, &k,
+                       &alpha, dA, &ldda,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    double                       alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    double                       beta;
+    magmaDoubleComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian rank-k update.
+        \f$ C = \alpha A A^H + \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^H A + \beta C \f$ (trans == MagmaConjTrans), \n
+    where \f$ C \f$ is Hermitian.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A (for MagmaNoTrans)
+            or rows of A (for MagmaConjTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX_16 array on the device.
+            The n-by-n Hermitian matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_herk
+*******************************************************************************/
+extern "C" void
+magma_zherk(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    double alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    double beta,
+    magmaDoubleComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zherk_task(
+        uplo, trans, n, k, alpha, dA, ldda, beta, dC, lddc ));
+}
+#endif // COMPLEX
+
+
+#ifdef COMPLEX
+// ---------------------------------------------
+// stores arguments and executes call to zher2k (on the worker thread of a queue)
+class magma_zher2k_task: public magma_task
+{
+public:
+    magma_zher2k_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_const_ptr in_dB, magma_int_t in_lddb,
+        double in_beta,
+        magmaDoubleComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zher2k( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                        &n, &k,
+                        &alpha, dA, &ldda,
+                                dB, &lddb,
+                        &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_const_ptr dB;
+    magma_int_t                  lddb;
+    double                       beta;
+    magmaDoubleComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform Hermitian rank-2k update.
+        \f$ C = \alpha A B^H + \alpha B A^H \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^H B + \alpha B^H A \beta C \f$ (trans == MagmaConjTrans), \n
+    where \f$ C \f$ is Hermitian.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A and B.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A and B (for MagmaNoTrans)
+            or rows of A and B (for MagmaConjTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX_16 array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix B of dimension (lddb,k), lddb >= max(1,n); \n
+            otherwise,                the k-by-n matrix B of dimension (lddb,n), lddb >= max(1,k).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX_16 array on the device.
+            The n-by-n Hermitian matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_her2k
+*******************************************************************************/
+extern "C" void
+magma_zher2k(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dB, magma_int_t lddb,
+    double beta,
+    magmaDoubleComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zher2k_task(
+        uplo, trans, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+#endif // COMPLEX
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zsymm (on the worker thread of a queue)
+class magma_zsymm_task: public magma_task
+{
+public:
+    magma_zsymm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo,
+        magma_int_t in_m, magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_const_ptr in_dB, magma_int_t in_lddb,
+        magmaDoubleComplex in_beta,
+        magmaDoubleComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zsymm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_const_ptr dB;
+    magma_int_t                  lddb;
+    magmaDoubleComplex           beta;
+    magmaDoubleComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric matrix-matrix product.
+        \f$ C = \alpha A B + \beta C \f$ (side == MagmaLeft), or \n
+        \f$ C = \alpha B A + \beta C \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is symmetric.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of A is referenced.
+
+    @param[in]
+    m       Number of rows of C. m >= 0.
+
+    @param[in]
+    n       Number of columns of C. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array on the device.
+            If side == MagmaLeft, the m-by-m symmetric matrix A of dimension (ldda,m), ldda >= max(1,m); \n
+            otherwise,            the n-by-n symmetric matrix A of dimension (ldda,n), ldda >= max(1,n).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX_16 array on the device.
+            The m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX_16 array on the device.
+            The m-by-n matrix C of dimension (lddc,n), lddc >= max(1,m).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_symm
+*******************************************************************************/
+extern "C" void
+magma_zsymm(
+    magma_side_t side, magma_uplo_t uplo,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dB, magma_int_t lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zsymm_task(
+        side, uplo, m, n, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zsyrk (on the worker thread of a queue)
+class magma_zsyrk_task: public magma_task
+{
+public:
+    magma_zsyrk_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex in_beta,
+        magmaDoubleComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zsyrk( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                       &n, &k,
+                       &alpha, dA, &ldda,
+                       &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex           beta;
+    magmaDoubleComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-k update.
+        \f$ C = \alpha A A^T + \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^T A + \beta C \f$ (trans == MagmaTrans),      \n
+    where \f$ C \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A (for MagmaNoTrans)
+            or rows of A (for MagmaTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX_16 array on the device.
+            The n-by-n symmetric matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syrk
+*******************************************************************************/
+extern "C" void
+magma_zsyrk(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zsyrk_task(
+        uplo, trans, n, k, alpha, dA, ldda, beta, dC, lddc ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to zsyr2k (on the worker thread of a queue)
+class magma_zsyr2k_task: public magma_task
+{
+public:
+    magma_zsyr2k_task(
+        magma_uplo_t in_uplo, magma_trans_t in_trans,
+        magma_int_t in_n, magma_int_t in_k,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_const_ptr in_dB, magma_int_t in_lddb,
+        magmaDoubleComplex in_beta,
+        magmaDoubleComplex_ptr       in_dC, magma_int_t in_lddc
+    ):
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        n    ( in_n     ),
+        k    ( in_k     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  ),
+        beta ( in_beta  ),
+        dC   ( in_dC    ),
+        lddc ( in_lddc  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_zsyr2k( lapack_uplo_const( uplo ), lapack_trans_const( trans ),
+                        &n, &k,
+                        &alpha, dA, &ldda,
+                                dB, &lddb,
+                        &beta,  dC, &lddc );
+    }
+
+private:
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_int_t                  n;
+    magma_int_t                  k;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_const_ptr dB;
+    magma_int_t                  lddb;
+    magmaDoubleComplex           beta;
+    magmaDoubleComplex_ptr       dC;
+    magma_int_t                  lddc;
+};
+
+
+/***************************************************************************//**
+    Perform symmetric rank-2k update.
+        \f$ C = \alpha A B^T + \alpha B A^T \beta C \f$ (trans == MagmaNoTrans), or \n
+        \f$ C = \alpha A^T B + \alpha B^T A \beta C \f$ (trans == MagmaTrans),      \n
+    where \f$ C \f$ is symmetric.
+
+    @param[in]
+    uplo    Whether the upper or lower triangle of C is referenced.
+
+    @param[in]
+    trans   Operation to perform on A and B.
+
+    @param[in]
+    n       Number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       Number of columns of A and B (for MagmaNoTrans)
+            or rows of A and B (for MagmaTrans). k >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix A of dimension (ldda,k), ldda >= max(1,n); \n
+            otherwise,                the k-by-n matrix A of dimension (ldda,n), ldda >= max(1,k).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX_16 array on the device.
+            If trans == MagmaNoTrans, the n-by-k matrix B of dimension (lddb,k), lddb >= max(1,n); \n
+            otherwise,                the k-by-n matrix B of dimension (lddb,n), lddb >= max(1,k).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    beta    Scalar \f$ \beta \f$
+
+    @param[in,out]
+    dC      COMPLEX_16 array on the device.
+            The n-by-n symmetric matrix C of dimension (lddc,n), lddc >= max(1,n).
+
+    @param[in]
+    lddc    Leading dimension of dC.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_syr2k
+*******************************************************************************/
+extern "C" void
+magma_zsyr2k(
+    magma_uplo_t uplo, magma_trans_t trans,
+    magma_int_t n, magma_int_t k,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dB, magma_int_t lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_zsyr2k_task(
+        uplo, trans, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to ztrmm (on the worker thread of a queue)
+class magma_ztrmm_task: public magma_task
+{
+public:
+    magma_ztrmm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_m, magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_ptr       in_dB, magma_int_t in_lddb
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_ztrmm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       lapack_trans_const( trans ), lapack_diag_const( diag ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_ptr       dB;
+    magma_int_t                  lddb;
+};
+
+
+/***************************************************************************//**
+    Perform triangular matrix-matrix product.
+        \f$ B = \alpha op(A) B \f$ (side == MagmaLeft), or \n
+        \f$ B = \alpha B op(A) \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is triangular.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether A is upper or lower triangular.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    m       Number of rows of B. m >= 0.
+
+    @param[in]
+    n       Number of columns of B. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array on the device.
+            If side == MagmaLeft, the n-by-n triangular matrix A of dimension (ldda,n), ldda >= max(1,n); \n
+            otherwise,            the m-by-m triangular matrix A of dimension (ldda,m), ldda >= max(1,m).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in]
+    dB      COMPLEX_16 array on the device.
+            The m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trmm
+*******************************************************************************/
+extern "C" void
+magma_ztrmm(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_ztrmm_task(
+        side, uplo, trans, diag, m, n, alpha, dA, ldda, dB, lddb ));
+}
+
+
+// ---------------------------------------------
+// stores arguments and executes call to ztrsm (on the worker thread of a queue)
+class magma_ztrsm_task: public magma_task
+{
+public:
+    magma_ztrsm_task(
+        magma_side_t in_side, magma_uplo_t in_uplo, magma_trans_t in_trans, magma_diag_t in_diag,
+        magma_int_t in_m, magma_int_t in_n,
+        magmaDoubleComplex in_alpha,
+        magmaDoubleComplex_const_ptr in_dA, magma_int_t in_ldda,
+        magmaDoubleComplex_ptr       in_dB, magma_int_t in_lddb
+    ):
+        side ( in_side  ),
+        uplo ( in_uplo  ),
+        trans( in_trans ),
+        diag ( in_diag  ),
+        m    ( in_m     ),
+        n    ( in_n     ),
+        alpha( in_alpha ),
+        dA   ( in_dA    ),
+        ldda ( in_ldda  ),
+        dB   ( in_dB    ),
+        lddb ( in_lddb  )
+    {}
+
+    virtual void run()
+    {
+        blasf77_ztrsm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       lapack_trans_const( trans ), lapack_diag_const( diag ),
+                       &m, &n,
+                       &alpha, dA, &ldda,
+                               dB, &lddb );
+    }
+
+private:
+    magma_side_t                 side;
+    magma_uplo_t                 uplo;
+    magma_trans_t                trans;
+    magma_diag_t                 diag;
+    magma_int_t                  m;
+    magma_int_t                  n;
+    magmaDoubleComplex           alpha;
+    magmaDoubleComplex_const_ptr dA;
+    magma_int_t                  ldda;
+    magmaDoubleComplex_ptr       dB;
+    magma_int_t                  lddb;
+};
+
+
+/***************************************************************************//**
+    Solve triangular matrix-matrix system (multiple right-hand sides).
+        \f$ op(A) X = \alpha B \f$ (side == MagmaLeft), or \n
+        \f$ X op(A) = \alpha B \f$ (side == MagmaRight),   \n
+    where \f$ A \f$ is triangular.
+
+    @param[in]
+    side    Whether A is on the left or right.
+
+    @param[in]
+    uplo    Whether A is upper or lower triangular.
+
+    @param[in]
+    trans   Operation to perform on A.
+
+    @param[in]
+    diag    Whether the diagonal of A is assumed to be unit or non-unit.
+
+    @param[in]
+    m       Number of rows of B. m >= 0.
+
+    @param[in]
+    n       Number of columns of B. n >= 0.
+
+    @param[in]
+    alpha   Scalar \f$ \alpha \f$
+
+    @param[in]
+    dA      COMPLEX_16 array on the device.
+            If side == MagmaLeft, the m-by-m triangular matrix A of dimension (ldda,m), ldda >= max(1,m); \n
+            otherwise,            the n-by-n triangular matrix A of dimension (ldda,n), ldda >= max(1,n).
+
+    @param[in]
+    ldda    Leading dimension of dA.
+
+    @param[in,out]
+    dB      COMPLEX_16 array on the device.
+            On entry, m-by-n matrix B of dimension (lddb,n), lddb >= max(1,m).
+            On exit, overwritten with the solution matrix X.
+
+    @param[in]
+    lddb    Leading dimension of dB.
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magma_ztrsm(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_host_enqueue( queue, new magma_ztrsm_task(
+        side, uplo, trans, diag, m, n, alpha, dA, ldda, dB, lddb ));
+}
+
+#endif // HAVE_HOST
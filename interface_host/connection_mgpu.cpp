@@ -0,0 +1,49 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+*/
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Groups the devices into complexes of devices that can access each other's
+    memory, as in the CUDA version. In the host backend all devices share
+    host memory, so they form a single complex.
+
+    @param[out]
+    gnode   Array of dimension (MagmaMaxGPUs+2, MagmaMaxGPUs+2).
+            gnode[c][0:n-1] are the devices in complex c,
+            and gnode[c][MagmaMaxGPUs] = n is their number.
+
+    @param[out]
+    ncmplx  Number of complexes.
+
+    @param[in]
+    ngpu    Number of devices.
+
+    @return Number of complexes.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" magma_int_t
+magma_buildconnection_mgpu(
+    magma_int_t gnode[MagmaMaxGPUs+2][MagmaMaxGPUs+2],
+    magma_int_t *ncmplx, magma_int_t ngpu )
+{
+    ncmplx[0] = 0;
+    if ( ngpu <= 0 ) {
+        return 0;
+    }
+    for( magma_int_t d = 0; d < ngpu; ++d ) {
+        gnode[0][d] = d;
+    }
+    gnode[0][MagmaMaxGPUs] = ngpu;
+    ncmplx[0] = 1;
+    return 1;
+}
+
+#endif // HAVE_HOST
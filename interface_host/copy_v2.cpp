@@ -0,0 +1,730 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+*/
+#include <string.h>
+
+#include "host_stream.hpp"
+#include "error.h"
+
+#ifdef HAVE_HOST
+
+// Generic, type-independent routines to copy data.
+// Type-safe versions which avoid the user needing sizeof(...) are in headers;
+// see magma_{s,d,c,z,i,index_}{set,get,copy}{matrix,vector}
+//
+// In the host backend, device memory is host memory, so all copies are
+// memcpy's, executed by the worker thread of the queue.
+// A vector with increment inc is copied as a 1-by-n matrix with
+// leading dimension inc.
+
+// copies larger than this many bytes use all OpenMP threads
+#define MAGMA_HOST_COPY_PARALLEL  (1 << 20)
+
+
+/***************************************************************************//**
+    Copies m-by-n matrix A to matrix B, where elements have elemSize bytes.
+    Columns are copied in parallel for large matrices; a matrix without
+    gaps between its columns is copied in chunks in parallel.
+    @ingroup magma_copymatrix
+*******************************************************************************/
+static void
+magma_host_copymatrix(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    void const* A_src, magma_int_t lda,
+    void*       B_dst, magma_int_t ldb )
+{
+    const char* A = (const char*) A_src;
+    char*       B = (char*) B_dst;
+    size_t col    = size_t(m) * size_t(elemSize);
+    size_t nbytes = col * size_t(n);
+    if ( nbytes == 0 || (A == B && lda == ldb) ) {
+        return;
+    }
+
+    if ( (lda == m && ldb == m) || n == 1 ) {
+        // contiguous
+        const size_t chunk = MAGMA_HOST_COPY_PARALLEL;
+        magma_int_t nchunk = magma_int_t( (nbytes + chunk - 1) / chunk );
+        #pragma omp parallel for schedule(static) if (nchunk > 1)
+        for( magma_int_t i=0; i < nchunk; ++i ) {
+            size_t offset = size_t(i) * chunk;
+            memcpy( B + offset, A + offset, min( chunk, nbytes - offset ));
+        }
+    }
+    else {
+        #pragma omp parallel for schedule(static) if (nbytes > MAGMA_HOST_COPY_PARALLEL)
+        for( magma_int_t j=0; j < n; ++j ) {
+            memcpy( B + size_t(j)*size_t(ldb)*elemSize,
+                    A + size_t(j)*size_t(lda)*elemSize, col );
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Task that copies a matrix on the worker thread of a queue.
+    @ingroup magma_copymatrix
+*******************************************************************************/
+class magma_copy_task: public magma_task
+{
+public:
+    magma_copy_task(
+        magma_int_t m, magma_int_t n, magma_int_t elemSize,
+        void const* A_src, magma_int_t lda,
+        void*       B_dst, magma_int_t ldb ):
+        m_m       ( m        ),
+        m_n       ( n        ),
+        m_elemSize( elemSize ),
+        m_A       ( A_src    ),
+        m_lda     ( lda      ),
+        m_B       ( B_dst    ),
+        m_ldb     ( ldb      )
+    {}
+
+    virtual void run()
+    {
+        magma_host_copymatrix( m_m, m_n, m_elemSize, m_A, m_lda, m_B, m_ldb );
+    }
+
+private:
+    magma_int_t m_m, m_n, m_elemSize;
+    void const* m_A;
+    magma_int_t m_lda;
+    void*       m_B;
+    magma_int_t m_ldb;
+};
+
+/***************************************************************************//**
+    @fn magma_setvector( n, elemSize, hx_src, incx, dy_dst, incy, queue )
+
+    Copy vector hx_src on CPU host to dy_dst on the device.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+
+    This version synchronizes the queue after the transfer.
+    See magma_setvector_async() for an asynchronous version.
+
+    @param[in]
+    n           Number of elements in vector.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    hx_src      Source array of dimension (1 + (n-1))*incx, on CPU host.
+
+    @param[in]
+    incx        Increment between elements of hx_src. incx > 0.
+
+    @param[out]
+    dy_dst      Destination array of dimension (1 + (n-1))*incy, on the device.
+
+    @param[in]
+    incy        Increment between elements of dy_dst. incy > 0.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_setvector
+*******************************************************************************/
+extern "C" void
+magma_setvector_internal(
+    magma_int_t n, magma_int_t elemSize,
+    void const* hx_src, magma_int_t incx,
+    magma_ptr   dy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_host_enqueue( queue, new magma_copy_task(
+        1, n, elemSize, hx_src, incx, dy_dst, incy ));
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_setvector_async( n, elemSize, hx_src, incx, dy_dst, incy, queue )
+
+    Copy vector hx_src on CPU host to dy_dst on the device.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+
+    This version is asynchronous: it may return before the transfer finishes.
+    See magma_setvector() for a synchronous version.
+
+    @param[in]
+    n           Number of elements in vector.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    hx_src      Source array of dimension (1 + (n-1))*incx, on CPU host.
+
+    @param[in]
+    incx        Increment between elements of hx_src. incx > 0.
+
+    @param[out]
+    dy_dst      Destination array of dimension (1 + (n-1))*incy, on the device.
+
+    @param[in]
+    incy        Increment between elements of dy_dst. incy > 0.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_setvector
+*******************************************************************************/
+extern "C" void
+magma_setvector_async_internal(
+    magma_int_t n, magma_int_t elemSize,
+    void const* hx_src, magma_int_t incx,
+    magma_ptr   dy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    // for backwards compatability, accepts NULL queue to mean a synchronous copy.
+    if ( queue == NULL ) {
+        fprintf( stderr, "Warning: %s got NULL queue\n", __func__ );
+    }
+    magma_host_enqueue( queue, new magma_copy_task(
+        1, n, elemSize, hx_src, incx, dy_dst, incy ));
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_getvector( n, elemSize, dx_src, incx, hy_dst, incy, queue )
+
+    Copy vector dx_src on the device to hy_dst on CPU host.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+
+    This version synchronizes the queue after the transfer.
+    See magma_getvector_async() for an asynchronous version.
+
+    @param[in]
+    n           Number of elements in vector.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    dx_src      Source array of dimension (1 + (n-1))*incx, on the device.
+
+    @param[in]
+    incx        Increment between elements of hx_src. incx > 0.
+
+    @param[out]
+    hy_dst      Destination array of dimension (1 + (n-1))*incy, on CPU host.
+
+    @param[in]
+    incy        Increment between elements of dy_dst. incy > 0.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_getvector
+*******************************************************************************/
+extern "C" void
+magma_getvector_internal(
+    magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dx_src, magma_int_t incx,
+    void*           hy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_host_enqueue( queue, new magma_copy_task(
+        1, n, elemSize, dx_src, incx, hy_dst, incy ));
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_getvector_async( n, elemSize, dx_src, incx, hy_dst, incy, queue )
+
+    Copy vector dx_src on the device to hy_dst on CPU host.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+
+    This version is asynchronous: it may return before the transfer finishes.
+    See magma_getvector() for a synchronous version.
+
+    @param[in]
+    n           Number of elements in vector.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    dx_src      Source array of dimension (1 + (n-1))*incx, on the device.
+
+    @param[in]
+    incx        Increment between elements of hx_src. incx > 0.
+
+    @param[out]
+    hy_dst      Destination array of dimension (1 + (n-1))*incy, on CPU host.
+
+    @param[in]
+    incy        Increment between elements of dy_dst. incy > 0.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_getvector
+*******************************************************************************/
+extern "C" void
+magma_getvector_async_internal(
+    magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dx_src, magma_int_t incx,
+    void*           hy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    // for backwards compatability, accepts NULL queue to mean a synchronous copy.
+    if ( queue == NULL ) {
+        fprintf( stderr, "Warning: %s got NULL queue\n", __func__ );
+    }
+    magma_host_enqueue( queue, new magma_copy_task(
+        1, n, elemSize, dx_src, incx, hy_dst, incy ));
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_copyvector( n, elemSize, dx_src, incx, dy_dst, incy, queue )
+
+    Copy vector dx_src on the device to dy_dst on the device.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+    With CUDA unified addressing, dx and dy can be on different GPUs.
+
+    This version synchronizes the queue after the transfer.
+    See magma_copyvector_async() for an asynchronous version.
+
+    @param[in]
+    n           Number of elements in vector.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    dx_src      Source array of dimension (1 + (n-1))*incx, on the device.
+
+    @param[in]
+    incx        Increment between elements of hx_src. incx > 0.
+
+    @param[out]
+    dy_dst      Destination array of dimension (1 + (n-1))*incy, on the device.
+
+    @param[in]
+    incy        Increment between elements of dy_dst. incy > 0.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_copyvector
+*******************************************************************************/
+// TODO compare performance with cublasZcopy BLAS function.
+// But this implementation can handle any element size, not just [sdcz] precisions.
+extern "C" void
+magma_copyvector_internal(
+    magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dx_src, magma_int_t incx,
+    magma_ptr       dy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_host_enqueue( queue, new magma_copy_task(
+        1, n, elemSize, dx_src, incx, dy_dst, incy ));
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_copyvector_async( n, elemSize, dx_src, incx, dy_dst, incy, queue )
+
+    Copy vector dx_src on the device to dy_dst on the device.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+    With CUDA unified addressing, dx and dy can be on different GPUs.
+
+    This version is asynchronous: it may return before the transfer finishes.
+    See magma_copyvector() for a synchronous version.
+
+    @param[in]
+    n           Number of elements in vector.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    dx_src      Source array of dimension (1 + (n-1))*incx, on the device.
+
+    @param[in]
+    incx        Increment between elements of hx_src. incx > 0.
+
+    @param[out]
+    dy_dst      Destination array of dimension (1 + (n-1))*incy, on the device.
+
+    @param[in]
+    incy        Increment between elements of dy_dst. incy > 0.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_copyvector
+*******************************************************************************/
+extern "C" void
+magma_copyvector_async_internal(
+    magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dx_src, magma_int_t incx,
+    magma_ptr       dy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    // for backwards compatability, accepts NULL queue to mean a synchronous copy.
+    if ( queue == NULL ) {
+        fprintf( stderr, "Warning: %s got NULL queue\n", __func__ );
+    }
+    magma_host_enqueue( queue, new magma_copy_task(
+        1, n, elemSize, dx_src, incx, dy_dst, incy ));
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_setmatrix( m, n, elemSize, hA_src, lda, dB_dst, lddb, queue )
+
+    Copy all or part of matrix hA_src on CPU host to dB_dst on the device.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+
+    This version synchronizes the queue after the transfer.
+    See magma_setmatrix_async() for an asynchronous version.
+
+    @param[in]
+    m           Number of rows of matrix A. m >= 0.
+
+    @param[in]
+    n           Number of columns of matrix A. n >= 0.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    hA_src      Source array of dimension (lda,n), on CPU host.
+
+    @param[in]
+    lda         Leading dimension of matrix A. lda >= m.
+
+    @param[out]
+    dB_dst      Destination array of dimension (lddb,n), on the device.
+
+    @param[in]
+    lddb        Leading dimension of matrix B. lddb >= m.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_setmatrix
+*******************************************************************************/
+extern "C" void
+magma_setmatrix_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    void const* hA_src, magma_int_t lda,
+    magma_ptr   dB_dst, magma_int_t lddb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_host_enqueue( queue, new magma_copy_task(
+        m, n, elemSize, hA_src, lda, dB_dst, lddb ));
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_setmatrix_async( m, n, elemSize, hA_src, lda, dB_dst, lddb, queue )
+
+    Copy all or part of matrix hA_src on CPU host to dB_dst on the device.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+
+    This version is asynchronous: it may return before the transfer finishes.
+    See magma_setmatrix() for a synchronous version.
+
+    @param[in]
+    m           Number of rows of matrix A. m >= 0.
+
+    @param[in]
+    n           Number of columns of matrix A. n >= 0.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    hA_src      Source array of dimension (lda,n), on CPU host.
+
+    @param[in]
+    lda         Leading dimension of matrix A. lda >= m.
+
+    @param[out]
+    dB_dst      Destination array of dimension (lddb,n), on the device.
+
+    @param[in]
+    lddb        Leading dimension of matrix B. lddb >= m.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_setmatrix
+*******************************************************************************/
+extern "C" void
+magma_setmatrix_async_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    void const* hA_src, magma_int_t lda,
+    magma_ptr   dB_dst, magma_int_t lddb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    // for backwards compatability, accepts NULL queue to mean a synchronous copy.
+    if ( queue == NULL ) {
+        fprintf( stderr, "Warning: %s got NULL queue\n", __func__ );
+    }
+    magma_host_enqueue( queue, new magma_copy_task(
+        m, n, elemSize, hA_src, lda, dB_dst, lddb ));
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_getmatrix( m, n, elemSize, dA_src, ldda, hB_dst, ldb, queue )
+
+    Copy all or part of matrix dA_src on the device to hB_dst on CPU host.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+
+    This version synchronizes the queue after the transfer.
+    See magma_getmatrix_async() for an asynchronous version.
+
+    @param[in]
+    m           Number of rows of matrix A. m >= 0.
+
+    @param[in]
+    n           Number of columns of matrix A. n >= 0.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    dA_src      Source array of dimension (ldda,n), on the device.
+
+    @param[in]
+    ldda        Leading dimension of matrix A. ldda >= m.
+
+    @param[out]
+    hB_dst      Destination array of dimension (ldb,n), on CPU host.
+
+    @param[in]
+    ldb         Leading dimension of matrix B. ldb >= m.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_getmatrix
+*******************************************************************************/
+extern "C" void
+magma_getmatrix_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dA_src, magma_int_t ldda,
+    void*           hB_dst, magma_int_t ldb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_host_enqueue( queue, new magma_copy_task(
+        m, n, elemSize, dA_src, ldda, hB_dst, ldb ));
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_getmatrix_async( m, n, elemSize, dA_src, ldda, hB_dst, ldb, queue )
+
+    Copy all or part of matrix dA_src on the device to hB_dst on CPU host.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+
+    This version is asynchronous: it may return before the transfer finishes.
+    See magma_getmatrix() for a synchronous version.
+
+    @param[in]
+    m           Number of rows of matrix A. m >= 0.
+
+    @param[in]
+    n           Number of columns of matrix A. n >= 0.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    dA_src      Source array of dimension (ldda,n), on the device.
+
+    @param[in]
+    ldda        Leading dimension of matrix A. ldda >= m.
+
+    @param[out]
+    hB_dst      Destination array of dimension (ldb,n), on CPU host.
+
+    @param[in]
+    ldb         Leading dimension of matrix B. ldb >= m.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_getmatrix
+*******************************************************************************/
+extern "C" void
+magma_getmatrix_async_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dA_src, magma_int_t ldda,
+    void*           hB_dst, magma_int_t ldb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    // for backwards compatability, accepts NULL queue to mean a synchronous copy.
+    if ( queue == NULL ) {
+        fprintf( stderr, "Warning: %s got NULL queue\n", __func__ );
+    }
+    magma_host_enqueue( queue, new magma_copy_task(
+        m, n, elemSize, dA_src, ldda, hB_dst, ldb ));
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_copymatrix( m, n, elemSize, dA_src, ldda, dB_dst, lddb, queue )
+
+    Copy all or part of matrix dA_src on the device to dB_dst on the device.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+    With CUDA unified addressing, dA and dB can be on different GPUs.
+
+    This version synchronizes the queue after the transfer.
+    See magma_copymatrix_async() for an asynchronous version.
+
+    @param[in]
+    m           Number of rows of matrix A. m >= 0.
+
+    @param[in]
+    n           Number of columns of matrix A. n >= 0.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    dA_src      Source array of dimension (ldda,n).
+
+    @param[in]
+    ldda        Leading dimension of matrix A. ldda >= m.
+
+    @param[out]
+    dB_dst      Destination array of dimension (lddb,n), on the device.
+
+    @param[in]
+    lddb        Leading dimension of matrix B. lddb >= m.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_copymatrix
+*******************************************************************************/
+extern "C" void
+magma_copymatrix_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dA_src, magma_int_t ldda,
+    magma_ptr       dB_dst, magma_int_t lddb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_host_enqueue( queue, new magma_copy_task(
+        m, n, elemSize, dA_src, ldda, dB_dst, lddb ));
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_copymatrix_async( m, n, elemSize, dA_src, ldda, dB_dst, lddb, queue )
+
+    Copy all or part of matrix dA_src on the device to dB_dst on the device.
+    Elements may be arbitrary size.
+    Type-safe versions set elemSize appropriately.
+    With CUDA unified addressing, dA and dB can be on different GPUs.
+
+    This version is asynchronous: it may return before the transfer finishes.
+    See magma_copyvector() for a synchronous version.
+
+    @param[in]
+    m           Number of rows of matrix A. m >= 0.
+
+    @param[in]
+    n           Number of columns of matrix A. n >= 0.
+
+    @param[in]
+    elemSize    Size of each element, e.g., sizeof(double).
+
+    @param[in]
+    dA_src      Source array of dimension (ldda,n), on the device.
+
+    @param[in]
+    ldda        Leading dimension of matrix A. ldda >= m.
+
+    @param[out]
+    dB_dst      Destination array of dimension (lddb,n), on the device.
+
+    @param[in]
+    lddb        Leading dimension of matrix B. lddb >= m.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @ingroup magma_copymatrix
+*******************************************************************************/
+extern "C" void
+magma_copymatrix_async_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dA_src, magma_int_t ldda,
+    magma_ptr       dB_dst, magma_int_t lddb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    // for backwards compatability, accepts NULL queue to mean a synchronous copy.
+    if ( queue == NULL ) {
+        fprintf( stderr, "Warning: %s got NULL queue\n", __func__ );
+    }
+    magma_host_enqueue( queue, new magma_copy_task(
+        m, n, elemSize, dA_src, ldda, dB_dst, lddb ));
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,88 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+*/
+
+#ifndef MAGMA_HOST_STREAM_HPP
+#define MAGMA_HOST_STREAM_HPP
+
+#include "thread_queue.hpp"
+#include "magma_internal.h"  // after thread_queue.hpp, so max, min are defined
+
+
+/***************************************************************************//**
+    Worker thread of a queue in the host backend.
+    It has a single thread, so the tasks pushed to it execute one at a time,
+    in the order they were pushed, like the operations on a CUDA stream.
+    @ingroup magma_queue
+*******************************************************************************/
+struct magma_host_stream
+{
+    magma_thread_queue worker;
+};
+
+
+/***************************************************************************//**
+    Event in the host backend.
+    magma_event_record pushes a task that increments reached once it runs;
+    the event has triggered when reached catches up with recorded.
+    @ingroup magma_event
+*******************************************************************************/
+struct magma_event
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    long long       recorded;   ///< number of times the event was recorded
+    long long       reached;    ///< number of recorded tasks that have executed
+};
+
+
+/******************************************************************************/
+// Blocks until the operations enqueued on all queues are finished,
+// like cudaDeviceSynchronize.
+void magma_host_device_sync();
+
+
+/******************************************************************************/
+// Executes task on the worker thread of queue, after all operations previously
+// enqueued on it. With a NULL queue, task executes immediately.
+// task must be allocated with new; it is deleted after it executes.
+void magma_host_enqueue( magma_queue_t queue, magma_task* task );
+
+
+/***************************************************************************//**
+    Task that calls a function object, usually a lambda that captures its
+    arguments by value. The host versions of the magmablas kernels use it
+    instead of declaring a task class for each kernel.
+    @ingroup magma_queue
+*******************************************************************************/
+template< typename Func >
+class magma_function_task: public magma_task
+{
+public:
+    magma_function_task( const Func& in_func ):
+        func( in_func )
+    {}
+
+    virtual void run()
+    {
+        func();
+    }
+
+private:
+    Func func;
+};
+
+
+/******************************************************************************/
+// Executes func() on the worker thread of queue, like magma_host_enqueue.
+template< typename Func >
+void magma_host_enqueue_func( magma_queue_t queue, const Func& func )
+{
+    magma_host_enqueue( queue, new magma_function_task< Func >( func ));
+}
+
+#endif        //  #ifndef MAGMA_HOST_STREAM_HPP
@@ -0,0 +1,807 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <map>
+#include <mutex>  // requires C++11
+#include <set>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(MAGMA_WITH_MKL)
+#include <mkl_service.h>
+#endif
+
+#if defined(MAGMA_WITH_ACML)
+#include <acml.h>
+#endif
+
+// defining MAGMA_LAPACK_H is a hack to NOT include magma_lapack.h
+// via magma_internal.h here, since it conflicts with acml.h and we don't
+// need lapack here, but we want acml.h for the acmlversion() function.
+#define MAGMA_LAPACK_H
+
+#include "host_stream.hpp"
+#include "error.h"
+
+#define MAX_BATCHCOUNT    (65534)
+
+#ifdef HAVE_HOST
+
+#ifdef DEBUG_MEMORY
+// defined in alloc.cpp
+extern std::map< void*, size_t > g_pointers_dev;
+extern std::map< void*, size_t > g_pointers_cpu;
+extern std::map< void*, size_t > g_pointers_pin;
+#endif
+
+// -----------------------------------------------------------------------------
+// prototypes
+extern "C" void
+magma_warn_leaks( const std::map< void*, size_t >& pointers, const char* type );
+
+
+// -----------------------------------------------------------------------------
+// constants
+
+// bit flags
+enum {
+    own_none     = 0x0000,
+    own_stream   = 0x0001
+};
+
+
+// -----------------------------------------------------------------------------
+// globals
+static std::mutex g_mutex;
+
+// count of (init - finalize) calls
+static int g_init = 0;
+
+// queues that exist, for magma_host_device_sync
+static std::mutex g_queues_mutex;
+static std::set< magma_queue_t > g_queues;
+
+
+// -----------------------------------------------------------------------------
+// properties of the host, which is the only device, set by magma_init()
+struct magma_device_info
+{
+    size_t memory;
+    magma_int_t multiproc_count;    // number of cores
+};
+
+static struct magma_device_info g_magma_host = { 0, 0 };
+
+
+// =============================================================================
+// initialization
+
+/***************************************************************************//**
+    Initializes the MAGMA library.
+    Caches information about the host, which is the only device of the
+    host backend.
+
+    Every magma_init call must be paired with a magma_finalize call.
+    Only one thread needs to call magma_init and magma_finalize,
+    but every thread may call it. If n threads call magma_init,
+    the n-th call to magma_finalize will release resources.
+
+    @retval MAGMA_SUCCESS
+
+    @see magma_finalize
+
+    @ingroup magma_init
+*******************************************************************************/
+extern "C" magma_int_t
+magma_init()
+{
+    magma_int_t info = 0;
+
+    g_mutex.lock();
+    {
+        if ( g_init == 0 ) {
+            long pages    = sysconf( _SC_PHYS_PAGES );
+            long pagesize = sysconf( _SC_PAGESIZE );
+            long ncores   = sysconf( _SC_NPROCESSORS_ONLN );
+            g_magma_host.memory          = size_t( max( 0, pages ) ) * size_t( max( 0, pagesize ) );
+            g_magma_host.multiproc_count = magma_int_t( max( 1, ncores ) );
+        }
+        g_init += 1;  // increment (init - finalize) count
+    }
+    g_mutex.unlock();
+
+    return info;
+}
+
+
+/***************************************************************************//**
+    Frees information used by the MAGMA library.
+    @see magma_init
+
+    @ingroup magma_init
+*******************************************************************************/
+extern "C" magma_int_t
+magma_finalize()
+{
+    magma_int_t info = 0;
+
+    g_mutex.lock();
+    {
+        if ( g_init <= 0 ) {
+            info = MAGMA_ERR_NOT_INITIALIZED;
+        }
+        else {
+            g_init -= 1;  // decrement (init - finalize) count
+            if ( g_init == 0 ) {
+                #ifdef DEBUG_MEMORY
+                magma_warn_leaks( g_pointers_dev, "device" );
+                magma_warn_leaks( g_pointers_cpu, "CPU" );
+                magma_warn_leaks( g_pointers_pin, "CPU pinned" );
+                #endif
+            }
+        }
+    }
+    g_mutex.unlock();
+
+    return info;
+}
+
+
+// =============================================================================
+// testing and debugging support
+
+#ifdef DEBUG_MEMORY
+/***************************************************************************//**
+    If DEBUG_MEMORY is defined at compile time, prints warnings when
+    magma_finalize() is called for any device, CPU, or CPU pinned
+    allocations that were not freed.
+
+    @param[in]
+    pointers    Hash table mapping allocated pointers to size.
+
+    @param[in]
+    type        String describing type of pointers (device, CPU, etc.)
+
+    @ingroup magma_testing
+*******************************************************************************/
+extern "C" void
+magma_warn_leaks( const std::map< void*, size_t >& pointers, const char* type )
+{
+    if ( pointers.size() > 0 ) {
+        fprintf( stderr, "Warning: MAGMA detected memory leak of %llu %s pointers:\n",
+                 (long long unsigned) pointers.size(), type );
+        std::map< void*, size_t >::const_iterator iter;
+        for( iter = pointers.begin(); iter != pointers.end(); ++iter ) {
+            fprintf( stderr, "    pointer %p, size %lu\n", iter->first, iter->second );
+        }
+    }
+}
+#endif
+
+
+/***************************************************************************//**
+    Print MAGMA version, backend, LAPACK/BLAS library version,
+    number of cores and threads, date, etc.
+    Used in testing.
+    @ingroup magma_testing
+*******************************************************************************/
+extern "C" void
+magma_print_environment()
+{
+    magma_int_t major, minor, micro;
+    magma_version( &major, &minor, &micro );
+
+    printf( "%% MAGMA %lld.%lld.%lld %s %lld-bit magma_int_t, %lld-bit pointer.\n",
+            (long long) major, (long long) minor, (long long) micro,
+            MAGMA_VERSION_STAGE,
+            (long long) (8*sizeof(magma_int_t)),
+            (long long) (8*sizeof(void*)) );
+
+    printf( "Compiled for the host backend\n" );
+
+    // OpenMP, MKL, ACML versions all printed on same line
+    printf( "%% " );
+
+/* OpenMP */
+
+#if defined(_OPENMP)
+    int omp_threads = 0;
+    #pragma omp parallel
+    {
+        omp_threads = omp_get_num_threads();
+    }
+    printf( "OpenMP threads %d. ", omp_threads );
+#else
+    printf( "MAGMA not compiled with OpenMP. " );
+#endif
+
+#if defined(MAGMA_WITH_MKL)
+    MKLVersion mkl_version;
+    mkl_get_version( &mkl_version );
+    printf( "MKL %d.%d.%d, MKL threads %d. ",
+            mkl_version.MajorVersion,
+            mkl_version.MinorVersion,
+            mkl_version.UpdateVersion,
+            mkl_get_max_threads() );
+#endif
+
+#if defined(MAGMA_WITH_ACML)
+    // ACML 4 doesn't have acml_build parameter
+    int acml_major, acml_minor, acml_patch, acml_build;
+    acmlversion( &acml_major, &acml_minor, &acml_patch, &acml_build );
+    printf( "ACML %d.%d.%d.%d ", acml_major, acml_minor, acml_patch, acml_build );
+#endif
+
+    printf( "\n" );
+
+    // print the host, which is the only device
+    long pages    = sysconf( _SC_PHYS_PAGES );
+    long pagesize = sysconf( _SC_PAGESIZE );
+    printf( "%% device 0: host, %ld cores, %.1f MiB memory\n",
+            sysconf( _SC_NPROCESSORS_ONLN ),
+            double( pages ) * double( pagesize ) / (1024.*1024.) );
+
+    time_t t = time( NULL );
+    printf( "%% %s", ctime( &t ));
+}
+
+
+/***************************************************************************//**
+    For debugging purposes, determines whether a pointer points to CPU or GPU memory.
+
+    In the host backend, device memory is host memory, so this cannot
+    determine if it is CPU or device memory.
+
+    @param[in] A    pointer to test
+
+    @return -1:  unknown.
+
+    @ingroup magma_util
+*******************************************************************************/
+extern "C" magma_int_t
+magma_is_devptr( const void* A )
+{
+    MAGMA_UNUSED( A );
+    return -1;
+}
+
+
+// =============================================================================
+// device support
+
+/***************************************************************************//**
+    Returns CUDA architecture capability for the current device.
+    The host backend has no CUDA architecture, so this returns 0.
+
+    @return 0.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" magma_int_t
+magma_getdevice_arch()
+{
+    return 0;
+}
+
+
+/***************************************************************************//**
+    Fills in devices array with the available devices.
+    The host backend has one device, the host, with ID 0.
+
+    @param[out]
+    devices     Array of dimension (size).
+                On output, devices[0, ..., num_dev-1] contain device IDs.
+                Entries >= num_dev are not touched.
+
+    @param[in]
+    size        Dimension of the array devices.
+
+    @param[out]
+    num_dev     Number of devices, limited to size.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" void
+magma_getdevices(
+    magma_device_t* devices,
+    magma_int_t  size,
+    magma_int_t* num_dev )
+{
+    magma_int_t cnt = min( 1, size );
+    for( magma_int_t i = 0; i < cnt; ++i ) {
+        devices[i] = i;
+    }
+    *num_dev = cnt;
+}
+
+
+/***************************************************************************//**
+    Get the current device.
+
+    @param[out]
+    device      On output, device ID of the current device, always 0.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" void
+magma_getdevice( magma_device_t* device )
+{
+    *device = 0;
+}
+
+
+/***************************************************************************//**
+    Set the current device.
+
+    @param[in]
+    device      Device ID to set as the current device; must be 0.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" void
+magma_setdevice( magma_device_t device )
+{
+    if ( device != 0 ) {
+        check_error( MAGMA_ERR_ILLEGAL_VALUE );
+    }
+}
+
+/***************************************************************************//**
+    Returns the number of cores of the host.
+    This requires magma_init() to be called first to cache the information.
+
+    @return the number of cores of the host.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" magma_int_t
+magma_getdevice_multiprocessor_count()
+{
+    if ( g_init <= 0 ) {
+        fprintf( stderr, "Error in %s: MAGMA not initialized (call magma_init() first)\n", __func__ );
+        return 0;
+    }
+    return g_magma_host.multiproc_count;
+}
+
+/***************************************************************************//**
+    Returns the maximum shared memory per block (in bytes) for the current device.
+    The host has no shared memory, so this returns 0.
+
+    @return 0.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" size_t
+magma_getdevice_shmem_block()
+{
+    return 0;
+}
+
+
+/***************************************************************************//**
+    Returns the maximum shared memory multiprocessor (in bytes) for the current device.
+    The host has no shared memory, so this returns 0.
+
+    @return 0.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" size_t
+magma_getdevice_shmem_multiprocessor()
+{
+    return 0;
+}
+
+
+/***************************************************************************//**
+    @param[in]
+    queue           Queue to query.
+
+    @return         Amount of free memory in bytes available on the host.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C" size_t
+magma_mem_size( magma_queue_t queue )
+{
+    MAGMA_UNUSED( queue );
+    size_t freeMem, totalMem;
+    magma_mem_info( &freeMem, &totalMem );
+    return freeMem;
+}
+
+
+// =============================================================================
+// queue support
+
+/***************************************************************************//**
+    @param[in]
+    queue       Queue to query.
+
+    @return Device ID associated with the MAGMA queue.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C"
+magma_int_t
+magma_queue_get_device( magma_queue_t queue )
+{
+    return queue->device();
+}
+
+
+/***************************************************************************//**
+    @param[in]
+    queue       Queue to query.
+
+    @return Worker thread associated with the MAGMA queue.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C"
+magma_host_stream_t
+magma_queue_get_host_stream( magma_queue_t queue )
+{
+    return queue->host_stream();
+}
+
+
+/***************************************************************************//**
+    Executes task on the worker thread of queue, after all operations
+    previously enqueued on it. With a NULL queue, task executes immediately
+    in the calling thread.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @param[in]
+    task        Task allocated with new; it is deleted after it executes.
+
+    @ingroup magma_queue
+*******************************************************************************/
+void magma_host_enqueue( magma_queue_t queue, magma_task* task )
+{
+    if ( queue == NULL ) {
+        task->run();
+        delete task;
+    }
+    else {
+        queue->host_stream()->worker.push_task( task );
+    }
+}
+
+
+/***************************************************************************//**
+    @fn magma_queue_create( device, queue_ptr )
+
+    magma_queue_create( device, queue_ptr ) is the preferred alias to this
+    function.
+
+    Creates a new MAGMA queue, with an associated worker thread that executes
+    the operations enqueued on it in order.
+
+    This is the MAGMA v2 version which takes a device ID.
+
+    @param[in]
+    device          Device to create queue on; must be 0.
+
+    @param[out]
+    queue_ptr       On output, the newly created queue.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C" void
+magma_queue_create_internal(
+    magma_device_t device, magma_queue_t* queue_ptr,
+    const char* func, const char* file, int line )
+{
+    magma_queue_t queue;
+    magma_malloc_cpu( (void**)&queue, sizeof(*queue) );
+    assert( queue != NULL );
+    *queue_ptr = queue;
+
+    queue->own__      = own_none;
+    queue->device__   = device;
+    queue->stream__   = NULL;
+    queue->ptrArray__ = NULL;
+    queue->dAarray__  = NULL;
+    queue->dBarray__  = NULL;
+    queue->dCarray__  = NULL;
+    queue->maxbatch__ = MAX_BATCHCOUNT;
+
+    if ( device != 0 ) {
+        check_xerror( MAGMA_ERR_ILLEGAL_VALUE, func, file, line );
+    }
+
+    // one thread, so operations execute in the order they are enqueued
+    queue->stream__ = new magma_host_stream;
+    queue->stream__->worker.launch( 1 );
+    queue->own__ |= own_stream;
+
+    g_queues_mutex.lock();
+    g_queues.insert( queue );
+    g_queues_mutex.unlock();
+}
+
+
+/***************************************************************************//**
+    @fn magma_queue_destroy( queue )
+
+    Destroys a queue, freeing its resources.
+    Operations still enqueued on it are executed before its worker thread exits.
+
+    @param[in]
+    queue           Queue to destroy.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C" void
+magma_queue_destroy_internal(
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+
+    if ( queue != NULL ) {
+        g_queues_mutex.lock();
+        g_queues.erase( queue );
+        g_queues_mutex.unlock();
+
+        if ( queue->stream__ != NULL && (queue->own__ & own_stream)) {
+            // the destructor joins the worker thread once its tasks are done
+            delete queue->stream__;
+        }
+
+        if( queue->ptrArray__ != NULL ) magma_free( queue->ptrArray__ );
+
+        queue->own__      = own_none;
+        queue->device__   = -1;
+        queue->stream__   = NULL;
+        queue->ptrArray__ = NULL;
+        queue->dAarray__  = NULL;
+        queue->dBarray__  = NULL;
+        queue->dCarray__  = NULL;
+
+        magma_free_cpu( queue );
+    }
+}
+
+
+/***************************************************************************//**
+    @fn magma_queue_sync( queue )
+
+    Synchronizes with a queue. The CPU blocks until all operations on the queue
+    are finished. Operations on a NULL queue execute synchronously, so there
+    is nothing to wait for.
+
+    @param[in]
+    queue           Queue to synchronize.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C" void
+magma_queue_sync_internal(
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+
+    if ( queue != NULL ) {
+        queue->host_stream()->worker.sync();
+    }
+}
+
+
+/***************************************************************************//**
+    Synchronizes with all queues. The CPU blocks until all operations on
+    every queue are finished, like cudaDeviceSynchronize.
+    magma_free and magma_free_pinned call it, as cudaFree and cudaFreeHost
+    synchronize the device: tasks still enqueued may use the memory.
+
+    @ingroup magma_queue
+*******************************************************************************/
+void
+magma_host_device_sync()
+{
+    std::lock_guard< std::mutex > lock( g_queues_mutex );
+    for( magma_queue_t queue : g_queues ) {
+        queue->host_stream()->worker.sync();
+    }
+}
+
+
+// =============================================================================
+// event support
+
+/***************************************************************************//**
+    Task that triggers an event when the queue reaches it.
+    @ingroup magma_event
+*******************************************************************************/
+class magma_event_record_task: public magma_task
+{
+public:
+    magma_event_record_task( magma_event_t event, long long ticket ):
+        m_event ( event  ),
+        m_ticket( ticket )
+    {}
+
+    virtual void run()
+    {
+        pthread_mutex_lock( &m_event->mutex );
+        m_event->reached = max( m_event->reached, m_ticket );
+        pthread_cond_broadcast( &m_event->cond );
+        pthread_mutex_unlock( &m_event->mutex );
+    }
+
+private:
+    magma_event_t m_event;
+    long long     m_ticket;
+};
+
+
+/***************************************************************************//**
+    Task that blocks the queue until an event triggers.
+    @ingroup magma_event
+*******************************************************************************/
+class magma_event_wait_task: public magma_task
+{
+public:
+    magma_event_wait_task( magma_event_t event, long long ticket ):
+        m_event ( event  ),
+        m_ticket( ticket )
+    {}
+
+    virtual void run()
+    {
+        pthread_mutex_lock( &m_event->mutex );
+        while( m_event->reached < m_ticket ) {
+            pthread_cond_wait( &m_event->cond, &m_event->mutex );
+        }
+        pthread_mutex_unlock( &m_event->mutex );
+    }
+
+private:
+    magma_event_t m_event;
+    long long     m_ticket;
+};
+
+
+/***************************************************************************//**
+    Creates an event.
+
+    @param[in]
+    event           On output, the newly created event.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_event_create( magma_event_t* event )
+{
+    *event = new magma_event;
+    pthread_mutex_init( &(*event)->mutex, NULL );
+    pthread_cond_init( &(*event)->cond, NULL );
+    (*event)->recorded = 0;
+    (*event)->reached  = 0;
+}
+
+
+/***************************************************************************//**
+    Creates an event, without timing support.
+    Events of the host backend have no timing support, so this is the same
+    as magma_event_create.
+
+    @param[in]
+    event           On output, the newly created event.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_event_create_untimed( magma_event_t* event )
+{
+    magma_event_create( event );
+}
+
+
+
+/***************************************************************************//*
+    Destroys an event, freeing its resources.
+
+    @param[in]
+    event           Event to destroy.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_event_destroy( magma_event_t event )
+{
+    if ( event != NULL ) {
+        pthread_mutex_destroy( &event->mutex );
+        pthread_cond_destroy( &event->cond );
+        delete event;
+    }
+}
+
+
+/***************************************************************************//**
+    Records an event into the queue's execution stream.
+    The event will trigger when all previous operations on this queue finish.
+
+    @param[in]
+    event           Event to record.
+
+    @param[in]
+    queue           Queue to execute in.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_event_record( magma_event_t event, magma_queue_t queue )
+{
+    pthread_mutex_lock( &event->mutex );
+    long long ticket = ++event->recorded;
+    pthread_mutex_unlock( &event->mutex );
+
+    magma_host_enqueue( queue, new magma_event_record_task( event, ticket ));
+}
+
+
+/***************************************************************************//**
+    Synchronizes with an event. The CPU blocks until the event triggers.
+
+    @param[in]
+    event           Event to synchronize with.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_event_sync( magma_event_t event )
+{
+    pthread_mutex_lock( &event->mutex );
+    long long ticket = event->recorded;
+    while( event->reached < ticket ) {
+        pthread_cond_wait( &event->cond, &event->mutex );
+    }
+    pthread_mutex_unlock( &event->mutex );
+}
+
+
+/***************************************************************************//**
+    Synchronizes a queue with an event. The queue blocks until the event
+    triggers. The CPU does not block.
+
+    @param[in]
+    event           Event to synchronize with.
+
+    @param[in]
+    queue           Queue to synchronize.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_queue_wait_event( magma_queue_t queue, magma_event_t event )
+{
+    pthread_mutex_lock( &event->mutex );
+    long long ticket = event->recorded;
+    pthread_mutex_unlock( &event->mutex );
+
+    magma_host_enqueue( queue, new magma_event_wait_task( event, ticket ));
+}
+
+#endif // HAVE_HOST
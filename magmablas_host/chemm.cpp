@@ -0,0 +1,155 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from magmablas_host/zhemm.cpp, normal z -> c, Sat Oct 17 01:12:25 2026
+*/
+#include "host_stream.hpp"
+
+#define COMPLEX
+
+#define PRECISION_c
+
+#ifdef HAVE_HOST
+
+// Host versions of the magmablas Hermitian and complex symmetric kernels
+// that exist only in the complex precisions; in the real precisions,
+// chemm and csymv are the same as csymm and chemv in cgemm.cpp.
+// See the CUDA versions for the full argument descriptions.
+
+
+/***************************************************************************//**
+    Performs the Hermitian matrix-matrix product
+    \f$ C = \alpha A B + \beta C \f$ (side == MagmaLeft), or
+    \f$ C = \alpha B A + \beta C \f$ (side == MagmaRight).
+
+    @ingroup magma_hemm
+*******************************************************************************/
+extern "C" void
+magmablas_chemm(
+    magma_side_t side, magma_uplo_t uplo,
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dB, magma_int_t lddb,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_int_t nrowa = (side == MagmaLeft ? m : n);
+
+    magma_int_t info = 0;
+    if ( side != MagmaLeft && side != MagmaRight ) {
+        info = -1;
+    } else if (uplo != MagmaLower && uplo != MagmaUpper ) {
+        info = -2;
+    } else if ( m < 0 ) {
+        info = -3;
+    } else if ( n < 0 ) {
+        info = -4;
+    } else if ( ldda < max(1,nrowa) ) {
+        info = -7;
+    } else if ( lddb < max(1,m) ) {
+        info = -9;
+    } else if (lddc < max(1,m)) {
+        info = -12;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    magma_chemm( side, uplo, m, n,
+                 alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+}
+
+
+/***************************************************************************//**
+    Performs the complex symmetric matrix-vector product
+    \f$ y = \alpha A x + \beta y \f$.
+
+    @ingroup magma_symv
+*******************************************************************************/
+extern "C" magma_int_t
+magmablas_csymv(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -1;
+    } else if ( n < 0 ) {
+        info = -2;
+    } else if ( ldda < max(1, n) ) {
+        info = -5;
+    } else if ( incx == 0 ) {
+        info = -7;
+    } else if ( incy == 0 ) {
+        info = -10;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    magma_csymv( uplo, n, alpha, dA, ldda, dx, incx, beta, dy, incy, queue );
+    return info;
+}
+
+
+/***************************************************************************//**
+    Performs the complex symmetric matrix-vector product
+    \f$ y = \alpha A x + \beta y \f$.
+    dwork is not referenced, but lwork is checked as in the CUDA version.
+
+    @ingroup magma_symv
+*******************************************************************************/
+extern "C" magma_int_t
+magmablas_csymv_work(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dx, magma_int_t incx,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr dy, magma_int_t incy,
+    magmaFloatComplex_ptr dwork, magma_int_t lwork,
+    magma_queue_t queue )
+{
+    // NB_X = 64 in the CUDA version
+    magma_int_t lwmin = ldda*magma_ceildiv( n, 64 );
+
+    magma_int_t info = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -1;
+    } else if ( n < 0 ) {
+        info = -2;
+    } else if ( ldda < max(1, n) ) {
+        info = -5;
+    } else if ( incx == 0 ) {
+        info = -7;
+    } else if ( incy == 0 ) {
+        info = -10;
+    } else if ( lwork < lwmin ) {
+        info = -12;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    magma_csymv( uplo, n, alpha, dA, ldda, dx, incx, beta, dy, incy, queue );
+    return info;
+}
+
+#endif // HAVE_HOST
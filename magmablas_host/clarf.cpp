@@ -0,0 +1,567 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from magmablas_host/zlarf.cpp, normal z -> c, Sat Oct 17 01:12:27 2026
+*/
+#include "host_stream.hpp"
+
+#define COMPLEX
+
+#define PRECISION_c
+
+#ifdef HAVE_HOST
+
+// Host versions of the magmablas Householder kernels used by the
+// cgeqr2x_gpu and claqps_gpu panels. Each CUDA kernel becomes a static
+// routine below that pushes the same loop, run serially, to the worker
+// thread of the queue; the drivers are kept as in the CUDA versions.
+// See the CUDA versions for the full argument descriptions.
+
+
+/******************************************************************************/
+// dwork[b] = V(:,b)**H c, for 0 <= b < k.
+static void
+magma_cgemv_kernel1(
+    magma_int_t k, magma_int_t m,
+    const magmaFloatComplex *V, magma_int_t ldv,
+    const magmaFloatComplex *c,
+    magmaFloatComplex *dwork, magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t b = 0; b < k; ++b) {
+            magmaFloatComplex sum = MAGMA_C_ZERO;
+            for (magma_int_t j = 0; j < m; ++j) {
+                sum += MAGMA_C_CONJ( V[j + b*ldv] ) * c[j];
+            }
+            dwork[b] = sum;
+        }
+    });
+}
+
+
+/******************************************************************************/
+// c = c - V x, with V m-by-n.
+static void
+magma_cgemv_kernel2(
+    magma_int_t m, magma_int_t n,
+    const magmaFloatComplex *V, magma_int_t ldv,
+    const magmaFloatComplex *x,
+    magmaFloatComplex *c, magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < m; ++j) {
+            magmaFloatComplex sum = MAGMA_C_ZERO;
+            for (magma_int_t l = 0; l < n; ++l) {
+                sum += V[j + l*ldv] * x[l];
+            }
+            c[j] -= sum;
+        }
+    });
+}
+
+
+/******************************************************************************/
+// c[0] = 1, then dwork[b] = -tau[0] V(:,b)**H c, for 0 <= b < k.
+static void
+magma_cgemv_kernel3(
+    magma_int_t k, magma_int_t m,
+    const magmaFloatComplex *V, magma_int_t ldv,
+    magmaFloatComplex *c,
+    magmaFloatComplex *dwork, const magmaFloatComplex *tau,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        c[0] = MAGMA_C_ONE;
+        for (magma_int_t b = 0; b < k; ++b) {
+            magmaFloatComplex sum = MAGMA_C_ZERO;
+            for (magma_int_t j = 0; j < m; ++j) {
+                sum += MAGMA_C_CONJ( V[j + b*ldv] ) * c[j];
+            }
+            dwork[b] = -tau[0] * sum;
+        }
+    });
+}
+
+
+/******************************************************************************/
+// y[0:k] = T(0:k,0:k) t, then y[k] = tau[0].
+static void
+magma_ctrmv_kernel2(
+    magma_int_t k,
+    const magmaFloatComplex *T, magma_int_t ldt,
+    const magmaFloatComplex *t,
+    magmaFloatComplex *y, const magmaFloatComplex *tau,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t b = 0; b < k; ++b) {
+            magmaFloatComplex sum = MAGMA_C_ZERO;
+            for (magma_int_t l = 0; l < k; ++l) {
+                sum += T[b + l*ldt] * t[l];
+            }
+            y[b] = sum;
+        }
+        y[k] = tau[0];
+    });
+}
+
+
+/******************************************************************************/
+// y[0:k] = T(0:k,0:k)**H t.
+static void
+magma_ctrmv_tkernel(
+    magma_int_t k,
+    const magmaFloatComplex *T, magma_int_t ldt,
+    const magmaFloatComplex *t,
+    magmaFloatComplex *y, magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t b = 0; b < k; ++b) {
+            magmaFloatComplex sum = MAGMA_C_ZERO;
+            for (magma_int_t l = 0; l < k; ++l) {
+                sum += MAGMA_C_CONJ( T[l + b*ldt] ) * t[l];
+            }
+            y[b] = sum;
+        }
+    });
+}
+
+
+/******************************************************************************/
+// T(0,0) = tau[0], and the diagonal entry dx0 of V is set to 1.
+static void
+magma_clarfg_first_t(
+    const magmaFloatComplex *dtau, magmaFloatComplex *T,
+    magmaFloatComplex *dx0, magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        T[0]   = dtau[0];
+        dx0[0] = MAGMA_C_ONE;
+    });
+}
+
+
+/***************************************************************************//**
+    Generates a Householder elementary reflector, like LAPACK's clarfg:
+        H**H [ alpha ] = [ beta ],   H**H H = I.
+             [   x   ]   [   0  ]
+    dalpha, dx, and dtau are in device memory.
+
+    @ingroup magma_larfg
+*******************************************************************************/
+extern "C"
+void magmablas_clarfg(
+    magma_int_t n,
+    magmaFloatComplex_ptr dalpha,
+    magmaFloatComplex_ptr dx, magma_int_t incx,
+    magmaFloatComplex_ptr dtau,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        lapackf77_clarfg( &n, dalpha, dx, &incx, dtau );
+    });
+}
+
+
+/***************************************************************************//**
+    Generates Householder elementary reflector H = I - tau v v^T to reduce
+        H [ dx0 ] = [ beta ]
+          [ dx  ]   [ 0    ]
+    with |beta| = norm( [dx0, dx] ).
+    Stores v over dx; first element of v is 1 and is not stored.
+    Stores beta over dAkk.
+    Stores tau.
+
+    The norm of dx is recomputed into dxnorm (array in device memory).
+*******************************************************************************/
+extern "C" void
+magma_clarfg_gpu(
+    magma_int_t n,
+    magmaFloatComplex_ptr dx0,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex_ptr dtau,
+    magmaFloat_ptr        dxnorm,
+    magmaFloatComplex_ptr dAkk,
+    magma_queue_t queue )
+{
+    /* recomputing the norm */
+    magmablas_scnrm2_cols(n-1, 1, dx0+1, n, dxnorm, queue);
+
+    magma_host_enqueue_func( queue, [=]() {
+        if ( n <= 0 ) {
+            *dtau = MAGMA_C_ZERO;
+            *dAkk = *dx0;
+            return;
+        }
+
+        float xnorm  = *dxnorm;
+        float alphar = MAGMA_C_REAL( *dx0 );
+        float alphai = MAGMA_C_IMAG( *dx0 );
+        if ( xnorm != 0 || alphai != 0 ) {
+            float beta  = sqrt( alphar*alphar + alphai*alphai + xnorm*xnorm );
+            beta  = -copysign( beta, alphar );
+
+            // todo: deal with badly scaled vectors (see lapack's larfg)
+            *dtau = MAGMA_C_MAKE( (beta - alphar)/beta, -alphai/beta );
+            *dAkk = MAGMA_C_MAKE( beta, 0. );
+
+            magmaFloatComplex scale =
+                MAGMA_C_DIV( MAGMA_C_ONE, MAGMA_C_MAKE( alphar - beta, alphai ));
+            if ( xnorm != 0 ) {
+                for (magma_int_t j = 0; j < n-1; ++j) {
+                    dx[j] = MAGMA_C_MUL( dx[j], scale );
+                }
+            }
+        }
+        else {
+            *dtau = MAGMA_C_ZERO;
+            *dAkk = *dx0;
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Generates Householder elementary reflector H = I - tau v v^T to reduce
+        H [ dx0 ] = [ beta ]
+          [ dx  ]   [ 0    ]
+    with |beta| = norm( [dx0, dx] ) = dxnorm[0].
+    Stores v over dx; first element of v is 1 and is not stored.
+    Stores beta over dA.
+    Stores tau.
+    The iter elements above dx0 are moved above dA.
+
+    The difference with LAPACK's clarfg is that the norm of dx, and hence beta,
+    are computed outside the routine and passed to it in dxnorm (array in
+    device memory).
+*******************************************************************************/
+extern "C" void
+magma_clarfgx_gpu(
+    magma_int_t n,
+    magmaFloatComplex_ptr dx0,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex_ptr dtau,
+    magmaFloat_ptr        dxnorm,
+    magmaFloatComplex_ptr dA, magma_int_t iter,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        float xnorm  = *dxnorm;
+        float alphar = MAGMA_C_REAL( *dx0 );
+        float alphai = MAGMA_C_IMAG( *dx0 );
+        #ifdef COMPLEX
+        if ( (xnorm == 0 && alphai == 0) || n == 0 )
+        #else
+        if ( (xnorm == 0 && alphai == 0) || n == 1 )
+        #endif
+        {
+            *dtau = MAGMA_C_ZERO;
+            *dA   = *dx0;
+        }
+        else {
+            // no need to compute the norm as it is passed as input
+            float beta  = -copysign( xnorm, alphar );
+
+            // todo: deal with badly scaled vectors (see lapack's larfg)
+            *dtau = MAGMA_C_MAKE( (beta - alphar)/beta, -alphai/beta );
+            *dA   = MAGMA_C_MAKE( beta, 0. );
+
+            magmaFloatComplex scale =
+                MAGMA_C_DIV( MAGMA_C_ONE, MAGMA_C_MAKE( alphar - beta, alphai ));
+            if ( xnorm != 0 ) {
+                for (magma_int_t j = 0; j < n-1; ++j) {
+                    dx[j] = MAGMA_C_MUL( dx[j], scale );
+                }
+            }
+        }
+
+        for (magma_int_t j = 0; j < iter; ++j) {
+            *( dA-iter+j) = *(dx0-iter+j);
+            *(dx0-iter+j) = MAGMA_C_ZERO;
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Generates Householder elementary reflector H = I - tau v v^T, as
+    magma_clarfgx_gpu, and computes the iter-th column of the triangular
+    factor T of the block reflector.
+*******************************************************************************/
+extern "C" void
+magma_clarfgtx_gpu(
+    magma_int_t n,
+    magmaFloatComplex_ptr dx0,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex_ptr dtau,
+    magmaFloat_ptr        dxnorm,
+    magmaFloatComplex_ptr dA, magma_int_t iter,
+    magmaFloatComplex_ptr V,  magma_int_t ldv,
+    magmaFloatComplex_ptr T,  magma_int_t ldt,
+    magmaFloatComplex_ptr dwork,
+    magma_queue_t queue )
+{
+    /*  Generate the elementary reflector H(iter)  */
+    magma_clarfgx_gpu(n, dx0, dx, dtau, dxnorm, dA, iter, queue);
+
+    if (iter == 0) {
+        magma_clarfg_first_t( dtau, T+iter+iter*ldt, dx0, queue );
+    }
+    else {
+        /* Compute the iter-th column of T */
+        magma_cgemv_kernel3( iter, n, V, ldv, dx0, dwork, dtau, queue );
+        magma_ctrmv_kernel2( iter, T, ldt, dwork, T+iter*ldt, dtau, queue );
+    }
+}
+
+
+/***************************************************************************//**
+    Apply a complex elementary reflector H to a complex M-by-N
+    matrix C from the left. H is represented in the form
+          H = I - tau * v * v**H
+    where tau is a complex scalar and v is a complex vector.
+    If tau = 0, then H is taken to be the unit matrix.
+
+    To apply H**H (the conjugate transpose of H), supply conjg(tau)
+    instead tau.
+*******************************************************************************/
+extern "C" magma_int_t
+magma_clarf_gpu(
+    magma_int_t m,  magma_int_t n,
+    magmaFloatComplex_const_ptr dv,
+    magmaFloatComplex_const_ptr dtau,
+    magmaFloatComplex_ptr dC,  magma_int_t lddc,
+    magma_queue_t queue )
+{
+    if ( n > 0 && m > 0 ) {
+        magma_host_enqueue_func( queue, [=]() {
+            if ( MAGMA_C_EQUAL( *dtau, MAGMA_C_ZERO ) ) {
+                return;
+            }
+            for (magma_int_t b = 0; b < n; ++b) {
+                magmaFloatComplex *dc = dC + b*lddc;
+
+                /* w := v**H * C, with v[0] = 1 */
+                magmaFloatComplex sum = dc[0];
+                for (magma_int_t j = 1; j < m; ++j) {
+                    sum += MAGMA_C_CONJ( dv[j] ) * dc[j];
+                }
+
+                /* C := C - v * w */
+                magmaFloatComplex tmp = -MAGMA_C_CONJ( *dtau ) * sum;
+                dc[0] += tmp;
+                for (magma_int_t j = 1; j < m; ++j) {
+                    dc[j] += tmp * dv[j];
+                }
+            }
+        });
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/***************************************************************************//**
+    Apply a complex elementary reflector H to a complex M-by-N
+    matrix C from the left, as magma_clarf_gpu, and compute the iter-th
+    column of the triangular factor T of the block reflector.
+    v[0] is set to 1.
+*******************************************************************************/
+extern "C" void
+magma_clarfx_gpu(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex_ptr v,
+    magmaFloatComplex_ptr tau,
+    magmaFloatComplex_ptr C, magma_int_t ldc,
+    magmaFloat_ptr        xnorm,
+    magmaFloatComplex_ptr dT, magma_int_t iter,
+    magmaFloatComplex_ptr work,
+    magma_queue_t queue )
+{
+    magma_int_t N = n + iter + 1;
+    magmaFloatComplex *T = (iter == 0 ? dT+iter*N : work);
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t b = 0; b < N; ++b) {
+            if ( ! MAGMA_C_EQUAL( *tau, MAGMA_C_ZERO ) ) {
+                magmaFloatComplex *dc = C + b*ldc;
+
+                /* if b < iter, V(i:n,i)**H * V(i:n,1:i-1) for computing T;
+                 * if b > iter, w := v**H * C */
+                magmaFloatComplex sum = MAGMA_C_ZERO;
+                if ( m > 0 ) {
+                    sum = dc[0];
+                    v[0] = MAGMA_C_ONE;
+                }
+                for (magma_int_t j = 1; j < m; ++j) {
+                    sum += MAGMA_C_CONJ( v[j] ) * dc[j];
+                }
+
+                /*  C := C - v * w  */
+                magmaFloatComplex z__1 = -MAGMA_C_CONJ( *tau ) * sum;
+                if (b > iter) {
+                    for (magma_int_t j = 0; j < m; ++j) {
+                        dc[j] += z__1 * v[j];
+                    }
+                }
+                else if (b == iter) {
+                    T[iter] = *tau;
+                }
+                else {
+                    T[b] = MAGMA_C_CONJ( z__1 );
+                }
+            }
+            else if (b <= iter) {
+                // in case tau is zero put the corresponding column of T to zero
+                T[b] = MAGMA_C_ZERO;
+            }
+        }
+    });
+
+    if (iter > 0) {
+        magma_ctrmv_kernel2( iter, dT, N, work, dT+iter*N, tau, queue );
+    }
+}
+
+
+/***************************************************************************//**
+    Apply a complex block reflector H to a complex vector C from the left
+    (i.e., C = H C). H is represented in the form
+          H = I - V T V**H
+    where T is the complex k-by-k upper triangular matrix in the
+    representation of the block reflector, and V is a complex block of
+    k elementary reflectors.
+*******************************************************************************/
+extern "C" void
+magma_clarfbx_gpu(
+    magma_int_t m, magma_int_t k,
+    magmaFloatComplex_ptr V,  magma_int_t ldv,
+    magmaFloatComplex_ptr dT, magma_int_t ldt,
+    magmaFloatComplex_ptr c,
+    magmaFloatComplex_ptr dwork,
+    magma_queue_t queue )
+{
+    /* dwork = V**H c     */
+    magma_cgemv_kernel1( k, m, V, ldv, c, dwork, queue );
+
+    /* dwork = T**H dwork */
+    magma_ctrmv_tkernel( k, dT, ldt, dwork, dwork+k, queue );
+
+    /* c = c - V dwork    */
+    magma_cgemv_kernel2( m, k, V, ldv, dwork+k, c, queue );
+}
+
+
+/***************************************************************************//**
+    CGEQR2 computes a QR factorization of a complex m by n matrix A:
+    A = Q * R, returning the triangular n x n factor T of the block
+    reflector in dT and the diagonal n x n blocks of R in ddA.
+    This version adds internal blocking.
+
+    @ingroup magma_geqr2
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cgeqr2x4_gpu(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_ptr dtau,
+    magmaFloatComplex_ptr dT,
+    magmaFloatComplex_ptr ddA,
+    magmaFloat_ptr dwork,
+    magma_queue_t queue,
+    magma_int_t *info)
+{
+    #define dA(i_,j_) (dA + (j_)*(ldda) + (i_))
+    #define dT(i_,j_) (dT + (j_)*(k)    + (i_))
+    #define BS 32
+
+    magma_int_t i, k;
+
+    magmaFloat_ptr dnorm = (magmaFloat_ptr)dwork;
+    magmaFloatComplex_ptr dwork2 = (magmaFloatComplex_ptr)(dwork + 2*n);
+
+    *info = 0;
+    if (m < 0) {
+        *info = -1;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (ldda < max(1,m)) {
+        *info = -4;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Compute the norms of the trailing columns */
+    k = min(m,n);
+    magmablas_scnrm2_cols( m, k, dA(0,0), ldda, dnorm, queue );
+
+    for (magma_int_t b=0; b < k; b += BS) {
+        for (i = b; i < min(k, b+BS); ++i) {
+            /*   Apply H**H to A(:,i) from the left */
+            if (i-b > 0) {
+                /* Compute the (i-1)th column of T */
+                if ( i-1 > 0 ) {
+                    magma_cgemv_kernel3( i-1, m-i+1, dA(i-1,0), ldda,
+                                         dA(i-1, i-1), dwork2, dtau+i-1, queue );
+                    magma_ctrmv_kernel2( i-1, dT(0,0), k, dwork2,
+                                         dT(0,i-1), dtau+i-1, queue );
+                }
+
+                /* dwork = V**H c */
+                magma_cgemv_kernel1( i-b, m-b, dA(b, b), ldda, dA(b,i),
+                                     dwork2, queue );
+
+                /* dwork = T**H dwork2 */
+                magma_ctrmv_tkernel( i-b, dT(b,b), k, dwork2, dwork2+i-b, queue );
+
+                /* c = c - V dwork2 */
+                if ( m-b > 0 ) {
+                    magma_cgemv_kernel2( m-b, i-b, dA(b,b), ldda,
+                                         dwork2+i-b, dA(b, i), queue );
+                }
+            }
+
+            /*   Adjust the dnorm[i] to hold the norm of A(i:m,i) */
+            if ( i > 0 ) {
+                magmablas_scnrm2_adjust( i, dnorm+i, dA(0, i), queue );
+            }
+
+            /*  Generate elementary reflector H(i) to annihilate A(i+1:m,i)
+                1. 1 is not yet put on the diagonal of A
+                2. Elements above the diagonal are copied in ddA and
+                   the ones in A are set to zero
+                3. update T */
+            magma_clarfgx_gpu( m-i, dA(i, i), dA(min(i+1,m),i), dtau+i,
+                               dnorm+i, ddA + i + i*n, i, queue );
+
+            if (i == 0) {
+                magma_clarfg_first_t( dtau, dT(0,0), dA(i, i), queue );
+            }
+        }
+        if ( i-1 > 0 ) {
+            magma_cgemv_kernel3( i-1, m-i+1, dA(i-1,0), ldda,
+                                 dA(i-1, i-1), dwork2, dtau+i-1, queue );
+            magma_ctrmv_kernel2( i-1, dT(0,0), k, dwork2,
+                                 dT(0,i-1), dtau+i-1, queue );
+        }
+
+        /* Apply the transformations to the trailing matrix. */
+        magma_clarfb2_gpu(
+                           m-b, k-i, BS,
+                           dA(b, b), ldda, dT+b+b*k, k,
+                           dA(b, i), ldda, dwork2, k-i, queue );
+    }
+
+    return *info;
+
+    #undef dA
+    #undef dT
+    #undef BS
+} /* magma_cgeqr2 */
+
+#endif // HAVE_HOST
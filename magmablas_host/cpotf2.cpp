@@ -0,0 +1,185 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from magmablas_host/zpotf2.cpp, normal z -> c, Sat Oct 17 01:12:27 2026
+*/
+#include "host_stream.hpp"
+
+#define COMPLEX
+
+#define PRECISION_c
+
+#ifdef HAVE_HOST
+
+// Host versions of the Cholesky panel kernels, including the native panel
+// of cpotrf_gpu. On the host, each panel is factored by LAPACK on the worker
+// thread of the queue, so the panel is not split into recursive tiles;
+// recnb is unused.
+// See the CUDA versions for the full argument descriptions.
+
+
+/***************************************************************************//**
+    CPOTF2 computes the Cholesky factorization of a Hermitian
+    positive definite matrix A.
+
+    @ingroup magma_potf2
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cpotf2_gpu(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex_ptr dA, magma_int_t ldda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower) {
+        *info = -1;
+    } else if (n < 0 || n > 512) {
+        *info = -2;
+    } else if (ldda < max(1,n)) {
+        *info = -4;
+    }
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    // Quick return if possible
+    if (n == 0) {
+        return *info;
+    }
+
+    magma_queue_sync( queue );
+    lapackf77_cpotrf( lapack_uplo_const( uplo ), &n, dA, &ldda, info );
+
+    return *info;
+}
+
+
+/***************************************************************************//**
+    Factors the n-by-n panel dA on the queue, and sets dinfo to gbstep + k
+    if the leading minor of order k is not positive definite and dinfo is
+    still zero. dinfo is in device memory.
+*******************************************************************************/
+static void
+magma_cpotf2_host(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex *dA, magma_int_t lda, magma_int_t gbstep,
+    magma_int_t *dinfo, magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t iinfo;
+        lapackf77_cpotrf( lapack_uplo_const( uplo ), &n, dA, &lda, &iinfo );
+        if (iinfo > 0 && *dinfo == 0) {
+            *dinfo = gbstep + iinfo;
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Cholesky panel factorization, lower case only, with the same interface
+    as the CUDA version. The error is reported in dinfo, in device memory.
+
+    @ingroup magma_potf2
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cpotf2_lpout(
+        magma_uplo_t uplo, magma_int_t n,
+        magmaFloatComplex *dA, magma_int_t lda, magma_int_t gbstep,
+        magma_int_t *dinfo, magma_queue_t queue)
+{
+    magma_int_t arginfo = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower) {
+        arginfo = -1;
+    } else if (n < 0) {
+        arginfo = -2;
+    } else if (lda < max(1,n)) {
+        arginfo = -4;
+    }
+
+    if (arginfo != 0) {
+        magma_xerbla( __func__, -(arginfo) );
+        return arginfo;
+    }
+
+    // Quick return if possible
+    if (n == 0) {
+        return arginfo;
+    }
+
+    if (uplo == MagmaUpper) {
+        fprintf( stderr, "%s: uplo=upper is not yet implemented\n", __func__ );
+        arginfo = -1;
+        return arginfo;
+    }
+
+    magma_cpotf2_host( uplo, n, dA, lda, gbstep, dinfo, queue );
+    return arginfo;
+}
+
+
+/***************************************************************************//**
+    Cholesky panel factorization, lower case only, with the same interface
+    as the CUDA version. The error is reported in dinfo, in device memory.
+
+    @ingroup magma_potf2
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cpotf2_lpin(
+        magma_uplo_t uplo, magma_int_t n,
+        magmaFloatComplex *dA, magma_int_t lda, magma_int_t gbstep,
+        magma_int_t *dinfo, magma_queue_t queue)
+{
+    // Quick return if possible
+    if (n == 0) {
+        return 0;
+    }
+
+    magma_cpotf2_host( uplo, n, dA, lda, gbstep, dinfo, queue );
+    return 0;
+}
+
+
+/***************************************************************************//**
+    Native Cholesky factorization of the diagonal tile dA, used by
+    cpotrf_gpu in MagmaNative mode. The error is reported in dinfo,
+    in device memory, as gbstep + k.
+
+    @ingroup magma_potrf
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cpotrf_rectile_native(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t recnb,
+    magmaFloatComplex* dA,    magma_int_t ldda, magma_int_t gbstep,
+    magma_int_t *dinfo,  magma_int_t *info, magma_queue_t queue)
+{
+    *info = 0;
+    // check arguments
+    if ( uplo != MagmaUpper && uplo != MagmaLower) {
+        *info = -1;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (ldda < max(1,n)) {
+        *info = -4;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    // Quick return if possible
+    if ( n == 0 ) {
+        return *info;
+    }
+
+    magma_cpotf2_host( uplo, n, dA, ldda, gbstep, dinfo, queue );
+    return *info;
+}
+
+#endif // HAVE_HOST
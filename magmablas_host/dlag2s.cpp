@@ -0,0 +1,248 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from magmablas_host/zlag2c.cpp, mixed zc -> ds, Sat Oct 17 01:12:26 2026
+*/
+#include "host_stream.hpp"
+
+#define PRECISION_d
+
+#ifdef HAVE_HOST
+
+// Host versions of the magmablas mixed precision kernels.
+// dlag2s and dlat2s return info, so they wait for the queue, then convert
+// directly, as the CUDA versions wait to read the overflow flag; the others
+// push a lambda to the worker thread of the queue.
+// See the CUDA versions for the full argument descriptions.
+
+
+/***************************************************************************//**
+    Converts the double-real matrix A to the single-real matrix SA.
+    info = 1 if an entry of A is outside the single precision range.
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magmablas_dlag2s(
+    magma_int_t m, magma_int_t n,
+    magmaDouble_const_ptr A, magma_int_t lda,
+    magmaFloat_ptr SA,       magma_int_t ldsa,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( m < 0 )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,m) )
+        *info = -4;
+    else if ( ldsa < max(1,m) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+
+    magma_queue_sync( queue );
+    lapackf77_dlag2s( &m, &n, A, &lda, SA, &ldsa, info );
+}
+
+
+/***************************************************************************//**
+    Converts the single-real matrix SA to the double-real matrix A.
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magmablas_slag2d(
+    magma_int_t m, magma_int_t n,
+    magmaFloat_const_ptr SA, magma_int_t ldsa,
+    magmaDouble_ptr       A, magma_int_t lda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( m < 0 )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( ldsa < max(1,m) )
+        *info = -4;
+    else if ( lda < max(1,m) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t iinfo;
+        lapackf77_slag2d( &m, &n, SA, &ldsa, A, &lda, &iinfo );
+    });
+}
+
+
+/***************************************************************************//**
+    Converts the lower or upper triangle of the double-real symmetric
+    matrix A to the single-real matrix SA.
+    info = 1 if an entry of A is outside the single precision range.
+
+    @ingroup magma_lat2
+*******************************************************************************/
+extern "C" void
+magmablas_dlat2s(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaDouble_const_ptr  A, magma_int_t lda,
+    magmaFloat_ptr        SA, magma_int_t ldsa,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,n) )
+        *info = -4;
+    else if ( ldsa < max(1,n) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( n == 0 ) {
+        return;
+    }
+
+    magma_queue_sync( queue );
+    lapackf77_dlat2s( lapack_uplo_const( uplo ), &n, A, &lda, SA, &ldsa, info );
+}
+
+
+/***************************************************************************//**
+    Converts the lower or upper triangle of the single-real symmetric
+    matrix SA to the double-real matrix A.
+
+    @ingroup magma_lat2
+*******************************************************************************/
+extern "C" void
+magmablas_slat2d(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloat_const_ptr SA, magma_int_t ldsa,
+    magmaDouble_ptr      A,  magma_int_t lda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,n) )
+        *info = -4;
+    else if ( ldsa < max(1,n) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( n == 0 ) {
+        return;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            magma_int_t ibeg = (uplo == MagmaLower ? j : 0);
+            magma_int_t iend = (uplo == MagmaLower ? n : j+1);
+            for (magma_int_t i = ibeg; i < iend; ++i) {
+                A[i + j*lda] = MAGMA_D_MAKE( MAGMA_S_REAL( SA[i + j*ldsa] ),
+                                             MAGMA_S_IMAG( SA[i + j*ldsa] ));
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Row i of A is cast to single precision in row ipiv[i] of SA (incx >= 0),
+    or row ipiv[i] of SA is cast to double precision in row i of A (incx < 0),
+    for 0 <= i < m. ipiv is in device memory.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_dslaswp(
+    magma_int_t n,
+    magmaDouble_ptr A, magma_int_t lda,
+    magmaFloat_ptr SA, magma_int_t ldsa,
+    magma_int_t m,
+    const magma_int_t *ipiv, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            for (magma_int_t i = 0; i < m; ++i) {
+                if (incx >= 0) {
+                    double a = A[ipiv[i] + j*lda];
+                    SA[i + j*ldsa] = MAGMA_S_MAKE( (float)MAGMA_D_REAL( a ),
+                                                   (float)MAGMA_D_IMAG( a ));
+                }
+                else {
+                    float sa = SA[ipiv[i] + j*ldsa];
+                    A[i + j*lda] = MAGMA_D_MAKE( (double)MAGMA_S_REAL( sa ),
+                                                 (double)MAGMA_S_IMAG( sa ));
+                }
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Adds the single precision correction r to the solution x, and copies b
+    to w: \f$ x = x + r \f$, \f$ w = b \f$.
+
+    @ingroup magma_axpy
+*******************************************************************************/
+extern "C" void
+magmablas_dsaxpycp(
+    magma_int_t m,
+    magmaFloat_ptr r,
+    magmaDouble_ptr x,
+    magmaDouble_const_ptr b,
+    magmaDouble_ptr w,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t i = 0; i < m; ++i) {
+            x[i] = MAGMA_D_ADD( x[i], MAGMA_D_MAKE( MAGMA_S_REAL( r[i] ),
+                                                    MAGMA_S_IMAG( r[i] ) ) );
+            w[i] = b[i];
+        }
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,461 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from magmablas_host/zlange.cpp, normal z -> d, Sat Oct 17 01:12:26 2026
+*/
+#include "host_stream.hpp"
+
+#define REAL
+
+#define PRECISION_d
+
+#ifdef HAVE_HOST
+
+// Host versions of the magmablas norm, scaling, and inertia kernels.
+// Routines that return a value wait for the queue, then compute it directly;
+// the others push a lambda to the worker thread of the queue.
+// See the CUDA versions for the full argument descriptions.
+
+#define dA(i_, j_) (dA + (i_) + (j_)*ldda)
+
+
+/***************************************************************************//**
+    @return the one norm, Frobenius norm, infinity norm, or the element of
+    largest absolute value of the m x n matrix dA, like LAPACK's dlange.
+    dwork is a workspace of dimension lwork.
+
+    @ingroup magma_lange
+*******************************************************************************/
+extern "C" double
+magmablas_dlange(
+    magma_norm_t norm, magma_int_t m, magma_int_t n,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr dwork, magma_int_t lwork,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( ! (norm == MagmaInfNorm || norm == MagmaMaxNorm ||
+            norm == MagmaOneNorm || norm == MagmaFrobeniusNorm) )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < m )
+        info = -5;
+    else if ( ((norm == MagmaInfNorm || norm == MagmaMaxNorm) && (lwork < m)) ||
+              ((norm == MagmaOneNorm || norm == MagmaFrobeniusNorm ) && (lwork < n)) )
+        info = -7;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    /* Quick return */
+    if ( m == 0 || n == 0 )
+        return 0;
+
+    magma_queue_sync( queue );
+    return lapackf77_dlange( lapack_norm_const( norm ), &m, &n,
+                             dA, &ldda, dwork );
+}
+
+
+/***************************************************************************//**
+    @return the one norm, Frobenius norm, infinity norm, or the element of
+    largest absolute value of the n x n symmetric matrix dA, like LAPACK's
+    dlansy. Only the max norm and the infinity norm (which equals the one
+    norm) are supported, as in the CUDA version.
+    dwork is a workspace of dimension lwork.
+
+    @ingroup magma_lanhe
+*******************************************************************************/
+extern "C" double
+magmablas_dlansy(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr dwork, magma_int_t lwork,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    // 1-norm == inf-norm since A is symmetric
+    bool inf_norm = (norm == MagmaInfNorm || norm == MagmaOneNorm);
+    bool max_norm = (norm == MagmaMaxNorm);
+    if ( ! (max_norm || inf_norm) )
+        info = -1;
+    else if ( uplo != MagmaUpper && uplo != MagmaLower )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < n )
+        info = -5;
+    else if ( lwork < n )
+        info = -7;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    /* Quick return */
+    if ( n == 0 )
+        return 0;
+
+    magma_queue_sync( queue );
+    #ifdef COMPLEX
+    return lapackf77_dlansy( lapack_norm_const( norm ), lapack_uplo_const( uplo ),
+                             &n, dA, &ldda, dwork );
+    #else
+    return lapackf77_dlansy( lapack_norm_const( norm ), lapack_uplo_const( uplo ),
+                             &n, dA, &ldda, dwork );
+    #endif
+}
+
+
+/***************************************************************************//**
+    Multiplies the full, lower triangular, or upper triangular matrix dA
+    by cto/cfrom, like LAPACK's dlascl.
+
+    @ingroup magma_lascl
+*******************************************************************************/
+extern "C" void
+magmablas_dlascl(
+    magma_type_t type, magma_int_t kl, magma_int_t ku,
+    double cfrom, double cto,
+    magma_int_t m, magma_int_t n,
+    magmaDouble_ptr dA, magma_int_t ldda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( type != MagmaLower && type != MagmaUpper && type != MagmaFull )
+        *info = -1;
+    else if ( cfrom == 0 || isnan(cfrom) )
+        *info = -4;
+    else if ( isnan(cto) )
+        *info = -5;
+    else if ( m < 0 )
+        *info = -6;
+    else if ( n < 0 )
+        *info = -3;
+    else if ( ldda < max(1,m) )
+        *info = -7;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;  //info;
+    }
+
+    if ( m == 0 || n == 0 )
+        return;
+
+    magma_host_enqueue_func( queue, [=]() {
+        const char* type_ = (type == MagmaLower ? "L" :
+                             type == MagmaUpper ? "U" : "G");
+        magma_int_t iinfo;
+        lapackf77_dlascl( type_, &kl, &ku, &cfrom, &cto, &m, &n,
+                          dA, &ldda, &iinfo );
+    });
+}
+
+
+/***************************************************************************//**
+    Scales row i of the full, lower triangular, or upper triangular matrix dA
+    by the real scalar dD[i].
+
+    @ingroup magma_lascl2
+*******************************************************************************/
+extern "C" void
+magmablas_dlascl2(
+    magma_type_t type, magma_int_t m, magma_int_t n,
+    magmaDouble_const_ptr dD,
+    magmaDouble_ptr dA, magma_int_t ldda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( type != MagmaLower && type != MagmaUpper && type != MagmaFull )
+        *info = -1;
+    else if ( m < 0 )
+        *info = -2;
+    else if ( n < 0 )
+        *info = -3;
+    else if ( ldda < max(1,m) )
+        *info = -5;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;  //info;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            magma_int_t ibeg = (type == MagmaLower ? j : 0);
+            magma_int_t iend = (type == MagmaUpper ? min( j+1, m ) : m);
+            for (magma_int_t i = ibeg; i < iend; ++i) {
+                *dA(i,j) *= dD[i];
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Divides the lower triangle of dA by the diagonal of dD on the right
+    (column j by dD(j,j)), or the upper triangle of dA by the diagonal of dD
+    on the left (row i by dD(i,i)).
+
+    @ingroup magma_lascl_diag
+*******************************************************************************/
+extern "C" void
+magmablas_dlascl_diag(
+    magma_type_t type, magma_int_t m, magma_int_t n,
+    magmaDouble_const_ptr dD, magma_int_t lddd,
+    magmaDouble_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( type != MagmaLower && type != MagmaUpper )
+        *info = -1;
+    else if ( m < 0 )
+        *info = -2;
+    else if ( n < 0 )
+        *info = -3;
+    else if ( lddd < max(1,m) )
+        *info = -5;
+    else if ( ldda < max(1,m) )
+        *info = -7;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;  //info;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            for (magma_int_t i = 0; i < m; ++i) {
+                if ( type == MagmaLower )
+                    *dA(i,j) = *dA(i,j) / dD[j + j*lddd];
+                else
+                    *dA(i,j) = *dA(i,j) / dD[i + i*lddd];
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Scales the m x 2 matrix dA by the inverse of the 2 x 2 diagonal block
+    stored in dW, as done in the Bunch-Kaufman factorization:
+    for lower, the block is in the first two rows of dW and the rows of dA
+    are taken from the rows after it; for upper, the block is in the last
+    two rows of dW.
+
+    @ingroup magma_lascl_2x2
+*******************************************************************************/
+extern "C" void
+magmablas_dlascl_2x2(
+    magma_type_t type, magma_int_t m,
+    magmaDouble_const_ptr dW, magma_int_t lddw,
+    magmaDouble_ptr       dA, magma_int_t ldda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    #define dW(i_, j_) (dW + (i_) + (j_)*lddw)
+
+    *info = 0;
+    if ( type != MagmaLower && type != MagmaUpper )
+        *info = -1;
+    else if ( m < 0 )
+        *info = -2;
+    else if ( ldda < max(1,m) )
+        *info = -4;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;  //info;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        double D11, D21, D22;
+        double T;
+        if ( type == MagmaLower ) {
+            D21 = *dW(1,0);
+            D11 = *dW(1,1) / D21;
+            D22 = *dW(0,0) / MAGMA_D_CONJ( D21 );
+            T = 1.0 / ( MAGMA_D_REAL( D11*D22 ) - 1.0 );
+            D21 = MAGMA_D_MAKE( T, 0 ) / D21;
+            for (magma_int_t i = 0; i < m; ++i) {
+                *dA(i,0) = MAGMA_D_CONJ( D21 )*( D11*(*dW(2+i,0)) - *dW(2+i,1) );
+                *dA(i,1) = D21*( D22*(*dW(2+i,1)) - *dW(2+i,0) );
+            }
+        }
+        else {
+            D21 = *dW(m,1);
+            D11 = *dW(m+1,1) / MAGMA_D_CONJ( D21 );
+            D22 = *dW(m,0) / D21;
+            T = 1.0 / ( MAGMA_D_REAL( D11*D22 ) - 1.0 );
+            D21 = MAGMA_D_MAKE( T, 0 ) / D21;
+            for (magma_int_t i = 0; i < m; ++i) {
+                *dA(i,0) = D21*( D11*(*dW(i,0)) - *dW(i,1) );
+                *dA(i,1) = MAGMA_D_CONJ( D21 )*( D22*(*dW(i,1)) - *dW(i,0) );
+            }
+        }
+    });
+
+    #undef dW
+}
+
+
+/***************************************************************************//**
+    Computes the inertia of the real part of the diagonal of dA:
+    dneig[0], dneig[1], and dneig[2] are set to the number of positive,
+    negative, and zero entries.
+
+    @ingroup magma_hetrf
+*******************************************************************************/
+extern "C" magma_int_t
+magmablas_ddiinertia(
+    magma_int_t n,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    int *dneig,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 ) {
+        info = -1;
+    } else if ( ldda < max(1, n) ) {
+        info = -3;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    if (n == 0)
+        return info;
+
+    magma_host_enqueue_func( queue, [=]() {
+        dneig[0] = dneig[1] = dneig[2] = 0;
+        for (magma_int_t i = 0; i < n; ++i) {
+            double d = MAGMA_D_REAL( *dA(i,i) );
+            if ( d > 0 )
+                dneig[0] += 1;
+            else if ( d < 0 )
+                dneig[1] += 1;
+            else
+                dneig[2] += 1;
+        }
+    });
+
+    return info;
+}
+
+
+/***************************************************************************//**
+    Computes the norm of each column of the m x n matrix dA into dxnorm.
+
+    @ingroup magma_nrm2
+*******************************************************************************/
+extern "C" void
+magmablas_dnrm2_cols(
+    magma_int_t m, magma_int_t n,
+    magmaDouble_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr dxnorm,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t ione = 1;
+        for (magma_int_t j = 0; j < n; ++j) {
+            dxnorm[j] = magma_cblas_dnrm2( m, dA(0,j), ione );
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Computes the norm of each column j of the m x n matrix dA into dxnorm[j],
+    but only for the columns with dlsticc[j+1] != 0.
+
+    @ingroup magma_nrm2
+*******************************************************************************/
+extern "C" void
+magmablas_dnrm2_check(
+    magma_int_t m, magma_int_t n,
+    magmaDouble_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr dxnorm,
+    magmaDouble_ptr dlsticc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t ione = 1;
+        for (magma_int_t j = 0; j < n; ++j) {
+            if ( dlsticc[j+1] != 0 ) {
+                dxnorm[j] = magma_cblas_dnrm2( m, dA(0,j), ione );
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Adjusts the norm dxnorm[0] of a vector c to give the norm of c[k:],
+    assuming that c was changed with orthogonal transformations.
+
+    @ingroup magma_nrm2
+*******************************************************************************/
+extern "C" void
+magmablas_dnrm2_adjust(
+    magma_int_t k,
+    magmaDouble_ptr dxnorm,
+    magmaDouble_ptr dc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        double sum = 0;
+        for (magma_int_t i = 0; i < k; ++i) {
+            double temp = MAGMA_D_ABS( dc[i] ) / dxnorm[0];
+            sum += temp*temp;
+        }
+        dxnorm[0] *= sqrt( 1 - sum );
+    });
+}
+
+
+/***************************************************************************//**
+    Adjusts the norms dxnorm[0:k] of the columns of C[:,0:k] to give the norms
+    of C[1:,0:k], assuming that C was changed with orthogonal transformations.
+    As in the CUDA version, the QP3 accuracy check is disabled, so dlsticc
+    is cleared.
+
+    @ingroup magma_nrm2
+*******************************************************************************/
+extern "C" void
+magmablas_dnrm2_row_check_adjust(
+    magma_int_t k, double tol,
+    magmaDouble_ptr dxnorm,
+    magmaDouble_ptr dxnorm2,
+    magmaDouble_ptr dC, magma_int_t lddc,
+    magmaDouble_ptr dlsticc,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t i = 0; i < k; ++i) {
+            double temp = MAGMA_D_ABS( dC[i*lddc] ) / dxnorm[i];
+            temp = max( 0.0, ((1.0 + temp) * (1.0 - temp)) );
+            dxnorm[i] *= sqrt( temp );
+        }
+        for (magma_int_t i = 0; i <= k; ++i) {
+            dlsticc[i] = 0;
+        }
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,567 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from magmablas_host/zlarf.cpp, normal z -> d, Sat Oct 17 01:12:27 2026
+*/
+#include "host_stream.hpp"
+
+#define REAL
+
+#define PRECISION_d
+
+#ifdef HAVE_HOST
+
+// Host versions of the magmablas Householder kernels used by the
+// dgeqr2x_gpu and dlaqps_gpu panels. Each CUDA kernel becomes a static
+// routine below that pushes the same loop, run serially, to the worker
+// thread of the queue; the drivers are kept as in the CUDA versions.
+// See the CUDA versions for the full argument descriptions.
+
+
+/******************************************************************************/
+// dwork[b] = V(:,b)**H c, for 0 <= b < k.
+static void
+magma_dgemv_kernel1(
+    magma_int_t k, magma_int_t m,
+    const double *V, magma_int_t ldv,
+    const double *c,
+    double *dwork, magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t b = 0; b < k; ++b) {
+            double sum = MAGMA_D_ZERO;
+            for (magma_int_t j = 0; j < m; ++j) {
+                sum += MAGMA_D_CONJ( V[j + b*ldv] ) * c[j];
+            }
+            dwork[b] = sum;
+        }
+    });
+}
+
+
+/******************************************************************************/
+// c = c - V x, with V m-by-n.
+static void
+magma_dgemv_kernel2(
+    magma_int_t m, magma_int_t n,
+    const double *V, magma_int_t ldv,
+    const double *x,
+    double *c, magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < m; ++j) {
+            double sum = MAGMA_D_ZERO;
+            for (magma_int_t l = 0; l < n; ++l) {
+                sum += V[j + l*ldv] * x[l];
+            }
+            c[j] -= sum;
+        }
+    });
+}
+
+
+/******************************************************************************/
+// c[0] = 1, then dwork[b] = -tau[0] V(:,b)**H c, for 0 <= b < k.
+static void
+magma_dgemv_kernel3(
+    magma_int_t k, magma_int_t m,
+    const double *V, magma_int_t ldv,
+    double *c,
+    double *dwork, const double *tau,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        c[0] = MAGMA_D_ONE;
+        for (magma_int_t b = 0; b < k; ++b) {
+            double sum = MAGMA_D_ZERO;
+            for (magma_int_t j = 0; j < m; ++j) {
+                sum += MAGMA_D_CONJ( V[j + b*ldv] ) * c[j];
+            }
+            dwork[b] = -tau[0] * sum;
+        }
+    });
+}
+
+
+/******************************************************************************/
+// y[0:k] = T(0:k,0:k) t, then y[k] = tau[0].
+static void
+magma_dtrmv_kernel2(
+    magma_int_t k,
+    const double *T, magma_int_t ldt,
+    const double *t,
+    double *y, const double *tau,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t b = 0; b < k; ++b) {
+            double sum = MAGMA_D_ZERO;
+            for (magma_int_t l = 0; l < k; ++l) {
+                sum += T[b + l*ldt] * t[l];
+            }
+            y[b] = sum;
+        }
+        y[k] = tau[0];
+    });
+}
+
+
+/******************************************************************************/
+// y[0:k] = T(0:k,0:k)**H t.
+static void
+magma_dtrmv_tkernel(
+    magma_int_t k,
+    const double *T, magma_int_t ldt,
+    const double *t,
+    double *y, magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t b = 0; b < k; ++b) {
+            double sum = MAGMA_D_ZERO;
+            for (magma_int_t l = 0; l < k; ++l) {
+                sum += MAGMA_D_CONJ( T[l + b*ldt] ) * t[l];
+            }
+            y[b] = sum;
+        }
+    });
+}
+
+
+/******************************************************************************/
+// T(0,0) = tau[0], and the diagonal entry dx0 of V is set to 1.
+static void
+magma_dlarfg_first_t(
+    const double *dtau, double *T,
+    double *dx0, magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        T[0]   = dtau[0];
+        dx0[0] = MAGMA_D_ONE;
+    });
+}
+
+
+/***************************************************************************//**
+    Generates a Householder elementary reflector, like LAPACK's dlarfg:
+        H**H [ alpha ] = [ beta ],   H**H H = I.
+             [   x   ]   [   0  ]
+    dalpha, dx, and dtau are in device memory.
+
+    @ingroup magma_larfg
+*******************************************************************************/
+extern "C"
+void magmablas_dlarfg(
+    magma_int_t n,
+    magmaDouble_ptr dalpha,
+    magmaDouble_ptr dx, magma_int_t incx,
+    magmaDouble_ptr dtau,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        lapackf77_dlarfg( &n, dalpha, dx, &incx, dtau );
+    });
+}
+
+
+/***************************************************************************//**
+    Generates Householder elementary reflector H = I - tau v v^T to reduce
+        H [ dx0 ] = [ beta ]
+          [ dx  ]   [ 0    ]
+    with |beta| = norm( [dx0, dx] ).
+    Stores v over dx; first element of v is 1 and is not stored.
+    Stores beta over dAkk.
+    Stores tau.
+
+    The norm of dx is recomputed into dxnorm (array in device memory).
+*******************************************************************************/
+extern "C" void
+magma_dlarfg_gpu(
+    magma_int_t n,
+    magmaDouble_ptr dx0,
+    magmaDouble_ptr dx,
+    magmaDouble_ptr dtau,
+    magmaDouble_ptr        dxnorm,
+    magmaDouble_ptr dAkk,
+    magma_queue_t queue )
+{
+    /* recomputing the norm */
+    magmablas_dnrm2_cols(n-1, 1, dx0+1, n, dxnorm, queue);
+
+    magma_host_enqueue_func( queue, [=]() {
+        if ( n <= 0 ) {
+            *dtau = MAGMA_D_ZERO;
+            *dAkk = *dx0;
+            return;
+        }
+
+        double xnorm  = *dxnorm;
+        double alphar = MAGMA_D_REAL( *dx0 );
+        double alphai = MAGMA_D_IMAG( *dx0 );
+        if ( xnorm != 0 || alphai != 0 ) {
+            double beta  = sqrt( alphar*alphar + alphai*alphai + xnorm*xnorm );
+            beta  = -copysign( beta, alphar );
+
+            // todo: deal with badly scaled vectors (see lapack's larfg)
+            *dtau = MAGMA_D_MAKE( (beta - alphar)/beta, -alphai/beta );
+            *dAkk = MAGMA_D_MAKE( beta, 0. );
+
+            double scale =
+                MAGMA_D_DIV( MAGMA_D_ONE, MAGMA_D_MAKE( alphar - beta, alphai ));
+            if ( xnorm != 0 ) {
+                for (magma_int_t j = 0; j < n-1; ++j) {
+                    dx[j] = MAGMA_D_MUL( dx[j], scale );
+                }
+            }
+        }
+        else {
+            *dtau = MAGMA_D_ZERO;
+            *dAkk = *dx0;
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Generates Householder elementary reflector H = I - tau v v^T to reduce
+        H [ dx0 ] = [ beta ]
+          [ dx  ]   [ 0    ]
+    with |beta| = norm( [dx0, dx] ) = dxnorm[0].
+    Stores v over dx; first element of v is 1 and is not stored.
+    Stores beta over dA.
+    Stores tau.
+    The iter elements above dx0 are moved above dA.
+
+    The difference with LAPACK's dlarfg is that the norm of dx, and hence beta,
+    are computed outside the routine and passed to it in dxnorm (array in
+    device memory).
+*******************************************************************************/
+extern "C" void
+magma_dlarfgx_gpu(
+    magma_int_t n,
+    magmaDouble_ptr dx0,
+    magmaDouble_ptr dx,
+    magmaDouble_ptr dtau,
+    magmaDouble_ptr        dxnorm,
+    magmaDouble_ptr dA, magma_int_t iter,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        double xnorm  = *dxnorm;
+        double alphar = MAGMA_D_REAL( *dx0 );
+        double alphai = MAGMA_D_IMAG( *dx0 );
+        #ifdef COMPLEX
+        if ( (xnorm == 0 && alphai == 0) || n == 0 )
+        #else
+        if ( (xnorm == 0 && alphai == 0) || n == 1 )
+        #endif
+        {
+            *dtau = MAGMA_D_ZERO;
+            *dA   = *dx0;
+        }
+        else {
+            // no need to compute the norm as it is passed as input
+            double beta  = -copysign( xnorm, alphar );
+
+            // todo: deal with badly scaled vectors (see lapack's larfg)
+            *dtau = MAGMA_D_MAKE( (beta - alphar)/beta, -alphai/beta );
+            *dA   = MAGMA_D_MAKE( beta, 0. );
+
+            double scale =
+                MAGMA_D_DIV( MAGMA_D_ONE, MAGMA_D_MAKE( alphar - beta, alphai ));
+            if ( xnorm != 0 ) {
+                for (magma_int_t j = 0; j < n-1; ++j) {
+                    dx[j] = MAGMA_D_MUL( dx[j], scale );
+                }
+            }
+        }
+
+        for (magma_int_t j = 0; j < iter; ++j) {
+            *( dA-iter+j) = *(dx0-iter+j);
+            *(dx0-iter+j) = MAGMA_D_ZERO;
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Generates Householder elementary reflector H = I - tau v v^T, as
+    magma_dlarfgx_gpu, and computes the iter-th column of the triangular
+    factor T of the block reflector.
+*******************************************************************************/
+extern "C" void
+magma_dlarfgtx_gpu(
+    magma_int_t n,
+    magmaDouble_ptr dx0,
+    magmaDouble_ptr dx,
+    magmaDouble_ptr dtau,
+    magmaDouble_ptr        dxnorm,
+    magmaDouble_ptr dA, magma_int_t iter,
+    magmaDouble_ptr V,  magma_int_t ldv,
+    magmaDouble_ptr T,  magma_int_t ldt,
+    magmaDouble_ptr dwork,
+    magma_queue_t queue )
+{
+    /*  Generate the elementary reflector H(iter)  */
+    magma_dlarfgx_gpu(n, dx0, dx, dtau, dxnorm, dA, iter, queue);
+
+    if (iter == 0) {
+        magma_dlarfg_first_t( dtau, T+iter+iter*ldt, dx0, queue );
+    }
+    else {
+        /* Compute the iter-th column of T */
+        magma_dgemv_kernel3( iter, n, V, ldv, dx0, dwork, dtau, queue );
+        magma_dtrmv_kernel2( iter, T, ldt, dwork, T+iter*ldt, dtau, queue );
+    }
+}
+
+
+/***************************************************************************//**
+    Apply a real elementary reflector H to a real M-by-N
+    matrix C from the left. H is represented in the form
+          H = I - tau * v * v**H
+    where tau is a real scalar and v is a real vector.
+    If tau = 0, then H is taken to be the unit matrix.
+
+    To apply H**H (the conjugate transpose of H), supply conjg(tau)
+    instead tau.
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dlarf_gpu(
+    magma_int_t m,  magma_int_t n,
+    magmaDouble_const_ptr dv,
+    magmaDouble_const_ptr dtau,
+    magmaDouble_ptr dC,  magma_int_t lddc,
+    magma_queue_t queue )
+{
+    if ( n > 0 && m > 0 ) {
+        magma_host_enqueue_func( queue, [=]() {
+            if ( MAGMA_D_EQUAL( *dtau, MAGMA_D_ZERO ) ) {
+                return;
+            }
+            for (magma_int_t b = 0; b < n; ++b) {
+                double *dc = dC + b*lddc;
+
+                /* w := v**H * C, with v[0] = 1 */
+                double sum = dc[0];
+                for (magma_int_t j = 1; j < m; ++j) {
+                    sum += MAGMA_D_CONJ( dv[j] ) * dc[j];
+                }
+
+                /* C := C - v * w */
+                double tmp = -MAGMA_D_CONJ( *dtau ) * sum;
+                dc[0] += tmp;
+                for (magma_int_t j = 1; j < m; ++j) {
+                    dc[j] += tmp * dv[j];
+                }
+            }
+        });
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/***************************************************************************//**
+    Apply a real elementary reflector H to a real M-by-N
+    matrix C from the left, as magma_dlarf_gpu, and compute the iter-th
+    column of the triangular factor T of the block reflector.
+    v[0] is set to 1.
+*******************************************************************************/
+extern "C" void
+magma_dlarfx_gpu(
+    magma_int_t m, magma_int_t n,
+    magmaDouble_ptr v,
+    magmaDouble_ptr tau,
+    magmaDouble_ptr C, magma_int_t ldc,
+    magmaDouble_ptr        xnorm,
+    magmaDouble_ptr dT, magma_int_t iter,
+    magmaDouble_ptr work,
+    magma_queue_t queue )
+{
+    magma_int_t N = n + iter + 1;
+    double *T = (iter == 0 ? dT+iter*N : work);
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t b = 0; b < N; ++b) {
+            if ( ! MAGMA_D_EQUAL( *tau, MAGMA_D_ZERO ) ) {
+                double *dc = C + b*ldc;
+
+                /* if b < iter, V(i:n,i)**H * V(i:n,1:i-1) for computing T;
+                 * if b > iter, w := v**H * C */
+                double sum = MAGMA_D_ZERO;
+                if ( m > 0 ) {
+                    sum = dc[0];
+                    v[0] = MAGMA_D_ONE;
+                }
+                for (magma_int_t j = 1; j < m; ++j) {
+                    sum += MAGMA_D_CONJ( v[j] ) * dc[j];
+                }
+
+                /*  C := C - v * w  */
+                double z__1 = -MAGMA_D_CONJ( *tau ) * sum;
+                if (b > iter) {
+                    for (magma_int_t j = 0; j < m; ++j) {
+                        dc[j] += z__1 * v[j];
+                    }
+                }
+                else if (b == iter) {
+                    T[iter] = *tau;
+                }
+                else {
+                    T[b] = MAGMA_D_CONJ( z__1 );
+                }
+            }
+            else if (b <= iter) {
+                // in case tau is zero put the corresponding column of T to zero
+                T[b] = MAGMA_D_ZERO;
+            }
+        }
+    });
+
+    if (iter > 0) {
+        magma_dtrmv_kernel2( iter, dT, N, work, dT+iter*N, tau, queue );
+    }
+}
+
+
+/***************************************************************************//**
+    Apply a real block reflector H to a real vector C from the left
+    (i.e., C = H C). H is represented in the form
+          H = I - V T V**H
+    where T is the real k-by-k upper triangular matrix in the
+    representation of the block reflector, and V is a real block of
+    k elementary reflectors.
+*******************************************************************************/
+extern "C" void
+magma_dlarfbx_gpu(
+    magma_int_t m, magma_int_t k,
+    magmaDouble_ptr V,  magma_int_t ldv,
+    magmaDouble_ptr dT, magma_int_t ldt,
+    magmaDouble_ptr c,
+    magmaDouble_ptr dwork,
+    magma_queue_t queue )
+{
+    /* dwork = V**H c     */
+    magma_dgemv_kernel1( k, m, V, ldv, c, dwork, queue );
+
+    /* dwork = T**H dwork */
+    magma_dtrmv_tkernel( k, dT, ldt, dwork, dwork+k, queue );
+
+    /* c = c - V dwork    */
+    magma_dgemv_kernel2( m, k, V, ldv, dwork+k, c, queue );
+}
+
+
+/***************************************************************************//**
+    DGEQR2 computes a QR factorization of a real m by n matrix A:
+    A = Q * R, returning the triangular n x n factor T of the block
+    reflector in dT and the diagonal n x n blocks of R in ddA.
+    This version adds internal blocking.
+
+    @ingroup magma_geqr2
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dgeqr2x4_gpu(
+    magma_int_t m, magma_int_t n,
+    magmaDouble_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr dtau,
+    magmaDouble_ptr dT,
+    magmaDouble_ptr ddA,
+    magmaDouble_ptr dwork,
+    magma_queue_t queue,
+    magma_int_t *info)
+{
+    #define dA(i_,j_) (dA + (j_)*(ldda) + (i_))
+    #define dT(i_,j_) (dT + (j_)*(k)    + (i_))
+    #define BS 32
+
+    magma_int_t i, k;
+
+    magmaDouble_ptr dnorm = (magmaDouble_ptr)dwork;
+    magmaDouble_ptr dwork2 = (magmaDouble_ptr)(dwork + 2*n);
+
+    *info = 0;
+    if (m < 0) {
+        *info = -1;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (ldda < max(1,m)) {
+        *info = -4;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Compute the norms of the trailing columns */
+    k = min(m,n);
+    magmablas_dnrm2_cols( m, k, dA(0,0), ldda, dnorm, queue );
+
+    for (magma_int_t b=0; b < k; b += BS) {
+        for (i = b; i < min(k, b+BS); ++i) {
+            /*   Apply H**H to A(:,i) from the left */
+            if (i-b > 0) {
+                /* Compute the (i-1)th column of T */
+                if ( i-1 > 0 ) {
+                    magma_dgemv_kernel3( i-1, m-i+1, dA(i-1,0), ldda,
+                                         dA(i-1, i-1), dwork2, dtau+i-1, queue );
+                    magma_dtrmv_kernel2( i-1, dT(0,0), k, dwork2,
+                                         dT(0,i-1), dtau+i-1, queue );
+                }
+
+                /* dwork = V**H c */
+                magma_dgemv_kernel1( i-b, m-b, dA(b, b), ldda, dA(b,i),
+                                     dwork2, queue );
+
+                /* dwork = T**H dwork2 */
+                magma_dtrmv_tkernel( i-b, dT(b,b), k, dwork2, dwork2+i-b, queue );
+
+                /* c = c - V dwork2 */
+                if ( m-b > 0 ) {
+                    magma_dgemv_kernel2( m-b, i-b, dA(b,b), ldda,
+                                         dwork2+i-b, dA(b, i), queue );
+                }
+            }
+
+            /*   Adjust the dnorm[i] to hold the norm of A(i:m,i) */
+            if ( i > 0 ) {
+                magmablas_dnrm2_adjust( i, dnorm+i, dA(0, i), queue );
+            }
+
+            /*  Generate elementary reflector H(i) to annihilate A(i+1:m,i)
+                1. 1 is not yet put on the diagonal of A
+                2. Elements above the diagonal are copied in ddA and
+                   the ones in A are set to zero
+                3. update T */
+            magma_dlarfgx_gpu( m-i, dA(i, i), dA(min(i+1,m),i), dtau+i,
+                               dnorm+i, ddA + i + i*n, i, queue );
+
+            if (i == 0) {
+                magma_dlarfg_first_t( dtau, dT(0,0), dA(i, i), queue );
+            }
+        }
+        if ( i-1 > 0 ) {
+            magma_dgemv_kernel3( i-1, m-i+1, dA(i-1,0), ldda,
+                                 dA(i-1, i-1), dwork2, dtau+i-1, queue );
+            magma_dtrmv_kernel2( i-1, dT(0,0), k, dwork2,
+                                 dT(0,i-1), dtau+i-1, queue );
+        }
+
+        /* Apply the transformations to the trailing matrix. */
+        magma_dlarfb2_gpu(
+                           m-b, k-i, BS,
+                           dA(b, b), ldda, dT+b+b*k, k,
+                           dA(b, i), ldda, dwork2, k-i, queue );
+    }
+
+    return *info;
+
+    #undef dA
+    #undef dT
+    #undef BS
+} /* magma_dgeqr2 */
+
+#endif // HAVE_HOST
@@ -0,0 +1,72 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from magmablas_host/zhetrs.cpp, normal z -> d, Sat Oct 17 01:12:25 2026
+*/
+#include "host_stream.hpp"
+
+#define REAL
+
+#define PRECISION_d
+
+#ifdef HAVE_HOST
+
+// Host version of dsytrs_gpu. The factorization computed by dsytrf_gpu
+// uses the same ipiv convention as LAPACK, so the solve is done by LAPACK
+// once the queue is done with dA and dB.
+// See the CUDA version for the full argument descriptions.
+
+
+/***************************************************************************//**
+    DSYTRS solves a system of linear equations dA*dX = dB with a real
+    symmetric matrix dA using the factorization dA = dU*dD*dU**H or
+    dA = dL*dD*dL**H computed by DSYTRF_GPU.
+    ipiv is in host memory.
+
+    @ingroup magma_hetrs
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dsytrs_gpu(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    double *dA, magma_int_t ldda,
+    magma_int_t *ipiv,
+    double *dB, magma_int_t lddb,
+    magma_int_t *info,
+    magma_queue_t queue )
+{
+    /* Test the input parameters. */
+    *info = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        *info = -1;
+    } else if ( n < 0 ) {
+        *info = -2;
+    } else if ( nrhs < 0 ) {
+        *info = -3;
+    } else if ( ldda < max( 1, n ) ) {
+        *info = -5;
+    } else if ( lddb < max( 1, n ) ) {
+        *info = -8;
+    }
+
+    if ( *info != 0 ) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return if possible */
+    if (n == 0 || nrhs == 0) {
+        return *info;
+    }
+
+    magma_queue_sync( queue );
+    lapackf77_dsytrs( lapack_uplo_const( uplo ), &n, &nrhs,
+                      dA, &ldda, ipiv, dB, &lddb, info );
+
+    return *info;
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,30 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+*/
+#include "host_stream.hpp"
+
+#ifdef HAVE_HOST
+
+// =============================================================================
+// Auxiliary routine to adjust ipiv
+
+/******************************************************************************/
+// Host version: adds offset to ipiv[0:m], in device memory, on the queue.
+extern "C" void
+adjust_ipiv( magma_int_t *ipiv,
+                 magma_int_t m, magma_int_t offset,
+                 magma_queue_t queue)
+{
+    if (offset == 0 ) return;
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t i = 0; i < m; ++i) {
+            ipiv[i] += offset;
+        }
+    });
+}
+
+#endif // HAVE_HOST
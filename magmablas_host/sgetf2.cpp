@@ -0,0 +1,99 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from magmablas_host/zgetf2.cpp, normal z -> s, Sat Oct 17 01:12:25 2026
+*/
+#include "host_stream.hpp"
+
+#define REAL
+
+#define PRECISION_s
+
+#ifdef HAVE_HOST
+
+// Host versions of the LU panel kernels, including the native panel of
+// sgetrf_gpu. On the host, each panel is factored by LAPACK on the worker
+// thread of the queue.
+// See the CUDA versions for the full argument descriptions.
+
+
+/***************************************************************************//**
+    SGETF2 computes an LU factorization of a general m-by-n matrix A
+    using partial pivoting with row interchanges.
+    ipiv is in host memory and uses one-based indices.
+    Unlike the CUDA version, info > 0 reports an exactly zero U(info,info).
+
+    @ingroup magma_getf2
+*******************************************************************************/
+extern "C" magma_int_t
+magma_sgetf2_gpu(
+    magma_int_t m, magma_int_t n,
+    magmaFloat_ptr dA, magma_int_t ldda,
+    magma_int_t *ipiv,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if (m < 0) {
+        *info = -1;
+    } else if (n < 0 || n > 512) {
+        *info = -2;
+    } else if (ldda < max(1,m)) {
+        *info = -4;
+    }
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    // Quick return if possible
+    if (m == 0 || n == 0) {
+        return *info;
+    }
+
+    magma_queue_sync( queue );
+    lapackf77_sgetrf( &m, &n, dA, &ldda, ipiv, info );
+
+    return *info;
+}
+
+
+/***************************************************************************//**
+    Native LU panel factorization, used by sgetrf_gpu in MagmaNative mode.
+    dipiv is in device memory and gets one-based indices relative to the
+    panel; the caller adjusts them with adjust_ipiv. The error is reported
+    in dinfo, in device memory, as gbstep + k. dipivinfo and update_queue
+    are not referenced.
+
+    @ingroup magma_getrf_panel
+*******************************************************************************/
+extern "C" magma_int_t
+magma_sgetrf_recpanel_native(
+    magma_int_t m, magma_int_t n,
+    magmaFloat_ptr dA, magma_int_t ldda,
+    magma_int_t* dipiv, magma_int_t* dipivinfo,
+    magma_int_t *dinfo, magma_int_t gbstep,
+    magma_queue_t queue, magma_queue_t update_queue )
+{
+    // Quick return if possible
+    if (m == 0 || n == 0) {
+        return 0;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t iinfo;
+        lapackf77_sgetrf( &m, &n, dA, &ldda, dipiv, &iinfo );
+        if (iinfo > 0 && *dinfo == 0) {
+            *dinfo = gbstep + iinfo;
+        }
+    });
+
+    return 0;
+}
+
+#endif // HAVE_HOST
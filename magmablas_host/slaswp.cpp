@@ -0,0 +1,383 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from magmablas_host/zlaswp.cpp, normal z -> s, Sat Oct 17 01:12:27 2026
+*/
+#include <vector>
+
+#include "host_stream.hpp"
+
+#define REAL
+
+#define PRECISION_s
+
+#ifdef HAVE_HOST
+
+// Host versions of the magmablas row interchange and swap kernels.
+// Pivots passed in host memory are read when the routine is called, as the
+// CUDA versions copy them into the kernel arguments, so each routine copies
+// them into the lambda it enqueues. Pivots passed in device memory are read
+// when the task executes.
+// See the CUDA versions for the full argument descriptions.
+
+
+/***************************************************************************//**
+    Performs the row interchanges k1 through k2 given by ipiv on the matrix
+    dAT, which is stored row-wise. ipiv is in host memory.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_slaswp(
+    magma_int_t n,
+    magmaFloat_ptr dAT, magma_int_t ldda,
+    magma_int_t k1, magma_int_t k2,
+    const magma_int_t *ipiv, magma_int_t inci,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( n > ldda )
+        info = -3;
+    else if ( k1 < 1 )
+        info = -4;
+    else if ( k2 < 1 )
+        info = -5;
+    else if ( inci <= 0 )
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( k2 < k1 )
+        return;
+
+    std::vector< magma_int_t > piv( k2 - k1 + 1 );
+    for (magma_int_t k = k1-1; k < k2; ++k) {
+        piv[ k - (k1-1) ] = ipiv[k*inci] - 1;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t ione = 1;
+        for (magma_int_t k = k1-1; k < k2; ++k) {
+            magma_int_t kp = piv[ k - (k1-1) ];
+            if ( kp != k ) {
+                blasf77_sswap( &n, dAT + k*ldda, &ione, dAT + kp*ldda, &ione );
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Performs the row interchanges k1 through k2 given by ipiv on the matrix
+    dA, whose element (i,j) is at dA + i*ldx + j*ldy, so it may be stored
+    row-wise or column-wise. ipiv is in host memory.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_slaswpx(
+    magma_int_t n,
+    magmaFloat_ptr dA, magma_int_t ldx, magma_int_t ldy,
+    magma_int_t k1, magma_int_t k2,
+    const magma_int_t *ipiv, magma_int_t inci,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( k1 < 0 )
+        info = -4;
+    else if ( k2 < 0 || k2 < k1 )
+        info = -5;
+    else if ( inci <= 0 )
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( k2 < max( k1, 1 ) )
+        return;
+
+    std::vector< magma_int_t > piv( k2 - k1 + 1 );
+    for (magma_int_t k = k1-1; k < k2; ++k) {
+        piv[ k - (k1-1) ] = ipiv[k*inci] - 1;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t k = k1-1; k < k2; ++k) {
+            magma_int_t kp = piv[ k - (k1-1) ];
+            if ( kp != k ) {
+                blasf77_sswap( &n, dA + k*ldx, &ldy, dA + kp*ldx, &ldy );
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Performs the row interchanges k1 through k2 given by d_ipiv on the matrix
+    dAT, which is stored row-wise, like magmablas_slaswp.
+    d_ipiv is in device memory.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_slaswp2(
+    magma_int_t n,
+    magmaFloat_ptr dAT, magma_int_t ldda,
+    magma_int_t k1, magma_int_t k2,
+    magmaInt_const_ptr d_ipiv, magma_int_t inci,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( k1 < 0 )
+        info = -4;
+    else if ( k2 < 0 || k2 < k1 )
+        info = -5;
+    else if ( inci <= 0 )
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    // as in the CUDA version, d_ipiv[0] is the pivot of row k1
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t ione = 1;
+        float *dA0 = dAT + (k1-1)*ldda;
+        for (magma_int_t i1 = 0; i1 < k2-(k1-1); ++i1) {
+            magma_int_t i2 = d_ipiv[i1*inci] - 1;  // Fortran index
+            if ( i2 != i1 ) {
+                blasf77_sswap( &n, dA0 + i1*ldda, &ione, dA0 + i2*ldda, &ione );
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Performs the symmetric interchanges k1 through k2 of rows and columns
+    given by ipiv on the symmetric matrix dA, whose lower triangle is stored.
+    ipiv is in host memory.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_slaswp_sym(
+    magma_int_t n, float *dA, magma_int_t lda,
+    magma_int_t k1, magma_int_t k2,
+    const magma_int_t *ipiv, magma_int_t inci,
+    magma_queue_t queue )
+{
+    #define dA(i_, j_) (dA + (i_) + (j_)*lda)
+
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( k1 < 0 )
+        info = -4;
+    else if ( k2 < 0 || k2 < k1 )
+        info = -5;
+    else if ( inci <= 0 )
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( k2 < max( k1, 1 ) )
+        return;
+
+    std::vector< magma_int_t > piv( k2 - k1 + 1 );
+    for (magma_int_t k = k1-1; k < k2; ++k) {
+        piv[ k - (k1-1) ] = ipiv[k*inci] - 1;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t ii = k1-1; ii < k2; ++ii) {
+            magma_int_t i1 = min( ii, piv[ ii - (k1-1) ] );
+            magma_int_t i2 = max( ii, piv[ ii - (k1-1) ] );
+            if ( i1 == i2 )
+                continue;
+            for (magma_int_t t = 0; t < n; ++t) {
+                float *A1 = NULL, *A2 = NULL;
+                if (t < i1) {
+                    // row swap: (i1,t) <-> (i2,t)
+                    A1 = dA(i1,t);
+                    A2 = dA(i2,t);
+                } else if (t == i1) {
+                    // diagonal swap: (i1,i1) <-> (i2,i2)
+                    A1 = dA(i1,i1);
+                    A2 = dA(i2,i2);
+                } else if (t < i2) {
+                    // row-col swap: (t,i1) <-> (i2,t)
+                    A1 = dA(t,i1);
+                    A2 = dA(i2,t);
+                } else if (t > i2) {
+                    // column swap: (t,i1) <-> (t,i2)
+                    A1 = dA(t,i1);
+                    A2 = dA(t,i2);
+                }
+                if ( A1 != NULL && A2 != NULL ) {
+                    float temp = *A1;
+                    *A1 = *A2;
+                    *A2 = temp;
+                }
+            }
+        }
+    });
+
+    #undef dA
+}
+
+
+/***************************************************************************//**
+    Performs the row interchanges k1 through k2 given by dipiv on the matrix
+    dA, which is stored row-wise. If k1 > k2, the interchanges are applied
+    in reverse order. dipiv is in device memory.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magma_slaswp_columnserial(
+    magma_int_t n, magmaFloat_ptr dA, magma_int_t lda,
+    magma_int_t k1, magma_int_t k2,
+    magma_int_t *dipiv, magma_queue_t queue )
+{
+    if ( n == 0 )
+        return;
+
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t ione = 1;
+        magma_int_t inc  = (k1 <= k2 ? 1 : -1);
+        for (magma_int_t i1 = k1-1; i1 != k2-1 + inc; i1 += inc) {
+            magma_int_t i2 = dipiv[i1] - 1;  // Fortran index
+            if ( i2 != i1 ) {
+                blasf77_sswap( &n, dA + i1*lda, &ione, dA + i2*lda, &ione );
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Swaps two vectors, \f$ dx \leftrightarrow dy \f$.
+
+    @ingroup magma_swap
+*******************************************************************************/
+extern "C" void
+magmablas_sswap(
+    magma_int_t n,
+    magmaFloat_ptr dx, magma_int_t incx,
+    magmaFloat_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_sswap( n, dx, incx, dy, incy, queue );
+}
+
+
+/***************************************************************************//**
+    Blocked version: swaps rows (ColMajor) or columns (RowMajor) i1 through
+    i2 of dA with the rows or columns ipiv - offset of dB.
+    Used in magma_ststrf() and magma_sssssm().
+
+    @ingroup magma_swapblk
+*******************************************************************************/
+extern "C" void
+magmablas_sswapblk(
+    magma_order_t order, magma_int_t n,
+    magmaFloat_ptr dA, magma_int_t ldda,
+    magmaFloat_ptr dB, magma_int_t lddb,
+    magma_int_t i1, magma_int_t i2,
+    const magma_int_t *ipiv, magma_int_t inci, magma_int_t offset,
+    magma_queue_t queue )
+{
+    /* Quick return */
+    if ( n == 0 || i2 < i1 )
+        return;
+
+    std::vector< magma_int_t > piv( i2 - i1 + 1 );
+    for (magma_int_t k = i1-1; k < i2; ++k) {
+        piv[ k - (i1-1) ] = ipiv[k*inci] - 1;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t ione = 1;
+        for (magma_int_t k = i1-1; k < i2; ++k) {
+            magma_int_t im = piv[ k - (i1-1) ];
+            if ( im == k )
+                continue;
+            if ( order == MagmaColMajor )
+                blasf77_sswap( &n, dA + k, &ldda, dB + (im - offset), &lddb );
+            else
+                blasf77_sswap( &n, dA + k*ldda, &ione, dB + (im - offset)*lddb, &ione );
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Swaps nblocks = n/nb diagonal blocks of size nb x nb between dA and dB.
+    Block i is at dA( i*nb*inca, i*nb ) and dB( i*nb*incb, i*nb ).
+
+    @ingroup magma_swapdblk
+*******************************************************************************/
+extern "C" void
+magmablas_sswapdblk(
+    magma_int_t n, magma_int_t nb,
+    magmaFloat_ptr dA, magma_int_t ldda, magma_int_t inca,
+    magmaFloat_ptr dB, magma_int_t lddb, magma_int_t incb,
+    magma_queue_t queue )
+{
+    magma_int_t nblocks = n / nb;
+
+    magma_int_t info = 0;
+    if (n < 0) {
+        info = -1;
+    } else if (nb < 1 || nb > 1024) {
+        info = -2;
+    } else if (ldda < (nblocks-1)*nb*inca + nb) {
+        info = -4;
+    } else if (inca < 0) {
+        info = -5;
+    } else if (lddb < (nblocks-1)*nb*incb + nb) {
+        info = -7;
+    } else if (incb < 0) {
+        info = -8;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( nblocks > 0 ) {
+        magma_host_enqueue_func( queue, [=]() {
+            magma_int_t ione = 1;
+            for (magma_int_t b = 0; b < nblocks; ++b) {
+                float *A = dA + b*nb*(ldda + inca);
+                float *B = dB + b*nb*(lddb + incb);
+                for (magma_int_t j = 0; j < nb; ++j) {
+                    blasf77_sswap( &nb, A + j*ldda, &ione, B + j*lddb, &ione );
+                }
+            }
+        });
+    }
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,1014 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @precisions normal z -> s d c
+*/
+#include "host_stream.hpp"
+
+#define COMPLEX
+
+#define PRECISION_z
+
+#ifdef HAVE_HOST
+
+// Host versions of the magmablas BLAS-like kernels. Routines with a BLAS
+// equivalent check their arguments like the CUDA version in magmablas/,
+// then call the magma_z BLAS wrapper of the host backend, which pushes the
+// host BLAS call to the worker thread of the queue. Workspaces used only by
+// the CUDA kernels (dwork, d_dinvA) are not referenced.
+// See the CUDA versions for the full argument descriptions.
+
+#define dA(i_, j_) (dA + (i_) + (j_)*ldda)
+
+// block size of the inverted diagonal blocks in magmablas_ztrtri_diag,
+// as NB in magmablas/ztrtri.cuh
+#define TRI_NB 128
+
+
+// =============================================================================
+// Level 2 BLAS
+
+/***************************************************************************//**
+    Performs the matrix-vector product \f$ y = \alpha op(A) x + \beta y \f$.
+
+    @ingroup magma_gemv
+*******************************************************************************/
+extern "C" void
+magmablas_zgemv(
+    magma_trans_t trans, magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( trans != MagmaNoTrans && trans != MagmaTrans && trans != MagmaConjTrans )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < m )
+        info = -6;
+    else if ( incx == 0 )
+        info = -8;
+    else if ( incy == 0 )
+        info = -11;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    magma_zgemv( trans, m, n, alpha, dA, ldda, dx, incx, beta, dy, incy, queue );
+}
+
+
+/***************************************************************************//**
+    Performs the matrix-vector product \f$ y = \alpha A conj(x) + \beta y \f$.
+
+    @ingroup magma_gemv
+*******************************************************************************/
+extern "C" void
+magmablas_zgemv_conj(
+    magma_int_t m, magma_int_t n, magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( m < 0 )
+        info = -1;
+    else if ( n < 0 )
+        info = -2;
+    else if ( ldda < m )
+        info = -5;
+    else if ( incx == 0 )
+        info = -7;
+    else if ( incy == 0 )
+        info = -10;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t i = 0; i < m; ++i) {
+            magmaDoubleComplex res = MAGMA_Z_ZERO;
+            for (magma_int_t j = 0; j < n; ++j) {
+                res += (*dA(i,j)) * MAGMA_Z_CONJ( dx[j*incx] );
+            }
+            dy[i*incy] = alpha * res + beta * dy[i*incy];
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Performs the Hermitian matrix-vector product \f$ y = \alpha A x + \beta y \f$.
+
+    @ingroup magma_hemv
+*******************************************************************************/
+extern "C" magma_int_t
+magmablas_zhemv(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -1;
+    } else if ( n < 0 ) {
+        info = -2;
+    } else if ( ldda < max(1, n) ) {
+        info = -5;
+    } else if ( incx == 0 ) {
+        info = -7;
+    } else if ( incy == 0 ) {
+        info = -10;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    magma_zhemv( uplo, n, alpha, dA, ldda, dx, incx, beta, dy, incy, queue );
+    return info;
+}
+
+
+/***************************************************************************//**
+    Performs the Hermitian matrix-vector product \f$ y = \alpha A x + \beta y \f$.
+    dwork is not referenced, but lwork is checked as in the CUDA version.
+
+    @ingroup magma_hemv
+*******************************************************************************/
+extern "C" magma_int_t
+magmablas_zhemv_work(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dx, magma_int_t incx,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr dy, magma_int_t incy,
+    magmaDoubleComplex_ptr dwork, magma_int_t lwork,
+    magma_queue_t queue )
+{
+    // NB_X = 64 in the CUDA version
+    magma_int_t lwmin = ldda*magma_ceildiv( n, 64 );
+
+    magma_int_t info = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -1;
+    } else if ( n < 0 ) {
+        info = -2;
+    } else if ( ldda < max(1, n) ) {
+        info = -5;
+    } else if ( incx == 0 ) {
+        info = -7;
+    } else if ( incy == 0 ) {
+        info = -10;
+    } else if ( lwork < lwmin ) {
+        info = -12;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    magma_zhemv( uplo, n, alpha, dA, ldda, dx, incx, beta, dy, incy, queue );
+    return info;
+}
+
+
+/***************************************************************************//**
+    Computes the partial Hermitian matrix-vector products of a matrix
+    distributed 1D block-column cyclic over ngpu devices, as in the CUDA
+    version: the contribution of the columns of device dev is written to
+    hwork[dev*n : dev*n+n], scaled by alpha. x is in host memory.
+    beta and y are not referenced; see magmablas_zhemv_mgpu_sync.
+
+    @ingroup magma_hemv
+*******************************************************************************/
+extern "C" magma_int_t
+magmablas_zhemv_mgpu(
+    magma_uplo_t uplo,
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr const d_lA[], magma_int_t ldda,
+    magma_int_t offset,
+    magmaDoubleComplex const *x,       magma_int_t incx,
+    magmaDoubleComplex beta,                                         // unused, see magmablas_zhemv_mgpu_sync
+    magmaDoubleComplex       *y,       magma_int_t incy,             // unused
+    magmaDoubleComplex       *hwork,   magma_int_t lhwork,
+    magmaDoubleComplex_ptr    dwork[], magma_int_t ldwork,
+    magma_int_t ngpu,
+    magma_int_t nb,
+    magma_queue_t queues[] )
+{
+    bool upper = (uplo == MagmaUpper);
+
+    magma_int_t block_offset = offset % nb;
+    magma_int_t blocks = magma_ceildiv( n + block_offset, nb );
+    magma_int_t ldwmin = ldda*(blocks + 1);
+    magma_int_t lhwmin = n*ngpu;
+
+    magma_int_t info = 0;
+    if ( (! upper) && (uplo != MagmaLower) ) {
+        info = -1;
+    } else if ( n < 0 ) {
+        info = -2;
+    } else if ( ldda < max(1,n+offset) ) {
+        info = -5;
+    } else if ( offset < 0 ) {
+        info = -6;
+    } else if ( incx == 0 ) {
+        info = -8;
+    } else if ( incy == 0 ) {
+        info = -11;
+    } else if ( lhwork < lhwmin ) {
+        info = -13;
+    } else if ( ldwork < ldwmin ) {
+        info = -15;
+    } else if ( ngpu < 1 ) {
+        info = -16;
+    } else if ( nb != 64 ) {
+        info = -17;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    if ( n == 0 )
+        return info;
+
+    for (magma_int_t dev = 0; dev < ngpu; ++dev) {
+        magmaDoubleComplex_const_ptr dA = d_lA[dev];
+        magmaDoubleComplex *w = &hwork[dev*n];
+        magma_host_enqueue_func( queues[dev], [=]() {
+            for (magma_int_t k = 0; k < n; ++k) {
+                w[k] = MAGMA_Z_ZERO;
+            }
+            // global column J of the parent matrix is local column jj on its device
+            for (magma_int_t J = offset; J < offset + n; ++J) {
+                if ( (J / nb) % ngpu != dev )
+                    continue;
+                magma_int_t jj = (J / nb / ngpu)*nb + J % nb;
+                magma_int_t j  = J - offset;
+                magmaDoubleComplex xj = x[j*incx];
+                magmaDoubleComplex sum = MAGMA_Z_REAL( *dA(J,jj) ) * xj;
+                magma_int_t ibeg = (upper ? 0   : j+1);
+                magma_int_t iend = (upper ? j   : n  );
+                for (magma_int_t i = ibeg; i < iend; ++i) {
+                    magmaDoubleComplex aij = *dA(i + offset, jj);
+                    w[i] += aij * xj;
+                    sum  += MAGMA_Z_CONJ( aij ) * x[i*incx];
+                }
+                w[j] += sum;
+            }
+            for (magma_int_t k = 0; k < n; ++k) {
+                w[k] = alpha * w[k];
+            }
+        });
+    }
+
+    return info;
+}
+
+
+/***************************************************************************//**
+    Synchronizes and accumulates the final zhemv result,
+    \f$ y = \beta y + \sum_{dev} hwork[dev*n : dev*n+n] \f$.
+    For convenience, the parameters are identical to magmablas_zhemv_mgpu
+    (though some are unused here).
+
+    @see magmablas_zhemv_mgpu
+    @ingroup magma_hemv
+*******************************************************************************/
+extern "C" magma_int_t
+magmablas_zhemv_mgpu_sync(
+    magma_uplo_t uplo,                                               // unused, see magmablas_zhemv_mgpu
+    magma_int_t n,
+    magmaDoubleComplex alpha,                                        // unused
+    magmaDoubleComplex_const_ptr const d_lA[], magma_int_t ldda,
+    magma_int_t offset,                                              // unused
+    magmaDoubleComplex const *x,       magma_int_t incx,             // unused
+    magmaDoubleComplex beta,
+    magmaDoubleComplex       *y,       magma_int_t incy,             // unused
+    magmaDoubleComplex       *hwork,   magma_int_t lhwork,
+    magmaDoubleComplex_ptr    dwork[], magma_int_t ldwork,           // unused
+    magma_int_t ngpu,
+    magma_int_t nb,                                                  // unused
+    magma_queue_t queues[] )
+{
+    const magmaDoubleComplex c_one = MAGMA_Z_ONE;
+    const magma_int_t ione = 1;
+
+    magma_int_t lhwmin  = n*ngpu;
+
+    magma_int_t info = 0;
+    if ( n < 0 ) {
+        info = -2;
+    } else if ( ldda < max(1,n+offset) ) {
+        info = -5;
+    } else if ( offset < 0 ) {
+        info = -6;
+    } else if ( incx == 0 ) {
+        info = -8;
+    } else if ( incy == 0 ) {
+        info = -11;
+    } else if ( lhwork < lhwmin ) {
+        info = -13;
+    } else if ( ngpu < 1 ) {
+        info = -16;
+    } else if ( nb != 64 ) {
+        info = -17;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    if ( n == 0 )
+        return info;
+
+    // scale y = beta*y
+    blasf77_zscal( &n, &beta, y, &incy );
+
+    // sum reduce, y += sum( hwork )
+    for (magma_int_t dev = 0; dev < ngpu; ++dev) {
+        magma_queue_sync( queues[dev] );
+        blasf77_zaxpy( &n, &c_one, &hwork[dev*n], &ione, y, &ione );
+    }
+
+    return info;
+}
+
+
+/***************************************************************************//**
+    Solves the triangular system \f$ op(A) x = b \f$, writing the solution
+    to the contiguous vector dx; db is not modified.
+    flag is not referenced.
+
+    @ingroup magma_trsv
+*******************************************************************************/
+extern "C" void
+magmablas_ztrsv_outofplace(
+    magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr A, magma_int_t lda,
+    magmaDoubleComplex_ptr       b, magma_int_t incb,
+    magmaDoubleComplex_ptr       x,
+    magma_queue_t queue,
+    magma_int_t flag )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -1;
+    } else if ( trans != MagmaNoTrans && trans != MagmaTrans && trans != MagmaConjTrans ) {
+        info = -2;
+    } else if ( diag != MagmaUnit && diag != MagmaNonUnit ) {
+        info = -3;
+    } else if (n < 0) {
+        info = -5;
+    } else if (lda < max(1,n)) {
+        info = -8;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if (n == 0)
+        return;
+
+    magma_zcopy( n, b, incb, x, 1, queue );
+    magma_ztrsv( uplo, trans, diag, n, A, lda, x, 1, queue );
+}
+
+
+/***************************************************************************//**
+    Solves the triangular system \f$ op(A) x = b \f$, overwriting db with x.
+
+    @ingroup magma_trsv
+*******************************************************************************/
+extern "C" void
+magmablas_ztrsv(
+    magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+    magma_int_t n,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr db, magma_int_t incb,
+    magma_queue_t queue )
+{
+    magma_ztrsv( uplo, trans, diag, n, dA, ldda, db, incb, queue );
+}
+
+
+/***************************************************************************//**
+    Performs the triangular matrix-vector product \f$ x = op(A) x \f$.
+
+    @ingroup magma_trmv
+*******************************************************************************/
+extern "C" void
+magmablas_ztrmv(
+    magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t n,
+    magmaDoubleComplex *dA, magma_int_t ldda,
+    magmaDoubleComplex *dX, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -1;
+    } else if ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans ) {
+        info = -2;
+    } else if ( diag != MagmaUnit && diag != MagmaNonUnit ) {
+        info = -3;
+    } else if (n < 0) {
+        info = -4;
+    } else if (ldda < max(1,n)) {
+        info = -6;
+    } else if (incx < 0) {    // no support yet for a negative incx
+        info = -8;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if ( n <= 0 )
+        return;
+
+    magma_ztrmv( uplo, transA, diag, n, dA, ldda, dX, incx, queue );
+}
+
+
+// =============================================================================
+// Level 3 BLAS
+
+/***************************************************************************//**
+    Performs the matrix-matrix product
+    \f$ C = \alpha op(A) op(B) + \beta C \f$.
+
+    @ingroup magma_gemm
+*******************************************************************************/
+extern "C" void
+magmablas_zgemm(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dB, magma_int_t lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if      ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans )
+        info = -1;
+    else if ( transB != MagmaNoTrans && transB != MagmaTrans && transB != MagmaConjTrans )
+        info = -2;
+    else if ( m < 0 )
+        info = -3;
+    else if ( n < 0 )
+        info = -4;
+    else if ( k < 0 )
+        info = -5;
+    else if ( transA == MagmaNoTrans ? ldda < m : ldda < k )
+        info = -8;
+    else if ( transB == MagmaNoTrans ? lddb < k : lddb < n )
+        info = -10;
+    else if ( lddc < m )
+        info = -13;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    magma_zgemm( transA, transB, m, n, k,
+                 alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+}
+
+
+/***************************************************************************//**
+    Performs the matrix-matrix product \f$ C = \alpha A^H B + \beta C \f$,
+    where A is k x m, B is k x n, and C is m x n.
+    The CUDA version is tuned for m, n << k.
+
+    @ingroup magma_gemm
+*******************************************************************************/
+extern "C" void
+magmablas_zgemm_reduce(
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dB, magma_int_t lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( m < 0 )
+        info = -1;
+    else if ( n < 0 )
+        info = -2;
+    else if ( k < 0 )
+        info = -3;
+    else if ( ldda < m )
+        info = -6;
+    else if ( lddb < k )
+        info = -8;
+    else if ( lddc < m )
+        info = -11;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    magma_zgemm( MagmaConjTrans, MagmaNoTrans, m, n, k,
+                 alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+}
+
+
+/***************************************************************************//**
+    Performs the symmetric matrix-matrix product
+    \f$ C = \alpha A B + \beta C \f$ (side == MagmaLeft), or
+    \f$ C = \alpha B A + \beta C \f$ (side == MagmaRight).
+
+    @ingroup magma_symm
+*******************************************************************************/
+extern "C" void
+magmablas_zsymm(
+    magma_side_t side, magma_uplo_t uplo,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_const_ptr dB, magma_int_t lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_int_t nrowa = (side == MagmaLeft ? m : n);
+
+    magma_int_t info = 0;
+    if ( side != MagmaLeft && side != MagmaRight ) {
+        info = -1;
+    } else if (uplo != MagmaLower && uplo != MagmaUpper ) {
+        info = -2;
+    } else if ( m < 0 ) {
+        info = -3;
+    } else if ( n < 0 ) {
+        info = -4;
+    } else if ( ldda < max(1,nrowa) ) {
+        info = -7;
+    } else if ( lddb < max(1,m) ) {
+        info = -9;
+    } else if (lddc < max(1,m)) {
+        info = -12;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    magma_zsymm( side, uplo, m, n,
+                 alpha, dA, ldda, dB, lddb, beta, dC, lddc, queue );
+}
+
+
+/***************************************************************************//**
+    Performs the triangular matrix-matrix product
+    \f$ B = \alpha op(A) B \f$ (side == MagmaLeft), or
+    \f$ B = \alpha B op(A) \f$ (side == MagmaRight).
+
+    @ingroup magma_trmm
+*******************************************************************************/
+extern "C" void
+magmablas_ztrmm(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex *dA, magma_int_t ldda,
+    magmaDoubleComplex *dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_int_t nrowA = (side == MagmaLeft ? m : n);
+
+    magma_int_t info = 0;
+    if ( side != MagmaLeft && side != MagmaRight ) {
+        info = -1;
+    } else if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -2;
+    } else if ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans ) {
+        info = -3;
+    } else if ( diag != MagmaUnit && diag != MagmaNonUnit ) {
+        info = -4;
+    } else if (m < 0) {
+        info = -5;
+    } else if (n < 0) {
+        info = -6;
+    } else if (ldda < max(1,nrowA)) {
+        info = -9;
+    } else if (lddb < max(1,m)) {
+        info = -11;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if ( m <= 0 || n <= 0 )
+        return;
+
+    magma_ztrmm( side, uplo, transA, diag, m, n, alpha, dA, ldda, dB, lddb, queue );
+}
+
+
+/***************************************************************************//**
+    Solves the triangular system
+    \f$ op(A) X = \alpha B \f$ (side == MagmaLeft), or
+    \f$ X op(A) = \alpha B \f$ (side == MagmaRight),
+    writing the solution to dX; dB is not modified.
+    flag, d_dinvA, and dinvA_length are checked as in the CUDA version,
+    but d_dinvA is not referenced.
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magmablas_ztrsm_outofplace(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magmaDoubleComplex_ptr       dX, magma_int_t lddx,
+    magma_int_t flag,
+    magmaDoubleComplex_ptr d_dinvA, magma_int_t dinvA_length,
+    magma_queue_t queue )
+{
+    magma_int_t nrowA = (side == MagmaLeft ? m : n);
+
+    magma_int_t min_dinvA_length;
+    if ( side == MagmaLeft ) {
+        min_dinvA_length = magma_roundup( m, TRI_NB )*TRI_NB;
+    }
+    else {
+        min_dinvA_length = magma_roundup( n, TRI_NB )*TRI_NB;
+    }
+
+    magma_int_t info = 0;
+    if ( side != MagmaLeft && side != MagmaRight ) {
+        info = -1;
+    } else if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -2;
+    } else if ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans ) {
+        info = -3;
+    } else if ( diag != MagmaUnit && diag != MagmaNonUnit ) {
+        info = -4;
+    } else if (m < 0) {
+        info = -5;
+    } else if (n < 0) {
+        info = -6;
+    } else if (dA == NULL) {
+        info = -8;
+    } else if (ldda < max(1,nrowA)) {
+        info = -9;
+    } else if (dB == NULL) {
+        info = -10;
+    } else if (lddb < max(1,m)) {
+        info = -11;
+    } else if (dX == NULL) {
+        info = -12;
+    } else if (lddx < max(1,m)) {
+        info = -13;
+    } else if (d_dinvA == NULL) {
+        info = -15;
+    } else if (dinvA_length < min_dinvA_length) {
+        info = -16;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    // quick return if possible.
+    if (m == 0 || n == 0)
+        return;
+
+    magmablas_zlacpy( MagmaFull, m, n, dB, lddb, dX, lddx, queue );
+    magma_ztrsm( side, uplo, transA, diag, m, n, alpha, dA, ldda, dX, lddx, queue );
+}
+
+
+/***************************************************************************//**
+    Similar to magmablas_ztrsm_outofplace(), but copies the solution dX
+    back to dB.
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magmablas_ztrsm_work(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magmaDoubleComplex_ptr       dX, magma_int_t lddx,
+    magma_int_t flag,
+    magmaDoubleComplex_ptr d_dinvA, magma_int_t dinvA_length,
+    magma_queue_t queue )
+{
+    magmablas_ztrsm_outofplace( side, uplo, transA, diag, m, n, alpha,
+                                dA, ldda, dB, lddb, dX, lddx, flag,
+                                d_dinvA, dinvA_length, queue );
+    // copy X to B
+    magmablas_zlacpy( MagmaFull, m, n, dX, lddx, dB, lddb, queue );
+}
+
+
+/***************************************************************************//**
+    Solves the triangular system
+    \f$ op(A) X = \alpha B \f$ (side == MagmaLeft), or
+    \f$ X op(A) = \alpha B \f$ (side == MagmaRight),
+    overwriting dB with X.
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magmablas_ztrsm(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_int_t nrowA = (side == MagmaLeft ? m : n);
+
+    magma_int_t info = 0;
+    if ( side != MagmaLeft && side != MagmaRight ) {
+        info = -1;
+    } else if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -2;
+    } else if ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans ) {
+        info = -3;
+    } else if ( diag != MagmaUnit && diag != MagmaNonUnit ) {
+        info = -4;
+    } else if (m < 0) {
+        info = -5;
+    } else if (n < 0) {
+        info = -6;
+    } else if (dA == NULL) {
+        info = -8;
+    } else if (ldda < max(1,nrowA)) {
+        info = -9;
+    } else if (dB == NULL) {
+        info = -10;
+    } else if (lddb < max(1,m)) {
+        info = -11;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if (m == 0 || n == 0)
+        return;
+
+    magma_ztrsm( side, uplo, transA, diag, m, n, alpha, dA, ldda, dB, lddb, queue );
+}
+
+
+/***************************************************************************//**
+    Inverts the TRI_NB x TRI_NB diagonal blocks of the triangular matrix dA
+    into d_dinvA, which holds ceil(n/TRI_NB) blocks stored one after the
+    other, each with leading dimension TRI_NB. The unused part of each block
+    is zero; the last partial block is padded with an identity.
+
+    @ingroup magma_trtri
+*******************************************************************************/
+extern "C" void
+magmablas_ztrtri_diag(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr d_dinvA,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if (uplo != MagmaLower && uplo != MagmaUpper)
+        info = -1;
+    else if (diag != MagmaNonUnit && diag != MagmaUnit)
+        info = -2;
+    else if (n < 0)
+        info = -3;
+    else if (ldda < n)
+        info = -5;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        const magmaDoubleComplex c_zero = MAGMA_Z_ZERO;
+        const magmaDoubleComplex c_one  = MAGMA_Z_ONE;
+        magma_int_t nb = TRI_NB;
+        magma_int_t iinfo;
+        for (magma_int_t j = 0; j < n; j += TRI_NB) {
+            magma_int_t jb = min( TRI_NB, n-j );
+            magmaDoubleComplex *dinvA = d_dinvA + j*TRI_NB;
+            lapackf77_zlaset( "Full", &nb, &nb, &c_zero, &c_one, dinvA, &nb );
+            lapackf77_zlacpy( lapack_uplo_const( uplo ), &jb, &jb,
+                              dA(j,j), &ldda, dinvA, &nb );
+            lapackf77_ztrtri( lapack_uplo_const( uplo ), lapack_diag_const( diag ),
+                              &jb, dinvA, &nb, &iinfo );
+        }
+    });
+}
+
+
+// =============================================================================
+// Random butterfly transformation
+
+// Applies the butterfly u, v of size n to the n x n matrix dA:
+// A = U^T A V, where U and V are the butterflies built from u and v.
+static void
+zelementary_multiplication(
+    magma_int_t n,
+    magmaDoubleComplex *dA, magma_int_t ldda,
+    const magmaDoubleComplex *du,
+    const magmaDoubleComplex *dv )
+{
+    magma_int_t h = n/2;
+    for (magma_int_t j = 0; j < h; ++j) {
+        for (magma_int_t i = 0; i < h; ++i) {
+            magmaDoubleComplex a00 = *dA(i,   j  );
+            magmaDoubleComplex a01 = *dA(i,   j+h);
+            magmaDoubleComplex a10 = *dA(i+h, j  );
+            magmaDoubleComplex a11 = *dA(i+h, j+h);
+
+            magmaDoubleComplex b1 = a00 + a01;
+            magmaDoubleComplex b2 = a10 + a11;
+            magmaDoubleComplex b3 = a00 - a01;
+            magmaDoubleComplex b4 = a10 - a11;
+
+            *dA(i,   j  ) = du[i]   * dv[j]   * (b1 + b2);
+            *dA(i,   j+h) = du[i]   * dv[j+h] * (b3 + b4);
+            *dA(i+h, j  ) = du[i+h] * dv[j]   * (b1 - b2);
+            *dA(i+h, j+h) = du[i+h] * dv[j+h] * (b3 - b4);
+        }
+    }
+}
+
+
+// Applies the butterfly u of size n to the vector db.
+static void
+zapply_vector(
+    magma_int_t n, const magmaDoubleComplex *du, magmaDoubleComplex *db )
+{
+    magma_int_t h = n/2;
+    for (magma_int_t i = 0; i < h; ++i) {
+        magmaDoubleComplex a1 = du[i]   * db[i];
+        magmaDoubleComplex a2 = du[i+h] * db[i+h];
+        db[i]   = a1 + a2;
+        db[i+h] = a1 - a2;
+    }
+}
+
+
+// Applies the transpose of the butterfly u of size n to the vector db.
+static void
+zapply_transpose_vector(
+    magma_int_t n, const magmaDoubleComplex *du, magmaDoubleComplex *db )
+{
+    magma_int_t h = n/2;
+    for (magma_int_t i = 0; i < h; ++i) {
+        magmaDoubleComplex a1 = db[i] + db[i+h];
+        magmaDoubleComplex a2 = db[i] - db[i+h];
+        db[i]   = du[i]   * a1;
+        db[i+h] = du[i+h] * a2;
+    }
+}
+
+
+/***************************************************************************//**
+    Applies the random butterfly transformation of depth 2 stored in du and dv
+    to the n x n matrix dA, \f$ A = U^T A V \f$. du and dv hold the two levels
+    of the butterflies, with leading dimension ldda.
+
+    @ingroup magma_gesv_rbt
+*******************************************************************************/
+extern "C" void
+magmablas_zprbt(
+    magma_int_t n,
+    magmaDoubleComplex *dA, magma_int_t ldda,
+    magmaDoubleComplex *du, magmaDoubleComplex *dv,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t h = n/2;
+        magmaDoubleComplex *du1 = du + ldda;
+        magmaDoubleComplex *dv1 = dv + ldda;
+        zelementary_multiplication( h, dA(0,0), ldda, du1,     dv1     );
+        zelementary_multiplication( h, dA(0,h), ldda, du1,     dv1 + h );
+        zelementary_multiplication( h, dA(h,0), ldda, du1 + h, dv1     );
+        zelementary_multiplication( h, dA(h,h), ldda, du1 + h, dv1 + h );
+        zelementary_multiplication( n, dA, ldda, du, dv );
+    });
+}
+
+
+/***************************************************************************//**
+    Applies the random butterfly transformation of depth 2 stored in dv
+    to the vector db, \f$ b = V b \f$.
+
+    @ingroup magma_gesv_rbt
+*******************************************************************************/
+extern "C" void
+magmablas_zprbt_mv(
+    magma_int_t n,
+    magmaDoubleComplex *dv, magmaDoubleComplex *db,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t h = n/2;
+        zapply_vector( n, dv,         db     );
+        zapply_vector( h, dv + n,     db     );
+        zapply_vector( h, dv + n + h, db + h );
+    });
+}
+
+
+/***************************************************************************//**
+    Applies the transpose of the random butterfly transformation of depth 2
+    stored in du to the vector db, \f$ b = U^T b \f$.
+
+    @ingroup magma_gesv_rbt
+*******************************************************************************/
+extern "C" void
+magmablas_zprbt_mtv(
+    magma_int_t n,
+    magmaDoubleComplex *du, magmaDoubleComplex *db,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t h = n/2;
+        zapply_transpose_vector( h, du + n,     db     );
+        zapply_transpose_vector( h, du + n + h, db + h );
+        zapply_transpose_vector( n, du,         db     );
+    });
+}
+
+
+// =============================================================================
+// Iterative refinement
+
+/***************************************************************************//**
+    Adds the correction dr to the solution dx, and copies db to dr:
+    \f$ x = x + r \f$, \f$ r = b \f$.
+
+    @ingroup magma_axpy
+*******************************************************************************/
+extern "C" void
+magmablas_zaxpycp(
+    magma_int_t m,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dx,
+    magmaDoubleComplex_const_ptr db,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t i = 0; i < m; ++i) {
+            dx[i] = dx[i] + dr[i];
+            dr[i] = db[i];
+        }
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,663 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @precisions normal z -> s d c
+*/
+#include "host_stream.hpp"
+
+#define COMPLEX
+
+#define PRECISION_z
+
+#ifdef HAVE_HOST
+
+// Host versions of the magmablas copy, set, add, symmetrize, and transpose
+// kernels. Each routine checks its arguments like the CUDA version in
+// magmablas/, then pushes a lambda to the worker thread of the queue, which
+// loops over the host memory that stands for device memory.
+// See the CUDA versions for the full argument descriptions.
+
+#define dA(i_, j_) (dA + (i_) + (j_)*ldda)
+#define dB(i_, j_) (dB + (i_) + (j_)*lddb)
+
+
+/***************************************************************************//**
+    Copies all or part of a two-dimensional matrix dA to another matrix dB,
+    like LAPACK's zlacpy.
+
+    @ingroup magma_lacpy
+*******************************************************************************/
+extern "C" void
+magmablas_zlacpy(
+    magma_uplo_t uplo, magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper && uplo != MagmaFull )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < max(1,m))
+        info = -5;
+    else if ( lddb < max(1,m))
+        info = -7;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        lapackf77_zlacpy( lapack_uplo_const( uplo ), &m, &n,
+                          dA, &ldda, dB, &lddb );
+    });
+}
+
+
+/***************************************************************************//**
+    Copies the conjugate of vector dA1 to dA2, both of length n with strides
+    lda1 and lda2.
+
+    @ingroup magma_lacpy
+*******************************************************************************/
+extern "C" void
+magmablas_zlacpy_conj(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dA1, magma_int_t lda1,
+    magmaDoubleComplex_ptr dA2, magma_int_t lda2,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t i = 0; i < n; ++i) {
+            dA2[i*lda2] = MAGMA_Z_CONJ( dA1[i*lda1] );
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Copies the n columns rows[2*jj] of the Hermitian matrix dA, whose lower
+    triangle is stored, into dB, applying the row permutation given by the
+    pairs in rows, which it records in perm. For upper and full, it copies
+    dA to dB like magmablas_zlacpy.
+
+    @ingroup magma_lacpy
+*******************************************************************************/
+extern "C" void
+magmablas_zlacpy_sym_in(
+    magma_uplo_t uplo, magma_int_t m, magma_int_t n,
+    magma_int_t *rows, magma_int_t *perm,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper && uplo != MagmaFull )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < max(1,m))
+        info = -5;
+    else if ( lddb < max(1,m))
+        info = -7;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+
+    if ( uplo != MagmaLower ) {
+        magmablas_zlacpy( MagmaFull, m, n, dA, ldda, dB, lddb, queue );
+        return;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t jj = 0; jj < n; ++jj) {
+            perm[ rows[2*jj+1] ] = rows[2*jj];
+        }
+        for (magma_int_t jj = 0; jj < n; ++jj) {
+            magma_int_t j = rows[2*jj];
+            for (magma_int_t i = 0; i < m; ++i) {
+                if ( perm[i] <= j )
+                    *dB(i,jj) = MAGMA_Z_CONJ( *dA(j,perm[i]) );
+                else
+                    *dB(i,jj) = *dA(perm[i],j);
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Copies the n columns of dA back into the columns rows[2*jj+1] of the
+    Hermitian matrix dB, whose lower triangle is stored. This is the inverse
+    of magmablas_zlacpy_sym_in. For upper and full, it copies dA to dB like
+    magmablas_zlacpy.
+
+    @ingroup magma_lacpy
+*******************************************************************************/
+extern "C" void
+magmablas_zlacpy_sym_out(
+    magma_uplo_t uplo, magma_int_t m, magma_int_t n,
+    magma_int_t *rows, magma_int_t *perm,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper && uplo != MagmaFull )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < max(1,m))
+        info = -5;
+    else if ( lddb < max(1,m))
+        info = -7;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+
+    if ( uplo != MagmaLower ) {
+        magmablas_zlacpy( MagmaFull, m, n, dA, ldda, dB, lddb, queue );
+        return;
+    }
+
+    // as in the CUDA kernel, dA is read with lddb and dB written with ldda
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t jj = 0; jj < n; ++jj) {
+            perm[ rows[2*jj+1] ] = rows[2*jj+1];
+        }
+        for (magma_int_t jj = 0; jj < n; ++jj) {
+            magma_int_t j = rows[2*jj+1];
+            for (magma_int_t i = 0; i < m; ++i) {
+                if ( i <= j )
+                    dB[j + i*ldda] = MAGMA_Z_CONJ( dA[i + jj*lddb] );
+                else
+                    dB[i + j*ldda] = dA[i + jj*lddb];
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Sets the off-diagonal entries of dA to offdiag and the diagonal entries
+    to diag, like LAPACK's zlaset.
+
+    @ingroup magma_laset
+*******************************************************************************/
+extern "C" void
+magmablas_zlaset(
+    magma_uplo_t uplo, magma_int_t m, magma_int_t n,
+    magmaDoubleComplex offdiag, magmaDoubleComplex diag,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper && uplo != MagmaFull )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < max(1,m) )
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        lapackf77_zlaset( lapack_uplo_const( uplo ), &m, &n,
+                          &offdiag, &diag, dA, &ldda );
+    });
+}
+
+
+/***************************************************************************//**
+    Sets the k diagonals of the upper or lower band of dA: the main diagonal
+    to diag and the other k-1 diagonals to offdiag.
+
+    @ingroup magma_laset_band
+*******************************************************************************/
+extern "C" void
+magmablas_zlaset_band(
+    magma_uplo_t uplo, magma_int_t m, magma_int_t n, magma_int_t k,
+    magmaDoubleComplex offdiag, magmaDoubleComplex diag,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( k < 0 || k > 1024 )
+        info = -4;
+    else if ( ldda < max(1,m) )
+        info = -6;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        if ( uplo == MagmaUpper ) {
+            magma_int_t kk = min( k, n );
+            for (magma_int_t j = 0; j < n; ++j) {
+                for (magma_int_t i = max( 0, j-kk+1 ); i <= j && i < m; ++i) {
+                    *dA(i,j) = (i == j ? diag : offdiag);
+                }
+            }
+        }
+        else {
+            magma_int_t kk = min( k, m );
+            for (magma_int_t j = 0; j < n; ++j) {
+                for (magma_int_t i = j; i < min( m, j+kk ); ++i) {
+                    *dA(i,j) = (i == j ? diag : offdiag);
+                }
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Adds two matrices, \f$ dB = \alpha dA + dB \f$.
+
+    @ingroup magma_geadd
+*******************************************************************************/
+extern "C" void
+magmablas_zgeadd(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magmablas_zgeadd2( m, n, alpha, dA, ldda, MAGMA_Z_ONE, dB, lddb, queue );
+}
+
+
+/***************************************************************************//**
+    Adds two matrices, \f$ dB = \alpha dA + \beta dB \f$.
+
+    @ingroup magma_geadd
+*******************************************************************************/
+extern "C" void
+magmablas_zgeadd2(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( m < 0 )
+        info = -1;
+    else if ( n < 0 )
+        info = -2;
+    else if ( ldda < max(1,m))
+        info = -5;
+    else if ( lddb < max(1,m))
+        info = -7;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if ( m == 0 || n == 0 )
+        return;
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            for (magma_int_t i = 0; i < m; ++i) {
+                *dB(i,j) = alpha * (*dA(i,j)) + beta * (*dB(i,j));
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Computes \f$ dC = \alpha op(dA) + \beta op(dB) \f$,
+    where op is no-op, transpose, or conjugate transpose.
+
+    @ingroup magma_geam
+*******************************************************************************/
+extern "C" void
+magmablas_zgeam(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_const_ptr dB, magma_int_t lddb,
+    magmaDoubleComplex_ptr dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if      ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans )
+        info = -1;
+    else if ( transB != MagmaNoTrans && transB != MagmaTrans && transB != MagmaConjTrans )
+        info = -2;
+    else if ( m < 0 )
+        info = -3;
+    else if ( n < 0 )
+        info = -4;
+    else if ( dA == dC && transA != MagmaNoTrans )
+        info = -6;
+    else if ( transA == MagmaNoTrans ? ldda < m : ldda < n )
+        info = -7;
+    else if ( dB == dC && transB != MagmaNoTrans )
+        info = -9;
+    else if ( transB == MagmaNoTrans ? lddb < m : lddb < n )
+        info = -10;
+    else if ( lddc < m )
+        info = -12;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( (m == 0) || (n == 0) )
+        return;
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            for (magma_int_t i = 0; i < m; ++i) {
+                magmaDoubleComplex a, b;
+                if ( transA == MagmaNoTrans )
+                    a = *dA(i,j);
+                else if ( transA == MagmaTrans )
+                    a = *dA(j,i);
+                else
+                    a = MAGMA_Z_CONJ( *dA(j,i) );
+                if ( transB == MagmaNoTrans )
+                    b = *dB(i,j);
+                else if ( transB == MagmaTrans )
+                    b = *dB(j,i);
+                else
+                    b = MAGMA_Z_CONJ( *dB(j,i) );
+                dC[i + j*lddc] = alpha*a + beta*b;
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Makes dA Hermitian by copying the conjugate of the stored triangle
+    into the other triangle. The diagonal is made real.
+
+    @ingroup magma_symmetrize
+*******************************************************************************/
+extern "C" void
+magmablas_zsymmetrize(
+    magma_uplo_t uplo, magma_int_t m,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( ldda < max(1,m) )
+        info = -4;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if ( m == 0 )
+        return;
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < m; ++j) {
+            for (magma_int_t i = j+1; i < m; ++i) {
+                if ( uplo == MagmaLower )
+                    *dA(j,i) = MAGMA_Z_CONJ( *dA(i,j) );
+                else
+                    *dA(i,j) = MAGMA_Z_CONJ( *dA(j,i) );
+            }
+            *dA(j,j) = MAGMA_Z_MAKE( MAGMA_Z_REAL( *dA(j,j) ), 0 );
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Symmetrizes ntile tiles of size m x m along the diagonal of dA, like
+    magmablas_zsymmetrize. Tile t starts at dA(t*mstride, t*nstride).
+
+    @ingroup magma_symmetrize
+*******************************************************************************/
+extern "C" void
+magmablas_zsymmetrize_tiles(
+    magma_uplo_t uplo, magma_int_t m,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_int_t ntile, magma_int_t mstride, magma_int_t nstride,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( ldda < max(1,m + mstride*(ntile-1)) )
+        info = -5;
+    else if ( ntile < 0 )
+        info = -6;
+    else if ( mstride < 0 )
+        info = -7;
+    else if ( nstride < 0 )
+        info = -8;
+    else if ( mstride < m && nstride < m )  // only one must be >= m.
+        info = -7;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if ( m == 0 || ntile == 0 )
+        return;
+
+    for (magma_int_t t = 0; t < ntile; ++t) {
+        magmablas_zsymmetrize( uplo, m, dA(t*mstride, t*nstride), ldda, queue );
+    }
+}
+
+
+/***************************************************************************//**
+    Transposes a matrix, \f$ dAT = dA^T \f$.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magmablas_ztranspose(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr dA,  magma_int_t ldda,
+    magmaDoubleComplex_ptr       dAT, magma_int_t lddat,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( m < 0 )
+        info = -1;
+    else if ( n < 0 )
+        info = -2;
+    else if ( ldda < m )
+        info = -4;
+    else if ( lddat < n )
+        info = -6;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( m == 0 || n == 0 )
+        return;
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            for (magma_int_t i = 0; i < m; ++i) {
+                dAT[j + i*lddat] = *dA(i,j);
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Transposes a square matrix in place, \f$ dA = dA^T \f$.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magmablas_ztranspose_inplace(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( ldda < n )
+        info = -3;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            for (magma_int_t i = j+1; i < n; ++i) {
+                magmaDoubleComplex tmp = *dA(i,j);
+                *dA(i,j) = *dA(j,i);
+                *dA(j,i) = tmp;
+            }
+        }
+    });
+}
+
+
+#ifdef COMPLEX
+
+/***************************************************************************//**
+    Transposes and conjugates a matrix, \f$ dAT = dA^H \f$.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magmablas_ztranspose_conj(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr dA,  magma_int_t ldda,
+    magmaDoubleComplex_ptr       dAT, magma_int_t lddat,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( m < 0 )
+        info = -1;
+    else if ( n < 0 )
+        info = -2;
+    else if ( ldda < m )
+        info = -4;
+    else if ( lddat < n )
+        info = -6;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( m == 0 || n == 0 )
+        return;
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            for (magma_int_t i = 0; i < m; ++i) {
+                dAT[j + i*lddat] = MAGMA_Z_CONJ( *dA(i,j) );
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Transposes and conjugates a square matrix in place, \f$ dA = dA^H \f$.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magmablas_ztranspose_conj_inplace(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( ldda < n )
+        info = -3;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            for (magma_int_t i = j+1; i < n; ++i) {
+                magmaDoubleComplex tmp = *dA(i,j);
+                *dA(i,j) = MAGMA_Z_CONJ( *dA(j,i) );
+                *dA(j,i) = MAGMA_Z_CONJ( tmp );
+            }
+            *dA(j,j) = MAGMA_Z_CONJ( *dA(j,j) );
+        }
+    });
+}
+
+#endif // COMPLEX
+
+#endif // HAVE_HOST
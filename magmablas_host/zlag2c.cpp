@@ -0,0 +1,248 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @precisions mixed zc -> ds
+*/
+#include "host_stream.hpp"
+
+#define PRECISION_z
+
+#ifdef HAVE_HOST
+
+// Host versions of the magmablas mixed precision kernels.
+// zlag2c and zlat2c return info, so they wait for the queue, then convert
+// directly, as the CUDA versions wait to read the overflow flag; the others
+// push a lambda to the worker thread of the queue.
+// See the CUDA versions for the full argument descriptions.
+
+
+/***************************************************************************//**
+    Converts the double-complex matrix A to the single-complex matrix SA.
+    info = 1 if an entry of A is outside the single precision range.
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magmablas_zlag2c(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr A, magma_int_t lda,
+    magmaFloatComplex_ptr SA,       magma_int_t ldsa,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( m < 0 )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,m) )
+        *info = -4;
+    else if ( ldsa < max(1,m) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+
+    magma_queue_sync( queue );
+    lapackf77_zlag2c( &m, &n, A, &lda, SA, &ldsa, info );
+}
+
+
+/***************************************************************************//**
+    Converts the single-complex matrix SA to the double-complex matrix A.
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magmablas_clag2z(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex_const_ptr SA, magma_int_t ldsa,
+    magmaDoubleComplex_ptr       A, magma_int_t lda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( m < 0 )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( ldsa < max(1,m) )
+        *info = -4;
+    else if ( lda < max(1,m) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        magma_int_t iinfo;
+        lapackf77_clag2z( &m, &n, SA, &ldsa, A, &lda, &iinfo );
+    });
+}
+
+
+/***************************************************************************//**
+    Converts the lower or upper triangle of the double-complex Hermitian
+    matrix A to the single-complex matrix SA.
+    info = 1 if an entry of A is outside the single precision range.
+
+    @ingroup magma_lat2
+*******************************************************************************/
+extern "C" void
+magmablas_zlat2c(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaDoubleComplex_const_ptr  A, magma_int_t lda,
+    magmaFloatComplex_ptr        SA, magma_int_t ldsa,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,n) )
+        *info = -4;
+    else if ( ldsa < max(1,n) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( n == 0 ) {
+        return;
+    }
+
+    magma_queue_sync( queue );
+    lapackf77_zlat2c( lapack_uplo_const( uplo ), &n, A, &lda, SA, &ldsa, info );
+}
+
+
+/***************************************************************************//**
+    Converts the lower or upper triangle of the single-complex Hermitian
+    matrix SA to the double-complex matrix A.
+
+    @ingroup magma_lat2
+*******************************************************************************/
+extern "C" void
+magmablas_clat2z(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex_const_ptr SA, magma_int_t ldsa,
+    magmaDoubleComplex_ptr      A,  magma_int_t lda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,n) )
+        *info = -4;
+    else if ( ldsa < max(1,n) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( n == 0 ) {
+        return;
+    }
+
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            magma_int_t ibeg = (uplo == MagmaLower ? j : 0);
+            magma_int_t iend = (uplo == MagmaLower ? n : j+1);
+            for (magma_int_t i = ibeg; i < iend; ++i) {
+                A[i + j*lda] = MAGMA_Z_MAKE( MAGMA_C_REAL( SA[i + j*ldsa] ),
+                                             MAGMA_C_IMAG( SA[i + j*ldsa] ));
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Row i of A is cast to single precision in row ipiv[i] of SA (incx >= 0),
+    or row ipiv[i] of SA is cast to double precision in row i of A (incx < 0),
+    for 0 <= i < m. ipiv is in device memory.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_zclaswp(
+    magma_int_t n,
+    magmaDoubleComplex_ptr A, magma_int_t lda,
+    magmaFloatComplex_ptr SA, magma_int_t ldsa,
+    magma_int_t m,
+    const magma_int_t *ipiv, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t j = 0; j < n; ++j) {
+            for (magma_int_t i = 0; i < m; ++i) {
+                if (incx >= 0) {
+                    magmaDoubleComplex a = A[ipiv[i] + j*lda];
+                    SA[i + j*ldsa] = MAGMA_C_MAKE( (float)MAGMA_Z_REAL( a ),
+                                                   (float)MAGMA_Z_IMAG( a ));
+                }
+                else {
+                    magmaFloatComplex sa = SA[ipiv[i] + j*ldsa];
+                    A[i + j*lda] = MAGMA_Z_MAKE( (double)MAGMA_C_REAL( sa ),
+                                                 (double)MAGMA_C_IMAG( sa ));
+                }
+            }
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Adds the single precision correction r to the solution x, and copies b
+    to w: \f$ x = x + r \f$, \f$ w = b \f$.
+
+    @ingroup magma_axpy
+*******************************************************************************/
+extern "C" void
+magmablas_zcaxpycp(
+    magma_int_t m,
+    magmaFloatComplex_ptr r,
+    magmaDoubleComplex_ptr x,
+    magmaDoubleComplex_const_ptr b,
+    magmaDoubleComplex_ptr w,
+    magma_queue_t queue )
+{
+    magma_host_enqueue_func( queue, [=]() {
+        for (magma_int_t i = 0; i < m; ++i) {
+            x[i] = MAGMA_Z_ADD( x[i], MAGMA_Z_MAKE( MAGMA_C_REAL( r[i] ),
+                                                    MAGMA_C_IMAG( r[i] ) ) );
+            w[i] = b[i];
+        }
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,626 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/blas/magma_zvbcsr_cpu.cpp, normal z -> c, Fri Oct 16 19:29:27 2026
+
+*/
+#include <algorithm>
+
+#include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// largest number of rows in a block of the VBCSR format
+#define MAGMA_VBCSR_MAX_BLOCKSIZE 64
+
+
+/**
+    Collects the sorted, distinct block columns of block row I in ids, using
+    the pattern of its first row, which all rows of the block share.
+    Returns their number.
+*/
+static magma_int_t
+magma_cmvbcsr_blockcols(
+    magma_c_matrix A,
+    const magma_index_t *part,
+    const magma_index_t *bid,
+    magma_int_t I,
+    magma_index_t *ids )
+{
+    magma_int_t i = part[I], num = 0;
+    for (magma_int_t k = A.row[i]; k < A.row[i+1]; k++) {
+        ids[ num++ ] = bid[ A.col[k] ];
+    }
+    std::sort( ids, ids + num );
+    return std::unique( ids, ids + num ) - ids;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Converts a matrix A in CSR into the variable block CSR format
+    Magma_VBCSR on the host. The rows are split into blocks of consecutive
+    rows with identical column patterns (magma_cmrowblocks), e.g. the degrees
+    of freedom of one node of a FEM discretization. The same partition is
+    used for the columns, and every nonzero block is stored as a dense block
+    in column-major order, padded with zeros where needed.
+
+    In B, numblocks holds the number of block rows, blockinfo the first row of
+    each block (length numblocks+1), row and col the block row pointer and the
+    block column indices, vbcsr_valptr the offset of each block in val
+    (length nnz of blocks+1). nnz counts the stored values, true_nnz the
+    nonzeros of A.
+    The counting and the filling of the blocks run in parallel over the
+    block rows.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_c_matrix
+                square input matrix in CSR on the host
+
+    @param[in]
+    max_bs      magma_int_t
+                maximal number of rows in a block, at most 64,
+                8 if max_bs < 1
+
+    @param[out]
+    B           magma_c_matrix*
+                matrix in Magma_VBCSR on the host, has to be empty
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_caux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_cmvbcsr(
+    magma_c_matrix A,
+    magma_int_t max_bs,
+    magma_c_matrix *B,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    magma_int_t nb = 0, maxrow = 0;
+    magma_index_t *part = NULL, *bid = NULL, *vrow = NULL, *ids = NULL;
+
+    if ( A.memory_location != Magma_CPU || A.num_rows != A.num_cols ) {
+        printf("error: VBCSR requires a square matrix on the host.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+    if ( max_bs < 1 ) {
+        max_bs = 8;
+    }
+    max_bs = min( max_bs, MAGMA_VBCSR_MAX_BLOCKSIZE );
+
+    B->storage_type = Magma_VBCSR;
+    B->memory_location = Magma_CPU;
+    B->fill_mode = A.fill_mode;
+    B->num_rows = A.num_rows;
+    B->num_cols = A.num_cols;
+    B->true_nnz = A.nnz;
+    B->max_nnz_row = A.max_nnz_row;
+    B->diameter = A.diameter;
+    B->blocksize = max_bs;
+    B->val = NULL;
+    B->row = NULL;
+    B->col = NULL;
+    B->blockinfo = NULL;
+    B->vbcsr_valptr = NULL;
+
+    CHECK( magma_cmrowblocks( A, max_bs, &nb, &part, queue ));
+    B->numblocks = nb;
+    B->blockinfo = part;
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_index_malloc_cpu( &bid, A.num_rows+1 ));
+    #pragma omp parallel for schedule(static) reduction(max:maxrow)
+    for (magma_int_t I = 0; I < nb; I++) {
+        for (magma_int_t i = part[I]; i < part[I+1]; i++) {
+            bid[i] = I;
+            maxrow = max( maxrow, A.row[i+1] - A.row[i] );
+        }
+    }
+    CHECK( magma_index_malloc_cpu( &ids, num_threads * (maxrow+1) ));
+    CHECK( magma_index_malloc_cpu( &B->row, nb+1 ));
+    CHECK( magma_index_malloc_cpu( &vrow, nb+1 ));
+
+    // count the blocks and the values of each block row
+    #pragma omp parallel num_threads( num_threads )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        magma_index_t *tid = ids + id * (maxrow+1);
+        #pragma omp for schedule(dynamic, 64)
+        for (magma_int_t I = 0; I < nb; I++) {
+            magma_int_t num = magma_cmvbcsr_blockcols( A, part, bid, I, tid );
+            magma_int_t width = 0;
+            for (magma_int_t k = 0; k < num; k++) {
+                width += part[ tid[k]+1 ] - part[ tid[k] ];
+            }
+            B->row[I+1] = num;
+            vrow[I+1] = ( part[I+1] - part[I] ) * width;
+        }
+    }
+    B->row[0] = 0;
+    vrow[0] = 0;
+    CHECK( magma_cmatrix_createrowptr( nb, B->row, queue ));
+    CHECK( magma_cmatrix_createrowptr( nb, vrow, queue ));
+    B->nnz = vrow[nb];
+    CHECK( magma_index_malloc_cpu( &B->col, B->row[nb] ));
+    CHECK( magma_index_malloc_cpu( &B->vbcsr_valptr, B->row[nb]+1 ));
+    CHECK( magma_cmalloc_cpu( &B->val, B->nnz ));
+    B->vbcsr_valptr[ B->row[nb] ] = B->nnz;
+
+    // write the block structure and scatter the entries into the blocks
+    #pragma omp parallel num_threads( num_threads )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        magma_index_t *tid = ids + id * (maxrow+1);
+        #pragma omp for schedule(dynamic, 64)
+        for (magma_int_t I = 0; I < nb; I++) {
+            magma_int_t rows = part[I+1] - part[I];
+            magma_int_t num = magma_cmvbcsr_blockcols( A, part, bid, I, tid );
+            magma_index_t offset = vrow[I];
+            for (magma_int_t k = 0; k < num; k++) {
+                B->col[ B->row[I]+k ] = tid[k];
+                B->vbcsr_valptr[ B->row[I]+k ] = offset;
+                offset += rows * ( part[ tid[k]+1 ] - part[ tid[k] ] );
+            }
+            for (magma_index_t l = vrow[I]; l < vrow[I+1]; l++) {
+                B->val[l] = MAGMA_C_ZERO;
+            }
+            for (magma_int_t i = part[I]; i < part[I+1]; i++) {
+                for (magma_int_t k = A.row[i]; k < A.row[i+1]; k++) {
+                    magma_index_t J = bid[ A.col[k] ];
+                    magma_index_t *pos = std::lower_bound(
+                        B->col + B->row[I], B->col + B->row[I+1], J );
+                    magma_index_t l = B->vbcsr_valptr[ pos - B->col ] +
+                        ( A.col[k] - part[J] ) * rows + ( i - part[I] );
+                    B->val[l] += A.val[k];
+                }
+            }
+        }
+    }
+
+cleanup:
+    if ( info != 0 ) {
+        magma_cmfree( B, queue );
+    }
+    magma_free_cpu( bid );
+    magma_free_cpu( vrow );
+    magma_free_cpu( ids );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Converts a matrix A in Magma_VBCSR on the host back to CSR. The zeros
+    stored in the blocks are dropped.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_c_matrix
+                input matrix in Magma_VBCSR on the host
+
+    @param[out]
+    B           magma_c_matrix*
+                matrix in CSR on the host, has to be empty
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_caux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_cmvbcsrtocsr(
+    magma_c_matrix A,
+    magma_c_matrix *B,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    const magma_index_t *part = A.blockinfo;
+
+    if ( A.memory_location != Magma_CPU || A.storage_type != Magma_VBCSR ) {
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    B->storage_type = Magma_CSR;
+    B->memory_location = Magma_CPU;
+    B->fill_mode = A.fill_mode;
+    B->num_rows = A.num_rows;
+    B->num_cols = A.num_cols;
+    B->max_nnz_row = A.max_nnz_row;
+    B->diameter = A.diameter;
+    B->val = NULL;
+    B->col = NULL;
+    B->row = NULL;
+    CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
+
+    // count, then write the nonzeros of each row
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (magma_int_t I = 0; I < A.numblocks; I++) {
+        magma_int_t rows = part[I+1] - part[I];
+        for (magma_int_t r = 0; r < rows; r++) {
+            magma_index_t nz = 0;
+            for (magma_int_t k = A.row[I]; k < A.row[I+1]; k++) {
+                magma_int_t J = A.col[k];
+                const magmaFloatComplex *blk = A.val + A.vbcsr_valptr[k];
+                for (magma_int_t c = 0; c < part[J+1] - part[J]; c++) {
+                    if ( ! MAGMA_C_EQUAL( blk[ c*rows + r ], MAGMA_C_ZERO ) )
+                        nz++;
+                }
+            }
+            B->row[ part[I]+r+1 ] = nz;
+        }
+    }
+    B->row[0] = 0;
+    CHECK( magma_cmatrix_createrowptr( B->num_rows, B->row, queue ));
+    B->nnz = B->row[ B->num_rows ];
+    B->true_nnz = B->nnz;
+    CHECK( magma_index_malloc_cpu( &B->col, B->nnz ));
+    CHECK( magma_cmalloc_cpu( &B->val, B->nnz ));
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (magma_int_t I = 0; I < A.numblocks; I++) {
+        magma_int_t rows = part[I+1] - part[I];
+        for (magma_int_t r = 0; r < rows; r++) {
+            magma_index_t nz = B->row[ part[I]+r ];
+            for (magma_int_t k = A.row[I]; k < A.row[I+1]; k++) {
+                magma_int_t J = A.col[k];
+                const magmaFloatComplex *blk = A.val + A.vbcsr_valptr[k];
+                for (magma_int_t c = 0; c < part[J+1] - part[J]; c++) {
+                    if ( ! MAGMA_C_EQUAL( blk[ c*rows + r ], MAGMA_C_ZERO ) ) {
+                        B->col[nz] = part[J] + c;
+                        B->val[nz] = blk[ c*rows + r ];
+                        nz++;
+                    }
+                }
+            }
+        }
+    }
+
+cleanup:
+    if ( info != 0 ) {
+        magma_cmfree( B, queue );
+    }
+    return info;
+}
+
+
+/**
+    Helpers applying a dense block in column-major order, tmp += blk * x.
+    The fixed size variant lets the compiler unroll the columns and
+    vectorize over the rows, covering the common FEM block sizes.
+*/
+template< magma_int_t BS >
+static inline void
+magma_cgevbcsrmv_fixed(
+    const magmaFloatComplex *blk,
+    const magmaFloatComplex *x,
+    magmaFloatComplex *tmp )
+{
+    for (magma_int_t c = 0; c < BS; c++) {
+        magmaFloatComplex xc = x[c];
+        #pragma omp simd
+        for (magma_int_t r = 0; r < BS; r++)
+            tmp[r] += blk[ c*BS + r ] * xc;
+    }
+}
+
+static inline void
+magma_cgevbcsrmv_generic(
+    magma_int_t rows,
+    magma_int_t cols,
+    const magmaFloatComplex *blk,
+    const magmaFloatComplex *x,
+    magmaFloatComplex *tmp )
+{
+    for (magma_int_t c = 0; c < cols; c++) {
+        magmaFloatComplex xc = x[c];
+        #pragma omp simd
+        for (magma_int_t r = 0; r < rows; r++)
+            tmp[r] += blk[ c*rows + r ] * xc;
+    }
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host.
+    Input format is Magma_VBCSR (see magma_cmvbcsr): the block rows are
+    distributed to the threads, each block row is accumulated in registers
+    and written once. Square blocks of size 2, 3, 4 and 6 use unrolled
+    kernels.
+
+    Arguments
+    ---------
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    numblocks   magma_int_t
+                number of block rows in A
+
+    @param[in]
+    alpha       magmaFloatComplex
+                scalar multiplier
+
+    @param[in]
+    val         magmaFloatComplex*
+                array containing the blocks of A
+
+    @param[in]
+    valptr      magma_index_t*
+                offsets of the blocks in val
+
+    @param[in]
+    row         magma_index_t*
+                block row pointer of A
+
+    @param[in]
+    col         magma_index_t*
+                block column indices of A
+
+    @param[in]
+    part        magma_index_t*
+                first row of each block, length numblocks+1
+
+    @param[in]
+    x           magmaFloatComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaFloatComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaFloatComplex*
+                input/output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_cblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_cgevbcsrmv_cpu(
+    magma_int_t m,
+    magma_int_t numblocks,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *valptr,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magma_index_t *part,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue )
+{
+    bool beta_is_zero = MAGMA_C_EQUAL( beta, MAGMA_C_ZERO );
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (magma_int_t I = 0; I < numblocks; I++) {
+        magmaFloatComplex tmp[ MAGMA_VBCSR_MAX_BLOCKSIZE ];
+        magma_int_t rows = part[I+1] - part[I];
+        if ( rows > MAGMA_VBCSR_MAX_BLOCKSIZE )
+            continue;
+        for (magma_int_t r = 0; r < rows; r++)
+            tmp[r] = MAGMA_C_ZERO;
+        for (magma_int_t k = row[I]; k < row[I+1]; k++) {
+            magma_int_t J = col[k];
+            magma_int_t cols = part[J+1] - part[J];
+            const magmaFloatComplex *blk = val + valptr[k];
+            const magmaFloatComplex *xJ = x + part[J];
+            if ( rows == cols && rows == 3 ) {
+                magma_cgevbcsrmv_fixed< 3 >( blk, xJ, tmp );
+            } else if ( rows == cols && rows == 6 ) {
+                magma_cgevbcsrmv_fixed< 6 >( blk, xJ, tmp );
+            } else if ( rows == cols && rows == 2 ) {
+                magma_cgevbcsrmv_fixed< 2 >( blk, xJ, tmp );
+            } else if ( rows == cols && rows == 4 ) {
+                magma_cgevbcsrmv_fixed< 4 >( blk, xJ, tmp );
+            } else {
+                magma_cgevbcsrmv_generic( rows, cols, blk, xJ, tmp );
+            }
+        }
+        for (magma_int_t r = 0; r < rows; r++) {
+            magmaFloatComplex *yr = y + part[I] + r;
+            *yr = beta_is_zero ? alpha * tmp[r] : alpha * tmp[r] + beta * (*yr);
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Prepares the block-Jacobi preconditioner for a matrix A in Magma_VBCSR
+    on the host: the diagonal blocks of A are inverted (LU factorization with
+    partial pivoting) in parallel and stored as block-diagonal matrix D in
+    Magma_VBCSR, such that magma_cvbcsr_bjacobi_apply_cpu, or any SpMV with
+    D, applies the preconditioner.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_c_matrix
+                input matrix in Magma_VBCSR on the host
+
+    @param[out]
+    D           magma_c_matrix*
+                inverse of the block diagonal of A in Magma_VBCSR,
+                has to be empty
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_cgepr
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_cvbcsr_bjacobi_setup_cpu(
+    magma_c_matrix A,
+    magma_c_matrix *D,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t singular = 0;
+    magma_int_t nb = A.numblocks;
+
+    if ( A.memory_location != Magma_CPU || A.storage_type != Magma_VBCSR ) {
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    D->storage_type = Magma_VBCSR;
+    D->memory_location = Magma_CPU;
+    D->fill_mode = MagmaFull;
+    D->num_rows = A.num_rows;
+    D->num_cols = A.num_cols;
+    D->blocksize = A.blocksize;
+    D->numblocks = nb;
+    D->diameter = 0;
+    D->val = NULL;
+    D->row = NULL;
+    D->col = NULL;
+    D->blockinfo = NULL;
+    D->vbcsr_valptr = NULL;
+    CHECK( magma_index_malloc_cpu( &D->blockinfo, nb+1 ));
+    CHECK( magma_index_malloc_cpu( &D->row, nb+1 ));
+    CHECK( magma_index_malloc_cpu( &D->col, nb ));
+    CHECK( magma_index_malloc_cpu( &D->vbcsr_valptr, nb+1 ));
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t I = 0; I < nb; I++) {
+        magma_int_t rows = A.blockinfo[I+1] - A.blockinfo[I];
+        D->blockinfo[I] = A.blockinfo[I];
+        D->row[I] = I;
+        D->col[I] = I;
+        D->vbcsr_valptr[I+1] = rows * rows;
+    }
+    D->blockinfo[nb] = A.blockinfo[nb];
+    D->row[nb] = nb;
+    D->vbcsr_valptr[0] = 0;
+    CHECK( magma_cmatrix_createrowptr( nb, D->vbcsr_valptr, queue ));
+    D->nnz = D->vbcsr_valptr[nb];
+    D->true_nnz = D->nnz;
+    D->max_nnz_row = D->blocksize;
+    CHECK( magma_cmalloc_cpu( &D->val, D->nnz ));
+
+    #pragma omp parallel for schedule(dynamic, 64) reduction(max:singular)
+    for (magma_int_t I = 0; I < nb; I++) {
+        magma_int_t ipiv[ MAGMA_VBCSR_MAX_BLOCKSIZE ];
+        magmaFloatComplex work[ MAGMA_VBCSR_MAX_BLOCKSIZE ];
+        magma_int_t rows = D->blockinfo[I+1] - D->blockinfo[I], linfo = 0;
+        magmaFloatComplex *blk = D->val + D->vbcsr_valptr[I];
+        const magma_index_t *pos = std::lower_bound(
+            A.col + A.row[I], A.col + A.row[I+1], (magma_index_t) I );
+        if ( rows == 0 ) {
+            continue;
+        }
+        if ( rows > MAGMA_VBCSR_MAX_BLOCKSIZE ||
+             pos == A.col + A.row[I+1] || *pos != I ) {
+            singular = 1;
+            continue;
+        }
+        const magmaFloatComplex *ablk = A.val + A.vbcsr_valptr[ pos - A.col ];
+        for (magma_int_t l = 0; l < rows*rows; l++) {
+            blk[l] = ablk[l];
+        }
+        lapackf77_cgetrf( &rows, &rows, blk, &rows, ipiv, &linfo );
+        if ( linfo != 0 ) {
+            singular = 1;
+            continue;
+        }
+        lapackf77_cgetri( &rows, blk, &rows, ipiv, work, &rows, &linfo );
+    }
+    if ( singular ) {
+        printf("error: singular diagonal block in block-Jacobi.\n");
+        info = MAGMA_ERR_BADPRECOND;
+    }
+
+cleanup:
+    if ( info != 0 ) {
+        magma_cmfree( D, queue );
+    }
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Applies the block-Jacobi preconditioner generated by
+    magma_cvbcsr_bjacobi_setup_cpu on the host: x = D * b, where D holds the
+    inverted diagonal blocks.
+
+    Arguments
+    ---------
+
+    @param[in]
+    D           magma_c_matrix
+                inverted diagonal blocks in Magma_VBCSR on the host
+
+    @param[in]
+    b           magma_c_matrix
+                input vectors, column-major
+
+    @param[out]
+    x           magma_c_matrix*
+                output vectors, column-major
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_cgepr
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_cvbcsr_bjacobi_apply_cpu(
+    magma_c_matrix D,
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_queue_t queue )
+{
+    return magma_c_spmv_cpu( MAGMA_C_ONE, D, b, MAGMA_C_ZERO, *x, queue );
+}
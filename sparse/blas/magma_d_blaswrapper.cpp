@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/blas/magma_z_blaswrapper.cpp, normal z -> d, Sat Mar 27 20:32:22 2021
+       @generated from sparse/blas/magma_z_blaswrapper.cpp, normal z -> d, Sat Oct 17 00:26:38 2026
        @author Hartwig Anzt
 
 */
@@ -139,8 +139,10 @@ magma_d_spmv(
     magma_d_matrix dx={Magma_CSR};
     magma_d_matrix dy={Magma_CSR};
 
+    #if ! defined(HAVE_HOST)
     cusparseHandle_t cusparseHandle = 0;
     cusparseMatDescr_t descr = 0;
+    #endif
     // make sure RHS is a dense matrix
     if ( x.storage_type != Magma_DENSE ) {
          printf("error: only dense vectors are supported for SpMV.\n");
@@ -159,6 +161,11 @@ magma_d_spmv(
 
     // DEV case
     if ( A.memory_location == Magma_DEV ) {
+        #if defined(HAVE_HOST)
+        // the host backend has no cuSPARSE or SpMV kernels
+        printf("error: device SpMV not supported by the host backend.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        #else
         if ( A.num_cols == x.num_rows && x.num_cols == 1 ) {
             if ( A.storage_type == Magma_CSR   ||
                  A.storage_type == Magma_CUCSR ||
@@ -321,25 +328,18 @@ magma_d_spmv(
                 info = MAGMA_ERR_NOT_SUPPORTED;
             }
         }
+        #endif
     }
-    // CPU case missing!
+    // CPU case
     else {
-        CHECK( magma_dmtransfer( x, &dx, x.memory_location, Magma_DEV, queue ));
-        CHECK( magma_dmtransfer( y, &dy, y.memory_location, Magma_DEV, queue ));
-        CHECK( magma_dmtransfer( A, &dA, A.memory_location, Magma_DEV, queue ));
-        CHECK( magma_d_spmv( alpha, dA, dx, beta, dy, queue ) );
-        magma_dmfree(&x, queue );
-        magma_dmfree(&y, queue );
-        magma_dmfree(&A, queue );
-        CHECK( magma_dmtransfer( dx, &x, dx.memory_location, Magma_CPU, queue ));
-        CHECK( magma_dmtransfer( dy, &y, dy.memory_location, Magma_CPU, queue ));
-        CHECK( magma_dmtransfer( dA, &A, dA.memory_location, Magma_CPU, queue ));
-
+        CHECK( magma_d_spmv_cpu( alpha, A, x, beta, y, queue ));
     }
 
 cleanup:
+    #if ! defined(HAVE_HOST)
     cusparseDestroyMatDescr( descr );
     descr = 0;
+    #endif
     magma_dmfree(&x2, queue );
     magma_dmfree(&dx, queue );
     magma_dmfree(&dy, queue );
@@ -514,9 +514,6 @@ magma_d_spmm(
     magma_queue_t queue )
 {
     magma_int_t info = 0;
-    magma_d_matrix dA = {Magma_CSR};
-    magma_d_matrix dB = {Magma_CSR};
-    magma_d_matrix dC = {Magma_CSR};
     
     if ( A.memory_location != B.memory_location ) {
         printf("error: linear algebra objects are not located in same memory!\n");
@@ -541,19 +538,20 @@ magma_d_spmm(
             }
         }
     }
-    // CPU case missing!
+    // CPU case
     else {
-        A.storage_type = Magma_CSR;
-        B.storage_type = Magma_CSR;
-        CHECK( magma_dmtransfer( A, &dA, Magma_CPU, Magma_DEV, queue ) );
-        CHECK( magma_dmtransfer( B, &dB, Magma_CPU, Magma_DEV, queue ) );
-        CHECK(  magma_dcuspmm( dA, dB, &dC, queue ) );
-        CHECK( magma_dmtransfer( dC, C, Magma_DEV, Magma_CPU, queue ) );
+        if ( A.storage_type == Magma_CSR  ||
+             A.storage_type == Magma_CSRL ||
+             A.storage_type == Magma_CSRU ||
+             A.storage_type == Magma_CSRCOO ) {
+            CHECK( magma_dspgemm_cpu( alpha, A, B, C, queue ));
+        }
+        else {
+            printf("error: format not supported.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+        }
     }
     
 cleanup:
-    magma_dmfree( &dA, queue );
-    magma_dmfree( &dB, queue );
-    magma_dmfree( &dC, queue );
     return info;
 }
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/blas/magma_z_blaswrapper.cpp, normal z -> s, Sat Mar 27 20:32:23 2021
+       @generated from sparse/blas/magma_z_blaswrapper.cpp, normal z -> s, Sat Oct 17 00:26:38 2026
        @author Hartwig Anzt
 
 */
@@ -139,8 +139,10 @@ magma_s_spmv(
     magma_s_matrix dx={Magma_CSR};
     magma_s_matrix dy={Magma_CSR};
 
+    #if ! defined(HAVE_HOST)
     cusparseHandle_t cusparseHandle = 0;
     cusparseMatDescr_t descr = 0;
+    #endif
     // make sure RHS is a dense matrix
     if ( x.storage_type != Magma_DENSE ) {
          printf("error: only dense vectors are supported for SpMV.\n");
@@ -159,6 +161,11 @@ magma_s_spmv(
 
     // DEV case
     if ( A.memory_location == Magma_DEV ) {
+        #if defined(HAVE_HOST)
+        // the host backend has no cuSPARSE or SpMV kernels
+        printf("error: device SpMV not supported by the host backend.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        #else
         if ( A.num_cols == x.num_rows && x.num_cols == 1 ) {
             if ( A.storage_type == Magma_CSR   ||
                  A.storage_type == Magma_CUCSR ||
@@ -321,25 +328,18 @@ magma_s_spmv(
                 info = MAGMA_ERR_NOT_SUPPORTED;
             }
         }
+        #endif
     }
-    // CPU case missing!
+    // CPU case
     else {
-        CHECK( magma_smtransfer( x, &dx, x.memory_location, Magma_DEV, queue ));
-        CHECK( magma_smtransfer( y, &dy, y.memory_location, Magma_DEV, queue ));
-        CHECK( magma_smtransfer( A, &dA, A.memory_location, Magma_DEV, queue ));
-        CHECK( magma_s_spmv( alpha, dA, dx, beta, dy, queue ) );
-        magma_smfree(&x, queue );
-        magma_smfree(&y, queue );
-        magma_smfree(&A, queue );
-        CHECK( magma_smtransfer( dx, &x, dx.memory_location, Magma_CPU, queue ));
-        CHECK( magma_smtransfer( dy, &y, dy.memory_location, Magma_CPU, queue ));
-        CHECK( magma_smtransfer( dA, &A, dA.memory_location, Magma_CPU, queue ));
-
+        CHECK( magma_s_spmv_cpu( alpha, A, x, beta, y, queue ));
     }
 
 cleanup:
+    #if ! defined(HAVE_HOST)
     cusparseDestroyMatDescr( descr );
     descr = 0;
+    #endif
     magma_smfree(&x2, queue );
     magma_smfree(&dx, queue );
     magma_smfree(&dy, queue );
@@ -514,9 +514,6 @@ magma_s_spmm(
     magma_queue_t queue )
 {
     magma_int_t info = 0;
-    magma_s_matrix dA = {Magma_CSR};
-    magma_s_matrix dB = {Magma_CSR};
-    magma_s_matrix dC = {Magma_CSR};
     
     if ( A.memory_location != B.memory_location ) {
         printf("error: linear algebra objects are not located in same memory!\n");
@@ -541,19 +538,20 @@ magma_s_spmm(
             }
         }
     }
-    // CPU case missing!
+    // CPU case
     else {
-        A.storage_type = Magma_CSR;
-        B.storage_type = Magma_CSR;
-        CHECK( magma_smtransfer( A, &dA, Magma_CPU, Magma_DEV, queue ) );
-        CHECK( magma_smtransfer( B, &dB, Magma_CPU, Magma_DEV, queue ) );
-        CHECK(  magma_scuspmm( dA, dB, &dC, queue ) );
-        CHECK( magma_smtransfer( dC, C, Magma_DEV, Magma_CPU, queue ) );
+        if ( A.storage_type == Magma_CSR  ||
+             A.storage_type == Magma_CSRL ||
+             A.storage_type == Magma_CSRU ||
+             A.storage_type == Magma_CSRCOO ) {
+            CHECK( magma_sspgemm_cpu( alpha, A, B, C, queue ));
+        }
+        else {
+            printf("error: format not supported.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+        }
     }
     
 cleanup:
-    magma_smfree( &dA, queue );
-    magma_smfree( &dB, queue );
-    magma_smfree( &dC, queue );
     return info;
 }
@@ -139,8 +139,10 @@ magma_z_spmv(
     magma_z_matrix dx={Magma_CSR};
     magma_z_matrix dy={Magma_CSR};
 
+    #if ! defined(HAVE_HOST)
     cusparseHandle_t cusparseHandle = 0;
     cusparseMatDescr_t descr = 0;
+    #endif
     // make sure RHS is a dense matrix
     if ( x.storage_type != Magma_DENSE ) {
          printf("error: only dense vectors are supported for SpMV.\n");
@@ -159,6 +161,11 @@ magma_z_spmv(
 
     // DEV case
     if ( A.memory_location == Magma_DEV ) {
+        #if defined(HAVE_HOST)
+        // the host backend has no cuSPARSE or SpMV kernels
+        printf("error: device SpMV not supported by the host backend.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        #else
         if ( A.num_cols == x.num_rows && x.num_cols == 1 ) {
             if ( A.storage_type == Magma_CSR   ||
                  A.storage_type == Magma_CUCSR ||
@@ -321,25 +328,18 @@ magma_z_spmv(
                 info = MAGMA_ERR_NOT_SUPPORTED;
             }
         }
+        #endif
     }
-    // CPU case missing!
+    // CPU case
     else {
-        CHECK( magma_zmtransfer( x, &dx, x.memory_location, Magma_DEV, queue ));
-        CHECK( magma_zmtransfer( y, &dy, y.memory_location, Magma_DEV, queue ));
-        CHECK( magma_zmtransfer( A, &dA, A.memory_location, Magma_DEV, queue ));
-        CHECK( magma_z_spmv( alpha, dA, dx, beta, dy, queue ) );
-        magma_zmfree(&x, queue );
-        magma_zmfree(&y, queue );
-        magma_zmfree(&A, queue );
-        CHECK( magma_zmtransfer( dx, &x, dx.memory_location, Magma_CPU, queue ));
-        CHECK( magma_zmtransfer( dy, &y, dy.memory_location, Magma_CPU, queue ));
-        CHECK( magma_zmtransfer( dA, &A, dA.memory_location, Magma_CPU, queue ));
-
+        CHECK( magma_z_spmv_cpu( alpha, A, x, beta, y, queue ));
     }
 
 cleanup:
+    #if ! defined(HAVE_HOST)
     cusparseDestroyMatDescr( descr );
     descr = 0;
+    #endif
     magma_zmfree(&x2, queue );
     magma_zmfree(&dx, queue );
     magma_zmfree(&dy, queue );
@@ -514,9 +514,6 @@ magma_z_spmm(
     magma_queue_t queue )
 {
     magma_int_t info = 0;
-    magma_z_matrix dA = {Magma_CSR};
-    magma_z_matrix dB = {Magma_CSR};
-    magma_z_matrix dC = {Magma_CSR};
     
     if ( A.memory_location != B.memory_location ) {
         printf("error: linear algebra objects are not located in same memory!\n");
@@ -541,19 +538,20 @@ magma_z_spmm(
             }
         }
     }
-    // CPU case missing!
+    // CPU case
     else {
-        A.storage_type = Magma_CSR;
-        B.storage_type = Magma_CSR;
-        CHECK( magma_zmtransfer( A, &dA, Magma_CPU, Magma_DEV, queue ) );
-        CHECK( magma_zmtransfer( B, &dB, Magma_CPU, Magma_DEV, queue ) );
-        CHECK(  magma_zcuspmm( dA, dB, &dC, queue ) );
-        CHECK( magma_zmtransfer( dC, C, Magma_DEV, Magma_CPU, queue ) );
+        if ( A.storage_type == Magma_CSR  ||
+             A.storage_type == Magma_CSRL ||
+             A.storage_type == Magma_CSRU ||
+             A.storage_type == Magma_CSRCOO ) {
+            CHECK( magma_zspgemm_cpu( alpha, A, B, C, queue ));
+        }
+        else {
+            printf("error: format not supported.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+        }
     }
     
 cleanup:
-    magma_zmfree( &dA, queue );
-    magma_zmfree( &dB, queue );
-    magma_zmfree( &dC, queue );
     return info;
 }
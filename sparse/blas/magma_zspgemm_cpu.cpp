@@ -0,0 +1,393 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @precisions normal z -> c d s
+
+*/
+#include <algorithm>
+
+#include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// rows are handed out to the threads in chunks of this size
+#define MAGMA_SPGEMM_CHUNK 32
+
+
+/**
+    Helpers for the per-thread hash tables of the host SpGEMM. The tables use
+    open addressing with linear probing, their size is a power of two at
+    least twice the number of keys, and -1 marks an empty slot.
+*/
+static inline magma_int_t
+magma_zspgemm_tabsize( magma_int_t nkeys )
+{
+    magma_int_t size = 16;
+    while ( size < 2*nkeys ) {
+        size *= 2;
+    }
+    return size;
+}
+
+static inline magma_int_t
+magma_zspgemm_hash( magma_index_t key, magma_int_t mask )
+{
+    return (magma_int_t) ( ((unsigned int) key * 2654435761u) >> 7 ) & mask;
+}
+
+
+/**
+    Upper bound for the number of nonzeros in each row of A * B, i.e. the
+    number of products formed for the row. Returns the largest bound, capped
+    at B.num_cols, which is what the hash tables have to hold.
+*/
+static magma_int_t
+magma_zspgemm_rowflops(
+    magma_z_matrix A,
+    magma_z_matrix B,
+    magma_index_t *flops )
+{
+    magma_int_t maxrow = 0;
+
+    #pragma omp parallel for schedule(static) reduction(max:maxrow)
+    for (magma_int_t i = 0; i < A.num_rows; i++) {
+        magma_int_t f = 0;
+        for (magma_int_t k = A.row[i]; k < A.row[i+1]; k++) {
+            magma_index_t c = A.col[k];
+            f += B.row[c+1] - B.row[c];
+        }
+        flops[i] = f;
+        maxrow = max( maxrow, min( f, B.num_cols ) );
+    }
+    return maxrow;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Symbolic phase of the host sparse matrix-matrix product C = A * B.
+    Computes the sparsity pattern of the product in CSR with sorted column
+    indices and allocates the values, which are set by
+    magma_zspgemm_numeric_cpu. As the pattern only depends on the patterns
+    of A and B, it can be reused for any number of numeric phases with new
+    values in A and B.
+
+    The distinct columns of each row are collected in a per-thread hash
+    table, first to count them, then to write them. Rows are distributed
+    dynamically as the work per row varies strongly.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_z_matrix
+                input matrix A in CSR on the host
+
+    @param[in]
+    B           magma_z_matrix
+                input matrix B in CSR on the host
+
+    @param[out]
+    C           magma_z_matrix*
+                pattern of A * B in CSR on the host, has to be empty
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zspgemm_symbolic_cpu(
+    magma_z_matrix A,
+    magma_z_matrix B,
+    magma_z_matrix *C,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    magma_int_t tabsize;
+    magma_index_t *flops = NULL;
+    magma_index_t *table = NULL;
+
+    if ( A.memory_location != Magma_CPU || B.memory_location != Magma_CPU ||
+         A.num_cols != B.num_rows ) {
+        return MAGMA_ERR_NOT_SUPPORTED;
+    }
+
+    C->storage_type = Magma_CSR;
+    C->memory_location = Magma_CPU;
+    C->fill_mode = MagmaFull;
+    C->num_rows = A.num_rows;
+    C->num_cols = B.num_cols;
+    C->row = NULL;
+    C->col = NULL;
+    C->val = NULL;
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_index_malloc_cpu( &flops, A.num_rows+1 ));
+    CHECK( magma_index_malloc_cpu( &C->row, A.num_rows+1 ));
+    tabsize = magma_zspgemm_tabsize( magma_zspgemm_rowflops( A, B, flops ));
+    CHECK( magma_index_malloc_cpu( &table, num_threads * tabsize ));
+
+    // count the distinct columns of each row
+    #pragma omp parallel num_threads( num_threads )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        magma_index_t *tab = table + id * tabsize;
+        #pragma omp for schedule(dynamic, MAGMA_SPGEMM_CHUNK)
+        for (magma_int_t i = 0; i < A.num_rows; i++) {
+            magma_int_t mask = magma_zspgemm_tabsize(
+                                    min( flops[i], B.num_cols )) - 1;
+            magma_int_t nz = 0;
+            for (magma_int_t s = 0; s <= mask; s++) {
+                tab[s] = -1;
+            }
+            for (magma_int_t k = A.row[i]; k < A.row[i+1]; k++) {
+                magma_index_t c = A.col[k];
+                for (magma_int_t l = B.row[c]; l < B.row[c+1]; l++) {
+                    magma_index_t j = B.col[l];
+                    magma_int_t s = magma_zspgemm_hash( j, mask );
+                    while ( tab[s] != -1 && tab[s] != j ) {
+                        s = (s + 1) & mask;
+                    }
+                    if ( tab[s] == -1 ) {
+                        tab[s] = j;
+                        nz++;
+                    }
+                }
+            }
+            C->row[i+1] = nz;
+        }
+    }
+    C->row[0] = 0;
+    CHECK( magma_zmatrix_createrowptr( C->num_rows, C->row, queue ));
+    C->nnz = C->row[ C->num_rows ];
+    C->true_nnz = C->nnz;
+    CHECK( magma_index_malloc_cpu( &C->col, C->nnz ));
+    CHECK( magma_zmalloc_cpu( &C->val, C->nnz ));
+
+    // write the columns, then sort them
+    #pragma omp parallel num_threads( num_threads )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        magma_index_t *tab = table + id * tabsize;
+        #pragma omp for schedule(dynamic, MAGMA_SPGEMM_CHUNK)
+        for (magma_int_t i = 0; i < A.num_rows; i++) {
+            magma_int_t mask = magma_zspgemm_tabsize(
+                                    min( flops[i], B.num_cols )) - 1;
+            magma_int_t nz = C->row[i];
+            for (magma_int_t s = 0; s <= mask; s++) {
+                tab[s] = -1;
+            }
+            for (magma_int_t k = A.row[i]; k < A.row[i+1]; k++) {
+                magma_index_t c = A.col[k];
+                for (magma_int_t l = B.row[c]; l < B.row[c+1]; l++) {
+                    magma_index_t j = B.col[l];
+                    magma_int_t s = magma_zspgemm_hash( j, mask );
+                    while ( tab[s] != -1 && tab[s] != j ) {
+                        s = (s + 1) & mask;
+                    }
+                    if ( tab[s] == -1 ) {
+                        tab[s] = j;
+                        C->col[ nz++ ] = j;
+                    }
+                }
+            }
+            std::sort( C->col + C->row[i], C->col + C->row[i+1] );
+        }
+    }
+
+cleanup:
+    if ( info != 0 ) {
+        magma_zmfree( C, queue );
+    }
+    magma_free_cpu( flops );
+    magma_free_cpu( table );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Numeric phase of the host sparse matrix-matrix product
+              C = alpha * A * B.
+    C has to hold the pattern computed by magma_zspgemm_symbolic_cpu for
+    matrices with the same patterns as A and B; only the values of C are
+    written.
+
+    Each thread maps the columns of the current row of C to their positions
+    in a hash table and accumulates the products directly into C.
+
+    Arguments
+    ---------
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar alpha
+
+    @param[in]
+    A           magma_z_matrix
+                input matrix A in CSR on the host
+
+    @param[in]
+    B           magma_z_matrix
+                input matrix B in CSR on the host
+
+    @param[in,out]
+    C           magma_z_matrix*
+                product in CSR on the host
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zspgemm_numeric_cpu(
+    magmaDoubleComplex alpha,
+    magma_z_matrix A,
+    magma_z_matrix B,
+    magma_z_matrix *C,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    magma_int_t maxrow = 0;
+    magma_int_t tabsize;
+    magma_index_t *table = NULL;
+
+    if ( A.memory_location != Magma_CPU || B.memory_location != Magma_CPU ||
+         C->memory_location != Magma_CPU || C->row == NULL ||
+         A.num_cols != B.num_rows || C->num_rows != A.num_rows ) {
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    #pragma omp parallel for schedule(static) reduction(max:maxrow)
+    for (magma_int_t i = 0; i < C->num_rows; i++) {
+        maxrow = max( maxrow, C->row[i+1] - C->row[i] );
+    }
+    tabsize = magma_zspgemm_tabsize( maxrow );
+    // column and position in C for each slot
+    CHECK( magma_index_malloc_cpu( &table, 2 * num_threads * tabsize ));
+
+    #pragma omp parallel num_threads( num_threads )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        magma_index_t *tab = table + 2 * id * tabsize;
+        magma_index_t *pos = tab + tabsize;
+        #pragma omp for schedule(dynamic, MAGMA_SPGEMM_CHUNK)
+        for (magma_int_t i = 0; i < A.num_rows; i++) {
+            magma_int_t mask = magma_zspgemm_tabsize(
+                                    C->row[i+1] - C->row[i] ) - 1;
+            for (magma_int_t s = 0; s <= mask; s++) {
+                tab[s] = -1;
+            }
+            for (magma_int_t p = C->row[i]; p < C->row[i+1]; p++) {
+                magma_int_t s = magma_zspgemm_hash( C->col[p], mask );
+                while ( tab[s] != -1 ) {
+                    s = (s + 1) & mask;
+                }
+                tab[s] = C->col[p];
+                pos[s] = p;
+                C->val[p] = MAGMA_Z_ZERO;
+            }
+            for (magma_int_t k = A.row[i]; k < A.row[i+1]; k++) {
+                magma_index_t c = A.col[k];
+                magmaDoubleComplex a = alpha * A.val[k];
+                for (magma_int_t l = B.row[c]; l < B.row[c+1]; l++) {
+                    magma_int_t s = magma_zspgemm_hash( B.col[l], mask );
+                    while ( tab[s] != B.col[l] ) {
+                        s = (s + 1) & mask;
+                    }
+                    C->val[ pos[s] ] += a * B.val[l];
+                }
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( table );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host sparse matrix-matrix product C = alpha * A * B for matrices in CSR,
+    running the symbolic and the numeric phase. If the product has to be
+    formed repeatedly for matrices with the same patterns, call
+    magma_zspgemm_symbolic_cpu once and magma_zspgemm_numeric_cpu for every
+    product instead.
+
+    Arguments
+    ---------
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar alpha
+
+    @param[in]
+    A           magma_z_matrix
+                input matrix A in CSR on the host
+
+    @param[in]
+    B           magma_z_matrix
+                input matrix B in CSR on the host
+
+    @param[out]
+    C           magma_z_matrix*
+                product in CSR on the host, has to be empty
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zspgemm_cpu(
+    magmaDoubleComplex alpha,
+    magma_z_matrix A,
+    magma_z_matrix B,
+    magma_z_matrix *C,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    CHECK( magma_zspgemm_symbolic_cpu( A, B, C, queue ));
+    CHECK( magma_zspgemm_numeric_cpu( alpha, A, B, C, queue ));
+
+cleanup:
+    return info;
+}
@@ -0,0 +1,1456 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @precisions normal z -> c d s
+
+*/
+#include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define PRECISION_z
+
+// upper bound for the SELL-P slice size (the converter enforces 256 % C == 0)
+#define MAGMA_SELLP_MAX_BLOCKSIZE 256
+
+
+// writes y = alpha * tmp + beta * y, without reading y if beta is zero
+#define ZAXPBY_ROW( y, alpha, tmp, beta, beta_is_zero )                   \
+    (y) = (beta_is_zero) ? (alpha) * (tmp) : (alpha) * (tmp) + (beta) * (y)
+
+
+/**
+    Helper splitting the rows of a CSR matrix into num_threads contiguous
+    chunks carrying roughly the same amount of work. The work of a row is its
+    nonzero count plus one, i.e. the split is done along row[i] + i, which
+    is monotonic in i, such that a binary search can be used.
+    Thread t processes rows [ start[t], start[t+1] ).
+*/
+static void
+magma_zcsr_balance(
+    magma_int_t m,
+    const magma_index_t *row,
+    magma_int_t num_threads,
+    magma_int_t *start )
+{
+    magma_int_t total = (magma_int_t) row[m] + m;
+    start[0] = 0;
+    for (magma_int_t t = 1; t < num_threads; t++) {
+        magma_int_t target = (magma_int_t)( ((double) total * t) / num_threads );
+        magma_int_t lo = start[t-1], hi = m;
+        while (lo < hi) {
+            magma_int_t mid = lo + (hi - lo) / 2;
+            if ( (magma_int_t) row[mid] + mid < target )
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        start[t] = lo;
+    }
+    start[num_threads] = m;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host.
+    Input format is CSR. The rows are distributed to the OpenMP threads in
+    contiguous chunks balanced with respect to the nonzero count.
+
+    Arguments
+    ---------
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    n           magma_int_t
+                number of columns in A
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    val         magmaDoubleComplex*
+                array containing values of A in CSR
+
+    @param[in]
+    row         magma_index_t*
+                rowpointer of A in CSR
+
+    @param[in]
+    col         magma_index_t*
+                columnindices of A in CSR
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zgecsrmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    magma_int_t *start = NULL;
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_imalloc_cpu( &start, num_threads+1 ));
+    magma_zcsr_balance( m, row, num_threads, start );
+
+    #pragma omp parallel num_threads( num_threads )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        for (magma_int_t i = start[id]; i < start[id+1]; i++) {
+            magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+            for (magma_int_t j = row[i]; j < row[i+1]; j++) {
+                tmp += val[j] * x[ col[j] ];
+            }
+            ZAXPBY_ROW( y[i], alpha, tmp, beta, beta_is_zero );
+        }
+    }
+
+cleanup:
+    magma_free_cpu( start );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes Y = alpha *  A *  X + beta * Y on the host for
+    num_vecs vectors X, Y.
+    Input format is CSR. In column-major order, the vectors are stored one
+    after the other (leading dimension n for X and m for Y), in row-major
+    order the num_vecs entries belonging to one row are consecutive.
+
+    Arguments
+    ---------
+
+    @param[in]
+    major       magma_order_t
+                storage order of X and Y
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    n           magma_int_t
+                number of columns in A
+
+    @param[in]
+    num_vecs    magma_int_t
+                number of vectors
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    val         magmaDoubleComplex*
+                array containing values of A in CSR
+
+    @param[in]
+    row         magma_index_t*
+                rowpointer of A in CSR
+
+    @param[in]
+    col         magma_index_t*
+                columnindices of A in CSR
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vectors X
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vectors Y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zmgecsrmv_cpu(
+    magma_order_t major,
+    magma_int_t m, magma_int_t n,
+    magma_int_t num_vecs,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    magma_int_t *start = NULL;
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_imalloc_cpu( &start, num_threads+1 ));
+    magma_zcsr_balance( m, row, num_threads, start );
+
+    if ( major == MagmaRowMajor ) {
+        #pragma omp parallel num_threads( num_threads )
+        {
+            magma_int_t id = 0;
+            #ifdef _OPENMP
+            id = omp_get_thread_num();
+            #endif
+            for (magma_int_t i = start[id]; i < start[id+1]; i++) {
+                magmaDoubleComplex *yi = y + i*num_vecs;
+                if ( beta_is_zero ) {
+                    for (magma_int_t v = 0; v < num_vecs; v++)
+                        yi[v] = MAGMA_Z_ZERO;
+                } else {
+                    for (magma_int_t v = 0; v < num_vecs; v++)
+                        yi[v] = beta * yi[v];
+                }
+                for (magma_int_t j = row[i]; j < row[i+1]; j++) {
+                    magmaDoubleComplex a = alpha * val[j];
+                    const magmaDoubleComplex *xj = x + col[j]*num_vecs;
+                    #pragma omp simd
+                    for (magma_int_t v = 0; v < num_vecs; v++)
+                        yi[v] += a * xj[v];
+                }
+            }
+        }
+    }
+    else {
+        #pragma omp parallel num_threads( num_threads )
+        {
+            magma_int_t id = 0;
+            #ifdef _OPENMP
+            id = omp_get_thread_num();
+            #endif
+            for (magma_int_t i = start[id]; i < start[id+1]; i++) {
+                for (magma_int_t v = 0; v < num_vecs; v++) {
+                    const magmaDoubleComplex *xv = x + v*n;
+                    magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+                    for (magma_int_t j = row[i]; j < row[i+1]; j++) {
+                        tmp += val[j] * xv[ col[j] ];
+                    }
+                    ZAXPBY_ROW( y[v*m+i], alpha, tmp, beta, beta_is_zero );
+                }
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( start );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host.
+    Input format is ELLPACKT (row-major ELLPACK). Padding entries are marked
+    with a negative column index, as generated by magma_zmconvert for
+    Magma_ELLPACKT and Magma_ELLD.
+
+    Arguments
+    ---------
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    n           magma_int_t
+                number of columns in A
+
+    @param[in]
+    nnz_per_row magma_int_t
+                number of elements in the longest row
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    val         magmaDoubleComplex*
+                array containing values of A in ELLPACKT
+
+    @param[in]
+    col         magma_index_t*
+                columnindices of A in ELLPACKT
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zgeellmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t i = 0; i < m; i++) {
+        magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+        for (magma_int_t k = 0; k < nnz_per_row; k++) {
+            magma_index_t c = col[ i*nnz_per_row + k ];
+            if ( c >= 0 )
+                tmp += val[ i*nnz_per_row + k ] * x[ c ];
+        }
+        ZAXPBY_ROW( y[i], alpha, tmp, beta, beta_is_zero );
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host.
+    Input format is ELL (column-major ELLPACK, zero-padded). The rows are
+    processed in chunks such that the inner loop runs over consecutive
+    memory locations of val and col.
+
+    Arguments
+    ---------
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    n           magma_int_t
+                number of columns in A
+
+    @param[in]
+    nnz_per_row magma_int_t
+                number of elements in the longest row
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    val         magmaDoubleComplex*
+                array containing values of A in ELL
+
+    @param[in]
+    col         magma_index_t*
+                columnindices of A in ELL
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zgeelltmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    const magma_int_t chunk = MAGMA_SELLP_MAX_BLOCKSIZE;
+    magma_int_t num_chunks = magma_ceildiv( m, chunk );
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t c = 0; c < num_chunks; c++) {
+        magmaDoubleComplex tmp[ MAGMA_SELLP_MAX_BLOCKSIZE ];
+        magma_int_t first = c * chunk;
+        magma_int_t len = min( chunk, m - first );
+        for (magma_int_t i = 0; i < len; i++)
+            tmp[i] = MAGMA_Z_ZERO;
+        for (magma_int_t k = 0; k < nnz_per_row; k++) {
+            const magmaDoubleComplex *valk = val + k*m + first;
+            const magma_index_t *colk = col + k*m + first;
+            #pragma omp simd
+            for (magma_int_t i = 0; i < len; i++)
+                tmp[i] += valk[i] * x[ colk[i] ];
+        }
+        for (magma_int_t i = 0; i < len; i++) {
+            ZAXPBY_ROW( y[first+i], alpha, tmp[i], beta, beta_is_zero );
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host.
+    Input format is ELLRT. The ELLRT format stores the row-major ELLPACK
+    arrays with rows padded to a multiple of alignment, and the row lengths
+    in row.
+
+    Arguments
+    ---------
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    n           magma_int_t
+                number of columns in A
+
+    @param[in]
+    nnz_per_row magma_int_t
+                number of elements in the longest row
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    val         magmaDoubleComplex*
+                array containing values of A in ELLRT
+
+    @param[in]
+    col         magma_index_t*
+                columnindices of A in ELLRT
+
+    @param[in]
+    rowlength   magma_index_t*
+                number of nonzeros in each row
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vector y
+
+    @param[in]
+    alignment   magma_int_t
+                alignment of the rows
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zgeellrtmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *col,
+    const magma_index_t *rowlength,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_int_t alignment,
+    magma_queue_t queue )
+{
+    magma_int_t ld = magma_roundup( nnz_per_row, alignment );
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t i = 0; i < m; i++) {
+        magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+        for (magma_int_t k = 0; k < rowlength[i]; k++) {
+            tmp += val[ i*ld + k ] * x[ col[ i*ld + k ] ];
+        }
+        ZAXPBY_ROW( y[i], alpha, tmp, beta, beta_is_zero );
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host.
+    Input format is SELL-P. The slices are distributed to the threads, inside
+    a slice the rows are processed as SIMD lanes. For SELL-C-sigma, the
+    results are scattered to the original rows.
+
+    Arguments
+    ---------
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    n           magma_int_t
+                number of columns in A
+
+    @param[in]
+    blocksize   magma_int_t
+                number of rows in one SELL-P slice
+
+    @param[in]
+    slices      magma_int_t
+                number of slices in matrix
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    val         magmaDoubleComplex*
+                array containing values of A in SELL-P
+
+    @param[in]
+    col         magma_index_t*
+                columnindices of A in SELL-P
+
+    @param[in]
+    rowptr      magma_index_t*
+                slice pointer of A in SELL-P
+
+    @param[in]
+    perm        magma_index_t*
+                row permutation of SELL-C-sigma: row j of the SELL-P
+                layout is row perm[j] of A, NULL if the rows are not sorted
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zgesellpmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t blocksize,
+    magma_int_t slices,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *col,
+    const magma_index_t *rowptr,
+    const magma_index_t *perm,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    if ( blocksize > MAGMA_SELLP_MAX_BLOCKSIZE ) {
+        return MAGMA_ERR_NOT_SUPPORTED;
+    }
+
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (magma_int_t s = 0; s < slices; s++) {
+        magmaDoubleComplex tmp[ MAGMA_SELLP_MAX_BLOCKSIZE ];
+        magma_int_t C = blocksize;
+        magma_int_t len = (rowptr[s+1] - rowptr[s]) / C;
+        for (magma_int_t j = 0; j < C; j++)
+            tmp[j] = MAGMA_Z_ZERO;
+        for (magma_int_t k = 0; k < len; k++) {
+            const magmaDoubleComplex *valk = val + rowptr[s] + k*C;
+            const magma_index_t *colk = col + rowptr[s] + k*C;
+            #pragma omp simd
+            for (magma_int_t j = 0; j < C; j++)
+                tmp[j] += valk[j] * x[ colk[j] ];
+        }
+        magma_int_t rows = min( C, m - s*C );
+        for (magma_int_t j = 0; j < rows; j++) {
+            magma_int_t i = perm ? perm[s*C+j] : s*C+j;
+            ZAXPBY_ROW( y[i], alpha, tmp[j], beta, beta_is_zero );
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes Y = alpha *  A *  X + beta * Y on the host for
+    num_vecs vectors stored in row-major order.
+    Input format is SELL-P.
+
+    Arguments
+    ---------
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    n           magma_int_t
+                number of columns in A
+
+    @param[in]
+    num_vecs    magma_int_t
+                number of vectors
+
+    @param[in]
+    blocksize   magma_int_t
+                number of rows in one SELL-P slice
+
+    @param[in]
+    slices      magma_int_t
+                number of slices in matrix
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    val         magmaDoubleComplex*
+                array containing values of A in SELL-P
+
+    @param[in]
+    col         magma_index_t*
+                columnindices of A in SELL-P
+
+    @param[in]
+    rowptr      magma_index_t*
+                slice pointer of A in SELL-P
+
+    @param[in]
+    perm        magma_index_t*
+                row permutation of SELL-C-sigma: row j of the SELL-P
+                layout is row perm[j] of A, NULL if the rows are not sorted
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vectors X
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vectors Y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zmgesellpmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t num_vecs,
+    magma_int_t blocksize,
+    magma_int_t slices,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *col,
+    const magma_index_t *rowptr,
+    const magma_index_t *perm,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (magma_int_t s = 0; s < slices; s++) {
+        magma_int_t C = blocksize;
+        magma_int_t len = (rowptr[s+1] - rowptr[s]) / C;
+        magma_int_t rows = min( C, m - s*C );
+        for (magma_int_t j = 0; j < rows; j++) {
+            magmaDoubleComplex *yi = y + ( perm ? perm[s*C+j] : s*C+j )*num_vecs;
+            if ( beta_is_zero ) {
+                for (magma_int_t v = 0; v < num_vecs; v++)
+                    yi[v] = MAGMA_Z_ZERO;
+            } else {
+                for (magma_int_t v = 0; v < num_vecs; v++)
+                    yi[v] = beta * yi[v];
+            }
+            for (magma_int_t k = 0; k < len; k++) {
+                magma_int_t idx = rowptr[s] + k*C + j;
+                magmaDoubleComplex a = alpha * val[ idx ];
+                const magmaDoubleComplex *xj = x + col[ idx ]*num_vecs;
+                #pragma omp simd
+                for (magma_int_t v = 0; v < num_vecs; v++)
+                    yi[v] += a * xj[v];
+            }
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host.
+    Input format is CSR5 as generated by magma_zmconvert on the host.
+    The CSR5 converter keeps the CSR row pointer and only transposes the
+    column indices and values inside each full, non-fast-track tile. The
+    kernel therefore processes the rows in nonzero-balanced chunks like the
+    CSR kernel, and maps every CSR position to its location inside the tile.
+
+    Arguments
+    ---------
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    n           magma_int_t
+                number of columns in A
+
+    @param[in]
+    p           magma_int_t
+                number of tiles in A
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    sigma       magma_int_t
+                sigma in A in CSR5
+
+    @param[in]
+    tile_ptr    magma_uindex_t*
+                tile pointer of A in CSR5
+
+    @param[in]
+    val         magmaDoubleComplex*
+                array containing values of A in CSR5
+
+    @param[in]
+    row         magma_index_t*
+                rowpointer of A in CSR5
+
+    @param[in]
+    col         magma_index_t*
+                columnindices of A in CSR5
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zgecsr5mv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t p,
+    magmaDoubleComplex alpha,
+    magma_int_t sigma,
+    const magma_uindex_t *tile_ptr,
+    const magmaDoubleComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    magma_int_t *start = NULL;
+    const magma_int_t tile = MAGMA_CSR5_OMEGA * sigma;
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_imalloc_cpu( &start, num_threads+1 ));
+    magma_zcsr_balance( m, row, num_threads, start );
+
+    #pragma omp parallel num_threads( num_threads )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        for (magma_int_t i = start[id]; i < start[id+1]; i++) {
+            magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+            magma_int_t j = row[i];
+            while ( j < row[i+1] ) {
+                magma_int_t t = j / tile;
+                magma_int_t tile_end = min( (magma_int_t) row[i+1], (t+1)*tile );
+                if ( t < p-1 && tile_ptr[t] != tile_ptr[t+1] ) {
+                    // transposed tile: entry idx is stored at
+                    // (idx % sigma) * omega + idx / sigma
+                    magma_int_t base = t * tile;
+                    for (; j < tile_end; j++) {
+                        magma_int_t idx = j - base;
+                        magma_int_t dst = base + (idx % sigma) * MAGMA_CSR5_OMEGA
+                                               + idx / sigma;
+                        tmp += val[ dst ] * x[ col[ dst ] ];
+                    }
+                } else {
+                    // fast-track tile or last tile: stored as in CSR
+                    for (; j < tile_end; j++) {
+                        tmp += val[ j ] * x[ col[ j ] ];
+                    }
+                }
+            }
+            ZAXPBY_ROW( y[i], alpha, tmp, beta, beta_is_zero );
+        }
+    }
+
+cleanup:
+    magma_free_cpu( start );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host.
+    Input format is COO with the row indices in ascending order, as generated
+    by magma_zmconvert. The nonzeros are split into equally sized chunks.
+    Every thread accumulates the contributions to the first row of its chunk
+    in a private carry (that row may be shared with the previous thread),
+    all other rows are owned exclusively. The carries are added in the end.
+
+    Arguments
+    ---------
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    n           magma_int_t
+                number of columns in A
+
+    @param[in]
+    nnz         magma_int_t
+                number of nonzeros in A
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    val         magmaDoubleComplex*
+                array containing values of A in COO
+
+    @param[in]
+    rowidx      magma_index_t*
+                row indices of A in COO
+
+    @param[in]
+    col         magma_index_t*
+                columnindices of A in COO
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zgecoomv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *rowidx,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    magmaDoubleComplex *carry = NULL;
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_zmalloc_cpu( &carry, num_threads ));
+
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t i = 0; i < m; i++) {
+        y[i] = beta_is_zero ? MAGMA_Z_ZERO : beta * y[i];
+    }
+
+    #pragma omp parallel num_threads( num_threads )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        magma_int_t lo = (magma_int_t)( ((double) nnz * id) / num_threads );
+        magma_int_t hi = (magma_int_t)( ((double) nnz * (id+1)) / num_threads );
+        magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+        carry[id] = MAGMA_Z_ZERO;
+        if ( lo < hi ) {
+            magma_index_t first = rowidx[lo];
+            magma_index_t current = first;
+            for (magma_int_t j = lo; j < hi; j++) {
+                if ( rowidx[j] != current ) {
+                    if ( current == first )
+                        carry[id] = tmp;
+                    else
+                        y[current] += alpha * tmp;
+                    tmp = MAGMA_Z_ZERO;
+                    current = rowidx[j];
+                }
+                tmp += val[j] * x[ col[j] ];
+            }
+            if ( current == first )
+                carry[id] = tmp;
+            else
+                y[current] += alpha * tmp;
+        }
+    }
+    for (magma_int_t t = 0; t < num_threads; t++) {
+        magma_int_t lo = (magma_int_t)( ((double) nnz * t) / num_threads );
+        magma_int_t hi = (magma_int_t)( ((double) nnz * (t+1)) / num_threads );
+        if ( lo < hi ) {
+            y[ rowidx[lo] ] += alpha * carry[t];
+        }
+    }
+
+cleanup:
+    magma_free_cpu( carry );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host.
+    Input format is BCSR with row-major dense blocks of size
+    blocksize x blocksize, as generated by magma_zmconvert.
+    The block rows are distributed to the threads, the dense blocks are
+    applied with a register-blocked inner product.
+
+    Arguments
+    ---------
+
+    @param[in]
+    m           magma_int_t
+                number of rows in A
+
+    @param[in]
+    n           magma_int_t
+                number of columns in A
+
+    @param[in]
+    blocksize   magma_int_t
+                size of the dense blocks
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    val         magmaDoubleComplex*
+                array containing the blocks of A in BCSR
+
+    @param[in]
+    row         magma_index_t*
+                block row pointer of A in BCSR
+
+    @param[in]
+    col         magma_index_t*
+                block column indices of A in BCSR
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zgebcsrmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t blocksize,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    magma_int_t bs = blocksize;
+    magma_int_t mb = magma_ceildiv( m, bs );
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    if ( bs > MAGMA_SELLP_MAX_BLOCKSIZE ) {
+        return MAGMA_ERR_NOT_SUPPORTED;
+    }
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (magma_int_t ib = 0; ib < mb; ib++) {
+        magmaDoubleComplex tmp[ MAGMA_SELLP_MAX_BLOCKSIZE ];
+        magma_int_t rows = min( bs, m - ib*bs );
+        for (magma_int_t r = 0; r < bs; r++)
+            tmp[r] = MAGMA_Z_ZERO;
+        for (magma_int_t k = row[ib]; k < row[ib+1]; k++) {
+            const magmaDoubleComplex *blk = val + k*bs*bs;
+            magma_int_t jb = col[k] * bs;
+            magma_int_t cols = min( bs, n - jb );
+            for (magma_int_t r = 0; r < rows; r++) {
+                magmaDoubleComplex s = MAGMA_Z_ZERO;
+                for (magma_int_t c = 0; c < cols; c++)
+                    s += blk[ r*bs + c ] * x[ jb + c ];
+                tmp[r] += s;
+            }
+        }
+        for (magma_int_t r = 0; r < rows; r++) {
+            ZAXPBY_ROW( y[ib*bs+r], alpha, tmp[r], beta, beta_is_zero );
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host for the
+    matrix-free stencil operators generated by magma_zm_stencil. The entries
+    of A are computed on the fly, they match the matrices generated by
+    magma_zm_5stencil and magma_zm_27stencil: row r is the grid point
+    r = (z*n + y)*n + x, the neighbors outside the domain in x-direction are
+    omitted, the others are coupled as long as their index is inside the
+    matrix.
+
+    Arguments
+    ---------
+
+    @param[in]
+    points      magma_int_t
+                stencil points: 5 (2D) or 27 (3D, n >= 3)
+
+    @param[in]
+    n           magma_int_t
+                grid points per dimension
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zgestencilmv_cpu(
+    magma_int_t points,
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    magma_int_t nn = n*n;
+    magma_int_t m;
+    magmaDoubleComplex diag, offdiag;
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    if ( points == 5 ) {
+        m = nn;
+        // the values of magma_zm_5stencil
+        diag = MAGMA_Z_MAKE( 4.0, 4.0 );
+        offdiag = MAGMA_Z_MAKE( -1.0, -1.0 );
+    } else if ( points == 27 && n >= 3 ) {
+        m = nn*n;
+        diag = MAGMA_Z_MAKE( 26.0, 0.0 );
+        offdiag = MAGMA_Z_MAKE( -1.0, 0.0 );
+    } else {
+        return MAGMA_ERR_NOT_SUPPORTED;
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t r = 0; r < m; r++) {
+        magma_int_t ix = r % n;
+        magma_int_t lo = ( ix == 0 ) ? 0 : -1;
+        magma_int_t hi = ( ix == n-1 ) ? 0 : 1;
+        magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+        if ( points == 5 ) {
+            if ( lo != 0 )
+                tmp += x[ r-1 ];
+            if ( hi != 0 )
+                tmp += x[ r+1 ];
+            if ( r >= n )
+                tmp += x[ r-n ];
+            if ( r+n < m )
+                tmp += x[ r+n ];
+        } else {
+            for (magma_int_t dz = -1; dz <= 1; dz++) {
+                for (magma_int_t dy = -1; dy <= 1; dy++) {
+                    magma_int_t c = r + dz*nn + dy*n;
+                    for (magma_int_t dx = lo; dx <= hi; dx++) {
+                        if ( c+dx >= 0 && c+dx < m && c+dx != r )
+                            tmp += x[ c+dx ];
+                    }
+                }
+            }
+        }
+        tmp = diag * x[r] + offdiag * tmp;
+        ZAXPBY_ROW( y[r], alpha, tmp, beta, beta_is_zero );
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Helper dispatching one right-hand side to the host kernel matching the
+    storage format of A.
+*/
+static magma_int_t
+magma_z_spmv_cpu_vec(
+    magmaDoubleComplex alpha,
+    magma_z_matrix A,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    if ( A.storage_type == Magma_CSR   ||
+         A.storage_type == Magma_CUCSR ||
+         A.storage_type == Magma_CSRL  ||
+         A.storage_type == Magma_CSRU  ||
+         A.storage_type == Magma_CSRD  ||
+         A.storage_type == Magma_CSRCOO )
+    {
+        CHECK( magma_zgecsrmv_cpu( A.num_rows, A.num_cols, alpha,
+               A.val, A.row, A.col, x, beta, y, queue ));
+    }
+    else if ( A.storage_type == Magma_ELLPACKT ||
+              A.storage_type == Magma_ELLD ) {
+        CHECK( magma_zgeellmv_cpu( A.num_rows, A.num_cols, A.max_nnz_row,
+               alpha, A.val, A.col, x, beta, y, queue ));
+    }
+    else if ( A.storage_type == Magma_ELL ) {
+        CHECK( magma_zgeelltmv_cpu( A.num_rows, A.num_cols, A.max_nnz_row,
+               alpha, A.val, A.col, x, beta, y, queue ));
+    }
+    else if ( A.storage_type == Magma_ELLRT ) {
+        CHECK( magma_zgeellrtmv_cpu( A.num_rows, A.num_cols, A.max_nnz_row,
+               alpha, A.val, A.col, A.row, x, beta, y, A.alignment, queue ));
+    }
+    else if ( A.storage_type == Magma_SELLP ) {
+        CHECK( magma_zgesellpmv_cpu( A.num_rows, A.num_cols,
+               A.blocksize, A.numblocks, alpha, A.val, A.col, A.row,
+               A.sellp_perm, x, beta, y, queue ));
+    }
+    else if ( A.storage_type == Magma_CSR5 ) {
+        CHECK( magma_zgecsr5mv_cpu( A.num_rows, A.num_cols, A.csr5_p,
+               alpha, A.csr5_sigma, A.tile_ptr, A.val, A.row, A.col,
+               x, beta, y, queue ));
+    }
+    else if ( A.storage_type == Magma_COO ) {
+        CHECK( magma_zgecoomv_cpu( A.num_rows, A.num_cols, A.nnz,
+               alpha, A.val, A.row, A.col, x, beta, y, queue ));
+    }
+    else if ( A.storage_type == Magma_BCSR ) {
+        CHECK( magma_zgebcsrmv_cpu( A.num_rows, A.num_cols, A.blocksize,
+               alpha, A.val, A.row, A.col, x, beta, y, queue ));
+    }
+    #if defined(PRECISION_z) || defined(PRECISION_d)
+    else if ( A.storage_type == Magma_CSRMP ) {
+        CHECK( magma_zgecsrmpmv_cpu( alpha, A, x, beta, y, queue ));
+    }
+    #endif
+    else if ( A.storage_type == Magma_STENCIL ) {
+        CHECK( magma_zgestencilmv_cpu( A.stencil_points, A.stencil_grid,
+               alpha, x, beta, y, queue ));
+    }
+    else if ( A.storage_type == Magma_VBCSR ) {
+        CHECK( magma_zgevbcsrmv_cpu( A.num_rows, A.numblocks, alpha,
+               A.val, A.vbcsr_valptr, A.row, A.col, A.blockinfo,
+               x, beta, y, queue ));
+    }
+    else if ( A.storage_type == Magma_DENSE ) {
+        // the host converter generates row-major dense matrices
+        magma_int_t m = A.num_rows, n = A.num_cols, ione = 1;
+        blasf77_zgemv( "Transpose", &n, &m, &alpha, A.val, &n,
+                       x, &ione, &beta, y, &ione );
+    }
+    else {
+        printf("error: format not supported.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+    }
+
+cleanup:
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    For a given input matrix A and vectors x, y and scalars alpha, beta
+    located in host memory, the wrapper determines the suitable host SpMV
+    computing
+              y = alpha * A * x + beta * y.
+    This is called by magma_z_spmv for Magma_CPU data, such that no data
+    is transferred to the device.
+    Multiple vectors are supported for all formats in column-major order,
+    and for CSR and SELL-P in row-major order.
+
+    Arguments
+    ---------
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar alpha
+
+    @param[in]
+    A           magma_z_matrix
+                sparse matrix A
+
+    @param[in]
+    x           magma_z_matrix
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar beta
+
+    @param[out]
+    y           magma_z_matrix
+                output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_z_spmv_cpu(
+    magmaDoubleComplex alpha,
+    magma_z_matrix A,
+    magma_z_matrix x,
+    magmaDoubleComplex beta,
+    magma_z_matrix y,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    if ( A.num_cols == x.num_rows && x.num_cols == 1 ) {
+        CHECK( magma_z_spmv_cpu_vec( alpha, A, x.val, beta, y.val, queue ));
+    }
+    else if ( A.num_cols < x.num_rows || x.num_cols > 1 ) {
+        magma_int_t num_vecs = x.num_rows / A.num_cols * x.num_cols;
+        bool csr = ( A.storage_type == Magma_CSR   ||
+                     A.storage_type == Magma_CUCSR ||
+                     A.storage_type == Magma_CSRL  ||
+                     A.storage_type == Magma_CSRU  ||
+                     A.storage_type == Magma_CSRD  ||
+                     A.storage_type == Magma_CSRCOO );
+        if ( csr ) {
+            CHECK( magma_zmgecsrmv_cpu( x.major, A.num_rows, A.num_cols,
+                   num_vecs, alpha, A.val, A.row, A.col, x.val, beta, y.val,
+                   queue ));
+        }
+        else if ( x.major == MagmaRowMajor && A.storage_type == Magma_SELLP ) {
+            CHECK( magma_zmgesellpmv_cpu( A.num_rows, A.num_cols, num_vecs,
+                   A.blocksize, A.numblocks, alpha, A.val, A.col, A.row,
+                   A.sellp_perm, x.val, beta, y.val, queue ));
+        }
+        else if ( x.major == MagmaColMajor ) {
+            for (magma_int_t v = 0; v < num_vecs; v++) {
+                CHECK( magma_z_spmv_cpu_vec( alpha, A, x.val + v*A.num_cols,
+                       beta, y.val + v*A.num_rows, queue ));
+            }
+        }
+        else {
+            printf("error: format not supported.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+        }
+    }
+    else {
+        printf("error: dimensions do not match.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+    }
+
+cleanup:
+    return info;
+}
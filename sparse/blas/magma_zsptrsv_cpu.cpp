@@ -0,0 +1,419 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @precisions normal z -> c d s
+
+*/
+#include "magmasparse_internal.h"
+#include "magma_bulge.h"  // magma_yield
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// rows of one level set handled as a block by the SIMD kernel
+#define MAGMA_SPTRSV_BLOCK 8
+
+// busy-wait iterations of the sync-free solve before a waiting thread yields
+// its core, e.g., if there are more threads than cores
+#define MAGMA_SPTRSV_SPIN 1024
+
+
+/**
+    Purpose
+    -------
+
+    Level-set analysis of a triangular matrix T in CSR on the host for
+    magma_zsptrsv_levels_cpu and magma_zsptrsv_syncfree_cpu. Row i is in
+    level 1 + max( level(j) ) over all off-diagonal entries T(i,j). The rows
+    are bucket sorted by level, the position of the diagonal is stored per
+    row. Any previous analysis is released.
+    The analysis only depends on the sparsity pattern of T.
+
+    Arguments
+    ---------
+
+    @param[in]
+    uplo        magma_uplo_t
+                MagmaLower or MagmaUpper
+
+    @param[in]
+    T           magma_z_matrix
+                triangular matrix in CSR on the CPU, the diagonal has to be stored;
+                MAGMA_ERR_BADPRECOND is returned otherwise
+
+    @param[out]
+    analysis    magma_sptrsv_info*
+                analysis data
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgepr
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zsptrsv_analysis_cpu(
+    magma_uplo_t uplo,
+    magma_z_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = T.num_rows;
+    magma_int_t missing = 0;
+    magma_index_t *level = NULL;
+
+    if ( T.memory_location != Magma_CPU || T.storage_type != Magma_CSR ) {
+        return MAGMA_ERR_NOT_SUPPORTED;
+    }
+
+    magma_zsptrsv_free_cpu( analysis, queue );
+    analysis->num_rows = n;
+    analysis->uplo = uplo;
+    analysis->epoch = 0;
+
+    CHECK( magma_index_malloc_cpu( &level, n ));
+    CHECK( magma_index_malloc_cpu( &analysis->diag, n ));
+    CHECK( magma_index_malloc_cpu( &analysis->level_rows, n ));
+    CHECK( magma_imalloc_cpu( &analysis->ready, n ));
+
+    // diagonal positions and completion flags are independent per row
+    #pragma omp parallel for reduction(+:missing)
+    for (magma_int_t i=0; i < n; i++) {
+        analysis->diag[i] = -1;
+        analysis->ready[i] = 0;
+        for (magma_int_t k=T.row[i]; k < T.row[i+1]; k++) {
+            if ( T.col[k] == i ) {
+                analysis->diag[i] = k;
+            }
+        }
+        missing += ( analysis->diag[i] == -1 );
+    }
+
+    // the levels are a longest-path computation along the elimination order
+    analysis->num_levels = 0;
+    for (magma_int_t s=0; s < n; s++) {
+        magma_int_t i = ( uplo == MagmaLower ) ? s : n-1-s;
+        magma_index_t l = 0;
+        for (magma_int_t k=T.row[i]; k < T.row[i+1]; k++) {
+            magma_index_t j = T.col[k];
+            if ( ( uplo == MagmaLower && j < i ) || ( uplo == MagmaUpper && j > i ) ) {
+                l = ( level[j]+1 > l ) ? level[j]+1 : l;
+            }
+        }
+        level[i] = l;
+        analysis->num_levels = ( l+1 > analysis->num_levels ) ? l+1 : analysis->num_levels;
+    }
+    if ( missing > 0 ) {
+        info = MAGMA_ERR_BADPRECOND;
+    }
+
+    // bucket sort the rows by level, in elimination order inside a level
+    CHECK( magma_index_malloc_cpu( &analysis->level_ptr, analysis->num_levels+1 ));
+    for (magma_int_t l=0; l < analysis->num_levels+1; l++) {
+        analysis->level_ptr[l] = 0;
+    }
+    for (magma_int_t i=0; i < n; i++) {
+        analysis->level_ptr[level[i]+1]++;
+    }
+    for (magma_int_t l=0; l < analysis->num_levels; l++) {
+        analysis->level_ptr[l+1] += analysis->level_ptr[l];
+    }
+    for (magma_int_t s=0; s < n; s++) {
+        magma_int_t i = ( uplo == MagmaLower ) ? s : n-1-s;
+        analysis->level_rows[ analysis->level_ptr[level[i]]++ ] = i;
+    }
+    for (magma_int_t l=analysis->num_levels; l > 0; l--) {
+        analysis->level_ptr[l] = analysis->level_ptr[l-1];
+    }
+    analysis->level_ptr[0] = 0;
+
+cleanup:
+    magma_free_cpu( level );
+    if ( info != 0 ) {
+        magma_zsptrsv_free_cpu( analysis, queue );
+    }
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Releases the host SpTRSV analysis data.
+
+    Arguments
+    ---------
+
+    @param[in,out]
+    analysis    magma_sptrsv_info*
+                analysis data
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgepr
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zsptrsv_free_cpu(
+    magma_sptrsv_info *analysis,
+    magma_queue_t queue )
+{
+    magma_free_cpu( analysis->level_ptr );
+    magma_free_cpu( analysis->level_rows );
+    magma_free_cpu( analysis->diag );
+    magma_free_cpu( analysis->ready );
+    analysis->level_ptr = NULL;
+    analysis->level_rows = NULL;
+    analysis->diag = NULL;
+    analysis->ready = NULL;
+    analysis->num_rows = 0;
+    analysis->num_levels = 0;
+    analysis->epoch = 0;
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Solves T x = b on the host with level scheduling: the level sets found by
+    magma_zsptrsv_analysis_cpu are processed one after the other, the rows of
+    a level in parallel. Inside a level, blocks of MAGMA_SPTRSV_BLOCK rows are
+    vectorized across the rows.
+
+    Arguments
+    ---------
+
+    @param[in]
+    T           magma_z_matrix
+                triangular matrix in CSR on the CPU
+
+    @param[in]
+    analysis    magma_sptrsv_info*
+                analysis of T
+
+    @param[in]
+    b           magma_z_matrix
+                right-hand side(s) on the CPU
+
+    @param[in,out]
+    x           magma_z_matrix*
+                solution(s) on the CPU, may be the same as b
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgepr
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zsptrsv_levels_cpu(
+    magma_z_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_queue_t queue )
+{
+    magma_int_t n = analysis->num_rows;
+    const magmaDoubleComplex *val = T.val;
+    const magma_index_t *row = T.row, *col = T.col, *diag = analysis->diag;
+    const magma_index_t *level_ptr = analysis->level_ptr;
+    const magma_index_t *level_rows = analysis->level_rows;
+
+    for (magma_int_t v=0; v < b.num_cols; v++) {
+        const magmaDoubleComplex *bv = b.val + v*n;
+        magmaDoubleComplex *xv = x->val + v*n;
+
+        #pragma omp parallel
+        for (magma_int_t l=0; l < analysis->num_levels; l++) {
+            magma_int_t start = level_ptr[l];
+            magma_int_t len = level_ptr[l+1] - start;
+            magma_int_t num_blocks = magma_ceildiv( len, MAGMA_SPTRSV_BLOCK );
+            // implicit barrier: the next level reads the rows of this one
+            #pragma omp for schedule(static)
+            for (magma_int_t blk=0; blk < num_blocks; blk++) {
+                magma_int_t end = ( (blk+1)*MAGMA_SPTRSV_BLOCK < len ) ?
+                    (blk+1)*MAGMA_SPTRSV_BLOCK : len;
+                #pragma omp simd
+                for (magma_int_t r=start+blk*MAGMA_SPTRSV_BLOCK; r < start+end; r++) {
+                    magma_index_t i = level_rows[r];
+                    magmaDoubleComplex s = bv[i];
+                    for (magma_index_t k=row[i]; k < row[i+1]; k++) {
+                        s = ( k == diag[i] ) ? s : s - val[k] * xv[ col[k] ];
+                    }
+                    xv[i] = s / val[ diag[i] ];
+                }
+            }
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Solves T x = b on the host without level barriers. The rows are dealt
+    out to the threads round-robin in elimination order, so all threads work
+    on neighbouring rows at the front of the elimination; with contiguous
+    ranges, all but the first thread would wait for the rows before theirs.
+    A row waits only for the rows it depends on, signalled through
+    completion flags. The flags hold the number of the solve they were set
+    in, so they never need resetting. As the rows of a thread are processed
+    in order and all dependencies point backwards in that order, the waits
+    cannot deadlock.
+
+    Arguments
+    ---------
+
+    @param[in]
+    T           magma_z_matrix
+                triangular matrix in CSR on the CPU
+
+    @param[in,out]
+    analysis    magma_sptrsv_info*
+                analysis of T
+
+    @param[in]
+    b           magma_z_matrix
+                right-hand side(s) on the CPU
+
+    @param[in,out]
+    x           magma_z_matrix*
+                solution(s) on the CPU, may be the same as b
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgepr
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zsptrsv_syncfree_cpu(
+    magma_z_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_queue_t queue )
+{
+    magma_int_t n = analysis->num_rows;
+    magma_int_t lower = ( analysis->uplo == MagmaLower );
+    const magmaDoubleComplex *val = T.val;
+    const magma_index_t *row = T.row, *col = T.col, *diag = analysis->diag;
+    magma_int_t *ready = analysis->ready;
+
+    for (magma_int_t v=0; v < b.num_cols; v++) {
+        const magmaDoubleComplex *bv = b.val + v*n;
+        magmaDoubleComplex *xv = x->val + v*n;
+        if ( analysis->epoch >= (1 << 30) ) {  // start over with clean flags
+            for (magma_int_t i=0; i < n; i++) {
+                ready[i] = 0;
+            }
+            analysis->epoch = 0;
+        }
+        magma_int_t epoch = ++analysis->epoch;
+
+        #pragma omp parallel for schedule(static,1)
+        for (magma_int_t s=0; s < n; s++) {
+            magma_int_t i = lower ? s : n-1-s;
+            magmaDoubleComplex sum = bv[i];
+            for (magma_index_t k=row[i]; k < row[i+1]; k++) {
+                if ( k == diag[i] ) {
+                    continue;
+                }
+                magma_index_t j = col[k];
+                magma_int_t done, spin = 0;
+                while ( true ) {
+                    #pragma omp atomic read
+                    done = ready[j];
+                    if ( done == epoch ) {
+                        break;
+                    }
+                    if ( ++spin == MAGMA_SPTRSV_SPIN ) {
+                        magma_yield();
+                        spin = 0;
+                    }
+                }
+                #pragma omp flush
+                sum -= val[k] * xv[j];
+            }
+            xv[i] = sum / val[ diag[i] ];
+            #pragma omp flush
+            #pragma omp atomic write
+            ready[i] = epoch;
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host triangular solve T x = b using the analysis in analysis. The sync-free
+    variant is used for trisolver == Magma_SYNCFREESOLVE, the level-scheduled
+    one otherwise.
+
+    Arguments
+    ---------
+
+    @param[in]
+    T           magma_z_matrix
+                triangular matrix in CSR on the CPU
+
+    @param[in,out]
+    analysis    magma_sptrsv_info*
+                analysis of T
+
+    @param[in]
+    trisolver   magma_solver_type
+                Magma_SYNCFREESOLVE or any other value for level scheduling
+
+    @param[in]
+    b           magma_z_matrix
+                right-hand side(s) on the CPU
+
+    @param[in,out]
+    x           magma_z_matrix*
+                solution(s) on the CPU
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgepr
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zsptrsv_cpu(
+    magma_z_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_solver_type trisolver,
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_queue_t queue )
+{
+    if ( b.memory_location != Magma_CPU || x->memory_location != Magma_CPU ||
+         analysis->diag == NULL || analysis->num_rows != T.num_rows ) {
+        return MAGMA_ERR_NOT_SUPPORTED;
+    }
+    if ( trisolver == Magma_SYNCFREESOLVE ) {
+        return magma_zsptrsv_syncfree_cpu( T, analysis, b, x, queue );
+    } else {
+        return magma_zsptrsv_levels_cpu( T, analysis, b, x, queue );
+    }
+}
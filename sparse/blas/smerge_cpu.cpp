@@ -0,0 +1,1731 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/blas/zmerge_cpu.cpp, normal z -> s, Fri Oct 16 19:00:18 2026
+
+*/
+#include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// below this vector length the host kernels run single-threaded; this also
+// allows to call the host solvers from inside a parallel loop over many
+// small systems without oversubscribing the cores
+#define MAGMA_CPU_OMP_MIN_SIZE 4096
+
+
+static bool
+magma_s_iscsr( magma_s_matrix A )
+{
+    return ( A.storage_type == Magma_CSR   ||
+             A.storage_type == Magma_CUCSR ||
+             A.storage_type == Magma_CSRL  ||
+             A.storage_type == Magma_CSRU  ||
+             A.storage_type == Magma_CSRD  ||
+             A.storage_type == Magma_CSRCOO );
+}
+
+
+/**
+    Purpose
+    -------
+
+    Computes the dot product conj(x)' * y of two vectors in host memory.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    x           float*
+                vector x
+
+    @param[in]
+    y           float*
+                vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sblas
+    ********************************************************************/
+
+extern "C" float
+magma_sdot_cpu(
+    magma_int_t n,
+    const float *x,
+    const float *y,
+    magma_queue_t queue )
+{
+    float re = 0.0, im = 0.0;
+
+    #pragma omp parallel for reduction(+:re,im) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        float tmp = MAGMA_S_CONJ( x[i] ) * y[i];
+        re += MAGMA_S_REAL( tmp );
+        im += MAGMA_S_IMAG( tmp );
+    }
+    return MAGMA_S_MAKE( re, im );
+}
+
+
+/**
+    Purpose
+    -------
+
+    Computes the Euclidean norm of a vector in host memory.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    x           float*
+                vector x
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sblas
+    ********************************************************************/
+
+extern "C" float
+magma_snrm2_cpu(
+    magma_int_t n,
+    const float *x,
+    magma_queue_t queue )
+{
+    float nrm = 0.0;
+
+    #pragma omp parallel for reduction(+:nrm) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        nrm += MAGMA_S_REAL( MAGMA_S_CONJ( x[i] ) * x[i] );
+    }
+    return sqrt( nrm );
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_scgmerge_spmv1: computes z = A * d and the
+    dot product d' * z. For CSR matrices, both operations are fused into
+    one pass over the matrix.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                system matrix in host memory
+
+    @param[in]
+    d           float*
+                input vector d
+
+    @param[out]
+    z           float*
+                output vector z = A * d
+
+    @param[out]
+    dz          float*
+                dot product d' * z
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_scgmerge_spmv1_cpu(
+    magma_s_matrix A,
+    const float *d,
+    float *z,
+    float *dz,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+
+    if ( magma_s_iscsr( A ) ) {
+        float re = 0.0, im = 0.0;
+        #pragma omp parallel for schedule(dynamic, 256) reduction(+:re,im) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+        for (magma_int_t i = 0; i < n; i++) {
+            float tmp = MAGMA_S_ZERO;
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                tmp += A.val[j] * d[ A.col[j] ];
+            }
+            z[i] = tmp;
+            tmp = MAGMA_S_CONJ( d[i] ) * tmp;
+            re += MAGMA_S_REAL( tmp );
+            im += MAGMA_S_IMAG( tmp );
+        }
+        *dz = MAGMA_S_MAKE( re, im );
+    } else {
+        magma_s_matrix vd={Magma_CSR}, vz={Magma_CSR};
+        CHECK( magma_svset( n, 1, (float*) d, &vd, queue ));
+        CHECK( magma_svset( n, 1, z, &vz, queue ));
+        CHECK( magma_s_spmv_cpu( MAGMA_S_ONE, A, vd, MAGMA_S_ZERO, vz, queue ));
+        *dz = magma_sdot_cpu( n, d, z, queue );
+    }
+
+cleanup:
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_scgmerge_xrbeta: performs the CG updates
+        x = x + alpha * d
+        r = r - alpha * z
+        rr_new = r' * r
+        d = r + rr_new / rr_old * d
+    in one parallel region. The static schedule makes every thread revisit
+    the same chunk of the vectors in the second sweep.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    alpha       float
+                step length
+
+    @param[in,out]
+    x           float*
+                solution approximation
+
+    @param[in,out]
+    r           float*
+                residual
+
+    @param[in,out]
+    d           float*
+                search direction
+
+    @param[in]
+    z           float*
+                z = A * d
+
+    @param[in,out]
+    rr          float*
+                on entry r' * r of the previous iteration,
+                on exit r' * r of the updated residual
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_scgmerge_xrbeta_cpu(
+    magma_int_t n,
+    float alpha,
+    float *x,
+    float *r,
+    float *d,
+    const float *z,
+    float *rr,
+    magma_queue_t queue )
+{
+    float rr_old = *rr, rr_new = 0.0;
+
+    #pragma omp parallel if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        #pragma omp for schedule(static) reduction(+:rr_new)
+        for (magma_int_t i = 0; i < n; i++) {
+            x[i] = x[i] + alpha * d[i];
+            r[i] = r[i] - alpha * z[i];
+            rr_new += MAGMA_S_REAL( MAGMA_S_CONJ( r[i] ) * r[i] );
+        }
+        float beta = MAGMA_S_MAKE( rr_new / rr_old, 0.0 );
+        #pragma omp for schedule(static)
+        for (magma_int_t i = 0; i < n; i++) {
+            d[i] = r[i] + beta * d[i];
+        }
+    }
+    *rr = rr_new;
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_sbicgstab_1:
+        p = r + beta * ( p - omega * v )
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    beta        float
+                scalar
+
+    @param[in]
+    omega       float
+                scalar
+
+    @param[in]
+    r           float*
+                vector
+
+    @param[in]
+    v           float*
+                vector
+
+    @param[in,out]
+    p           float*
+                input/output vector
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbicgstab_1_cpu(
+    magma_int_t n,
+    float beta,
+    float omega,
+    const float *r,
+    const float *v,
+    float *p,
+    magma_queue_t queue )
+{
+    #pragma omp parallel for simd schedule(static) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        p[i] = r[i] + beta * ( p[i] - omega * v[i] );
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_sbicgmerge_spmv1: computes v = A * p and the
+    dot product rr' * v, fused into one pass for CSR matrices.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                system matrix in host memory
+
+    @param[in]
+    rr          float*
+                shadow residual
+
+    @param[in]
+    p           float*
+                input vector p
+
+    @param[out]
+    v           float*
+                output vector v = A * p
+
+    @param[out]
+    rrv         float*
+                dot product rr' * v
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbicgmerge_spmv1_cpu(
+    magma_s_matrix A,
+    const float *rr,
+    const float *p,
+    float *v,
+    float *rrv,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+
+    if ( magma_s_iscsr( A ) ) {
+        float re = 0.0, im = 0.0;
+        #pragma omp parallel for schedule(dynamic, 256) reduction(+:re,im) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+        for (magma_int_t i = 0; i < n; i++) {
+            float tmp = MAGMA_S_ZERO;
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                tmp += A.val[j] * p[ A.col[j] ];
+            }
+            v[i] = tmp;
+            tmp = MAGMA_S_CONJ( rr[i] ) * tmp;
+            re += MAGMA_S_REAL( tmp );
+            im += MAGMA_S_IMAG( tmp );
+        }
+        *rrv = MAGMA_S_MAKE( re, im );
+    } else {
+        magma_s_matrix vp={Magma_CSR}, vv={Magma_CSR};
+        CHECK( magma_svset( n, 1, (float*) p, &vp, queue ));
+        CHECK( magma_svset( n, 1, v, &vv, queue ));
+        CHECK( magma_s_spmv_cpu( MAGMA_S_ONE, A, vp, MAGMA_S_ZERO, vv, queue ));
+        *rrv = magma_sdot_cpu( n, rr, v, queue );
+    }
+
+cleanup:
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_sbicgstab_2:
+        s = r - alpha * v
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    alpha       float
+                scalar
+
+    @param[in]
+    r           float*
+                vector
+
+    @param[in]
+    v           float*
+                vector
+
+    @param[out]
+    s           float*
+                output vector
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbicgstab_2_cpu(
+    magma_int_t n,
+    float alpha,
+    const float *r,
+    const float *v,
+    float *s,
+    magma_queue_t queue )
+{
+    #pragma omp parallel for simd schedule(static) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        s[i] = r[i] - alpha * v[i];
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_sbicgmerge_spmv2: computes t = A * s and the
+    dot products t' * s and t' * t, fused into one pass for CSR matrices.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                system matrix in host memory
+
+    @param[in]
+    s           float*
+                input vector s
+
+    @param[out]
+    t           float*
+                output vector t = A * s
+
+    @param[out]
+    ts          float*
+                dot product t' * s
+
+    @param[out]
+    tt          float*
+                dot product t' * t
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbicgmerge_spmv2_cpu(
+    magma_s_matrix A,
+    const float *s,
+    float *t,
+    float *ts,
+    float *tt,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+
+    if ( magma_s_iscsr( A ) ) {
+        float re = 0.0, im = 0.0, nrm = 0.0;
+        #pragma omp parallel for schedule(dynamic, 256) reduction(+:re,im,nrm) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+        for (magma_int_t i = 0; i < n; i++) {
+            float tmp = MAGMA_S_ZERO;
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                tmp += A.val[j] * s[ A.col[j] ];
+            }
+            t[i] = tmp;
+            nrm += MAGMA_S_REAL( MAGMA_S_CONJ( tmp ) * tmp );
+            tmp = MAGMA_S_CONJ( tmp ) * s[i];
+            re += MAGMA_S_REAL( tmp );
+            im += MAGMA_S_IMAG( tmp );
+        }
+        *ts = MAGMA_S_MAKE( re, im );
+        *tt = MAGMA_S_MAKE( nrm, 0.0 );
+    } else {
+        magma_s_matrix vs={Magma_CSR}, vt={Magma_CSR};
+        CHECK( magma_svset( n, 1, (float*) s, &vs, queue ));
+        CHECK( magma_svset( n, 1, t, &vt, queue ));
+        CHECK( magma_s_spmv_cpu( MAGMA_S_ONE, A, vs, MAGMA_S_ZERO, vt, queue ));
+        *ts = magma_sdot_cpu( n, t, s, queue );
+        *tt = magma_sdot_cpu( n, t, t, queue );
+    }
+
+cleanup:
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_sbicgstab_3, fused with the reductions needed
+    in the next iteration:
+        x = x + alpha * p + omega * s
+        r = s - omega * t
+        rho = rr' * r
+        nrm = r' * r
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    alpha       float
+                scalar
+
+    @param[in]
+    omega       float
+                scalar
+
+    @param[in]
+    p           float*
+                vector
+
+    @param[in]
+    s           float*
+                vector
+
+    @param[in]
+    t           float*
+                vector
+
+    @param[in]
+    rr          float*
+                shadow residual
+
+    @param[in,out]
+    x           float*
+                solution approximation
+
+    @param[out]
+    r           float*
+                residual
+
+    @param[out]
+    rho         float*
+                dot product rr' * r
+
+    @param[out]
+    nrm         float*
+                dot product r' * r
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbicgstab_3_cpu(
+    magma_int_t n,
+    float alpha,
+    float omega,
+    const float *p,
+    const float *s,
+    const float *t,
+    const float *rr,
+    float *x,
+    float *r,
+    float *rho,
+    float *nrm,
+    magma_queue_t queue )
+{
+    float re = 0.0, im = 0.0, rnrm = 0.0;
+
+    #pragma omp parallel for schedule(static) reduction(+:re,im,rnrm) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        x[i] = x[i] + alpha * p[i] + omega * s[i];
+        float ri = s[i] - omega * t[i];
+        r[i] = ri;
+        rnrm += MAGMA_S_REAL( MAGMA_S_CONJ( ri ) * ri );
+        float tmp = MAGMA_S_CONJ( rr[i] ) * ri;
+        re += MAGMA_S_REAL( tmp );
+        im += MAGMA_S_IMAG( tmp );
+    }
+    *rho = MAGMA_S_MAKE( re, im );
+    *nrm = rnrm;
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_smdotc: computes the k dot products
+        h[j] = V(j)' * w,    j = 0, ..., k-1
+    in one sweep over w. V is a column-major block of k vectors with
+    leading dimension ldv.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    k           magma_int_t
+                number of vectors in V
+
+    @param[in]
+    V           float*
+                block of vectors
+
+    @param[in]
+    ldv         magma_int_t
+                leading dimension of V
+
+    @param[in]
+    w           float*
+                vector
+
+    @param[out]
+    h           float*
+                array of size k containing the dot products
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_smdotc_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const float *V,
+    magma_int_t ldv,
+    const float *w,
+    float *h,
+    magma_queue_t queue )
+{
+    for (magma_int_t j = 0; j < k; j++) {
+        h[j] = MAGMA_S_ZERO;
+    }
+
+    #pragma omp parallel if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        // every thread accumulates k partial sums over its rows,
+        // blocking the rows keeps w in cache for all k vectors
+        const magma_int_t nb = 512;
+        float part[64];
+        for (magma_int_t j0 = 0; j0 < k; j0 += 64) {
+            magma_int_t kb = min( (magma_int_t) 64, k - j0 );
+            for (magma_int_t j = 0; j < kb; j++) {
+                part[j] = MAGMA_S_ZERO;
+            }
+            #pragma omp for schedule(static) nowait
+            for (magma_int_t i0 = 0; i0 < n; i0 += nb) {
+                magma_int_t ib = min( nb, n - i0 );
+                for (magma_int_t j = 0; j < kb; j++) {
+                    const float *vj = V + (j0+j)*ldv + i0;
+                    float tmp = MAGMA_S_ZERO;
+                    for (magma_int_t i = 0; i < ib; i++) {
+                        tmp += MAGMA_S_CONJ( vj[i] ) * w[i0+i];
+                    }
+                    part[j] += tmp;
+                }
+            }
+            #pragma omp critical
+            {
+                for (magma_int_t j = 0; j < kb; j++) {
+                    h[j0+j] += part[j];
+                }
+            }
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Computes w = w - V * h for a column-major block V of k vectors in one
+    sweep over w. If nrm is not NULL, the squared norm of the updated w is
+    returned in nrm.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    k           magma_int_t
+                number of vectors in V
+
+    @param[in]
+    V           float*
+                block of vectors
+
+    @param[in]
+    ldv         magma_int_t
+                leading dimension of V
+
+    @param[in]
+    h           float*
+                array of size k containing the coefficients
+
+    @param[in,out]
+    w           float*
+                vector
+
+    @param[out]
+    nrm         float*
+                squared norm of the updated w (optional)
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_smaxpy_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const float *V,
+    magma_int_t ldv,
+    const float *h,
+    float *w,
+    float *nrm,
+    magma_queue_t queue )
+{
+    float wnrm = 0.0;
+
+    #pragma omp parallel for schedule(static) reduction(+:wnrm) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        float tmp = w[i];
+        for (magma_int_t j = 0; j < k; j++) {
+            tmp -= h[j] * V[ j*ldv + i ];
+        }
+        w[i] = tmp;
+        wnrm += MAGMA_S_REAL( MAGMA_S_CONJ( tmp ) * tmp );
+    }
+    if ( nrm != NULL ) {
+        *nrm = wnrm;
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    SpMV of the host Chronopoulos-Gear CG: computes w = A * r together with
+    the two inner products r' * r and r' * w the next iteration needs. For
+    CSR matrices, all three are formed in one pass over the matrix, such
+    that the iteration needs a single global reduction.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                system matrix in host memory
+
+    @param[in]
+    r           float*
+                residual
+
+    @param[out]
+    w           float*
+                output vector w = A * r
+
+    @param[out]
+    rr          float*
+                r' * r
+
+    @param[out]
+    rw          float*
+                real part of r' * w
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_scacg_spmv_cpu(
+    magma_s_matrix A,
+    const float *r,
+    float *w,
+    float *rr,
+    float *rw,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+    float rr_loc = 0.0, rw_loc = 0.0;
+
+    if ( magma_s_iscsr( A ) ) {
+        #pragma omp parallel for schedule(dynamic, 256) reduction(+:rr_loc,rw_loc) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+        for (magma_int_t i = 0; i < n; i++) {
+            float tmp = MAGMA_S_ZERO;
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                tmp += A.val[j] * r[ A.col[j] ];
+            }
+            w[i] = tmp;
+            rr_loc += MAGMA_S_REAL( MAGMA_S_CONJ( r[i] ) * r[i] );
+            rw_loc += MAGMA_S_REAL( MAGMA_S_CONJ( r[i] ) * tmp );
+        }
+    } else {
+        magma_s_matrix vr={Magma_CSR}, vw={Magma_CSR};
+        CHECK( magma_svset( n, 1, (float*) r, &vr, queue ));
+        CHECK( magma_svset( n, 1, w, &vw, queue ));
+        CHECK( magma_s_spmv_cpu( MAGMA_S_ONE, A, vr, MAGMA_S_ZERO, vw, queue ));
+        #pragma omp parallel for schedule(static) reduction(+:rr_loc,rw_loc) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+        for (magma_int_t i = 0; i < n; i++) {
+            rr_loc += MAGMA_S_REAL( MAGMA_S_CONJ( r[i] ) * r[i] );
+            rw_loc += MAGMA_S_REAL( MAGMA_S_CONJ( r[i] ) * w[i] );
+        }
+    }
+    *rr = rr_loc;
+    *rw = rw_loc;
+
+cleanup:
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Vector updates of the host Chronopoulos-Gear CG:
+        p = r + beta * p
+        s = w + beta * s
+        x = x + alpha * p
+        r = r - alpha * s
+    in one sweep without any reduction.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    alpha       float
+                step length
+
+    @param[in]
+    beta        float
+                direction update
+
+    @param[in,out]
+    x           float*
+                solution approximation
+
+    @param[in,out]
+    r           float*
+                residual
+
+    @param[in,out]
+    p           float*
+                search direction
+
+    @param[in,out]
+    s           float*
+                s = A * p
+
+    @param[in]
+    w           float*
+                w = A * r
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_scacg_update_cpu(
+    magma_int_t n,
+    float alpha,
+    float beta,
+    float *x,
+    float *r,
+    float *p,
+    float *s,
+    const float *w,
+    magma_queue_t queue )
+{
+    float za = MAGMA_S_MAKE( alpha, 0.0 );
+    float zb = MAGMA_S_MAKE( beta, 0.0 );
+
+    #pragma omp parallel for simd schedule(static) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        float pi = r[i] + zb * p[i];
+        float si = w[i] + zb * s[i];
+        p[i] = pi;
+        s[i] = si;
+        x[i] = x[i] + za * pi;
+        r[i] = r[i] - za * si;
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    SpMV of the host pipelined GMRES: computes w = A * z and, in the same
+    sweep, the inner products
+        h[j] = V(j)' * z,    j = 0, ..., k-1,
+        nrm  = z' * z.
+    The reduction for the orthogonalization of z does not depend on w,
+    so it is overlapped with the SpMV instead of following it. If w is
+    NULL, only the inner products are computed.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                system matrix in host memory
+
+    @param[in]
+    k           magma_int_t
+                number of vectors in V
+
+    @param[in]
+    V           float*
+                block of vectors
+
+    @param[in]
+    ldv         magma_int_t
+                leading dimension of V
+
+    @param[in]
+    z           float*
+                input vector z
+
+    @param[out]
+    w           float*
+                output vector w = A * z (optional)
+
+    @param[out]
+    h           float*
+                array of size k containing the inner products
+
+    @param[out]
+    nrm         float*
+                squared norm of z
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_spipegmres_spmv_cpu(
+    magma_s_matrix A,
+    magma_int_t k,
+    const float *V,
+    magma_int_t ldv,
+    const float *z,
+    float *w,
+    float *h,
+    float *nrm,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+    magma_int_t num_threads = 1;
+    float *part = NULL;
+    float znrm = 0.0;
+    bool fused = ( w != NULL && magma_s_iscsr( A ) );
+
+    if ( w != NULL && ! fused ) {
+        magma_s_matrix vz={Magma_CSR}, vw={Magma_CSR};
+        CHECK( magma_svset( n, 1, (float*) z, &vz, queue ));
+        CHECK( magma_svset( n, 1, w, &vw, queue ));
+        CHECK( magma_s_spmv_cpu( MAGMA_S_ONE, A, vz, MAGMA_S_ZERO, vw, queue ));
+    }
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_smalloc_cpu( &part, num_threads * (k+1) ));
+    for (magma_int_t j = 0; j < k; j++) {
+        h[j] = MAGMA_S_ZERO;
+    }
+
+    #pragma omp parallel num_threads( num_threads ) reduction(+:znrm) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        // the rows are processed in blocks, the SpMV of a block is
+        // followed by the k inner products while the block of z is in cache
+        const magma_int_t nb = 512;
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        float *hp = part + id * (k+1);
+        for (magma_int_t j = 0; j < k; j++) {
+            hp[j] = MAGMA_S_ZERO;
+        }
+        #pragma omp for schedule(static) nowait
+        for (magma_int_t i0 = 0; i0 < n; i0 += nb) {
+            magma_int_t ib = min( nb, n - i0 );
+            if ( fused ) {
+                for (magma_int_t i = i0; i < i0+ib; i++) {
+                    float tmp = MAGMA_S_ZERO;
+                    for (magma_int_t l = A.row[i]; l < A.row[i+1]; l++) {
+                        tmp += A.val[l] * z[ A.col[l] ];
+                    }
+                    w[i] = tmp;
+                }
+            }
+            for (magma_int_t i = i0; i < i0+ib; i++) {
+                znrm += MAGMA_S_REAL( MAGMA_S_CONJ( z[i] ) * z[i] );
+            }
+            for (magma_int_t j = 0; j < k; j++) {
+                const float *vj = V + j*ldv;
+                float tmp = MAGMA_S_ZERO;
+                for (magma_int_t i = i0; i < i0+ib; i++) {
+                    tmp += MAGMA_S_CONJ( vj[i] ) * z[i];
+                }
+                hp[j] += tmp;
+            }
+        }
+        #pragma omp critical
+        {
+            for (magma_int_t j = 0; j < k; j++) {
+                h[j] += hp[j];
+            }
+        }
+    }
+    *nrm = znrm;
+
+cleanup:
+    magma_free_cpu( part );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Basis update of the host pipelined GMRES. With the inner products h of
+    z = A * V(k-1) against V(0:k-1) and eta = H(k,k-1), computes
+        v = ( z - V * h ) / eta
+        y = ( w - Z * h ) / eta
+    in one sweep, where Z(j) = A * V(j) and w = A * z, i.e. v is the next
+    basis vector and y = A * v. If w is NULL, only v is computed.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    k           magma_int_t
+                number of vectors in V and Z
+
+    @param[in]
+    V           float*
+                orthonormal basis
+
+    @param[in]
+    Z           float*
+                block of vectors A * V
+
+    @param[in]
+    ldv         magma_int_t
+                leading dimension of V and Z
+
+    @param[in]
+    h           float*
+                array of size k containing the coefficients
+
+    @param[in]
+    eta         float
+                norm of the orthogonalized z
+
+    @param[in]
+    z           float*
+                vector z
+
+    @param[in]
+    w           float*
+                vector w = A * z (optional)
+
+    @param[out]
+    v           float*
+                next basis vector
+
+    @param[out]
+    y           float*
+                A times the next basis vector (optional)
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_spipegmres_update_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const float *V,
+    const float *Z,
+    magma_int_t ldv,
+    const float *h,
+    float eta,
+    const float *z,
+    const float *w,
+    float *v,
+    float *y,
+    magma_queue_t queue )
+{
+    float scal = MAGMA_S_MAKE( 1.0 / eta, 0.0 );
+
+    #pragma omp parallel for schedule(static) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        float tv = z[i];
+        for (magma_int_t j = 0; j < k; j++) {
+            tv -= h[j] * V[ j*ldv + i ];
+        }
+        v[i] = scal * tv;
+        if ( w != NULL ) {
+            float ty = w[i];
+            for (magma_int_t j = 0; j < k; j++) {
+                ty -= h[j] * Z[ j*ldv + i ];
+            }
+            y[i] = scal * ty;
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    SpMV of the host block CG: computes Q = A * P for a block of nv vectors
+    and the nv inner products den[v] = P(:,v)' * Q(:,v). P and Q are stored
+    row-major, i.e., the nv entries of a row are contiguous, such that every
+    entry of A is read once for all vectors. For CSR matrices, the inner
+    products are formed in the same pass.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                system matrix in host memory
+
+    @param[in]
+    nv          magma_int_t
+                number of vectors
+
+    @param[in]
+    P           float*
+                row-major block of nv vectors
+
+    @param[out]
+    Q           float*
+                row-major output block Q = A * P
+
+    @param[out]
+    den         float*
+                array of size nv containing P(:,v)' * Q(:,v)
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbcgmerge_spmv_cpu(
+    magma_s_matrix A,
+    magma_int_t nv,
+    const float *P,
+    float *Q,
+    float *den,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+    magma_int_t num_threads = 1;
+    float *part = NULL;
+    bool fused = magma_s_iscsr( A );
+
+    if ( ! fused ) {
+        magma_s_matrix vp={Magma_CSR}, vq={Magma_CSR};
+        CHECK( magma_svset( n, nv, (float*) P, &vp, queue ));
+        CHECK( magma_svset( n, nv, Q, &vq, queue ));
+        vp.major = MagmaRowMajor;
+        vq.major = MagmaRowMajor;
+        CHECK( magma_s_spmv_cpu( MAGMA_S_ONE, A, vp, MAGMA_S_ZERO, vq, queue ));
+    }
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_smalloc_cpu( &part, num_threads * nv ));
+    for (magma_int_t v = 0; v < nv; v++) {
+        den[v] = MAGMA_S_ZERO;
+    }
+
+    #pragma omp parallel num_threads( num_threads ) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        float *dp = part + id * nv;
+        for (magma_int_t v = 0; v < nv; v++) {
+            dp[v] = MAGMA_S_ZERO;
+        }
+        #pragma omp for schedule(dynamic, 256) nowait
+        for (magma_int_t i = 0; i < n; i++) {
+            const float *pi = P + i*nv;
+            float *qi = Q + i*nv;
+            if ( fused ) {
+                for (magma_int_t v = 0; v < nv; v++) {
+                    qi[v] = MAGMA_S_ZERO;
+                }
+                for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                    float a = A.val[j];
+                    const float *pj = P + A.col[j]*nv;
+                    #pragma omp simd
+                    for (magma_int_t v = 0; v < nv; v++) {
+                        qi[v] += a * pj[v];
+                    }
+                }
+            }
+            for (magma_int_t v = 0; v < nv; v++) {
+                dp[v] += MAGMA_S_CONJ( pi[v] ) * qi[v];
+            }
+        }
+        #pragma omp critical
+        {
+            for (magma_int_t v = 0; v < nv; v++) {
+                den[v] += dp[v];
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( part );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Vector updates of the host block CG. For the row-major blocks of nv
+    vectors, computes
+
+        X(:,v) = X(:,v) + alpha[v] * P(:,v)
+        R(:,v) = R(:,v) - alpha[v] * Q(:,v)
+        rr[v]  = R(:,v)' * R(:,v)
+
+    in one sweep.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    nv          magma_int_t
+                number of vectors
+
+    @param[in]
+    alpha       float*
+                array of size nv containing the step lengths
+
+    @param[in,out]
+    X           float*
+                solution block
+
+    @param[in,out]
+    R           float*
+                residual block
+
+    @param[in]
+    P           float*
+                search directions
+
+    @param[in]
+    Q           float*
+                Q = A * P
+
+    @param[out]
+    rr          float*
+                array of size nv containing the squared residual norms
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbcgmerge_xr_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    const float *alpha,
+    float *X,
+    float *R,
+    const float *P,
+    const float *Q,
+    float *rr,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    float *part = NULL;
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_smalloc_cpu( &part, num_threads * nv ));
+    for (magma_int_t v = 0; v < nv; v++) {
+        rr[v] = 0.0;
+    }
+
+    #pragma omp parallel num_threads( num_threads ) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        float *rp = part + id * nv;
+        for (magma_int_t v = 0; v < nv; v++) {
+            rp[v] = 0.0;
+        }
+        #pragma omp for schedule(static) nowait
+        for (magma_int_t i = 0; i < n; i++) {
+            for (magma_int_t v = 0; v < nv; v++) {
+                magma_int_t l = i*nv + v;
+                X[l] = X[l] + alpha[v] * P[l];
+                R[l] = R[l] - alpha[v] * Q[l];
+                rp[v] += MAGMA_S_REAL( MAGMA_S_CONJ( R[l] ) * R[l] );
+            }
+        }
+        #pragma omp critical
+        {
+            for (magma_int_t v = 0; v < nv; v++) {
+                rr[v] += rp[v];
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( part );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Block version of magma_smdotc_cpu for nv independent right-hand sides.
+    V holds k row-major blocks of nv vectors with leading dimension ldv
+    between the blocks, W is a row-major block of nv vectors. Computes
+
+        h[j*nv+v] = V_j(:,v)' * W(:,v),    j = 0, ..., k-1
+
+    in one sweep over W.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    nv          magma_int_t
+                number of vectors per block
+
+    @param[in]
+    k           magma_int_t
+                number of blocks in V
+
+    @param[in]
+    V           float*
+                blocks of vectors
+
+    @param[in]
+    ldv         magma_int_t
+                distance between the blocks of V
+
+    @param[in]
+    W           float*
+                block of vectors
+
+    @param[out]
+    h           float*
+                array of size k*nv containing the dot products
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbmdotc_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const float *V,
+    magma_int_t ldv,
+    const float *W,
+    float *h,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    float *part = NULL;
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_smalloc_cpu( &part, num_threads * k * nv ));
+    for (magma_int_t l = 0; l < k*nv; l++) {
+        h[l] = MAGMA_S_ZERO;
+    }
+
+    #pragma omp parallel num_threads( num_threads ) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        float *hp = part + id * k * nv;
+        for (magma_int_t l = 0; l < k*nv; l++) {
+            hp[l] = MAGMA_S_ZERO;
+        }
+        #pragma omp for schedule(static) nowait
+        for (magma_int_t i = 0; i < n; i++) {
+            const float *wi = W + i*nv;
+            for (magma_int_t j = 0; j < k; j++) {
+                const float *vji = V + j*ldv + i*nv;
+                for (magma_int_t v = 0; v < nv; v++) {
+                    hp[ j*nv+v ] += MAGMA_S_CONJ( vji[v] ) * wi[v];
+                }
+            }
+        }
+        #pragma omp critical
+        {
+            for (magma_int_t l = 0; l < k*nv; l++) {
+                h[l] += hp[l];
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( part );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Block version of magma_smaxpy_cpu for nv independent right-hand sides:
+    computes W(:,v) = W(:,v) - sum_j h[j*nv+v] * V_j(:,v) in one sweep over
+    W, with the layout of magma_sbmdotc_cpu. If nrm is not NULL, the squared
+    norms of the updated vectors are returned in nrm. With k = 0, this only
+    computes the norms.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    nv          magma_int_t
+                number of vectors per block
+
+    @param[in]
+    k           magma_int_t
+                number of blocks in V
+
+    @param[in]
+    V           float*
+                blocks of vectors
+
+    @param[in]
+    ldv         magma_int_t
+                distance between the blocks of V
+
+    @param[in]
+    h           float*
+                array of size k*nv containing the coefficients
+
+    @param[in,out]
+    W           float*
+                block of vectors
+
+    @param[out]
+    nrm         float*
+                array of size nv containing the squared norms (optional)
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbmaxpy_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const float *V,
+    magma_int_t ldv,
+    const float *h,
+    float *W,
+    float *nrm,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    float *part = NULL;
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_smalloc_cpu( &part, num_threads * nv ));
+    for (magma_int_t v = 0; nrm != NULL && v < nv; v++) {
+        nrm[v] = 0.0;
+    }
+
+    #pragma omp parallel num_threads( num_threads ) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        float *np = part + id * nv;
+        for (magma_int_t v = 0; v < nv; v++) {
+            np[v] = 0.0;
+        }
+        #pragma omp for schedule(static) nowait
+        for (magma_int_t i = 0; i < n; i++) {
+            float *wi = W + i*nv;
+            for (magma_int_t j = 0; j < k; j++) {
+                const float *vji = V + j*ldv + i*nv;
+                for (magma_int_t v = 0; v < nv; v++) {
+                    wi[v] -= h[ j*nv+v ] * vji[v];
+                }
+            }
+            for (magma_int_t v = 0; v < nv; v++) {
+                np[v] += MAGMA_S_REAL( MAGMA_S_CONJ( wi[v] ) * wi[v] );
+            }
+        }
+        if ( nrm != NULL ) {
+            #pragma omp critical
+            {
+                for (magma_int_t v = 0; v < nv; v++) {
+                    nrm[v] += np[v];
+                }
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( part );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Removes vectors from a row-major block of nv vectors: on exit, X is a
+    row-major block of the nk vectors keep[0], ..., keep[nk-1], in this
+    order. Used by the host block solvers to deflate converged right-hand
+    sides, such that the remaining vectors stay contiguous.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    nv          magma_int_t
+                number of vectors on entry
+
+    @param[in]
+    nk          magma_int_t
+                number of vectors to keep
+
+    @param[in]
+    keep        magma_int_t*
+                array of size nk containing the vectors to keep
+
+    @param[in,out]
+    X           float*
+                block of vectors
+
+    @param[out]
+    work        float*
+                workspace of size n*nk
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbcompact_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t nk,
+    const magma_int_t *keep,
+    float *X,
+    float *work,
+    magma_queue_t queue )
+{
+    #pragma omp parallel if( n*nv > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        #pragma omp for schedule(static)
+        for (magma_int_t i = 0; i < n; i++) {
+            for (magma_int_t v = 0; v < nk; v++) {
+                work[ i*nk+v ] = X[ i*nv+keep[v] ];
+            }
+        }
+        #pragma omp for schedule(static)
+        for (magma_int_t l = 0; l < n*nk; l++) {
+            X[l] = work[l];
+        }
+    }
+    return MAGMA_SUCCESS;
+}
@@ -0,0 +1,426 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @precisions mixed zc -> ds
+
+*/
+#include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+#define PRECISION_z
+
+// number of rows sharing one base column for the 16-bit column offsets
+#define MAGMA_MP_BLOCKSIZE 64
+
+// largest column span a row block may have to use 16-bit offsets
+#define MAGMA_MP_MAX_SPAN 65535
+
+
+/**
+    Conversion between single precision and the IEEE half precision format,
+    with round-to-nearest-even. The half values are kept as raw 16-bit
+    patterns, such that no compiler support for FP16 is needed. If the CPU
+    provides F16C, the decoding uses the hardware instruction.
+*/
+static inline unsigned short
+magma_float_to_half( float f )
+{
+    union { float f; unsigned int u; } v;
+    v.f = f;
+    unsigned int sign = (v.u >> 16) & 0x8000;
+    unsigned int a = v.u & 0x7fffffff;
+    unsigned int h;
+
+    if ( a >= 0x7f800000 ) {                    // Inf or NaN
+        h = ( a > 0x7f800000 ) ? 0x7e00 : 0x7c00;
+    } else if ( a >= 0x477ff000 ) {             // rounds beyond 65504
+        h = 0x7c00;
+    } else if ( a < 0x38800000 ) {              // subnormal half or zero
+        v.u = a;
+        h = (unsigned int) nearbyintf( v.f * 16777216.0f );
+    } else {
+        unsigned int m = a & 0x7fffff;
+        unsigned int rem = m & 0x1fff;
+        h = ( ((a >> 23) - 112) << 10 ) | ( m >> 13 );
+        if ( rem > 0x1000 || ( rem == 0x1000 && (h & 1) ) ) {
+            h++;                                // may carry into the exponent
+        }
+    }
+    return (unsigned short) ( sign | h );
+}
+
+static inline float
+magma_half_to_float( unsigned short h )
+{
+#if defined(__F16C__)
+    return _cvtsh_ss( h );
+#else
+    union { unsigned int u; float f; } v;
+    unsigned int em = h & 0x7fff;
+    v.u = em << 13;
+    v.f *= 5.192296858534828e+33f;              // 2^112 rebiases the exponent
+    if ( em >= 0x7c00 ) {
+        v.u = (em << 13) | 0x7f800000;          // Inf or NaN
+    }
+    v.u |= (unsigned int) (h & 0x8000) << 16;
+    return v.f;
+#endif
+}
+
+
+/**
+    Decodes the k-th value of the low precision storage of a CSRMP matrix.
+*/
+static inline magmaDoubleComplex
+magma_zmp_decode( const magmaFloatComplex *val, magma_int_t k )
+{
+    return MAGMA_Z_MAKE( (double) MAGMA_C_REAL( val[k] ),
+                         (double) MAGMA_C_IMAG( val[k] ) );
+}
+
+static inline magmaDoubleComplex
+magma_zmp_decode( const unsigned short *val, magma_int_t k )
+{
+#if defined(PRECISION_z)
+    return MAGMA_Z_MAKE( (double) magma_half_to_float( val[2*k] ),
+                         (double) magma_half_to_float( val[2*k+1] ) );
+#else
+    return MAGMA_Z_MAKE( (double) magma_half_to_float( val[k] ), 0.0 );
+#endif
+}
+
+static inline void
+magma_zmp_encode( magmaFloatComplex *val, magma_int_t k, magmaDoubleComplex a )
+{
+    val[k] = MAGMA_C_MAKE( (float) MAGMA_Z_REAL( a ), (float) MAGMA_Z_IMAG( a ) );
+}
+
+static inline void
+magma_zmp_encode( unsigned short *val, magma_int_t k, magmaDoubleComplex a )
+{
+#if defined(PRECISION_z)
+    val[2*k]   = magma_float_to_half( (float) MAGMA_Z_REAL( a ) );
+    val[2*k+1] = magma_float_to_half( (float) MAGMA_Z_IMAG( a ) );
+#else
+    val[k] = magma_float_to_half( (float) MAGMA_Z_REAL( a ) );
+#endif
+}
+
+
+/**
+    Helper filling the values, column offsets and row scaling of a CSRMP
+    matrix B from the CSR matrix A, for the value storage type T.
+    The row and block information of B has to be set up.
+*/
+template< typename T >
+static void
+magma_zmcsrmp_fill(
+    magma_z_matrix A,
+    magma_z_matrix B,
+    T *val )
+{
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (magma_int_t b = 0; b < B.numblocks; b++) {
+        magma_index_t base = B.blockinfo[ 2*b ];
+        magma_index_t shift = B.blockinfo[ 2*b+1 ];
+        magma_int_t end = min( (b+1)*B.blocksize, B.num_rows );
+        for (magma_int_t i = b*B.blocksize; i < end; i++) {
+            double scale = 0.0;
+            B.diag[i] = MAGMA_Z_ZERO;
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                if ( A.col[j] == i ) {
+                    B.diag[i] += A.val[j];
+                } else {
+                    scale = max( scale, fabs( MAGMA_Z_REAL( A.val[j] )));
+                    scale = max( scale, fabs( MAGMA_Z_IMAG( A.val[j] )));
+                }
+            }
+            if ( scale == 0.0 ) {
+                scale = 1.0;
+            }
+            B.mp_scale[i] = scale;
+            magma_int_t k = B.row[i];
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                if ( A.col[j] != i ) {
+                    magma_zmp_encode( val, k, A.val[j] / scale );
+                    if ( base >= 0 ) {
+                        B.mp_col[ k-shift ] = (unsigned short) ( A.col[j] - base );
+                    } else {
+                        B.col[ k-shift ] = A.col[j];
+                    }
+                    k++;
+                }
+            }
+        }
+    }
+}
+
+
+/**
+    Purpose
+    -------
+
+    Converts a square matrix in CSR into the mixed precision storage
+    Magma_CSRMP on the host. In this format, the diagonal is kept in the
+    working precision, the off-diagonal values are scaled row-wise to at
+    most one in magnitude and stored in single or half precision. The rows
+    are grouped into blocks of 64; if the off-diagonal columns of a block
+    span less than 65536 columns, they are stored as 16-bit offsets to the
+    smallest column of the block, otherwise as magma_index_t.
+    The product is computed by magma_zgecsrmpmv_cpu, which is also used by
+    magma_z_spmv for Magma_CPU data, such that the host solvers can operate
+    on the low precision operator. Compared to CSR, the bytes per nonzero
+    needed for the values are halved (single) or quartered (half), and the
+    indices mostly take 2 instead of 4 bytes.
+
+    Layout: B.row is the row pointer to the off-diagonal entries, B.diag the
+    diagonal and B.mp_scale the row scaling. For row block b,
+    B.blockinfo[2b] is the base column, or -1 if the block uses B.col, and
+    the column of entry k is found at position k - B.blockinfo[2b+1] in
+    B.mp_col or B.col. B.mp_val holds the values.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_z_matrix
+                input matrix in CSR on the host
+
+    @param[in]
+    format      magma_precision
+                value precision: Magma_HALF for half precision, any other
+                value selects single precision
+
+    @param[out]
+    B           magma_z_matrix*
+                matrix in Magma_CSRMP, has to be empty
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zaux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zmcsrmp(
+    magma_z_matrix A,
+    magma_precision format,
+    magma_z_matrix *B,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+    magma_int_t nnz16 = 0, nnz32 = 0;
+    magma_int_t parts = 1;
+
+    if ( A.memory_location != Magma_CPU || A.num_rows != A.num_cols ||
+         ( A.storage_type != Magma_CSR && A.storage_type != Magma_CUCSR &&
+           A.storage_type != Magma_CSRCOO )) {
+        printf("error: CSRMP requires a square CSR matrix in host memory.\n");
+        return MAGMA_ERR_NOT_SUPPORTED;
+    }
+
+    #if defined(PRECISION_z)
+    parts = 2;
+    #endif
+    B->storage_type = Magma_CSRMP;
+    B->memory_location = Magma_CPU;
+    B->fill_mode = A.fill_mode;
+    B->sym = A.sym;
+    B->num_rows = n;
+    B->num_cols = n;
+    B->nnz = A.nnz;
+    B->true_nnz = A.nnz;
+    B->max_nnz_row = A.max_nnz_row;
+    B->ownership = MagmaTrue;
+    B->mp_format = ( format == Magma_HALF ) ? Magma_HALF : Magma_FLOAT;
+    B->blocksize = MAGMA_MP_BLOCKSIZE;
+    B->numblocks = magma_ceildiv( n, MAGMA_MP_BLOCKSIZE );
+    B->val = NULL;
+    B->row = NULL;
+    B->col = NULL;
+    B->diag = NULL;
+    B->blockinfo = NULL;
+    B->mp_val = NULL;
+    B->mp_scale = NULL;
+    B->mp_col = NULL;
+
+    // off-diagonal row pointer
+    CHECK( magma_index_malloc_cpu( &B->row, n+1 ));
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t i = 0; i < n; i++) {
+        magma_int_t nz = 0;
+        for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+            nz += ( A.col[j] != i );
+        }
+        B->row[i+1] = nz;
+    }
+    B->row[0] = 0;
+    CHECK( magma_zmatrix_createrowptr( n, B->row, queue ));
+
+    // column span of the blocks
+    CHECK( magma_index_malloc_cpu( &B->blockinfo, 2*B->numblocks ));
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t b = 0; b < B->numblocks; b++) {
+        magma_int_t end = min( (b+1)*B->blocksize, n );
+        magma_index_t lo = n, hi = 0;
+        for (magma_int_t i = b*B->blocksize; i < end; i++) {
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                if ( A.col[j] != i ) {
+                    lo = min( lo, A.col[j] );
+                    hi = max( hi, A.col[j] );
+                }
+            }
+        }
+        B->blockinfo[ 2*b ] = ( lo > hi ) ? 0 :
+                              ( hi - lo <= MAGMA_MP_MAX_SPAN ) ? lo : -1;
+    }
+    for (magma_int_t b = 0; b < B->numblocks; b++) {
+        magma_index_t first = B->row[ b*B->blocksize ];
+        magma_index_t last = B->row[ min( (b+1)*B->blocksize, n ) ];
+        if ( B->blockinfo[ 2*b ] >= 0 ) {
+            B->blockinfo[ 2*b+1 ] = first - nnz16;
+            nnz16 += last - first;
+        } else {
+            B->blockinfo[ 2*b+1 ] = first - nnz32;
+            nnz32 += last - first;
+        }
+    }
+
+    CHECK( magma_zmalloc_cpu( &B->diag, n ));
+    CHECK( magma_dmalloc_cpu( &B->mp_scale, n ));
+    CHECK( magma_malloc_cpu( (void**) &B->mp_col, max( nnz16, 1 ) * sizeof(unsigned short) ));
+    CHECK( magma_index_malloc_cpu( &B->col, max( nnz32, 1 )));
+    if ( B->mp_format == Magma_HALF ) {
+        CHECK( magma_malloc_cpu( &B->mp_val,
+                    max( parts * B->row[n], 1 ) * sizeof(unsigned short) ));
+        magma_zmcsrmp_fill( A, *B, (unsigned short*) B->mp_val );
+    } else {
+        CHECK( magma_malloc_cpu( &B->mp_val,
+                    max( B->row[n], 1 ) * sizeof(magmaFloatComplex) ));
+        magma_zmcsrmp_fill( A, *B, (magmaFloatComplex*) B->mp_val );
+    }
+
+cleanup:
+    if ( info != 0 ) {
+        magma_zmfree( B, queue );
+    }
+    return info;
+}
+
+
+/**
+    Helper computing y = alpha * A * x + beta * y for a CSRMP matrix with
+    the value storage type T. The row blocks are distributed dynamically,
+    the products are accumulated in the working precision.
+*/
+template< typename T >
+static void
+magma_zgecsrmpmv_kernel(
+    magmaDoubleComplex alpha,
+    magma_z_matrix A,
+    const T *val,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y )
+{
+    bool beta_is_zero = MAGMA_Z_EQUAL( beta, MAGMA_Z_ZERO );
+
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (magma_int_t b = 0; b < A.numblocks; b++) {
+        magma_index_t base = A.blockinfo[ 2*b ];
+        magma_index_t shift = A.blockinfo[ 2*b+1 ];
+        magma_int_t end = min( (b+1)*A.blocksize, A.num_rows );
+        for (magma_int_t i = b*A.blocksize; i < end; i++) {
+            magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+            if ( base >= 0 ) {
+                const magmaDoubleComplex *xb = x + base;
+                for (magma_int_t k = A.row[i]; k < A.row[i+1]; k++) {
+                    tmp += magma_zmp_decode( val, k ) * xb[ A.mp_col[ k-shift ] ];
+                }
+            } else {
+                for (magma_int_t k = A.row[i]; k < A.row[i+1]; k++) {
+                    tmp += magma_zmp_decode( val, k ) * x[ A.col[ k-shift ] ];
+                }
+            }
+            tmp = A.diag[i] * x[i] + MAGMA_Z_MAKE( A.mp_scale[i], 0.0 ) * tmp;
+            if ( beta_is_zero ) {
+                y[i] = alpha * tmp;
+            } else {
+                y[i] = alpha * tmp + beta * y[i];
+            }
+        }
+    }
+}
+
+
+/**
+    Purpose
+    -------
+
+    This routine computes y = alpha *  A *  x + beta * y on the host for a
+    matrix A in the mixed precision storage Magma_CSRMP generated by
+    magma_zmcsrmp. The low precision values and 16-bit column offsets are
+    decoded on the fly, the accumulation is done in the working precision.
+
+    Arguments
+    ---------
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar multiplier
+
+    @param[in]
+    A           magma_z_matrix
+                matrix in Magma_CSRMP on the host
+
+    @param[in]
+    x           magmaDoubleComplex*
+                input vector x
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar multiplier
+
+    @param[out]
+    y           magmaDoubleComplex*
+                input/output vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zgecsrmpmv_cpu(
+    magmaDoubleComplex alpha,
+    magma_z_matrix A,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    if ( A.storage_type != Magma_CSRMP || A.memory_location != Magma_CPU ) {
+        return MAGMA_ERR_NOT_SUPPORTED;
+    }
+    if ( A.mp_format == Magma_HALF ) {
+        magma_zgecsrmpmv_kernel( alpha, A, (const unsigned short*) A.mp_val,
+                                 x, beta, y );
+    } else {
+        magma_zgecsrmpmv_kernel( alpha, A, (const magmaFloatComplex*) A.mp_val,
+                                 x, beta, y );
+    }
+    return MAGMA_SUCCESS;
+}
@@ -0,0 +1,1731 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @precisions normal z -> c d s
+
+*/
+#include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// below this vector length the host kernels run single-threaded; this also
+// allows to call the host solvers from inside a parallel loop over many
+// small systems without oversubscribing the cores
+#define MAGMA_CPU_OMP_MIN_SIZE 4096
+
+
+static bool
+magma_z_iscsr( magma_z_matrix A )
+{
+    return ( A.storage_type == Magma_CSR   ||
+             A.storage_type == Magma_CUCSR ||
+             A.storage_type == Magma_CSRL  ||
+             A.storage_type == Magma_CSRU  ||
+             A.storage_type == Magma_CSRD  ||
+             A.storage_type == Magma_CSRCOO );
+}
+
+
+/**
+    Purpose
+    -------
+
+    Computes the dot product conj(x)' * y of two vectors in host memory.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    x           magmaDoubleComplex*
+                vector x
+
+    @param[in]
+    y           magmaDoubleComplex*
+                vector y
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magmaDoubleComplex
+magma_zdotc_cpu(
+    magma_int_t n,
+    const magmaDoubleComplex *x,
+    const magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    double re = 0.0, im = 0.0;
+
+    #pragma omp parallel for reduction(+:re,im) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        magmaDoubleComplex tmp = MAGMA_Z_CONJ( x[i] ) * y[i];
+        re += MAGMA_Z_REAL( tmp );
+        im += MAGMA_Z_IMAG( tmp );
+    }
+    return MAGMA_Z_MAKE( re, im );
+}
+
+
+/**
+    Purpose
+    -------
+
+    Computes the Euclidean norm of a vector in host memory.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    x           magmaDoubleComplex*
+                vector x
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" double
+magma_dznrm2_cpu(
+    magma_int_t n,
+    const magmaDoubleComplex *x,
+    magma_queue_t queue )
+{
+    double nrm = 0.0;
+
+    #pragma omp parallel for reduction(+:nrm) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        nrm += MAGMA_Z_REAL( MAGMA_Z_CONJ( x[i] ) * x[i] );
+    }
+    return sqrt( nrm );
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_zcgmerge_spmv1: computes z = A * d and the
+    dot product d' * z. For CSR matrices, both operations are fused into
+    one pass over the matrix.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_z_matrix
+                system matrix in host memory
+
+    @param[in]
+    d           magmaDoubleComplex*
+                input vector d
+
+    @param[out]
+    z           magmaDoubleComplex*
+                output vector z = A * d
+
+    @param[out]
+    dz          magmaDoubleComplex*
+                dot product d' * z
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zcgmerge_spmv1_cpu(
+    magma_z_matrix A,
+    const magmaDoubleComplex *d,
+    magmaDoubleComplex *z,
+    magmaDoubleComplex *dz,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+
+    if ( magma_z_iscsr( A ) ) {
+        double re = 0.0, im = 0.0;
+        #pragma omp parallel for schedule(dynamic, 256) reduction(+:re,im) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+        for (magma_int_t i = 0; i < n; i++) {
+            magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                tmp += A.val[j] * d[ A.col[j] ];
+            }
+            z[i] = tmp;
+            tmp = MAGMA_Z_CONJ( d[i] ) * tmp;
+            re += MAGMA_Z_REAL( tmp );
+            im += MAGMA_Z_IMAG( tmp );
+        }
+        *dz = MAGMA_Z_MAKE( re, im );
+    } else {
+        magma_z_matrix vd={Magma_CSR}, vz={Magma_CSR};
+        CHECK( magma_zvset( n, 1, (magmaDoubleComplex*) d, &vd, queue ));
+        CHECK( magma_zvset( n, 1, z, &vz, queue ));
+        CHECK( magma_z_spmv_cpu( MAGMA_Z_ONE, A, vd, MAGMA_Z_ZERO, vz, queue ));
+        *dz = magma_zdotc_cpu( n, d, z, queue );
+    }
+
+cleanup:
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_zcgmerge_xrbeta: performs the CG updates
+        x = x + alpha * d
+        r = r - alpha * z
+        rr_new = r' * r
+        d = r + rr_new / rr_old * d
+    in one parallel region. The static schedule makes every thread revisit
+    the same chunk of the vectors in the second sweep.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                step length
+
+    @param[in,out]
+    x           magmaDoubleComplex*
+                solution approximation
+
+    @param[in,out]
+    r           magmaDoubleComplex*
+                residual
+
+    @param[in,out]
+    d           magmaDoubleComplex*
+                search direction
+
+    @param[in]
+    z           magmaDoubleComplex*
+                z = A * d
+
+    @param[in,out]
+    rr          double*
+                on entry r' * r of the previous iteration,
+                on exit r' * r of the updated residual
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zcgmerge_xrbeta_cpu(
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex *x,
+    magmaDoubleComplex *r,
+    magmaDoubleComplex *d,
+    const magmaDoubleComplex *z,
+    double *rr,
+    magma_queue_t queue )
+{
+    double rr_old = *rr, rr_new = 0.0;
+
+    #pragma omp parallel if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        #pragma omp for schedule(static) reduction(+:rr_new)
+        for (magma_int_t i = 0; i < n; i++) {
+            x[i] = x[i] + alpha * d[i];
+            r[i] = r[i] - alpha * z[i];
+            rr_new += MAGMA_Z_REAL( MAGMA_Z_CONJ( r[i] ) * r[i] );
+        }
+        magmaDoubleComplex beta = MAGMA_Z_MAKE( rr_new / rr_old, 0.0 );
+        #pragma omp for schedule(static)
+        for (magma_int_t i = 0; i < n; i++) {
+            d[i] = r[i] + beta * d[i];
+        }
+    }
+    *rr = rr_new;
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_zbicgstab_1:
+        p = r + beta * ( p - omega * v )
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    beta        magmaDoubleComplex
+                scalar
+
+    @param[in]
+    omega       magmaDoubleComplex
+                scalar
+
+    @param[in]
+    r           magmaDoubleComplex*
+                vector
+
+    @param[in]
+    v           magmaDoubleComplex*
+                vector
+
+    @param[in,out]
+    p           magmaDoubleComplex*
+                input/output vector
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zbicgstab_1_cpu(
+    magma_int_t n,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex omega,
+    const magmaDoubleComplex *r,
+    const magmaDoubleComplex *v,
+    magmaDoubleComplex *p,
+    magma_queue_t queue )
+{
+    #pragma omp parallel for simd schedule(static) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        p[i] = r[i] + beta * ( p[i] - omega * v[i] );
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_zbicgmerge_spmv1: computes v = A * p and the
+    dot product rr' * v, fused into one pass for CSR matrices.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_z_matrix
+                system matrix in host memory
+
+    @param[in]
+    rr          magmaDoubleComplex*
+                shadow residual
+
+    @param[in]
+    p           magmaDoubleComplex*
+                input vector p
+
+    @param[out]
+    v           magmaDoubleComplex*
+                output vector v = A * p
+
+    @param[out]
+    rrv         magmaDoubleComplex*
+                dot product rr' * v
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zbicgmerge_spmv1_cpu(
+    magma_z_matrix A,
+    const magmaDoubleComplex *rr,
+    const magmaDoubleComplex *p,
+    magmaDoubleComplex *v,
+    magmaDoubleComplex *rrv,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+
+    if ( magma_z_iscsr( A ) ) {
+        double re = 0.0, im = 0.0;
+        #pragma omp parallel for schedule(dynamic, 256) reduction(+:re,im) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+        for (magma_int_t i = 0; i < n; i++) {
+            magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                tmp += A.val[j] * p[ A.col[j] ];
+            }
+            v[i] = tmp;
+            tmp = MAGMA_Z_CONJ( rr[i] ) * tmp;
+            re += MAGMA_Z_REAL( tmp );
+            im += MAGMA_Z_IMAG( tmp );
+        }
+        *rrv = MAGMA_Z_MAKE( re, im );
+    } else {
+        magma_z_matrix vp={Magma_CSR}, vv={Magma_CSR};
+        CHECK( magma_zvset( n, 1, (magmaDoubleComplex*) p, &vp, queue ));
+        CHECK( magma_zvset( n, 1, v, &vv, queue ));
+        CHECK( magma_z_spmv_cpu( MAGMA_Z_ONE, A, vp, MAGMA_Z_ZERO, vv, queue ));
+        *rrv = magma_zdotc_cpu( n, rr, v, queue );
+    }
+
+cleanup:
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_zbicgstab_2:
+        s = r - alpha * v
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar
+
+    @param[in]
+    r           magmaDoubleComplex*
+                vector
+
+    @param[in]
+    v           magmaDoubleComplex*
+                vector
+
+    @param[out]
+    s           magmaDoubleComplex*
+                output vector
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zbicgstab_2_cpu(
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *r,
+    const magmaDoubleComplex *v,
+    magmaDoubleComplex *s,
+    magma_queue_t queue )
+{
+    #pragma omp parallel for simd schedule(static) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        s[i] = r[i] - alpha * v[i];
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_zbicgmerge_spmv2: computes t = A * s and the
+    dot products t' * s and t' * t, fused into one pass for CSR matrices.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_z_matrix
+                system matrix in host memory
+
+    @param[in]
+    s           magmaDoubleComplex*
+                input vector s
+
+    @param[out]
+    t           magmaDoubleComplex*
+                output vector t = A * s
+
+    @param[out]
+    ts          magmaDoubleComplex*
+                dot product t' * s
+
+    @param[out]
+    tt          magmaDoubleComplex*
+                dot product t' * t
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zbicgmerge_spmv2_cpu(
+    magma_z_matrix A,
+    const magmaDoubleComplex *s,
+    magmaDoubleComplex *t,
+    magmaDoubleComplex *ts,
+    magmaDoubleComplex *tt,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+
+    if ( magma_z_iscsr( A ) ) {
+        double re = 0.0, im = 0.0, nrm = 0.0;
+        #pragma omp parallel for schedule(dynamic, 256) reduction(+:re,im,nrm) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+        for (magma_int_t i = 0; i < n; i++) {
+            magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                tmp += A.val[j] * s[ A.col[j] ];
+            }
+            t[i] = tmp;
+            nrm += MAGMA_Z_REAL( MAGMA_Z_CONJ( tmp ) * tmp );
+            tmp = MAGMA_Z_CONJ( tmp ) * s[i];
+            re += MAGMA_Z_REAL( tmp );
+            im += MAGMA_Z_IMAG( tmp );
+        }
+        *ts = MAGMA_Z_MAKE( re, im );
+        *tt = MAGMA_Z_MAKE( nrm, 0.0 );
+    } else {
+        magma_z_matrix vs={Magma_CSR}, vt={Magma_CSR};
+        CHECK( magma_zvset( n, 1, (magmaDoubleComplex*) s, &vs, queue ));
+        CHECK( magma_zvset( n, 1, t, &vt, queue ));
+        CHECK( magma_z_spmv_cpu( MAGMA_Z_ONE, A, vs, MAGMA_Z_ZERO, vt, queue ));
+        *ts = magma_zdotc_cpu( n, t, s, queue );
+        *tt = magma_zdotc_cpu( n, t, t, queue );
+    }
+
+cleanup:
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_zbicgstab_3, fused with the reductions needed
+    in the next iteration:
+        x = x + alpha * p + omega * s
+        r = s - omega * t
+        rho = rr' * r
+        nrm = r' * r
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    alpha       magmaDoubleComplex
+                scalar
+
+    @param[in]
+    omega       magmaDoubleComplex
+                scalar
+
+    @param[in]
+    p           magmaDoubleComplex*
+                vector
+
+    @param[in]
+    s           magmaDoubleComplex*
+                vector
+
+    @param[in]
+    t           magmaDoubleComplex*
+                vector
+
+    @param[in]
+    rr          magmaDoubleComplex*
+                shadow residual
+
+    @param[in,out]
+    x           magmaDoubleComplex*
+                solution approximation
+
+    @param[out]
+    r           magmaDoubleComplex*
+                residual
+
+    @param[out]
+    rho         magmaDoubleComplex*
+                dot product rr' * r
+
+    @param[out]
+    nrm         double*
+                dot product r' * r
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zbicgstab_3_cpu(
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex omega,
+    const magmaDoubleComplex *p,
+    const magmaDoubleComplex *s,
+    const magmaDoubleComplex *t,
+    const magmaDoubleComplex *rr,
+    magmaDoubleComplex *x,
+    magmaDoubleComplex *r,
+    magmaDoubleComplex *rho,
+    double *nrm,
+    magma_queue_t queue )
+{
+    double re = 0.0, im = 0.0, rnrm = 0.0;
+
+    #pragma omp parallel for schedule(static) reduction(+:re,im,rnrm) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        x[i] = x[i] + alpha * p[i] + omega * s[i];
+        magmaDoubleComplex ri = s[i] - omega * t[i];
+        r[i] = ri;
+        rnrm += MAGMA_Z_REAL( MAGMA_Z_CONJ( ri ) * ri );
+        magmaDoubleComplex tmp = MAGMA_Z_CONJ( rr[i] ) * ri;
+        re += MAGMA_Z_REAL( tmp );
+        im += MAGMA_Z_IMAG( tmp );
+    }
+    *rho = MAGMA_Z_MAKE( re, im );
+    *nrm = rnrm;
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Host version of magma_zmdotc: computes the k dot products
+        h[j] = V(j)' * w,    j = 0, ..., k-1
+    in one sweep over w. V is a column-major block of k vectors with
+    leading dimension ldv.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    k           magma_int_t
+                number of vectors in V
+
+    @param[in]
+    V           magmaDoubleComplex*
+                block of vectors
+
+    @param[in]
+    ldv         magma_int_t
+                leading dimension of V
+
+    @param[in]
+    w           magmaDoubleComplex*
+                vector
+
+    @param[out]
+    h           magmaDoubleComplex*
+                array of size k containing the dot products
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zmdotc_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    magma_int_t ldv,
+    const magmaDoubleComplex *w,
+    magmaDoubleComplex *h,
+    magma_queue_t queue )
+{
+    for (magma_int_t j = 0; j < k; j++) {
+        h[j] = MAGMA_Z_ZERO;
+    }
+
+    #pragma omp parallel if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        // every thread accumulates k partial sums over its rows,
+        // blocking the rows keeps w in cache for all k vectors
+        const magma_int_t nb = 512;
+        magmaDoubleComplex part[64];
+        for (magma_int_t j0 = 0; j0 < k; j0 += 64) {
+            magma_int_t kb = min( (magma_int_t) 64, k - j0 );
+            for (magma_int_t j = 0; j < kb; j++) {
+                part[j] = MAGMA_Z_ZERO;
+            }
+            #pragma omp for schedule(static) nowait
+            for (magma_int_t i0 = 0; i0 < n; i0 += nb) {
+                magma_int_t ib = min( nb, n - i0 );
+                for (magma_int_t j = 0; j < kb; j++) {
+                    const magmaDoubleComplex *vj = V + (j0+j)*ldv + i0;
+                    magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+                    for (magma_int_t i = 0; i < ib; i++) {
+                        tmp += MAGMA_Z_CONJ( vj[i] ) * w[i0+i];
+                    }
+                    part[j] += tmp;
+                }
+            }
+            #pragma omp critical
+            {
+                for (magma_int_t j = 0; j < kb; j++) {
+                    h[j0+j] += part[j];
+                }
+            }
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Computes w = w - V * h for a column-major block V of k vectors in one
+    sweep over w. If nrm is not NULL, the squared norm of the updated w is
+    returned in nrm.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    k           magma_int_t
+                number of vectors in V
+
+    @param[in]
+    V           magmaDoubleComplex*
+                block of vectors
+
+    @param[in]
+    ldv         magma_int_t
+                leading dimension of V
+
+    @param[in]
+    h           magmaDoubleComplex*
+                array of size k containing the coefficients
+
+    @param[in,out]
+    w           magmaDoubleComplex*
+                vector
+
+    @param[out]
+    nrm         double*
+                squared norm of the updated w (optional)
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zmaxpy_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    magma_int_t ldv,
+    const magmaDoubleComplex *h,
+    magmaDoubleComplex *w,
+    double *nrm,
+    magma_queue_t queue )
+{
+    double wnrm = 0.0;
+
+    #pragma omp parallel for schedule(static) reduction(+:wnrm) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        magmaDoubleComplex tmp = w[i];
+        for (magma_int_t j = 0; j < k; j++) {
+            tmp -= h[j] * V[ j*ldv + i ];
+        }
+        w[i] = tmp;
+        wnrm += MAGMA_Z_REAL( MAGMA_Z_CONJ( tmp ) * tmp );
+    }
+    if ( nrm != NULL ) {
+        *nrm = wnrm;
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    SpMV of the host Chronopoulos-Gear CG: computes w = A * r together with
+    the two inner products r' * r and r' * w the next iteration needs. For
+    CSR matrices, all three are formed in one pass over the matrix, such
+    that the iteration needs a single global reduction.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_z_matrix
+                system matrix in host memory
+
+    @param[in]
+    r           magmaDoubleComplex*
+                residual
+
+    @param[out]
+    w           magmaDoubleComplex*
+                output vector w = A * r
+
+    @param[out]
+    rr          double*
+                r' * r
+
+    @param[out]
+    rw          double*
+                real part of r' * w
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zcacg_spmv_cpu(
+    magma_z_matrix A,
+    const magmaDoubleComplex *r,
+    magmaDoubleComplex *w,
+    double *rr,
+    double *rw,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+    double rr_loc = 0.0, rw_loc = 0.0;
+
+    if ( magma_z_iscsr( A ) ) {
+        #pragma omp parallel for schedule(dynamic, 256) reduction(+:rr_loc,rw_loc) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+        for (magma_int_t i = 0; i < n; i++) {
+            magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+            for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                tmp += A.val[j] * r[ A.col[j] ];
+            }
+            w[i] = tmp;
+            rr_loc += MAGMA_Z_REAL( MAGMA_Z_CONJ( r[i] ) * r[i] );
+            rw_loc += MAGMA_Z_REAL( MAGMA_Z_CONJ( r[i] ) * tmp );
+        }
+    } else {
+        magma_z_matrix vr={Magma_CSR}, vw={Magma_CSR};
+        CHECK( magma_zvset( n, 1, (magmaDoubleComplex*) r, &vr, queue ));
+        CHECK( magma_zvset( n, 1, w, &vw, queue ));
+        CHECK( magma_z_spmv_cpu( MAGMA_Z_ONE, A, vr, MAGMA_Z_ZERO, vw, queue ));
+        #pragma omp parallel for schedule(static) reduction(+:rr_loc,rw_loc) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+        for (magma_int_t i = 0; i < n; i++) {
+            rr_loc += MAGMA_Z_REAL( MAGMA_Z_CONJ( r[i] ) * r[i] );
+            rw_loc += MAGMA_Z_REAL( MAGMA_Z_CONJ( r[i] ) * w[i] );
+        }
+    }
+    *rr = rr_loc;
+    *rw = rw_loc;
+
+cleanup:
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Vector updates of the host Chronopoulos-Gear CG:
+        p = r + beta * p
+        s = w + beta * s
+        x = x + alpha * p
+        r = r - alpha * s
+    in one sweep without any reduction.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    alpha       double
+                step length
+
+    @param[in]
+    beta        double
+                direction update
+
+    @param[in,out]
+    x           magmaDoubleComplex*
+                solution approximation
+
+    @param[in,out]
+    r           magmaDoubleComplex*
+                residual
+
+    @param[in,out]
+    p           magmaDoubleComplex*
+                search direction
+
+    @param[in,out]
+    s           magmaDoubleComplex*
+                s = A * p
+
+    @param[in]
+    w           magmaDoubleComplex*
+                w = A * r
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zcacg_update_cpu(
+    magma_int_t n,
+    double alpha,
+    double beta,
+    magmaDoubleComplex *x,
+    magmaDoubleComplex *r,
+    magmaDoubleComplex *p,
+    magmaDoubleComplex *s,
+    const magmaDoubleComplex *w,
+    magma_queue_t queue )
+{
+    magmaDoubleComplex za = MAGMA_Z_MAKE( alpha, 0.0 );
+    magmaDoubleComplex zb = MAGMA_Z_MAKE( beta, 0.0 );
+
+    #pragma omp parallel for simd schedule(static) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        magmaDoubleComplex pi = r[i] + zb * p[i];
+        magmaDoubleComplex si = w[i] + zb * s[i];
+        p[i] = pi;
+        s[i] = si;
+        x[i] = x[i] + za * pi;
+        r[i] = r[i] - za * si;
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    SpMV of the host pipelined GMRES: computes w = A * z and, in the same
+    sweep, the inner products
+        h[j] = V(j)' * z,    j = 0, ..., k-1,
+        nrm  = z' * z.
+    The reduction for the orthogonalization of z does not depend on w,
+    so it is overlapped with the SpMV instead of following it. If w is
+    NULL, only the inner products are computed.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_z_matrix
+                system matrix in host memory
+
+    @param[in]
+    k           magma_int_t
+                number of vectors in V
+
+    @param[in]
+    V           magmaDoubleComplex*
+                block of vectors
+
+    @param[in]
+    ldv         magma_int_t
+                leading dimension of V
+
+    @param[in]
+    z           magmaDoubleComplex*
+                input vector z
+
+    @param[out]
+    w           magmaDoubleComplex*
+                output vector w = A * z (optional)
+
+    @param[out]
+    h           magmaDoubleComplex*
+                array of size k containing the inner products
+
+    @param[out]
+    nrm         double*
+                squared norm of z
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zpipegmres_spmv_cpu(
+    magma_z_matrix A,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    magma_int_t ldv,
+    const magmaDoubleComplex *z,
+    magmaDoubleComplex *w,
+    magmaDoubleComplex *h,
+    double *nrm,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+    magma_int_t num_threads = 1;
+    magmaDoubleComplex *part = NULL;
+    double znrm = 0.0;
+    bool fused = ( w != NULL && magma_z_iscsr( A ) );
+
+    if ( w != NULL && ! fused ) {
+        magma_z_matrix vz={Magma_CSR}, vw={Magma_CSR};
+        CHECK( magma_zvset( n, 1, (magmaDoubleComplex*) z, &vz, queue ));
+        CHECK( magma_zvset( n, 1, w, &vw, queue ));
+        CHECK( magma_z_spmv_cpu( MAGMA_Z_ONE, A, vz, MAGMA_Z_ZERO, vw, queue ));
+    }
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_zmalloc_cpu( &part, num_threads * (k+1) ));
+    for (magma_int_t j = 0; j < k; j++) {
+        h[j] = MAGMA_Z_ZERO;
+    }
+
+    #pragma omp parallel num_threads( num_threads ) reduction(+:znrm) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        // the rows are processed in blocks, the SpMV of a block is
+        // followed by the k inner products while the block of z is in cache
+        const magma_int_t nb = 512;
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        magmaDoubleComplex *hp = part + id * (k+1);
+        for (magma_int_t j = 0; j < k; j++) {
+            hp[j] = MAGMA_Z_ZERO;
+        }
+        #pragma omp for schedule(static) nowait
+        for (magma_int_t i0 = 0; i0 < n; i0 += nb) {
+            magma_int_t ib = min( nb, n - i0 );
+            if ( fused ) {
+                for (magma_int_t i = i0; i < i0+ib; i++) {
+                    magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+                    for (magma_int_t l = A.row[i]; l < A.row[i+1]; l++) {
+                        tmp += A.val[l] * z[ A.col[l] ];
+                    }
+                    w[i] = tmp;
+                }
+            }
+            for (magma_int_t i = i0; i < i0+ib; i++) {
+                znrm += MAGMA_Z_REAL( MAGMA_Z_CONJ( z[i] ) * z[i] );
+            }
+            for (magma_int_t j = 0; j < k; j++) {
+                const magmaDoubleComplex *vj = V + j*ldv;
+                magmaDoubleComplex tmp = MAGMA_Z_ZERO;
+                for (magma_int_t i = i0; i < i0+ib; i++) {
+                    tmp += MAGMA_Z_CONJ( vj[i] ) * z[i];
+                }
+                hp[j] += tmp;
+            }
+        }
+        #pragma omp critical
+        {
+            for (magma_int_t j = 0; j < k; j++) {
+                h[j] += hp[j];
+            }
+        }
+    }
+    *nrm = znrm;
+
+cleanup:
+    magma_free_cpu( part );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Basis update of the host pipelined GMRES. With the inner products h of
+    z = A * V(k-1) against V(0:k-1) and eta = H(k,k-1), computes
+        v = ( z - V * h ) / eta
+        y = ( w - Z * h ) / eta
+    in one sweep, where Z(j) = A * V(j) and w = A * z, i.e. v is the next
+    basis vector and y = A * v. If w is NULL, only v is computed.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    k           magma_int_t
+                number of vectors in V and Z
+
+    @param[in]
+    V           magmaDoubleComplex*
+                orthonormal basis
+
+    @param[in]
+    Z           magmaDoubleComplex*
+                block of vectors A * V
+
+    @param[in]
+    ldv         magma_int_t
+                leading dimension of V and Z
+
+    @param[in]
+    h           magmaDoubleComplex*
+                array of size k containing the coefficients
+
+    @param[in]
+    eta         double
+                norm of the orthogonalized z
+
+    @param[in]
+    z           magmaDoubleComplex*
+                vector z
+
+    @param[in]
+    w           magmaDoubleComplex*
+                vector w = A * z (optional)
+
+    @param[out]
+    v           magmaDoubleComplex*
+                next basis vector
+
+    @param[out]
+    y           magmaDoubleComplex*
+                A times the next basis vector (optional)
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zpipegmres_update_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    const magmaDoubleComplex *Z,
+    magma_int_t ldv,
+    const magmaDoubleComplex *h,
+    double eta,
+    const magmaDoubleComplex *z,
+    const magmaDoubleComplex *w,
+    magmaDoubleComplex *v,
+    magmaDoubleComplex *y,
+    magma_queue_t queue )
+{
+    magmaDoubleComplex scal = MAGMA_Z_MAKE( 1.0 / eta, 0.0 );
+
+    #pragma omp parallel for schedule(static) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    for (magma_int_t i = 0; i < n; i++) {
+        magmaDoubleComplex tv = z[i];
+        for (magma_int_t j = 0; j < k; j++) {
+            tv -= h[j] * V[ j*ldv + i ];
+        }
+        v[i] = scal * tv;
+        if ( w != NULL ) {
+            magmaDoubleComplex ty = w[i];
+            for (magma_int_t j = 0; j < k; j++) {
+                ty -= h[j] * Z[ j*ldv + i ];
+            }
+            y[i] = scal * ty;
+        }
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/**
+    Purpose
+    -------
+
+    SpMV of the host block CG: computes Q = A * P for a block of nv vectors
+    and the nv inner products den[v] = P(:,v)' * Q(:,v). P and Q are stored
+    row-major, i.e., the nv entries of a row are contiguous, such that every
+    entry of A is read once for all vectors. For CSR matrices, the inner
+    products are formed in the same pass.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_z_matrix
+                system matrix in host memory
+
+    @param[in]
+    nv          magma_int_t
+                number of vectors
+
+    @param[in]
+    P           magmaDoubleComplex*
+                row-major block of nv vectors
+
+    @param[out]
+    Q           magmaDoubleComplex*
+                row-major output block Q = A * P
+
+    @param[out]
+    den         magmaDoubleComplex*
+                array of size nv containing P(:,v)' * Q(:,v)
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zbcgmerge_spmv_cpu(
+    magma_z_matrix A,
+    magma_int_t nv,
+    const magmaDoubleComplex *P,
+    magmaDoubleComplex *Q,
+    magmaDoubleComplex *den,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+    magma_int_t num_threads = 1;
+    magmaDoubleComplex *part = NULL;
+    bool fused = magma_z_iscsr( A );
+
+    if ( ! fused ) {
+        magma_z_matrix vp={Magma_CSR}, vq={Magma_CSR};
+        CHECK( magma_zvset( n, nv, (magmaDoubleComplex*) P, &vp, queue ));
+        CHECK( magma_zvset( n, nv, Q, &vq, queue ));
+        vp.major = MagmaRowMajor;
+        vq.major = MagmaRowMajor;
+        CHECK( magma_z_spmv_cpu( MAGMA_Z_ONE, A, vp, MAGMA_Z_ZERO, vq, queue ));
+    }
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_zmalloc_cpu( &part, num_threads * nv ));
+    for (magma_int_t v = 0; v < nv; v++) {
+        den[v] = MAGMA_Z_ZERO;
+    }
+
+    #pragma omp parallel num_threads( num_threads ) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        magmaDoubleComplex *dp = part + id * nv;
+        for (magma_int_t v = 0; v < nv; v++) {
+            dp[v] = MAGMA_Z_ZERO;
+        }
+        #pragma omp for schedule(dynamic, 256) nowait
+        for (magma_int_t i = 0; i < n; i++) {
+            const magmaDoubleComplex *pi = P + i*nv;
+            magmaDoubleComplex *qi = Q + i*nv;
+            if ( fused ) {
+                for (magma_int_t v = 0; v < nv; v++) {
+                    qi[v] = MAGMA_Z_ZERO;
+                }
+                for (magma_int_t j = A.row[i]; j < A.row[i+1]; j++) {
+                    magmaDoubleComplex a = A.val[j];
+                    const magmaDoubleComplex *pj = P + A.col[j]*nv;
+                    #pragma omp simd
+                    for (magma_int_t v = 0; v < nv; v++) {
+                        qi[v] += a * pj[v];
+                    }
+                }
+            }
+            for (magma_int_t v = 0; v < nv; v++) {
+                dp[v] += MAGMA_Z_CONJ( pi[v] ) * qi[v];
+            }
+        }
+        #pragma omp critical
+        {
+            for (magma_int_t v = 0; v < nv; v++) {
+                den[v] += dp[v];
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( part );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Vector updates of the host block CG. For the row-major blocks of nv
+    vectors, computes
+
+        X(:,v) = X(:,v) + alpha[v] * P(:,v)
+        R(:,v) = R(:,v) - alpha[v] * Q(:,v)
+        rr[v]  = R(:,v)' * R(:,v)
+
+    in one sweep.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    nv          magma_int_t
+                number of vectors
+
+    @param[in]
+    alpha       magmaDoubleComplex*
+                array of size nv containing the step lengths
+
+    @param[in,out]
+    X           magmaDoubleComplex*
+                solution block
+
+    @param[in,out]
+    R           magmaDoubleComplex*
+                residual block
+
+    @param[in]
+    P           magmaDoubleComplex*
+                search directions
+
+    @param[in]
+    Q           magmaDoubleComplex*
+                Q = A * P
+
+    @param[out]
+    rr          double*
+                array of size nv containing the squared residual norms
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zgegpuk
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zbcgmerge_xr_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    const magmaDoubleComplex *alpha,
+    magmaDoubleComplex *X,
+    magmaDoubleComplex *R,
+    const magmaDoubleComplex *P,
+    const magmaDoubleComplex *Q,
+    double *rr,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    double *part = NULL;
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_dmalloc_cpu( &part, num_threads * nv ));
+    for (magma_int_t v = 0; v < nv; v++) {
+        rr[v] = 0.0;
+    }
+
+    #pragma omp parallel num_threads( num_threads ) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        double *rp = part + id * nv;
+        for (magma_int_t v = 0; v < nv; v++) {
+            rp[v] = 0.0;
+        }
+        #pragma omp for schedule(static) nowait
+        for (magma_int_t i = 0; i < n; i++) {
+            for (magma_int_t v = 0; v < nv; v++) {
+                magma_int_t l = i*nv + v;
+                X[l] = X[l] + alpha[v] * P[l];
+                R[l] = R[l] - alpha[v] * Q[l];
+                rp[v] += MAGMA_Z_REAL( MAGMA_Z_CONJ( R[l] ) * R[l] );
+            }
+        }
+        #pragma omp critical
+        {
+            for (magma_int_t v = 0; v < nv; v++) {
+                rr[v] += rp[v];
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( part );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Block version of magma_zmdotc_cpu for nv independent right-hand sides.
+    V holds k row-major blocks of nv vectors with leading dimension ldv
+    between the blocks, W is a row-major block of nv vectors. Computes
+
+        h[j*nv+v] = V_j(:,v)' * W(:,v),    j = 0, ..., k-1
+
+    in one sweep over W.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    nv          magma_int_t
+                number of vectors per block
+
+    @param[in]
+    k           magma_int_t
+                number of blocks in V
+
+    @param[in]
+    V           magmaDoubleComplex*
+                blocks of vectors
+
+    @param[in]
+    ldv         magma_int_t
+                distance between the blocks of V
+
+    @param[in]
+    W           magmaDoubleComplex*
+                block of vectors
+
+    @param[out]
+    h           magmaDoubleComplex*
+                array of size k*nv containing the dot products
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zbmdotc_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    magma_int_t ldv,
+    const magmaDoubleComplex *W,
+    magmaDoubleComplex *h,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    magmaDoubleComplex *part = NULL;
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_zmalloc_cpu( &part, num_threads * k * nv ));
+    for (magma_int_t l = 0; l < k*nv; l++) {
+        h[l] = MAGMA_Z_ZERO;
+    }
+
+    #pragma omp parallel num_threads( num_threads ) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        magmaDoubleComplex *hp = part + id * k * nv;
+        for (magma_int_t l = 0; l < k*nv; l++) {
+            hp[l] = MAGMA_Z_ZERO;
+        }
+        #pragma omp for schedule(static) nowait
+        for (magma_int_t i = 0; i < n; i++) {
+            const magmaDoubleComplex *wi = W + i*nv;
+            for (magma_int_t j = 0; j < k; j++) {
+                const magmaDoubleComplex *vji = V + j*ldv + i*nv;
+                for (magma_int_t v = 0; v < nv; v++) {
+                    hp[ j*nv+v ] += MAGMA_Z_CONJ( vji[v] ) * wi[v];
+                }
+            }
+        }
+        #pragma omp critical
+        {
+            for (magma_int_t l = 0; l < k*nv; l++) {
+                h[l] += hp[l];
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( part );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Block version of magma_zmaxpy_cpu for nv independent right-hand sides:
+    computes W(:,v) = W(:,v) - sum_j h[j*nv+v] * V_j(:,v) in one sweep over
+    W, with the layout of magma_zbmdotc_cpu. If nrm is not NULL, the squared
+    norms of the updated vectors are returned in nrm. With k = 0, this only
+    computes the norms.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    nv          magma_int_t
+                number of vectors per block
+
+    @param[in]
+    k           magma_int_t
+                number of blocks in V
+
+    @param[in]
+    V           magmaDoubleComplex*
+                blocks of vectors
+
+    @param[in]
+    ldv         magma_int_t
+                distance between the blocks of V
+
+    @param[in]
+    h           magmaDoubleComplex*
+                array of size k*nv containing the coefficients
+
+    @param[in,out]
+    W           magmaDoubleComplex*
+                block of vectors
+
+    @param[out]
+    nrm         double*
+                array of size nv containing the squared norms (optional)
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zbmaxpy_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    magma_int_t ldv,
+    const magmaDoubleComplex *h,
+    magmaDoubleComplex *W,
+    double *nrm,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    double *part = NULL;
+
+    #ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+    #endif
+    CHECK( magma_dmalloc_cpu( &part, num_threads * nv ));
+    for (magma_int_t v = 0; nrm != NULL && v < nv; v++) {
+        nrm[v] = 0.0;
+    }
+
+    #pragma omp parallel num_threads( num_threads ) if( n > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        magma_int_t id = 0;
+        #ifdef _OPENMP
+        id = omp_get_thread_num();
+        #endif
+        double *np = part + id * nv;
+        for (magma_int_t v = 0; v < nv; v++) {
+            np[v] = 0.0;
+        }
+        #pragma omp for schedule(static) nowait
+        for (magma_int_t i = 0; i < n; i++) {
+            magmaDoubleComplex *wi = W + i*nv;
+            for (magma_int_t j = 0; j < k; j++) {
+                const magmaDoubleComplex *vji = V + j*ldv + i*nv;
+                for (magma_int_t v = 0; v < nv; v++) {
+                    wi[v] -= h[ j*nv+v ] * vji[v];
+                }
+            }
+            for (magma_int_t v = 0; v < nv; v++) {
+                np[v] += MAGMA_Z_REAL( MAGMA_Z_CONJ( wi[v] ) * wi[v] );
+            }
+        }
+        if ( nrm != NULL ) {
+            #pragma omp critical
+            {
+                for (magma_int_t v = 0; v < nv; v++) {
+                    nrm[v] += np[v];
+                }
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( part );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Removes vectors from a row-major block of nv vectors: on exit, X is a
+    row-major block of the nk vectors keep[0], ..., keep[nk-1], in this
+    order. Used by the host block solvers to deflate converged right-hand
+    sides, such that the remaining vectors stay contiguous.
+
+    Arguments
+    ---------
+
+    @param[in]
+    n           magma_int_t
+                vector length
+
+    @param[in]
+    nv          magma_int_t
+                number of vectors on entry
+
+    @param[in]
+    nk          magma_int_t
+                number of vectors to keep
+
+    @param[in]
+    keep        magma_int_t*
+                array of size nk containing the vectors to keep
+
+    @param[in,out]
+    X           magmaDoubleComplex*
+                block of vectors
+
+    @param[out]
+    work        magmaDoubleComplex*
+                workspace of size n*nk
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_zblas
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_zbcompact_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t nk,
+    const magma_int_t *keep,
+    magmaDoubleComplex *X,
+    magmaDoubleComplex *work,
+    magma_queue_t queue )
+{
+    #pragma omp parallel if( n*nv > MAGMA_CPU_OMP_MIN_SIZE )
+    {
+        #pragma omp for schedule(static)
+        for (magma_int_t i = 0; i < n; i++) {
+            for (magma_int_t v = 0; v < nk; v++) {
+                work[ i*nk+v ] = X[ i*nv+keep[v] ];
+            }
+        }
+        #pragma omp for schedule(static)
+        for (magma_int_t l = 0; l < n*nk; l++) {
+            X[l] = work[l];
+        }
+    }
+    return MAGMA_SUCCESS;
+}
@@ -0,0 +1,1238 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/blas_host/magma_z_no_device.cpp, normal z -> c, Sat Oct 17 00:30:56 2026
+
+       This is simply a copy of the prototypes in magmasparse_c.h of the device routines
+       that the sparse library references, with a body that returns
+       MAGMA_ERR_NOT_SUPPORTED added to each function, since the host
+       backend has neither the sparse device kernels nor cuSPARSE.
+*/
+#include "magmasparse_internal.h"
+
+#ifdef HAVE_HOST
+
+static const char* format = "error: %s is not supported by the host backend.\n";
+
+extern "C" magma_int_t
+magma_cmcsrcompressor_gpu(
+    magma_c_matrix *A,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cparilu_csr(
+    magma_c_matrix A,
+    magma_c_matrix L,
+    magma_c_matrix U,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cparic_csr(
+    magma_c_matrix A,
+    magma_c_matrix A_CSR,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cmatrix_cup_gpu(
+    magma_c_matrix A,
+    magma_c_matrix B,
+    magma_c_matrix *U,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cparilut_sweep_gpu(
+    magma_c_matrix *A,
+    magma_c_matrix *L,
+    magma_c_matrix *U,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cparilut_residuals_gpu(
+    magma_c_matrix A,
+    magma_c_matrix L,
+    magma_c_matrix U,
+    magma_c_matrix *R,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cthrsholdrm_gpu(
+    magma_int_t order,
+    magma_c_matrix* A,
+    float* thrs,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cget_row_ptr(
+    const magma_int_t num_rows,
+    magma_int_t* nnz,
+    const magma_index_t* rowidx,
+    magma_index_t* rowptr,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cparilut_candidates_gpu(
+    magma_c_matrix L0,
+    magma_c_matrix U0,
+    magma_c_matrix L,
+    magma_c_matrix U,
+    magma_c_matrix *L_new,
+    magma_c_matrix *U_new,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_csampleselect(
+    magma_int_t total_size,
+    magma_int_t subset_size,
+    magmaFloatComplex *val,
+    float *thrs,
+    magma_ptr *tmp_ptr,
+    magma_int_t *tmp_size,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_csampleselect_nodp(
+    magma_int_t total_size,
+    magma_int_t subset_size,
+    magmaFloatComplex *val,
+    float *thrs,
+    magma_ptr *tmp_ptr,
+    magma_int_t *tmp_size,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cisai_generator_regs(
+    magma_uplo_t uplotype,
+    magma_trans_t transtype,
+    magma_diag_t diagtype,
+    magma_c_matrix L,
+    magma_c_matrix *M,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccsr_sort_gpu(
+    magma_c_matrix *A,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cftjacobicontractions(
+    magma_c_matrix xkm2,
+    magma_c_matrix xkm1,
+    magma_c_matrix xk,
+    magma_c_matrix *z,
+    magma_c_matrix *c,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cftjacobiupdatecheck(
+    float delta,
+    magma_c_matrix *xold,
+    magma_c_matrix *xnew,
+    magma_c_matrix *zprev,
+    magma_c_matrix c,
+    magma_int_t *flag_t,
+    magma_int_t *flag_fp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_clobpcg_res(
+    magma_int_t num_rows,
+    magma_int_t num_vecs,
+    float *evalues,
+    magmaFloatComplex_ptr X,
+    magmaFloatComplex_ptr R,
+    float *res,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_clobpcg_maxpy(
+    magma_int_t num_rows,
+    magma_int_t num_vecs,
+    magmaFloatComplex_ptr X,
+    magmaFloatComplex_ptr Y,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccumilusetup_transpose(
+    magma_c_matrix A, magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccumilusetup(
+    magma_c_matrix A,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccustomilusetup(
+    magma_c_matrix A,
+    magma_c_matrix b,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccustomicsetup(
+    magma_c_matrix A,
+    magma_c_matrix b,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccumilugeneratesolverinfo(
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_capplycumilu_l(
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_capplycumilu_r(
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_capplycumilu_l_transpose(
+    magma_c_matrix b, magma_c_matrix *x,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_capplycumilu_r_transpose(
+    magma_c_matrix b, magma_c_matrix *x,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccumiccsetup(
+    magma_c_matrix A,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccumicgeneratesolverinfo(
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_capplycumicc_l(
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_capplycumicc_r(
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbajac_csr(
+    magma_int_t localiters,
+    magma_c_matrix D,
+    magma_c_matrix R,
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbajac_csr_overlap(
+    magma_int_t localiters,
+    magma_int_t matrices,
+    magma_int_t overlap,
+    magma_c_matrix *D,
+    magma_c_matrix *R,
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccuspmm(
+    magma_c_matrix A,
+    magma_c_matrix B,
+    magma_c_matrix *AB,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccuspaxpy(
+    magmaFloatComplex_ptr alpha, magma_c_matrix A,
+    magmaFloatComplex_ptr beta, magma_c_matrix B,
+    magma_c_matrix *AB,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccompact(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex_ptr dA, magma_int_t ldda,
+    float *dnorms, float tol,
+    magma_int_t *activeMask, magma_int_t *cBlockSize,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccompactActive(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex_ptr dA, magma_int_t ldda,
+    magma_int_t *active,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cgecsrmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex lambda,
+    magmaFloatComplex_ptr dval,
+    magmaIndex_ptr drowptr,
+    magmaIndex_ptr dcolind,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaFloatComplex_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cgeellmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaFloatComplex alpha,
+    magmaFloatComplex lambda,
+    magmaFloatComplex_ptr dval,
+    magmaIndex_ptr dcolind,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaFloatComplex_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cgeelltmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaFloatComplex alpha,
+    magmaFloatComplex lambda,
+    magmaFloatComplex_ptr dval,
+    magmaIndex_ptr dcolind,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaFloatComplex_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cjacobisetup_vector_gpu(
+    magma_int_t num_rows,
+    magma_c_matrix b,
+    magma_c_matrix d,
+    magma_c_matrix c,
+    magma_c_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cjacobi_diagscal(
+    magma_int_t num_rows,
+    magma_c_matrix d,
+    magma_c_matrix b,
+    magma_c_matrix *c,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cjacobiupdate(
+    magma_c_matrix t,
+    magma_c_matrix b,
+    magma_c_matrix d,
+    magma_c_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cjacobispmvupdate(
+    magma_int_t maxiter,
+    magma_c_matrix A,
+    magma_c_matrix t,
+    magma_c_matrix b,
+    magma_c_matrix d,
+    magma_c_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cjacobispmvupdateselect(
+    magma_int_t maxiter,
+    magma_int_t num_updates,
+    magma_index_t *indices,
+    magma_c_matrix A,
+    magma_c_matrix t,
+    magma_c_matrix b,
+    magma_c_matrix d,
+    magma_c_matrix tmp,
+    magma_c_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbicgmerge1(
+    magma_int_t n,
+    magmaFloatComplex_ptr dskp,
+    magmaFloatComplex_ptr dv,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbicgmerge2(
+    magma_int_t n,
+    magmaFloatComplex_ptr dskp,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dv,
+    magmaFloatComplex_ptr ds,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbicgmerge4(
+    magma_int_t type,
+    magmaFloatComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cidr_smoothing_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex_ptr drs,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dt,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cidr_smoothing_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex omega,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex_ptr dxs,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccgs_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr r,
+    magmaFloatComplex_ptr q,
+    magmaFloatComplex_ptr u,
+    magmaFloatComplex_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccgs_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex_ptr r,
+    magmaFloatComplex_ptr u,
+    magmaFloatComplex_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccgs_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_ptr v_hat,
+    magmaFloatComplex_ptr u,
+    magmaFloatComplex_ptr q,
+    magmaFloatComplex_ptr t,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccgs_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_ptr u_hat,
+    magmaFloatComplex_ptr t,
+    magmaFloatComplex_ptr x,
+    magmaFloatComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cqmr_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex rho,
+    magmaFloatComplex psi,
+    magmaFloatComplex_ptr y,
+    magmaFloatComplex_ptr z,
+    magmaFloatComplex_ptr v,
+    magmaFloatComplex_ptr w,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cqmr_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex pde,
+    magmaFloatComplex rde,
+    magmaFloatComplex_ptr y,
+    magmaFloatComplex_ptr z,
+    magmaFloatComplex_ptr p,
+    magmaFloatComplex_ptr q,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cqmr_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr pt,
+    magmaFloatComplex_ptr v,
+    magmaFloatComplex_ptr y,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cqmr_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex eta,
+    magmaFloatComplex_ptr p,
+    magmaFloatComplex_ptr pt,
+    magmaFloatComplex_ptr d,
+    magmaFloatComplex_ptr s,
+    magmaFloatComplex_ptr x,
+    magmaFloatComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cqmr_5(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex eta,
+    magmaFloatComplex pds,
+    magmaFloatComplex_ptr p,
+    magmaFloatComplex_ptr pt,
+    magmaFloatComplex_ptr d,
+    magmaFloatComplex_ptr s,
+    magmaFloatComplex_ptr x,
+    magmaFloatComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cqmr_7(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr pt,
+    magmaFloatComplex_ptr v,
+    magmaFloatComplex_ptr vt,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cqmr_8(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex rho,
+    magmaFloatComplex psi,
+    magmaFloatComplex_ptr vt,
+    magmaFloatComplex_ptr wt,
+    magmaFloatComplex_ptr y,
+    magmaFloatComplex_ptr z,
+    magmaFloatComplex_ptr v,
+    magmaFloatComplex_ptr w,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbicgstab_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex beta,
+    magmaFloatComplex omega,
+    magmaFloatComplex_ptr r,
+    magmaFloatComplex_ptr v,
+    magmaFloatComplex_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbicgstab_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_ptr r,
+    magmaFloatComplex_ptr v,
+    magmaFloatComplex_ptr s,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbicgstab_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex alpha,
+    magmaFloatComplex omega,
+    magmaFloatComplex_ptr p,
+    magmaFloatComplex_ptr s,
+    magmaFloatComplex_ptr t,
+    magmaFloatComplex_ptr x,
+    magmaFloatComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbicgstab_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex alpha,
+    magmaFloatComplex omega,
+    magmaFloatComplex_ptr y,
+    magmaFloatComplex_ptr z,
+    magmaFloatComplex_ptr s,
+    magmaFloatComplex_ptr t,
+    magmaFloatComplex_ptr x,
+    magmaFloatComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ctfqmr_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex alpha,
+    magmaFloatComplex sigma,
+    magmaFloatComplex_ptr v,
+    magmaFloatComplex_ptr Au,
+    magmaFloatComplex_ptr u_m,
+    magmaFloatComplex_ptr pu_m,
+    magmaFloatComplex_ptr u_mp1,
+    magmaFloatComplex_ptr w,
+    magmaFloatComplex_ptr d,
+    magmaFloatComplex_ptr Ad,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ctfqmr_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex eta,
+    magmaFloatComplex_ptr d,
+    magmaFloatComplex_ptr Ad,
+    magmaFloatComplex_ptr x,
+    magmaFloatComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ctfqmr_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr w,
+    magmaFloatComplex_ptr u_m,
+    magmaFloatComplex_ptr u_mp1,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ctfqmr_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr Au_new,
+    magmaFloatComplex_ptr v,
+    magmaFloatComplex_ptr Au,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ctfqmr_5(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloatComplex alpha,
+    magmaFloatComplex sigma,
+    magmaFloatComplex_ptr v,
+    magmaFloatComplex_ptr Au,
+    magmaFloatComplex_ptr u_mp1,
+    magmaFloatComplex_ptr w,
+    magmaFloatComplex_ptr d,
+    magmaFloatComplex_ptr Ad,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccgmerge_spmv1(
+    magma_c_matrix A,
+    magmaFloatComplex_ptr d1,
+    magmaFloatComplex_ptr d2,
+    magmaFloatComplex_ptr dd,
+    magmaFloatComplex_ptr dz,
+    magmaFloatComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ccgmerge_xrbeta(
+    magma_int_t n,
+    magmaFloatComplex_ptr d1,
+    magmaFloatComplex_ptr d2,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dd,
+    magmaFloatComplex_ptr dz,
+    magmaFloatComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cpcgmerge_xrbeta1(
+    magma_int_t n,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dd,
+    magmaFloatComplex_ptr dz,
+    magmaFloatComplex_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cpcgmerge_xrbeta2(
+    magma_int_t n,
+    magmaFloatComplex_ptr d1,
+    magmaFloatComplex_ptr d2,
+    magmaFloatComplex_ptr dh,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dd,
+    magmaFloatComplex_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cjcgmerge_xrbeta(
+    magma_int_t n,
+    magmaFloatComplex_ptr d1,
+    magmaFloatComplex_ptr d2,
+    magmaFloatComplex_ptr diag,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dd,
+    magmaFloatComplex_ptr dz,
+    magmaFloatComplex_ptr dh,
+    magmaFloatComplex_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cmdotc(
+    magma_int_t n,
+    magma_int_t k,
+    magmaFloatComplex_ptr dv,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dd1,
+    magmaFloatComplex_ptr dd2,
+    magmaFloatComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cgemvmdot_shfl(
+    magma_int_t n,
+    magma_int_t k,
+    magmaFloatComplex_ptr dv,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dd1,
+    magmaFloatComplex_ptr dd2,
+    magmaFloatComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cgemvmdot(
+    magma_int_t n,
+    magma_int_t k,
+    magmaFloatComplex_ptr dv,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dd1,
+    magmaFloatComplex_ptr dd2,
+    magmaFloatComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cmdotc1(
+    magma_int_t n,
+    magmaFloatComplex_ptr v0,
+    magmaFloatComplex_ptr w0,
+    magmaFloatComplex_ptr d1,
+    magmaFloatComplex_ptr d2,
+    magmaFloatComplex_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cmdotc3(
+    magma_int_t n,
+    magmaFloatComplex_ptr v0,
+    magmaFloatComplex_ptr w0,
+    magmaFloatComplex_ptr v1,
+    magmaFloatComplex_ptr w1,
+    magmaFloatComplex_ptr v2,
+    magmaFloatComplex_ptr w2,
+    magmaFloatComplex_ptr d1,
+    magmaFloatComplex_ptr d2,
+    magmaFloatComplex_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbicgmerge_spmv1(
+    magma_c_matrix A,
+    magmaFloatComplex_ptr dd1,
+    magmaFloatComplex_ptr dd2,
+    magmaFloatComplex_ptr dp,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dv,
+    magmaFloatComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbicgmerge_spmv2(
+    magma_c_matrix A,
+    magmaFloatComplex_ptr dd1,
+    magmaFloatComplex_ptr dd2,
+    magmaFloatComplex_ptr ds,
+    magmaFloatComplex_ptr dt,
+    magmaFloatComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cbicgmerge_xrbeta(
+    magma_int_t n,
+    magmaFloatComplex_ptr dd1,
+    magmaFloatComplex_ptr dd2,
+    magmaFloatComplex_ptr drr,
+    magmaFloatComplex_ptr dr,
+    magmaFloatComplex_ptr dp,
+    magmaFloatComplex_ptr ds,
+    magmaFloatComplex_ptr dt,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_cge3pt(
+    magma_int_t m,
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr dx,
+    magmaFloatComplex_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,1238 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/blas_host/magma_z_no_device.cpp, normal z -> d, Sat Oct 17 00:30:55 2026
+
+       This is simply a copy of the prototypes in magmasparse_d.h of the device routines
+       that the sparse library references, with a body that returns
+       MAGMA_ERR_NOT_SUPPORTED added to each function, since the host
+       backend has neither the sparse device kernels nor cuSPARSE.
+*/
+#include "magmasparse_internal.h"
+
+#ifdef HAVE_HOST
+
+static const char* format = "error: %s is not supported by the host backend.\n";
+
+extern "C" magma_int_t
+magma_dmcsrcompressor_gpu(
+    magma_d_matrix *A,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dparilu_csr(
+    magma_d_matrix A,
+    magma_d_matrix L,
+    magma_d_matrix U,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dparic_csr(
+    magma_d_matrix A,
+    magma_d_matrix A_CSR,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dmatrix_cup_gpu(
+    magma_d_matrix A,
+    magma_d_matrix B,
+    magma_d_matrix *U,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dparilut_sweep_gpu(
+    magma_d_matrix *A,
+    magma_d_matrix *L,
+    magma_d_matrix *U,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dparilut_residuals_gpu(
+    magma_d_matrix A,
+    magma_d_matrix L,
+    magma_d_matrix U,
+    magma_d_matrix *R,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dthrsholdrm_gpu(
+    magma_int_t order,
+    magma_d_matrix* A,
+    double* thrs,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dget_row_ptr(
+    const magma_int_t num_rows,
+    magma_int_t* nnz,
+    const magma_index_t* rowidx,
+    magma_index_t* rowptr,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dparilut_candidates_gpu(
+    magma_d_matrix L0,
+    magma_d_matrix U0,
+    magma_d_matrix L,
+    magma_d_matrix U,
+    magma_d_matrix *L_new,
+    magma_d_matrix *U_new,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dsampleselect(
+    magma_int_t total_size,
+    magma_int_t subset_size,
+    double *val,
+    double *thrs,
+    magma_ptr *tmp_ptr,
+    magma_int_t *tmp_size,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dsampleselect_nodp(
+    magma_int_t total_size,
+    magma_int_t subset_size,
+    double *val,
+    double *thrs,
+    magma_ptr *tmp_ptr,
+    magma_int_t *tmp_size,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_disai_generator_regs(
+    magma_uplo_t uplotype,
+    magma_trans_t transtype,
+    magma_diag_t diagtype,
+    magma_d_matrix L,
+    magma_d_matrix *M,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcsr_sort_gpu(
+    magma_d_matrix *A,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dftjacobicontractions(
+    magma_d_matrix xkm2,
+    magma_d_matrix xkm1,
+    magma_d_matrix xk,
+    magma_d_matrix *z,
+    magma_d_matrix *c,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dftjacobiupdatecheck(
+    double delta,
+    magma_d_matrix *xold,
+    magma_d_matrix *xnew,
+    magma_d_matrix *zprev,
+    magma_d_matrix c,
+    magma_int_t *flag_t,
+    magma_int_t *flag_fp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dlobpcg_res(
+    magma_int_t num_rows,
+    magma_int_t num_vecs,
+    double *evalues,
+    magmaDouble_ptr X,
+    magmaDouble_ptr R,
+    double *res,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dlobpcg_maxpy(
+    magma_int_t num_rows,
+    magma_int_t num_vecs,
+    magmaDouble_ptr X,
+    magmaDouble_ptr Y,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcumilusetup_transpose(
+    magma_d_matrix A, magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcumilusetup(
+    magma_d_matrix A,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcustomilusetup(
+    magma_d_matrix A,
+    magma_d_matrix b,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcustomicsetup(
+    magma_d_matrix A,
+    magma_d_matrix b,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcumilugeneratesolverinfo(
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dapplycumilu_l(
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dapplycumilu_r(
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dapplycumilu_l_transpose(
+    magma_d_matrix b, magma_d_matrix *x,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dapplycumilu_r_transpose(
+    magma_d_matrix b, magma_d_matrix *x,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcumiccsetup(
+    magma_d_matrix A,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcumicgeneratesolverinfo(
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dapplycumicc_l(
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dapplycumicc_r(
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbajac_csr(
+    magma_int_t localiters,
+    magma_d_matrix D,
+    magma_d_matrix R,
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbajac_csr_overlap(
+    magma_int_t localiters,
+    magma_int_t matrices,
+    magma_int_t overlap,
+    magma_d_matrix *D,
+    magma_d_matrix *R,
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcuspmm(
+    magma_d_matrix A,
+    magma_d_matrix B,
+    magma_d_matrix *AB,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcuspaxpy(
+    magmaDouble_ptr alpha, magma_d_matrix A,
+    magmaDouble_ptr beta, magma_d_matrix B,
+    magma_d_matrix *AB,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcompact(
+    magma_int_t m, magma_int_t n,
+    magmaDouble_ptr dA, magma_int_t ldda,
+    double *dnorms, double tol,
+    magma_int_t *activeMask, magma_int_t *cBlockSize,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcompactActive(
+    magma_int_t m, magma_int_t n,
+    magmaDouble_ptr dA, magma_int_t ldda,
+    magma_int_t *active,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dgecsrmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    double lambda,
+    magmaDouble_ptr dval,
+    magmaIndex_ptr drowptr,
+    magmaIndex_ptr dcolind,
+    magmaDouble_ptr dx,
+    double beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaDouble_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dgeellmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    double alpha,
+    double lambda,
+    magmaDouble_ptr dval,
+    magmaIndex_ptr dcolind,
+    magmaDouble_ptr dx,
+    double beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaDouble_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dgeelltmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    double alpha,
+    double lambda,
+    magmaDouble_ptr dval,
+    magmaIndex_ptr dcolind,
+    magmaDouble_ptr dx,
+    double beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaDouble_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_djacobisetup_vector_gpu(
+    magma_int_t num_rows,
+    magma_d_matrix b,
+    magma_d_matrix d,
+    magma_d_matrix c,
+    magma_d_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_djacobi_diagscal(
+    magma_int_t num_rows,
+    magma_d_matrix d,
+    magma_d_matrix b,
+    magma_d_matrix *c,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_djacobiupdate(
+    magma_d_matrix t,
+    magma_d_matrix b,
+    magma_d_matrix d,
+    magma_d_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_djacobispmvupdate(
+    magma_int_t maxiter,
+    magma_d_matrix A,
+    magma_d_matrix t,
+    magma_d_matrix b,
+    magma_d_matrix d,
+    magma_d_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_djacobispmvupdateselect(
+    magma_int_t maxiter,
+    magma_int_t num_updates,
+    magma_index_t *indices,
+    magma_d_matrix A,
+    magma_d_matrix t,
+    magma_d_matrix b,
+    magma_d_matrix d,
+    magma_d_matrix tmp,
+    magma_d_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbicgmerge1(
+    magma_int_t n,
+    magmaDouble_ptr dskp,
+    magmaDouble_ptr dv,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbicgmerge2(
+    magma_int_t n,
+    magmaDouble_ptr dskp,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dv,
+    magmaDouble_ptr ds,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbicgmerge4(
+    magma_int_t type,
+    magmaDouble_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_didr_smoothing_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDouble_ptr drs,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dt,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_didr_smoothing_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double omega,
+    magmaDouble_ptr dx,
+    magmaDouble_ptr dxs,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcgs_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double beta,
+    magmaDouble_ptr r,
+    magmaDouble_ptr q,
+    magmaDouble_ptr u,
+    magmaDouble_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcgs_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDouble_ptr r,
+    magmaDouble_ptr u,
+    magmaDouble_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcgs_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double alpha,
+    magmaDouble_ptr v_hat,
+    magmaDouble_ptr u,
+    magmaDouble_ptr q,
+    magmaDouble_ptr t,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcgs_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double alpha,
+    magmaDouble_ptr u_hat,
+    magmaDouble_ptr t,
+    magmaDouble_ptr x,
+    magmaDouble_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dqmr_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double rho,
+    double psi,
+    magmaDouble_ptr y,
+    magmaDouble_ptr z,
+    magmaDouble_ptr v,
+    magmaDouble_ptr w,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dqmr_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double pde,
+    double rde,
+    magmaDouble_ptr y,
+    magmaDouble_ptr z,
+    magmaDouble_ptr p,
+    magmaDouble_ptr q,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dqmr_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double beta,
+    magmaDouble_ptr pt,
+    magmaDouble_ptr v,
+    magmaDouble_ptr y,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dqmr_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double eta,
+    magmaDouble_ptr p,
+    magmaDouble_ptr pt,
+    magmaDouble_ptr d,
+    magmaDouble_ptr s,
+    magmaDouble_ptr x,
+    magmaDouble_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dqmr_5(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double eta,
+    double pds,
+    magmaDouble_ptr p,
+    magmaDouble_ptr pt,
+    magmaDouble_ptr d,
+    magmaDouble_ptr s,
+    magmaDouble_ptr x,
+    magmaDouble_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dqmr_7(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double beta,
+    magmaDouble_ptr pt,
+    magmaDouble_ptr v,
+    magmaDouble_ptr vt,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dqmr_8(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double rho,
+    double psi,
+    magmaDouble_ptr vt,
+    magmaDouble_ptr wt,
+    magmaDouble_ptr y,
+    magmaDouble_ptr z,
+    magmaDouble_ptr v,
+    magmaDouble_ptr w,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbicgstab_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double beta,
+    double omega,
+    magmaDouble_ptr r,
+    magmaDouble_ptr v,
+    magmaDouble_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbicgstab_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double alpha,
+    magmaDouble_ptr r,
+    magmaDouble_ptr v,
+    magmaDouble_ptr s,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbicgstab_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double alpha,
+    double omega,
+    magmaDouble_ptr p,
+    magmaDouble_ptr s,
+    magmaDouble_ptr t,
+    magmaDouble_ptr x,
+    magmaDouble_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbicgstab_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double alpha,
+    double omega,
+    magmaDouble_ptr y,
+    magmaDouble_ptr z,
+    magmaDouble_ptr s,
+    magmaDouble_ptr t,
+    magmaDouble_ptr x,
+    magmaDouble_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dtfqmr_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double alpha,
+    double sigma,
+    magmaDouble_ptr v,
+    magmaDouble_ptr Au,
+    magmaDouble_ptr u_m,
+    magmaDouble_ptr pu_m,
+    magmaDouble_ptr u_mp1,
+    magmaDouble_ptr w,
+    magmaDouble_ptr d,
+    magmaDouble_ptr Ad,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dtfqmr_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double eta,
+    magmaDouble_ptr d,
+    magmaDouble_ptr Ad,
+    magmaDouble_ptr x,
+    magmaDouble_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dtfqmr_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double beta,
+    magmaDouble_ptr w,
+    magmaDouble_ptr u_m,
+    magmaDouble_ptr u_mp1,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dtfqmr_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double beta,
+    magmaDouble_ptr Au_new,
+    magmaDouble_ptr v,
+    magmaDouble_ptr Au,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dtfqmr_5(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    double alpha,
+    double sigma,
+    magmaDouble_ptr v,
+    magmaDouble_ptr Au,
+    magmaDouble_ptr u_mp1,
+    magmaDouble_ptr w,
+    magmaDouble_ptr d,
+    magmaDouble_ptr Ad,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcgmerge_spmv1(
+    magma_d_matrix A,
+    magmaDouble_ptr d1,
+    magmaDouble_ptr d2,
+    magmaDouble_ptr dd,
+    magmaDouble_ptr dz,
+    magmaDouble_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dcgmerge_xrbeta(
+    magma_int_t n,
+    magmaDouble_ptr d1,
+    magmaDouble_ptr d2,
+    magmaDouble_ptr dx,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dd,
+    magmaDouble_ptr dz,
+    magmaDouble_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dpcgmerge_xrbeta1(
+    magma_int_t n,
+    magmaDouble_ptr dx,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dd,
+    magmaDouble_ptr dz,
+    magmaDouble_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dpcgmerge_xrbeta2(
+    magma_int_t n,
+    magmaDouble_ptr d1,
+    magmaDouble_ptr d2,
+    magmaDouble_ptr dh,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dd,
+    magmaDouble_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_djcgmerge_xrbeta(
+    magma_int_t n,
+    magmaDouble_ptr d1,
+    magmaDouble_ptr d2,
+    magmaDouble_ptr diag,
+    magmaDouble_ptr dx,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dd,
+    magmaDouble_ptr dz,
+    magmaDouble_ptr dh,
+    magmaDouble_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dmdotc(
+    magma_int_t n,
+    magma_int_t k,
+    magmaDouble_ptr dv,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dd1,
+    magmaDouble_ptr dd2,
+    magmaDouble_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dgemvmdot_shfl(
+    magma_int_t n,
+    magma_int_t k,
+    magmaDouble_ptr dv,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dd1,
+    magmaDouble_ptr dd2,
+    magmaDouble_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dgemvmdot(
+    magma_int_t n,
+    magma_int_t k,
+    magmaDouble_ptr dv,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dd1,
+    magmaDouble_ptr dd2,
+    magmaDouble_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dmdotc1(
+    magma_int_t n,
+    magmaDouble_ptr v0,
+    magmaDouble_ptr w0,
+    magmaDouble_ptr d1,
+    magmaDouble_ptr d2,
+    magmaDouble_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dmdotc3(
+    magma_int_t n,
+    magmaDouble_ptr v0,
+    magmaDouble_ptr w0,
+    magmaDouble_ptr v1,
+    magmaDouble_ptr w1,
+    magmaDouble_ptr v2,
+    magmaDouble_ptr w2,
+    magmaDouble_ptr d1,
+    magmaDouble_ptr d2,
+    magmaDouble_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbicgmerge_spmv1(
+    magma_d_matrix A,
+    magmaDouble_ptr dd1,
+    magmaDouble_ptr dd2,
+    magmaDouble_ptr dp,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dv,
+    magmaDouble_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbicgmerge_spmv2(
+    magma_d_matrix A,
+    magmaDouble_ptr dd1,
+    magmaDouble_ptr dd2,
+    magmaDouble_ptr ds,
+    magmaDouble_ptr dt,
+    magmaDouble_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dbicgmerge_xrbeta(
+    magma_int_t n,
+    magmaDouble_ptr dd1,
+    magmaDouble_ptr dd2,
+    magmaDouble_ptr drr,
+    magmaDouble_ptr dr,
+    magmaDouble_ptr dp,
+    magmaDouble_ptr ds,
+    magmaDouble_ptr dt,
+    magmaDouble_ptr dx,
+    magmaDouble_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_dge3pt(
+    magma_int_t m,
+    magma_int_t n,
+    double alpha,
+    double beta,
+    magmaDouble_ptr dx,
+    magmaDouble_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,40 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/blas_host/magma_zc_no_device.cpp, mixed zc -> ds, Sat Oct 17 00:31:02 2026
+
+       This is simply a copy of the prototypes in magmasparse_ds.h of the
+       mixed-precision device routines that the sparse library references,
+       with a body that returns MAGMA_ERR_NOT_SUPPORTED added to each
+       function, since the host backend has neither the sparse device
+       kernels nor cuSPARSE.
+*/
+#include "magmasparse_internal.h"
+
+#ifdef HAVE_HOST
+
+static const char* format = "error: %s is not supported by the host backend.\n";
+
+extern "C" magma_int_t
+magma_dsgecsrmv_mixed_prec(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    magmaDouble_ptr ddiagval,
+    magmaFloat_ptr doffdiagval,
+    magmaIndex_ptr drowptr,
+    magmaIndex_ptr dcolind,
+    magmaDouble_ptr dx,
+    double beta,
+    magmaDouble_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+#endif // HAVE_HOST
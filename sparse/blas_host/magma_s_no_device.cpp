@@ -0,0 +1,1238 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/blas_host/magma_z_no_device.cpp, normal z -> s, Sat Oct 17 00:30:55 2026
+
+       This is simply a copy of the prototypes in magmasparse_s.h of the device routines
+       that the sparse library references, with a body that returns
+       MAGMA_ERR_NOT_SUPPORTED added to each function, since the host
+       backend has neither the sparse device kernels nor cuSPARSE.
+*/
+#include "magmasparse_internal.h"
+
+#ifdef HAVE_HOST
+
+static const char* format = "error: %s is not supported by the host backend.\n";
+
+extern "C" magma_int_t
+magma_smcsrcompressor_gpu(
+    magma_s_matrix *A,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sparilu_csr(
+    magma_s_matrix A,
+    magma_s_matrix L,
+    magma_s_matrix U,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sparic_csr(
+    magma_s_matrix A,
+    magma_s_matrix A_CSR,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_smatrix_cup_gpu(
+    magma_s_matrix A,
+    magma_s_matrix B,
+    magma_s_matrix *U,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sparilut_sweep_gpu(
+    magma_s_matrix *A,
+    magma_s_matrix *L,
+    magma_s_matrix *U,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sparilut_residuals_gpu(
+    magma_s_matrix A,
+    magma_s_matrix L,
+    magma_s_matrix U,
+    magma_s_matrix *R,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sthrsholdrm_gpu(
+    magma_int_t order,
+    magma_s_matrix* A,
+    float* thrs,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sget_row_ptr(
+    const magma_int_t num_rows,
+    magma_int_t* nnz,
+    const magma_index_t* rowidx,
+    magma_index_t* rowptr,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sparilut_candidates_gpu(
+    magma_s_matrix L0,
+    magma_s_matrix U0,
+    magma_s_matrix L,
+    magma_s_matrix U,
+    magma_s_matrix *L_new,
+    magma_s_matrix *U_new,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ssampleselect(
+    magma_int_t total_size,
+    magma_int_t subset_size,
+    float *val,
+    float *thrs,
+    magma_ptr *tmp_ptr,
+    magma_int_t *tmp_size,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ssampleselect_nodp(
+    magma_int_t total_size,
+    magma_int_t subset_size,
+    float *val,
+    float *thrs,
+    magma_ptr *tmp_ptr,
+    magma_int_t *tmp_size,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sisai_generator_regs(
+    magma_uplo_t uplotype,
+    magma_trans_t transtype,
+    magma_diag_t diagtype,
+    magma_s_matrix L,
+    magma_s_matrix *M,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scsr_sort_gpu(
+    magma_s_matrix *A,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sftjacobicontractions(
+    magma_s_matrix xkm2,
+    magma_s_matrix xkm1,
+    magma_s_matrix xk,
+    magma_s_matrix *z,
+    magma_s_matrix *c,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sftjacobiupdatecheck(
+    float delta,
+    magma_s_matrix *xold,
+    magma_s_matrix *xnew,
+    magma_s_matrix *zprev,
+    magma_s_matrix c,
+    magma_int_t *flag_t,
+    magma_int_t *flag_fp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_slobpcg_res(
+    magma_int_t num_rows,
+    magma_int_t num_vecs,
+    float *evalues,
+    magmaFloat_ptr X,
+    magmaFloat_ptr R,
+    float *res,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_slobpcg_maxpy(
+    magma_int_t num_rows,
+    magma_int_t num_vecs,
+    magmaFloat_ptr X,
+    magmaFloat_ptr Y,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scumilusetup_transpose(
+    magma_s_matrix A, magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scumilusetup(
+    magma_s_matrix A,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scustomilusetup(
+    magma_s_matrix A,
+    magma_s_matrix b,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scustomicsetup(
+    magma_s_matrix A,
+    magma_s_matrix b,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scumilugeneratesolverinfo(
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sapplycumilu_l(
+    magma_s_matrix b,
+    magma_s_matrix *x,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sapplycumilu_r(
+    magma_s_matrix b,
+    magma_s_matrix *x,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sapplycumilu_l_transpose(
+    magma_s_matrix b, magma_s_matrix *x,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sapplycumilu_r_transpose(
+    magma_s_matrix b, magma_s_matrix *x,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scumiccsetup(
+    magma_s_matrix A,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scumicgeneratesolverinfo(
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sapplycumicc_l(
+    magma_s_matrix b,
+    magma_s_matrix *x,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sapplycumicc_r(
+    magma_s_matrix b,
+    magma_s_matrix *x,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbajac_csr(
+    magma_int_t localiters,
+    magma_s_matrix D,
+    magma_s_matrix R,
+    magma_s_matrix b,
+    magma_s_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbajac_csr_overlap(
+    magma_int_t localiters,
+    magma_int_t matrices,
+    magma_int_t overlap,
+    magma_s_matrix *D,
+    magma_s_matrix *R,
+    magma_s_matrix b,
+    magma_s_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scuspmm(
+    magma_s_matrix A,
+    magma_s_matrix B,
+    magma_s_matrix *AB,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scuspaxpy(
+    magmaFloat_ptr alpha, magma_s_matrix A,
+    magmaFloat_ptr beta, magma_s_matrix B,
+    magma_s_matrix *AB,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scompact(
+    magma_int_t m, magma_int_t n,
+    magmaFloat_ptr dA, magma_int_t ldda,
+    float *dnorms, float tol,
+    magma_int_t *activeMask, magma_int_t *cBlockSize,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scompactActive(
+    magma_int_t m, magma_int_t n,
+    magmaFloat_ptr dA, magma_int_t ldda,
+    magma_int_t *active,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sgecsrmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    float alpha,
+    float lambda,
+    magmaFloat_ptr dval,
+    magmaIndex_ptr drowptr,
+    magmaIndex_ptr dcolind,
+    magmaFloat_ptr dx,
+    float beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaFloat_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sgeellmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    float alpha,
+    float lambda,
+    magmaFloat_ptr dval,
+    magmaIndex_ptr dcolind,
+    magmaFloat_ptr dx,
+    float beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaFloat_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sgeelltmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    float alpha,
+    float lambda,
+    magmaFloat_ptr dval,
+    magmaIndex_ptr dcolind,
+    magmaFloat_ptr dx,
+    float beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaFloat_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sjacobisetup_vector_gpu(
+    magma_int_t num_rows,
+    magma_s_matrix b,
+    magma_s_matrix d,
+    magma_s_matrix c,
+    magma_s_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sjacobi_diagscal(
+    magma_int_t num_rows,
+    magma_s_matrix d,
+    magma_s_matrix b,
+    magma_s_matrix *c,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sjacobiupdate(
+    magma_s_matrix t,
+    magma_s_matrix b,
+    magma_s_matrix d,
+    magma_s_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sjacobispmvupdate(
+    magma_int_t maxiter,
+    magma_s_matrix A,
+    magma_s_matrix t,
+    magma_s_matrix b,
+    magma_s_matrix d,
+    magma_s_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sjacobispmvupdateselect(
+    magma_int_t maxiter,
+    magma_int_t num_updates,
+    magma_index_t *indices,
+    magma_s_matrix A,
+    magma_s_matrix t,
+    magma_s_matrix b,
+    magma_s_matrix d,
+    magma_s_matrix tmp,
+    magma_s_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbicgmerge1(
+    magma_int_t n,
+    magmaFloat_ptr dskp,
+    magmaFloat_ptr dv,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbicgmerge2(
+    magma_int_t n,
+    magmaFloat_ptr dskp,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dv,
+    magmaFloat_ptr ds,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbicgmerge4(
+    magma_int_t type,
+    magmaFloat_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sidr_smoothing_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloat_ptr drs,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dt,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sidr_smoothing_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float omega,
+    magmaFloat_ptr dx,
+    magmaFloat_ptr dxs,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scgs_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float beta,
+    magmaFloat_ptr r,
+    magmaFloat_ptr q,
+    magmaFloat_ptr u,
+    magmaFloat_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scgs_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaFloat_ptr r,
+    magmaFloat_ptr u,
+    magmaFloat_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scgs_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float alpha,
+    magmaFloat_ptr v_hat,
+    magmaFloat_ptr u,
+    magmaFloat_ptr q,
+    magmaFloat_ptr t,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scgs_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float alpha,
+    magmaFloat_ptr u_hat,
+    magmaFloat_ptr t,
+    magmaFloat_ptr x,
+    magmaFloat_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sqmr_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float rho,
+    float psi,
+    magmaFloat_ptr y,
+    magmaFloat_ptr z,
+    magmaFloat_ptr v,
+    magmaFloat_ptr w,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sqmr_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float pde,
+    float rde,
+    magmaFloat_ptr y,
+    magmaFloat_ptr z,
+    magmaFloat_ptr p,
+    magmaFloat_ptr q,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sqmr_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float beta,
+    magmaFloat_ptr pt,
+    magmaFloat_ptr v,
+    magmaFloat_ptr y,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sqmr_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float eta,
+    magmaFloat_ptr p,
+    magmaFloat_ptr pt,
+    magmaFloat_ptr d,
+    magmaFloat_ptr s,
+    magmaFloat_ptr x,
+    magmaFloat_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sqmr_5(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float eta,
+    float pds,
+    magmaFloat_ptr p,
+    magmaFloat_ptr pt,
+    magmaFloat_ptr d,
+    magmaFloat_ptr s,
+    magmaFloat_ptr x,
+    magmaFloat_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sqmr_7(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float beta,
+    magmaFloat_ptr pt,
+    magmaFloat_ptr v,
+    magmaFloat_ptr vt,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sqmr_8(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float rho,
+    float psi,
+    magmaFloat_ptr vt,
+    magmaFloat_ptr wt,
+    magmaFloat_ptr y,
+    magmaFloat_ptr z,
+    magmaFloat_ptr v,
+    magmaFloat_ptr w,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbicgstab_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float beta,
+    float omega,
+    magmaFloat_ptr r,
+    magmaFloat_ptr v,
+    magmaFloat_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbicgstab_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float alpha,
+    magmaFloat_ptr r,
+    magmaFloat_ptr v,
+    magmaFloat_ptr s,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbicgstab_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float alpha,
+    float omega,
+    magmaFloat_ptr p,
+    magmaFloat_ptr s,
+    magmaFloat_ptr t,
+    magmaFloat_ptr x,
+    magmaFloat_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbicgstab_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float alpha,
+    float omega,
+    magmaFloat_ptr y,
+    magmaFloat_ptr z,
+    magmaFloat_ptr s,
+    magmaFloat_ptr t,
+    magmaFloat_ptr x,
+    magmaFloat_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_stfqmr_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float alpha,
+    float sigma,
+    magmaFloat_ptr v,
+    magmaFloat_ptr Au,
+    magmaFloat_ptr u_m,
+    magmaFloat_ptr pu_m,
+    magmaFloat_ptr u_mp1,
+    magmaFloat_ptr w,
+    magmaFloat_ptr d,
+    magmaFloat_ptr Ad,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_stfqmr_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float eta,
+    magmaFloat_ptr d,
+    magmaFloat_ptr Ad,
+    magmaFloat_ptr x,
+    magmaFloat_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_stfqmr_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float beta,
+    magmaFloat_ptr w,
+    magmaFloat_ptr u_m,
+    magmaFloat_ptr u_mp1,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_stfqmr_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float beta,
+    magmaFloat_ptr Au_new,
+    magmaFloat_ptr v,
+    magmaFloat_ptr Au,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_stfqmr_5(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    float alpha,
+    float sigma,
+    magmaFloat_ptr v,
+    magmaFloat_ptr Au,
+    magmaFloat_ptr u_mp1,
+    magmaFloat_ptr w,
+    magmaFloat_ptr d,
+    magmaFloat_ptr Ad,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scgmerge_spmv1(
+    magma_s_matrix A,
+    magmaFloat_ptr d1,
+    magmaFloat_ptr d2,
+    magmaFloat_ptr dd,
+    magmaFloat_ptr dz,
+    magmaFloat_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_scgmerge_xrbeta(
+    magma_int_t n,
+    magmaFloat_ptr d1,
+    magmaFloat_ptr d2,
+    magmaFloat_ptr dx,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dd,
+    magmaFloat_ptr dz,
+    magmaFloat_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_spcgmerge_xrbeta1(
+    magma_int_t n,
+    magmaFloat_ptr dx,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dd,
+    magmaFloat_ptr dz,
+    magmaFloat_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_spcgmerge_xrbeta2(
+    magma_int_t n,
+    magmaFloat_ptr d1,
+    magmaFloat_ptr d2,
+    magmaFloat_ptr dh,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dd,
+    magmaFloat_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sjcgmerge_xrbeta(
+    magma_int_t n,
+    magmaFloat_ptr d1,
+    magmaFloat_ptr d2,
+    magmaFloat_ptr diag,
+    magmaFloat_ptr dx,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dd,
+    magmaFloat_ptr dz,
+    magmaFloat_ptr dh,
+    magmaFloat_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_smdotc(
+    magma_int_t n,
+    magma_int_t k,
+    magmaFloat_ptr dv,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dd1,
+    magmaFloat_ptr dd2,
+    magmaFloat_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sgemvmdot_shfl(
+    magma_int_t n,
+    magma_int_t k,
+    magmaFloat_ptr dv,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dd1,
+    magmaFloat_ptr dd2,
+    magmaFloat_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sgemvmdot(
+    magma_int_t n,
+    magma_int_t k,
+    magmaFloat_ptr dv,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dd1,
+    magmaFloat_ptr dd2,
+    magmaFloat_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_smdotc1(
+    magma_int_t n,
+    magmaFloat_ptr v0,
+    magmaFloat_ptr w0,
+    magmaFloat_ptr d1,
+    magmaFloat_ptr d2,
+    magmaFloat_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_smdotc3(
+    magma_int_t n,
+    magmaFloat_ptr v0,
+    magmaFloat_ptr w0,
+    magmaFloat_ptr v1,
+    magmaFloat_ptr w1,
+    magmaFloat_ptr v2,
+    magmaFloat_ptr w2,
+    magmaFloat_ptr d1,
+    magmaFloat_ptr d2,
+    magmaFloat_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbicgmerge_spmv1(
+    magma_s_matrix A,
+    magmaFloat_ptr dd1,
+    magmaFloat_ptr dd2,
+    magmaFloat_ptr dp,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dv,
+    magmaFloat_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbicgmerge_spmv2(
+    magma_s_matrix A,
+    magmaFloat_ptr dd1,
+    magmaFloat_ptr dd2,
+    magmaFloat_ptr ds,
+    magmaFloat_ptr dt,
+    magmaFloat_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sbicgmerge_xrbeta(
+    magma_int_t n,
+    magmaFloat_ptr dd1,
+    magmaFloat_ptr dd2,
+    magmaFloat_ptr drr,
+    magmaFloat_ptr dr,
+    magmaFloat_ptr dp,
+    magmaFloat_ptr ds,
+    magmaFloat_ptr dt,
+    magmaFloat_ptr dx,
+    magmaFloat_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_sge3pt(
+    magma_int_t m,
+    magma_int_t n,
+    float alpha,
+    float beta,
+    magmaFloat_ptr dx,
+    magmaFloat_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+#endif // HAVE_HOST
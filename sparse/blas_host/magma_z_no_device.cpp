@@ -0,0 +1,1238 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @precisions normal z -> s d c
+
+       This is simply a copy of the prototypes in magmasparse_z.h of the device routines
+       that the sparse library references, with a body that returns
+       MAGMA_ERR_NOT_SUPPORTED added to each function, since the host
+       backend has neither the sparse device kernels nor cuSPARSE.
+*/
+#include "magmasparse_internal.h"
+
+#ifdef HAVE_HOST
+
+static const char* format = "error: %s is not supported by the host backend.\n";
+
+extern "C" magma_int_t
+magma_zmcsrcompressor_gpu(
+    magma_z_matrix *A,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zparilu_csr(
+    magma_z_matrix A,
+    magma_z_matrix L,
+    magma_z_matrix U,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zparic_csr(
+    magma_z_matrix A,
+    magma_z_matrix A_CSR,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zmatrix_cup_gpu(
+    magma_z_matrix A,
+    magma_z_matrix B,
+    magma_z_matrix *U,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zparilut_sweep_gpu(
+    magma_z_matrix *A,
+    magma_z_matrix *L,
+    magma_z_matrix *U,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zparilut_residuals_gpu(
+    magma_z_matrix A,
+    magma_z_matrix L,
+    magma_z_matrix U,
+    magma_z_matrix *R,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zthrsholdrm_gpu(
+    magma_int_t order,
+    magma_z_matrix* A,
+    double* thrs,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zget_row_ptr(
+    const magma_int_t num_rows,
+    magma_int_t* nnz,
+    const magma_index_t* rowidx,
+    magma_index_t* rowptr,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zparilut_candidates_gpu(
+    magma_z_matrix L0,
+    magma_z_matrix U0,
+    magma_z_matrix L,
+    magma_z_matrix U,
+    magma_z_matrix *L_new,
+    magma_z_matrix *U_new,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zsampleselect(
+    magma_int_t total_size,
+    magma_int_t subset_size,
+    magmaDoubleComplex *val,
+    double *thrs,
+    magma_ptr *tmp_ptr,
+    magma_int_t *tmp_size,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zsampleselect_nodp(
+    magma_int_t total_size,
+    magma_int_t subset_size,
+    magmaDoubleComplex *val,
+    double *thrs,
+    magma_ptr *tmp_ptr,
+    magma_int_t *tmp_size,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zisai_generator_regs(
+    magma_uplo_t uplotype,
+    magma_trans_t transtype,
+    magma_diag_t diagtype,
+    magma_z_matrix L,
+    magma_z_matrix *M,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcsr_sort_gpu(
+    magma_z_matrix *A,
+    magma_queue_t queue)
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zftjacobicontractions(
+    magma_z_matrix xkm2,
+    magma_z_matrix xkm1,
+    magma_z_matrix xk,
+    magma_z_matrix *z,
+    magma_z_matrix *c,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zftjacobiupdatecheck(
+    double delta,
+    magma_z_matrix *xold,
+    magma_z_matrix *xnew,
+    magma_z_matrix *zprev,
+    magma_z_matrix c,
+    magma_int_t *flag_t,
+    magma_int_t *flag_fp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zlobpcg_res(
+    magma_int_t num_rows,
+    magma_int_t num_vecs,
+    double *evalues,
+    magmaDoubleComplex_ptr X,
+    magmaDoubleComplex_ptr R,
+    double *res,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zlobpcg_maxpy(
+    magma_int_t num_rows,
+    magma_int_t num_vecs,
+    magmaDoubleComplex_ptr X,
+    magmaDoubleComplex_ptr Y,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcumilusetup_transpose(
+    magma_z_matrix A, magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcumilusetup(
+    magma_z_matrix A,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcustomilusetup(
+    magma_z_matrix A,
+    magma_z_matrix b,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcustomicsetup(
+    magma_z_matrix A,
+    magma_z_matrix b,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcumilugeneratesolverinfo(
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zapplycumilu_l(
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zapplycumilu_r(
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zapplycumilu_l_transpose(
+    magma_z_matrix b, magma_z_matrix *x,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zapplycumilu_r_transpose(
+    magma_z_matrix b, magma_z_matrix *x,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcumiccsetup(
+    magma_z_matrix A,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcumicgeneratesolverinfo(
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zapplycumicc_l(
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zapplycumicc_r(
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbajac_csr(
+    magma_int_t localiters,
+    magma_z_matrix D,
+    magma_z_matrix R,
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbajac_csr_overlap(
+    magma_int_t localiters,
+    magma_int_t matrices,
+    magma_int_t overlap,
+    magma_z_matrix *D,
+    magma_z_matrix *R,
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcuspmm(
+    magma_z_matrix A,
+    magma_z_matrix B,
+    magma_z_matrix *AB,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcuspaxpy(
+    magmaDoubleComplex_ptr alpha, magma_z_matrix A,
+    magmaDoubleComplex_ptr beta, magma_z_matrix B,
+    magma_z_matrix *AB,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcompact(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    double *dnorms, double tol,
+    magma_int_t *activeMask, magma_int_t *cBlockSize,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcompactActive(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_int_t *active,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zgecsrmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex lambda,
+    magmaDoubleComplex_ptr dval,
+    magmaIndex_ptr drowptr,
+    magmaIndex_ptr dcolind,
+    magmaDoubleComplex_ptr dx,
+    magmaDoubleComplex beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaDoubleComplex_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zgeellmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex lambda,
+    magmaDoubleComplex_ptr dval,
+    magmaIndex_ptr dcolind,
+    magmaDoubleComplex_ptr dx,
+    magmaDoubleComplex beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaDoubleComplex_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zgeelltmv_shift(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex lambda,
+    magmaDoubleComplex_ptr dval,
+    magmaIndex_ptr dcolind,
+    magmaDoubleComplex_ptr dx,
+    magmaDoubleComplex beta,
+    magma_int_t offset,
+    magma_int_t blocksize,
+    magmaIndex_ptr dadd_rows,
+    magmaDoubleComplex_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zjacobisetup_vector_gpu(
+    magma_int_t num_rows,
+    magma_z_matrix b,
+    magma_z_matrix d,
+    magma_z_matrix c,
+    magma_z_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zjacobi_diagscal(
+    magma_int_t num_rows,
+    magma_z_matrix d,
+    magma_z_matrix b,
+    magma_z_matrix *c,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zjacobiupdate(
+    magma_z_matrix t,
+    magma_z_matrix b,
+    magma_z_matrix d,
+    magma_z_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zjacobispmvupdate(
+    magma_int_t maxiter,
+    magma_z_matrix A,
+    magma_z_matrix t,
+    magma_z_matrix b,
+    magma_z_matrix d,
+    magma_z_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zjacobispmvupdateselect(
+    magma_int_t maxiter,
+    magma_int_t num_updates,
+    magma_index_t *indices,
+    magma_z_matrix A,
+    magma_z_matrix t,
+    magma_z_matrix b,
+    magma_z_matrix d,
+    magma_z_matrix tmp,
+    magma_z_matrix *x,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbicgmerge1(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dskp,
+    magmaDoubleComplex_ptr dv,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbicgmerge2(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dskp,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dv,
+    magmaDoubleComplex_ptr ds,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbicgmerge4(
+    magma_int_t type,
+    magmaDoubleComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zidr_smoothing_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex_ptr drs,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dt,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zidr_smoothing_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex omega,
+    magmaDoubleComplex_ptr dx,
+    magmaDoubleComplex_ptr dxs,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcgs_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr r,
+    magmaDoubleComplex_ptr q,
+    magmaDoubleComplex_ptr u,
+    magmaDoubleComplex_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcgs_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex_ptr r,
+    magmaDoubleComplex_ptr u,
+    magmaDoubleComplex_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcgs_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_ptr v_hat,
+    magmaDoubleComplex_ptr u,
+    magmaDoubleComplex_ptr q,
+    magmaDoubleComplex_ptr t,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcgs_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_ptr u_hat,
+    magmaDoubleComplex_ptr t,
+    magmaDoubleComplex_ptr x,
+    magmaDoubleComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zqmr_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex rho,
+    magmaDoubleComplex psi,
+    magmaDoubleComplex_ptr y,
+    magmaDoubleComplex_ptr z,
+    magmaDoubleComplex_ptr v,
+    magmaDoubleComplex_ptr w,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zqmr_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex pde,
+    magmaDoubleComplex rde,
+    magmaDoubleComplex_ptr y,
+    magmaDoubleComplex_ptr z,
+    magmaDoubleComplex_ptr p,
+    magmaDoubleComplex_ptr q,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zqmr_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr pt,
+    magmaDoubleComplex_ptr v,
+    magmaDoubleComplex_ptr y,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zqmr_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex eta,
+    magmaDoubleComplex_ptr p,
+    magmaDoubleComplex_ptr pt,
+    magmaDoubleComplex_ptr d,
+    magmaDoubleComplex_ptr s,
+    magmaDoubleComplex_ptr x,
+    magmaDoubleComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zqmr_5(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex eta,
+    magmaDoubleComplex pds,
+    magmaDoubleComplex_ptr p,
+    magmaDoubleComplex_ptr pt,
+    magmaDoubleComplex_ptr d,
+    magmaDoubleComplex_ptr s,
+    magmaDoubleComplex_ptr x,
+    magmaDoubleComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zqmr_7(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr pt,
+    magmaDoubleComplex_ptr v,
+    magmaDoubleComplex_ptr vt,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zqmr_8(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex rho,
+    magmaDoubleComplex psi,
+    magmaDoubleComplex_ptr vt,
+    magmaDoubleComplex_ptr wt,
+    magmaDoubleComplex_ptr y,
+    magmaDoubleComplex_ptr z,
+    magmaDoubleComplex_ptr v,
+    magmaDoubleComplex_ptr w,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbicgstab_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex omega,
+    magmaDoubleComplex_ptr r,
+    magmaDoubleComplex_ptr v,
+    magmaDoubleComplex_ptr p,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbicgstab_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex_ptr r,
+    magmaDoubleComplex_ptr v,
+    magmaDoubleComplex_ptr s,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbicgstab_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex omega,
+    magmaDoubleComplex_ptr p,
+    magmaDoubleComplex_ptr s,
+    magmaDoubleComplex_ptr t,
+    magmaDoubleComplex_ptr x,
+    magmaDoubleComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbicgstab_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex omega,
+    magmaDoubleComplex_ptr y,
+    magmaDoubleComplex_ptr z,
+    magmaDoubleComplex_ptr s,
+    magmaDoubleComplex_ptr t,
+    magmaDoubleComplex_ptr x,
+    magmaDoubleComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ztfqmr_1(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex sigma,
+    magmaDoubleComplex_ptr v,
+    magmaDoubleComplex_ptr Au,
+    magmaDoubleComplex_ptr u_m,
+    magmaDoubleComplex_ptr pu_m,
+    magmaDoubleComplex_ptr u_mp1,
+    magmaDoubleComplex_ptr w,
+    magmaDoubleComplex_ptr d,
+    magmaDoubleComplex_ptr Ad,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ztfqmr_2(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex eta,
+    magmaDoubleComplex_ptr d,
+    magmaDoubleComplex_ptr Ad,
+    magmaDoubleComplex_ptr x,
+    magmaDoubleComplex_ptr r,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ztfqmr_3(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr w,
+    magmaDoubleComplex_ptr u_m,
+    magmaDoubleComplex_ptr u_mp1,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ztfqmr_4(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr Au_new,
+    magmaDoubleComplex_ptr v,
+    magmaDoubleComplex_ptr Au,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_ztfqmr_5(
+    magma_int_t num_rows,
+    magma_int_t num_cols,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex sigma,
+    magmaDoubleComplex_ptr v,
+    magmaDoubleComplex_ptr Au,
+    magmaDoubleComplex_ptr u_mp1,
+    magmaDoubleComplex_ptr w,
+    magmaDoubleComplex_ptr d,
+    magmaDoubleComplex_ptr Ad,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcgmerge_spmv1(
+    magma_z_matrix A,
+    magmaDoubleComplex_ptr d1,
+    magmaDoubleComplex_ptr d2,
+    magmaDoubleComplex_ptr dd,
+    magmaDoubleComplex_ptr dz,
+    magmaDoubleComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zcgmerge_xrbeta(
+    magma_int_t n,
+    magmaDoubleComplex_ptr d1,
+    magmaDoubleComplex_ptr d2,
+    magmaDoubleComplex_ptr dx,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dd,
+    magmaDoubleComplex_ptr dz,
+    magmaDoubleComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zpcgmerge_xrbeta1(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dx,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dd,
+    magmaDoubleComplex_ptr dz,
+    magmaDoubleComplex_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zpcgmerge_xrbeta2(
+    magma_int_t n,
+    magmaDoubleComplex_ptr d1,
+    magmaDoubleComplex_ptr d2,
+    magmaDoubleComplex_ptr dh,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dd,
+    magmaDoubleComplex_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zjcgmerge_xrbeta(
+    magma_int_t n,
+    magmaDoubleComplex_ptr d1,
+    magmaDoubleComplex_ptr d2,
+    magmaDoubleComplex_ptr diag,
+    magmaDoubleComplex_ptr dx,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dd,
+    magmaDoubleComplex_ptr dz,
+    magmaDoubleComplex_ptr dh,
+    magmaDoubleComplex_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zmdotc(
+    magma_int_t n,
+    magma_int_t k,
+    magmaDoubleComplex_ptr dv,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dd1,
+    magmaDoubleComplex_ptr dd2,
+    magmaDoubleComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zgemvmdot_shfl(
+    magma_int_t n,
+    magma_int_t k,
+    magmaDoubleComplex_ptr dv,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dd1,
+    magmaDoubleComplex_ptr dd2,
+    magmaDoubleComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zgemvmdot(
+    magma_int_t n,
+    magma_int_t k,
+    magmaDoubleComplex_ptr dv,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dd1,
+    magmaDoubleComplex_ptr dd2,
+    magmaDoubleComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zmdotc1(
+    magma_int_t n,
+    magmaDoubleComplex_ptr v0,
+    magmaDoubleComplex_ptr w0,
+    magmaDoubleComplex_ptr d1,
+    magmaDoubleComplex_ptr d2,
+    magmaDoubleComplex_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zmdotc3(
+    magma_int_t n,
+    magmaDoubleComplex_ptr v0,
+    magmaDoubleComplex_ptr w0,
+    magmaDoubleComplex_ptr v1,
+    magmaDoubleComplex_ptr w1,
+    magmaDoubleComplex_ptr v2,
+    magmaDoubleComplex_ptr w2,
+    magmaDoubleComplex_ptr d1,
+    magmaDoubleComplex_ptr d2,
+    magmaDoubleComplex_ptr skp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbicgmerge_spmv1(
+    magma_z_matrix A,
+    magmaDoubleComplex_ptr dd1,
+    magmaDoubleComplex_ptr dd2,
+    magmaDoubleComplex_ptr dp,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dv,
+    magmaDoubleComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbicgmerge_spmv2(
+    magma_z_matrix A,
+    magmaDoubleComplex_ptr dd1,
+    magmaDoubleComplex_ptr dd2,
+    magmaDoubleComplex_ptr ds,
+    magmaDoubleComplex_ptr dt,
+    magmaDoubleComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zbicgmerge_xrbeta(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dd1,
+    magmaDoubleComplex_ptr dd2,
+    magmaDoubleComplex_ptr drr,
+    magmaDoubleComplex_ptr dr,
+    magmaDoubleComplex_ptr dp,
+    magmaDoubleComplex_ptr ds,
+    magmaDoubleComplex_ptr dt,
+    magmaDoubleComplex_ptr dx,
+    magmaDoubleComplex_ptr dskp,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+
+extern "C" magma_int_t
+magma_zge3pt(
+    magma_int_t m,
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex_ptr dx,
+    magmaDoubleComplex_ptr dy,
+    magma_queue_t queue )
+{
+    printf( format, __func__ );
+    return MAGMA_ERR_NOT_SUPPORTED;
+}
+
+#endif // HAVE_HOST
@@ -8,10 +8,11 @@
        @author Mark Gates
 */
 
-#include <cuda.h>  // for CUDA_VERSION
-
 #include "magmasparse_internal.h"
 
+#if ! defined(HAVE_HOST)
+#include <cuda.h>  // for CUDA_VERSION
+
 /**
     Maps a cuSPARSE error to a MAGMA error.
     
@@ -46,3 +47,5 @@ cusparse2magma_error( cusparseStatus_t status )
             break;
     }
 }
+
+#endif // ! HAVE_HOST
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zmatrix_tools.cpp, normal z -> c, Sat Mar 27 20:32:47 2021
+       @generated from sparse/control/magma_zmatrix_tools.cpp, normal z -> c, Fri Oct 16 18:44:46 2026
        @author Hartwig Anzt
 
 */
@@ -21,6 +21,246 @@
 #define AVOID_DUPLICATES
 //#define NANCHECK
 
+/***************************************************************************//**
+    Merge-path engine behind the sparse set operations below.
+    
+    The work of U = A op B is the sequence of all elements of A and B plus one
+    row-end item per row, ordered row by row, and within a row merged by 
+    column with the element of A first on equal columns. This sequence is 
+    split into equal parts, one per thread, by a binary search for the row 
+    and then for the merge-path split inside the row. A row with many 
+    nonzeros is therefore shared by several threads instead of serializing 
+    the whole operation on the thread owning it. An element of A and its 
+    match in B always go to the same thread.
+    
+    Every thread merges its part exactly once and stores the source of each
+    kept element (a for A, -1-b for B) into U->rowidx, at the position of 
+    its first A (and B, for the union) element. This bound can not be 
+    overtaken by the output, so no counting pass is needed. After a scan of 
+    the per-thread counts, the column indices and values are gathered to 
+    their final place and the row indices are written over the sources.
+    
+    U has to be empty or set up by magma_cmatrix_reserve for A.num_rows rows.
+*******************************************************************************/
+
+typedef enum {
+    Magma_SETOP_CUP,            // A \cup B, values of A where both exist
+    Magma_SETOP_CAP,            // A \cap B, values one
+    Magma_SETOP_NEGCAP,         // A \ B, values of A
+    Magma_SETOP_TRIL_NEGCAP,    // tril(A) \ B, values of A
+    Magma_SETOP_TRIU_NEGCAP     // triu(A) \ B, values of A
+} magma_csetop_t;
+
+
+// position in the merge-path of a set operation
+typedef struct {
+    magma_int_t row;
+    magma_int_t a;
+    magma_int_t b;
+} magma_csetop_split_t;
+
+
+static magma_csetop_split_t
+magma_cmatrix_setop_split(
+    magma_c_matrix A,
+    magma_c_matrix B,
+    long long diag )
+{
+    magma_csetop_split_t s;
+    magma_int_t lo = 0, hi = A.num_rows - 1;
+    
+    // last row starting at or before diag; the row starts are strictly 
+    // increasing as every row holds its row-end item
+    while (lo < hi) {
+        magma_int_t mid = lo + (hi - lo + 1)/2;
+        if ((long long) mid + A.row[mid] + B.row[mid] <= diag) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    s.row = lo;
+    
+    // merge-path split of the row: first i with A[i] > B[k-1-i]
+    magma_int_t a0 = A.row[lo], lena = A.row[lo+1] - a0;
+    magma_int_t b0 = B.row[lo], lenb = B.row[lo+1] - b0;
+    magma_int_t k = (magma_int_t) (diag - lo - a0 - b0);
+    k = min(k, lena + lenb);
+    magma_int_t ilo = max(0, k - lenb), ihi = min(k, lena);
+    while (ilo < ihi) {
+        magma_int_t mid = (ilo + ihi)/2;
+        if (A.col[a0 + mid] <= B.col[b0 + k - 1 - mid]) {
+            ilo = mid + 1;
+        } else {
+            ihi = mid;
+        }
+    }
+    magma_int_t i = ilo, j = k - ilo;
+    // do not separate a matching pair
+    if (i > 0 && j < lenb && A.col[a0 + i - 1] == B.col[b0 + j]) {
+        j++;
+    }
+    s.a = a0 + i;
+    s.b = b0 + j;
+    return s;
+}
+
+
+static magma_int_t
+magma_cmatrix_setop(
+    magma_csetop_t op,
+    magma_c_matrix A,
+    magma_c_matrix B,
+    magma_c_matrix *U,
+    magma_queue_t queue)
+{
+    magma_int_t info = 0;
+    magma_index_t *offset = NULL;
+    // avoids the allocation in the ParILUT sweeps for common thread counts
+    magma_index_t offset_local[ 257 ];
+    magma_int_t num_threads = 1;
+    magma_int_t bound;
+    long long work;
+    magma_int_t used_threads = 1;
+    
+    assert(A.num_rows == B.num_rows);
+    U->num_cols = A.num_cols;
+    
+    bound = A.row[A.num_rows];
+    if (op == Magma_SETOP_CUP) {
+        bound += B.row[B.num_rows];
+    }
+    CHECK(magma_cmatrix_reserve(A.num_rows, bound, U, queue));
+    U->row[0] = 0;
+    if (A.num_rows == 0) {
+        U->nnz = 0;
+        goto cleanup;
+    }
+    
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    if (num_threads < 257) {
+        offset = offset_local;
+    } else {
+        CHECK(magma_index_malloc_cpu(&offset, num_threads+1));
+    }
+    work = (long long) A.num_rows + A.row[A.num_rows] + B.row[B.num_rows];
+    offset[0] = 0;
+    
+    #pragma omp parallel num_threads(num_threads)
+    {
+#ifdef _OPENMP
+        magma_int_t id = omp_get_thread_num();
+        magma_int_t nt = omp_get_num_threads();
+#else
+        magma_int_t id = 0;
+        magma_int_t nt = 1;
+#endif
+        magma_csetop_split_t s = 
+            magma_cmatrix_setop_split(A, B, work * id / nt);
+        magma_csetop_split_t e = ( id == nt-1 ) ?
+            magma_cmatrix_setop_split(A, B, work - 1) :
+            magma_cmatrix_setop_split(A, B, work * (id+1) / nt);
+        // the last thread also takes the final row-end item
+        magma_int_t last = ( id == nt-1 ) ? A.num_rows : e.row;
+        magma_index_t *src = U->rowidx + 
+            ( (op == Magma_SETOP_CUP) ? s.a + s.b : s.a );
+        magma_int_t cnt = 0;
+        magma_int_t row = s.row;
+        magma_int_t a = s.a;
+        magma_int_t b = s.b;
+        
+        while (row < last || (row == e.row && (a < e.a || b < e.b))) {
+            magma_int_t enda = ( row == e.row ) ? e.a : A.row[row+1];
+            magma_int_t endb = ( row == e.row ) ? e.b : B.row[row+1];
+            while (a < enda || b < endb) {
+                magma_int_t acol = ( a < enda ) ? A.col[a] : -1;
+                magma_int_t bcol = ( b < endb ) ? B.col[b] : -1;
+                if (b == endb || (a < enda && acol < bcol)) {
+                    // only in A
+                    if ((op == Magma_SETOP_CUP && acol != -1)
+                        || op == Magma_SETOP_NEGCAP
+                        || (op == Magma_SETOP_TRIL_NEGCAP && acol <= row)
+                        || (op == Magma_SETOP_TRIU_NEGCAP && acol >= row)) {
+                        src[cnt++] = a;
+                    }
+                    a++;
+                } else if (a == enda || bcol < acol) {
+                    // only in B
+                    if (op == Magma_SETOP_CUP && bcol != -1) {
+                        src[cnt++] = -1 - b;
+                    }
+                    b++;
+                } else {
+                    // in both
+                    if ((op == Magma_SETOP_CUP && acol != -1)
+                        || op == Magma_SETOP_CAP) {
+                        src[cnt++] = a;
+                    }
+                    a++;
+                    b++;
+                }
+            }
+            if (row < last) {
+                // row-end item, converted to the global offset later
+                U->row[row+1] = cnt;
+                row++;
+                if (row < A.num_rows) {
+                    a = A.row[row];
+                    b = B.row[row];
+                }
+            } else {
+                break;
+            }
+        }
+        offset[id+1] = cnt;
+        
+        #pragma omp barrier
+        #pragma omp single
+        {
+            used_threads = nt;
+            for (magma_int_t t=0; t<nt; t++) {
+                offset[t+1] += offset[t];
+            }
+        }
+        
+        magma_int_t start = offset[id];
+        for (magma_int_t r=s.row; r<last; r++) {
+            U->row[r+1] += start;
+        }
+        for (magma_int_t k=0; k<cnt; k++) {
+            magma_int_t i = src[k];
+            if (i < 0) {
+                U->col[start + k] = B.col[-1 - i];
+                U->val[start + k] = B.val[-1 - i];
+            } else {
+                U->col[start + k] = A.col[i];
+                U->val[start + k] = ( op == Magma_SETOP_CAP ) ?
+                    MAGMA_C_ONE : A.val[i];
+            }
+        }
+        
+        // the sources of the other threads are not needed anymore
+        #pragma omp barrier
+        magma_int_t k = start;
+        for (magma_int_t r=s.row; r<=last && r<A.num_rows; r++) {
+            magma_int_t end = ( r < last ) ? U->row[r+1] : start + cnt;
+            for (; k<end; k++) {
+                U->rowidx[k] = r;
+            }
+        }
+    }
+    U->nnz = offset[used_threads];
+    
+cleanup:
+    if (offset != offset_local) {
+        magma_free_cpu(offset);
+    }
+    return info;
+}
+
+
 /***************************************************************************//**
     Purpose
     -------
@@ -57,145 +297,56 @@ magma_cmatrix_cup(
     magma_c_matrix *U,
     magma_queue_t queue)
 {
-    magma_int_t info = 0;
-    assert(A.num_rows == B.num_rows);
-    U->num_rows = A.num_rows;
-    U->num_cols = A.num_cols;
-    U->storage_type = Magma_CSR;
-    U->memory_location = Magma_CPU;
-    
-    CHECK(magma_index_malloc_cpu(&U->row, U->num_rows+1));
-    #pragma omp parallel for
-    for (magma_int_t row=0; row<A.num_rows; row++) {
-        magma_int_t add = 0;
-        magma_int_t a = A.row[row];
-        magma_int_t b = B.row[row];
-        magma_int_t enda = A.row[ row+1 ];
-        magma_int_t endb = B.row[ row+1 ]; 
-        magma_int_t acol;
-        magma_int_t bcol;
-        if(a<enda && b<endb) {
-            do{
-                acol = A.col[ a ];
-                bcol = B.col[ b ];
-                
-                if(acol == -1) { // stop in case acol = -1
-                    a++;
-                } 
-                else if(bcol == -1) { // stop in case bcol = -1
-                    b++;
-                }
-                else if(acol == bcol) {
-                    add++;
-                    a++;
-                    b++;
-                }
-                else if(acol<bcol) {
-                    add++;
-                    a++;
-                }
-                else {
-                    add++;
-                    b++;
-                }
-            }while(a<enda && b<endb);
-        }
-        // now th rest - if existing
-        if(a<enda) {
-            do{
-                add++;
-                a++;
-            }while(a<enda);            
-        }
-        if(b<endb) {
-            do{
-                add++;
-                b++;
-            }while(b<endb);            
-        }
-        U->row[ row+1 ] = add; 
-    }
+    U->row = NULL;
+    U->rowidx = NULL;
+    U->col = NULL;
+    U->val = NULL;
+    U->true_nnz = 0;
     
-    // get the total element count
-    U->row[ 0 ] = 0;
-    CHECK(magma_cmatrix_createrowptr(U->num_rows, U->row, queue));
-    U->nnz = U->row[ U->num_rows ];
-        
-    CHECK(magma_cmalloc_cpu(&U->val, U->nnz));
-    CHECK(magma_index_malloc_cpu(&U->rowidx, U->nnz));
-    CHECK(magma_index_malloc_cpu(&U->col, U->nnz));
-    #pragma omp parallel for
-    for (magma_int_t i=0; i<U->nnz; i++) {
-        U->val[i] = MAGMA_C_ONE;
-    }
-    #pragma omp parallel for
-    for (magma_int_t row=0; row<A.num_rows; row++) {
-        magma_int_t add = 0;
-        magma_int_t offset = U->row[row];
-        magma_int_t a = A.row[row];
-        magma_int_t b = B.row[row];
-        magma_int_t enda = A.row[ row+1 ];
-        magma_int_t endb = B.row[ row+1 ]; 
-        magma_int_t acol;
-        magma_int_t bcol;
-        if(a<enda && b<endb) {
-            do{
-                acol = A.col[ a ];
-                bcol = B.col[ b ];
-                if(acol == -1) { // stop in case acol = -1
-                    a++;
-                } 
-                else if(bcol == -1) { // stop in case bcol = -1
-                    b++;
-                }
-                else if(acol == bcol) {
-                    U->col[ offset + add ] = acol;
-                    U->rowidx[ offset + add ] = row;
-                    U->val[ offset + add ] = A.val[ a ];
-                    add++;
-                    a++;
-                    b++;
-                }
-                else if(acol<bcol) {
-                    U->col[ offset + add ] = acol;
-                    U->rowidx[ offset + add ] = row;
-                    U->val[ offset + add ] = A.val[ a ];
-                    add++;
-                    a++;
-                }
-                else {
-                    U->col[ offset + add ] = bcol;
-                    U->rowidx[ offset + add ] = row;
-                    U->val[ offset + add ] = B.val[ b ];
-                    add++;
-                    b++;
-                }
-            }while(a<enda && b<endb);
-        }
-        // now th rest - if existing
-        if(a<enda) {
-            do{
-                acol = A.col[ a ];
-                U->col[ offset + add ] = acol;
-                U->rowidx[ offset + add ] = row;
-                U->val[ offset + add ] = A.val[ a ];
-                add++;
-                a++;
-            }while(a<enda);            
-        }
-        if(b<endb) {
-            do{
-                bcol = B.col[ b ];
-                U->col[ offset + add ] = bcol;
-                U->rowidx[ offset + add ] = row;
-                U->val[ offset + add ] = B.val[ b ];
-                add++;
-                b++;
-            }while(b<endb);            
-        }
-    }
-cleanup:
-    return info;
+    return magma_cmatrix_cup_ws(A, B, U, queue);
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    Generates a matrix  U = A \cup B like magma_cmatrix_cup, but writes into
+    the arrays U already holds. U has to be empty or set up by 
+    magma_cmatrix_reserve for A.num_rows rows; the arrays are only 
+    reallocated if they can not hold A.nnz + B.nnz elements, which is also
+    used as merge buffer.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_c_matrix
+                Input matrix 1.
+
+    @param[in]
+    B           magma_c_matrix
+                Input matrix 2.
+
+    @param[in,out]
+    U           magma_c_matrix*
+                Not a real matrix, but the list of all matrix entries included 
+                in either A or B. No duplicates.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_caux
+*******************************************************************************/
+
+extern "C" magma_int_t
+magma_cmatrix_cup_ws(
+    magma_c_matrix A,
+    magma_c_matrix B,
+    magma_c_matrix *U,
+    magma_queue_t queue)
+{
+    return magma_cmatrix_setop(Magma_SETOP_CUP, A, B, U, queue);
 }
 
 
@@ -235,86 +386,13 @@ magma_cmatrix_cap(
     magma_c_matrix *U,
     magma_queue_t queue)
 {
-    magma_int_t info = 0;
-    //printf("\n"); fflush(stdout);
-    // parallel for using openmp
-    assert(A.num_rows == B.num_rows);
-    U->num_rows = A.num_rows;
-    U->num_cols = A.num_cols;
-    U->storage_type = Magma_CSR;
-    U->memory_location = Magma_CPU;
-    
-    CHECK(magma_index_malloc_cpu(&U->row, A.num_rows+1));
-    #pragma omp parallel for
-    for (magma_int_t row=0; row<A.num_rows; row++) {
-        magma_int_t add = 0;
-        magma_int_t a = A.row[row];
-        magma_int_t b = B.row[row];
-        magma_int_t enda = A.row[ row+1 ];
-        magma_int_t endb = B.row[ row+1 ]; 
-        magma_int_t acol;
-        magma_int_t bcol;
-        do{
-            acol = A.col[ a ];
-            bcol = B.col[ b ];
-            if(acol == bcol) {
-                add++;
-                a++;
-                b++;
-            }
-            else if(acol<bcol) {
-                a++;
-            }
-            else {
-                b++;
-            }
-        }while(a<enda && b<endb);
-        U->row[ row+1 ] = add; 
-    }
-     
-        // new row pointer
-    U->row[ 0 ] = 0;
-    CHECK(magma_cmatrix_createrowptr(U->num_rows, U->row, queue));
-    U->nnz = U->row[ U->num_rows ];
-    
-    CHECK(magma_cmalloc_cpu(&U->val, U->nnz));
-    CHECK(magma_index_malloc_cpu(&U->rowidx, U->nnz));
-    CHECK(magma_index_malloc_cpu(&U->col, U->nnz));
-    #pragma omp parallel for
-    for (magma_int_t i=0; i<U->nnz; i++) {
-        U->val[i] = MAGMA_C_ONE;
-    }
+    U->row = NULL;
+    U->rowidx = NULL;
+    U->col = NULL;
+    U->val = NULL;
+    U->true_nnz = 0;
     
-    #pragma omp parallel for
-    for (magma_int_t row=0; row<A.num_rows; row++) {
-        magma_int_t add = 0;
-        magma_int_t offset = U->row[row];
-        magma_int_t a = A.row[row];
-        magma_int_t b = B.row[row];
-        magma_int_t enda = A.row[ row+1 ];
-        magma_int_t endb = B.row[ row+1 ]; 
-        magma_int_t acol;
-        magma_int_t bcol;
-        do{
-            acol = A.col[ a ];
-            bcol = B.col[ b ];
-            if(acol == bcol) {
-                U->col[ offset + add ] = acol;
-                U->rowidx[ offset + add ] = row;
-                add++;
-                a++;
-                b++;
-            }
-            else if(acol<bcol) {
-                a++;
-            }
-            else {
-                b++;
-            }
-        }while(a<enda && b<endb);
-    }
-cleanup:
-    return info;
+    return magma_cmatrix_setop(Magma_SETOP_CAP, A, B, U, queue);
 }
 
 
@@ -355,102 +433,13 @@ magma_cmatrix_negcap(
     magma_c_matrix *U,
     magma_queue_t queue)
 {
-    magma_int_t info = 0;
-    //printf("\n"); fflush(stdout);
-    // parallel for using openmp
-    assert(A.num_rows == B.num_rows);
-    U->num_rows = A.num_rows;
-    U->num_cols = A.num_cols;
-    U->storage_type = Magma_CSR;
-    U->memory_location = Magma_CPU;
+    U->row = NULL;
+    U->rowidx = NULL;
+    U->col = NULL;
+    U->val = NULL;
+    U->true_nnz = 0;
     
-    CHECK(magma_index_malloc_cpu(&U->row, A.num_rows+1));
-    #pragma omp parallel for
-    for (magma_int_t row=0; row<A.num_rows; row++) {
-        magma_int_t add = 0;
-        magma_int_t a = A.row[row];
-        magma_int_t b = B.row[row];
-        magma_int_t enda = A.row[ row+1 ];
-        magma_int_t endb = B.row[ row+1 ]; 
-        magma_int_t acol;
-        magma_int_t bcol;
-        do{
-            acol = A.col[ a ];
-            bcol = B.col[ b ];
-            if(acol == bcol) {
-                a++;
-                b++;
-            }
-            else if(acol<bcol) {
-                add++;
-                a++;
-            }
-            else {
-                b++;
-            }
-        }while(a<enda && b<endb);
-        // now th rest - if existing
-        if(a<enda) {
-            do{
-                add++;
-                a++;
-            }while(a<enda);            
-        }
-        U->row[ row+1 ] = add; 
-    }
-        
-    // new row pointer
-    U->row[ 0 ] = 0;
-    CHECK(magma_cmatrix_createrowptr(U->num_rows, U->row, queue));
-    U->nnz = U->row[ U->num_rows ];
-    
-    CHECK(magma_cmalloc_cpu(&U->val, U->nnz));
-    CHECK(magma_index_malloc_cpu(&U->rowidx, U->nnz));
-    CHECK(magma_index_malloc_cpu(&U->col, U->nnz));
-    
-    #pragma omp parallel for
-    for (magma_int_t row=0; row<A.num_rows; row++) {
-        magma_int_t add = 0;
-        magma_int_t offset = U->row[row];
-        magma_int_t a = A.row[row];
-        magma_int_t b = B.row[row];
-        magma_int_t enda = A.row[ row+1 ];
-        magma_int_t endb = B.row[ row+1 ]; 
-        magma_int_t acol;
-        magma_int_t bcol;
-        do{
-            acol = A.col[ a ];
-            bcol = B.col[ b ];
-            if(acol == bcol) {
-                a++;
-                b++;
-            }
-            else if(acol<bcol) {
-                U->col[ offset + add ] = acol;
-                U->rowidx[ offset + add ] = row;
-                U->val[ offset + add ] = A.val[a];
-                add++;
-                a++;
-            }
-            else {
-                b++;
-            }
-        }while(a<enda && b<endb);
-        // now th rest - if existing
-        if(a<enda) {
-            do{
-                acol = A.col[ a ];
-                U->col[ offset + add ] = acol;
-                U->rowidx[ offset + add ] = row;
-                U->val[ offset + add ] = A.val[a];
-                add++;
-                a++;
-            }while(a<enda);            
-        }
-    }
-
-cleanup:
-    return info;
+    return magma_cmatrix_setop(Magma_SETOP_NEGCAP, A, B, U, queue);
 }
 
 
@@ -491,124 +480,13 @@ magma_cmatrix_tril_negcap(
     magma_c_matrix *U,
     magma_queue_t queue)
 {
-    magma_int_t info = 0;
-    //printf("\n"); fflush(stdout);
-    // parallel for using openmp
-    assert(A.num_rows == B.num_rows);
-    U->num_rows = A.num_rows;
-    U->num_cols = A.num_cols;
-    U->storage_type = Magma_CSR;
-    U->memory_location = Magma_CPU;
-    
-    CHECK(magma_index_malloc_cpu(&U->row, A.num_rows+1));
-    #pragma omp parallel for
-    for (magma_int_t row=0; row<A.num_rows; row++) {
-        magma_int_t add = 0;
-        magma_int_t a = A.row[row];
-        magma_int_t b = B.row[row];
-        magma_int_t enda = A.row[ row+1 ];
-        magma_int_t endb = B.row[ row+1 ]; 
-        magma_int_t acol;
-        magma_int_t bcol;
-        if(a<enda && b<endb) {
-            do{
-                acol = A.col[ a ];
-                bcol = B.col[ b ];
-                if(acol > row) {
-                    a = enda;
-                    break;    
-                }
-                if(acol == bcol) {
-                    a++;
-                    b++;
-                }
-                else if(acol<bcol) {
-                    add++;
-                    a++;
-                }
-                else {
-                    b++;
-                }
-            }while(a<enda && b<endb);
-        }
-        // now th rest - if existing
-        if(a<enda) {
-            do{
-                acol = A.col[ a ];
-                if(acol > row) {
-                    a = enda;
-                    break;    
-                } else {
-                    add++;
-                    a++;
-                }
-            }while(a<enda);            
-        }
-        U->row[ row+1 ] = add; 
-    }
-        
-    // new row pointer
-    U->row[ 0 ] = 0;
-    CHECK(magma_cmatrix_createrowptr(U->num_rows, U->row, queue));
-    U->nnz = U->row[ U->num_rows ];
-    
-    CHECK(magma_cmalloc_cpu(&U->val, U->nnz));
-    CHECK(magma_index_malloc_cpu(&U->rowidx, U->nnz));
-    CHECK(magma_index_malloc_cpu(&U->col, U->nnz));
+    U->row = NULL;
+    U->rowidx = NULL;
+    U->col = NULL;
+    U->val = NULL;
+    U->true_nnz = 0;
     
-    #pragma omp parallel for
-    for (magma_int_t row=0; row<A.num_rows; row++) {
-        magma_int_t add = 0;
-        magma_int_t offset = U->row[row];
-        magma_int_t a = A.row[row];
-        magma_int_t b = B.row[row];
-        magma_int_t enda = A.row[ row+1 ];
-        magma_int_t endb = B.row[ row+1 ]; 
-        magma_int_t acol;
-        magma_int_t bcol;
-        if(a<enda && b<endb) {
-            do{
-                acol = A.col[ a ];
-                bcol = B.col[ b ];
-                if(acol > row) {
-                    a = enda;
-                    break;    
-                }
-                if(acol == bcol) {
-                    a++;
-                    b++;
-                }
-                else if(acol<bcol) {
-                    U->col[ offset + add ] = acol;
-                    U->rowidx[ offset + add ] = row;
-                    U->val[ offset + add ] = A.val[a];
-                    add++;
-                    a++;
-                }
-                else {
-                    b++;
-                }
-            }while(a<enda && b<endb);
-        }
-        // now th rest - if existing
-        if(a<enda) {
-            do{
-                acol = A.col[ a ];
-                if(acol > row) {
-                    a = enda;
-                    break;    
-                } else {
-                    U->col[ offset + add ] = acol;
-                    U->rowidx[ offset + add ] = row;
-                    U->val[ offset + add ] = A.val[a];
-                    add++;
-                    a++;
-                }
-            }while(a<enda);            
-        }
-    }
-cleanup:
-    return info;
+    return magma_cmatrix_setop(Magma_SETOP_TRIL_NEGCAP, A, B, U, queue);
 }
 
 
@@ -648,121 +526,13 @@ magma_cmatrix_triu_negcap(
     magma_c_matrix *U,
     magma_queue_t queue)
 {
-    magma_int_t info = 0;
-    assert(A.num_rows == B.num_rows);
-    U->num_rows = A.num_rows;
-    U->num_cols = A.num_cols;
-    U->storage_type = Magma_CSR;
-    U->memory_location = Magma_CPU;
-    
-    CHECK(magma_index_malloc_cpu(&U->row, A.num_rows+1));
-    #pragma omp parallel for
-    for (magma_int_t row=0; row<A.num_rows; row++) {
-        magma_int_t add = 0;
-        magma_int_t a = A.row[row];
-        magma_int_t b = B.row[row];
-        magma_int_t enda = A.row[ row+1 ];
-        magma_int_t endb = B.row[ row+1 ]; 
-        magma_int_t acol;
-        magma_int_t bcol;
-        if(a<enda && b<endb) {
-            do{
-                acol = A.col[ a ];
-                bcol = B.col[ b ];
-                if(acol == bcol) {
-                    a++;
-                    b++;
-                }
-                else if(acol<bcol) {
-                    if(acol >= row) {
-                        add++;
-                        a++;
-                    } else {
-                        a++;
-                    }
-                }
-                else {
-                    b++;
-                }
-            }while(a<enda && b<endb);
-        }
-        // now th rest - if existing
-        if(a<enda) {
-            do{
-                acol = A.col[ a ];
-                if(acol >= row) {
-                    add++;
-                    a++;
-                } else {
-                    a++;
-                }
-            }while(a<enda);            
-        }
-        U->row[ row+1 ] = add; 
-    }
-        
-    // new row pointer
-    U->row[ 0 ] = 0;
-    CHECK(magma_cmatrix_createrowptr(U->num_rows, U->row, queue));
-    U->nnz = U->row[ U->num_rows ];
-    
-    CHECK(magma_cmalloc_cpu(&U->val, U->nnz));
-    CHECK(magma_index_malloc_cpu(&U->rowidx, U->nnz));
-    CHECK(magma_index_malloc_cpu(&U->col, U->nnz));
+    U->row = NULL;
+    U->rowidx = NULL;
+    U->col = NULL;
+    U->val = NULL;
+    U->true_nnz = 0;
     
-    #pragma omp parallel for
-    for (magma_int_t row=0; row<A.num_rows; row++) {
-        magma_int_t add = 0;
-        magma_int_t offset = U->row[row];
-        magma_int_t a = A.row[row];
-        magma_int_t b = B.row[row];
-        magma_int_t enda = A.row[ row+1 ];
-        magma_int_t endb = B.row[ row+1 ]; 
-        magma_int_t acol;
-        magma_int_t bcol;
-        if(a<enda && b<endb) {
-            do{
-                acol = A.col[ a ];
-                bcol = B.col[ b ];
-                if(acol == bcol) {
-                    a++;
-                    b++;
-                }
-                else if(acol<bcol) {
-                    if(acol >= row) {
-                        U->col[ offset + add ] = acol;
-                        U->rowidx[ offset + add ] = row;
-                        U->val[ offset + add ] = A.val[a];
-                        add++;
-                        a++;
-                    } else {
-                        a++;
-                    }
-                }
-                else {
-                    b++;
-                }
-            }while(a<enda && b<endb);
-        }
-        // now th rest - if existing
-        if(a<enda) {
-            do{
-                acol = A.col[ a ];
-                if(acol >= row) {
-                    U->col[ offset + add ] = acol;
-                    U->rowidx[ offset + add ] = row;
-                    U->val[ offset + add ] = A.val[a];
-                    add++;
-                    a++;
-                } else {
-                    a++;
-                }
-            }while(a<enda);            
-        }
-    }
-
-cleanup:
-    return info;
+    return magma_cmatrix_setop(Magma_SETOP_TRIU_NEGCAP, A, B, U, queue);
 }
 
 
@@ -836,6 +606,61 @@ magma_ccsrcoo_transpose(
     magma_c_matrix A,
     magma_c_matrix *B,
     magma_queue_t queue)
+{
+    magma_int_t info = 0;
+    magma_c_parilut_workspace ws={0};
+    
+    B->row = NULL;
+    B->rowidx = NULL;
+    B->col = NULL;
+    B->val = NULL;
+    B->true_nnz = 0;
+    
+    info = magma_ccsrcoo_transpose_ws(A, B, &ws, queue);
+    B->storage_type = A.storage_type;
+    B->memory_location = A.memory_location;
+    
+    magma_cparilut_workspace_free(&ws, queue);
+    return info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    Transposes a matrix that already contains rowidx like 
+    magma_ccsrcoo_transpose, but writes into the arrays B already holds and 
+    takes the linked list from the scratch of the workspace. B has to be empty
+    or set up by magma_cmatrix_reserve for A.num_rows rows.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_c_matrix
+                Matrix to transpose.
+                
+    @param[in,out]
+    B           magma_c_matrix*
+                Transposed matrix.
+
+    @param[in,out]
+    ws          magma_c_parilut_workspace*
+                Workspace providing the scratch.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_caux
+*******************************************************************************/
+
+extern "C" magma_int_t
+magma_ccsrcoo_transpose_ws(
+    magma_c_matrix A,
+    magma_c_matrix *B,
+    magma_c_parilut_workspace *ws,
+    magma_queue_t queue)
 {
     magma_int_t info = 0;
     magma_index_t *linked_list;
@@ -844,20 +669,13 @@ magma_ccsrcoo_transpose(
     
     magma_int_t el_per_block, num_threads=1;
     
-    B->storage_type = A.storage_type;
-    B->memory_location = A.memory_location;
-    
-    B->num_rows = A.num_rows;
     B->num_cols = A.num_cols;
-    B->nnz      = A.nnz;
-    
-    CHECK(magma_index_malloc_cpu(&linked_list, A.nnz));
-    CHECK(magma_index_malloc_cpu(&row_ptr, A.num_rows+1));
-    CHECK(magma_index_malloc_cpu(&last_rowel, A.num_rows+1));
-    CHECK(magma_index_malloc_cpu(&B->row, A.num_rows+1));
-    CHECK(magma_index_malloc_cpu(&B->rowidx, A.nnz));
-    CHECK(magma_index_malloc_cpu(&B->col, A.nnz));
-    CHECK(magma_cmalloc_cpu(&B->val, A.nnz));
+    
+    CHECK(magma_cmatrix_reserve(A.num_rows, A.nnz, B, queue));
+    CHECK(magma_cparilut_workspace_scratch(A.nnz+2*(A.num_rows+1), 0, ws, queue));
+    linked_list = ws->index;
+    row_ptr = linked_list + A.nnz;
+    last_rowel = row_ptr + A.num_rows+1;
 #ifdef _OPENMP
     #pragma omp parallel
     {
@@ -925,9 +743,6 @@ magma_ccsrcoo_transpose(
     }
     
 cleanup:
-    magma_free_cpu(row_ptr);
-    magma_free_cpu(last_rowel);
-    magma_free_cpu(linked_list);
     return info;
 }
 
@@ -967,6 +782,8 @@ magma_cmatrix_createrowptr(
 {
     magma_int_t info = 0;
     magma_index_t *offset=NULL;
+    // avoids the allocation in the ParILUT sweeps for common thread counts
+    magma_index_t offset_local[ 257 ];
     
     magma_int_t el_per_block, num_threads;
     magma_int_t loc_offset = 0;
@@ -979,7 +796,11 @@ magma_cmatrix_createrowptr(
 #else
     num_threads = 1;
 #endif
-    CHECK(magma_index_malloc_cpu(&offset, num_threads+1));
+    if (num_threads < 257) {
+        offset = offset_local;
+    } else {
+        CHECK(magma_index_malloc_cpu(&offset, num_threads+1));
+    }
     el_per_block = magma_ceildiv(n, num_threads);
     
     #pragma omp parallel
@@ -1011,7 +832,9 @@ magma_cmatrix_createrowptr(
     }
     
 cleanup:
-    magma_free_cpu(offset);
+    if (offset != offset_local) {
+        magma_free_cpu(offset);
+    }
     return info;
 }
 
@@ -1056,6 +879,7 @@ magma_cmatrix_swap(
     SWAP(A->num_rows, B->num_rows);
     SWAP(A->num_cols, B->num_cols);
     SWAP(A->nnz, B->nnz);
+    SWAP(A->true_nnz, B->true_nnz);
     
     index_swap = A->row;
     A->row = B->row;
@@ -1077,6 +901,78 @@ magma_cmatrix_swap(
 }
 
 
+/***************************************************************************//**
+    Purpose
+    -------
+    Makes sure the host CSR matrix A provides a row pointer for num_rows rows 
+    and val, col and rowidx arrays for at least nnz elements. A has to be empty
+    or set up by this routine for the same number of rows. The allocated 
+    length is kept in A->true_nnz, and the arrays are only reallocated if nnz 
+    exceeds it. Regrowth adds a quarter on top, as the ParILUT patterns 
+    usually grow over the first sweeps.
+    
+    The contents of val, col and rowidx are not preserved when reallocating.
+
+    Arguments
+    ---------
+
+    @param[in]
+    num_rows    magma_int_t
+                Number of rows.
+
+    @param[in]
+    nnz         magma_int_t
+                Number of elements needed.
+
+    @param[in,out]
+    A           magma_c_matrix*
+                Matrix to set up.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_caux
+*******************************************************************************/
+
+extern "C" magma_int_t
+magma_cmatrix_reserve(
+    magma_int_t num_rows,
+    magma_int_t nnz,
+    magma_c_matrix *A,
+    magma_queue_t queue)
+{
+    magma_int_t info = 0;
+    magma_int_t length;
+    
+    A->storage_type = Magma_CSR;
+    A->memory_location = Magma_CPU;
+    A->num_rows = num_rows;
+    A->nnz = nnz;
+    
+    if (A->row == NULL) {
+        CHECK(magma_index_malloc_cpu(&A->row, num_rows+1));
+    }
+    if (nnz > A->true_nnz) {
+        length = ( A->true_nnz > 0 ) ? nnz + nnz/4 : nnz;
+        magma_free_cpu(A->val);
+        magma_free_cpu(A->col);
+        magma_free_cpu(A->rowidx);
+        A->val = NULL;
+        A->col = NULL;
+        A->rowidx = NULL;
+        A->true_nnz = 0;
+        CHECK(magma_cmalloc_cpu(&A->val, length));
+        CHECK(magma_index_malloc_cpu(&A->col, length));
+        CHECK(magma_index_malloc_cpu(&A->rowidx, length));
+        A->true_nnz = length;
+    }
+    
+cleanup:
+    return info;
+}
+
+
 /***************************************************************************//**
     Purpose
     -------
@@ -1296,7 +1192,8 @@ magma_cmatrix_abssum(
 /***************************************************************************//**
     Purpose
     -------
-    SOrts the elements in a CSR matrix for increasing column index.
+    Sorts the elements in a CSR matrix for increasing column index, the
+    values are reordered along. The rows are distributed over the threads.
 
     Arguments
     ---------
@@ -1320,14 +1217,12 @@ magma_ccsr_sort(
     magma_int_t info = 0;
     
     if (A->memory_location == Magma_CPU && A->storage_type == Magma_CSR){
-        #pragma omp parallel  
-        for (int row=0; row<A->num_rows; row++) {
-            magma_cindexsort(&A->col[A->row[row]], 0, 
-                A->row[row+1]-A->row[row]-1, queue);
-        }
+        CHECK(magma_cindexsortval_segments(A->num_rows, A->row, A->col, 
+            A->val, queue));
     } else {
         info = MAGMA_ERR_NOT_SUPPORTED;
     }
     
+cleanup:
     return info;
 }
@@ -5,12 +5,20 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zmconvert.cpp, normal z -> c, Sat Mar 27 20:32:39 2021
+       @generated from sparse/control/magma_zmconvert.cpp, normal z -> c, Sat Oct 17 01:18:16 2026
        @author Hartwig Anzt
 */
+#include <algorithm>
+#include <utility>
+
 #include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
+#if ! defined(HAVE_HOST)
 #include <cuda.h>  // for CUDA_VERSION
+#endif
 
 
 /* For hipSPARSE, they use a separate complex type than for hipBLAS */
@@ -39,6 +47,246 @@
 #endif
 
 
+/*
+    Exclusive prefix sum in parallel. On entry ptr[0:n-1] holds the counts,
+    on exit ptr[0:n] holds the offsets, ptr[n] the total.
+    Each thread sums a contiguous chunk, the chunk sums are scanned, then
+    each thread writes the offsets of its chunk.
+*/
+static magma_int_t
+magma_cmconvert_scan(
+    magma_int_t n,
+    magma_index_t *ptr )
+{
+    magma_int_t info = 0;
+    magma_int_t num_threads = 1;
+    magma_index_t *partial = NULL;
+    
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    CHECK( magma_index_malloc_cpu( &partial, num_threads+1 ));
+    partial[0] = 0;
+    
+    #pragma omp parallel num_threads(num_threads)
+    {
+        magma_int_t tid = 0, nt = 1;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+        nt = omp_get_num_threads();
+#endif
+        magma_int_t chunk = magma_ceildiv( n, nt );
+        magma_int_t start = min( n, tid*chunk );
+        magma_int_t end = min( n, start+chunk );
+        magma_index_t sum = 0;
+        for( magma_int_t i=start; i<end; i++ ) {
+            sum += ptr[i];
+        }
+        partial[tid+1] = sum;
+        #pragma omp barrier
+        #pragma omp single
+        {
+            for( magma_int_t t=0; t<nt; t++ ) {
+                partial[t+1] += partial[t];
+            }
+            ptr[n] = partial[nt];
+        }
+        sum = partial[tid];
+        for( magma_int_t i=start; i<end; i++ ) {
+            magma_index_t count = ptr[i];
+            ptr[i] = sum;
+            sum += count;
+        }
+    }
+    
+cleanup:
+    magma_free_cpu( partial );
+    return info;
+}
+
+
+/*
+    Row permutation of SELL-C-sigma: within each window of sigma consecutive
+    rows, the rows are sorted by decreasing length, such that rows of similar
+    length share a slice. Rows of equal length keep their order.
+    sigma is a multiple of the slice size C, the windows are processed in
+    parallel. SELL row k holds row perm[k] of A.
+*/
+static magma_int_t
+magma_cmconvert_sellp_perm(
+    magma_int_t n,
+    const magma_index_t *row,
+    magma_int_t sigma,
+    magma_index_t *perm )
+{
+    magma_int_t info = 0;
+    magma_int_t windows = magma_ceildiv( n, sigma );
+    std::pair< magma_index_t, magma_index_t > *key = NULL;
+
+    CHECK( magma_malloc_cpu( (void**) &key,
+                             max( n, (magma_int_t) 1 ) * sizeof(*key) ));
+    #pragma omp parallel for schedule(dynamic)
+    for( magma_int_t w=0; w < windows; w++ ) {
+        magma_int_t start = w*sigma;
+        magma_int_t end = min( n, start+sigma );
+        for( magma_int_t i=start; i < end; i++ ) {
+            key[i].first = row[i] - row[i+1];   // negated length
+            key[i].second = i;
+        }
+        std::sort( key+start, key+end );
+        for( magma_int_t i=start; i < end; i++ ) {
+            perm[i] = key[i].second;
+        }
+    }
+
+cleanup:
+    magma_free_cpu( key );
+    return info;
+}
+
+
+/*
+    Sorted, distinct block columns of block row I with blocks of size bs,
+    collected in ids. Returns their number.
+*/
+static magma_int_t
+magma_cmconvert_blockcols(
+    magma_c_matrix A,
+    magma_int_t bs,
+    magma_int_t I,
+    magma_index_t *ids )
+{
+    magma_int_t start = A.row[ I*bs ];
+    magma_int_t end = A.row[ min( A.num_rows, (I+1)*bs ) ];
+    for( magma_int_t k=start; k < end; k++ ) {
+        ids[ k-start ] = A.col[k] / bs;
+    }
+    std::sort( ids, ids + (end-start) );
+    return std::unique( ids, ids + (end-start) ) - ids;
+}
+
+
+/*
+    CSR to BCSR with blocks of size B->blocksize, stored row-major as by
+    cuSPARSE. The blocks of each block row are counted in parallel, the scan
+    turns the counts into the block row pointer, then the block rows are
+    written in parallel.
+*/
+static magma_int_t
+magma_cmconvert_csr2bcsr(
+    magma_c_matrix A,
+    magma_c_matrix *B )
+{
+    magma_int_t info = 0;
+    magma_int_t bs = B->blocksize;
+    magma_int_t mb = magma_ceildiv( A.num_rows, bs );
+    magma_int_t num_threads = 1, span = 0;
+    magma_index_t *ids = NULL;
+
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    #pragma omp parallel for reduction(max:span)
+    for( magma_int_t I=0; I < mb; I++ ) {
+        span = max( span, A.row[ min( A.num_rows, (I+1)*bs ) ] - A.row[ I*bs ] );
+    }
+    CHECK( magma_index_malloc_cpu( &ids, num_threads*(span+1) ));
+    CHECK( magma_index_malloc_cpu( &B->row, mb+1 ));
+
+    #pragma omp parallel num_threads(num_threads)
+    {
+        magma_int_t tid = 0;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+#endif
+        #pragma omp for schedule(dynamic, 64)
+        for( magma_int_t I=0; I < mb; I++ ) {
+            B->row[I] = magma_cmconvert_blockcols( A, bs, I, ids + tid*(span+1) );
+        }
+    }
+    CHECK( magma_cmconvert_scan( mb, B->row ));
+    B->numblocks = B->row[mb];
+    CHECK( magma_index_malloc_cpu( &B->col, B->numblocks ));
+    CHECK( magma_cmalloc_cpu( &B->val, B->numblocks*bs*bs ));
+
+    #pragma omp parallel num_threads(num_threads)
+    {
+        magma_int_t tid = 0;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+#endif
+        magma_index_t *tids = ids + tid*(span+1);
+        #pragma omp for schedule(dynamic, 64)
+        for( magma_int_t I=0; I < mb; I++ ) {
+            magma_index_t *cols = B->col + B->row[I];
+            magma_int_t num = magma_cmconvert_blockcols( A, bs, I, tids );
+            for( magma_int_t k=0; k < num; k++ ) {
+                cols[k] = tids[k];
+            }
+            for( magma_int_t l=B->row[I]*bs*bs; l < B->row[I+1]*bs*bs; l++ ) {
+                B->val[l] = MAGMA_C_ZERO;
+            }
+            for( magma_int_t i=I*bs; i < min( A.num_rows, (I+1)*bs ); i++ ) {
+                for( magma_int_t k=A.row[i]; k < A.row[i+1]; k++ ) {
+                    magma_index_t J = A.col[k] / bs;
+                    magma_int_t pos = std::lower_bound( cols, cols+num, J ) - B->col;
+                    B->val[ pos*bs*bs + (i-I*bs)*bs + A.col[k]-J*bs ] = A.val[k];
+                }
+            }
+        }
+    }
+
+cleanup:
+    magma_free_cpu( ids );
+    return info;
+}
+
+
+/*
+    BCSR to CSR. As by cuSPARSE, all entries of the blocks are kept and the
+    dimensions are rounded up to multiples of the block size. The row pointer
+    follows from the block row pointer, the rows are written in parallel.
+*/
+static magma_int_t
+magma_cmconvert_bcsr2csr(
+    magma_c_matrix A,
+    magma_c_matrix *B )
+{
+    magma_int_t info = 0;
+    magma_int_t bs = A.blocksize;
+    magma_int_t mb = magma_ceildiv( A.num_rows, bs );
+    magma_int_t nb = magma_ceildiv( A.num_cols, bs );
+
+    B->num_rows = mb*bs;
+    B->num_cols = nb*bs;
+    B->nnz = A.numblocks*bs*bs;
+    B->true_nnz = B->nnz;
+    CHECK( magma_index_malloc_cpu( &B->row, B->num_rows+1 ));
+    CHECK( magma_index_malloc_cpu( &B->col, B->nnz ));
+    CHECK( magma_cmalloc_cpu( &B->val, B->nnz ));
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for( magma_int_t I=0; I < mb; I++ ) {
+        magma_int_t num = A.row[I+1] - A.row[I];
+        for( magma_int_t r=0; r < bs; r++ ) {
+            magma_index_t k = A.row[I]*bs*bs + r*num*bs;
+            B->row[ I*bs+r ] = k;
+            for( magma_int_t b=A.row[I]; b < A.row[I+1]; b++ ) {
+                for( magma_int_t c=0; c < bs; c++ ) {
+                    B->col[k] = A.col[b]*bs + c;
+                    B->val[k] = A.val[ b*bs*bs + r*bs + c ];
+                    k++;
+                }
+            }
+        }
+    }
+    B->row[ B->num_rows ] = B->nnz;
+
+cleanup:
+    return info;
+}
+
+
 /**
     Purpose
     -------
@@ -97,32 +345,33 @@ magma_c_csr_compressor(
 {
     magma_int_t info = 0;
 
-    magma_index_t i,j, nnz_new=0, (*row_nnz)=NULL, nnz_this_row;
-    CHECK( magma_index_malloc_cpu( &(row_nnz), (*n) ));
+    magma_index_t nnz_new=0;
     CHECK( magma_index_malloc_cpu( rown, *n+1 ));
-    for( i=0; i<*n; i++ ) {
-        (*rown)[i] = nnz_new;
-        nnz_this_row = 0;
-        for( j=(*row)[i]; j<(*row)[i+1]; j++ ) {
+    // count the nonzeros per row, the scan turns the counts into offsets
+    #pragma omp parallel for
+    for( magma_int_t i=0; i<*n; i++ ) {
+        magma_index_t nnz_this_row = 0;
+        for( magma_int_t j=(*row)[i]; j<(*row)[i+1]; j++ ) {
             if ( (MAGMA_C_REAL((*val)[j]) != 0) || (MAGMA_C_IMAG((*val)[j]) != 0) ) {
-                nnz_new++;
                 nnz_this_row++;
             }
         }
-        row_nnz[i] = nnz_this_row;
+        (*rown)[i] = nnz_this_row;
     }
-    (*rown)[*n] = nnz_new;
+    CHECK( magma_cmconvert_scan( *n, *rown ));
+    nnz_new = (*rown)[*n];
 
     CHECK( magma_cmalloc_cpu( valn, nnz_new ));
     CHECK( magma_index_malloc_cpu( coln, nnz_new ));
 
-    nnz_new = 0;
-    for( i=0; i<*n; i++ ) {
-        for( j=(*row)[i]; j<(*row)[i+1]; j++ ) {
+    #pragma omp parallel for
+    for( magma_int_t i=0; i<*n; i++ ) {
+        magma_index_t k = (*rown)[i];
+        for( magma_int_t j=(*row)[i]; j<(*row)[i+1]; j++ ) {
             if ( (MAGMA_C_REAL((*val)[j]) != 0) || (MAGMA_C_IMAG((*val)[j]) != 0) ) {
-                (*valn)[nnz_new]= (*val)[j];
-                (*coln)[nnz_new]= (*col)[j];
-                nnz_new++;
+                (*valn)[k]= (*val)[j];
+                (*coln)[k]= (*col)[j];
+                k++;
             }
         }
     }
@@ -130,12 +379,13 @@ magma_c_csr_compressor(
 
 cleanup:
     if ( info != 0 ) {
-        magma_free_cpu( valn );
-        magma_free_cpu( coln );
-        magma_free_cpu( rown );
+        magma_free_cpu( *valn );
+        magma_free_cpu( *coln );
+        magma_free_cpu( *rown );
+        *valn = NULL;
+        *coln = NULL;
+        *rown = NULL;
     }
-    magma_free_cpu( row_nnz );
-    row_nnz = NULL;
     return info;
 }
 
@@ -193,8 +443,10 @@ magma_cmconvert(
     magmaFloatComplex *transpose=NULL;
     magma_index_t *nnz_per_row=NULL;
 
+    #if ! defined(HAVE_HOST)
     cusparseHandle_t cusparseHandle = 0;
     cusparseMatDescr_t descr = 0;
+    #endif
     
     // make sure the target structure is empty
     magma_cmfree( B, queue );
@@ -248,10 +500,12 @@ magma_cmconvert(
                 CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
                 CHECK( magma_index_malloc_cpu( &B->col, A.nnz ));
 
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.nnz; i++) {
                     B->val[i] = A.val[i];
                     B->col[i] = A.col[i];
                 }
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows+1; i++) {
                     B->row[i] = A.row[i];
                 }
@@ -273,22 +527,27 @@ magma_cmconvert(
                 B->true_nnz = A.true_nnz;
                 B->diameter = A.diameter;
 
-                magma_int_t numzeros=0;
+                // the row counts are scanned into the row pointer of B,
+                // the fill pass then works on all rows independently
+                CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows; i++) {
+                    magma_index_t count = 0;
                     for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
                         if ( A.col[j] <= i) {
-                            numzeros++;
+                            count++;
                         }
                     }
+                    B->row[i] = count;
                 }
-                B->nnz = numzeros;
-                CHECK( magma_cmalloc_cpu( &B->val, numzeros ));
-                CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
-                CHECK( magma_index_malloc_cpu( &B->col, numzeros ));
+                CHECK( magma_cmconvert_scan( A.num_rows, B->row ));
+                B->nnz = B->row[A.num_rows];
+                CHECK( magma_cmalloc_cpu( &B->val, B->nnz ));
+                CHECK( magma_index_malloc_cpu( &B->col, B->nnz ));
 
-                numzeros=0;
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows; i++) {
-                    B->row[i]=numzeros;
+                    magma_index_t numzeros = B->row[i];
                     for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
                         if ( A.col[j] < i) {
                             B->val[numzeros] = A.val[j];
@@ -308,7 +567,6 @@ magma_cmconvert(
                         }
                     }
                 }
-                B->row[B->num_rows] = numzeros;
             }
 
             // CSR to CSRU
@@ -321,22 +579,25 @@ magma_cmconvert(
                 B->num_cols = A.num_cols;
                 B->diameter = A.diameter;
                 B->fill_mode = MagmaUpper;
-                magma_int_t numzeros=0;
+                CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows; i++) {
+                    magma_index_t count = 0;
                     for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
                         if ( A.col[j] >= i) {
-                            numzeros++;
+                            count++;
                         }
                     }
+                    B->row[i] = count;
                 }
-                B->nnz = numzeros;
-                CHECK( magma_cmalloc_cpu( &B->val, numzeros ));
-                CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
-                CHECK( magma_index_malloc_cpu( &B->col, numzeros ));
+                CHECK( magma_cmconvert_scan( A.num_rows, B->row ));
+                B->nnz = B->row[A.num_rows];
+                CHECK( magma_cmalloc_cpu( &B->val, B->nnz ));
+                CHECK( magma_index_malloc_cpu( &B->col, B->nnz ));
 
-                numzeros=0;
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows; i++) {
-                    B->row[i]=numzeros;
+                    magma_index_t numzeros = B->row[i];
                     for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
                         if ( A.col[j] >= i) {
                             B->val[numzeros] = A.val[j];
@@ -345,7 +606,6 @@ magma_cmconvert(
                         }
                     }
                 }
-                B->row[B->num_rows] = numzeros;
             }
 
             // CSR to CSRD (diagonal elements first)
@@ -364,6 +624,7 @@ magma_cmconvert(
                 CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
                 CHECK( magma_index_malloc_cpu( &B->col, A.nnz ));
 
+                #pragma omp parallel for
                 for(magma_int_t i=0; i < A.num_rows; i++) {
                     magma_int_t count = 1;
                     for(magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
@@ -377,6 +638,7 @@ magma_cmconvert(
                         }
                     }
                 }
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows+1; i++) {
                     B->row[i] = A.row[i];
                 }
@@ -390,6 +652,7 @@ magma_cmconvert(
                 magma_free_cpu( B->row );
                 CHECK( magma_index_malloc_cpu( &B->row, A.nnz ));
 
+                #pragma omp parallel for
                 for(magma_int_t i=0; i < A.num_rows; i++) {
                     for(magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
                         B->row[j] = i;
@@ -404,6 +667,7 @@ magma_cmconvert(
 
                 CHECK( magma_index_malloc_cpu( &B->rowidx, A.nnz ));
 
+                #pragma omp parallel for
                 for(magma_int_t i=0; i < A.num_rows; i++) {
                     for(magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
                         B->rowidx[j] = i;
@@ -423,11 +687,13 @@ magma_cmconvert(
                 CHECK( magma_index_malloc_cpu( &B->rowidx, A.nnz+A.num_rows*2 ));
                 CHECK( magma_index_malloc_cpu( &B->list, A.nnz+A.num_rows*2 ));
 
+                #pragma omp parallel for
                 for(magma_int_t i=0; i < A.nnz; i++) {
                     B->col[i] = A.col[i];
                     B->val[i] = A.val[i];
                 }
 
+                #pragma omp parallel for
                 for(magma_int_t i=0; i < A.num_rows; i++) {
                     for(magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
                         B->rowidx[j] = i;
@@ -437,6 +703,7 @@ magma_cmconvert(
                     }
                     B->list[A.row[i+1]-1] = 0;
                 }
+                #pragma omp parallel for
                 for(magma_int_t i=A.nnz; i < A.nnz+A.num_rows*2; i++) {
                     B->list[i] = -1;
                 }
@@ -455,13 +722,13 @@ magma_cmconvert(
                 B->max_nnz_row = A.max_nnz_row;
                 B->diameter = A.diameter;
                 // conversion
-                magma_index_t i, j, maxrowlength=0;
-                CHECK( magma_index_malloc_cpu( &length, A.num_rows));
+                magma_index_t maxrowlength=0;
 
-                for( i=0; i < A.num_rows; i++ ) {
-                    length[i] = A.row[i+1]-A.row[i];
-                    if (length[i] > maxrowlength)
-                        maxrowlength = length[i];
+                #pragma omp parallel for reduction(max:maxrowlength)
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
+                    magma_index_t rowlength = A.row[i+1]-A.row[i];
+                    if (rowlength > maxrowlength)
+                        maxrowlength = rowlength;
                 }
                 //printf( "Conversion to ELLPACK with %d elements per row: ",
                                                                 // maxrowlength );
@@ -469,17 +736,18 @@ magma_cmconvert(
                 CHECK( magma_cmalloc_cpu( &B->val, maxrowlength*A.num_rows ));
                 CHECK( magma_index_malloc_cpu( &B->col, maxrowlength*A.num_rows ));
 
-                for( i=0; i < (maxrowlength*A.num_rows); i++) {
-                    B->val[i] = MAGMA_C_MAKE(0., 0.);
-                    B->col[i] =  -1;
-                }
-                for( i=0; i < A.num_rows; i++ ) {
+                #pragma omp parallel for
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
                     magma_int_t offset = 0;
-                    for( j=A.row[i]; j < A.row[i+1]; j++ ) {
+                    for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++ ) {
                         B->val[i*maxrowlength+offset] = A.val[j];
                         B->col[i*maxrowlength+offset] = A.col[j];
                         offset++;
                     }
+                    for( ; offset < maxrowlength; offset++ ) {
+                        B->val[i*maxrowlength+offset] = MAGMA_C_MAKE(0., 0.);
+                        B->col[i*maxrowlength+offset] = -1;
+                    }
                 }
                 B->max_nnz_row = maxrowlength;
             }
@@ -497,13 +765,13 @@ magma_cmconvert(
                 B->diameter = A.diameter;
 
                 // conversion
-                magma_index_t i, j, maxrowlength=0;
-                CHECK( magma_index_malloc_cpu( &length, A.num_rows));
+                magma_index_t maxrowlength=0;
 
-                for( i=0; i < A.num_rows; i++ ) {
-                    length[i] = A.row[i+1]-A.row[i];
-                    if (length[i] > maxrowlength)
-                        maxrowlength = length[i];
+                #pragma omp parallel for reduction(max:maxrowlength)
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
+                    magma_index_t rowlength = A.row[i+1]-A.row[i];
+                    if (rowlength > maxrowlength)
+                        maxrowlength = rowlength;
                 }
                 //printf( "Conversion to ELL with %d elements per row: ",
                                                                // maxrowlength );
@@ -511,18 +779,18 @@ magma_cmconvert(
                 CHECK( magma_cmalloc_cpu( &B->val, maxrowlength*A.num_rows ));
                 CHECK( magma_index_malloc_cpu( &B->col, maxrowlength*A.num_rows ));
 
-                for( i=0; i < (maxrowlength*A.num_rows); i++) {
-                    B->val[i] = MAGMA_C_MAKE(0., 0.);
-                    B->col[i] = 0;
-                }
-
-                for( i=0; i < A.num_rows; i++ ) {
+                #pragma omp parallel for
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
                     magma_int_t offset = 0;
-                    for( j=A.row[i]; j < A.row[i+1]; j++ ) {
+                    for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++ ) {
                         B->val[offset*A.num_rows+i] = A.val[j];
                         B->col[offset*A.num_rows+i] = A.col[j];
                         offset++;
                     }
+                    for( ; offset < maxrowlength; offset++ ) {
+                        B->val[offset*A.num_rows+i] = MAGMA_C_MAKE(0., 0.);
+                        B->col[offset*A.num_rows+i] = 0;
+                    }
                 }
                 B->max_nnz_row = maxrowlength;
                 //printf( "done\n" );
@@ -541,13 +809,13 @@ magma_cmconvert(
                 B->diameter = A.diameter;
 
                 // conversion
-                magma_index_t i, j, maxrowlength=0;
-                CHECK( magma_index_malloc_cpu( &length, A.num_rows));
+                magma_index_t maxrowlength=0;
 
-                for( i=0; i < A.num_rows; i++ ) {
-                    length[i] = A.row[i+1]-A.row[i];
-                    if (length[i] > maxrowlength)
-                        maxrowlength = length[i];
+                #pragma omp parallel for reduction(max:maxrowlength)
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
+                    magma_index_t rowlength = A.row[i+1]-A.row[i];
+                    if (rowlength > maxrowlength)
+                        maxrowlength = rowlength;
                 }
                 //printf( "Conversion to ELL with %d elements per row: ",
                                                                // maxrowlength );
@@ -556,14 +824,14 @@ magma_cmconvert(
                 CHECK( magma_index_malloc_cpu( &B->col, maxrowlength*A.num_rows ));
 
 
-                for( i=0; i < (maxrowlength*A.num_rows); i++) {
-                    B->val[i] = MAGMA_C_MAKE(0., 0.);
-                    B->col[i] =  -1;
-                }
-
-                for( i=0; i < A.num_rows; i++ ) {
+                #pragma omp parallel for
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
+                    for( magma_int_t k=0; k < maxrowlength; k++ ) {
+                        B->val[i*maxrowlength+k] = MAGMA_C_MAKE(0., 0.);
+                        B->col[i*maxrowlength+k] = -1;
+                    }
                     magma_int_t offset = 1;
-                    for( j=A.row[i]; j < A.row[i+1]; j++ ) {
+                    for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++ ) {
                         if ( A.col[j] == i ) { // diagonal case
                             B->val[i*maxrowlength] = A.val[j];
                             B->col[i*maxrowlength] = A.col[j];
@@ -590,13 +858,13 @@ magma_cmconvert(
                 B->diameter = A.diameter;
 
                 // conversion
-                magma_index_t i, j, maxrowlength=0;
-                CHECK( magma_index_malloc_cpu( &length, A.num_rows));
+                magma_index_t maxrowlength=0;
 
-                for( i=0; i < A.num_rows; i++ ) {
-                    length[i] = A.row[i+1]-A.row[i];
-                    if (length[i] > maxrowlength)
-                        maxrowlength = length[i];
+                #pragma omp parallel for reduction(max:maxrowlength)
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
+                    magma_index_t rowlength = A.row[i+1]-A.row[i];
+                    if (rowlength > maxrowlength)
+                        maxrowlength = rowlength;
                 }
 
                 //printf( "Conversion to ELLRT with %d elements per row: ",
@@ -609,18 +877,18 @@ magma_cmconvert(
                 CHECK( magma_index_malloc_cpu( &B->col, rowlength*A.num_rows ));
                 CHECK( magma_index_malloc_cpu( &B->row, A.num_rows ));
 
-                for( i=0; i < rowlength*A.num_rows; i++) {
-                    B->val[i] = MAGMA_C_MAKE(0., 0.);
-                    B->col[i] =  0;
-                }
-
-                for( i=0; i < A.num_rows; i++ ) {
+                #pragma omp parallel for
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
                     magma_int_t offset = 0;
-                    for( j=A.row[i]; j < A.row[i+1]; j++ ) {
+                    for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++ ) {
                         B->val[i*rowlength+offset] = A.val[j];
                         B->col[i*rowlength+offset] = A.col[j];
                         offset++;
                     }
+                    for( ; offset < rowlength; offset++ ) {
+                        B->val[i*rowlength+offset] = MAGMA_C_MAKE(0., 0.);
+                        B->col[i*rowlength+offset] = 0;
+                    }
                     B->row[i] = A.row[i+1] - A.row[i];
                 }
                 B->max_nnz_row = maxrowlength;
@@ -655,32 +923,43 @@ magma_cmconvert(
                 magma_int_t C = B->blocksize;
                 magma_int_t slices = ( A.num_rows+C-1)/(C);
                 B->numblocks = slices;
-                magma_int_t alignedlength, alignment = B->alignment;
+                magma_int_t alignment = B->alignment;
+                magma_index_t max_nnz_row = 0;
+                // SELL-C-sigma: sort the rows by length within windows of
+                // sigma rows, a multiple of C; sigma <= 1 keeps the order
+                B->sellp_perm = NULL;
+                if ( B->sellp_sigma > 1 ) {
+                    B->sellp_sigma = magma_roundup( B->sellp_sigma, C );
+                    CHECK( magma_index_malloc_cpu( &B->sellp_perm,
+                                        max( A.num_rows, (magma_int_t) 1 ) ));
+                    CHECK( magma_cmconvert_sellp_perm( A.num_rows, A.row,
+                                        B->sellp_sigma, B->sellp_perm ));
+                } else {
+                    B->sellp_sigma = 1;
+                }
+                const magma_index_t *perm = B->sellp_perm;
                 // conversion
-                magma_index_t i, j, k, maxrowlength=0;
-                CHECK( magma_index_malloc_cpu( &length, C));
-                // B-row points to the start of each slice
+                // B-row points to the start of each slice,
+                // the slice sizes are computed independently and scanned
                 CHECK( magma_index_malloc_cpu( &B->row, slices+1 ));
 
-
-                B->row[0] = 0;
-                for( i=0; i < slices; i++ ) {
-                    maxrowlength = 0;
-                    for(j=0; j < C; j++) {
-                        if (i*C+j < A.num_rows) {
-                            length[j] = A.row[i*C+j+1]-A.row[i*C+j];
-                        }
-                        else
-                            length[j]=0;
-                        if (length[j] > maxrowlength) {
-                            maxrowlength = length[j];
+                #pragma omp parallel for reduction(max:max_nnz_row)
+                for( magma_int_t i=0; i < slices; i++ ) {
+                    magma_index_t maxrowlength = 0;
+                    for( magma_int_t j=0; j < C && i*C+j < A.num_rows; j++) {
+                        magma_int_t line = perm ? perm[i*C+j] : i*C+j;
+                        magma_index_t rowlength = A.row[line+1]-A.row[line];
+                        if (rowlength > maxrowlength) {
+                            maxrowlength = rowlength;
                         }
                     }
-                    alignedlength = magma_roundup( maxrowlength, alignment );
-                    B->row[i+1] = B->row[i] + alignedlength * C;
-                    if ( alignedlength > B->max_nnz_row )
-                        B->max_nnz_row = alignedlength;
+                    magma_index_t alignedlength = magma_roundup( maxrowlength, alignment );
+                    B->row[i] = alignedlength * C;
+                    if ( alignedlength > max_nnz_row )
+                        max_nnz_row = alignedlength;
                 }
+                CHECK( magma_cmconvert_scan( slices, B->row ));
+                B->max_nnz_row = max_nnz_row;
                 B->nnz = B->row[slices];
                 //printf( "Conversion to SELLC with %d slices of size %d and"
                 //       " %d nonzeros.\n", slices, C, B->nnz );
@@ -689,18 +968,21 @@ magma_cmconvert(
                 CHECK( magma_cmalloc_cpu( &B->val, B->row[slices] ));
                 CHECK( magma_index_malloc_cpu( &B->col, B->row[slices] ));
 
-                // zero everything
-                for( i=0; i < B->row[slices]; i++ ) {
-                    B->val[ i ] = MAGMA_C_MAKE(0., 0.);
-                    B->col[ i ] =  0;
-                }
-                // fill in values
-                for( i=0; i < slices; i++ ) {
-                    for(j=0; j < C; j++) {
+                // zero and fill in values slice by slice
+                #pragma omp parallel for
+                for( magma_int_t i=0; i < slices; i++ ) {
+                    for( magma_int_t k=B->row[i]; k < B->row[i+1]; k++ ) {
+                        B->val[ k ] = MAGMA_C_MAKE(0., 0.);
+                        B->col[ k ] =  0;
+                    }
+                    for( magma_int_t j=0; j < C; j++) {
                         magma_int_t line = i*C+j;
                         magma_int_t offset = 0;
                         if ( line < A.num_rows) {
-                            for( k=A.row[line]; k < A.row[line+1]; k++ ) {
+                            if ( perm != NULL ) {
+                                line = perm[line];
+                            }
+                            for( magma_int_t k=A.row[line]; k < A.row[line+1]; k++ ) {
                                 B->val[ B->row[i] + j +offset*C ] = A.val[k];
                                 B->col[ B->row[i] + j +offset*C ] = A.col[k];
                                 offset++;
@@ -727,11 +1009,10 @@ magma_cmconvert(
                 // conversion
                 CHECK( magma_cmalloc_cpu( &B->val, A.num_rows*A.num_cols ));
 
-                for( magma_int_t i=0; i<(A.num_rows)*(A.num_cols); i++) {
-                    B->val[i] = MAGMA_C_MAKE(0., 0.);
-                }
-
+                #pragma omp parallel for
                 for(magma_int_t i=0; i < A.num_rows; i++ ) {
+                    for(magma_int_t j=0; j < A.num_cols; j++ )
+                        B->val[i * (A.num_cols) + j ] = MAGMA_C_MAKE(0., 0.);
                     for(magma_int_t j=A.row[i]; j < A.row[i+1]; j++ )
                         B->val[i * (A.num_cols) + A.col[j] ] = A.val[ j ];
                 }
@@ -741,10 +1022,23 @@ magma_cmconvert(
 
             // CSR to BCSR
             else if ( new_format == Magma_BCSR ) {
-                CHECK( magma_cmtransfer(A, &dA, Magma_CPU, Magma_DEV, queue ) );
-                dB.blocksize = B->blocksize;
-                CHECK( magma_cmconvert(dA, &dB, Magma_CSR, Magma_BCSR, queue ) );
-                CHECK( magma_cmtransfer(dB, B, Magma_DEV, Magma_CPU, queue ) );
+                // fill in information for B
+                B->storage_type = Magma_BCSR;
+                B->memory_location = A.memory_location;
+                B->fill_mode = A.fill_mode;
+                B->num_rows = A.num_rows; B->true_nnz = A.true_nnz;
+                B->num_cols = A.num_cols;
+                B->nnz = A.nnz;
+                B->max_nnz_row = A.max_nnz_row;
+                B->diameter = A.diameter;
+
+                // conversion
+                CHECK( magma_cmconvert_csr2bcsr( A, B ));
+            }
+
+            // CSR to VBCSR (host only, blocksize is the maximal block size)
+            else if ( new_format == Magma_VBCSR ) {
+                CHECK( magma_cmvbcsr( A, B->blocksize, B, queue ));
             }
 
             // CSR to CSR5
@@ -764,6 +1058,7 @@ magma_cmconvert(
                 CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
                 CHECK( magma_index_malloc_cpu( &B->col, A.nnz ));
 
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows+1; i++) {
                     B->row[i] = A.row[i];
                 }
@@ -814,12 +1109,14 @@ magma_cmconvert(
                 //printf("sigma = %i, p = %i\n", B->csr5_sigma, B->csr5_p);
                 // malloc the newly added arrays for CSR5
                 CHECK( magma_uindex_malloc_cpu( &B->tile_ptr, B->csr5_p+1 ));
+                #pragma omp parallel for
                 for( magma_int_t i=0; i<B->csr5_p+1; i++) {
                     B->tile_ptr[i] = 0;
                 }
 
                 CHECK( magma_uindex_malloc_cpu( &B->tile_desc,
                           B->csr5_p * MAGMA_CSR5_OMEGA * B->csr5_num_packets ));
+                #pragma omp parallel for
                 for( magma_int_t i=0; i<B->csr5_p * MAGMA_CSR5_OMEGA
                                         * B->csr5_num_packets; i++) {
                     B->tile_desc[i] = 0;
@@ -827,12 +1124,14 @@ magma_cmconvert(
 
 
                 CHECK( magma_cmalloc_cpu( &B->calibrator, B->csr5_p ));
+                #pragma omp parallel for
                 for( magma_int_t i=0; i<B->csr5_p; i++) {
                     B->calibrator[i] = MAGMA_C_MAKE(0., 0.);
                 }
 
                 CHECK( magma_index_malloc_cpu( &B->tile_desc_offset_ptr,
                                                B->csr5_p+1 ));
+                #pragma omp parallel for
                 for( magma_int_t i=0; i<B->csr5_p+1; i++) {
                     B->tile_desc_offset_ptr[i] = 0;
                 }
@@ -841,6 +1140,7 @@ magma_cmconvert(
                 // convert csr data to csr5 data (3 steps)
                 // step 1 generate tile pointer
                 // step 1.1 binary search row pointer
+                #pragma omp parallel for
                 for (magma_index_t global_id = 0; global_id <= B->csr5_p;
                      global_id++)
                 {
@@ -867,6 +1167,10 @@ magma_cmconvert(
                 }
                 
                 // step 1.2 check empty rows
+                // the flags are collected first and applied in a second pass,
+                // as each tile reads the pointer of the next tile
+                CHECK( magma_index_malloc_cpu( &row_tmp, B->csr5_p ));
+                #pragma omp parallel for
                 for (magma_index_t group_id = 0; group_id < B->csr5_p; group_id++) {
                     int dirty = 0;
                 
@@ -875,22 +1179,25 @@ magma_cmconvert(
                     start = (start << 1) >> 1;
                     stop  = (stop << 1) >> 1;
                 
-                    if (start == stop)
-                        continue;
-                
-                    for (magma_uindex_t row_idx = start; row_idx <= stop; row_idx++) {
-                        if (B->row[row_idx] == B->row[row_idx+1]) {
-                            dirty = 1;
-                            break;
+                    if (start != stop) {
+                        for (magma_uindex_t row_idx = start; row_idx <= stop && row_idx < (magma_uindex_t) B->num_rows; row_idx++) {
+                            if (B->row[row_idx] == B->row[row_idx+1]) {
+                                dirty = 1;
+                                break;
+                            }
                         }
                     }
-                
-                    if (dirty) {
-                        start |= sizeof(magma_uindex_t) == 4
+                    row_tmp[group_id] = dirty;
+                }
+                #pragma omp parallel for
+                for (magma_index_t group_id = 0; group_id < B->csr5_p; group_id++) {
+                    if (row_tmp[group_id]) {
+                        B->tile_ptr[group_id] |= sizeof(magma_uindex_t) == 4
                                            ? 0x80000000 : 0x8000000000000000;
-                        B->tile_ptr[group_id] = start;
                     }
                 }
+                magma_free_cpu( row_tmp );
+                row_tmp = NULL;
                 B->csr5_tail_tile_start = (B->tile_ptr[B->csr5_p-1] << 1) >> 1;
                 
                 // step 2. generate tile descriptor
@@ -899,6 +1206,7 @@ magma_cmconvert(
                                      + B->csr5_bit_scansum_offset;
                 
                 //generate_tile_descriptor_s1_kernel
+                #pragma omp parallel for
                 for (int par_id = 0; par_id < B->csr5_p-1; par_id++) {
                     const magma_index_t row_start = B->tile_ptr[par_id]
                                                     & 0x7FFFFFFF;
@@ -927,7 +1235,10 @@ magma_cmconvert(
                 }
                 
                 //generate_tile_descriptor_s2_kernel
-                int num_thread = 1; //omp_get_max_threads();
+                int num_thread = 1;
+#ifdef _OPENMP
+                num_thread = omp_get_max_threads();
+#endif
                 magma_index_t *s_segn_scan_all, *s_present_all;
                 
                 CHECK( magma_index_malloc_cpu( &s_segn_scan_all,
@@ -946,9 +1257,12 @@ magma_cmconvert(
                 
                 //const int bit_all_offset = bit_y_offset + bit_scansum_offset;
                 
-                //#pragma omp parallel for
+                #pragma omp parallel for
                 for (int par_id = 0; par_id < B->csr5_p-1; par_id++) {
-                    int tid = 0; //omp_get_thread_num();
+                    int tid = 0;
+#ifdef _OPENMP
+                    tid = omp_get_thread_num();
+#endif
                     int *s_segn_scan = &s_segn_scan_all[tid * 2
                                                         * MAGMA_CSR5_OMEGA];
                     int *s_present = &s_present_all[tid * 2
@@ -1022,6 +1336,7 @@ magma_cmconvert(
                     if (with_empty_rows) {
                         B->tile_desc_offset_ptr[par_id]
                             = s_segn_scan[MAGMA_CSR5_OMEGA];
+                        #pragma omp atomic write
                         B->tile_desc_offset_ptr[B->csr5_p] = 1;
                     }
                 
@@ -1078,7 +1393,7 @@ magma_cmconvert(
                     //err = generate_tile_descriptor_offset
                     const int bit_bitflag = 32 - bit_all_offset;
                 
-                    //#pragma omp parallel for
+                    #pragma omp parallel for
                     for (int par_id = 0; par_id < B->csr5_p-1; par_id++) {
                         bool with_empty_rows = (B->tile_ptr[par_id] >> 31)&0x1;
                         if (!with_empty_rows)
@@ -1176,7 +1491,7 @@ magma_cmconvert(
                 }
                 
                 // step 3. transpose column_index and value arrays
-                //#pragma omp parallel for
+                #pragma omp parallel for
                 for (int par_id = 0; par_id < B->csr5_p; par_id++) {
                     // if this is fast track tile, do not transpose it
                     if (B->tile_ptr[par_id] == B->tile_ptr[par_id + 1]) {
@@ -1219,6 +1534,15 @@ magma_cmconvert(
                 info = MAGMA_ERR_NOT_SUPPORTED;
             }
         }
+        // STENCIL to anything: generate the operator in CSR
+        else if ( old_format == Magma_STENCIL ) {
+            if ( A.stencil_points == 5 ) {
+                CHECK( magma_cm_5stencil( A.stencil_grid, &hA, queue ));
+            } else {
+                CHECK( magma_cm_27stencil( A.stencil_grid, &hA, queue ));
+            }
+            CHECK( magma_cmconvert( hA, B, Magma_CSR, new_format, queue ));
+        }
         // anything to CSR
         else if ( new_format == Magma_CSR ) {
             // CSRU/CSRCSCU to CSR
@@ -1234,6 +1558,7 @@ magma_cmconvert(
             // CSRD to CSR (diagonal elements first)
             else if ( old_format == Magma_CSRD ) {
                 CHECK( magma_cmconvert( A, B, Magma_CSR, Magma_CSR, queue ));
+                #pragma omp parallel for schedule(dynamic,64)
                 for( magma_int_t i=0; i < A.num_rows; i++) {
                     magma_cindexsortval(
                     B->col,
@@ -1252,22 +1577,30 @@ magma_cmconvert(
             // CSRLIST to CSR
             else if ( old_format == Magma_CSRLIST ) {
                 CHECK( magma_cmconvert( A, B, Magma_CSR, Magma_CSR, queue ));
-                magma_int_t element, row, numnnz;
 
-                numnnz = 0;
-                // fill the rowpointer
-                B->row[0] = 0;
-                for( row=0; row<A.num_rows; row++ ){
-                    element = A.row[row];
+                // fill the rowpointer with the list lengths and scan them
+                #pragma omp parallel for
+                for( magma_int_t row=0; row<A.num_rows; row++ ){
+                    magma_index_t element = A.row[row], numnnz = 0;
+                    do{
+                        numnnz++;
+                        element = A.list[ element ];
+                    }while( element != 0 );
+                    B->row[ row ] = numnnz;
+                }
+                CHECK( magma_cmconvert_scan( A.num_rows, B->row ));
+                #pragma omp parallel for
+                for( magma_int_t row=0; row<A.num_rows; row++ ){
+                    magma_index_t element = A.row[row], numnnz = B->row[row];
                     do{
                         B->val[ numnnz ] = A.val[ element ];
                         B->col[ numnnz ] = A.col[ element ];
                         numnnz++;
                         element = A.list[ element ];
                     }while( element != 0 );
-                    B->row[ row+1 ] = numnnz;
                 }
                 // sort elements in every row according to col
+                #pragma omp parallel for schedule(dynamic,64)
                 for( magma_int_t i=0; i < A.num_rows; i++) {
                     magma_cindexsortval(
                     B->col,
@@ -1295,6 +1628,7 @@ magma_cmconvert(
 
                 CHECK( magma_index_malloc_cpu( &row_tmp, A.num_rows+1 ));
                 //fill the row-pointer
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows+1; i++ )
                     row_tmp[i] = i*A.max_nnz_row;
                 //now use AA_ELL, IA_ELL, row_tmp as CSR with some zeros.
@@ -1324,11 +1658,13 @@ magma_cmconvert(
                 CHECK( magma_index_malloc_cpu( &col_tmp, A.num_rows*A.max_nnz_row ));
 
                 //fill the row-pointer
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows+1; i++ )
                     row_tmp[i] = i*A.max_nnz_row;
                 //transform RowMajor to ColMajor
-                for( magma_int_t j=0; j < A.max_nnz_row; j++ ) {
-                    for( magma_int_t i=0; i < A.num_rows; i++ ) {
+                #pragma omp parallel for
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
+                    for( magma_int_t j=0; j < A.max_nnz_row; j++ ) {
                         col_tmp[i*A.max_nnz_row+j] = A.col[j*A.num_rows+i];
                         val_tmp[i*A.max_nnz_row+j] = A.val[j*A.num_rows+i];
                     }
@@ -1369,12 +1705,14 @@ magma_cmconvert(
                 // conversion
                 CHECK( magma_index_malloc_cpu( &row_tmp, A.num_rows+1 ));
                 //fill the row-pointer
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows+1; i++ )
                     row_tmp[i] = i*A.max_nnz_row;
                 // sort the diagonal element into the right place
                 CHECK( magma_cmalloc_cpu( &val_tmp2, A.num_rows*A.max_nnz_row ));
                 CHECK( magma_index_malloc_cpu( &col_tmp2, A.num_rows*A.max_nnz_row ));
 
+                #pragma omp parallel for
                 for( magma_int_t j=0; j < A.num_rows; j++ ) {
                     magma_index_t diagcol = A.col[j*A.max_nnz_row];
                     magma_int_t smaller = 0;
@@ -1421,6 +1759,7 @@ magma_cmconvert(
                 // conversion
                 CHECK( magma_index_malloc_cpu( &row_tmp, A.num_rows+1 ));
                 //fill the row-pointer
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows+1; i++ )
                     row_tmp[i] = i*rowlength;
                 //now use AA_ELL, IA_ELL, row_tmp as CSR with some zeros.
@@ -1454,24 +1793,32 @@ magma_cmconvert(
                 CHECK( magma_index_malloc_cpu( &col_tmp,
                                                A.max_nnz_row*(A.num_rows+C) ));
                 // zero everything
+                #pragma omp parallel for
                 for(magma_int_t i=0; i < A.max_nnz_row*(A.num_rows+C); i++ ) {
                     val_tmp[ i ] = MAGMA_C_MAKE(0., 0.);
                     col_tmp[ i ] =  0;
                 }
 
                 //fill the row-pointer
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows+1; i++ ) {
                     row_tmp[i] = A.max_nnz_row*i;
                 }
 
-                //transform RowMajor to ColMajor
+                //transform RowMajor to ColMajor, undoing the row sorting
+                //of SELL-C-sigma
+                #pragma omp parallel for
                 for( magma_int_t k=0; k < slices; k++) {
                     magma_int_t blockinfo = (A.row[k+1]-A.row[k])/A.blocksize;
                     for( magma_int_t j=0; j < C; j++ ) {
+                        magma_int_t line = k*C+j;
+                        if ( A.sellp_perm != NULL && line < A.num_rows ) {
+                            line = A.sellp_perm[line];
+                        }
                         for( magma_int_t i=0; i < blockinfo; i++ ) {
-                            col_tmp[ (k*C+j)*A.max_nnz_row+i ] =
+                            col_tmp[ line*A.max_nnz_row+i ] =
                                                     A.col[A.row[k]+i*C+j];
-                            val_tmp[ (k*C+j)*A.max_nnz_row+i ] =
+                            val_tmp[ line*A.max_nnz_row+i ] =
                                                     A.val[A.row[k]+i*C+j];
                         }
                     }
@@ -1504,12 +1851,13 @@ magma_cmconvert(
                 CHECK( magma_index_malloc_cpu( &B->row, B->num_rows+1 ));
                 CHECK( magma_index_malloc_cpu( &B->col, B->nnz ));
 
+                #pragma omp parallel for
                 for( magma_int_t i=0; i < A.num_rows+1; i++) {
                     B->row[i] = A.row[i];
                 }
 
                 // step 1. transpose column_index and value arrays
-                //#pragma omp parallel for
+                #pragma omp parallel for
                 for (int par_id = 0; par_id < A.csr5_p; par_id++)
                 {
                     // if this is fast track tile, do not transpose it
@@ -1567,54 +1915,69 @@ magma_cmconvert(
 
                 // conversion
 
-                B->nnz=0;
-                for( magma_int_t i=0; i<(A.num_rows)*(A.num_cols); i++ ) {
-                    if ( MAGMA_C_REAL(A.val[i]) != 0.0 || MAGMA_C_IMAG(A.val[i]) != 0.0 )
-                        (B->nnz)++;
+                // count the nonzeros per row, scan into the row pointer
+                CHECK( magma_index_malloc_cpu( &B->row, B->num_rows+1 ));
+                #pragma omp parallel for
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
+                    magma_index_t count = 0;
+                    for( magma_int_t j=i*A.num_cols; j < (i+1)*A.num_cols; j++ ) {
+                        if ( MAGMA_C_REAL(A.val[j]) != 0.0 || MAGMA_C_IMAG(A.val[j]) != 0.0 )
+                            count++;
+                    }
+                    (B->row)[i] = count;
                 }
+                CHECK( magma_cmconvert_scan( A.num_rows, B->row ));
+                B->nnz = (B->row)[B->num_rows];
                 CHECK( magma_cmalloc_cpu( &B->val, B->nnz));
-                CHECK( magma_index_malloc_cpu( &B->row, B->num_rows+1 ));
                 CHECK( magma_index_malloc_cpu( &B->col, B->nnz ));
 
-                magma_int_t i = 0;
-                magma_int_t j = 0;
-                magma_int_t k = 0;
-
-                for(i=0; i<(A.num_rows)*(A.num_cols); i++)
-                {
-                    if ( i%(B->num_cols) == 0 )
-                    {
-                        (B->row)[k] = j;
-                        k++;
-                    }
-                    if ( MAGMA_C_REAL(A.val[i]) != 0 || MAGMA_C_IMAG(A.val[i]) != 0)
-                    {
-                        (B->val)[j] = A.val[i];
-                        (B->col)[j] = i%(B->num_cols);
-                        j++;
+                #pragma omp parallel for
+                for( magma_int_t i=0; i < A.num_rows; i++ ) {
+                    magma_index_t k = (B->row)[i];
+                    for( magma_int_t j=0; j < A.num_cols; j++ ) {
+                        magmaFloatComplex v = A.val[i*A.num_cols+j];
+                        if ( MAGMA_C_REAL(v) != 0 || MAGMA_C_IMAG(v) != 0)
+                        {
+                            (B->val)[k] = v;
+                            (B->col)[k] = j;
+                            k++;
+                        }
                     }
                 }
-                (B->row)[B->num_rows]=B->nnz;
 
                 //printf( "done\n" );
             }
 
             // BCSR to CSR
             else if ( old_format == Magma_BCSR ) {
-                CHECK( magma_cmtransfer(A, &dA, Magma_CPU, Magma_DEV, queue ) );
-                CHECK( magma_cmconvert(dA, &dB, Magma_BCSR, Magma_CSR, queue ) );
-                magma_cmfree( &dA, queue );
-                CHECK( magma_cmtransfer(dB, B, Magma_DEV, Magma_CPU, queue ) );
-                magma_cmfree( &dB, queue );
+                // fill in information for B
+                B->storage_type = Magma_CSR;
+                B->memory_location = A.memory_location;
+                B->fill_mode = A.fill_mode;
+                B->diameter = A.diameter;
+
+                // conversion
+                CHECK( magma_cmconvert_bcsr2csr( A, B ));
+            }
+
+            // VBCSR to CSR
+            else if ( old_format == Magma_VBCSR ) {
+                CHECK( magma_cmvbcsrtocsr( A, B, queue ));
             }
 
             // COO to CSR
             else if ( old_format == Magma_COO ) {
+                #if defined(HAVE_HOST)
+                // done by cuSPARSE on the device
+                printf("error: conversion not supported by the host backend.\n");
+                info = MAGMA_ERR_NOT_SUPPORTED;
+                #else
                 CHECK( magma_cmtransfer(A, &dA, Magma_CPU, Magma_DEV, queue ) );
                 CHECK( magma_cmconvert(dA, &dB, Magma_COO, Magma_CSR, queue ) );
                 magma_cmfree( &dA, queue );
                 CHECK( magma_cmtransfer(dB, B, Magma_DEV, Magma_CPU, queue ) );
                 magma_cmfree( &dB, queue );
+                #endif
             }
 
             else {
@@ -1630,6 +1993,17 @@ magma_cmconvert(
         }
     } // end CPU case
     else if ( A.memory_location == Magma_DEV ) {
+        #if defined(HAVE_HOST)
+        // the host backend has no cuSPARSE; convert a CPU copy
+        if ( old_format == Magma_CSR && new_format == Magma_CSR ) {
+            CHECK( magma_cmtransfer( A, B, Magma_DEV, Magma_DEV, queue ));
+        }
+        else {
+            CHECK( magma_cmtransfer( A, &hA, A.memory_location, Magma_CPU, queue ));
+            CHECK( magma_cmconvert( hA, &hB, old_format, new_format, queue ));
+            CHECK( magma_cmtransfer( hB, B, Magma_CPU, A.memory_location, queue ));
+        }
+        #else
         // CSR to CSR
         if ( old_format == Magma_CSR && new_format == Magma_CSR ) {
             CHECK( magma_cmtransfer( A, B, Magma_DEV, Magma_DEV, queue ));
@@ -1953,13 +2327,16 @@ magma_cmconvert(
             CHECK( magma_cmconvert( hA, &hB, old_format, new_format, queue ));
             CHECK( magma_cmtransfer( hB, B, Magma_CPU, A.memory_location, queue ));
         }
+        #endif
     }
 
 cleanup:
+    #if ! defined(HAVE_HOST)
     cusparseDestroyMatDescr(descr);
     cusparseDestroy(cusparseHandle);
     descr = NULL;
     cusparseHandle = NULL;
+    #endif
     magma_free( nnz_per_row );
     magma_free_cpu( row_tmp );
     magma_free_cpu( col_tmp );
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zmio.cpp, normal z -> c, Sat Mar 27 20:32:40 2021
+       @generated from sparse/control/magma_zmio.cpp, normal z -> c, Fri Oct 16 17:48:24 2026
        @author Hartwig Anzt
        @author Mark Gates
 */
@@ -14,12 +14,22 @@
 //  the IO functions provided by MatrixMarket
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 #include <utility>  // pair
 
+#if ! (defined( _WIN32 ) || defined( _WIN64 ))
+#include <sys/mman.h>  // mmap
+#include <sys/stat.h>
+#endif
+
 #include "magmasparse_internal.h"
 #include "magmasparse_mmio.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 /**
     Purpose
@@ -36,6 +46,307 @@ static bool compare_first(
 }
 
 
+// chunks smaller than this are not worth a thread of their own
+#define MAGMA_MTX_CHUNK_MIN_SIZE  (1 << 20)
+
+
+/**
+    Purpose
+    -------
+    Reads the nnz entries of a coordinate Matrix Market file. The file
+    position of fid has to be right after the size line.
+
+    The remainder of the file is mapped into memory (or read in one go if
+    mapping is not possible), split at line boundaries into one chunk per
+    thread, and parsed in two passes: the first pass counts the entry lines
+    in every chunk, which gives each chunk its offset in the COO arrays, the
+    second pass parses the entries in place. Row and column indices are
+    converted to zero-based indices and checked against the matrix size.
+    
+    zeros is set to 1 if a real-valued entry is an explicit zero.
+*/
+static magma_int_t
+magma_cmtx_read_entries(
+    FILE *fid,
+    MM_typecode matcode,
+    magma_index_t num_rows,
+    magma_index_t num_cols,
+    magma_int_t nnz,
+    magma_index_t *coo_row,
+    magma_index_t *coo_col,
+    magmaFloatComplex *coo_val,
+    magma_int_t *zeros )
+{
+    magma_int_t info = 0;
+
+    const char *data = NULL, *end = NULL;
+    std::vector< char > buffer;
+    std::vector< const char* > chunk;
+    std::vector< magma_int_t > offset;
+    magma_int_t nchunks = 1, nlines = 0;
+    int bad = 0, zero = 0;
+    int values = (mm_is_real(matcode) || mm_is_integer(matcode)) ? 1 :
+                 (mm_is_pattern(matcode) ? 0 : 2);   // values per entry
+
+#if ! (defined( _WIN32 ) || defined( _WIN64 ))
+    void *map = MAP_FAILED;
+    size_t map_size = 0;
+    struct stat st;
+    off_t start = ftello( fid );
+    if ( start >= 0 && fstat( fileno( fid ), &st ) == 0 && S_ISREG( st.st_mode )
+         && st.st_size > start )
+    {
+        map_size = (size_t) st.st_size;
+        map = mmap( NULL, map_size, PROT_READ, MAP_PRIVATE, fileno( fid ), 0 );
+        if ( map != MAP_FAILED ) {
+            #ifdef MADV_SEQUENTIAL
+            madvise( map, map_size, MADV_SEQUENTIAL );
+            #endif
+            data = (const char*) map + start;
+            end  = (const char*) map + map_size;
+        }
+    }
+#endif
+    if ( data == NULL ) {
+        // no mapping possible (pipe, Windows): read the rest of the file
+        char block[ 65536 ];
+        size_t got;
+        while ( (got = fread( block, 1, sizeof(block), fid )) > 0 ) {
+            buffer.insert( buffer.end(), block, block + got );
+        }
+        data = buffer.empty() ? NULL : &buffer[0];
+        end  = data + buffer.size();
+    }
+
+    #ifdef _OPENMP
+    nchunks = omp_get_max_threads();
+    #endif
+    nchunks = max( 1, min( nchunks, (magma_int_t)
+                  ((end - data) / MAGMA_MTX_CHUNK_MIN_SIZE) ));
+    chunk.resize( nchunks+1 );
+    offset.resize( nchunks+1, 0 );
+    
+    // chunk boundaries are moved to the start of the next line
+    chunk[0] = data;
+    chunk[nchunks] = end;
+    for( magma_int_t t = 1; t < nchunks; t++ ) {
+        const char *p = data + (end - data) / nchunks * t;
+        p = max( p, chunk[t-1] );
+        while ( p < end && *p != '\n' )
+            p++;
+        chunk[t] = (p < end) ? p+1 : end;
+    }
+
+    // first pass: count the entry lines of every chunk
+    #pragma omp parallel for schedule(static,1)
+    for( magma_int_t t = 0; t < nchunks; t++ ) {
+        magma_int_t count = 0;
+        const char *p = chunk[t];
+        while ( p < chunk[t+1] ) {
+            while ( p < chunk[t+1] && (*p == ' ' || *p == '\t' || *p == '\r') )
+                p++;
+            if ( p < chunk[t+1] && *p != '\n' && *p != '%' )
+                count++;
+            while ( p < chunk[t+1] && *p != '\n' )
+                p++;
+            p++;
+        }
+        offset[t+1] = count;
+    }
+    for( magma_int_t t = 0; t < nchunks; t++ ) {
+        offset[t+1] += offset[t];
+    }
+    nlines = offset[nchunks];
+    if ( nlines < nnz ) {
+        printf("\n%% Premature end of file: %lld of %lld entries found.\n",
+               (long long) nlines, (long long) nnz );
+        info = MAGMA_ERR_UNKNOWN;
+        goto cleanup;
+    }
+
+    // second pass: parse the entries, lines beyond nnz are ignored
+    #pragma omp parallel for schedule(static,1) reduction(+:bad,zero)
+    for( magma_int_t t = 0; t < nchunks; t++ ) {
+        magma_int_t i = offset[t];
+        const char *p = chunk[t];
+        while ( p < chunk[t+1] && i < nnz ) {
+            while ( p < chunk[t+1] && (*p == ' ' || *p == '\t' || *p == '\r') )
+                p++;
+            if ( p < chunk[t+1] && *p != '\n' && *p != '%' ) {
+                magma_index_t ROW = 0, COL = 0;
+                real_Double_t VAL = 1.0, VALC = 0.0;  // always parsed in 64 bit
+                if ( (p = mm_parse_index( p, end, &ROW )) == NULL ||
+                     (p = mm_parse_index( p, end, &COL )) == NULL ||
+                     (values > 0 && (p = mm_parse_real( p, end, &VAL  )) == NULL) ||
+                     (values > 1 && (p = mm_parse_real( p, end, &VALC )) == NULL) ||
+                     ROW < 1 || ROW > num_rows || COL < 1 || COL > num_cols )
+                {
+                    bad++;
+                    break;
+                }
+                if ( values == 1 && VAL == 0 )
+                    zero = 1;
+                coo_row[i] = ROW - 1;
+                coo_col[i] = COL - 1;
+                coo_val[i] = MAGMA_C_MAKE( VAL, VALC );
+                i++;
+            }
+            while ( p < chunk[t+1] && *p != '\n' )
+                p++;
+            p++;
+        }
+    }
+    if ( bad > 0 ) {
+        printf("\n%% Invalid or out of range entry in Matrix Market file.\n");
+        info = MAGMA_ERR_UNKNOWN;
+        goto cleanup;
+    }
+    *zeros = (zero > 0) ? 1 : 0;
+
+cleanup:
+#if ! (defined( _WIN32 ) || defined( _WIN64 ))
+    if ( map != MAP_FAILED ) {
+        munmap( map, map_size );
+    }
+#endif
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+    Converts a matrix in COO format into CSR format with sorted column
+    indices. If mirror is 1 (symmetric) or 2 (hermitian), the off-diagonal
+    entries are duplicated on the fly, such that no expanded COO copy is
+    needed.
+
+    The row counts and the scatter into the row buckets use atomic updates,
+    the column indices of every row are sorted in parallel afterwards.
+    Positions are computed in 64-bit; the routine fails with
+    MAGMA_ERR_NOT_SUPPORTED instead of overflowing if the (expanded) number
+    of nonzeros does not fit into magma_index_t.
+*/
+static magma_int_t
+magma_cmtx_coo_to_csr(
+    magma_index_t num_rows,
+    magma_int_t nnz,
+    const magma_index_t *coo_row,
+    const magma_index_t *coo_col,
+    const magmaFloatComplex *coo_val,
+    magma_int_t mirror,
+    magma_index_t **row,
+    magma_index_t **col,
+    magmaFloatComplex **val,
+    magma_int_t *nnz_csr,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    magma_index_t *pos = NULL;
+    long long off_diagonals = 0, total = 0, cumsum = 0;
+
+    *row = NULL;
+    *col = NULL;
+    *val = NULL;
+
+    CHECK( magma_index_malloc_cpu( row, num_rows+1 ));
+    CHECK( magma_index_malloc_cpu( &pos, num_rows+1 ));
+
+    #pragma omp parallel for
+    for( magma_int_t i = 0; i < num_rows+1; i++ ) {
+        pos[i] = 0;
+    }
+    
+    // count the entries of every row
+    #pragma omp parallel for reduction(+:off_diagonals)
+    for( magma_int_t i = 0; i < nnz; i++ ) {
+        #pragma omp atomic
+        pos[ coo_row[i] ]++;
+        if ( mirror > 0 && coo_row[i] != coo_col[i] ) {
+            #pragma omp atomic
+            pos[ coo_col[i] ]++;
+            off_diagonals++;
+        }
+    }
+    total = (long long) nnz + off_diagonals;
+    if ( total > (std::numeric_limits< magma_index_t >::max)() ) {
+        printf("\n%% Matrix has %lld nonzeros, exceeding the range of magma_index_t.\n",
+               total );
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+    
+    // cumulative sum the nnz per row to get row[]
+    for( magma_int_t i = 0; i < num_rows; i++ ) {
+        magma_index_t temp = pos[i];
+        (*row)[i] = pos[i] = (magma_index_t) cumsum;
+        cumsum += temp;
+    }
+    (*row)[num_rows] = (magma_index_t) total;
+    
+    CHECK( magma_index_malloc_cpu( col, total ));
+    CHECK( magma_cmalloc_cpu( val, total ));
+
+    // scatter into the row buckets
+    #pragma omp parallel for
+    for( magma_int_t i = 0; i < nnz; i++ ) {
+        magma_index_t r = coo_row[i], c = coo_col[i], dest;
+        #pragma omp atomic capture
+        dest = pos[r]++;
+        (*col)[dest] = c;
+        (*val)[dest] = coo_val[i];
+        if ( mirror > 0 && r != c ) {
+            #pragma omp atomic capture
+            dest = pos[c]++;
+            (*col)[dest] = r;
+            (*val)[dest] = (mirror == 1) ? coo_val[i] : conj(coo_val[i]);
+        }
+    }
+
+    // sort column indices within each row
+    // copy into vector of pairs (column index, value), sort by column index, then copy back
+    #pragma omp parallel
+    {
+        std::vector< std::pair< magma_index_t, magmaFloatComplex > > rowval;
+        #pragma omp for schedule(dynamic,1024)
+        for( magma_int_t k=0; k < num_rows; ++k ) {
+            magma_index_t kk  = (*row)[k];
+            magma_index_t len = (*row)[k+1] - (*row)[k];
+            bool sorted = true;
+            for( magma_index_t i=1; i < len && sorted; ++i ) {
+                sorted = ( (*col)[kk+i-1] <= (*col)[kk+i] );
+            }
+            if ( sorted ) {
+                continue;
+            }
+            rowval.resize( len );
+            for( magma_index_t i=0; i < len; ++i ) {
+                rowval[i] = std::make_pair( (*col)[kk+i], (*val)[kk+i] );
+            }
+            std::sort( rowval.begin(), rowval.end(), compare_first );
+            for( magma_index_t i=0; i < len; ++i ) {
+                (*col)[kk+i] = rowval[i].first;
+                (*val)[kk+i] = rowval[i].second;
+            }
+        }
+    }
+    *nnz_csr = (magma_int_t) total;
+
+cleanup:
+    if ( info != 0 ) {
+        magma_free_cpu( *row );
+        magma_free_cpu( *col );
+        magma_free_cpu( *val );
+        *row = NULL;
+        *col = NULL;
+        *val = NULL;
+    }
+    magma_free_cpu( pos );
+    return info;
+}
+
+
 /**
     Purpose
     -------
@@ -107,11 +418,7 @@ magma_int_t read_c_csr_from_mtx(
     
     magma_index_t *coo_col=NULL, *coo_row=NULL;
     magmaFloatComplex *coo_val=NULL;
-    magma_index_t *new_col=NULL, *new_row=NULL;
-    magmaFloatComplex *new_val=NULL;
-    magma_int_t hermitian = 0;
-    
-    std::vector< std::pair< magma_index_t, magmaFloatComplex > > rowval;
+    magma_int_t mirror = 0, zeros = 0;
     
     FILE *fid = NULL;
     MM_typecode matcode;
@@ -168,158 +475,24 @@ magma_int_t read_c_csr_from_mtx(
     CHECK( magma_index_malloc_cpu( &coo_row, *nnz ) );
     CHECK( magma_cmalloc_cpu( &coo_val, *nnz ) );
 
-    if (mm_is_real(matcode) || mm_is_integer(matcode)) {
-        for(magma_int_t i = 0; i < *nnz; ++i) {
-            magma_index_t ROW, COL;
-            float VAL;  // always read in a float and convert later if necessary
-            
-            fscanf(fid, " %d %d %f \n", &ROW, &COL, &VAL);
-            
-            coo_row[i] = ROW - 1;
-            coo_col[i] = COL - 1;
-            coo_val[i] = MAGMA_C_MAKE( VAL, 0.);
-        }
-    } else if (mm_is_pattern(matcode) ) {
-        for(magma_int_t i = 0; i < *nnz; ++i) {
-            magma_index_t ROW, COL;
-            
-            fscanf(fid, " %d %d \n", &ROW, &COL );
-            
-            coo_row[i] = ROW - 1;
-            coo_col[i] = COL - 1;
-            coo_val[i] = MAGMA_C_MAKE( 1.0, 0.);
-        }
-    } else if (mm_is_complex(matcode) ){
-        for (magma_int_t i = 0; i < *nnz; ++i) {
-            magma_index_t ROW, COL;
-            float VAL, VALC;  // always read in a float and convert later if necessary
-            
-            fscanf(fid, " %d %d %f %f\n", &ROW, &COL, &VAL, &VALC);
-            
-            coo_row[i] = ROW - 1;
-            coo_col[i] = COL - 1;
-            coo_val[i] = MAGMA_C_MAKE( VAL, VALC);
-        }
-        // printf(" ...successfully read complex matrix... ");
-    } else {
-        printf("\n%% Unrecognized data type\n");
-        info = MAGMA_ERR_NOT_SUPPORTED;
-        goto cleanup;
-    }
+    CHECK( magma_cmtx_read_entries( fid, matcode, num_rows, num_cols, *nnz,
+                                    coo_row, coo_col, coo_val, &zeros ));
     fclose(fid);
     fid = NULL;
     printf(" done. Converting to CSR:");
     fflush(stdout);
     
-
     if( mm_is_hermitian(matcode) ) {
-        hermitian = 1;
-        printf("hermitian case!\n\n\n");
+        mirror = 2;
+    } else if ( mm_is_symmetric(matcode) ) {
+        mirror = 1;
     }
-    if ( mm_is_symmetric(matcode) || mm_is_hermitian(matcode) ) { 
-                                        // duplicate off diagonal entries
+    if ( mirror > 0 ) {         // duplicate off diagonal entries
         printf("\n%% Detected symmetric case.");
-        
-        magma_index_t off_diagonals = 0;
-        for(magma_int_t i = 0; i < *nnz; ++i) {
-            if (coo_row[i] != coo_col[i])
-                ++off_diagonals;
-        }
-        magma_index_t true_nonzeros = 2*off_diagonals + (*nnz - off_diagonals);
-        
-        //printf("%% total number of nonzeros: %d\n%%", int(*nnz));
-
-        CHECK( magma_index_malloc_cpu( &new_row, true_nonzeros ));
-        CHECK( magma_index_malloc_cpu( &new_col, true_nonzeros ));
-        CHECK( magma_cmalloc_cpu( &new_val, true_nonzeros ));
-    
-        magma_index_t ptr = 0;
-        for(magma_int_t i = 0; i < *nnz; ++i) {
-            if (coo_row[i] != coo_col[i]) {
-                new_row[ptr] = coo_row[i];
-                new_col[ptr] = coo_col[i];
-                new_val[ptr] = coo_val[i];
-                ptr++;
-                new_col[ptr] = coo_row[i];
-                new_row[ptr] = coo_col[i];
-                new_val[ptr] = (hermitian == 0) ? coo_val[i] : conj(coo_val[i]);
-                ptr++;
-            } else {
-                new_row[ptr] = coo_row[i];
-                new_col[ptr] = coo_col[i];
-                new_val[ptr] = coo_val[i];
-                ptr++;
-            }
-        }
-        
-        magma_free_cpu(coo_row); 
-        magma_free_cpu(coo_col); 
-        magma_free_cpu(coo_val);
-
-        coo_row = new_row;
-        coo_col = new_col;
-        coo_val = new_val;
-        
-        *nnz = true_nonzeros;
-    } // end symmetric case
-    
-    CHECK( magma_cmalloc_cpu( val, *nnz ) );
-    
-    CHECK( magma_index_malloc_cpu( col, *nnz ) );
-    CHECK( magma_index_malloc_cpu( row, (*n_row+1) ) );
-    CHECK( magma_cmalloc_cpu( val, *nnz ) );
-
-    // original code from  Nathan Bell and Michael Garland
-    for (magma_index_t i = 0; i < num_rows; i++)
-        (*row)[i] = 0;
-    
-    for (magma_index_t i = 0; i < *nnz; i++)
-        (*row)[coo_row[i]]++;
-    
-    // cumulative sum the nnz per row to get row[]
-    magma_int_t cumsum;
-    cumsum = 0;
-    for(magma_int_t i = 0; i < num_rows; i++) {
-        magma_index_t temp = (*row)[i];
-        (*row)[i] = cumsum;
-        cumsum += temp;
-    }
-    (*row)[num_rows] = *nnz;
-    
-    // write Aj,Ax into Bj,Bx
-    for(magma_int_t i = 0; i < *nnz; i++) {
-        magma_index_t row_  = coo_row[i];
-        magma_index_t dest = (*row)[row_];
-        (*col)[dest] = coo_col[i];
-        (*val)[dest] = coo_val[i];
-        (*row)[row_]++;
-    }
-    
-    int last;
-    last = 0;
-    for(int i = 0; i <= num_rows; i++) {
-        int temp  = (*row)[i];
-        (*row)[i] = last;
-        last      = temp;
     }
     
-    (*row)[*n_row] = *nnz;
-
-    // sort column indices within each row
-    // copy into vector of pairs (column index, value), sort by column index, then copy back
-    for (magma_index_t k=0; k < *n_row; ++k) {
-        int kk  = (*row)[k];
-        int len = (*row)[k+1] - (*row)[k];
-        rowval.resize( len );
-        for( int i=0; i < len; ++i ) {
-            rowval[i] = std::make_pair( (*col)[kk+i], (*val)[kk+i] );
-        }
-        std::sort( rowval.begin(), rowval.end(), compare_first );
-        for( int i=0; i < len; ++i ) {
-            (*col)[kk+i] = rowval[i].first;
-            (*val)[kk+i] = rowval[i].second;
-        }
-    }
+    CHECK( magma_cmtx_coo_to_csr( num_rows, *nnz, coo_row, coo_col, coo_val,
+                                  mirror, row, col, val, nnz, queue ));
 
     printf(" done.\n");
 cleanup:
@@ -920,6 +1093,8 @@ cleanup:
     Reads in a matrix stored in coo format from a Matrix Market (.mtx)
     file and converts it into CSR format. It duplicates the off-diagonal
     entries in the symmetric case.
+    Files written by magma_cwrite_csr_bin are recognized and loaded
+    without parsing.
 
     Arguments
     ---------
@@ -948,25 +1123,33 @@ magma_c_csr_mtx(
     char buffer[ 1024 ];
     magma_int_t info = 0;
 
-    int csr_compressor = 0;       // checks for zeros in original file
+    magma_int_t csr_compressor = 0;       // checks for zeros in original file
     
     magma_c_matrix B={Magma_CSR};
 
     magma_index_t *coo_col = NULL;
     magma_index_t *coo_row = NULL;
     magmaFloatComplex *coo_val = NULL;
-    magmaFloatComplex *new_val = NULL;
-    magma_index_t* new_row = NULL;
-    magma_index_t* new_col = NULL;
-    magma_int_t hermitian = 0;
+    magma_int_t mirror = 0;
     
     // make sure the target structure is empty
     magma_cmfree( A, queue );
     A->ownership = MagmaTrue;
-    std::vector< std::pair< magma_index_t, magmaFloatComplex > > rowval;
     
     FILE *fid = NULL;
     MM_typecode matcode;
+    
+    // binary cache written by magma_cwrite_csr_bin: copy it into CSR
+    if ( mm_is_magma_bin( filename ) ) {
+        CHECK( magma_c_csr_bin( &B, filename, queue ));
+        if ( B.storage_type == Magma_CSR ) {
+            CHECK( magma_cmtransfer( B, A, Magma_CPU, Magma_CPU, queue ));
+        } else {
+            CHECK( magma_cmconvert( B, A, B.storage_type, Magma_CSR, queue ));
+        }
+        goto cleanup;
+    }
+    
     fid = fopen(filename, "r");
     
     if (fid == NULL) {
@@ -1021,45 +1204,8 @@ magma_c_csr_mtx(
     CHECK( magma_index_malloc_cpu( &coo_row, A->nnz ) );
     CHECK( magma_cmalloc_cpu( &coo_val, A->nnz ) );
 
-    if (mm_is_real(matcode) || mm_is_integer(matcode)) {
-        for(magma_int_t i = 0; i < A->nnz; ++i) {
-            magma_index_t ROW, COL;
-            float VAL;  // always read in a float and convert later if necessary
-            
-            fscanf(fid, " %d %d %f \n", &ROW, &COL, &VAL);
-            if ( VAL == 0 )
-                csr_compressor = 1;
-            coo_row[i] = ROW - 1;
-            coo_col[i] = COL - 1;
-            coo_val[i] = MAGMA_C_MAKE( VAL, 0.);
-        }
-    } else if (mm_is_pattern(matcode) ) {
-        for(magma_int_t i = 0; i < A->nnz; ++i) {
-            magma_index_t ROW, COL;
-            
-            fscanf(fid, " %d %d \n", &ROW, &COL );
-            
-            coo_row[i] = ROW - 1;
-            coo_col[i] = COL - 1;
-            coo_val[i] = MAGMA_C_MAKE( 1.0, 0.);
-        }
-    } else if (mm_is_complex(matcode) ){
-        for (magma_int_t i = 0; i < A->nnz; ++i) {
-            magma_index_t ROW, COL;
-            float VAL, VALC;  // always read in a float and convert later if necessary
-            
-            fscanf(fid, " %d %d %f %f\n", &ROW, &COL, &VAL, &VALC);
-            
-            coo_row[i] = ROW - 1;
-            coo_col[i] = COL - 1;
-            coo_val[i] = MAGMA_C_MAKE( VAL, VALC);
-        }
-        // printf(" ...successfully read complex matrix... ");
-    } else {
-        printf("\n%% Unrecognized data type\n");
-        info = MAGMA_ERR_NOT_SUPPORTED;
-        goto cleanup;
-    }
+    CHECK( magma_cmtx_read_entries( fid, matcode, num_rows, num_cols, A->nnz,
+                                    coo_row, coo_col, coo_val, &csr_compressor ));
     fclose(fid);
     fid = NULL;
     printf(" done. Converting to CSR:");
@@ -1067,86 +1213,18 @@ magma_c_csr_mtx(
     
     A->sym = Magma_GENERAL;
 
-
     if( mm_is_hermitian(matcode) ) {
-        hermitian = 1;
+        mirror = 2;
+    } else if ( mm_is_symmetric(matcode) ) {
+        mirror = 1;
     }
-    if ( mm_is_symmetric(matcode) || mm_is_hermitian(matcode) ) { 
-                                        // duplicate off diagonal entries
+    if ( mirror > 0 ) {         // duplicate off diagonal entries
         printf("\n%% Detected symmetric case.");
         A->sym = Magma_SYMMETRIC;
-        magma_index_t off_diagonals = 0;
-        for(magma_int_t i = 0; i < A->nnz; ++i) {
-            if (coo_row[i] != coo_col[i])
-                ++off_diagonals;
-        }
-        magma_index_t true_nonzeros = 2*off_diagonals + (A->nnz - off_diagonals);
-        
-        //printf("%% total number of nonzeros: %d\n%%", int(A->nnz));
-
-        CHECK( magma_index_malloc_cpu( &new_row, true_nonzeros ));
-        CHECK( magma_index_malloc_cpu( &new_col, true_nonzeros ));
-        CHECK( magma_cmalloc_cpu( &new_val, true_nonzeros ));
-        
-        magma_index_t ptr = 0;
-        for(magma_int_t i = 0; i < A->nnz; ++i) {
-            if (coo_row[i] != coo_col[i]) {
-                new_row[ptr] = coo_row[i];
-                new_col[ptr] = coo_col[i];
-                new_val[ptr] = coo_val[i];
-                ptr++;
-                new_col[ptr] = coo_row[i];
-                new_row[ptr] = coo_col[i];
-                new_val[ptr] = (hermitian == 0) ? coo_val[i] : conj(coo_val[i]);
-                ptr++;
-            } else {
-                new_row[ptr] = coo_row[i];
-                new_col[ptr] = coo_col[i];
-                new_val[ptr] = coo_val[i];
-                ptr++;
-            }
-        }
-        
-        magma_free_cpu(coo_row);
-        magma_free_cpu(coo_col);
-        magma_free_cpu(coo_val);
-
-        coo_row = new_row;
-        coo_col = new_col;
-        coo_val = new_val;
-        A->nnz = true_nonzeros;
-        //printf("total number of nonzeros: %d\n", A->nnz);
-    } // end symmetric case
-    
-    CHECK( magma_cmalloc_cpu( &A->val, A->nnz ));
-    CHECK( magma_index_malloc_cpu( &A->col, A->nnz ));
-    CHECK( magma_index_malloc_cpu( &A->row, A->num_rows+1 ));
-    
-    // original code from Nathan Bell and Michael Garland
-    for (magma_index_t i = 0; i < num_rows; i++)
-        (A->row)[i] = 0;
-    
-    for (magma_index_t i = 0; i < A->nnz; i++)
-        (A->row)[coo_row[i]]++;
-        
-    // cumulative sum the nnz per row to get row[]
-    magma_int_t cumsum;
-    cumsum = 0;
-    for(magma_int_t i = 0; i < num_rows; i++) {
-        magma_index_t temp = (A->row)[i];
-        (A->row)[i] = cumsum;
-        cumsum += temp;
     }
-    (A->row)[num_rows] = A->nnz;
     
-    // write Aj,Ax into Bj,Bx
-    for(magma_int_t i = 0; i < A->nnz; i++) {
-        magma_index_t row_ = coo_row[i];
-        magma_index_t dest = (A->row)[row_];
-        (A->col)[dest] = coo_col[i];
-        (A->val)[dest] = coo_val[i];
-        (A->row)[row_]++;
-    }    
+    CHECK( magma_cmtx_coo_to_csr( num_rows, A->nnz, coo_row, coo_col, coo_val,
+                                  mirror, &A->row, &A->col, &A->val, &A->nnz, queue ));
     magma_free_cpu(coo_row);
     magma_free_cpu(coo_col);
     magma_free_cpu(coo_val);
@@ -1154,31 +1232,6 @@ magma_c_csr_mtx(
     coo_col = NULL;
     coo_val = NULL;
 
-    int last;
-    last = 0;
-    for(int i = 0; i <= num_rows; i++) {
-        int temp    = (A->row)[i];
-        (A->row)[i] = last;
-        last        = temp;
-    }
-    (A->row)[A->num_rows] = A->nnz;
-    
-    // sort column indices within each row
-    // copy into vector of pairs (column index, value), sort by column index, then copy back
-    for (magma_index_t k=0; k < A->num_rows; ++k) {
-        int kk  = (A->row)[k];
-        int len = (A->row)[k+1] - (A->row)[k];
-        rowval.resize( len );
-        for( int i=0; i < len; ++i ) {
-            rowval[i] = std::make_pair( (A->col)[kk+i], (A->val)[kk+i] );
-        }
-        std::sort( rowval.begin(), rowval.end(), compare_first );
-        for( int i=0; i < len; ++i ) {
-            (A->col)[kk+i] = rowval[i].first;
-            (A->val)[kk+i] = rowval[i].second;
-        }
-    }
-
     if ( csr_compressor > 0) { // run the CSR compressor to remove zeros
         //printf("removing zeros: ");
         CHECK( magma_cmtransfer( *A, &B, Magma_CPU, Magma_CPU, queue ));
@@ -1201,7 +1254,7 @@ cleanup:
         fclose( fid );
         fid = NULL;
     }
-    magma_cmfree( &B, queue );
+    magma_cmfree_bin( &B, queue );
     magma_free_cpu(coo_row);
     magma_free_cpu(coo_col);
     magma_free_cpu(coo_val);
@@ -1246,12 +1299,10 @@ magma_c_csr_mtxsymm(
     
     magma_c_matrix B={Magma_CSR};
         
-    int csr_compressor = 0;       // checks for zeros in original file
+    magma_int_t csr_compressor = 0;       // checks for zeros in original file
     
     magma_index_t *coo_col=NULL, *coo_row=NULL;
     magmaFloatComplex *coo_val=NULL;
-
-    std::vector< std::pair< magma_index_t, magmaFloatComplex > > rowval;
     
     FILE *fid = NULL;
     MM_typecode matcode;
@@ -1311,46 +1362,8 @@ magma_c_csr_mtxsymm(
     CHECK( magma_index_malloc_cpu( &coo_row, A->nnz ) );
     CHECK( magma_cmalloc_cpu( &coo_val, A->nnz ) );
     
-    if (mm_is_real(matcode) || mm_is_integer(matcode)) {
-        for(magma_int_t i = 0; i < A->nnz; ++i) {
-            magma_index_t ROW, COL;
-            float VAL;  // always read in a float and convert later if necessary
-            
-            fscanf(fid, " %d %d %f \n", &ROW, &COL, &VAL);
-            if ( VAL == 0 )
-                csr_compressor = 1;
-            coo_row[i] = ROW - 1;
-            coo_col[i] = COL - 1;
-            coo_val[i] = MAGMA_C_MAKE( VAL, 0.);
-        }
-    } else if (mm_is_pattern(matcode) ) {
-        for(magma_int_t i = 0; i < A->nnz; ++i) {
-            magma_index_t ROW, COL;
-            
-            fscanf(fid, " %d %d \n", &ROW, &COL);
-            
-            coo_row[i] = ROW - 1;
-            coo_col[i] = COL - 1;
-            coo_val[i] = MAGMA_C_MAKE( 1.0, 0.);
-        }
-    } else if (mm_is_complex(matcode) ){
-        for (magma_int_t i = 0; i < A->nnz; ++i) {
-            magma_index_t ROW, COL;
-            float VAL, VALC;  // always read in a float and convert later if necessary
-            
-            fscanf(fid, " %d %d %f %f\n", &ROW, &COL, &VAL, &VALC);
-            
-            coo_row[i] = ROW - 1;
-            coo_col[i] = COL - 1;
-            coo_val[i] = MAGMA_C_MAKE( VAL, VALC);
-        }
-        // printf(" ...successfully read complex matrix... ");
-    } else {
-        printf("Unrecognized data type\n");
-        info = MAGMA_ERR_NOT_SUPPORTED;
-        // TODO goto cleanup?
-    }
-    
+    CHECK( magma_cmtx_read_entries( fid, matcode, num_rows, num_cols, A->nnz,
+                                    coo_row, coo_col, coo_val, &csr_compressor ));
     fclose(fid);
     fid = NULL;
     printf(" done. Converting to CSR:");
@@ -1363,67 +1376,14 @@ magma_c_csr_mtxsymm(
         A->sym = Magma_SYMMETRIC;
     } // end symmetric case
     
-    CHECK( magma_index_malloc_cpu( &A->col, A->nnz ) );
-    CHECK( magma_index_malloc_cpu( &A->row, A->num_rows+1 ) );
-    CHECK( magma_cmalloc_cpu( &A->val, A->nnz ) );
-
-    // original code from  Nathan Bell and Michael Garland
-    for (magma_index_t i = 0; i < num_rows; i++)
-        (A->row)[i] = 0;
-    
-    for (magma_index_t i = 0; i < A->nnz; i++)
-        (A->row)[coo_row[i]]++;
-    
-    // cumulative sum the nnz per row to get row[]
-    magma_int_t cumsum;
-    cumsum = 0;
-    for(magma_int_t i = 0; i < num_rows; i++) {
-        magma_index_t temp = (A->row)[i];
-        (A->row)[i] = cumsum;
-        cumsum += temp;
-    }
-    (A->row)[num_rows] = A->nnz;
-    
-    // write Aj,Ax into Bj,Bx
-    for(magma_int_t i = 0; i < A->nnz; i++) {
-        magma_index_t row_  = coo_row[i];
-        magma_index_t dest = (A->row)[row_];
-        (A->col)[dest] = coo_col[i];
-        (A->val)[dest] = coo_val[i];
-        (A->row)[row_]++;
-    }
+    CHECK( magma_cmtx_coo_to_csr( num_rows, A->nnz, coo_row, coo_col, coo_val,
+                                  0, &A->row, &A->col, &A->val, &A->nnz, queue ));
     magma_free_cpu(coo_row);
     magma_free_cpu(coo_col);
     magma_free_cpu(coo_val);
     coo_row = NULL;
     coo_col = NULL;
     coo_val = NULL;
-    
-    int last;
-    last = 0;
-    for(int i = 0; i <= num_rows; i++) {
-        int temp    = (A->row)[i];
-        (A->row)[i] = last;
-        last        = temp;
-    }
-    
-    (A->row)[A->num_rows]=A->nnz;
-    
-    // sort column indices within each row
-    // copy into vector of pairs (column index, value), sort by column index, then copy back
-    for (magma_index_t k=0; k < A->num_rows; ++k) {
-        int kk  = (A->row)[k];
-        int len = (A->row)[k+1] - (A->row)[k];
-        rowval.resize( len );
-        for( int i=0; i < len; ++i ) {
-            rowval[i] = std::make_pair( (A->col)[kk+i], (A->val)[kk+i] );
-        }
-        std::sort( rowval.begin(), rowval.end(), compare_first );
-        for( int i=0; i < len; ++i ) {
-            (A->col)[kk+i] = rowval[i].first;
-            (A->val)[kk+i] = rowval[i].second;
-        }
-    }
 
     if ( csr_compressor > 0) { // run the CSR compressor to remove zeros
         //printf("removing zeros: ");
@@ -0,0 +1,529 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/control/magma_zmbin.cpp, normal z -> d, Fri Oct 16 19:15:57 2026
+*/
+
+#include <map>
+
+#if ! (defined( _WIN32 ) || defined( _WIN64 ))
+#include <sys/mman.h>  // mmap
+#include <sys/stat.h>
+#define MAGMA_BIN_MMAP
+#endif
+
+#include "magmasparse_internal.h"
+#include "magmasparse_mmio.h"
+
+#define REAL
+
+
+// files mapped by magma_d_csr_bin: base address -> mapped size
+static std::map< void*, size_t > magma_dbin_maps;
+
+
+/**
+    Purpose
+    -------
+    Appends the array *p of the given size in bytes to the section list.
+*/
+static void magma_dbin_add(
+    void **p,
+    int64_t bytes,
+    void **ptr[],
+    int64_t size[],
+    int32_t *num )
+{
+    ptr[ *num ]  = p;
+    size[ *num ] = bytes;
+    (*num)++;
+}
+
+
+/**
+    Purpose
+    -------
+    Lists the arrays of a CPU matrix in the order they are stored in the
+    binary container, together with their sizes in bytes. The sizes are
+    derived from the scalar fields of A only, such that the same list can
+    be used to write the arrays and to set the pointers when loading.
+    The values always come first.
+*/
+static magma_int_t
+magma_dbin_sections(
+    magma_d_matrix *A,
+    void **ptr[],
+    int64_t size[],
+    int32_t *num )
+{
+    magma_int_t info = 0;
+
+    int64_t n   = A->num_rows;
+    int64_t nnz = A->nnz;
+    int64_t vs  = sizeof(double);
+    int64_t is  = sizeof(magma_index_t);
+    int64_t us  = sizeof(magma_uindex_t);
+    int64_t len;
+
+    *num = 0;
+    switch( A->storage_type ) {
+        case Magma_CSR:
+        case Magma_CSRL:
+        case Magma_CSRU:
+        case Magma_CSRD:
+        case Magma_CSRCOO:
+            magma_dbin_add( (void**) &A->val,    nnz*vs,  ptr, size, num );
+            magma_dbin_add( (void**) &A->row,    (n+1)*is, ptr, size, num );
+            magma_dbin_add( (void**) &A->col,    nnz*is,  ptr, size, num );
+            if ( A->storage_type == Magma_CSRCOO ) {
+                magma_dbin_add( (void**) &A->rowidx, nnz*is, ptr, size, num );
+            }
+            break;
+        case Magma_COO:
+            // the CPU COO format keeps the row indices in row
+            magma_dbin_add( (void**) &A->val,    nnz*vs,  ptr, size, num );
+            magma_dbin_add( (void**) &A->row,    nnz*is,  ptr, size, num );
+            magma_dbin_add( (void**) &A->col,    nnz*is,  ptr, size, num );
+            break;
+        case Magma_ELL:
+        case Magma_ELLPACKT:
+        case Magma_ELLD:
+            len = n * A->max_nnz_row;
+            magma_dbin_add( (void**) &A->val,    len*vs,  ptr, size, num );
+            magma_dbin_add( (void**) &A->col,    len*is,  ptr, size, num );
+            break;
+        case Magma_ELLRT:
+            len = n * magma_roundup( A->max_nnz_row, A->alignment );
+            magma_dbin_add( (void**) &A->val,    len*vs,  ptr, size, num );
+            magma_dbin_add( (void**) &A->col,    len*is,  ptr, size, num );
+            magma_dbin_add( (void**) &A->row,    n*is,    ptr, size, num );
+            break;
+        case Magma_SELLP:
+            if ( A->sellp_perm != NULL ) {
+                printf("error: SELL-C-sigma with sorted rows not supported by the binary matrix container.\n");
+                info = MAGMA_ERR_NOT_SUPPORTED;
+                break;
+            }
+            magma_dbin_add( (void**) &A->val,    nnz*vs,  ptr, size, num );
+            magma_dbin_add( (void**) &A->col,    nnz*is,  ptr, size, num );
+            magma_dbin_add( (void**) &A->row,    (A->numblocks+1)*is, ptr, size, num );
+            break;
+        case Magma_CSR5:
+            len = (int64_t) A->csr5_p * MAGMA_CSR5_OMEGA * A->csr5_num_packets;
+            magma_dbin_add( (void**) &A->val,    nnz*vs,  ptr, size, num );
+            magma_dbin_add( (void**) &A->row,    (n+1)*is, ptr, size, num );
+            magma_dbin_add( (void**) &A->col,    nnz*is,  ptr, size, num );
+            magma_dbin_add( (void**) &A->tile_ptr,  (A->csr5_p+1)*us, ptr, size, num );
+            magma_dbin_add( (void**) &A->tile_desc, len*us,           ptr, size, num );
+            magma_dbin_add( (void**) &A->tile_desc_offset_ptr,
+                            (A->csr5_p+1)*is, ptr, size, num );
+            magma_dbin_add( (void**) &A->tile_desc_offset,
+                            A->csr5_num_offsets*is, ptr, size, num );
+            magma_dbin_add( (void**) &A->calibrator, A->csr5_p*vs, ptr, size, num );
+            break;
+        default:
+            printf("error: format not supported by the binary matrix container.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+    }
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Writes a matrix to a binary file that can be loaded without parsing
+    by magma_d_csr_bin. The container holds a versioned header followed by
+    the arrays of the matrix, each aligned to MAGMA_BIN_ALIGNMENT bytes.
+
+    Besides CSR, the matrix can be in COO, CSRCOO, ELL, ELLPACKT, ELLD,
+    ELLRT, SELLP or CSR5 format; the arrays of these formats are stored as
+    they are, such that a conversion done once (e.g. the SELL-P slices or
+    the CSR5 tile descriptors) is cached as well. Matrices generated by
+    magma_dm_5stencil or magma_dm_27stencil can be cached the same way as
+    matrices read from Matrix Market files.
+
+    The file is written to filename.tmp first and renamed afterwards,
+    so a concurrent reader never sees a partial file.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_d_matrix
+                sparse matrix, if not on the CPU a copy is transferred
+
+    @param[in]
+    filename    const char*
+                output filename
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_daux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_dwrite_csr_bin(
+    magma_d_matrix A,
+    const char *filename,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    magma_d_matrix hA={Magma_CSR};
+    magma_bin_header head;
+    void **ptr[ MAGMA_BIN_MAX_SECTIONS ];
+    int64_t size[ MAGMA_BIN_MAX_SECTIONS ];
+    int32_t num = 0;
+    int64_t pos = 0;
+    static const char zeros[ MAGMA_BIN_ALIGNMENT ] = { 0 };
+    char *tmpname = NULL;
+    FILE *fp = NULL;
+
+    if ( A.memory_location == Magma_CPU ) {
+        hA = A;
+        hA.ownership = MagmaFalse;
+    } else {
+        CHECK( magma_dmtransfer( A, &hA, A.memory_location, Magma_CPU, queue ));
+    }
+    CHECK( magma_dbin_sections( &hA, ptr, size, &num ));
+
+    memset( &head, 0, sizeof(head) );
+    memcpy( head.magic, MAGMA_BIN_MAGIC, sizeof(head.magic) );
+    head.version                 = MAGMA_BIN_VERSION;
+    head.byte_order              = MAGMA_BIN_BYTE_ORDER;
+    head.value_size              = sizeof(double);
+    #ifdef COMPLEX
+    head.num_components          = 2;
+    #else
+    head.num_components          = 1;
+    #endif
+    head.index_size              = sizeof(magma_index_t);
+    head.storage_type            = hA.storage_type;
+    head.sym                     = hA.sym;
+    head.diagorder_type          = hA.diagorder_type;
+    head.fill_mode               = hA.fill_mode;
+    head.num_sections            = num;
+    head.num_rows                = hA.num_rows;
+    head.num_cols                = hA.num_cols;
+    head.nnz                     = hA.nnz;
+    head.true_nnz                = hA.true_nnz;
+    head.max_nnz_row             = hA.max_nnz_row;
+    head.diameter                = hA.diameter;
+    head.blocksize               = hA.blocksize;
+    head.numblocks               = hA.numblocks;
+    head.alignment               = hA.alignment;
+    head.csr5_sigma              = hA.csr5_sigma;
+    head.csr5_bit_y_offset       = hA.csr5_bit_y_offset;
+    head.csr5_bit_scansum_offset = hA.csr5_bit_scansum_offset;
+    head.csr5_num_packets        = hA.csr5_num_packets;
+    head.csr5_p                  = hA.csr5_p;
+    head.csr5_num_offsets        = hA.csr5_num_offsets;
+    head.csr5_tail_tile_start    = hA.csr5_tail_tile_start;
+    pos = MAGMA_BIN_ALIGNMENT;
+    for( int32_t k = 0; k < num; k++ ) {
+        head.offset[k] = pos;
+        head.size[k]   = size[k];
+        pos += (size[k] + MAGMA_BIN_ALIGNMENT-1) / MAGMA_BIN_ALIGNMENT * MAGMA_BIN_ALIGNMENT;
+    }
+    head.file_size = head.offset[num-1] + head.size[num-1];
+
+    printf("%% Writing sparse matrix to file (%s):", filename);
+    fflush(stdout);
+
+    CHECK( magma_malloc_cpu( (void**) &tmpname, strlen(filename) + 5 ));
+    sprintf( tmpname, "%s.tmp", filename );
+    fp = fopen( tmpname, "wb" );
+    if ( fp == NULL ) {
+        printf("\n%% error writing matrix: missing write permission\n");
+        info = MAGMA_ERR_NOT_FOUND;
+        goto cleanup;
+    }
+    pos = 0;
+    if ( fwrite( &head, sizeof(head), 1, fp ) != 1 ) {
+        info = MAGMA_ERR_UNKNOWN;
+    }
+    pos += sizeof(head);
+    for( int32_t k = 0; k < num && info == 0; k++ ) {
+        while ( pos < head.offset[k] && info == 0 ) {
+            size_t pad = (size_t) min( head.offset[k] - pos, (int64_t) MAGMA_BIN_ALIGNMENT );
+            if ( fwrite( zeros, 1, pad, fp ) != pad ) {
+                info = MAGMA_ERR_UNKNOWN;
+            }
+            pos += pad;
+        }
+        if ( size[k] > 0 &&
+             fwrite( *ptr[k], 1, size[k], fp ) != (size_t) size[k] ) {
+            info = MAGMA_ERR_UNKNOWN;
+        }
+        pos += size[k];
+    }
+    if ( fclose( fp ) != 0 ) {
+        info = MAGMA_ERR_UNKNOWN;
+    }
+    fp = NULL;
+    if ( info != 0 ) {
+        printf("\n%% error writing matrix: disk full or I/O error\n");
+        remove( tmpname );
+        goto cleanup;
+    }
+    #if defined( _WIN32 ) || defined( _WIN64 )
+    remove( filename );     // rename does not replace existing files
+    #endif
+    if ( rename( tmpname, filename ) != 0 ) {
+        printf("\n%% error writing matrix: cannot rename %s\n", tmpname);
+        remove( tmpname );
+        info = MAGMA_ERR_UNKNOWN;
+        goto cleanup;
+    }
+    printf(" done.\n");
+
+cleanup:
+    if ( fp != NULL ) {
+        fclose( fp );
+    }
+    magma_free_cpu( tmpname );
+    magma_dmfree( &hA, queue );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Loads a matrix written by magma_dwrite_csr_bin. The matrix is returned
+    in the storage format it was written in.
+
+    Where mmap is available, the file is mapped copy-on-write and the arrays
+    of A point directly into the mapping: nothing is parsed or copied, and
+    pages are only read from disk when they are first touched. Changing
+    the values of A does not change the file. Since MAGMA does not own the
+    arrays of such a matrix, A has to be released with magma_dmfree_bin.
+    Without mmap, the arrays are read into memory owned by A.
+
+    Arguments
+    ---------
+
+    @param[out]
+    A           magma_d_matrix*
+                matrix in magma sparse matrix format
+
+    @param[in]
+    filename    const char*
+                filename of the binary matrix
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_daux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_d_csr_bin(
+    magma_d_matrix *A,
+    const char *filename,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    magma_bin_header head;
+    void **ptr[ MAGMA_BIN_MAX_SECTIONS ];
+    int64_t size[ MAGMA_BIN_MAX_SECTIONS ];
+    int32_t num = 0;
+    int64_t file_size = 0;
+    void *map = NULL;
+    FILE *fid = NULL;
+
+    // make sure the target structure is empty
+    magma_dmfree( A, queue );
+
+    fid = fopen( filename, "rb" );
+    if ( fid == NULL ) {
+        printf("%% Unable to open file %s\n", filename);
+        info = MAGMA_ERR_NOT_FOUND;
+        goto cleanup;
+    }
+
+    printf("%% Reading sparse matrix from file (%s):", filename);
+    fflush(stdout);
+
+    if ( fread( &head, sizeof(head), 1, fid ) != 1 ||
+         memcmp( head.magic, MAGMA_BIN_MAGIC, sizeof(head.magic) ) != 0 )
+    {
+        printf("\n%% Not a MAGMA binary matrix file.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+    if ( head.version != MAGMA_BIN_VERSION ||
+         head.byte_order != MAGMA_BIN_BYTE_ORDER )
+    {
+        printf("\n%% Unsupported version or byte order of binary matrix file.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+    #ifdef COMPLEX
+    if ( head.num_components != 2 ||
+    #else
+    if ( head.num_components != 1 ||
+    #endif
+         head.value_size != (int32_t) sizeof(double) ||
+         head.index_size != (int32_t) sizeof(magma_index_t) )
+    {
+        printf("\n%% Binary matrix file has a different precision or index size.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    A->storage_type            = (magma_storage_t) head.storage_type;
+    A->memory_location         = Magma_CPU;
+    A->sym                     = (magma_symmetry_t) head.sym;
+    A->diagorder_type          = (magma_diagorder_t) head.diagorder_type;
+    A->fill_mode               = (magma_uplo_t) head.fill_mode;
+    A->num_rows                = head.num_rows;
+    A->num_cols                = head.num_cols;
+    A->nnz                     = head.nnz;
+    A->true_nnz                = head.true_nnz;
+    A->max_nnz_row             = head.max_nnz_row;
+    A->diameter                = head.diameter;
+    A->blocksize               = head.blocksize;
+    A->numblocks               = head.numblocks;
+    A->alignment               = head.alignment;
+    A->csr5_sigma              = head.csr5_sigma;
+    A->csr5_bit_y_offset       = head.csr5_bit_y_offset;
+    A->csr5_bit_scansum_offset = head.csr5_bit_scansum_offset;
+    A->csr5_num_packets        = head.csr5_num_packets;
+    A->csr5_p                  = head.csr5_p;
+    A->csr5_num_offsets        = head.csr5_num_offsets;
+    A->csr5_tail_tile_start    = head.csr5_tail_tile_start;
+    A->sellp_sigma             = 1;
+    A->sellp_perm              = NULL;
+
+    // the section list follows from the header, check it against the file
+    fseek( fid, 0, SEEK_END );
+    file_size = ftell( fid );
+    CHECK( magma_dbin_sections( A, ptr, size, &num ));
+    if ( num != head.num_sections || head.offset[0] != MAGMA_BIN_ALIGNMENT ||
+         file_size < head.file_size )
+    {
+        info = MAGMA_ERR_UNKNOWN;
+    }
+    for( int32_t k = 0; k < num && info == 0; k++ ) {
+        if ( size[k] != head.size[k] ||
+             head.offset[k] % MAGMA_BIN_ALIGNMENT != 0 ||
+             head.offset[k] + head.size[k] > head.file_size ) {
+            info = MAGMA_ERR_UNKNOWN;
+        }
+        *ptr[k] = NULL;
+    }
+    if ( info != 0 ) {
+        printf("\n%% Corrupted or truncated binary matrix file.\n");
+        goto cleanup;
+    }
+
+#ifdef MAGMA_BIN_MMAP
+    map = mmap( NULL, head.file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                fileno( fid ), 0 );
+    if ( map == MAP_FAILED ) {
+        map = NULL;
+    }
+#endif
+    if ( map != NULL ) {
+        for( int32_t k = 0; k < num; k++ ) {
+            *ptr[k] = (char*) map + head.offset[k];
+        }
+        A->ownership = MagmaFalse;
+        #pragma omp critical(magma_dbin)
+        magma_dbin_maps[ map ] = (size_t) head.file_size;
+    }
+    else {
+        A->ownership = MagmaTrue;
+        for( int32_t k = 0; k < num; k++ ) {
+            CHECK( magma_malloc_cpu( ptr[k], size[k] ));
+            fseek( fid, head.offset[k], SEEK_SET );
+            if ( size[k] > 0 && fread( *ptr[k], 1, size[k], fid ) != (size_t) size[k] ) {
+                printf("\n%% Corrupted or truncated binary matrix file.\n");
+                info = MAGMA_ERR_UNKNOWN;
+                goto cleanup;
+            }
+        }
+    }
+    printf(" done.\n");
+
+cleanup:
+    if ( fid != NULL ) {
+        fclose( fid );
+    }
+    if ( info != 0 ) {
+        if ( map == NULL ) {
+            A->ownership = MagmaTrue;
+        } else {
+            A->ownership = MagmaFalse;
+        }
+        magma_dmfree_bin( A, queue );
+    }
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Frees a matrix loaded by magma_d_csr_bin: if the matrix points into a
+    file mapping, the mapping is released, otherwise this is the same as
+    magma_dmfree. Can be called for any matrix.
+
+    Arguments
+    ---------
+
+    @param[in,out]
+    A           magma_d_matrix*
+                matrix to free
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_daux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_dmfree_bin(
+    magma_d_matrix *A,
+    magma_queue_t queue )
+{
+    bool mapped = false;
+    size_t length = 0;
+    char *base = NULL;
+
+    if ( A->memory_location == Magma_CPU && A->ownership == MagmaFalse
+         && A->val != NULL )
+    {
+        // the values are the first section of the file
+        base = (char*) A->val - MAGMA_BIN_ALIGNMENT;
+        #pragma omp critical(magma_dbin)
+        {
+            std::map< void*, size_t >::iterator it = magma_dbin_maps.find( base );
+            if ( it != magma_dbin_maps.end() ) {
+                mapped = true;
+                length = it->second;
+                magma_dbin_maps.erase( it );
+            }
+        }
+    }
+#ifdef MAGMA_BIN_MMAP
+    if ( mapped ) {
+        munmap( base, length );
+    }
+#endif
+    return magma_dmfree( A, queue );
+}
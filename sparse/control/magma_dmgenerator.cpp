@@ -5,17 +5,134 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zmgenerator.cpp, normal z -> d, Sat Mar 27 20:32:39 2021
+       @generated from sparse/control/magma_zmgenerator.cpp, normal z -> d, Fri Oct 16 19:22:14 2026
        @author Hartwig Anzt
 */
 #include "magmasparse_internal.h"
 
 
+/**
+    Description of a banded stencil matrix: row i holds the entries
+    i-offset[offdiags], ..., i-offset[1], i, i+offset[1], ..., i+offset[offdiags]
+    with the values vals[offdiags], ..., vals[1], vals[0], vals[1], ...,
+    vals[offdiags]. Entries outside the matrix or with value zero are dropped.
+    If grid > 0, the rows are grid points of a domain with grid points in
+    x-direction, and the entries with offset shift[s]-1 in the first and
+    shift[s]+1 in the last point of a grid line couple across the domain
+    boundary. They are dropped, or stored as explicit zeros if keep_zeros is
+    set.
+*/
+typedef struct {
+    magma_int_t n;
+    magma_int_t offdiags;
+    const magma_index_t *offset;
+    const double *vals;
+    magma_int_t grid;
+    magma_int_t nshift;
+    magma_index_t shift[9];
+    bool keep_zeros;
+} magma_dmgenerator_band;
+
+
+/**
+    Generates row i of the banded matrix. Returns the number of entries,
+    writes them to col and val unless col is NULL.
+*/
+static inline magma_int_t
+magma_dmgenerator_row(
+    const magma_dmgenerator_band *g,
+    magma_int_t i,
+    magma_index_t *col,
+    double *val )
+{
+    magma_int_t nz = 0;
+    bool left  = g->grid > 0 && (i+1) % g->grid == 1;
+    bool right = g->grid > 0 && i % g->grid == g->grid-1;
+
+    for (magma_int_t k = -g->offdiags; k <= g->offdiags; k++) {
+        magma_int_t d = ( k < 0 ) ? -g->offset[ -k ] : g->offset[ k ];
+        double v = g->vals[ ( k < 0 ) ? -k : k ];
+        magma_int_t c = i + d;
+        if ( c < 0 || c >= g->n || MAGMA_D_EQUAL( v, MAGMA_D_ZERO ) ) {
+            continue;
+        }
+        for (magma_int_t s = 0; s < g->nshift; s++) {
+            if ( (left && d == g->shift[s]-1) || (right && d == g->shift[s]+1) ) {
+                v = MAGMA_D_ZERO;
+            }
+        }
+        if ( MAGMA_D_EQUAL( v, MAGMA_D_ZERO ) && ! g->keep_zeros ) {
+            continue;
+        }
+        if ( col != NULL ) {
+            col[ nz ] = c;
+            val[ nz ] = v;
+        }
+        nz++;
+    }
+    return nz;
+}
+
+
+/**
+    Generates the banded matrix in CSR directly into A: the entries of each
+    row are counted in parallel, the row pointer is formed by a parallel scan,
+    and the rows are written in parallel into their final location.
+*/
+static magma_int_t
+magma_dmgenerator_fill(
+    const magma_dmgenerator_band *g,
+    magma_d_matrix *A,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = g->n;
+
+    // make sure the target structure is empty
+    magma_dmfree( A, queue );
+    A->ownership = MagmaTrue;
+    A->val = NULL;
+    A->col = NULL;
+    A->row = NULL;
+    A->storage_type = Magma_CSR;
+    A->memory_location = Magma_CPU;
+    A->fill_mode = MagmaFull;
+    A->num_rows = n;
+    A->num_cols = n;
+    A->max_nnz_row = 2*g->offdiags+1;
+    A->diameter = 0;
+
+    CHECK( magma_index_malloc_cpu( &A->row, n+1 ));
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t i = 0; i < n; i++) {
+        A->row[i+1] = magma_dmgenerator_row( g, i, NULL, NULL );
+    }
+    A->row[0] = 0;
+    CHECK( magma_dmatrix_createrowptr( n, A->row, queue ));
+    A->nnz = A->row[n];
+    A->true_nnz = A->nnz;
+
+    CHECK( magma_index_malloc_cpu( &A->col, A->nnz ));
+    CHECK( magma_dmalloc_cpu( &A->val, A->nnz ));
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t i = 0; i < n; i++) {
+        magma_dmgenerator_row( g, i, A->col + A->row[i], A->val + A->row[i] );
+    }
+
+cleanup:
+    if ( info != 0 ) {
+        magma_dmfree( A, queue );
+    }
+    return info;
+}
+
+
 /**
     Purpose
     -------
 
     Generate a symmetric n x n CSR matrix for a stencil.
+    The matrix is generated in parallel directly into A.
 
     Arguments
     ---------
@@ -58,78 +175,17 @@ magma_dmgenerator(
     magma_d_matrix *A,
     magma_queue_t queue )
 {
-    magma_int_t info = 0;
-    
-    magma_d_matrix B={Magma_CSR};
-    
-    B.val = NULL;
-    B.col = NULL;
-    B.row = NULL;
-    B.rowidx = NULL;
-    B.blockinfo = NULL;
-    B.diag = NULL;
-    B.dval = NULL;
-    B.dcol = NULL;
-    B.drow = NULL;
-    B.drowidx = NULL;
-    B.ddiag = NULL;
-    B.list = NULL;
-    B.dlist = NULL;
-    
-    B.num_rows = n;
-    B.num_cols = n;
-    B.fill_mode = MagmaFull;
-    B.memory_location = Magma_CPU;
-    B.storage_type = Magma_ELLPACKT;
-    B.max_nnz_row = (2*offdiags+1);
-
-    CHECK( magma_dmalloc_cpu( &B.val, B.max_nnz_row*n ));
-    CHECK( magma_index_malloc_cpu( &B.col, B.max_nnz_row*n ));
-    
-    for( int i=0; i<n; i++ ) { // stride over rows
-        // stride over the number of nonzeros in each row
-        // left of diagonal
-        for( int j=0; j<offdiags; j++ ) {
-            B.val[ i*B.max_nnz_row + j ] = diag_vals[ offdiags - j ];
-            B.col[ i*B.max_nnz_row + j ] = -1 * diag_offset[ offdiags-j ] + i;
-        }
-        // elements on the diagonal
-        B.val[ i*B.max_nnz_row + offdiags ] = diag_vals[ 0 ];
-        B.col[ i*B.max_nnz_row + offdiags ] = i;
-        // right of diagonal
-        for( int j=0; j<offdiags; j++ ) {
-            B.val[ i*B.max_nnz_row + j + offdiags +1 ] = diag_vals[ j+1 ];
-            B.col[ i*B.max_nnz_row + j + offdiags +1 ] = diag_offset[ j+1 ] + i;
-        }
-    }
-
-    // set invalid entries to zero
-    for( int i=0; i<n; i++ ) { // stride over rows
-        for( int j=0; j<B.max_nnz_row; j++ ) { // nonzeros in every row
-            if ( (B.col[i*B.max_nnz_row + j] < 0) ||
-                    (B.col[i*B.max_nnz_row + j] >= n) ) {
-                B.val[ i*B.max_nnz_row + j ] = MAGMA_D_MAKE( 0.0, 0.0 );
-            }
-        }
-    }
+    magma_dmgenerator_band g;
 
-    B.nnz = 0;
+    g.n = n;
+    g.offdiags = offdiags;
+    g.offset = diag_offset;
+    g.vals = diag_vals;
+    g.grid = 0;
+    g.nshift = 0;
+    g.keep_zeros = false;
 
-    for( int i=0; i<n; i++ ) { // stride over rows
-        for( int j=0; j<B.max_nnz_row; j++ ) { // nonzeros in every row
-            if ( MAGMA_D_REAL( B.val[i*B.max_nnz_row + j]) != 0.0 )
-                B.nnz++;
-        }
-    }
-    B.true_nnz = B.nnz;
-    // converting it to CSR will remove the invalit entries completely
-    CHECK( magma_dmconvert( B, A, Magma_ELLPACKT, Magma_CSR, queue ));
-
-cleanup:
-    if( info != 0 ){
-        magma_dmfree( &B, queue );
-    }
-    return info;
+    return magma_dmgenerator_fill( &g, A, queue );
 }
 
 
@@ -140,6 +196,8 @@ cleanup:
     -------
 
     Generate a 27-point stencil for a 3D FD discretization.
+    The couplings across the boundary in x-direction are stored as explicit
+    zeros.
 
     Arguments
     ---------
@@ -167,17 +225,12 @@ magma_dm_27stencil(
 {
     magma_int_t info = 0;
     
-    magma_int_t i,j,k;
-    magma_d_matrix hA={Magma_CSR};
-
-    
     // generate matrix of desired structure and size (3d 27-point stencil)
     magma_int_t nn = n*n*n;
     magma_int_t offdiags = 13;
-    magma_index_t *diag_offset=NULL;
-    double *diag_vals=NULL;
-    CHECK( magma_dmalloc_cpu( &diag_vals, offdiags+1 ));
-    CHECK( magma_index_malloc_cpu( &diag_offset, offdiags+1 ));
+    magma_index_t diag_offset[14];
+    double diag_vals[14];
+    magma_dmgenerator_band g;
 
     diag_offset[0] = 0;
     diag_offset[1] = 1;
@@ -195,63 +248,24 @@ magma_dm_27stencil(
     diag_offset[13] = n*n+n+1;
 
     diag_vals[0] = MAGMA_D_MAKE( 26.0, 0.0 );
-    diag_vals[1] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[2] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[3] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[4] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[5] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[6] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[7] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[8] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[9] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[10] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[11] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[12] = MAGMA_D_MAKE( -1.0, 0.0 );
-    diag_vals[13] = MAGMA_D_MAKE( -1.0, 0.0 );
-    CHECK( magma_dmgenerator( nn, offdiags, diag_offset, diag_vals, &hA, queue ));
-
-    // now set some entries to zero (boundary...)
-    for( i=0; i < n*n; i++ ) {
-        for( j=0; j < n; j++ ) {
-            magma_index_t row = i*n+j;
-            for( k=hA.row[row]; k<hA.row[row+1]; k++) {
-                if ((hA.col[k] == row-1 ||
-                    hA.col[k] == row-n-1 ||
-                    hA.col[k] == row+n-1 ||
-                    hA.col[k] == row-n*n+n-1 ||
-                    hA.col[k] == row+n*n-n-1 ||
-                    hA.col[k] == row-n*n-1 ||
-                    hA.col[k] == row+n*n-1 ||
-                    hA.col[k] == row-n*n-n-1 ||
-                    hA.col[k] == row+n*n+n-1 ) && (row+1)%n == 1 )
-                        
-                        hA.val[k] = MAGMA_D_MAKE( 0.0, 0.0 );
-    
-                if ((hA.col[k] == row+1 ||
-                    hA.col[k] == row-n+1 ||
-                    hA.col[k] == row+n+1 ||
-                    hA.col[k] == row-n*n+n+1 ||
-                    hA.col[k] == row+n*n-n+1 ||
-                    hA.col[k] == row-n*n+1 ||
-                    hA.col[k] == row+n*n+1 ||
-                    hA.col[k] == row-n*n-n+1 ||
-                    hA.col[k] == row+n*n+n+1 ) && (row)%n ==n-1 )
-                        
-                        hA.val[k] = MAGMA_D_MAKE( 0.0, 0.0 );
-            }
-        }
+    for( magma_int_t k=1; k <= offdiags; k++ ) {
+        diag_vals[k] = MAGMA_D_MAKE( -1.0, 0.0 );
     }
-    hA.true_nnz = hA.nnz;
-    if (A->ownership) {
-        magma_dmfree( A, queue );
+
+    // set the entries coupling across the boundary to zero
+    g.n = nn;
+    g.offdiags = offdiags;
+    g.offset = diag_offset;
+    g.vals = diag_vals;
+    g.grid = n;
+    g.nshift = 9;
+    for( magma_int_t k=0; k < 9; k++ ) {
+        g.shift[k] = (k/3-1)*n*n + (k%3-1)*n;
     }
-    A->ownership = MagmaTrue;
-    CHECK( magma_dmconvert( hA, A, Magma_CSR, Magma_CSR, queue ));
+    g.keep_zeros = true;
+    CHECK( magma_dmgenerator_fill( &g, A, queue ));
 
 cleanup:
-    magma_free_cpu( diag_vals );
-    magma_free_cpu( diag_offset );
-    magma_dmfree( &hA, queue );
     return info;
 }
 
@@ -289,19 +303,13 @@ magma_dm_5stencil(
 {
     magma_int_t info = 0;
     
-    magma_int_t i,j,k;
-    magma_d_matrix hA={Magma_CSR};
-    
     // generate matrix of desired structure and size (2d 5-point stencil)
     magma_int_t nn = n*n;
     magma_int_t offdiags = 2;
-    magma_index_t *diag_offset=NULL;
-    double *diag_vals=NULL;
-    CHECK( magma_dmalloc_cpu( &diag_vals, offdiags+1 ));
-    CHECK( magma_index_malloc_cpu( &diag_offset, offdiags+1 ));
+    magma_index_t diag_offset[3];
+    double diag_vals[3];
+    magma_dmgenerator_band g;
     
-    magma_dmfree( A, queue );
-    A->ownership = MagmaTrue;
     diag_offset[0] = 0;
     diag_offset[1] = 1;
     diag_offset[2] = n;
@@ -320,29 +328,105 @@ magma_dm_5stencil(
         diag_vals[1] = MAGMA_D_MAKE( -1.0, 0.0 );
         diag_vals[2] = MAGMA_D_MAKE( -1.0, 0.0 );
     #endif
-    CHECK( magma_dmgenerator( nn, offdiags, diag_offset, diag_vals, &hA, queue ));
-
-    // now set some entries to zero (boundary...)
-    for( i=0; i<n; i++ ) {
-        for( j=0; j<n; j++ ) {
-            magma_index_t row = i*n+j;
-            for( k=hA.row[row]; k<hA.row[row+1]; k++) {
-                if ((hA.col[k] == row-1 ) && (row+1)%n == 1 )
-                    hA.val[k] = MAGMA_D_MAKE( 0.0, 0.0 );
+
+    // drop the entries coupling across the boundary
+    g.n = nn;
+    g.offdiags = offdiags;
+    g.offset = diag_offset;
+    g.vals = diag_vals;
+    g.grid = n;
+    g.nshift = 1;
+    g.shift[0] = 0;
+    g.keep_zeros = false;
+    CHECK( magma_dmgenerator_fill( &g, A, queue ));
     
-                if ((hA.col[k] == row+1 ) && (row)%n ==n-1 )
-                    hA.val[k] = MAGMA_D_MAKE( 0.0, 0.0 );
+cleanup:
+    return info;
+}
+
+
+
+/**
+    Purpose
+    -------
+
+    Generate the 5-point stencil of magma_dm_5stencil or the 27-point
+    stencil of magma_dm_27stencil as matrix-free operator in the storage
+    format Magma_STENCIL. Only the stencil and the grid size are stored, the
+    host SpMV (magma_d_spmv) computes the entries on the fly. This allows to
+    run solvers on problems whose matrix would not fit into memory.
+    nnz is set to the number of entries of the generated CSR matrix.
+    The operator can be converted to CSR with magma_dmconvert.
+
+    Arguments
+    ---------
+
+    @param[in]
+    points      magma_int_t
+                stencil points: 5 (2D) or 27 (3D)
+
+    @param[in]
+    n           magma_int_t
+                grid points per dimension, at least 3 for the 27-point stencil
+
+    @param[out]
+    A           magma_d_matrix*
+                operator to generate
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_daux
+    ********************************************************************/
+
+extern "C"
+magma_int_t
+magma_dm_stencil(
+    magma_int_t points,
+    magma_int_t n,
+    magma_d_matrix *A,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t nn, nnz;
+
+    if ( ( points != 5 && points != 27 ) || n < 1 || ( points == 27 && n < 3 ) ) {
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    // an entry with offset d is present in all rows but |d|
+    if ( points == 5 ) {
+        nn = n*n;
+        nnz = 5*nn - 4*n;
+    } else {
+        nn = n*n*n;
+        nnz = 0;
+        for( magma_int_t dz=-1; dz <= 1; dz++ ) {
+            for( magma_int_t dy=-1; dy <= 1; dy++ ) {
+                for( magma_int_t dx=-1; dx <= 1; dx++ ) {
+                    magma_int_t d = dz*n*n + dy*n + dx;
+                    nnz += nn - ( d < 0 ? -d : d );
+                }
             }
         }
     }
 
-    CHECK( magma_dmconvert( hA, A, Magma_CSR, Magma_CSR, queue ));
-    magma_dmcsrcompressor( A, queue );
-    A->true_nnz = A->nnz;
-    
+    // make sure the target structure is empty
+    magma_dmfree( A, queue );
+    A->ownership = MagmaTrue;
+    A->storage_type = Magma_STENCIL;
+    A->memory_location = Magma_CPU;
+    A->fill_mode = MagmaFull;
+    A->num_rows = nn;
+    A->num_cols = nn;
+    A->nnz = nnz;
+    A->true_nnz = nnz;
+    A->max_nnz_row = points;
+    A->diameter = 0;
+    A->stencil_points = points;
+    A->stencil_grid = n;
+
 cleanup:
-    magma_free_cpu( diag_vals );
-    magma_free_cpu( diag_offset );
-    magma_dmfree( &hA, queue );
     return info;
 }
@@ -0,0 +1,830 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/control/magma_zmreorder.cpp, normal z -> d, Fri Oct 16 18:32:15 2026
+*/
+#include <algorithm>
+#include <vector>
+
+#include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// subgraphs up to this size are not bisected further in nested dissection
+#define MAGMA_REORDER_ND_LEAF 64
+
+// subgraphs larger than this are bisected in a separate task
+#define MAGMA_REORDER_ND_TASK 4096
+
+
+/*
+    Adjacency graph of A + A^T without the diagonal, in CSR (xadj, adj).
+    The rows are sorted and free of duplicates.
+*/
+static magma_int_t
+magma_dmreorder_graph(
+    magma_d_matrix A,
+    magma_index_t **xadj,
+    magma_index_t **adj )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+    magma_index_t *cnt = NULL, *tmp = NULL, *pos = NULL;
+
+    *xadj = NULL;
+    *adj = NULL;
+    CHECK( magma_index_malloc_cpu( &cnt, n+1 ));
+    CHECK( magma_index_malloc_cpu( &pos, n+1 ));
+
+    // every off-diagonal entry A(i,j) contributes j to row i and i to row j
+    for( magma_int_t i=0; i<n+1; i++ ) {
+        cnt[i] = 0;
+    }
+    for( magma_int_t i=0; i<n; i++ ) {
+        for( magma_int_t j=A.row[i]; j<A.row[i+1]; j++ ) {
+            magma_index_t c = A.col[j];
+            if ( c != i && c >= 0 && c < n ) {
+                cnt[i+1]++;
+                cnt[c+1]++;
+            }
+        }
+    }
+    for( magma_int_t i=0; i<n; i++ ) {
+        cnt[i+1] += cnt[i];
+        pos[i] = cnt[i];
+    }
+    CHECK( magma_index_malloc_cpu( &tmp, max( (magma_int_t) cnt[n], 1 ) ));
+    for( magma_int_t i=0; i<n; i++ ) {
+        for( magma_int_t j=A.row[i]; j<A.row[i+1]; j++ ) {
+            magma_index_t c = A.col[j];
+            if ( c != i && c >= 0 && c < n ) {
+                tmp[ pos[i]++ ] = c;
+                tmp[ pos[c]++ ] = i;
+            }
+        }
+    }
+
+    // sort the rows and drop the duplicates of symmetric entries
+    #pragma omp parallel for schedule(dynamic,256)
+    for( magma_int_t i=0; i<n; i++ ) {
+        magma_index_t *first = tmp + cnt[i];
+        magma_index_t *last = tmp + cnt[i+1];
+        std::sort( first, last );
+        pos[i] = std::unique( first, last ) - first;
+    }
+    CHECK( magma_index_malloc_cpu( xadj, n+1 ));
+    (*xadj)[0] = 0;
+    for( magma_int_t i=0; i<n; i++ ) {
+        (*xadj)[i+1] = (*xadj)[i] + pos[i];
+    }
+    CHECK( magma_index_malloc_cpu( adj, max( (magma_int_t) (*xadj)[n], 1 ) ));
+    #pragma omp parallel for schedule(dynamic,256)
+    for( magma_int_t i=0; i<n; i++ ) {
+        for( magma_int_t k=0; k<pos[i]; k++ ) {
+            (*adj)[ (*xadj)[i]+k ] = tmp[ cnt[i]+k ];
+        }
+    }
+
+cleanup:
+    if ( info != 0 ) {
+        magma_free_cpu( *xadj );
+        magma_free_cpu( *adj );
+        *xadj = NULL;
+        *adj = NULL;
+    }
+    magma_free_cpu( cnt );
+    magma_free_cpu( pos );
+    magma_free_cpu( tmp );
+    return info;
+}
+
+
+/*
+    Breadth-first level structure rooted at root, restricted to the nodes v
+    with part[v] == label. The nodes are written to ls in level order,
+    lev[v] is set for all reached nodes and has to be -1 for the others.
+    Returns the number of reached nodes, the number of levels and the width
+    of the widest level.
+*/
+static magma_int_t
+magma_dmreorder_levels(
+    magma_index_t root,
+    magma_index_t label,
+    const magma_index_t *xadj,
+    const magma_index_t *adj,
+    const magma_index_t *part,
+    magma_index_t *lev,
+    magma_index_t *ls,
+    magma_int_t *num_levels,
+    magma_int_t *width )
+{
+    magma_int_t head = 0, tail = 0, level_start = 0;
+    *num_levels = 0;
+    *width = 0;
+    ls[tail++] = root;
+    lev[root] = 0;
+    while ( head < tail ) {
+        magma_index_t v = ls[head];
+        if ( head == level_start ) {
+            // a new level starts
+            *width = max( *width, tail - level_start );
+            level_start = tail;
+            (*num_levels)++;
+        }
+        head++;
+        for( magma_int_t k=xadj[v]; k<xadj[v+1]; k++ ) {
+            magma_index_t w = adj[k];
+            if ( part[w] == label && lev[w] < 0 ) {
+                lev[w] = lev[v] + 1;
+                ls[tail++] = w;
+            }
+        }
+    }
+    return tail;
+}
+
+
+/*
+    Pseudo-peripheral node of the component of start (George and Liu):
+    repeatedly root a level structure at a node of minimum degree in the
+    last level until the number of levels stops growing.
+    On return ls/lev hold the level structure of the returned root.
+*/
+static magma_index_t
+magma_dmreorder_peripheral(
+    magma_index_t start,
+    magma_index_t label,
+    const magma_index_t *xadj,
+    const magma_index_t *adj,
+    const magma_index_t *part,
+    magma_index_t *lev,
+    magma_index_t *ls,
+    magma_int_t *reached,
+    magma_int_t *num_levels )
+{
+    magma_index_t root = start;
+    magma_int_t width;
+    *reached = magma_dmreorder_levels( root, label, xadj, adj, part, lev, ls,
+                                       num_levels, &width );
+    while ( true ) {
+        // candidate: node of minimum degree in the last level
+        magma_index_t cand = ls[ *reached-1 ];
+        for( magma_int_t k=*reached-1; k >= 0 && lev[ls[k]] == *num_levels-1; k-- ) {
+            magma_index_t v = ls[k];
+            if ( xadj[v+1]-xadj[v] < xadj[cand+1]-xadj[cand] ) {
+                cand = v;
+            }
+        }
+        if ( cand == root ) {
+            break;
+        }
+        for( magma_int_t k=0; k < *reached; k++ ) {
+            lev[ ls[k] ] = -1;
+        }
+        magma_int_t cand_levels, cand_reached;
+        cand_reached = magma_dmreorder_levels( cand, label, xadj, adj, part, lev, ls,
+                                               &cand_levels, &width );
+        if ( cand_levels <= *num_levels ) {
+            // no improvement, restore the structure of root
+            for( magma_int_t k=0; k < cand_reached; k++ ) {
+                lev[ ls[k] ] = -1;
+            }
+            *reached = magma_dmreorder_levels( root, label, xadj, adj, part, lev, ls,
+                                               num_levels, &width );
+            break;
+        }
+        root = cand;
+        *reached = cand_reached;
+        *num_levels = cand_levels;
+    }
+    return root;
+}
+
+
+/*
+    Reverse Cuthill-McKee ordering, component by component.
+*/
+static magma_int_t
+magma_dmreorder_rcm(
+    magma_int_t n,
+    const magma_index_t *xadj,
+    const magma_index_t *adj,
+    magma_index_t *perm )
+{
+    magma_int_t info = 0;
+    magma_index_t *part = NULL, *lev = NULL, *ls = NULL;
+    magma_int_t numbered = 0;
+    std::vector< magma_index_t > nbrs;
+
+    CHECK( magma_index_malloc_cpu( &part, n ));
+    CHECK( magma_index_malloc_cpu( &lev, n ));
+    CHECK( magma_index_malloc_cpu( &ls, n ));
+    for( magma_int_t i=0; i<n; i++ ) {
+        part[i] = 0;    // 0: not yet numbered, 1: numbered
+        lev[i] = -1;
+    }
+
+    for( magma_int_t s=0; s<n; s++ ) {
+        if ( part[s] != 0 ) {
+            continue;
+        }
+        // start the next component at a pseudo-peripheral node
+        magma_int_t reached, num_levels;
+        magma_index_t root = magma_dmreorder_peripheral( s, 0, xadj, adj, part,
+                                    lev, ls, &reached, &num_levels );
+        for( magma_int_t k=0; k<reached; k++ ) {
+            lev[ ls[k] ] = -1;
+        }
+
+        // Cuthill-McKee: visit the neighbors by increasing degree
+        magma_int_t head = numbered;
+        perm[ numbered++ ] = root;
+        part[root] = 1;
+        while ( head < numbered ) {
+            magma_index_t v = perm[ head++ ];
+            nbrs.clear();
+            for( magma_int_t k=xadj[v]; k<xadj[v+1]; k++ ) {
+                magma_index_t w = adj[k];
+                if ( part[w] == 0 ) {
+                    part[w] = 1;
+                    nbrs.push_back( w );
+                }
+            }
+            std::stable_sort( nbrs.begin(), nbrs.end(),
+                [xadj]( magma_index_t a, magma_index_t b ) {
+                    return xadj[a+1]-xadj[a] < xadj[b+1]-xadj[b]; } );
+            for( size_t k=0; k<nbrs.size(); k++ ) {
+                perm[ numbered++ ] = nbrs[k];
+            }
+        }
+    }
+    std::reverse( perm, perm+n );
+
+cleanup:
+    magma_free_cpu( part );
+    magma_free_cpu( lev );
+    magma_free_cpu( ls );
+    return info;
+}
+
+
+/*
+    Minimum degree ordering on the quotient graph. Eliminated nodes become
+    elements, elements adjacent to a pivot are absorbed into the new one and
+    the degrees of the affected nodes are updated with the approximate
+    external degree of AMD (Amestoy, Davis and Duff). There is no
+    supervariable detection and no aggressive absorption.
+*/
+static magma_int_t
+magma_dmreorder_mindegree(
+    magma_int_t n,
+    const magma_index_t *xadj,
+    const magma_index_t *adj,
+    magma_index_t *perm )
+{
+    magma_int_t info = 0;
+    std::vector< std::vector< magma_index_t > > adjv( n ), adje( n ), elem( n );
+    std::vector< magma_index_t > degree( n ), head( n+1, -1 ), next( n ), prev( n );
+    std::vector< magma_index_t > mark( n, -1 ), w( n, -1 );
+    std::vector< char > eliminated( n, 0 ), absorbed( n, 0 );
+    std::vector< magma_index_t > Lp, touched;
+    magma_int_t mindeg = 0;
+
+    // degree buckets as doubly linked lists
+    #define MAGMA_MD_INSERT( v ) {                  \
+        magma_index_t d_ = degree[v];               \
+        next[v] = head[d_]; prev[v] = -1;           \
+        if ( head[d_] >= 0 ) prev[ head[d_] ] = v;  \
+        head[d_] = v;                               \
+        if ( d_ < mindeg ) mindeg = d_; }
+    #define MAGMA_MD_REMOVE( v ) {                  \
+        if ( prev[v] >= 0 ) next[ prev[v] ] = next[v];  \
+        else head[ degree[v] ] = next[v];           \
+        if ( next[v] >= 0 ) prev[ next[v] ] = prev[v]; }
+
+    for( magma_int_t i=0; i<n; i++ ) {
+        adjv[i].assign( adj+xadj[i], adj+xadj[i+1] );
+        degree[i] = xadj[i+1]-xadj[i];
+        MAGMA_MD_INSERT( i );
+    }
+
+    for( magma_int_t k=0; k<n; k++ ) {
+        while ( head[mindeg] < 0 ) {
+            mindeg++;
+        }
+        magma_index_t p = head[mindeg];
+        MAGMA_MD_REMOVE( p );
+        eliminated[p] = 1;
+        perm[k] = p;
+
+        // the new element is the union of the variable and element neighbors
+        Lp.clear();
+        mark[p] = p;
+        for( size_t j=0; j<adjv[p].size(); j++ ) {
+            magma_index_t v = adjv[p][j];
+            if ( ! eliminated[v] && mark[v] != p ) {
+                mark[v] = p;
+                Lp.push_back( v );
+            }
+        }
+        for( size_t j=0; j<adje[p].size(); j++ ) {
+            magma_index_t e = adje[p][j];
+            if ( absorbed[e] ) {
+                continue;
+            }
+            for( size_t l=0; l<elem[e].size(); l++ ) {
+                magma_index_t v = elem[e][l];
+                if ( ! eliminated[v] && mark[v] != p ) {
+                    mark[v] = p;
+                    Lp.push_back( v );
+                }
+            }
+            absorbed[e] = 1;
+            std::vector< magma_index_t >().swap( elem[e] );
+        }
+        std::vector< magma_index_t >().swap( adjv[p] );
+        std::vector< magma_index_t >().swap( adje[p] );
+        elem[p] = Lp;
+
+        // update the neighbors: drop absorbed elements and covered variables
+        for( size_t j=0; j<Lp.size(); j++ ) {
+            magma_index_t i = Lp[j];
+            MAGMA_MD_REMOVE( i );
+            std::vector< magma_index_t > &ei = adje[i];
+            size_t m = 0;
+            for( size_t l=0; l<ei.size(); l++ ) {
+                if ( ! absorbed[ ei[l] ] ) {
+                    ei[m++] = ei[l];
+                }
+            }
+            ei.resize( m );
+            ei.push_back( p );
+            std::vector< magma_index_t > &vi = adjv[i];
+            m = 0;
+            for( size_t l=0; l<vi.size(); l++ ) {
+                magma_index_t v = vi[l];
+                if ( ! eliminated[v] && mark[v] != p ) {
+                    vi[m++] = v;
+                }
+            }
+            vi.resize( m );
+        }
+
+        // |Le \ Lp| for all other elements adjacent to Lp
+        touched.clear();
+        for( size_t j=0; j<Lp.size(); j++ ) {
+            magma_index_t i = Lp[j];
+            for( size_t l=0; l<adje[i].size(); l++ ) {
+                magma_index_t e = adje[i][l];
+                if ( e == p ) {
+                    continue;
+                }
+                if ( w[e] < 0 ) {
+                    w[e] = elem[e].size();
+                    touched.push_back( e );
+                }
+                w[e]--;
+            }
+        }
+
+        // approximate external degree
+        magma_int_t remaining = n-k-1;
+        for( size_t j=0; j<Lp.size(); j++ ) {
+            magma_index_t i = Lp[j];
+            magma_int_t d = adjv[i].size() + Lp.size() - 1;
+            for( size_t l=0; l<adje[i].size(); l++ ) {
+                magma_index_t e = adje[i][l];
+                if ( e != p ) {
+                    d += w[e];
+                }
+            }
+            d = min( d, (magma_int_t) (degree[i] + Lp.size() - 1) );
+            d = min( d, remaining-1 );
+            degree[i] = max( d, (magma_int_t) 0 );
+            MAGMA_MD_INSERT( i );
+        }
+        for( size_t j=0; j<touched.size(); j++ ) {
+            w[ touched[j] ] = -1;
+        }
+    }
+    #undef MAGMA_MD_INSERT
+    #undef MAGMA_MD_REMOVE
+
+    return info;
+}
+
+
+/*
+    Nested dissection of the segment perm[off:off+size-1].
+    The segment is bisected with the median level of a level structure
+    rooted at a pseudo-peripheral node; the reordered segment holds the
+    first part, the second part and the separator. Both parts are
+    dissected recursively, large ones in separate tasks. part[] labels the
+    nodes of a segment with its offset, separator nodes get -1.
+*/
+static void
+magma_dmreorder_nd_segment(
+    magma_int_t off,
+    magma_int_t size,
+    const magma_index_t *xadj,
+    const magma_index_t *adj,
+    magma_index_t *part,
+    magma_index_t *lev,
+    magma_index_t *perm,
+    magma_index_t *tmp )
+{
+    if ( size <= MAGMA_REORDER_ND_LEAF ) {
+        return;
+    }
+    magma_index_t *seg = perm + off;
+    magma_index_t *ls = tmp + off;
+    magma_index_t label = off;
+    for( magma_int_t k=0; k<size; k++ ) {
+        part[ seg[k] ] = label;
+        lev[ seg[k] ] = -1;
+    }
+
+    magma_int_t reached, num_levels;
+    magma_dmreorder_peripheral( seg[0], label, xadj, adj, part, lev, ls,
+                                &reached, &num_levels );
+
+    magma_int_t size1, size2, sizes;
+    if ( reached < size ) {
+        // disconnected: the reached component and the rest, no separator
+        size1 = reached;
+        magma_int_t z = reached;
+        for( magma_int_t k=0; k<size; k++ ) {
+            if ( lev[ seg[k] ] < 0 ) {
+                ls[ z++ ] = seg[k];
+            }
+        }
+        size2 = size - reached;
+        sizes = 0;
+    }
+    else if ( num_levels < 3 ) {
+        // too dense to bisect
+        return;
+    }
+    else {
+        // separator: the first level reaching half of the nodes
+        magma_int_t m = 0, count = 0;
+        for( magma_int_t k=0; k<size; k++ ) {
+            if ( 2*(count+1) > size ) {
+                m = lev[ ls[k] ];
+                break;
+            }
+            count++;
+        }
+        m = max( (magma_int_t) 1, min( m, num_levels-2 ) );
+        magma_int_t z = 0;
+        size1 = 0;
+        size2 = 0;
+        sizes = 0;
+        for( magma_int_t k=0; k<size; k++ ) {
+            magma_index_t v = ls[k];
+            if ( lev[v] < m ) {
+                seg[ z++ ] = v;
+                size1++;
+            }
+        }
+        for( magma_int_t k=0; k<size; k++ ) {
+            magma_index_t v = ls[k];
+            if ( lev[v] > m ) {
+                seg[ z++ ] = v;
+                size2++;
+            }
+        }
+        for( magma_int_t k=0; k<size; k++ ) {
+            magma_index_t v = ls[k];
+            if ( lev[v] == m ) {
+                seg[ z++ ] = v;
+                part[v] = -1;
+                sizes++;
+            }
+        }
+        for( magma_int_t k=0; k<size; k++ ) {
+            ls[k] = seg[k];
+        }
+    }
+    for( magma_int_t k=0; k<size; k++ ) {
+        seg[k] = ls[k];
+    }
+
+    #pragma omp task if( size1 > MAGMA_REORDER_ND_TASK )
+    magma_dmreorder_nd_segment( off, size1, xadj, adj, part, lev, perm, tmp );
+    #pragma omp task if( size2 > MAGMA_REORDER_ND_TASK )
+    magma_dmreorder_nd_segment( off+size1, size2, xadj, adj, part, lev, perm, tmp );
+    #pragma omp taskwait
+}
+
+
+/*
+    Nested dissection ordering.
+*/
+static magma_int_t
+magma_dmreorder_nd(
+    magma_int_t n,
+    const magma_index_t *xadj,
+    const magma_index_t *adj,
+    magma_index_t *perm )
+{
+    magma_int_t info = 0;
+    magma_index_t *part = NULL, *lev = NULL, *tmp = NULL;
+
+    CHECK( magma_index_malloc_cpu( &part, n ));
+    CHECK( magma_index_malloc_cpu( &lev, n ));
+    CHECK( magma_index_malloc_cpu( &tmp, n ));
+    for( magma_int_t i=0; i<n; i++ ) {
+        perm[i] = i;
+    }
+
+    #pragma omp parallel
+    #pragma omp single
+    magma_dmreorder_nd_segment( 0, n, xadj, adj, part, lev, perm, tmp );
+
+cleanup:
+    magma_free_cpu( part );
+    magma_free_cpu( lev );
+    magma_free_cpu( tmp );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Computes a fill or bandwidth reducing symmetric permutation of A and
+    returns the permuted matrix B = P A P^T. The ordering only depends on
+    the sparsity pattern of A + A^T:
+
+        Magma_RCM               reverse Cuthill-McKee, reduces the bandwidth
+                                (diameter) and improves SpMV locality
+        Magma_MINDEGREE         approximate minimum degree, reduces ILU fill
+        Magma_NESTEDDISSECTION  recursive bisection with level-set separators
+        Magma_NOREORDER         identity
+
+    The right-hand side has to be permuted with magma_dvpermute( MagmaNoTrans ),
+    the solution of the permuted system is mapped back with
+    magma_dvpermute( MagmaTrans ).
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_d_matrix
+                square sparse matrix in any format and location
+
+    @param[in]
+    order       magma_reorder_t
+                ordering to compute
+
+    @param[out]
+    perm        magma_index_t**
+                permutation of length A.num_rows allocated on the host:
+                row i of B is row perm[i] of A
+
+    @param[out]
+    B           magma_d_matrix*
+                permuted matrix in the format and location of A
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_daux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_dmreorder(
+    magma_d_matrix A,
+    magma_reorder_t order,
+    magma_index_t **perm,
+    magma_d_matrix *B,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    magma_d_matrix hA={Magma_CSR}, CSRA={Magma_CSR}, hB={Magma_CSR}, CSRB={Magma_CSR};
+    magma_index_t *xadj = NULL, *adj = NULL;
+
+    *perm = NULL;
+    if ( A.num_rows != A.num_cols ) {
+        printf("error: reordering requires a square matrix.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    CHECK( magma_dmtransfer( A, &hA, A.memory_location, Magma_CPU, queue ));
+    CHECK( magma_dmconvert( hA, &CSRA, hA.storage_type, Magma_CSR, queue ));
+    CHECK( magma_index_malloc_cpu( perm, max( CSRA.num_rows, (magma_int_t) 1 ) ));
+
+    if ( order == Magma_NOREORDER ) {
+        for( magma_int_t i=0; i<CSRA.num_rows; i++ ) {
+            (*perm)[i] = i;
+        }
+    }
+    else {
+        CHECK( magma_dmreorder_graph( CSRA, &xadj, &adj ));
+        if ( order == Magma_RCM ) {
+            CHECK( magma_dmreorder_rcm( CSRA.num_rows, xadj, adj, *perm ));
+        }
+        else if ( order == Magma_MINDEGREE ) {
+            CHECK( magma_dmreorder_mindegree( CSRA.num_rows, xadj, adj, *perm ));
+        }
+        else if ( order == Magma_NESTEDDISSECTION ) {
+            CHECK( magma_dmreorder_nd( CSRA.num_rows, xadj, adj, *perm ));
+        }
+        else {
+            printf("error: reordering not supported.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+            goto cleanup;
+        }
+    }
+
+    CHECK( magma_dmpermute( CSRA, *perm, &CSRB, queue ));
+    CHECK( magma_ddiameter( &CSRB, queue ));
+    CHECK( magma_dmconvert( CSRB, &hB, Magma_CSR, A.storage_type, queue ));
+    CHECK( magma_dmtransfer( hB, B, Magma_CPU, A.memory_location, queue ));
+    B->diameter = CSRB.diameter;
+
+cleanup:
+    if ( info != 0 ) {
+        magma_free_cpu( *perm );
+        *perm = NULL;
+    }
+    magma_free_cpu( xadj );
+    magma_free_cpu( adj );
+    magma_dmfree( &hA, queue );
+    magma_dmfree( &CSRA, queue );
+    magma_dmfree( &hB, queue );
+    magma_dmfree( &CSRB, queue );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Symmetric permutation B = P A P^T of a CSR matrix on the host,
+    B(i,j) = A( perm[i], perm[j] ). The rows of B are sorted.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_d_matrix
+                square matrix in CSR on the CPU
+
+    @param[in]
+    perm        magma_index_t*
+                permutation: row i of B is row perm[i] of A
+
+    @param[out]
+    B           magma_d_matrix*
+                permuted matrix in CSR on the CPU
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_daux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_dmpermute(
+    magma_d_matrix A,
+    magma_index_t *perm,
+    magma_d_matrix *B,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t n = A.num_rows;
+    magma_index_t *iperm = NULL;
+
+    if ( A.memory_location != Magma_CPU || A.storage_type != Magma_CSR ) {
+        printf("error: permutation only supported for CSR on the CPU.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    B->storage_type = Magma_CSR;
+    B->memory_location = Magma_CPU;
+    B->num_rows = A.num_rows;
+    B->num_cols = A.num_cols;
+    B->nnz = A.nnz;
+    B->true_nnz = A.nnz;
+    B->fill_mode = A.fill_mode;
+    B->sym = A.sym;
+    B->diagorder_type = A.diagorder_type;
+    CHECK( magma_index_malloc_cpu( &iperm, max( n, (magma_int_t) 1 ) ));
+    CHECK( magma_index_malloc_cpu( &B->row, n+1 ));
+    CHECK( magma_index_malloc_cpu( &B->col, max( A.nnz, (magma_int_t) 1 ) ));
+    CHECK( magma_dmalloc_cpu( &B->val, max( A.nnz, (magma_int_t) 1 ) ));
+
+    #pragma omp parallel for
+    for( magma_int_t i=0; i<n; i++ ) {
+        iperm[ perm[i] ] = i;
+    }
+    B->row[0] = 0;
+    for( magma_int_t i=0; i<n; i++ ) {
+        B->row[i+1] = B->row[i] + A.row[ perm[i]+1 ] - A.row[ perm[i] ];
+    }
+    #pragma omp parallel for
+    for( magma_int_t i=0; i<n; i++ ) {
+        magma_index_t k = B->row[i];
+        for( magma_int_t j=A.row[ perm[i] ]; j<A.row[ perm[i]+1 ]; j++ ) {
+            B->col[k] = iperm[ A.col[j] ];
+            B->val[k] = A.val[j];
+            k++;
+        }
+    }
+    CHECK( magma_dcsr_sort( B, queue ));
+
+cleanup:
+    if ( info != 0 ) {
+        magma_dmfree( B, queue );
+    }
+    magma_free_cpu( iperm );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Permutes the rows of a vector (block):
+
+        MagmaNoTrans:   y[i] = x[ perm[i] ]    (e.g. right-hand side into the
+                                                reordered system)
+        MagmaTrans:     y[ perm[i] ] = x[i]    (solution back to the original
+                                                ordering)
+
+    Arguments
+    ---------
+
+    @param[in]
+    trans       magma_trans_t
+                MagmaNoTrans or MagmaTrans
+
+    @param[in]
+    perm        magma_index_t*
+                permutation on the host as returned by magma_dmreorder
+
+    @param[in]
+    x           magma_d_matrix
+                input vector (block) in host or device memory
+
+    @param[out]
+    y           magma_d_matrix*
+                permuted vector (block) in the location of x
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_daux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_dvpermute(
+    magma_trans_t trans,
+    magma_index_t *perm,
+    magma_d_matrix x,
+    magma_d_matrix *y,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_d_matrix hx={Magma_CSR}, hy={Magma_CSR};
+    magma_int_t n = x.num_rows, nc = x.num_cols;
+
+    CHECK( magma_dmtransfer( x, &hx, x.memory_location, Magma_CPU, queue ));
+    CHECK( magma_dmtransfer( hx, &hy, Magma_CPU, Magma_CPU, queue ));
+
+    #pragma omp parallel for
+    for( magma_int_t i=0; i<n; i++ ) {
+        magma_int_t src = ( trans == MagmaNoTrans ) ? perm[i] : i;
+        magma_int_t dst = ( trans == MagmaNoTrans ) ? i : perm[i];
+        for( magma_int_t v=0; v<nc; v++ ) {
+            if ( x.major == MagmaRowMajor ) {
+                hy.val[ dst*nc+v ] = hx.val[ src*nc+v ];
+            } else {
+                hy.val[ v*n+dst ] = hx.val[ v*n+src ];
+            }
+        }
+    }
+    magma_dmfree( y, queue );
+    CHECK( magma_dmtransfer( hy, y, Magma_CPU, x.memory_location, queue ));
+
+cleanup:
+    magma_dmfree( &hx, queue );
+    magma_dmfree( &hy, queue );
+    return info;
+}
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zmsupernodal.cpp, normal z -> d, Sat Mar 27 20:32:47 2021
+       @generated from sparse/control/magma_zmsupernodal.cpp, normal z -> d, Fri Oct 16 19:29:26 2026
        @author Hartwig Anzt
 
 */
@@ -13,6 +13,124 @@
 #include "magmasparse_internal.h"
 
 
+/**
+    Hash of the column pattern of row i, used to rule out most mismatching
+    rows before their patterns are compared.
+*/
+static inline unsigned long long
+magma_dmrowblocks_hash(
+    magma_d_matrix A,
+    magma_int_t i )
+{
+    unsigned long long h = 14695981039346656037ull ^
+                           (unsigned long long) ( A.row[i+1] - A.row[i] );
+    for (magma_int_t k = A.row[i]; k < A.row[i+1]; k++) {
+        h = ( h ^ (unsigned long long) A.col[k] ) * 1099511628211ull;
+    }
+    return h;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    Splits the rows of A into blocks of consecutive rows with identical
+    column patterns. A run of rows with identical patterns is split into
+    blocks of max_bs rows. The patterns are hashed and compared to the
+    pattern of the previous row in parallel.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_d_matrix
+                System matrix in CSR on the host.
+
+    @param[in]
+    max_bs      magma_int_t
+                Maximal number of rows in a block.
+
+    @param[out]
+    num_blocks  magma_int_t*
+                Number of blocks.
+
+    @param[out]
+    start       magma_index_t**
+                First row of each block, followed by A.num_rows
+                (length num_blocks+1), allocated on the host.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_daux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_dmrowblocks(
+    magma_d_matrix A,
+    magma_int_t max_bs,
+    magma_int_t *num_blocks,
+    magma_index_t **start,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    magma_int_t n = A.num_rows, nb = 0, run = 0;
+    unsigned long long *hash = NULL;
+    magma_index_t *brk = NULL;
+
+    *start = NULL;
+    if ( max_bs < 1 ) {
+        max_bs = 1;
+    }
+    CHECK( magma_malloc_cpu( (void**) &hash, (n+1) * sizeof(unsigned long long) ));
+    CHECK( magma_index_malloc_cpu( &brk, n+1 ));
+    CHECK( magma_index_malloc_cpu( start, n+1 ));
+
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t i = 0; i < n; i++) {
+        hash[i] = magma_dmrowblocks_hash( A, i );
+    }
+    // a row starts a new run unless its pattern matches the previous one
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t i = 0; i < n; i++) {
+        magma_index_t b = 1;
+        if ( i > 0 && hash[i] == hash[i-1] &&
+             A.row[i+1]-A.row[i] == A.row[i]-A.row[i-1] ) {
+            b = 0;
+            for (magma_int_t k = 0; k < A.row[i+1]-A.row[i]; k++) {
+                if ( A.col[ A.row[i]+k ] != A.col[ A.row[i-1]+k ] ) {
+                    b = 1;
+                    break;
+                }
+            }
+        }
+        brk[i] = b;
+    }
+    // split the runs into blocks of at most max_bs rows
+    for (magma_int_t i = 0; i < n; i++) {
+        if ( brk[i] ) {
+            run = i;
+        }
+        if ( brk[i] || (i - run) % max_bs == 0 ) {
+            (*start)[ nb++ ] = i;
+        }
+    }
+    (*start)[ nb ] = n;
+    *num_blocks = nb;
+
+cleanup:
+    if ( info != 0 ) {
+        magma_free_cpu( *start );
+        *start = NULL;
+    }
+    magma_free_cpu( hash );
+    magma_free_cpu( brk );
+    return info;
+}
+
+
 /***************************************************************************//**
     Purpose
     -------
@@ -49,115 +167,54 @@ magma_dmsupernodal(
 {
     magma_int_t info = 0;
 
-    magma_int_t *blocksizes=NULL, *blocksizes2=NULL, *start=NULL, *v=NULL;
+    magma_int_t *blocksizes2=NULL;
+    magma_index_t *start=NULL;
     magma_int_t blockcount=0, blockcount2=0;
-    
-    magma_d_matrix x={Magma_CSR};
-    //char *filename = "blocksizes";
-    //int nlength = 6752;
 
     int maxblocksize = *max_bs;
     int current_size = 0;
-    int prev_matches = 0;
-    
+
     // make sure the target structure is empty
     magma_dmfree( S, queue );
 
-    CHECK( magma_imalloc_cpu( &v, A.num_rows+10 ));
-    CHECK( magma_imalloc_cpu( &start, A.num_rows+10 ));
-    CHECK( magma_imalloc_cpu( &blocksizes, A.num_rows+10 ));
-    CHECK( magma_imalloc_cpu( &blocksizes2, A.num_rows+10 ));
-
-    v[0] = 1;
-
-    for( magma_int_t i=1; i<A.num_rows; i++ ){
-        // pattern matches the pattern of the previous row
-        int match = 0; // 0 means match!
-        if( prev_matches == maxblocksize ){ // bounded by maxblocksize
-            match = 1; // no match
-            prev_matches = 0;
-        } else if( ((A.row[i+1]-A.row[i])-(A.row[i]-A.row[i-1])) != 0 ){
-            match = 1; // no match
-            prev_matches = 0;
-        } else {
-            magma_index_t length = (A.row[i+1]-A.row[i]);
-            magma_index_t start1 = A.row[i-1];
-            magma_index_t start2 = A.row[i];
-            for( magma_index_t j=0; j<length; j++ ){
-                if( A.col[ start1+j ] != A.col[ start2+j ] ){
-                    match = 1;
-                    prev_matches = 0;
-                }
-            }
-            if( match == 0 ){
-                prev_matches++; // add one match to the block
-            }
-        }
-        v[ i ] = match;
-    }
-
-    // start = find[v];
-    blockcount = 0;
-    for( magma_int_t i=0; i<A.num_rows; i++ ){
-        if( v[i] == 1 ){
-            start[blockcount] = i;
-            blockcount++;
-        }
-    }
-    start[blockcount] = A.num_rows;
-
-    for( magma_int_t i=0; i<blockcount; i++ ){
-        blocksizes[i] = start[i+1] - start[i];
-        if( blocksizes[i] > maxblocksize ){
-            // maxblocksize = blocksizes[i];
-            // printf("%% warning: at i=%5lld blocksize required is %5lld\n",
-            //                                                (long long) i, (long long) blocksizes[i] );
-        }
-    }
+    // supernodes: rows with the pattern of the previous row, a supernode
+    // is closed after it matched maxblocksize times
+    CHECK( magma_dmrowblocks( A, maxblocksize+1, &blockcount, &start, queue ));
+    CHECK( magma_imalloc_cpu( &blocksizes2, blockcount+1 ));
 
+    // merge consecutive supernodes up to maxblocksize rows
     current_size = 0;
     blockcount2=0;
     for( magma_int_t i=0; i<blockcount; i++ ){
-        if( current_size + blocksizes[i] > maxblocksize ){
+        magma_int_t blocksize = start[i+1] - start[i];
+        if( current_size + blocksize > maxblocksize ){
             blocksizes2[ blockcount2 ] = current_size;
             blockcount2++;
-            current_size = blocksizes[i]; // form new block
+            current_size = blocksize; // form new block
         } else {
-            current_size = current_size + blocksizes[i]; // add to previous block
+            current_size = current_size + blocksize; // add to previous block
         }
-        blocksizes[i] = start[i+1] - start[i];
     }
     blocksizes2[ blockcount2 ] = current_size;
     blockcount2++;
-    
+
     *max_bs = maxblocksize;
-    
-//     magma_dvread( &x, nlength, filename, queue );
-// for( int z=0; z< nlength; z++){
-//     blocksizes2[z] = (magma_int_t) MAGMA_D_REAL((x.val[z]));  
-// }
-// blockcount2 = nlength;
 
     CHECK( magma_dmvarsizeblockstruct( A.num_rows, blocksizes2, blockcount2, MagmaLower, S, queue ) );
-    
+
     CHECK( magma_index_malloc_cpu( &S->tile_desc_offset_ptr, blockcount2+1 ));
     S->tile_desc_offset_ptr[ 0 ] = 0;
     blockcount = 0;
     for( magma_int_t i=0; i<blockcount2; i++ ){
     blockcount = blockcount + blocksizes2[ i ];
-        S->tile_desc_offset_ptr[ i+1 ] = blockcount ;        
+        S->tile_desc_offset_ptr[ i+1 ] = blockcount ;
     }
-    
+
     S->numblocks = blockcount2;
 
 cleanup:
-    magma_free_cpu( v );
-    magma_dmfree(&x, queue );
-    magma_free_cpu( blocksizes );
     magma_free_cpu( blocksizes2 );
     magma_free_cpu( start );
-    v = NULL;
-    blocksizes = NULL;
     blocksizes2 = NULL;
     start = NULL;
 
@@ -168,7 +225,8 @@ cleanup:
 /***************************************************************************//**
     Purpose
     -------
-    Generates a block-diagonal sparsity pattern with variable block-size
+    Generates a block-diagonal sparsity pattern with variable block-size.
+    The blocks are written in parallel.
 
     Arguments
     ---------
@@ -211,7 +269,7 @@ magma_dmvarsizeblockstruct(
 {
     magma_int_t info = 0;
 
-    magma_int_t i, k, j, nnz = 0, col_start, row;
+    magma_index_t *rowstart=NULL, *nzstart=NULL;
 
     A->val = NULL;
     A->col = NULL;
@@ -230,36 +288,38 @@ magma_dmvarsizeblockstruct(
     A->storage_type = Magma_CSR;
     A->nnz = 0;
 
-    for( i=0; i<bsl; i++ ){
-        A->nnz = A->nnz + bs[i] * bs[i];
+    // first row and first nonzero of each block
+    CHECK( magma_index_malloc_cpu( &rowstart, bsl+1 ));
+    CHECK( magma_index_malloc_cpu( &nzstart, bsl+1 ));
+    rowstart[0] = 0;
+    nzstart[0] = 0;
+    for( magma_int_t i=0; i<bsl; i++ ){
+        rowstart[i+1] = rowstart[i] + bs[i];
+        nzstart[i+1] = nzstart[i] + bs[i] * bs[i];
     }
+    A->nnz = nzstart[ bsl ];
+    A->true_nnz = A->nnz;
 
     CHECK( magma_dmalloc_cpu( &A->val, A->nnz ));
     CHECK( magma_index_malloc_cpu( &A->row, A->num_rows+1 ));
     CHECK( magma_index_malloc_cpu( &A->col, A->nnz ));
-    nnz = 0;
-    row = 0;
-    col_start = 0;
-    for( i=0; i<bsl; i++ ){
-        for( j=0; j<bs[i]; j++ ){
-            A->row[ row ] = nnz;
-            row++;
-            for( k=0; k<bs[i]; k++ ){
+    #pragma omp parallel for schedule(dynamic, 64)
+    for( magma_int_t i=0; i<bsl; i++ ){
+        for( magma_int_t j=0; j<bs[i]; j++ ){
+            magma_index_t nnz = nzstart[i] + j*bs[i];
+            A->row[ rowstart[i]+j ] = nnz;
+            for( magma_int_t k=0; k<bs[i]; k++ ){
                 A->val[ nnz + k ] = MAGMA_D_ONE;
-                A->col[ nnz + k ] = col_start + k;
+                A->col[ nnz + k ] = rowstart[i] + k;
             }
-            nnz = nnz+bs[i];
         }
-        col_start = col_start + bs[i];
     }
-    A->row[ row ] = nnz;
-
-
-    CHECK( magma_dmcsrcompressor( A, queue ) );
+    A->row[ rowstart[ bsl ] ] = A->nnz;
 
     // magma_d_mvisu( *A, queue );
 
 cleanup:
-
+    magma_free_cpu( rowstart );
+    magma_free_cpu( nzstart );
     return info;
 }
@@ -5,14 +5,16 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zmtranspose.cpp, normal z -> d, Sat Mar 27 20:32:43 2021
+       @generated from sparse/control/magma_zmtranspose.cpp, normal z -> d, Sat Oct 17 00:26:40 2026
        @author Hartwig Anzt
        @author Mark Gates
 
 */
 #include "magmasparse_internal.h"
 
+#if ! defined(HAVE_HOST)
 #include <cuda.h>  // for CUDA_VERSION
+#endif
 
 /* For hipSPARSE, they use a separate real type than for hipBLAS */
 #ifdef HAVE_HIP
@@ -274,9 +276,11 @@ magma_d_cucsrtranspose(
     // for symmetric matrices: convert to csc using cusparse
     
     magma_int_t info = 0;
+    #if ! defined(HAVE_HOST)
     cusparseHandle_t handle=NULL;
     cusparseMatDescr_t descrA=NULL;
     cusparseMatDescr_t descrB=NULL;
+    #endif
     
     
     magma_d_matrix ACSR={Magma_CSR}, BCSR={Magma_CSR};
@@ -285,6 +289,14 @@ magma_d_cucsrtranspose(
     // make sure the target structure is empty
     magma_dmfree( B, queue );
 
+    #if defined(HAVE_HOST)
+    // the host backend has no cuSPARSE; transpose a CPU copy instead
+    if( A.storage_type == Magma_CSR && A.memory_location == Magma_DEV ) {
+        CHECK( magma_dmtransfer( A, &ACSR, Magma_DEV, Magma_CPU, queue ));
+        CHECK( magma_dmtranspose_cpu( ACSR, &BCSR, queue ));
+        CHECK( magma_dmtransfer( BCSR, B, Magma_CPU, Magma_DEV, queue ));
+    }
+    #else
     if( A.storage_type == Magma_CSR && A.memory_location == Magma_DEV ) {
         // fill in information for B
         B->storage_type    = A.storage_type;
@@ -327,7 +339,9 @@ magma_d_cucsrtranspose(
                           (double*)A.dval, A.drow, A.dcol, (double*)B->dval, B->dcol, B->drow,
                           CUSPARSE_ACTION_NUMERIC,
                           CUSPARSE_INDEX_BASE_ZERO);
-    } else if ( A.storage_type == Magma_CSR && A.memory_location == Magma_CPU ){
+    }
+    #endif
+    else if ( A.storage_type == Magma_CSR && A.memory_location == Magma_CPU ){
         CHECK( magma_dmtransfer( A, &dA, A.memory_location, Magma_DEV, queue ));
         CHECK( magma_d_cucsrtranspose( dA, &dB, queue ));
         CHECK( magma_dmtransfer( dB, B, Magma_DEV, A.memory_location, queue ));
@@ -337,9 +351,11 @@ magma_d_cucsrtranspose(
         CHECK( magma_dmconvert( BCSR, B, Magma_CSR, A.storage_type, queue ));
     }
 cleanup:
+    #if ! defined(HAVE_HOST)
     cusparseDestroyMatDescr( descrA );
     cusparseDestroyMatDescr( descrB );
     cusparseDestroy( handle );
+    #endif
     magma_dmfree( &dA, queue );
     magma_dmfree( &dB, queue );
     magma_dmfree( &ACSR, queue );
@@ -385,9 +401,11 @@ magma_dmtransposeconjugate(
     // for symmetric matrices: convert to csc using cusparse
     
     magma_int_t info = 0;
+    #if ! defined(HAVE_HOST)
     cusparseHandle_t handle=NULL;
     cusparseMatDescr_t descrA=NULL;
     cusparseMatDescr_t descrB=NULL;
+    #endif
     
     magma_d_matrix ACSR={Magma_CSR}, BCSR={Magma_CSR};
     magma_d_matrix dA={Magma_CSR}, dB={Magma_CSR};
@@ -395,6 +413,17 @@ magma_dmtransposeconjugate(
     // make sure the target structure is empty
     magma_dmfree( B, queue );
 
+    #if defined(HAVE_HOST)
+    // the host backend has no cuSPARSE; transpose and conjugate a CPU copy
+    if( A.storage_type == Magma_CSR ) {
+        CHECK( magma_dmtransfer( A, &ACSR, A.memory_location, Magma_CPU, queue ));
+        CHECK( magma_dmtranspose_cpu( ACSR, &BCSR, queue ));
+        for( magma_int_t k=0; k < BCSR.nnz; k++ ) {
+            BCSR.val[k] = MAGMA_D_CONJ( BCSR.val[k] );
+        }
+        CHECK( magma_dmtransfer( BCSR, B, Magma_CPU, A.memory_location, queue ));
+    }
+    #else
     if( A.storage_type == Magma_CSR && A.memory_location == Magma_DEV ) {
         // fill in information for B
         B->storage_type    = A.storage_type;
@@ -436,7 +465,9 @@ magma_dmtransposeconjugate(
                           CUSPARSE_ACTION_NUMERIC,
                           CUSPARSE_INDEX_BASE_ZERO);
         CHECK( magma_dmconjugate( B, queue ));
-    } else if ( A.memory_location == Magma_CPU ){
+    }
+    #endif
+    else if ( A.memory_location == Magma_CPU ){
         CHECK( magma_dmtransfer( A, &dA, A.memory_location, Magma_DEV, queue ));
         CHECK( magma_dmtransposeconjugate( dA, &dB, queue ));
         CHECK( magma_dmtransfer( dB, B, Magma_DEV, A.memory_location, queue ));
@@ -446,9 +477,11 @@ magma_dmtransposeconjugate(
         CHECK( magma_dmconvert( BCSR, B, Magma_CSR, A.storage_type, queue ));
     }
 cleanup:
+    #if ! defined(HAVE_HOST)
     cusparseDestroyMatDescr( descrA );
     cusparseDestroyMatDescr( descrB );
     cusparseDestroy( handle );
+    #endif
     magma_dmfree( &dA, queue );
     magma_dmfree( &dB, queue );
     magma_dmfree( &ACSR, queue );
@@ -5,14 +5,21 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zselect.cpp, normal z -> d, Sat Mar 27 20:32:44 2021
+       @generated from sparse/control/magma_zselect.cpp, normal z -> d, Fri Oct 16 18:37:51 2026
        @author Hartwig Anzt
 */
 
 //  in this file, many routines are taken from
 //  the IO functions provided by MatrixMarket
 
+#include <algorithm>
+#include <vector>
+
 #include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #define SWAP(a, b)  { tmp = a; a = b; b = tmp; }
 
 
@@ -227,3 +234,262 @@ magma_dselectrandom(
     }
     return info;
 }
+
+
+// sample-select: number of splitters and sample size per level
+#define MAGMA_SELECT_SPLITTERS 255
+#define MAGMA_SELECT_LEVELS 8
+#define MAGMA_SELECT_SAMPLE 1024
+
+// arrays up to this size are selected with a serial nth_element
+#define MAGMA_SELECT_SMALL 2048
+
+// arrays from this size on are counted by all threads
+#define MAGMA_SELECT_PARALLEL 16384
+
+
+/*
+    Magnitude of element i of the level: the values on the first level,
+    the extracted magnitudes on the following levels.
+*/
+static inline double
+magma_dselect_abs(
+    const double *a,
+    const double *m,
+    magma_int_t i )
+{
+    return ( a != NULL ) ? (double) MAGMA_D_ABS( a[i] ) : m[i];
+}
+
+
+/*
+    Bucket of x: 2j for splitters[j-1] < x < splitters[j], 2j-1 for
+    x == splitters[j-1]. The equality buckets make the selection progress
+    in the presence of many equal magnitudes. tree holds the splitters as
+    an implicit binary search tree (tree[1] is the root, the children of
+    tree[i] are tree[2i] and tree[2i+1]), which is traversed without
+    branches.
+*/
+static inline magma_int_t
+magma_dselect_bucket(
+    const double *tree,
+    const double *splitters,
+    double x )
+{
+    magma_int_t i = 1;
+    for( magma_int_t l=0; l<MAGMA_SELECT_LEVELS; l++ ) {
+        i = 2*i + ( x >= tree[i] );
+    }
+    magma_int_t u = i - (MAGMA_SELECT_SPLITTERS+1);
+    return ( u > 0 && x == splitters[u-1] ) ? 2*u-1 : 2*u;
+}
+
+
+/*
+    Fills the implicit search tree from the sorted splitters.
+*/
+static void
+magma_dselect_tree(
+    const double *splitters,
+    double *tree,
+    magma_int_t node,
+    magma_int_t *next )
+{
+    if ( node > MAGMA_SELECT_SPLITTERS ) {
+        return;
+    }
+    magma_dselect_tree( splitters, tree, 2*node, next );
+    tree[node] = splitters[ (*next)++ ];
+    magma_dselect_tree( splitters, tree, 2*node+1, next );
+}
+
+
+/**
+    Purpose
+    -------
+
+    Parallel sample-select: returns the magnitude of the element of rank k
+    (counting from 0, increasing magnitude) of the array a without
+    modifying or copying it.
+
+    Every level sorts a small sample, distributes the elements into 511
+    buckets bounded by 255 splitters (including one bucket for every
+    splitter value) with per-thread histograms, and continues with the
+    elements of the bucket containing rank k only. These are extracted
+    into a scratch array of about size/256 elements.
+
+    In approximate mode (tol > 0) the selection stops as soon as the bucket
+    containing rank k holds at most tol*size elements and returns the lower
+    bound of this bucket. In both modes the result thrs satisfies
+
+        #{ i : |a[i]| < thrs } <= k < #{ i : |a[i]| <= thrs } + tol*size,
+
+    i.e. thresholding at thrs never selects more than k elements below it
+    and misses at most tol*size. One level (a single pass over the data)
+    typically suffices for tol >= 1e-2.
+
+    Arguments
+    ---------
+
+    @param[in]
+    a           double*
+                array to select from, not modified
+
+    @param[in]
+    size        magma_int_t
+                size of array
+
+    @param[in]
+    k           magma_int_t
+                rank of the element, 0 <= k < size
+
+    @param[in]
+    tol         double
+                relative rank accuracy, 0 for the exact element
+
+    @param[out]
+    thrs        double*
+                magnitude of the selected element
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_daux
+    ********************************************************************/
+
+extern "C"
+magma_int_t
+magma_dsampleselect_cpu(
+    double *a,
+    magma_int_t size,
+    magma_int_t k,
+    double tol,
+    double *thrs,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    const magma_int_t num_buckets = 2*MAGMA_SELECT_SPLITTERS + 1;
+    const double *src = a;
+    double *m = NULL, *scratch = NULL;
+    magma_int_t n = size, num_threads = 1;
+    double splitters[ MAGMA_SELECT_SPLITTERS ];
+    double tree[ MAGMA_SELECT_SPLITTERS+1 ];
+    double sample[ MAGMA_SELECT_SAMPLE ];
+    std::vector< magma_int_t > hist;
+
+    if ( size <= 0 || k < 0 || k >= size ) {
+        info = MAGMA_ERR_ILLEGAL_VALUE;
+        goto cleanup;
+    }
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    hist.resize( num_buckets * (num_threads+1) );
+
+    while ( true ) {
+        if ( n <= MAGMA_SELECT_SMALL ) {
+            if ( src != NULL ) {
+                CHECK( magma_dmalloc_cpu( &scratch, n ));
+                for( magma_int_t i=0; i<n; i++ ) {
+                    scratch[i] = MAGMA_D_ABS( src[i] );
+                }
+                m = scratch;
+                scratch = NULL;
+            }
+            std::nth_element( m, m+k, m+n );
+            *thrs = m[k];
+            break;
+        }
+
+        // splitters from a sorted sample spread over the array
+        for( magma_int_t j=0; j<MAGMA_SELECT_SAMPLE; j++ ) {
+            magma_int_t stride = n / MAGMA_SELECT_SAMPLE;
+            magma_int_t offset = ( (j * 2654435761u) >> 7 ) % stride;
+            sample[j] = magma_dselect_abs( src, m, j*stride + offset );
+        }
+        std::sort( sample, sample + MAGMA_SELECT_SAMPLE );
+        for( magma_int_t j=0; j<MAGMA_SELECT_SPLITTERS; j++ ) {
+            splitters[j] = sample[ (j+1) * MAGMA_SELECT_SAMPLE
+                                   / (MAGMA_SELECT_SPLITTERS+1) ];
+        }
+        magma_int_t next = 0;
+        magma_dselect_tree( splitters, tree, 1, &next );
+
+        // bucket histograms, hist[t*num_buckets+b] for thread t
+        magma_int_t nt = ( n >= MAGMA_SELECT_PARALLEL ) ? num_threads : 1;
+        #pragma omp parallel num_threads( nt )
+        {
+            magma_int_t tid = 0;
+            #ifdef _OPENMP
+            tid = omp_get_thread_num();
+            #endif
+            magma_int_t *h = &hist[ tid*num_buckets ];
+            for( magma_int_t b=0; b<num_buckets; b++ ) {
+                h[b] = 0;
+            }
+            magma_int_t start = n * tid / nt, end = n * (tid+1) / nt;
+            for( magma_int_t i=start; i<end; i++ ) {
+                h[ magma_dselect_bucket( tree, splitters, magma_dselect_abs( src, m, i ) ) ]++;
+            }
+        }
+
+        // bucket containing rank k
+        magma_int_t bucket = 0, below = 0, count = 0;
+        for( bucket=0; bucket<num_buckets; bucket++ ) {
+            count = 0;
+            for( magma_int_t t=0; t<nt; t++ ) {
+                count += hist[ t*num_buckets+bucket ];
+            }
+            if ( k < below + count ) {
+                break;
+            }
+            below += count;
+        }
+        if ( bucket % 2 == 1 ) {
+            // equality bucket
+            *thrs = splitters[ (bucket-1)/2 ];
+            break;
+        }
+        if ( tol > 0 && count <= tol * size ) {
+            // just above the previous splitter: no element of the bucket is below
+            *thrs = ( bucket > 0 ) ? nextafter( splitters[ bucket/2 - 1 ], HUGE_VAL ) : 0.0;
+            break;
+        }
+
+        // extract the bucket, every thread writes behind the previous ones
+        CHECK( magma_dmalloc_cpu( &scratch, count ));
+        magma_int_t *offsets = &hist[ nt*num_buckets ];
+        offsets[0] = 0;
+        for( magma_int_t t=1; t<nt; t++ ) {
+            offsets[t] = offsets[t-1] + hist[ (t-1)*num_buckets+bucket ];
+        }
+        #pragma omp parallel num_threads( nt )
+        {
+            magma_int_t tid = 0;
+            #ifdef _OPENMP
+            tid = omp_get_thread_num();
+            #endif
+            magma_int_t pos = offsets[tid];
+            magma_int_t start = n * tid / nt, end = n * (tid+1) / nt;
+            for( magma_int_t i=start; i<end; i++ ) {
+                double x = magma_dselect_abs( src, m, i );
+                if ( magma_dselect_bucket( tree, splitters, x ) == bucket ) {
+                    scratch[ pos++ ] = x;
+                }
+            }
+        }
+        magma_free_cpu( m );
+        m = scratch;
+        scratch = NULL;
+        src = NULL;
+        n = count;
+        k -= below;
+    }
+
+cleanup:
+    magma_free_cpu( m );
+    magma_free_cpu( scratch );
+    return info;
+}
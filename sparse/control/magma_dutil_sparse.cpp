@@ -5,14 +5,12 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zutil_sparse.cpp, normal z -> d, Sat Mar 27 20:32:38 2021
+       @generated from sparse/control/magma_zutil_sparse.cpp, normal z -> d, Sat Oct 17 00:26:38 2026
 
        @author Hartwig Anzt
 
        Utilities for testing MAGMA-sparse.
 */
-#include <cuda_runtime_api.h>
-
 #include "magmasparse_internal.h"
 
 #define PRECISION_d
@@ -26,8 +24,14 @@ static const char *usage_sparse =
 " --solver      Possibility to choose a solver:\n"
 "               CG, PCG, BICGSTAB, PBICGSTAB, GMRES, PGMRES, LOBPCG, JACOBI,\n"
 "               BAITER, IDR, PIDR, CGS, PCGS, TFQMR, PTFQMR, QMR, PQMR, BICG,\n"
-"               PBICG, BOMBARDMENT, ITERREF.\n"
+"               PBICG, BOMBARDMENT, ITERREF, CACG, PIPEGMRES.\n"
 " --basic       Use non-optimized version\n"
+" --location x  Memory location for the solve: DEV (default) or CPU.\n"
+"               CPU is supported for CG, BICGSTAB and GMRES, and for PCG, PBICGSTAB\n"
+"               and PGMRES with the PARILU preconditioner, or PARIC for PCG.\n"
+"               CACG and PIPEGMRES are only available on the CPU.\n"
+" --nrhs k      Number of right-hand sides. On the CPU, CG and GMRES solve them\n"
+"               as one block sharing every SpMV.\n"
 " --ev x        For eigensolvers, set number of eigenvalues/eigenvectors to compute.\n"
 " --restart     For GMRES: possibility to choose the restart.\n"
 "               For IDR: Number of distinct subspaces (1,2,4,8).\n"
@@ -36,12 +40,22 @@ static const char *usage_sparse =
 " --maxiter x   Set an upper limit for the iteration count.\n"
 " --rtol x      Set a relative residual stopping criterion.\n"
 " --format      Possibility to choose a format for the sparse matrix:\n"
-"               CSR, ELL, SELLP, CUSPARSECSR, CSR5.\n"
+"               CSR, ELL, SELLP, CUSPARSECSR, CSR5,\n"
+"               AUTO   chosen for the solve location by magma_dmtune.\n"
+" --tune x      How AUTO chooses the format: ANALYZE (default) inspects the\n"
+"               row lengths, BENCH times the candidate formats.\n"
 " --blocksize x Set a specific blocksize for SELL-P format.\n"
 " --alignment x Set a specific alignment for SELL-P format.\n"
+" --sigma x     Sort the rows by length within windows of x rows (SELL-C-sigma,\n"
+"               CPU only).\n"
 " --mscale      Possibility to scale the original matrix:\n"
 "               NOSCALE   no scaling\n"
 "               UNITDIAG   symmetric scaling to unit diagonal\n"
+" --reorder     Possibility to reorder the original matrix:\n"
+"               NONE   no reordering\n"
+"               RCM   reverse Cuthill-McKee (bandwidth)\n"
+"               MINDEGREE   approximate minimum degree (fill)\n"
+"               ND   nested dissection\n"
 " --precond x   Possibility to choose a preconditioner:\n"
 "               CG, BICGSTAB, GMRES, LOBPCG, JACOBI,\n"
 "               BAITER, IDR, CGS, TFQMR, QMR, BICG\n"
@@ -53,6 +67,8 @@ static const char *usage_sparse =
 "                   --triolver k  Solver for triangular ILU factors: e.g. CUSOLVE, JACOBI, ISAI.\n"
 "                   --ppattern k  Pattern used for ISAI preconditioner.\n"
 "                   --psweeps x   Number of iterative ParILU sweeps.\n"
+"                   --pformat x   Value precision of the ITERREF inner solver on the CPU:\n"
+"                                 FP32 (default) or FP16.\n"
 " --trisolver   Possibility to choose a triangular solver for ILU preconditioning: \n"
 "               e.g. CUSOLVE, ISPTRSV, JACOBI, VBJACOBI, ISAI.\n"
 " --ppattern k  Possibility to choose a pattern for the trisolver: ISAI(k) or Block Jacobi.\n"
@@ -110,10 +126,15 @@ magma_dparse_opts(
     opts->input_format = Magma_CSR;
     opts->blocksize = 32;
     opts->alignment = 1;
+    opts->sigma = 1;
     opts->output_format = Magma_CSR;
     opts->input_location = Magma_CPU;
     opts->output_location = Magma_CPU;
+    opts->compute_location = Magma_DEV;
     opts->scaling = Magma_NOSCALE;
+    opts->reordering = Magma_NOREORDER;
+    opts->nrhs = 1;
+    opts->tune = Magma_TUNE_ANALYZE;
     #if defined(PRECISION_z) | defined(PRECISION_d)
         opts->solver_par.atol = 1e-16;
         opts->solver_par.rtol = 1e-10;
@@ -141,13 +162,11 @@ magma_dparse_opts(
     opts->precond_par.sweeps = 5;
     opts->precond_par.maxiter = 1;
     opts->precond_par.pattern = 1;
+    opts->precond_par.format = Magma_FLOAT;
     opts->solver_par.solver = Magma_CGMERGE;
     
     printf( usage_sparse_short, argv[0] );
     
-    int ndevices;
-    cudaGetDeviceCount( &ndevices );
-    
     int basic = 0;
 
     for( int i = 1; i < argc; ++i ) {
@@ -163,6 +182,8 @@ magma_dparse_opts(
                 opts->output_format = Magma_CUCSR;
             } else if ( strcmp("CSR5", argv[i]) == 0 ) {
                 opts->output_format = Magma_CSR5;
+            } else if ( strcmp("AUTO", argv[i]) == 0 ) {
+                opts->output_format = Magma_AUTO;
             } else {
                 printf( "%%error: invalid format, use default (CSR).\n" );
             }
@@ -189,6 +210,34 @@ magma_dparse_opts(
             else {
                 printf( "%%error: invalid scaling, use default.\n" );
             }
+        } else if ( strcmp("--tune", argv[i]) == 0 && i+1 < argc ) {
+            i++;
+            if ( strcmp("ANALYZE", argv[i]) == 0 ) {
+                opts->tune = Magma_TUNE_ANALYZE;
+            }
+            else if ( strcmp("BENCH", argv[i]) == 0 ) {
+                opts->tune = Magma_TUNE_BENCHMARK;
+            }
+            else {
+                printf( "%%error: invalid tuning mode, use default.\n" );
+            }
+        } else if ( strcmp("--reorder", argv[i]) == 0 && i+1 < argc ) {
+            i++;
+            if ( strcmp("NONE", argv[i]) == 0 ) {
+                opts->reordering = Magma_NOREORDER;
+            }
+            else if ( strcmp("RCM", argv[i]) == 0 ) {
+                opts->reordering = Magma_RCM;
+            }
+            else if ( strcmp("MINDEGREE", argv[i]) == 0 ) {
+                opts->reordering = Magma_MINDEGREE;
+            }
+            else if ( strcmp("ND", argv[i]) == 0 ) {
+                opts->reordering = Magma_NESTEDDISSECTION;
+            }
+            else {
+                printf( "%%error: invalid reordering, use default.\n" );
+            }
         } else if ( strcmp("--solver", argv[i]) == 0 && i+1 < argc ) {
             i++;
             if ( strcmp("CG", argv[i]) == 0 ) {
@@ -227,6 +276,12 @@ magma_dparse_opts(
             else if ( strcmp("PGMRES", argv[i]) == 0 ) {
                 opts->solver_par.solver = Magma_PGMRES;
             }
+            else if ( strcmp("CACG", argv[i]) == 0 ) {
+                opts->solver_par.solver = Magma_CACG;
+            }
+            else if ( strcmp("PIPEGMRES", argv[i]) == 0 ) {
+                opts->solver_par.solver = Magma_PIPEGMRES;
+            }
             else if ( strcmp("LOBPCG", argv[i]) == 0 ) {
                 opts->solver_par.solver = Magma_LOBPCG;
             }
@@ -266,6 +321,10 @@ magma_dparse_opts(
             else {
                 printf( "%%error: invalid solver.\n" );
             }
+        } else if ( strcmp("--nrhs", argv[i]) == 0 && i+1 < argc ) {
+            // read into k first: max is a macro and would evaluate argv[++i] twice
+            magma_int_t k = atoi( argv[++i] );
+            opts->nrhs = max( 1, k );
         } else if ( strcmp("--restart", argv[i]) == 0 && i+1 < argc ) {
             opts->solver_par.restart = atoi( argv[++i] );
         } else if ( strcmp("--precond", argv[i]) == 0 && i+1 < argc ) {
@@ -407,6 +466,15 @@ magma_dparse_opts(
             else {
                 printf( "%%error: invalid trisolver.\n" );
             }
+        } else if ( strcmp("--location", argv[i]) == 0 && i+1 < argc ) {
+            i++;
+            if ( strcmp("CPU", argv[i]) == 0 ) {
+                opts->compute_location = Magma_CPU;
+            } else if ( strcmp("DEV", argv[i]) == 0 ) {
+                opts->compute_location = Magma_DEV;
+            } else {
+                printf( "%%error: invalid location, use default (DEV).\n" );
+            }
         } else if ( strcmp("--basic", argv[i]) == 0 && i+1 < argc ) {
             basic = 1;
         } else if ( strcmp("--prestart", argv[i]) == 0 && i+1 < argc ) {
@@ -421,12 +489,25 @@ magma_dparse_opts(
             opts->precond_par.pattern = atoi( argv[++i] );
         } else if ( strcmp("--psweeps", argv[i]) == 0 && i+1 < argc ) {
             opts->precond_par.sweeps = atoi( argv[++i] );
+        } else if ( strcmp("--pformat", argv[i]) == 0 && i+1 < argc ) {
+            i++;
+            if ( strcmp("FP32", argv[i]) == 0 ) {
+                opts->precond_par.format = Magma_FLOAT;
+            } else if ( strcmp("FP16", argv[i]) == 0 ) {
+                opts->precond_par.format = Magma_HALF;
+            } else {
+                printf( "%%error: invalid value precision, use default (FP32).\n" );
+            }
         } else if ( strcmp("--plevels", argv[i]) == 0 && i+1 < argc ) {
             opts->precond_par.levels = atoi( argv[++i] );
         } else if ( strcmp("--blocksize", argv[i]) == 0 && i+1 < argc ) {
             opts->blocksize = atoi( argv[++i] );
         } else if ( strcmp("--alignment", argv[i]) == 0 && i+1 < argc ) {
             opts->alignment = atoi( argv[++i] );
+        } else if ( strcmp("--sigma", argv[i]) == 0 && i+1 < argc ) {
+            // read into k first: max is a macro and would evaluate argv[++i] twice
+            magma_int_t k = atoi( argv[++i] );
+            opts->sigma = max( 1, k );
         } else if ( strcmp("--verbose", argv[i]) == 0 && i+1 < argc ) {
             opts->solver_par.verbose = atoi( argv[++i] );
         }  else if ( strcmp("--maxiter", argv[i]) == 0 && i+1 < argc ) {
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zmatrixchar.cpp, normal z -> s, Sat Mar 27 20:32:39 2021
+       @generated from sparse/control/magma_zmatrixchar.cpp, normal z -> s, Fri Oct 16 18:29:39 2026
        @author Hartwig Anzt
 */
 #include "magmasparse_internal.h"
@@ -177,6 +177,6 @@ magma_sdiameter(
         info = MAGMA_ERR_NOT_SUPPORTED;
     }
 cleanup:
-    magma_free( &dim );
+    magma_free_cpu( dim );
     return info;
 }
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zmilustruct.cpp, normal z -> s, Sat Mar 27 20:32:44 2021
+       @generated from sparse/control/magma_zmilustruct.cpp, normal z -> s, Fri Oct 16 18:19:25 2026
        @author Hartwig Anzt
 */
 
@@ -13,6 +13,9 @@
 //  the IO functions provided by MatrixMarket
 
 #include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 /******************************************************************************
@@ -23,215 +26,461 @@
 
 #define mwIndex magma_index_t
 
+// rows up to this length are sorted by insertion, longer ones by radix sort
+#define MAGMA_SYMBILU_SORT_THRESHOLD 32
+
+// minimum size of the blocks each thread stores its row patterns in
+#define MAGMA_SYMBILU_BLOCK 65536
 
 
-void magma_sshell_sort(
-    const magma_int_t n, magma_index_t *x)
+/*
+// sorts x[0:len-1] in place, ascending order, all entries in [0,n).
+// short rows use insertion sort, longer rows a LSD radix sort on 8-bit
+// digits with as many passes as n needs. tmp has to hold len entries.
+*/
+static void
+magma_ssymbolic_ilu_sortrow(
+    const magma_int_t len, magma_index_t *x, magma_index_t *tmp,
+    const magma_int_t n )
 {
-    magma_int_t m, max, j, k, itemp;
+    if ( len <= MAGMA_SYMBILU_SORT_THRESHOLD ) {
+        for (magma_int_t j=1; j<len; j++) {
+            magma_index_t key = x[j];
+            magma_int_t k = j-1;
+            while (k >= 0 && x[k] > key) {
+                x[k+1] = x[k];
+                k--;
+            }
+            x[k+1] = key;
+        }
+        return;
+    }
+    
+    magma_index_t *src = x, *dst = tmp, *swap;
+    magma_int_t shift = 0;
+    do {
+        magma_int_t count[257] = { 0 };
+        for (magma_int_t j=0; j<len; j++)
+            count[ ((src[j] >> shift) & 255) + 1 ]++;
+        for (magma_int_t d=0; d<256; d++)
+            count[d+1] += count[d];
+        for (magma_int_t j=0; j<len; j++)
+            dst[ count[ (src[j] >> shift) & 255 ]++ ] = src[j];
+        swap = src;
+        src = dst;
+        dst = swap;
+        shift += 8;
+    } while ( ((n-1) >> shift) > 0 );
+    if ( src != x ) {
+        memcpy( x, src, len*sizeof(magma_index_t) );
+    }
+}
 
-    m = n/2;
 
-    while (m > 0) {
-        max = n - m;
-        for (j=0; j<max; j++)
-        {
-            for (k=j; k>=0; k-=m)
-            {
-                if (x[k+m] >= x[k])
-                    break;
-                itemp = x[k+m];
-                x[k+m] = x[k];
-                x[k] = itemp;
+/*
+// row patterns of the symbolic factorization.
+// each thread appends its rows to blocks of its own, rows never move once
+// written and can be read by other threads as soon as they are flagged
+// complete. rowbuf[i] holds nl[i] columns of L, followed by nu[i] columns
+// of U and their nu[i] fill levels.
+*/
+typedef struct {
+    magma_int_t     num_rows;
+    magma_int_t     nnzl;
+    magma_int_t     nnzu;
+    magma_index_t **rowbuf;
+    magma_index_t  *nl;
+    magma_index_t  *nu;
+    magma_int_t     num_threads;
+    magma_int_t    *num_blocks;
+    magma_index_t ***blocks;
+} magma_ssymbilu_rows;
+
+
+static void
+magma_ssymbolic_ilu_free(
+    magma_ssymbilu_rows *rows )
+{
+    if ( rows->blocks != NULL ) {
+        for (magma_int_t t=0; t<rows->num_threads; t++) {
+            for (magma_int_t k=0; k<rows->num_blocks[t]; k++) {
+                magma_free_cpu( rows->blocks[t][k] );
             }
+            magma_free_cpu( rows->blocks[t] );
         }
-        m = m/2;
     }
+    magma_free_cpu( rows->blocks );
+    magma_free_cpu( rows->num_blocks );
+    magma_free_cpu( rows->rowbuf );
+    magma_free_cpu( rows->nl );
+    magma_free_cpu( rows->nu );
+    rows->blocks = NULL;
+    rows->num_blocks = NULL;
+    rows->rowbuf = NULL;
+    rows->nl = NULL;
+    rows->nu = NULL;
+    rows->num_threads = 0;
 }
 
+
 /*
-// symbolic level ILU
-// factors magma_int_to separate upper and lower parts
+// symbolic level ILU, computes the patterns of all rows.
+// row i merges the U rows of all columns j < i in its pattern. the rows are
+// handed out in increasing order and a row waits only for the U rows it
+// actually merges, so the rows proceed in parallel as a wavefront without
+// any global synchronization. each thread owns its linked list workspace.
 // sorts the entries in each row of A by index
 // assumes no zero rows
 */
-
-extern "C"
-magma_int_t
-magma_ssymbolic_ilu(
+static magma_int_t
+magma_ssymbolic_ilu_rows(
     const magma_int_t levfill,                 /* level of fill */
     const magma_int_t n,                       /* order of matrix */
-    magma_int_t *nzl,                          /* input-output */
-    magma_int_t *nzu,                          /* input-output */
     const mwIndex *ia,
-    const mwIndex *ja,    /* input */
-    mwIndex *ial,
-    mwIndex *jal,              /* output lower factor structure */
-    mwIndex *iau,
-    mwIndex *jau)              /* output upper factor structure */
+    const mwIndex *ja,                         /* input */
+    magma_ssymbilu_rows *rows )                /* output row patterns */
 {
     magma_int_t info = 0;
     
-    magma_int_t i;
-    magma_index_t *lnklst=NULL;
-    magma_index_t *curlev=NULL;
-    magma_index_t *levels=NULL;
-    magma_index_t *iwork=NULL;
+    magma_int_t *ready = NULL;
+    magma_int_t maxlen = 0, num_threads = 1, failed = 0;
+    size_t blocksize;
     
-    magma_int_t knzl = 0;
-    magma_int_t knzu = 0;
-
-    CHECK( magma_index_malloc_cpu( &lnklst, n ));
-    CHECK( magma_index_malloc_cpu( &curlev, n ));
-    CHECK( magma_index_malloc_cpu( &levels, *nzu ));
-    CHECK( magma_index_malloc_cpu( &iwork, n ));
+    rows->num_rows = n;
+    rows->nnzl = 0;
+    rows->nnzu = 0;
+    rows->rowbuf = NULL;
+    rows->nl = NULL;
+    rows->nu = NULL;
+    rows->num_threads = 0;
+    rows->num_blocks = NULL;
+    rows->blocks = NULL;
+    
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
     
-    for(magma_int_t t=0; t<n; t++){
-        lnklst[t] = 0;
-        curlev[t] = 0;
-        iwork[t] = 0;
+    CHECK( magma_malloc_cpu( (void**) &rows->rowbuf, n*sizeof(magma_index_t*) ));
+    CHECK( magma_index_malloc_cpu( &rows->nl, n ));
+    CHECK( magma_index_malloc_cpu( &rows->nu, n ));
+    CHECK( magma_imalloc_cpu( &rows->num_blocks, num_threads ));
+    CHECK( magma_malloc_cpu( (void**) &rows->blocks, num_threads*sizeof(magma_index_t**) ));
+    CHECK( magma_imalloc_cpu( &ready, n ));
+    rows->num_threads = num_threads;
+    for (magma_int_t t=0; t<num_threads; t++) {
+        rows->num_blocks[t] = 0;
+        rows->blocks[t] = NULL;
     }
-
-    for(magma_int_t t=0; t<*nzu; t++){
-        levels[t] = 0;
+    
+    #pragma omp parallel for reduction(max:maxlen)
+    for (magma_int_t i=0; i<n; i++) {
+        ready[i] = 0;
+        maxlen = max( maxlen, (magma_int_t) (ia[i+1] - ia[i]) );
     }
-
-    ial[0] = 0;
-    iau[0] = 0;
-
-    for (i=0; i<n; i++) {
-        //printf("check line %d\n", i);
-        magma_int_t first, next, j;
-
-        /* copy column indices of row into workspace and sort them */
-
-        magma_int_t len = ia[i+1] - ia[i];
-        next = 0;
-        for (j=ia[i]; j<ia[i+1]; j++)
-            iwork[next++] = ja[j];
-        magma_sshell_sort(len, iwork);
-        //printf("check2 line %d\n", i);
-        /* construct implied linked list for row */
-
-        first = iwork[0];
-        curlev[first] = 0;
-
-        for (j=0; j<=len-2; j++)
-        {
-            lnklst[iwork[j]] = iwork[j+1];
-            curlev[iwork[j]] = 0;
+    // fill estimate for the first block of each thread
+    blocksize = max( (size_t) MAGMA_SYMBILU_BLOCK,
+                (size_t) ( 2*(levfill+1)*ia[n] / num_threads ) );
+    
+    #pragma omp parallel
+    {
+        magma_int_t tid = 0;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+#endif
+        magma_index_t *lnklst=NULL, *curlev=NULL, *iwork=NULL, *sortwork=NULL;
+        magma_index_t *block = NULL;
+        size_t used = 0, capacity = 0;
+        magma_int_t num_blocks = 0, max_blocks = 0;
+        magma_index_t **blocks = NULL;
+        magma_int_t myfail = 0;
+        
+        if ( magma_index_malloc_cpu( &lnklst, n ) != MAGMA_SUCCESS ||
+             magma_index_malloc_cpu( &curlev, n ) != MAGMA_SUCCESS ||
+             magma_index_malloc_cpu( &iwork, maxlen+1 ) != MAGMA_SUCCESS ||
+             magma_index_malloc_cpu( &sortwork, maxlen+1 ) != MAGMA_SUCCESS ) {
+            myfail = 1;
         }
-        // printf("check3 line %d iwork[len-1]:%d\n", i, iwork[len-1]);
-        lnklst[iwork[len-1]] = n;
-        curlev[iwork[len-1]] = 0;
-
-        /* merge with rows in U */
-        // printf("check4 line %d lnklst[iwork[len-1]]:%d\n", i, lnklst[iwork[len-1]]);
-        next = first;
-        // printf("next:%d (!<) first:%d\n", next, i);
-        while (next < i)
-        {
-          //  printf("check line %d while %d\n", i, next);
-            magma_int_t oldlst = next;
-            magma_int_t nxtlst = lnklst[next];
-            magma_int_t row = next;
-            magma_int_t ii;
-
-            /* scan row */
-
-            for (ii=iau[row]+1; ii<iau[row+1]; /*nop*/)
+        
+        #pragma omp for schedule(dynamic,64)
+        for (magma_int_t i=0; i<n; i++) {
+            magma_int_t first, next, j;
+            magma_int_t knzl = 0, knzu = 0;
+            
+            if ( myfail ) {
+                // keep the wavefront going, the result is discarded
+                rows->rowbuf[i] = NULL;
+                rows->nl[i] = 0;
+                rows->nu[i] = 0;
+                #pragma omp flush
+                #pragma omp atomic write
+                ready[i] = 1;
+                continue;
+            }
+            
+            /* copy column indices of row into workspace and sort them */
+            
+            magma_int_t len = ia[i+1] - ia[i];
+            next = 0;
+            for (j=ia[i]; j<ia[i+1]; j++)
+                iwork[next++] = ja[j];
+            magma_ssymbolic_ilu_sortrow( len, iwork, sortwork, n );
+            
+            /* construct implied linked list for row */
+            
+            first = ( len > 0 ) ? iwork[0] : n;
+            if ( len > 0 ) {
+                curlev[first] = 0;
+                for (j=0; j<=len-2; j++)
+                {
+                    lnklst[iwork[j]] = iwork[j+1];
+                    curlev[iwork[j]] = 0;
+                }
+                lnklst[iwork[len-1]] = n;
+                curlev[iwork[len-1]] = 0;
+            }
+            
+            /* merge with rows in U */
+            
+            next = first;
+            while (next < i)
             {
-                if (jau[ii] < nxtlst)
+                magma_int_t oldlst = next;
+                magma_int_t nxtlst = lnklst[next];
+                magma_int_t row = next;
+                magma_int_t ii, done;
+                
+                /* wait for the U row to be complete */
+                do {
+                    #pragma omp atomic read
+                    done = ready[row];
+                } while ( done == 0 );
+                #pragma omp flush
+                
+                const magma_index_t *jau = rows->rowbuf[row] + rows->nl[row];
+                const magma_index_t *levels = jau + rows->nu[row];
+                magma_int_t rownzu = rows->nu[row];
+                
+                /* scan row */
+                
+                for (ii=1; ii<rownzu; /*nop*/)
                 {
-                    /* new fill-in */
-                    magma_int_t newlev = curlev[row] + levels[ii] + 1;
-                    if (newlev <= levfill)
+                    if (jau[ii] < nxtlst)
+                    {
+                        /* new fill-in */
+                        magma_int_t newlev = curlev[row] + levels[ii] + 1;
+                        if (newlev <= levfill)
+                        {
+                            lnklst[oldlst]  = jau[ii];
+                            lnklst[jau[ii]] = nxtlst;
+                            oldlst = jau[ii];
+                            curlev[jau[ii]] = newlev;
+                        }
+                        ii++;
+                    }
+                    else if (jau[ii] == nxtlst)
                     {
-                        lnklst[oldlst]  = jau[ii];
-                        lnklst[jau[ii]] = nxtlst;
-                        oldlst = jau[ii];
-                        curlev[jau[ii]] = newlev;
+                        magma_int_t newlev;
+                        oldlst = nxtlst;
+                        nxtlst = lnklst[oldlst];
+                        newlev = curlev[row] + levels[ii] + 1;
+                        curlev[jau[ii]] = min( curlev[jau[ii]], newlev );
+                        ii++;
+                    }
+                    else /* (jau[ii] > nxtlst) */
+                    {
+                        oldlst = nxtlst;
+                        nxtlst = lnklst[oldlst];
                     }
-                    ii++;
                 }
-                else if (jau[ii] == nxtlst)
-                {
-                    magma_int_t newlev;
-                    oldlst = nxtlst;
-                    nxtlst = lnklst[oldlst];
-                    newlev = curlev[row] + levels[ii] + 1;
-                    curlev[jau[ii]] = min( curlev[jau[ii]], newlev );
-                    ii++;
+                next = lnklst[next];
+            }
+            
+            /* count the pattern of L and U */
+            
+            next = first;
+            while (next < i) {
+                knzl++;
+                next = lnklst[next];
+            }
+            if (next != i)
+            {
+                printf("ILU structurally singular.\n");
+            }
+            while (next < n) {
+                knzu++;
+                next = lnklst[next];
+            }
+            
+            /* make room in the current block */
+            
+            size_t need = knzl + 2*knzu;
+            if ( used + need > capacity ) {
+                size_t size = max( blocksize, need );
+                block = NULL;
+                if ( num_blocks == max_blocks ) {
+                    magma_index_t **tmp = NULL;
+                    max_blocks = 2*max_blocks + 8;
+                    if ( magma_malloc_cpu( (void**) &tmp, max_blocks*sizeof(magma_index_t*) ) == MAGMA_SUCCESS ) {
+                        for (magma_int_t k=0; k<num_blocks; k++)
+                            tmp[k] = blocks[k];
+                        magma_free_cpu( blocks );
+                        blocks = tmp;
+                    } else {
+                        max_blocks = num_blocks;
+                        myfail = 1;
+                    }
                 }
-                else /* (jau[ii] > nxtlst) */
-                {
-                    oldlst = nxtlst;
-                    nxtlst = lnklst[oldlst];
+                if ( ! myfail &&
+                     magma_index_malloc_cpu( &block, size ) == MAGMA_SUCCESS ) {
+                    blocks[num_blocks++] = block;
+                    used = 0;
+                    capacity = size;
+                } else {
+                    myfail = 1;
                 }
             }
-            next = lnklst[next];
-        }
-        
-        /* gather the pattern magma_int_to L and U */
-       // printf("check line5 %d\n", i);
-        next = first;
-        while (next < i)
-        {
-            if (knzl >= *nzl) {
-                printf("ILU: STORAGE parameter value %d<%d too small.\n", int(*nzl), int(knzl));
-                printf("Increase STORAGE parameter.\n");
-                info = -1;
-                goto cleanup;
+            
+            /* gather the pattern into L and U */
+            
+            if ( myfail ) {
+                rows->rowbuf[i] = NULL;
+                knzl = 0;
+                knzu = 0;
+            } else {
+                magma_index_t *buf = block + used;
+                magma_index_t *levels = buf + knzl + knzu;
+                magma_int_t k = 0;
+                rows->rowbuf[i] = buf;
+                used += need;
+                next = first;
+                while (next < n) {
+                    if ( next >= i ) {
+                        levels[k-knzl] = curlev[next];
+                    }
+                    buf[k++] = next;
+                    next = lnklst[next];
+                }
             }
-            jal[knzl++] = next;
-            next = lnklst[next];
-        }
-        ial[i+1] = knzl;
-        //  printf("check line6 %d\n", i);
-        if (next != i)
-        {
-            printf("ILU structurally singular.\n");
-            /*
-                assert(knzu < *nzu);
-                levels[knzu] = 2*n;
-                jau[knzu++] = i;
-            */
+            rows->nl[i] = knzl;
+            rows->nu[i] = knzu;
+            #pragma omp flush
+            #pragma omp atomic write
+            ready[i] = 1;
         }
-        //  printf("check line7 %d\n", i);
-        //                 printf("next:%d  n:%d \n", next, n);
-        while (next < n)
-        {
-            if (knzu >= *nzu) {
-                printf("ILU: STORAGE parameter value %d < %d too small.\n", int(*nzu), int(knzu));
-                printf("Increase STORAGE parameter.\n");
-                info = -1;
-                goto cleanup;
-            }
-            // printf("1 knzu:%d  next:%d \n", knzu, next );
-            levels[knzu] = curlev[next];
-            //  printf("2 knzu:%d  next:%d \n", knzu, next );
-            jau[knzu++] = next;
-            //  printf("3 knzu:%d  next:%d \n", knzu, next );
-            next = lnklst[next];
-            //  printf("4 next:%d  n:%d \n", next, n);
+        
+        rows->num_blocks[tid] = num_blocks;
+        rows->blocks[tid] = blocks;
+        if ( myfail ) {
+            #pragma omp atomic write
+            failed = 1;
         }
-        iau[i+1] = knzu;
+        magma_free_cpu( lnklst );
+        magma_free_cpu( curlev );
+        magma_free_cpu( iwork );
+        magma_free_cpu( sortwork );
+    }
+    
+    if ( failed ) {
+        info = MAGMA_ERR_HOST_ALLOC;
+        goto cleanup;
+    }
+    
+    for (magma_int_t i=0; i<n; i++) {
+        rows->nnzl += rows->nl[i];
+        rows->nnzu += rows->nu[i];
     }
+    
+cleanup:
+    if ( info != 0 ) {
+        magma_ssymbolic_ilu_free( rows );
+    }
+    magma_free_cpu( ready );
+    return info;
+}
+
 
-    *nzl = knzl;
-    *nzu = knzu;
+/*
+// copies the row patterns into the CSR structure of L and U
+*/
+static void
+magma_ssymbolic_ilu_gather(
+    const magma_ssymbilu_rows *rows,
+    mwIndex *ial,
+    mwIndex *jal,              /* output lower factor structure */
+    mwIndex *iau,
+    mwIndex *jau)              /* output upper factor structure */
+{
+    magma_int_t n = rows->num_rows;
+    
+    ial[0] = 0;
+    iau[0] = 0;
+    for (magma_int_t i=0; i<n; i++) {
+        ial[i+1] = ial[i] + rows->nl[i];
+        iau[i+1] = iau[i] + rows->nu[i];
+    }
+    
+    #pragma omp parallel for schedule(dynamic,64)
+    for (magma_int_t i=0; i<n; i++) {
+        const magma_index_t *buf = rows->rowbuf[i];
+        for (magma_int_t k=0; k<rows->nl[i]; k++)
+            jal[ial[i]+k] = buf[k];
+        buf += rows->nl[i];
+        for (magma_int_t k=0; k<rows->nu[i]; k++)
+            jau[iau[i]+k] = buf[k];
+    }
+}
+
+
+/*
+// symbolic level ILU
+// factors magma_int_to separate upper and lower parts
+// sorts the entries in each row of A by index
+// assumes no zero rows
+*/
 
-    // printf("ende\n");
+extern "C"
+magma_int_t
+magma_ssymbolic_ilu(
+    const magma_int_t levfill,                 /* level of fill */
+    const magma_int_t n,                       /* order of matrix */
+    magma_int_t *nzl,                          /* input-output */
+    magma_int_t *nzu,                          /* input-output */
+    const mwIndex *ia,
+    const mwIndex *ja,    /* input */
+    mwIndex *ial,
+    mwIndex *jal,              /* output lower factor structure */
+    mwIndex *iau,
+    mwIndex *jau)              /* output upper factor structure */
+{
+    magma_int_t info = 0;
+    
+    magma_ssymbilu_rows rows = { 0 };
+    
+    CHECK( magma_ssymbolic_ilu_rows( levfill, n, ia, ja, &rows ));
+    
+    if (rows.nnzl > *nzl) {
+        printf("ILU: STORAGE parameter value %d<%d too small.\n", int(*nzl), int(rows.nnzl));
+        printf("Increase STORAGE parameter.\n");
+        info = -1;
+        goto cleanup;
+    }
+    if (rows.nnzu > *nzu) {
+        printf("ILU: STORAGE parameter value %d < %d too small.\n", int(*nzu), int(rows.nnzu));
+        printf("Increase STORAGE parameter.\n");
+        info = -1;
+        goto cleanup;
+    }
+    magma_ssymbolic_ilu_gather( &rows, ial, jal, iau, jau );
+    
+    *nzl = rows.nnzl;
+    *nzu = rows.nnzu;
 
 #if 0
     printf( "Actual nnz for ILU: %d\n", *nzl + *nzu );
 #endif
 
 cleanup:
-    magma_free_cpu(lnklst);
-    magma_free_cpu(curlev);
-    magma_free_cpu(levels);
-    magma_free_cpu(iwork);
+    magma_ssymbolic_ilu_free( &rows );
     
     return info;
 }
@@ -264,11 +513,6 @@ void magma_smexFunction(magma_int_t nlhs, magma_int_t n, float omega,
     magma_ssymbolic_ilu(levfill, n, &nzl, &nzu, ia, ja, ial, jal, iau, jau);
 }
 
-/* shell sort
-// stable, so it is fast if already sorted
-// sorts x[0:n-1] in place, ascending order.
-*/
-
 
 
 /**
@@ -319,6 +563,7 @@ magma_ssymbilu(
     
     magma_s_matrix A_copy={Magma_CSR}, B={Magma_CSR};
     magma_s_matrix hA={Magma_CSR}, CSRCOOA={Magma_CSR};
+    magma_ssymbilu_rows rows = { 0 };
     
     // make sure the target structure is empty
     magma_smfree( L, queue );
@@ -334,28 +579,35 @@ magma_ssymbilu(
         CHECK( magma_smconvert( B, L, Magma_CSR, Magma_CSR , queue));
         CHECK( magma_smconvert( B, U, Magma_CSR, Magma_CSR, queue ));
 
-        magma_int_t num_lnnz = (levels > 0 ) ? B.nnz/2*(2*levels+50) : B.nnz;
-        magma_int_t num_unnz = (levels > 0 ) ? B.nnz/2*(2*levels+50) : B.nnz;
-
+        // the patterns are computed first, so L and U are allocated exactly
+        CHECK( magma_ssymbolic_ilu_rows( levels, A->num_rows, B.row, B.col, &rows ));
+        
         magma_free_cpu( L->col );
         magma_free_cpu( U->col );
-        CHECK( magma_index_malloc_cpu( &L->col, num_lnnz ));
-        CHECK( magma_index_malloc_cpu( &U->col, num_unnz ));
-
-        magma_ssymbolic_ilu( levels, A->num_rows, &num_lnnz, &num_unnz, B.row, B.col,
-                                            L->row, L->col, U->row, U->col );
-        L->nnz = num_lnnz;
-        U->nnz = num_unnz;
         magma_free_cpu( L->val );
         magma_free_cpu( U->val );
+        L->col = NULL;
+        U->col = NULL;
+        L->val = NULL;
+        U->val = NULL;
+        L->nnz = rows.nnzl;
+        U->nnz = rows.nnzu;
+        CHECK( magma_index_malloc_cpu( &L->col, L->nnz ));
+        CHECK( magma_index_malloc_cpu( &U->col, U->nnz ));
         CHECK( magma_smalloc_cpu( &L->val, L->nnz ));
         CHECK( magma_smalloc_cpu( &U->val, U->nnz ));
+        magma_ssymbolic_ilu_gather( &rows, L->row, L->col, U->row, U->col );
+        magma_ssymbolic_ilu_free( &rows );
+        
+        #pragma omp parallel for
         for( magma_int_t i=0; i<L->nnz; i++ )
             L->val[i] = MAGMA_S_MAKE( 0.0, 0.0 );
 
+        #pragma omp parallel for
         for( magma_int_t i=0; i<U->nnz; i++ )
             U->val[i] = MAGMA_S_MAKE( 0.0, 0.0 );
         // take the original values (scaled) as initial guess for L
+        #pragma omp parallel for
         for(magma_int_t i=0; i<L->num_rows; i++){
             for(magma_int_t j=B.row[i]; j<B.row[i+1]; j++){
                 magma_index_t lcol = B.col[j];
@@ -368,6 +620,7 @@ magma_ssymbilu(
         }
 
         // take the original values (scaled) as initial guess for U
+        #pragma omp parallel for
         for(magma_int_t i=0; i<U->num_rows; i++){
             for(magma_int_t j=B.row[i]; j<B.row[i+1]; j++){
                 magma_index_t lcol = B.col[j];
@@ -386,9 +639,13 @@ magma_ssymbilu(
         CHECK( magma_smalloc_cpu( &A->val, L->nnz+U->nnz ));
         A->nnz = L->nnz+U->nnz;
         
-        magma_int_t z = 0;
+        A->row[0] = 0;
+        for(magma_int_t i=0; i<A->num_rows; i++){
+            A->row[i+1] = A->row[i] + (L->row[i+1]-L->row[i]) + (U->row[i+1]-U->row[i]);
+        }
+        #pragma omp parallel for
         for(magma_int_t i=0; i<A->num_rows; i++){
-            A->row[i] = z;
+            magma_int_t z = A->row[i];
             for(magma_int_t j=L->row[i]; j<L->row[i+1]; j++){
                 A->col[z] = L->col[j];
                 A->val[z] = L->val[j];
@@ -400,8 +657,8 @@ magma_ssymbilu(
                 z++;
             }
         }
-        A->row[A->num_rows] = z;
         // reset the values of A to the original entries
+        #pragma omp parallel for
         for(magma_int_t i=0; i<A->num_rows; i++){
             for(magma_int_t j=A_copy.row[i]; j<A_copy.row[i+1]; j++){
                 magma_index_t lcol = A_copy.col[j];
@@ -436,5 +693,6 @@ cleanup:
     magma_smfree( &B, queue );
     magma_smfree( &hA, queue );
     magma_smfree( &CSRCOOA, queue );
+    magma_ssymbolic_ilu_free( &rows );
     return info;
 }
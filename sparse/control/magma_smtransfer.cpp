@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zmtransfer.cpp, normal z -> s, Sat Mar 27 20:32:44 2021
+       @generated from sparse/control/magma_zmtransfer.cpp, normal z -> s, Fri Oct 16 19:29:27 2026
        @author Hartwig Anzt
 */
 #include "magmasparse_internal.h"
@@ -251,7 +251,27 @@ magma_smtransfer(
             magma_index_setvector( A.num_rows * rowlength, A.col, 1, B->dcol, 1, queue );
             magma_index_setvector( A.num_rows, A.row, 1, B->drow, 1, queue );
         }
+        //STENCIL-type
+        else if ( A.storage_type == Magma_STENCIL ) {
+            // the matrix-free operator is only applied by the host SpMV
+            printf("error: matrix-free stencil operators are only supported on the CPU.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+            goto cleanup;
+        }
+        //VBCSR-type
+        else if ( A.storage_type == Magma_VBCSR ) {
+            // there are no device kernels for variable block sizes
+            printf("error: VBCSR is only supported on the CPU.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+            goto cleanup;
+        }
         //SELLP-type
+        else if ( A.storage_type == Magma_SELLP && A.sellp_perm != NULL ) {
+            // the device kernels do not apply the SELL-C-sigma row sorting
+            printf("error: SELL-C-sigma with sorted rows is only supported on the CPU.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+            goto cleanup;
+        }
         else if ( A.storage_type == Magma_SELLP ) {
             // fill in information for B
             B->storage_type = A.storage_type;
@@ -566,6 +586,55 @@ magma_smtransfer(
                 B->row[i] = A.row[i];
             }
         }
+        //STENCIL-type
+        else if ( A.storage_type == Magma_STENCIL ) {
+            // fill in information for B, there is no data
+            B->storage_type = A.storage_type;
+            B->memory_location = Magma_CPU;
+            B->fill_mode = A.fill_mode;
+            B->num_rows = A.num_rows;
+            B->num_cols = A.num_cols;
+            B->nnz = A.nnz; B->true_nnz = A.true_nnz;
+            B->max_nnz_row = A.max_nnz_row;
+            B->diameter = A.diameter;
+            B->stencil_points = A.stencil_points;
+            B->stencil_grid = A.stencil_grid;
+        }
+        //VBCSR-type
+        else if ( A.storage_type == Magma_VBCSR ) {
+            // fill in information for B
+            B->storage_type = A.storage_type;
+            B->memory_location = Magma_CPU;
+            B->fill_mode = A.fill_mode;
+            B->num_rows = A.num_rows;
+            B->num_cols = A.num_cols;
+            B->nnz = A.nnz; B->true_nnz = A.true_nnz;
+            B->max_nnz_row = A.max_nnz_row;
+            B->diameter = A.diameter;
+            B->blocksize = A.blocksize;
+            B->numblocks = A.numblocks;
+            magma_int_t nnzb = A.row[ A.numblocks ];
+            // memory allocation
+            CHECK( magma_smalloc_cpu( &B->val, A.nnz ));
+            CHECK( magma_index_malloc_cpu( &B->row, A.numblocks+1 ));
+            CHECK( magma_index_malloc_cpu( &B->blockinfo, A.numblocks+1 ));
+            CHECK( magma_index_malloc_cpu( &B->col, nnzb ));
+            CHECK( magma_index_malloc_cpu( &B->vbcsr_valptr, nnzb+1 ));
+            // data transfer
+            #pragma omp parallel for
+            for( magma_int_t i=0; i<A.nnz; i++ ) {
+                B->val[i] = A.val[i];
+            }
+            for( magma_int_t i=0; i<A.numblocks+1; i++ ) {
+                B->row[i] = A.row[i];
+                B->blockinfo[i] = A.blockinfo[i];
+            }
+            for( magma_int_t i=0; i<nnzb; i++ ) {
+                B->col[i] = A.col[i];
+                B->vbcsr_valptr[i] = A.vbcsr_valptr[i];
+            }
+            B->vbcsr_valptr[ nnzb ] = A.vbcsr_valptr[ nnzb ];
+        }
         //SELLP-type
         else if (  A.storage_type == Magma_SELLP ) {
             // fill in information for B
@@ -582,10 +651,15 @@ magma_smtransfer(
             B->blocksize = A.blocksize;
             B->alignment = A.alignment;
             B->numblocks = A.numblocks;
+            B->sellp_sigma = A.sellp_sigma;
+            B->sellp_perm = NULL;
             // memory allocation
             CHECK( magma_smalloc_cpu( &B->val, A.nnz ));
             CHECK( magma_index_malloc_cpu( &B->col, A.nnz ));
             CHECK( magma_index_malloc_cpu( &B->row, A.numblocks + 1 ));
+            if ( A.sellp_perm != NULL ) {
+                CHECK( magma_index_malloc_cpu( &B->sellp_perm, A.num_rows ));
+            }
             // data transfer
             #pragma omp parallel for
             for( magma_int_t i=0; i<A.nnz; i++ ) {
@@ -596,6 +670,12 @@ magma_smtransfer(
             for( magma_int_t i=0; i<A.numblocks+1; i++ ) {
                 B->row[i] = A.row[i];
             }
+            if ( A.sellp_perm != NULL ) {
+                #pragma omp parallel for
+                for( magma_int_t i=0; i<A.num_rows; i++ ) {
+                    B->sellp_perm[i] = A.sellp_perm[i];
+                }
+            }
         }
         //CSR5-type
         else if ( A.storage_type == Magma_CSR5 ) {
@@ -906,6 +986,8 @@ magma_smtransfer(
             B->blocksize = A.blocksize;
             B->numblocks = A.numblocks;
             B->alignment = A.alignment;
+            B->sellp_sigma = 1;
+            B->sellp_perm = NULL;
             // memory allocation
             CHECK( magma_smalloc_cpu( &B->val, A.nnz ));
             CHECK( magma_index_malloc_cpu( &B->col, A.nnz ));
@@ -5,14 +5,16 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zmtranspose.cpp, normal z -> s, Sat Mar 27 20:32:43 2021
+       @generated from sparse/control/magma_zmtranspose.cpp, normal z -> s, Sat Oct 17 00:26:40 2026
        @author Hartwig Anzt
        @author Mark Gates
 
 */
 #include "magmasparse_internal.h"
 
+#if ! defined(HAVE_HOST)
 #include <cuda.h>  // for CUDA_VERSION
+#endif
 
 /* For hipSPARSE, they use a separate real type than for hipBLAS */
 #ifdef HAVE_HIP
@@ -274,9 +276,11 @@ magma_s_cucsrtranspose(
     // for symmetric matrices: convert to csc using cusparse
     
     magma_int_t info = 0;
+    #if ! defined(HAVE_HOST)
     cusparseHandle_t handle=NULL;
     cusparseMatDescr_t descrA=NULL;
     cusparseMatDescr_t descrB=NULL;
+    #endif
     
     
     magma_s_matrix ACSR={Magma_CSR}, BCSR={Magma_CSR};
@@ -285,6 +289,14 @@ magma_s_cucsrtranspose(
     // make sure the target structure is empty
     magma_smfree( B, queue );
 
+    #if defined(HAVE_HOST)
+    // the host backend has no cuSPARSE; transpose a CPU copy instead
+    if( A.storage_type == Magma_CSR && A.memory_location == Magma_DEV ) {
+        CHECK( magma_smtransfer( A, &ACSR, Magma_DEV, Magma_CPU, queue ));
+        CHECK( magma_smtranspose_cpu( ACSR, &BCSR, queue ));
+        CHECK( magma_smtransfer( BCSR, B, Magma_CPU, Magma_DEV, queue ));
+    }
+    #else
     if( A.storage_type == Magma_CSR && A.memory_location == Magma_DEV ) {
         // fill in information for B
         B->storage_type    = A.storage_type;
@@ -327,7 +339,9 @@ magma_s_cucsrtranspose(
                           (float*)A.dval, A.drow, A.dcol, (float*)B->dval, B->dcol, B->drow,
                           CUSPARSE_ACTION_NUMERIC,
                           CUSPARSE_INDEX_BASE_ZERO);
-    } else if ( A.storage_type == Magma_CSR && A.memory_location == Magma_CPU ){
+    }
+    #endif
+    else if ( A.storage_type == Magma_CSR && A.memory_location == Magma_CPU ){
         CHECK( magma_smtransfer( A, &dA, A.memory_location, Magma_DEV, queue ));
         CHECK( magma_s_cucsrtranspose( dA, &dB, queue ));
         CHECK( magma_smtransfer( dB, B, Magma_DEV, A.memory_location, queue ));
@@ -337,9 +351,11 @@ magma_s_cucsrtranspose(
         CHECK( magma_smconvert( BCSR, B, Magma_CSR, A.storage_type, queue ));
     }
 cleanup:
+    #if ! defined(HAVE_HOST)
     cusparseDestroyMatDescr( descrA );
     cusparseDestroyMatDescr( descrB );
     cusparseDestroy( handle );
+    #endif
     magma_smfree( &dA, queue );
     magma_smfree( &dB, queue );
     magma_smfree( &ACSR, queue );
@@ -385,9 +401,11 @@ magma_smtransposeconjugate(
     // for symmetric matrices: convert to csc using cusparse
     
     magma_int_t info = 0;
+    #if ! defined(HAVE_HOST)
     cusparseHandle_t handle=NULL;
     cusparseMatDescr_t descrA=NULL;
     cusparseMatDescr_t descrB=NULL;
+    #endif
     
     magma_s_matrix ACSR={Magma_CSR}, BCSR={Magma_CSR};
     magma_s_matrix dA={Magma_CSR}, dB={Magma_CSR};
@@ -395,6 +413,17 @@ magma_smtransposeconjugate(
     // make sure the target structure is empty
     magma_smfree( B, queue );
 
+    #if defined(HAVE_HOST)
+    // the host backend has no cuSPARSE; transpose and conjugate a CPU copy
+    if( A.storage_type == Magma_CSR ) {
+        CHECK( magma_smtransfer( A, &ACSR, A.memory_location, Magma_CPU, queue ));
+        CHECK( magma_smtranspose_cpu( ACSR, &BCSR, queue ));
+        for( magma_int_t k=0; k < BCSR.nnz; k++ ) {
+            BCSR.val[k] = MAGMA_S_CONJ( BCSR.val[k] );
+        }
+        CHECK( magma_smtransfer( BCSR, B, Magma_CPU, A.memory_location, queue ));
+    }
+    #else
     if( A.storage_type == Magma_CSR && A.memory_location == Magma_DEV ) {
         // fill in information for B
         B->storage_type    = A.storage_type;
@@ -436,7 +465,9 @@ magma_smtransposeconjugate(
                           CUSPARSE_ACTION_NUMERIC,
                           CUSPARSE_INDEX_BASE_ZERO);
         CHECK( magma_smconjugate( B, queue ));
-    } else if ( A.memory_location == Magma_CPU ){
+    }
+    #endif
+    else if ( A.memory_location == Magma_CPU ){
         CHECK( magma_smtransfer( A, &dA, A.memory_location, Magma_DEV, queue ));
         CHECK( magma_smtransposeconjugate( dA, &dB, queue ));
         CHECK( magma_smtransfer( dB, B, Magma_DEV, A.memory_location, queue ));
@@ -446,9 +477,11 @@ magma_smtransposeconjugate(
         CHECK( magma_smconvert( BCSR, B, Magma_CSR, A.storage_type, queue ));
     }
 cleanup:
+    #if ! defined(HAVE_HOST)
     cusparseDestroyMatDescr( descrA );
     cusparseDestroyMatDescr( descrB );
     cusparseDestroy( handle );
+    #endif
     magma_smfree( &dA, queue );
     magma_smfree( &dB, queue );
     magma_smfree( &ACSR, queue );
@@ -0,0 +1,550 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/control/magma_zmtune.cpp, normal z -> s, Fri Oct 16 19:15:56 2026
+*/
+#include <algorithm>
+#include <functional>
+
+#include "magmasparse_internal.h"
+
+// padding (stored / true nonzeros) accepted for SELL-P and ELL
+#define MAGMA_TUNE_MAX_FILL 1.2
+
+// candidates with more padding are not benchmarked
+#define MAGMA_TUNE_MAX_BENCH_FILL 2.0
+
+// on the host, SELL-P only pays off for short rows, CSR vectorizes long rows
+#define MAGMA_TUNE_HOST_MAX_MEAN 32.0
+
+// on the device, ELL is used if the rows are that uniform
+#define MAGMA_TUNE_ELL_FILL 1.05
+
+// on the device, CSR5 is used if the longest row exceeds the mean that much
+#define MAGMA_TUNE_CSR5_RATIO 16.0
+
+// number of matrices whose choice is kept, and of timed SpMVs per candidate
+#define MAGMA_TUNE_CACHE_SIZE 32
+#define MAGMA_TUNE_REPS 10
+
+#define MAGMA_TUNE_MAX_CANDIDATES 16
+
+
+// one format choice: storage format and SELL-P parameters
+typedef struct {
+    magma_storage_t format;
+    magma_int_t     blocksize;
+    magma_int_t     alignment;
+    magma_int_t     sigma;
+} magma_smtune_choice;
+
+typedef struct {
+    unsigned long long  key;
+    magma_int_t         num_rows;
+    magma_int_t         num_cols;
+    magma_int_t         nnz;
+    magma_location_t    location;
+    magma_tune_t        mode;
+    magma_smtune_choice choice;
+} magma_smtune_entry;
+
+// choices of the last tuned matrices, replaced round robin
+static magma_smtune_entry magma_smtune_cache[ MAGMA_TUNE_CACHE_SIZE ];
+static magma_int_t magma_smtune_cache_num = 0;
+static magma_int_t magma_smtune_cache_next = 0;
+
+
+/*
+    Row length statistics of a CSR matrix: mean, variance and maximum.
+*/
+static void
+magma_smtune_stats(
+    magma_s_matrix A,
+    float *mean,
+    float *var,
+    magma_int_t *maxrow )
+{
+    magma_int_t n = A.num_rows;
+    float sum2 = 0.0;
+    magma_int_t mx = 0;
+
+    *mean = (float) A.row[n] / max( n, (magma_int_t) 1 );
+    float mu = *mean;
+    #pragma omp parallel for schedule(static) reduction(+:sum2) reduction(max:mx)
+    for( magma_int_t i=0; i < n; i++ ) {
+        magma_int_t len = A.row[i+1] - A.row[i];
+        sum2 += (len - mu) * (len - mu);
+        mx = max( mx, len );
+    }
+    *var = sum2 / max( n, (magma_int_t) 1 );
+    *maxrow = mx;
+}
+
+
+/*
+    Ratio of the entries stored by SELL-C-sigma with the given slice size,
+    alignment and sorting window, and the nonzeros of A. The row lengths are
+    sorted within each window the same way as in magma_smconvert.
+    len is a workspace of A.num_rows entries.
+*/
+static float
+magma_smtune_fill(
+    magma_s_matrix A,
+    magma_int_t C,
+    magma_int_t alignment,
+    magma_int_t sigma,
+    magma_index_t *len )
+{
+    magma_int_t n = A.num_rows;
+    float stored = 0.0;
+
+    sigma = ( sigma > 1 ) ? magma_roundup( sigma, C ) : C;
+    magma_int_t windows = magma_ceildiv( n, sigma );
+    #pragma omp parallel for schedule(dynamic) reduction(+:stored)
+    for( magma_int_t w=0; w < windows; w++ ) {
+        magma_int_t start = w*sigma;
+        magma_int_t end = min( n, start+sigma );
+        for( magma_int_t i=start; i < end; i++ ) {
+            len[i] = A.row[i+1] - A.row[i];
+        }
+        if ( sigma > C ) {
+            std::sort( len+start, len+end, std::greater<magma_index_t>() );
+        }
+        for( magma_int_t s=start; s < end; s += C ) {
+            magma_index_t mx = 0;
+            for( magma_int_t i=s; i < min( end, s+C ); i++ ) {
+                mx = max( mx, len[i] );
+            }
+            stored += (float) C * magma_roundup( mx, alignment );
+        }
+    }
+    return stored / max( A.nnz, (magma_int_t) 1 );
+}
+
+
+/*
+    Fingerprint of the sparsity pattern of A: a hash over the row pointer and
+    a sample of the column indices. Each entry is mixed with its position and
+    the results are summed, such that the sum can be formed in parallel.
+*/
+static inline unsigned long long
+magma_smtune_mix( unsigned long long h )
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static unsigned long long
+magma_smtune_fingerprint( magma_s_matrix A )
+{
+    unsigned long long key = 0;
+    magma_int_t stride = max( A.nnz / 4096, (magma_int_t) 1 );
+    magma_int_t samples = A.nnz / stride;
+
+    #pragma omp parallel for schedule(static) reduction(+:key)
+    for( magma_int_t i=0; i < A.num_rows; i++ ) {
+        key += magma_smtune_mix( ((unsigned long long) i << 32) ^
+                                 (unsigned long long) A.row[i+1] );
+    }
+    for( magma_int_t k=0; k < samples; k++ ) {
+        key += magma_smtune_mix( ((unsigned long long) (k+1) << 40) ^
+                                 (unsigned long long) A.col[ k*stride ] );
+    }
+    return key;
+}
+
+
+/*
+    Candidates for the benchmark: CSR and CSR5, ELL and all SELL-P variants
+    of the target with moderate padding. The analysis choice is always
+    included.
+*/
+static magma_int_t
+magma_smtune_candidates(
+    magma_s_matrix A,
+    magma_location_t location,
+    magma_smtune_choice analysis,
+    magma_smtune_choice *cand,
+    magma_index_t *len )
+{
+    magma_int_t num = 0;
+    float mean, var;
+    magma_int_t maxrow;
+
+    magma_smtune_stats( A, &mean, &var, &maxrow );
+    cand[num].format = Magma_CSR;  cand[num].blocksize = 32;
+    cand[num].alignment = 1;       cand[num].sigma = 1;      num++;
+    cand[num].format = Magma_CSR5; cand[num].blocksize = 32;
+    cand[num].alignment = 1;       cand[num].sigma = 1;      num++;
+    if ( (float) maxrow * A.num_rows <= MAGMA_TUNE_MAX_BENCH_FILL * A.nnz ) {
+        cand[num].format = Magma_ELL;  cand[num].blocksize = 32;
+        cand[num].alignment = 1;       cand[num].sigma = 1;  num++;
+    }
+    if ( location == Magma_CPU ) {
+        magma_int_t C = max( (magma_int_t) (64 / sizeof(float)),
+                             (magma_int_t) 1 );
+        magma_int_t sigma[4] = { 1, 8*C, 64*C, 512*C };
+        for( magma_int_t k=0; k < 4; k++ ) {
+            if ( magma_smtune_fill( A, C, 1, sigma[k], len )
+                    <= MAGMA_TUNE_MAX_BENCH_FILL ) {
+                cand[num].format = Magma_SELLP;  cand[num].blocksize = C;
+                cand[num].alignment = 1;         cand[num].sigma = sigma[k];
+                num++;
+            }
+        }
+    } else {
+        magma_int_t threads[5] = { 1, 4, 8, 16, 32 };
+        for( magma_int_t k=0; k < 5; k++ ) {
+            magma_int_t T = threads[k];
+            magma_int_t C = min( (magma_int_t) 32, 256 / T );
+            if ( magma_smtune_fill( A, C, T, 1, len )
+                    <= MAGMA_TUNE_MAX_BENCH_FILL ) {
+                cand[num].format = Magma_SELLP;  cand[num].blocksize = C;
+                cand[num].alignment = T;         cand[num].sigma = 1;
+                num++;
+            }
+        }
+    }
+    bool found = false;
+    for( magma_int_t k=0; k < num; k++ ) {
+        found = found || ( cand[k].format == analysis.format &&
+                           ( analysis.format != Magma_SELLP ||
+                             ( cand[k].blocksize == analysis.blocksize &&
+                               cand[k].alignment == analysis.alignment &&
+                               cand[k].sigma == analysis.sigma )));
+    }
+    if ( ! found ) {
+        cand[num++] = analysis;
+    }
+    return num;
+}
+
+
+/*
+    Applies the choice to B: sets the format and the SELL-P parameters.
+*/
+static void
+magma_smtune_set( magma_smtune_choice choice, magma_s_matrix *B )
+{
+    B->storage_type = choice.format;
+    B->blocksize    = choice.blocksize;
+    B->alignment    = choice.alignment;
+    B->sellp_sigma  = choice.sigma;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Chooses the storage format of A for the SpMV on the given target from
+    the row length histogram, without running any SpMV. On return, the
+    storage_type, blocksize, alignment and sellp_sigma of B describe the
+    choice, no arrays are allocated; magma_smconvert( A, B, Magma_CSR,
+    B->storage_type ) then creates the matrix.
+
+    On the CPU, SELL-C-sigma with one cache line of values per slice column
+    is chosen if the rows are short and the padding stays below 20%,
+    using the smallest sorting window sigma in { 1, 8C, 64C, 512C } that
+    achieves this; otherwise CSR, whose host kernel balances the nonzeros
+    over the threads. On the device, the kernels do not apply a row
+    permutation, so sigma is 1. Uniform rows use ELL, moderately varying
+    rows SELL-P with a number of threads per row (alignment) matching the
+    mean row length, very irregular rows CSR5, and CSR otherwise.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                input matrix in CSR on the CPU
+
+    @param[in]
+    location    magma_location_t
+                target of the SpMV: Magma_CPU or Magma_DEV
+
+    @param[out]
+    B           magma_s_matrix*
+                receives the chosen format and parameters
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_smtune_analyze(
+    magma_s_matrix A,
+    magma_location_t location,
+    magma_s_matrix *B,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_index_t *len = NULL;
+    magma_smtune_choice choice = { Magma_CSR, 32, 1, 1 };
+    float mean, var;
+    magma_int_t maxrow;
+
+    if ( A.memory_location != Magma_CPU || A.storage_type != Magma_CSR ) {
+        printf("error: format analysis requires a CSR matrix on the CPU.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+    CHECK( magma_index_malloc_cpu( &len, max( A.num_rows, (magma_int_t) 1 ) ));
+    magma_smtune_stats( A, &mean, &var, &maxrow );
+
+    if ( location == Magma_CPU ) {
+        magma_int_t C = max( (magma_int_t) (64 / sizeof(float)),
+                             (magma_int_t) 1 );
+        magma_int_t sigma[4] = { 1, 8*C, 64*C, 512*C };
+        if ( mean <= MAGMA_TUNE_HOST_MAX_MEAN ) {
+            for( magma_int_t k=0; k < 4; k++ ) {
+                if ( magma_smtune_fill( A, C, 1, sigma[k], len )
+                        <= MAGMA_TUNE_MAX_FILL ) {
+                    choice.format = Magma_SELLP;
+                    choice.blocksize = C;
+                    choice.sigma = sigma[k];
+                    break;
+                }
+            }
+        }
+    } else {
+        // threads per row (1, 4, 8, 16 or 32): each handles at least 4 entries
+        magma_int_t T = 1;
+        for( magma_int_t next = 4; next <= 32 && 4*next <= mean; next *= 2 ) {
+            T = next;
+        }
+        magma_int_t C = min( (magma_int_t) 32, 256 / T );
+        if ( (float) maxrow * A.num_rows <= MAGMA_TUNE_ELL_FILL * A.nnz ) {
+            choice.format = Magma_ELL;
+        }
+        else if ( magma_smtune_fill( A, C, T, 1, len ) <= MAGMA_TUNE_MAX_FILL ) {
+            choice.format = Magma_SELLP;
+            choice.blocksize = C;
+            choice.alignment = T;
+        }
+        else if ( maxrow > MAGMA_TUNE_CSR5_RATIO * mean ) {
+            choice.format = Magma_CSR5;
+        }
+    }
+    magma_smtune_set( choice, B );
+
+cleanup:
+    magma_free_cpu( len );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Chooses the storage format of A for the SpMV on the given target by
+    measuring the candidates: CSR, CSR5, ELL and the SELL-P variants of
+    the target (on the CPU with the sorting windows of
+    magma_smtune_analyze, on the device with 1 to 32 threads per row)
+    whose padding is at most 2, plus the choice of the analysis. Every
+    candidate is converted, moved to the target and timed over a number of
+    SpMVs; the fastest one is returned in B like in magma_smtune_analyze.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                input matrix in CSR on the CPU
+
+    @param[in]
+    location    magma_location_t
+                target of the SpMV: Magma_CPU or Magma_DEV
+
+    @param[out]
+    B           magma_s_matrix*
+                receives the chosen format and parameters
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_smtune_benchmark(
+    magma_s_matrix A,
+    magma_location_t location,
+    magma_s_matrix *B,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_index_t *len = NULL;
+    magma_smtune_choice cand[ MAGMA_TUNE_MAX_CANDIDATES ], best;
+    magma_s_matrix hC={Magma_CSR}, dC={Magma_CSR}, x={Magma_CSR}, y={Magma_CSR};
+    magma_int_t num;
+    real_Double_t start, end, best_time = -1.0;
+
+    CHECK( magma_smtune_analyze( A, location, B, queue ));
+    best.format = B->storage_type;
+    best.blocksize = B->blocksize;
+    best.alignment = B->alignment;
+    best.sigma = B->sellp_sigma;
+
+    CHECK( magma_index_malloc_cpu( &len, max( A.num_rows, (magma_int_t) 1 ) ));
+    num = magma_smtune_candidates( A, location, best, cand, len );
+    CHECK( magma_svinit( &x, location, A.num_cols, 1, MAGMA_S_ONE, queue ));
+    CHECK( magma_svinit( &y, location, A.num_rows, 1, MAGMA_S_ZERO, queue ));
+
+    for( magma_int_t k=0; k < num; k++ ) {
+        // candidates the converter or the target do not support are skipped
+        magma_smtune_set( cand[k], &hC );
+        if ( magma_smconvert( A, &hC, Magma_CSR, cand[k].format, queue ) != 0 ||
+             magma_smtransfer( hC, &dC, Magma_CPU, location, queue ) != 0 ||
+             magma_s_spmv( MAGMA_S_ONE, dC, x, MAGMA_S_ZERO, y, queue ) != 0 ) {
+            magma_smfree( &hC, queue );
+            magma_smfree( &dC, queue );
+            continue;
+        }
+        start = ( location == Magma_CPU ) ? magma_wtime() : magma_sync_wtime( queue );
+        for( magma_int_t r=0; r < MAGMA_TUNE_REPS; r++ ) {
+            magma_s_spmv( MAGMA_S_ONE, dC, x, MAGMA_S_ZERO, y, queue );
+        }
+        end = ( location == Magma_CPU ) ? magma_wtime() : magma_sync_wtime( queue );
+        if ( best_time < 0.0 || end-start < best_time ) {
+            best_time = end-start;
+            best = cand[k];
+        }
+        magma_smfree( &hC, queue );
+        magma_smfree( &dC, queue );
+    }
+    magma_smtune_set( best, B );
+
+cleanup:
+    magma_free_cpu( len );
+    magma_smfree( &hC, queue );
+    magma_smfree( &dC, queue );
+    magma_smfree( &x, queue );
+    magma_smfree( &y, queue );
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+
+    Converts A to the storage format chosen for the SpMV on the given
+    target, either by magma_smtune_analyze or by magma_smtune_benchmark.
+    The choice is cached per sparsity pattern fingerprint (dimensions,
+    nonzeros and a hash over the row pointer and a sample of the column
+    indices) together with target and mode, such that repeated calls for
+    the same matrix, or for matrices with the same pattern, skip the
+    analysis and the benchmark.
+
+    B holds the converted matrix on the CPU, its storage_type, blocksize,
+    alignment and sellp_sigma record the choice. It has to be moved to the
+    target with magma_smtransfer.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                input matrix in CSR on the CPU
+
+    @param[in]
+    location    magma_location_t
+                target of the SpMV: Magma_CPU or Magma_DEV
+
+    @param[in]
+    mode        magma_tune_t
+                Magma_TUNE_ANALYZE or Magma_TUNE_BENCHMARK
+
+    @param[out]
+    B           magma_s_matrix*
+                A in the chosen format on the CPU
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_smtune(
+    magma_s_matrix A,
+    magma_location_t location,
+    magma_tune_t mode,
+    magma_s_matrix *B,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_s_matrix choice={Magma_CSR};
+    unsigned long long key;
+    bool cached = false;
+
+    if ( A.memory_location != Magma_CPU || A.storage_type != Magma_CSR ) {
+        printf("error: format tuning requires a CSR matrix on the CPU.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+    location = ( location == Magma_CPU ) ? Magma_CPU : Magma_DEV;
+    key = magma_smtune_fingerprint( A );
+
+    #pragma omp critical( magma_smtune_cache )
+    for( magma_int_t k=0; k < magma_smtune_cache_num && ! cached; k++ ) {
+        magma_smtune_entry *e = &magma_smtune_cache[k];
+        if ( e->key == key && e->num_rows == A.num_rows &&
+             e->num_cols == A.num_cols && e->nnz == A.nnz &&
+             e->location == location && e->mode == mode ) {
+            magma_smtune_set( e->choice, &choice );
+            cached = true;
+        }
+    }
+
+    if ( ! cached ) {
+        if ( mode == Magma_TUNE_BENCHMARK ) {
+            CHECK( magma_smtune_benchmark( A, location, &choice, queue ));
+        } else {
+            CHECK( magma_smtune_analyze( A, location, &choice, queue ));
+        }
+        #pragma omp critical( magma_smtune_cache )
+        {
+            magma_smtune_entry *e = &magma_smtune_cache[ magma_smtune_cache_next ];
+            e->key = key;
+            e->num_rows = A.num_rows;
+            e->num_cols = A.num_cols;
+            e->nnz = A.nnz;
+            e->location = location;
+            e->mode = mode;
+            e->choice.format = choice.storage_type;
+            e->choice.blocksize = choice.blocksize;
+            e->choice.alignment = choice.alignment;
+            e->choice.sigma = choice.sellp_sigma;
+            magma_smtune_cache_next = (magma_smtune_cache_next + 1) % MAGMA_TUNE_CACHE_SIZE;
+            if ( magma_smtune_cache_num < MAGMA_TUNE_CACHE_SIZE ) {
+                magma_smtune_cache_num++;
+            }
+        }
+    }
+
+    B->blocksize = choice.blocksize;
+    B->alignment = choice.alignment;
+    B->sellp_sigma = choice.sellp_sigma;
+    CHECK( magma_smconvert( A, B, Magma_CSR, choice.storage_type, queue ));
+    B->blocksize = choice.blocksize;
+    B->alignment = choice.alignment;
+
+cleanup:
+    return info;
+}
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zparilut_kernels.cpp, normal z -> s, Sat Mar 27 20:32:48 2021
+       @generated from sparse/control/magma_zparilut_kernels.cpp, normal z -> s, Fri Oct 16 18:02:39 2026
        @author Hartwig Anzt
 
 */
@@ -211,9 +211,65 @@ magma_sparilut_sweep_sync(
     magma_queue_t queue)
 {
     magma_int_t info = 0;
-    float *L_new_val = NULL, *U_new_val = NULL, *val_swap = NULL;
-    CHECK(magma_smalloc_cpu(&L_new_val, L->nnz));
-    CHECK(magma_smalloc_cpu(&U_new_val, U->nnz));
+    magma_s_parilut_workspace ws={0};
+    
+    info = magma_sparilut_sweep_sync_ws(A, L, U, &ws, queue);
+    
+    magma_sparilut_workspace_free(&ws, queue);
+    return info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    This function does a synchronous ParILUT sweep like 
+    magma_sparilut_sweep_sync, but computes the new values in the scratch of
+    the workspace and copies them back into L and U.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix*
+                System matrix. The format is sorted CSR.
+
+    @param[in,out]
+    L           magma_s_matrix*
+                Current approximation for the lower triangular factor
+                The format is MAGMA_CSRCOO. This is sorted CSR plus the 
+                rowindexes being stored.
+                
+    @param[in,out]
+    U           magma_s_matrix*
+                Current approximation for the lower triangular factor
+                The format is MAGMA_CSRCOO. This is sorted CSR plus the 
+                rowindexes being stored.
+
+    @param[in,out]
+    ws          magma_s_parilut_workspace*
+                Workspace providing the scratch.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+*******************************************************************************/
+
+extern "C" magma_int_t
+magma_sparilut_sweep_sync_ws(
+    magma_s_matrix *A,
+    magma_s_matrix *L,
+    magma_s_matrix *U,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue)
+{
+    magma_int_t info = 0;
+    float *L_new_val = NULL, *U_new_val = NULL;
+    CHECK(magma_sparilut_workspace_scratch(0, L->nnz+U->nnz, ws, queue));
+    L_new_val = ws->val;
+    U_new_val = ws->val + L->nnz;
     
     #pragma omp parallel for
     for (magma_int_t e=0; e<U->nnz; e++) {
@@ -314,13 +370,17 @@ magma_sparilut_sweep_sync(
 
     }// end omp parallel section
 
-    // swap old and new values
-    SWAP(L_new_val, L->val);
-    SWAP(U_new_val, U->val);
+    // copy back the new values
+    #pragma omp parallel for
+    for (magma_int_t e=0; e<L->nnz; e++) {
+        L->val[ e ] = L_new_val[ e ];
+    }
+    #pragma omp parallel for
+    for (magma_int_t e=0; e<U->nnz; e++) {
+        U->val[ e ] = U_new_val[ e ];
+    }
     
 cleanup:
-    magma_free_cpu(L_new_val);
-    magma_free_cpu(U_new_val);
     return info;
 }
 
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zparilut_tools.cpp, normal z -> s, Sat Mar 27 20:32:48 2021
+       @generated from sparse/control/magma_zparilut_tools.cpp, normal z -> s, Fri Oct 16 18:36:34 2026
        @author Hartwig Anzt
 
 */
@@ -21,6 +21,10 @@
 #define AVOID_DUPLICATES
 //#define NANCHECK
 
+// rank accuracy of the approximate thresholds, relative to the number of
+// elements to remove
+#define MAGMA_PARILUT_SELECT_TOL 0.05
+
 // this file is marked as deprecated, and will be removed in future.
 
 
@@ -157,6 +161,101 @@ cleanup:
 }
 
 
+/***************************************************************************//**
+    Purpose
+    -------
+    Removes any element with absolute value smaller equal or larger equal
+    thrs from the matrix like magma_sparilut_thrsrm, but compacts into the
+    matrix B of the workspace and swaps the arrays, such that no memory is 
+    allocated once the workspace is large enough. A has to be set up by
+    magma_smatrix_reserve, its old arrays are kept in the workspace.
+
+    Arguments
+    ---------
+    
+    @param[in]
+    order       magma_int_t
+                order == 1: all elements smaller are discarded
+                order == 0: all elements larger are discarded
+
+    @param[in,out]
+    A           magma_s_matrix*
+                Matrix where elements are removed.
+
+    @param[in]
+    thrs        float*
+                Threshold: all elements smaller are discarded
+
+    @param[in,out]
+    ws          magma_s_parilut_workspace*
+                Workspace providing the scratch.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+*******************************************************************************/
+
+extern "C" magma_int_t
+magma_sparilut_thrsrm_ws(
+    magma_int_t order,
+    magma_s_matrix *A,
+    float *thrs,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    
+    magma_s_matrix *B = &ws->B;
+    CHECK( magma_smatrix_reserve( A->num_rows, 0, B, queue ) );
+    B->num_cols = A->num_cols;
+    
+    // set col for values smaller (order == 1) or larger threshold to -1,
+    // the diagonal is always kept
+    #pragma omp parallel for
+    for( magma_int_t row=0; row<A->num_rows; row++){
+        magma_int_t el = 0;
+        for( magma_int_t i=A->row[row]; i<A->row[row+1]; i++ ){
+            float absval = MAGMA_S_ABS(A->val[i]);
+            if( ( order == 1 ) ? absval <= *thrs : absval >= *thrs ){
+                if( A->col[i]!=row ){
+                    A->col[i] = -1; // cheaper than val  
+                }
+            } else {
+                el++;    
+            }
+        }
+        B->row[row+1] = el;
+    }
+    
+    // new row pointer
+    B->row[ 0 ] = 0;
+    CHECK( magma_smatrix_createrowptr( B->num_rows, B->row, queue ) );
+    CHECK( magma_smatrix_reserve( A->num_rows, B->row[ B->num_rows ], B, queue ) );
+    
+    #pragma omp parallel for
+    for( magma_int_t row=0; row<A->num_rows; row++){
+        magma_index_t offset_new = B->row[row];
+        magma_int_t count = 0;
+        for(magma_int_t i=A->row[row]; i<A->row[row+1]; i++){
+            if( A->col[i] > -1 ){ // copy this element
+                B->col[ offset_new + count ] = A->col[i];
+                B->val[ offset_new + count ] = A->val[i];
+                B->rowidx[ offset_new + count ] = row;
+                count++;
+            }
+        }
+    }
+    
+    // finally, swap the matrices
+    CHECK( magma_smatrix_swap( B, A, queue) );
+    
+cleanup:
+    return info;
+}
+
+
 /***************************************************************************//**
     Purpose
     -------
@@ -1051,6 +1150,64 @@ cleanup:
 }
 
 
+/***************************************************************************//**
+    Purpose
+    -------
+    Copies all off-diagonal values of A into oneA like 
+    magma_sparilut_preselect, but writes into the arrays oneA already holds.
+    oneA has to be empty or set up by magma_smatrix_reserve for A->num_rows 
+    rows.
+
+    Arguments
+    ---------
+
+    @param[in]
+    order       magma_int_t
+                order==0 lower triangular
+                order==1 upper triangular
+                
+    @param[in]
+    A           magma_s_matrix*
+                Matrix where elements are removed.
+                
+    @param[in,out]
+    oneA        magma_s_matrix*
+                Off-diagonal values of A.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+*******************************************************************************/
+
+extern "C" magma_int_t
+magma_sparilut_preselect_ws(
+    magma_int_t order,
+    magma_s_matrix *A,
+    magma_s_matrix *oneA,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    
+    oneA->num_cols = A->num_cols;
+    CHECK( magma_smatrix_reserve( A->num_rows, A->nnz - A->num_rows, oneA, queue ) );
+    
+    // order == 1: don't copy the first, else don't copy the last
+    #pragma omp parallel for
+    for( magma_int_t row=0; row<A->num_rows; row++){
+        magma_int_t start = A->row[row] + ( order == 1 ? 1 : 0 );
+        magma_int_t end = A->row[row+1] - ( order == 1 ? 0 : 1 );
+        for( magma_int_t i=start; i<end; i++ ){
+            oneA->val[ i-row ] = A->val[i];
+        }
+    }
+    
+cleanup:
+    return info;
+}
+
+
 /***************************************************************************//**
     Purpose
     -------
@@ -2879,6 +3036,84 @@ magma_sparilut_candidates(
     magma_s_matrix *L_new,
     magma_s_matrix *U_new,
     magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_s_parilut_workspace ws={0};
+    
+    L_new->row = NULL;
+    L_new->rowidx = NULL;
+    L_new->col = NULL;
+    L_new->val = NULL;
+    L_new->true_nnz = 0;
+    U_new->row = NULL;
+    U_new->rowidx = NULL;
+    U_new->col = NULL;
+    U_new->val = NULL;
+    U_new->true_nnz = 0;
+    
+    info = magma_sparilut_candidates_ws(L0, U0, L, U, L_new, U_new, &ws, queue);
+    
+    magma_sparilut_workspace_free(&ws, queue);
+    return info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    This function identifies the candidates like magma_sparilut_candidates,
+    but writes into the arrays L_new and U_new already hold and takes all
+    scratch from the workspace. L_new and U_new have to be empty or set up by
+    magma_smatrix_reserve for L.num_rows rows.
+
+    Arguments
+    ---------
+
+    @param[in]
+    L0          magma_s_matrix
+                tril( ILU(0) ) pattern of original system matrix.
+                
+    @param[in]
+    U0          magma_s_matrix
+                triu( ILU(0) ) pattern of original system matrix.
+                
+    @param[in]
+    L           magma_s_matrix
+                Current lower triangular factor.
+
+    @param[in]
+    U           magma_s_matrix
+                Current upper triangular factor.
+
+    @param[in,out]
+    L_new       magma_s_matrix*
+                List of candidates for L in COO format.
+
+    @param[in,out]
+    U_new       magma_s_matrix*
+                List of candidates for U in COO format.
+
+    @param[in,out]
+    ws          magma_s_parilut_workspace*
+                Workspace providing the scratch.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+*******************************************************************************/
+
+extern "C" magma_int_t
+magma_sparilut_candidates_ws(
+    magma_s_matrix L0,
+    magma_s_matrix U0,
+    magma_s_matrix L,
+    magma_s_matrix U,
+    magma_s_matrix *L_new,
+    magma_s_matrix *U_new,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue )
 {
     magma_int_t info = 0;
     magma_index_t *insertedL;
@@ -2903,10 +3138,11 @@ magma_sparilut_candidates(
     // for now: also some part commented out. If it turns out
     // this being correct, I need to clean up the code.
 
-    CHECK( magma_index_malloc_cpu( &L_new->row, L.num_rows+1 ));
-    CHECK( magma_index_malloc_cpu( &U_new->row, U.num_rows+1 ));
-    CHECK( magma_index_malloc_cpu( &insertedL, L.num_rows+1 ));
-    CHECK( magma_index_malloc_cpu( &insertedU, U.num_rows+1 )); 
+    CHECK( magma_smatrix_reserve( L.num_rows, 0, L_new, queue ));
+    CHECK( magma_smatrix_reserve( L.num_rows, 0, U_new, queue ));
+    CHECK( magma_sparilut_workspace_scratch( 2*(L.num_rows+1), 0, ws, queue ));
+    insertedL = ws->index;
+    insertedU = ws->index + L.num_rows+1;
     
     #pragma omp parallel for
     for( magma_int_t i=0; i<L.num_rows+1; i++ ){
@@ -2915,15 +3151,8 @@ magma_sparilut_candidates(
         insertedL[i] = 0;
         insertedU[i] = 0;
     }
-    L_new->num_rows = L.num_rows;
     L_new->num_cols = L.num_cols;
-    L_new->storage_type = Magma_CSR;
-    L_new->memory_location = Magma_CPU;
-    
-    U_new->num_rows = L.num_rows;
     U_new->num_cols = L.num_cols;
-    U_new->storage_type = Magma_CSR;
-    U_new->memory_location = Magma_CPU;
     
     // go over the original matrix - this is the only way to allow elements to come back...
     if( orig == 1 ){
@@ -3100,13 +3329,8 @@ magma_sparilut_candidates(
             }
         }
     }
-    magma_smalloc_cpu( &L_new->val, L_new->nnz );
-    magma_index_malloc_cpu( &L_new->rowidx, L_new->nnz );
-    magma_index_malloc_cpu( &L_new->col, L_new->nnz );
-    
-    magma_smalloc_cpu( &U_new->val, U_new->nnz );
-    magma_index_malloc_cpu( &U_new->rowidx, U_new->nnz );
-    magma_index_malloc_cpu( &U_new->col, U_new->nnz );
+    CHECK( magma_smatrix_reserve( L.num_rows, L_new->nnz, L_new, queue ));
+    CHECK( magma_smatrix_reserve( U.num_rows, U_new->nnz, U_new, queue ));
     
     #pragma omp parallel for
     for( magma_int_t i=0; i<L_new->nnz; i++ ){
@@ -3345,15 +3569,13 @@ magma_sparilut_candidates(
 #ifdef AVOID_DUPLICATES
         // #####################################################################
         
-        CHECK( magma_sparilut_thrsrm( 1, L_new, &thrs, queue ) );
-        CHECK( magma_sparilut_thrsrm( 1, U_new, &thrs, queue ) );
+        CHECK( magma_sparilut_thrsrm_ws( 1, L_new, &thrs, ws, queue ) );
+        CHECK( magma_sparilut_thrsrm_ws( 1, U_new, &thrs, ws, queue ) );
 
         // #####################################################################
 #endif
 
 cleanup:
-    magma_free_cpu( insertedL );
-    magma_free_cpu( insertedU );
     return info;
 }
 
@@ -4579,22 +4801,12 @@ magma_sparilut_set_thrs_randomselect(
     magma_int_t info = 0;
     
     magma_int_t size =  LU->nnz;
-    const magma_int_t incx = 1;
-    // copy as we may change the elements
-    float *val=NULL;
-    CHECK( magma_smalloc_cpu( &val, size ));
     assert( size > num_rm );
-    blasf77_scopy(&size, LU->val, &incx, val, &incx );
-    if( order == 0 ){
-        magma_sselectrandom( val, size, num_rm, queue );
-        *thrs = MAGMA_S_ABS(val[num_rm]);
-    } else {
-         magma_sselectrandom( val, size, size-num_rm, queue );
-        *thrs = MAGMA_S_ABS(val[size-num_rm]);  
-    }
+    // the values are not modified, no copy needed
+    CHECK( magma_ssampleselect_cpu( LU->val, size,
+        ( order == 0 ) ? num_rm : min( size-num_rm, size-1 ), 0.0, thrs, queue ));
 
 cleanup:
-    magma_free_cpu( val );
     return info;
 }
 
@@ -4647,22 +4859,11 @@ magma_sparilut_set_thrs_L_scaled(
     magma_int_t info = 0;
     
     magma_int_t size =  L->nnz;
-    const magma_int_t incx = 1;
-    // copy as we may change the elements
-    float *val=NULL;
-    CHECK( magma_smalloc_cpu( &val, size ));
     assert( size > num_rm );
-    blasf77_scopy(&size, L->val, &incx, val, &incx );
-    if( order == 0 ){
-        magma_sselectrandom( val, size, num_rm, queue );
-        *thrs = MAGMA_S_ABS(val[num_rm]);
-    } else {
-         magma_sselectrandom( val, size, size-num_rm, queue );
-        *thrs = MAGMA_S_ABS(val[size-num_rm]);  
-    }
+    CHECK( magma_ssampleselect_cpu( L->val, size,
+        ( order == 0 ) ? num_rm : min( size-num_rm, size-1 ), 0.0, thrs, queue ));
 
 cleanup:
-    magma_free_cpu( val );
     return info;
 }
 
@@ -4753,6 +4954,9 @@ cleanup:
     Purpose
     -------
     This routine approximates the threshold for removing num_rm elements.
+    It uses the approximate mode of magma_ssampleselect_cpu, the number of
+    elements below the threshold is at most num_rm and deviates by at most
+    5% of num_rm.
 
     Arguments
     ---------
@@ -4791,70 +4995,71 @@ magma_sparilut_set_thrs_randomselect_approx(
     magma_int_t info = 0;
     
     magma_int_t size =  LU->nnz;
-    const magma_int_t incx = 1;
-    //magma_int_t incy = 1;
-    //magma_int_t nz_copy = LU->nnz;
-    magma_int_t num_threads = 1;
-    magma_int_t el_per_block;
-    //magma_int_t num_rm_loc;
-    float *dthrs;
-    float *val;
-    
-
-    if( LU->nnz <= 680){
-       CHECK( magma_sparilut_set_thrs_randomselect(
-           num_rm,
-           LU,
-           order,
-           thrs,
-           queue ) );
-    } else {
-        CHECK( magma_smalloc_cpu( &val, size ));
-        blasf77_scopy(&size, LU->val, &incx, val, &incx );
-        assert( size > num_rm );
-#ifdef _OPENMP
-    #pragma omp parallel
-    {
-        num_threads = omp_get_max_threads();
-    }
-#else
-    num_threads = 1;
-#endif
-        num_threads = 272;
-        CHECK( magma_smalloc_cpu( &dthrs, num_threads ));
-        
-        
-        el_per_block = magma_ceildiv( LU->nnz, num_threads );
-        
-        #pragma omp parallel for
-        for( magma_int_t i=0; i<num_threads; i++ ){
-            magma_int_t start = min(i*el_per_block, size);
-            magma_int_t end = min((i+1)*el_per_block,LU->nnz);
-            magma_int_t loc_nz = end-start;
-            magma_int_t loc_rm = (int) (num_rm)/num_threads;
-            if( i == num_threads-1){
-                loc_rm = (int) (loc_nz * num_rm)/size;
-            }
-            if( loc_nz > loc_rm ){
-            if( order == 0 ){
-                magma_sselectrandom( val+start, loc_nz, loc_rm, queue );
-                dthrs[i] = val[start+loc_rm];
-            } else {
-                 magma_sselectrandom( val+start, loc_nz, loc_nz-loc_rm, queue );
-                dthrs[i] = val[start+loc_nz-loc_rm];  
-            }
-        }
-            
-        }
-        
-        // compute the median
-        magma_sselectrandom( dthrs, num_threads, (num_threads+1)/2, queue);
-        
-        *thrs = MAGMA_S_ABS(dthrs[(num_threads+1)/2]);
-    }
+    assert( size > num_rm );
+    CHECK( magma_ssampleselect_cpu( LU->val, size,
+        ( order == 0 ) ? num_rm : min( size-num_rm, size-1 ),
+        MAGMA_PARILUT_SELECT_TOL * num_rm / size, thrs, queue ));
+
+cleanup:
+    return info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    This routine approximates the threshold for removing num_rm elements like
+    magma_sparilut_set_thrs_randomselect_approx. The selection works on the
+    values in place, the workspace is not used.
+
+    Arguments
+    ---------
+
+    @param[in]
+    num_rm      magma_int_t
+                Number of Elements that are replaced.
+
+    @param[in]
+    LU          magma_s_matrix*
+                Current ILU approximation.
+
+    @param[in]
+    order       magma_int_t
+                Sort goal function: 0 = smallest, 1 = largest.
+
+    @param[out]
+    thrs        float*
+                Size of the num_rm-th smallest element.
+
+    @param[in,out]
+    ws          magma_s_parilut_workspace*
+                Workspace providing the scratch.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+*******************************************************************************/
+
+extern "C" magma_int_t
+magma_sparilut_set_thrs_randomselect_approx_ws(
+    magma_int_t num_rm,
+    magma_s_matrix *LU,
+    magma_int_t order,
+    float *thrs,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    
+    magma_int_t size =  LU->nnz;
+    assert( size > num_rm );
+    CHECK( magma_ssampleselect_cpu( LU->val, size,
+        ( order == 0 ) ? num_rm : min( size-num_rm, size-1 ),
+        MAGMA_PARILUT_SELECT_TOL * num_rm / size, thrs, queue ));
+
 cleanup:
-    magma_free_cpu( val );
-    magma_free_cpu( dthrs );
     return info;
 }
 
@@ -4903,19 +5108,14 @@ magma_sparilut_set_thrs_randomselect_factors(
     
     magma_int_t size =  L->nnz+U->nnz;
     const magma_int_t incx = 1;
-    // copy as we may change the elements
+    // L and U are selected from together
     float *val=NULL;
     CHECK( magma_smalloc_cpu( &val, size ));
     assert( size > num_rm );
     blasf77_scopy(&L->nnz, L->val, &incx, val, &incx );
     blasf77_scopy(&U->nnz, U->val, &incx, val+L->nnz, &incx );
-    if( order == 0 ){
-        magma_sselectrandom( val, size, num_rm, queue );
-        *thrs = MAGMA_S_ABS(val[num_rm]);
-    } else {
-         magma_sselectrandom( val, size, size-num_rm, queue );
-        *thrs = MAGMA_S_ABS(val[size-num_rm]);  
-    }
+    CHECK( magma_ssampleselect_cpu( val, size,
+        ( order == 0 ) ? num_rm : min( size-num_rm, size-1 ), 0.0, thrs, queue ));
 
 cleanup:
     magma_free_cpu( val );
@@ -4964,67 +5164,15 @@ magma_sparilut_set_exact_thrs(
     magma_queue_t queue )
 {
     magma_int_t info = 0;
-    float element;
-    float *val=NULL;
-    const magma_int_t incy = 1;
-    const magma_int_t incx = 1;
-    magma_int_t loc_nnz;
-    float ratio;
-    magma_int_t loc_num_rm;
-    magma_int_t num_threads=1;
-    float *elements = NULL;
-
-#ifdef _OPENMP
-    #pragma omp parallel
-    {
-        num_threads = omp_get_max_threads();
-    }
-#else
-    num_threads = 1;
-#endif
-    // two options: either there are enough candidates such that we can use
-    // a parallel first step of order-statistics, or not...
-    
-    ratio = ((float)num_rm)/((float)LU->nnz);
-    loc_num_rm = (int) ((float)ratio*(float)loc_nnz);
-    loc_num_rm = num_rm;
-    CHECK( magma_smalloc_cpu( &val, loc_nnz ));
-    CHECK( magma_smalloc_cpu( &elements, num_threads ));
-    
-    blasf77_scopy(&loc_nnz, LU->val, &incx, val, &incy );
-    // first step: every thread sorts a chunk of the array
-    // extract the num_rm elements in this chunk
-    // this only works if num_rm > loc_nnz / num_threads
-    if( loc_nnz / num_threads > loc_num_rm ){
-        #pragma omp parallel
-        {
-    #ifdef _OPENMP
-    magma_int_t id = omp_get_thread_num();
-#else
-    magma_int_t id = 0;
-#endif
-            if(id<num_threads){
-                magma_sorderstatistics(
-                    val + id*loc_nnz/num_threads, loc_nnz/num_threads, loc_num_rm, order, &elements[id], queue );
-            }
-        }
-        // Now copy the num_rm left-most elements of every chunk to the beginning of the array.
-        for( magma_int_t i=1; i<num_threads; i++){
-            blasf77_scopy(&loc_num_rm, val+i*loc_nnz/num_threads, &incy, val+i*loc_num_rm, &incy );
-        }
-        // now we only look at the left num_threads*num_rm elements and use order stats
-        magma_sorderstatistics(
-                    val, num_threads*loc_num_rm, loc_num_rm, order, &element, queue );
-    } else {
-        magma_sorderstatistics(
-                    val, loc_nnz, loc_num_rm, order, &element, queue );
-    }
+    float element = 0.0;
 
-    *thrs = element;
+    assert( LU->nnz > num_rm );
+    // num_rm-th smallest or largest magnitude
+    CHECK( magma_ssampleselect_cpu( LU->val, LU->nnz,
+        ( order == 0 ) ? num_rm : LU->nnz-1-num_rm, 0.0, &element, queue ));
+    *thrs = MAGMA_S_MAKE( element, 0.0 );
 
 cleanup:
-    magma_free_cpu( val );
-    magma_free_cpu( elements );
     return info;
 }
 
@@ -5173,3 +5321,115 @@ magma_sparilut_align_residuals(
     return info;
 }
 
+
+/***************************************************************************//**
+    Purpose
+    -------
+    Makes sure the ParILUT workspace provides at least index_len entries of 
+    index scratch and val_len entries of value scratch. The scratch is only
+    reallocated if it is too small; the contents are not preserved.
+
+    Arguments
+    ---------
+
+    @param[in]
+    index_len   magma_int_t
+                Number of index entries needed.
+
+    @param[in]
+    val_len     magma_int_t
+                Number of value entries needed.
+
+    @param[in,out]
+    ws          magma_s_parilut_workspace*
+                Workspace.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+*******************************************************************************/
+
+extern "C" magma_int_t
+magma_sparilut_workspace_scratch(
+    magma_int_t index_len,
+    magma_int_t val_len,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    
+    if( index_len > ws->index_len ){
+        magma_free_cpu( ws->index );
+        ws->index = NULL;
+        ws->index_len = 0;
+        CHECK( magma_index_malloc_cpu( &ws->index, index_len ));
+        ws->index_len = index_len;
+    }
+    if( val_len > ws->val_len ){
+        magma_free_cpu( ws->val );
+        ws->val = NULL;
+        ws->val_len = 0;
+        CHECK( magma_smalloc_cpu( &ws->val, val_len ));
+        ws->val_len = val_len;
+    }
+    
+cleanup:
+    return info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    Frees all memory held by a ParILUT workspace and resets it, such that it 
+    can be set up again for a matrix of different size.
+
+    Arguments
+    ---------
+
+    @param[in,out]
+    ws          magma_s_parilut_workspace*
+                Workspace.
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+*******************************************************************************/
+
+extern "C" magma_int_t
+magma_sparilut_workspace_free(
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue )
+{
+    magma_s_matrix *M[] = { &ws->L, &ws->U, &ws->UT, &ws->hL, &ws->hU,
+        &ws->oneL, &ws->oneU, &ws->L_new, &ws->U_new, &ws->B };
+    
+    for( magma_int_t i=0; i<(magma_int_t)(sizeof(M)/sizeof(M[0])); i++ ){
+        magma_free_cpu( M[i]->row );
+        magma_free_cpu( M[i]->rowidx );
+        magma_free_cpu( M[i]->col );
+        magma_free_cpu( M[i]->val );
+        M[i]->row = NULL;
+        M[i]->rowidx = NULL;
+        M[i]->col = NULL;
+        M[i]->val = NULL;
+        M[i]->storage_type = Magma_CSR;
+        M[i]->memory_location = Magma_CPU;
+        M[i]->num_rows = 0;
+        M[i]->nnz = 0;
+        M[i]->true_nnz = 0;
+    }
+    magma_free_cpu( ws->index );
+    magma_free_cpu( ws->val );
+    ws->index = NULL;
+    ws->val = NULL;
+    ws->index_len = 0;
+    ws->val_len = 0;
+    ws->num_rows = 0;
+    
+    return MAGMA_SUCCESS;
+}
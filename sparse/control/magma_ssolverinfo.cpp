@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zsolverinfo.cpp, normal z -> s, Sat Mar 27 20:32:40 2021
+       @generated from sparse/control/magma_zsolverinfo.cpp, normal z -> s, Fri Oct 16 18:51:59 2026
        @author Hartwig Anzt
 
 */
@@ -89,6 +89,14 @@ magma_ssolverinfo(
                 printf("%%   GMRES(%lld) performance analysis every %lld iterations\n",
                         (long long) solver_par->restart, (long long) k );
                 break;
+            case Magma_CACG:
+                printf("%%   CA-CG performance analysis every %lld iterations\n",
+                        (long long) k );
+                break;
+            case Magma_PIPEGMRES:
+                printf("%%   pipelined GMRES(%lld) performance analysis every %lld iterations\n",
+                        (long long) solver_par->restart, (long long) k );
+                break;
             case Magma_IDR:
             case Magma_IDRMERGE:
                 printf("%%   IDR(%lld) performance analysis every %lld iterations\n",
@@ -256,6 +264,8 @@ magma_ssolverinfo(
             case Magma_BICGSTABMERGE2:
             case Magma_GMRES:
             case Magma_PGMRES:
+            case Magma_CACG:
+            case Magma_PIPEGMRES:
             case Magma_IDR:
             case Magma_IDRMERGE:
             case Magma_PIDR:
@@ -353,6 +363,13 @@ magma_ssolverinfo(
             printf("%% PGMRES(%lld) solver summary:\n",
                     (long long) solver_par->restart );
             break;
+        case Magma_CACG:
+            printf("%% CA-CG solver summary:\n");
+            break;
+        case Magma_PIPEGMRES:
+            printf("%% pipelined GMRES(%lld) solver summary:\n",
+                    (long long) solver_par->restart );
+            break;
         case Magma_IDR:
         case Magma_IDRMERGE:
             printf("%% IDR(%lld) solver summary:\n",
@@ -418,6 +435,9 @@ magma_ssolverinfo(
     printf("%%    preconditioner setup: %.4f sec\n", precond_par->setuptime );
     printf("%%    iterations: %4lld\n", (long long) solver_par->numiter );
     printf("%%    SpMV-count: %4lld\n", (long long) solver_par->spmv_count );
+    if ( solver_par->reduction_count > 0 ) {
+        printf("%%    reduction-count: %4lld\n", (long long) solver_par->reduction_count );
+    }
     printf("%%    exact final residual: %e\n"
            "%%    runtime: %.4f sec\n",
             solver_par->final_res, solver_par->runtime);
@@ -517,6 +537,7 @@ magma_ssolverinfo_init(
     solver_par->runtime         = 0.;
     solver_par->numiter = 0;
     solver_par->spmv_count = 0;
+    solver_par->reduction_count = 0;
     precond_par->numiter = 0;
     precond_par->spmv_count = 0;
     precond_par->runtime       = 0.;
@@ -605,6 +626,22 @@ magma_ssolverinfo_init(
     precond_par->U_dgraphindegree = NULL;
     precond_par->L_dgraphindegree_bak = NULL;
     precond_par->U_dgraphindegree_bak = NULL;
+    
+    precond_par->sptrsvL.level_ptr = NULL;
+    precond_par->sptrsvL.level_rows = NULL;
+    precond_par->sptrsvL.diag = NULL;
+    precond_par->sptrsvL.ready = NULL;
+    precond_par->sptrsvU.level_ptr = NULL;
+    precond_par->sptrsvU.level_rows = NULL;
+    precond_par->sptrsvU.diag = NULL;
+    precond_par->sptrsvU.ready = NULL;
+    
+    precond_par->refactor.num_rows = 0;
+    precond_par->refactor.nnz = 0;
+    precond_par->refactor.Amap = NULL;
+    precond_par->refactor.Lmap = NULL;
+    precond_par->refactor.Umap = NULL;
+    precond_par->refactor.UTmap = NULL;
 
 cleanup:
     if( info != 0 ){
@@ -700,6 +737,8 @@ magma_sKrylov_check( magma_solver_type solver )
         case  Magma_BICGSTABMERGE:
         case  Magma_BICGSTABMERGE2:
         case  Magma_GMRES:
+        case  Magma_CACG:
+        case  Magma_PIPEGMRES:
         case  Magma_IDR:
         case  Magma_IDRMERGE:
         case  Magma_CGS:
@@ -5,14 +5,20 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/control/magma_zsort.cpp, normal z -> s, Sat Mar 27 20:32:45 2021
+       @generated from sparse/control/magma_zsort.cpp, normal z -> s, Sat Oct 17 01:14:23 2026
        @author Hartwig Anzt
 */
 
 //  in this file, many routines are taken from
 //  the IO functions provided by MatrixMarket
 
+#include <algorithm>
+#include <vector>
+
 #include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 #define SWAP(a, b)  { tmp = val[a]; val[a] = val[b]; val[b] = tmp; }
@@ -23,11 +29,283 @@
 #define UP 0
 #define DOWN 1
 
+// ranges up to this length are sorted by insertion
+#define MAGMA_SORT_INSERTION 32
+
+// ranges from this length on are sorted by all threads
+#define MAGMA_SORT_PARALLEL 16384
+
+
+/*
+    Workspace of the radix sort: order-preserving unsigned keys, the
+    permutation that is sorted along with them and a buffer to apply the
+    permutation to the values.
+*/
+typedef struct magma_ssort_ws
+{
+    magma_int_t         size;
+    unsigned long long  *key;
+    unsigned long long  *key2;
+    magma_index_t       *perm;
+    magma_index_t       *perm2;
+    float  *val;
+} magma_ssort_ws;
+
+
+static void
+magma_ssort_ws_free(
+    magma_ssort_ws *ws )
+{
+    magma_free_cpu( ws->key );
+    magma_free_cpu( ws->key2 );
+    magma_free_cpu( ws->perm );
+    magma_free_cpu( ws->perm2 );
+    magma_free_cpu( ws->val );
+    ws->key = NULL;
+    ws->key2 = NULL;
+    ws->perm = NULL;
+    ws->perm2 = NULL;
+    ws->val = NULL;
+    ws->size = 0;
+}
+
+
+static magma_int_t
+magma_ssort_ws_alloc(
+    magma_int_t n,
+    magma_ssort_ws *ws )
+{
+    magma_int_t info = 0;
+    ws->size = n;
+    CHECK( magma_malloc_cpu( (void**) &ws->key, n*sizeof(unsigned long long) ));
+    CHECK( magma_malloc_cpu( (void**) &ws->key2, n*sizeof(unsigned long long) ));
+    CHECK( magma_index_malloc_cpu( &ws->perm, n ));
+    CHECK( magma_index_malloc_cpu( &ws->perm2, n ));
+    CHECK( magma_smalloc_cpu( &ws->val, n ));
+
+cleanup:
+    if ( info != 0 ) {
+        magma_ssort_ws_free( ws );
+    }
+    return info;
+}
+
+
+/*
+    Unsigned keys with the order of |val| (the bit pattern of a nonnegative
+    float is monotone) or of the signed indices. Only sizeof(a) bytes are
+    copied, the remaining key bytes stay zero and are skipped by the sort.
+*/
+static inline unsigned long long
+magma_ssort_key(
+    const float *val,
+    const magma_index_t *col,
+    magma_int_t i )
+{
+    if ( val != NULL ) {
+        // MAGMA_D_ABS( 0.0 ) is -0.0
+        float a = ( MAGMA_S_ABS( val[i] ) > 0 ) ? (float) MAGMA_S_ABS( val[i] ) : 0.0;
+        unsigned long long k = 0;
+        memcpy( &k, &a, sizeof(a) );
+        return k;
+    }
+    return (unsigned long long) ( (unsigned int) col[i] ^ 0x80000000u );
+}
+
+
+/*
+    Stable LSD radix sort of ws->key[0:n-1] with 8-bit digits, ws->perm is
+    sorted along. Only the digits below the common prefix of the smallest
+    and largest key are processed, digits shared by all keys are skipped.
+    Uses all threads if parallel is set.
+*/
+static void
+magma_ssort_radix(
+    magma_int_t n,
+    magma_ssort_ws *ws,
+    int parallel )
+{
+    unsigned long long kmin = ws->key[0], kmax = ws->key[0];
+    for( magma_int_t i=1; i<n; i++ ) {
+        kmin = min( kmin, ws->key[i] );
+        kmax = max( kmax, ws->key[i] );
+    }
+    int passes = 0;
+    for( unsigned long long d = kmin ^ kmax; d != 0; d >>= 8 ) {
+        passes++;
+    }
+
+    int num_threads = 1;
+    #ifdef _OPENMP
+    if ( parallel && ! omp_in_parallel() ) {
+        num_threads = omp_get_max_threads();
+    }
+    #endif
+    std::vector< magma_index_t > hist( 256*num_threads );
+
+    unsigned long long *key = ws->key, *key2 = ws->key2;
+    magma_index_t *perm = ws->perm, *perm2 = ws->perm2;
+    for( int p=0; p<passes; p++ ) {
+        int shift = 8*p;
+        int skip = 0;
+        #pragma omp parallel num_threads( num_threads )
+        {
+            int tid = 0;
+            #ifdef _OPENMP
+            tid = omp_get_thread_num();
+            #endif
+            magma_int_t start = n * tid / num_threads;
+            magma_int_t end = n * (tid+1) / num_threads;
+            magma_index_t *h = &hist[ 256*tid ];
+            for( int d=0; d<256; d++ ) {
+                h[d] = 0;
+            }
+            for( magma_int_t i=start; i<end; i++ ) {
+                h[ (key[i] >> shift) & 0xff ]++;
+            }
+            #pragma omp barrier
+            #pragma omp single
+            {
+                // a digit shared by all keys leaves the order unchanged
+                for( int d=0; d<256; d++ ) {
+                    magma_index_t c = 0;
+                    for( int t=0; t<num_threads; t++ ) {
+                        c += hist[ 256*t+d ];
+                    }
+                    if ( c == n ) {
+                        skip = 1;
+                    }
+                }
+                // offsets: digit-major, thread-minor to stay stable
+                magma_index_t offset = 0;
+                for( int d=0; d<256; d++ ) {
+                    for( int t=0; t<num_threads; t++ ) {
+                        magma_index_t c = hist[ 256*t+d ];
+                        hist[ 256*t+d ] = offset;
+                        offset += c;
+                    }
+                }
+            }
+            if ( ! skip ) {
+                for( magma_int_t i=start; i<end; i++ ) {
+                    magma_index_t pos = h[ (key[i] >> shift) & 0xff ]++;
+                    key2[pos] = key[i];
+                    perm2[pos] = perm[i];
+                }
+            }
+        }
+        if ( ! skip ) {
+            std::swap( key, key2 );
+            std::swap( perm, perm2 );
+        }
+    }
+    ws->key = key;
+    ws->key2 = key2;
+    ws->perm = perm;
+    ws->perm2 = perm2;
+}
+
+
+/*
+    Sorts the range [0,n) of the arrays val, col and row (each may be NULL)
+    by increasing |val| (byval) or increasing col. Short ranges are sorted
+    by insertion, longer ones with the radix sort using the workspace ws,
+    which has to hold at least n elements. Both are stable.
+*/
+static void
+magma_ssort_range(
+    magma_int_t n,
+    int byval,
+    float *val,
+    magma_index_t *col,
+    magma_index_t *row,
+    magma_ssort_ws *ws,
+    int parallel )
+{
+    const float *kval = byval ? val : NULL;
+    if ( n <= MAGMA_SORT_INSERTION ) {
+        for( magma_int_t i=1; i<n; i++ ) {
+            unsigned long long k = magma_ssort_key( kval, col, i );
+            magma_int_t j = i;
+            if ( magma_ssort_key( kval, col, j-1 ) <= k ) {
+                continue;
+            }
+            float v = ( val != NULL ) ? val[i] : MAGMA_S_ZERO;
+            magma_index_t c = ( col != NULL ) ? col[i] : 0;
+            magma_index_t r = ( row != NULL ) ? row[i] : 0;
+            while ( j > 0 && magma_ssort_key( kval, col, j-1 ) > k ) {
+                if ( val != NULL ) val[j] = val[j-1];
+                if ( col != NULL ) col[j] = col[j-1];
+                if ( row != NULL ) row[j] = row[j-1];
+                j--;
+            }
+            if ( val != NULL ) val[j] = v;
+            if ( col != NULL ) col[j] = c;
+            if ( row != NULL ) row[j] = r;
+        }
+        return;
+    }
+
+    #pragma omp parallel for if( parallel && n >= MAGMA_SORT_PARALLEL )
+    for( magma_int_t i=0; i<n; i++ ) {
+        ws->key[i] = magma_ssort_key( kval, col, i );
+        ws->perm[i] = i;
+    }
+    magma_ssort_radix( n, ws, parallel && n >= MAGMA_SORT_PARALLEL );
+
+    // apply the permutation, perm2 is free after the sort
+    magma_index_t *perm = ws->perm, *itmp = ws->perm2;
+    if ( val != NULL ) {
+        #pragma omp parallel for if( parallel && n >= MAGMA_SORT_PARALLEL )
+        for( magma_int_t i=0; i<n; i++ ) {
+            ws->val[i] = val[ perm[i] ];
+        }
+        memcpy( val, ws->val, n*sizeof(float) );
+    }
+    for( int a=0; a<2; a++ ) {
+        magma_index_t *x = ( a == 0 ) ? col : row;
+        if ( x == NULL ) {
+            continue;
+        }
+        #pragma omp parallel for if( parallel && n >= MAGMA_SORT_PARALLEL )
+        for( magma_int_t i=0; i<n; i++ ) {
+            itmp[i] = x[ perm[i] ];
+        }
+        memcpy( x, itmp, n*sizeof(magma_index_t) );
+    }
+}
+
+
+/*
+    Sorts a single range, allocating the workspace if needed.
+*/
+static magma_int_t
+magma_ssort_engine(
+    magma_int_t n,
+    int byval,
+    float *val,
+    magma_index_t *col,
+    magma_index_t *row )
+{
+    magma_int_t info = 0;
+    magma_ssort_ws ws = { 0, NULL, NULL, NULL, NULL, NULL };
+
+    if ( n > MAGMA_SORT_INSERTION ) {
+        CHECK( magma_ssort_ws_alloc( n, &ws ));
+    }
+    magma_ssort_range( n, byval, val, col, row, &ws, 1 );
+
+cleanup:
+    magma_ssort_ws_free( &ws );
+    return info;
+}
+
+
 /**
     Purpose
     -------
 
-    Sorts an array of values in increasing order.
+    Sorts an array of values for increasing magnitude. The sort is stable.
 
     Arguments
     ---------
@@ -61,31 +339,8 @@ magma_ssort(
 {
     magma_int_t info = 0;
 
-    float temp;
-    magma_index_t pivot,j,i;
-
-    if(first<last){
-         pivot=first;
-         i=first;
-         j=last;
-
-        while(i<j){
-            while( MAGMA_S_ABS(x[i]) <= MAGMA_S_ABS(x[pivot]) && i<last )
-                i++;
-            while( MAGMA_S_ABS(x[j]) > MAGMA_S_ABS(x[pivot]) )
-                j--;
-            if( i<j ){
-                temp = x[i];
-                x[i] = x[j];
-                x[j] = temp;
-            }
-        }
-
-        temp=x[pivot];
-        x[pivot]=x[j];
-        x[j]=temp;
-        CHECK( magma_ssort( x, first, j-1, queue ));
-        CHECK( magma_ssort( x, j+1, last, queue ));
+    if ( first < last ) {
+        CHECK( magma_ssort_engine( last-first+1, 1, x+first, NULL, NULL ));
     }
 cleanup:
     return info;
@@ -96,7 +351,8 @@ cleanup:
     Purpose
     -------
 
-    Sorts an array of values in increasing order.
+    Sorts an array of values for increasing magnitude, the arrays col and
+    row are reordered along. The sort is stable.
 
     Arguments
     ---------
@@ -140,37 +396,8 @@ magma_smsort(
 {
     magma_int_t info = 0;
 
-    float temp;
-    magma_index_t pivot,j,i, tmpcol, tmprow;
-
-    if(first<last){
-         pivot=first;
-         i=first;
-         j=last;
-
-        while(i<j){
-            while( MAGMA_S_ABS(x[i]) <= MAGMA_S_ABS(x[pivot]) && i<last )
-                i++;
-            while( MAGMA_S_ABS(x[j]) > MAGMA_S_ABS(x[pivot]) )
-                j--;
-            if( i<j ){
-                temp = x[i];
-                x[i] = x[j];
-                x[j] = temp;
-                tmpcol = col[i];
-                col[i] = col[j];
-                col[j] = tmpcol;
-                tmprow = row[i];
-                row[i] = row[j];
-                row[j] = tmprow;
-            }
-        }
-
-        temp=x[pivot];
-        x[pivot]=x[j];
-        x[j]=temp;
-        CHECK( magma_smsort( x, col, row, first, j-1, queue ));
-        CHECK( magma_smsort( x, col, row, j+1, last, queue ));
+    if ( first < last ) {
+        CHECK( magma_ssort_engine( last-first+1, 1, x+first, col+first, row+first ));
     }
 cleanup:
     return info;
@@ -215,30 +442,8 @@ magma_sindexsort(
 {
     magma_int_t info = 0;
 
-    magma_index_t pivot,j,temp,i;
-
-    if(first<last){
-         pivot=first;
-         i=first;
-         j=last;
-
-        while(i<j){
-            while( x[i]<=x[pivot] && i<last )
-                i++;
-            while( x[j]>x[pivot] )
-                j--;
-            if( i<j ){
-                temp = x[i];
-                x[i] = x[j];
-                x[j] = temp;
-            }
-        }
-
-        temp=x[pivot];
-        x[pivot]=x[j];
-        x[j]=temp;
-        CHECK( magma_sindexsort( x, first, j-1, queue ));
-        CHECK( magma_sindexsort( x, j+1, last, queue ));
+    if ( first < last ) {
+        CHECK( magma_ssort_engine( last-first+1, 0, NULL, x+first, NULL ));
     }
 cleanup:
     return info;
@@ -250,6 +455,7 @@ cleanup:
     -------
 
     Sorts an array of integers, updates a respective array of values.
+    The sort is stable.
 
     Arguments
     ---------
@@ -288,39 +494,104 @@ magma_sindexsortval(
 {
     magma_int_t info = 0;
 
-    magma_index_t pivot,j,temp,i;
-    float tempval;
+    if ( first < last ) {
+        CHECK( magma_ssort_engine( last-first+1, 0, y+first, x+first, NULL ));
+    }
+cleanup:
+    return info;
+}
+
 
-    if(first<last){
-         pivot=first;
-         i=first;
-         j=last;
+/**
+    Purpose
+    -------
 
-        while(i<j){
-            while( x[i]<=x[pivot] && i<last )
-                i++;
-            while( x[j]>x[pivot] )
-                j--;
-            if( i<j ){
-                temp = x[i];
-                x[i] = x[j];
-                x[j] = temp;
-                tempval = y[i];
-                y[i] = y[j];
-                y[j] = tempval;
-            }
+    Segmented sort: sorts the integers in every segment
+    x[ ptr[i] : ptr[i+1]-1 ], i = 0..num_segments-1, in increasing order
+    and updates the respective values in y, e.g. the rows of a CSR matrix.
+    The segments are distributed over the threads, segments that are
+    long enough are sorted by all threads. The sort is stable.
+
+    Arguments
+    ---------
+
+    @param[in]
+    num_segments    magma_int_t
+                    number of segments
+
+    @param[in]
+    ptr         magma_index_t*
+                segment pointer of length num_segments+1
+
+    @param[in,out]
+    x           magma_index_t*
+                array to sort
+
+    @param[in,out]
+    y           float*
+                array updated along, may be NULL
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_saux
+    ********************************************************************/
+
+extern "C"
+magma_int_t
+magma_sindexsortval_segments(
+    magma_int_t num_segments,
+    magma_index_t *ptr,
+    magma_index_t *x,
+    float *y,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    magma_int_t maxlen = 0;
+    std::vector< magma_int_t > longsegs;
+
+    for( magma_int_t i=0; i<num_segments; i++ ) {
+        magma_int_t len = ptr[i+1] - ptr[i];
+        if ( len >= MAGMA_SORT_PARALLEL ) {
+            longsegs.push_back( i );
+        } else {
+            maxlen = max( maxlen, len );
         }
+    }
 
-        temp=x[pivot];
-        x[pivot]=x[j];
-        x[j]=temp;
+    if ( maxlen > 1 ) {
+        #pragma omp parallel
+        {
+            magma_ssort_ws ws = { 0, NULL, NULL, NULL, NULL, NULL };
+            magma_int_t locinfo = 0;
+            if ( maxlen > MAGMA_SORT_INSERTION ) {
+                locinfo = magma_ssort_ws_alloc( maxlen, &ws );
+            }
+            if ( locinfo != 0 ) {
+                #pragma omp atomic write
+                info = locinfo;
+            }
+            #pragma omp for schedule(dynamic,64)
+            for( magma_int_t i=0; i<num_segments; i++ ) {
+                magma_int_t len = ptr[i+1] - ptr[i];
+                if ( len > 1 && len < MAGMA_SORT_PARALLEL
+                    && ( len <= MAGMA_SORT_INSERTION || locinfo == 0 ) ) {
+                    magma_ssort_range( len, 0, ( y != NULL ) ? y+ptr[i] : NULL,
+                                       x+ptr[i], NULL, &ws, 0 );
+                }
+            }
+            magma_ssort_ws_free( &ws );
+        }
+        CHECK( info );
+    }
 
-        tempval=y[pivot];
-        y[pivot]=y[j];
-        y[j]=tempval;
-        CHECK( magma_sindexsortval( x, y, first, j-1, queue ));
-        CHECK( magma_sindexsortval( x, y, j+1, last, queue ));
+    for( size_t k=0; k<longsegs.size(); k++ ) {
+        magma_int_t i = longsegs[k];
+        CHECK( magma_ssort_engine( ptr[i+1]-ptr[i], 0,
+                    ( y != NULL ) ? y+ptr[i] : NULL, x+ptr[i], NULL ));
     }
+
 cleanup:
     return info;
 }
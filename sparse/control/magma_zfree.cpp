@@ -12,7 +12,7 @@
 
 // todo: see how to destroy info
 // there are different, e.g., cusparseDestroyCsrsv2Info(info), etc.
-#if CUDA_VERSION >= 11000 || defined(HAVE_HIP)
+#if CUDA_VERSION >= 11000 || defined(HAVE_HIP) || defined(HAVE_HOST)
 #define cusparseDestroySolveAnalysisInfo(info) {;}
 #endif
 
@@ -75,6 +75,7 @@ magma_zmfree(
                 magma_free_cpu( A->val );
                 magma_free_cpu( A->row );
                 magma_free_cpu( A->col );
+                magma_free_cpu( A->sellp_perm );
             }
             A->num_rows = 0;
             A->num_cols = 0;
@@ -151,6 +152,37 @@ magma_zmfree(
             A->nnz = 0; A->true_nnz = 0;
             A->blockinfo = 0;
         }
+        if ( A->storage_type == Magma_CSRMP ) {
+            if (A->ownership) {
+                magma_free_cpu( A->row );
+                magma_free_cpu( A->col );
+                magma_free_cpu( A->diag );
+                magma_free_cpu( A->blockinfo );
+                magma_free_cpu( A->mp_val );
+                magma_free_cpu( A->mp_scale );
+                magma_free_cpu( A->mp_col );
+            }
+            A->num_rows = 0;
+            A->num_cols = 0;
+            A->nnz = 0; A->true_nnz = 0;
+        }
+        if ( A->storage_type == Magma_STENCIL ) {
+            A->num_rows = 0;
+            A->num_cols = 0;
+            A->nnz = 0; A->true_nnz = 0;
+        }
+        if ( A->storage_type == Magma_VBCSR ) {
+            if (A->ownership) {
+                magma_free_cpu( A->val );
+                magma_free_cpu( A->row );
+                magma_free_cpu( A->col );
+                magma_free_cpu( A->blockinfo );
+                magma_free_cpu( A->vbcsr_valptr );
+            }
+            A->num_rows = 0;
+            A->num_cols = 0;
+            A->nnz = 0; A->true_nnz = 0;
+        }
         if ( A->storage_type == Magma_DENSE ) {
             if (A->ownership) {
                 magma_free_cpu( A->val );
@@ -182,9 +214,14 @@ magma_zmfree(
         A->dtile_desc_offset = NULL;
         A->calibrator = NULL;
         A->dcalibrator = NULL;
+        A->mp_val = NULL;
+        A->mp_scale = NULL;
+        A->mp_col = NULL;
+        A->sellp_perm = NULL;
+        A->vbcsr_valptr = NULL;
     }
 
-    if ( A->memory_location == Magma_DEV ) {
+    else if ( A->memory_location == Magma_DEV ) {
         if (A->storage_type == Magma_ELL || A->storage_type == Magma_ELLPACKT) {
             if (A->ownership) {
                 if ( magma_free( A->dval ) != MAGMA_SUCCESS ) {
@@ -738,6 +775,21 @@ magma_zprecondfree(
         magma_free( precond_par->U_dgraphindegree_bak );
         precond_par->U_dgraphindegree_bak = NULL;
     }
+    magma_zsptrsv_free_cpu( &precond_par->sptrsvL, queue );
+    magma_zsptrsv_free_cpu( &precond_par->sptrsvU, queue );
+    if ( precond_par->refactor.Lmap != NULL ) {
+        magma_free_cpu( precond_par->refactor.Amap );
+        magma_free_cpu( precond_par->refactor.Lmap );
+        magma_free_cpu( precond_par->refactor.Umap );
+        magma_free_cpu( precond_par->refactor.UTmap );
+        magma_zmfree( &precond_par->refactor.ACOO, queue );
+        magma_zmfree( &precond_par->refactor.L, queue );
+        magma_zmfree( &precond_par->refactor.UT, queue );
+        precond_par->refactor.Amap = NULL;
+        precond_par->refactor.Lmap = NULL;
+        precond_par->refactor.Umap = NULL;
+        precond_par->refactor.UTmap = NULL;
+    }
 
     precond_par->solver = Magma_NONE;
     
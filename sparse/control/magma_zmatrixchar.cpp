@@ -177,6 +177,6 @@ magma_zdiameter(
         info = MAGMA_ERR_NOT_SUPPORTED;
     }
 cleanup:
-    magma_free( &dim );
+    magma_free_cpu( dim );
     return info;
 }
@@ -19,7 +19,9 @@ extern "C" {
 #endif
 
 
+#if ! defined(HAVE_HOST)
 magma_int_t cusparse2magma_error( cusparseStatus_t status );
+#endif
 
 
 /**
@@ -64,6 +66,7 @@ magma_int_t cusparse2magma_error( cusparseStatus_t status );
     @see CHECK
     @ingroup magma_error_internal
     ********************************************************************/
+#if ! defined(HAVE_HOST)
 #define CHECK_CUSPARSE( err )                   \
     do {                                        \
         cusparseStatus_t e_ = (err);            \
@@ -72,6 +75,7 @@ magma_int_t cusparse2magma_error( cusparseStatus_t status );
             goto cleanup;                       \
         }                                       \
     } while(0)
+#endif
 
 
 #ifdef __cplusplus
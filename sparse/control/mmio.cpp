@@ -5,6 +5,11 @@
 *
 *
 */
+#include <cfloat>   // LDBL_MANT_DIG
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
 #include "magmasparse_internal.h"
 #include "magmasparse_mmio.h"
 
@@ -541,3 +546,175 @@ void mm_snprintf_typecode( char *buffer, size_t buflen, MM_typecode matcode )
 
     snprintf( buffer, buflen, "%s %s %s %s", types[0], types[1], types[2], types[3] );
 }
+
+
+/**
+    Purpose
+    -------
+    Parses a non-negative decimal integer starting at p, skipping leading
+    blanks. Returns the position after the last digit, or NULL if no digit
+    was found or the value does not fit into magma_index_t.
+*/
+const char* mm_parse_index(
+    const char *p,
+    const char *end,
+    magma_index_t *value )
+{
+    while ( p < end && (*p == ' ' || *p == '\t') )
+        p++;
+    if ( p < end && *p == '+' )
+        p++;
+    if ( p >= end || *p < '0' || *p > '9' )
+        return NULL;
+    long long v = 0;
+    while ( p < end && *p >= '0' && *p <= '9' ) {
+        v = 10*v + (*p - '0');
+        if ( v > (std::numeric_limits< magma_index_t >::max)() )
+            return NULL;
+        p++;
+    }
+    *value = (magma_index_t) v;
+    return p;
+}
+
+
+/**
+    Purpose
+    -------
+    Parses a floating point number starting at p, skipping leading blanks.
+    Numbers with a mantissa of at most 2^53 and a decimal exponent of at most
+    22 are converted with one correctly rounded multiplication or division by
+    an exact power of ten (Clinger's fast path). Where long double has a
+    64-bit mantissa, the same is done in extended precision for up to 19
+    significant digits and exponents up to 27, which covers the %.16e output
+    of most writers; the result is only accepted if the extended value is not
+    a tie between two doubles, as only then rounding twice is exact.
+    Everything else (long mantissas, large exponents, inf, nan, hex floats)
+    is handed to strtod, so the result is always correctly rounded.
+    Returns the position after the number, or NULL on a parse error.
+*/
+const char* mm_parse_real(
+    const char *p,
+    const char *end,
+    double *value )
+{
+    static const double exact_pow10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    while ( p < end && (*p == ' ' || *p == '\t') )
+        p++;
+    const char *start = p;
+
+    bool negative = false;
+    if ( p < end && (*p == '-' || *p == '+') ) {
+        negative = (*p == '-');
+        p++;
+    }
+    unsigned long long mantissa = 0;
+    int digits = 0, exponent = 0;
+    bool fast = true, any = false;
+    while ( p < end && *p >= '0' && *p <= '9' ) {
+        if ( digits < 19 ) {
+            mantissa = 10*mantissa + (*p - '0');
+            if ( mantissa != 0 )
+                digits++;
+        } else {
+            fast = false;
+        }
+        any = true;
+        p++;
+    }
+    if ( p < end && *p == '.' ) {
+        p++;
+        while ( p < end && *p >= '0' && *p <= '9' ) {
+            if ( digits < 19 ) {
+                mantissa = 10*mantissa + (*p - '0');
+                if ( mantissa != 0 )
+                    digits++;
+                exponent--;
+            } else {
+                fast = false;
+            }
+            any = true;
+            p++;
+        }
+    }
+    if ( any && p < end && (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D') ) {
+        p++;
+        bool eneg = false;
+        if ( p < end && (*p == '-' || *p == '+') ) {
+            eneg = (*p == '-');
+            p++;
+        }
+        if ( p >= end || *p < '0' || *p > '9' )
+            return NULL;
+        int e = 0;
+        while ( p < end && *p >= '0' && *p <= '9' ) {
+            if ( e < 100000 )
+                e = 10*e + (*p - '0');
+            p++;
+        }
+        exponent += eneg ? -e : e;
+    }
+    if ( any && fast &&
+         (p == end || *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') )
+    {
+        if ( mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22 ) {
+            double v = (double) mantissa;
+            v = (exponent < 0) ? v / exact_pow10[ -exponent ]
+                               : v * exact_pow10[ exponent ];
+            *value = negative ? -v : v;
+            return p;
+        }
+        #if LDBL_MANT_DIG == 64
+        if ( exponent >= -27 && exponent <= 27 ) {
+            long double pow10 = 1.0L;
+            for( int k = 0; k < (exponent < 0 ? -exponent : exponent); k++ )
+                pow10 *= 10.0L;     // exact up to 10^27
+            long double x = (long double) mantissa;
+            x = (exponent < 0) ? x / pow10 : x * pow10;
+            double v = (double) x;
+            long double r = x - (long double) v;
+            long double ulp = (long double) nextafter( v, (r < 0) ? -HUGE_VAL : HUGE_VAL ) - v;
+            if ( r == 0 || 2*r != ulp ) {
+                *value = negative ? -v : v;
+                return p;
+            }
+        }
+        #endif
+    }
+
+    // slow path; the mapped file is not NUL-terminated, copy the token
+    char token[ 128 ];
+    size_t len = 0;
+    p = start;
+    while ( p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n'
+            && len < sizeof(token)-1 ) {
+        token[ len++ ] = *p++;
+    }
+    token[ len ] = '\0';
+    char *tail = NULL;
+    *value = strtod( token, &tail );
+    if ( len == 0 || tail != token + len )
+        return NULL;
+    return p;
+}
+
+
+/**
+    Purpose
+    -------
+    Returns 1 if fname starts with the magic of the MAGMA binary matrix
+    container (see magma_zwrite_csr_bin), 0 otherwise.
+*/
+int mm_is_magma_bin(const char *fname)
+{
+    char magic[ sizeof(MAGMA_BIN_MAGIC) ] = { 0 };
+    FILE *f = fopen( fname, "rb" );
+    if ( f == NULL )
+        return 0;
+    size_t got = fread( magic, 1, 8, f );
+    fclose( f );
+    return ( got == 8 && memcmp( magic, MAGMA_BIN_MAGIC, 8 ) == 0 );
+}
@@ -5,7 +5,7 @@
  Univ. of Colorado, Denver
  @date
 
- @generated from sparse/include/magmasparse_z.h, normal z -> c, Sat Mar 27 20:33:22 2021
+ @generated from sparse/include/magmasparse_z.h, normal z -> c, Fri Oct 16 22:49:25 2026
  @author Hartwig Anzt
 */
 
@@ -97,6 +97,17 @@ magma_c_csr_mtx(
     const char *filename,
     magma_queue_t queue );
 
+magma_int_t
+magma_c_csr_bin(
+    magma_c_matrix *A,
+    const char *filename,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmfree_bin(
+    magma_c_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t 
 magma_ccsrset( 
     magma_int_t m, 
@@ -368,6 +379,14 @@ magma_cindexsortval(
     magma_int_t last,
     magma_queue_t queue );
 
+magma_int_t
+magma_cindexsortval_segments(
+    magma_int_t num_segments,
+    magma_index_t *ptr,
+    magma_index_t *x,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
 magma_int_t
 magma_corderstatistics(
     magmaFloatComplex *val,
@@ -424,6 +443,15 @@ magma_cselectrandom(
     magma_int_t k,
     magma_queue_t queue );
 
+magma_int_t
+magma_csampleselect_cpu(
+    magmaFloatComplex *a,
+    magma_int_t size,
+    magma_int_t k,
+    float tol,
+    float *thrs,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cdomainoverlap(
     magma_index_t num_rows,
@@ -461,6 +489,12 @@ magma_cwrite_csrtomtx(
     const char *filename,
     magma_queue_t queue );
 
+magma_int_t
+magma_cwrite_csr_bin(
+    magma_c_matrix A,
+    const char *filename,
+    magma_queue_t queue );
+
 magma_int_t 
 magma_cprint_csr( 
     magma_int_t n_row, 
@@ -635,6 +669,13 @@ magma_cm_5stencil(
     magma_c_matrix *A,
     magma_queue_t queue );
 
+magma_int_t
+magma_cm_stencil(
+    magma_int_t points,
+    magma_int_t n,
+    magma_c_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t
 magma_csolverinfo(
     magma_c_solver_par *solver_par, 
@@ -694,6 +735,24 @@ magma_cparilu_cpu(
     magma_c_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_cparilu_keepsymbolic(
+    magma_c_matrix hA0,
+    magma_c_matrix hA,
+    magma_c_matrix hAL,
+    magma_c_matrix hAU,
+    magma_c_matrix *ACOO,
+    magma_c_matrix *L,
+    magma_c_matrix *UT,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cparilu_refactor(
+    magma_c_matrix A,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cparic_gpu( 
     magma_c_matrix A, 
@@ -844,6 +903,20 @@ magma_cmatrix_cup(
     magma_c_matrix *U,
     magma_queue_t queue );
 
+magma_int_t
+magma_cmatrix_cup_ws(
+    magma_c_matrix A,
+    magma_c_matrix B,
+    magma_c_matrix *U,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmatrix_reserve(
+    magma_int_t num_rows,
+    magma_int_t nnz,
+    magma_c_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cmatrix_cup_gpu(
     magma_c_matrix A,
@@ -897,6 +970,14 @@ magma_cparilut_thrsrm(
     float *thrs,
     magma_queue_t queue );
 
+magma_int_t
+magma_cparilut_thrsrm_ws(
+    magma_int_t order,
+    magma_c_matrix *A,
+    float *thrs,
+    magma_c_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cparilut_thrsrm_semilinked(
     magma_c_matrix *U,
@@ -961,6 +1042,13 @@ magma_ccsrcoo_transpose(
     magma_c_matrix *B,
     magma_queue_t queue );
 
+magma_int_t
+magma_ccsrcoo_transpose_ws(
+    magma_c_matrix A,
+    magma_c_matrix *B,
+    magma_c_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cparilut_transpose_select_one(
     magma_c_matrix A,
@@ -1015,6 +1103,15 @@ magma_cparilut_set_thrs_randomselect_approx(
     float *thrs,
     magma_queue_t queue );
 
+magma_int_t
+magma_cparilut_set_thrs_randomselect_approx_ws(
+    magma_int_t num_rm,
+    magma_c_matrix *LU,
+    magma_int_t order,
+    float *thrs,
+    magma_c_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cparilut_set_thrs_randomselect_factors(
     magma_int_t num_rm,
@@ -1104,6 +1201,14 @@ magma_cparilut_sweep_sync(
     magma_c_matrix *U,
     magma_queue_t queue );
 
+magma_int_t
+magma_cparilut_sweep_sync_ws(
+    magma_c_matrix *A,
+    magma_c_matrix *L,
+    magma_c_matrix *U,
+    magma_c_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cparilut_sweep_gpu( 
     magma_c_matrix *A,
@@ -1271,6 +1376,14 @@ magma_cparilut_cpu(
     magma_c_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_cparilut_cpu_ws(
+    magma_c_matrix A,
+    magma_c_matrix b,
+    magma_c_preconditioner *precond,
+    magma_c_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cparilut_gpu(
     magma_c_matrix A,
@@ -1314,6 +1427,29 @@ magma_cparilut_candidates(
     magma_c_matrix *U_new,
     magma_queue_t queue );
 
+magma_int_t
+magma_cparilut_candidates_ws(
+    magma_c_matrix L0,
+    magma_c_matrix U0,
+    magma_c_matrix L,
+    magma_c_matrix U,
+    magma_c_matrix *L_new,
+    magma_c_matrix *U_new,
+    magma_c_parilut_workspace *ws,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cparilut_workspace_scratch(
+    magma_int_t index_len,
+    magma_int_t val_len,
+    magma_c_parilut_workspace *ws,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cparilut_workspace_free(
+    magma_c_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cparilut_candidates_gpu(
     magma_c_matrix L0,
@@ -1395,6 +1531,13 @@ magma_cparilut_preselect(
     magma_c_matrix *oneA,
     magma_queue_t queue );
 
+magma_int_t
+magma_cparilut_preselect_ws(
+    magma_int_t order,
+    magma_c_matrix *A,
+    magma_c_matrix *oneA,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cpreselect_gpu(
     magma_int_t order,
@@ -1608,10 +1751,544 @@ magma_ccsr_sort_gpu(
  -- MAGMA_SPARSE function definitions / Data on CPU
 */
 
+magma_int_t
+magma_c_spmv_cpu(
+    magmaFloatComplex alpha,
+    magma_c_matrix A,
+    magma_c_matrix x,
+    magmaFloatComplex beta,
+    magma_c_matrix y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgecsrmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmgecsrmv_cpu(
+    magma_order_t major,
+    magma_int_t m, magma_int_t n,
+    magma_int_t num_vecs,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgeellmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *col,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgeelltmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *col,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgeellrtmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *col,
+    const magma_index_t *rowlength,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_int_t alignment,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgesellpmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t blocksize,
+    magma_int_t slices,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *col,
+    const magma_index_t *rowptr,
+    const magma_index_t *perm,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmgesellpmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t num_vecs,
+    magma_int_t blocksize,
+    magma_int_t slices,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *col,
+    const magma_index_t *rowptr,
+    const magma_index_t *perm,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgecsr5mv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t p,
+    magmaFloatComplex alpha,
+    magma_int_t sigma,
+    const magma_uindex_t *tile_ptr,
+    const magmaFloatComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgecoomv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *rowidx,
+    const magma_index_t *col,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgebcsrmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t blocksize,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgestencilmv_cpu(
+    magma_int_t points,
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgevbcsrmv_cpu(
+    magma_int_t m,
+    magma_int_t numblocks,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *val,
+    const magma_index_t *valptr,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magma_index_t *part,
+    const magmaFloatComplex *x,
+    magmaFloatComplex beta,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmvbcsr(
+    magma_c_matrix A,
+    magma_int_t max_bs,
+    magma_c_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmvbcsrtocsr(
+    magma_c_matrix A,
+    magma_c_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cvbcsr_bjacobi_setup_cpu(
+    magma_c_matrix A,
+    magma_c_matrix *D,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cvbcsr_bjacobi_apply_cpu(
+    magma_c_matrix D,
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cspgemm_symbolic_cpu(
+    magma_c_matrix A,
+    magma_c_matrix B,
+    magma_c_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cspgemm_numeric_cpu(
+    magmaFloatComplex alpha,
+    magma_c_matrix A,
+    magma_c_matrix B,
+    magma_c_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cspgemm_cpu(
+    magmaFloatComplex alpha,
+    magma_c_matrix A,
+    magma_c_matrix B,
+    magma_c_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_csptrsv_analysis_cpu(
+    magma_uplo_t uplo,
+    magma_c_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_queue_t queue );
+
+magma_int_t
+magma_csptrsv_free_cpu(
+    magma_sptrsv_info *analysis,
+    magma_queue_t queue );
+
+magma_int_t
+magma_csptrsv_levels_cpu(
+    magma_c_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_csptrsv_syncfree_cpu(
+    magma_c_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_csptrsv_cpu(
+    magma_c_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_solver_type trisolver,
+    magma_c_matrix b,
+    magma_c_matrix *x,
+    magma_queue_t queue );
+
+magmaFloatComplex
+magma_cdotc_cpu(
+    magma_int_t n,
+    const magmaFloatComplex *x,
+    const magmaFloatComplex *y,
+    magma_queue_t queue );
+
+float
+magma_scnrm2_cpu(
+    magma_int_t n,
+    const magmaFloatComplex *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmdotc_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const magmaFloatComplex *V,
+    magma_int_t ldv,
+    const magmaFloatComplex *w,
+    magmaFloatComplex *h,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmaxpy_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const magmaFloatComplex *V,
+    magma_int_t ldv,
+    const magmaFloatComplex *h,
+    magmaFloatComplex *w,
+    float *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ccgmerge_spmv1_cpu(
+    magma_c_matrix A,
+    const magmaFloatComplex *d,
+    magmaFloatComplex *z,
+    magmaFloatComplex *dz,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ccgmerge_xrbeta_cpu(
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex *x,
+    magmaFloatComplex *r,
+    magmaFloatComplex *d,
+    const magmaFloatComplex *z,
+    float *rr,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbicgstab_1_cpu(
+    magma_int_t n,
+    magmaFloatComplex beta,
+    magmaFloatComplex omega,
+    const magmaFloatComplex *r,
+    const magmaFloatComplex *v,
+    magmaFloatComplex *p,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbicgmerge_spmv1_cpu(
+    magma_c_matrix A,
+    const magmaFloatComplex *rr,
+    const magmaFloatComplex *p,
+    magmaFloatComplex *v,
+    magmaFloatComplex *rrv,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbicgstab_2_cpu(
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *r,
+    const magmaFloatComplex *v,
+    magmaFloatComplex *s,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbicgmerge_spmv2_cpu(
+    magma_c_matrix A,
+    const magmaFloatComplex *s,
+    magmaFloatComplex *t,
+    magmaFloatComplex *ts,
+    magmaFloatComplex *tt,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbicgstab_3_cpu(
+    magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex omega,
+    const magmaFloatComplex *p,
+    const magmaFloatComplex *s,
+    const magmaFloatComplex *t,
+    const magmaFloatComplex *rr,
+    magmaFloatComplex *x,
+    magmaFloatComplex *r,
+    magmaFloatComplex *rho,
+    float *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ccacg_spmv_cpu(
+    magma_c_matrix A,
+    const magmaFloatComplex *r,
+    magmaFloatComplex *w,
+    float *rr,
+    float *rw,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ccacg_update_cpu(
+    magma_int_t n,
+    float alpha,
+    float beta,
+    magmaFloatComplex *x,
+    magmaFloatComplex *r,
+    magmaFloatComplex *p,
+    magmaFloatComplex *s,
+    const magmaFloatComplex *w,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cpipegmres_spmv_cpu(
+    magma_c_matrix A,
+    magma_int_t k,
+    const magmaFloatComplex *V,
+    magma_int_t ldv,
+    const magmaFloatComplex *z,
+    magmaFloatComplex *w,
+    magmaFloatComplex *h,
+    float *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cpipegmres_update_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const magmaFloatComplex *V,
+    const magmaFloatComplex *Z,
+    magma_int_t ldv,
+    const magmaFloatComplex *h,
+    float eta,
+    const magmaFloatComplex *z,
+    const magmaFloatComplex *w,
+    magmaFloatComplex *v,
+    magmaFloatComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbcgmerge_spmv_cpu(
+    magma_c_matrix A,
+    magma_int_t nv,
+    const magmaFloatComplex *P,
+    magmaFloatComplex *Q,
+    magmaFloatComplex *den,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbcgmerge_xr_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    const magmaFloatComplex *alpha,
+    magmaFloatComplex *X,
+    magmaFloatComplex *R,
+    const magmaFloatComplex *P,
+    const magmaFloatComplex *Q,
+    float *rr,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbmdotc_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const magmaFloatComplex *V,
+    magma_int_t ldv,
+    const magmaFloatComplex *W,
+    magmaFloatComplex *h,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbmaxpy_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const magmaFloatComplex *V,
+    magma_int_t ldv,
+    const magmaFloatComplex *h,
+    magmaFloatComplex *W,
+    float *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbcompact_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t nk,
+    const magma_int_t *keep,
+    magmaFloatComplex *X,
+    magmaFloatComplex *work,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ccg_cpu(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_matrix *x, magma_c_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbicgstab_cpu(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_matrix *x, magma_c_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cgmres_cpu(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_matrix *x, magma_c_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ccacg_cpu(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_matrix *x, magma_c_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cpipegmres_cpu(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_matrix *x, magma_c_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbcg_cpu(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_matrix *x, magma_c_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cbgmres_cpu(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_matrix *x, magma_c_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cpcg_cpu(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_matrix *x, magma_c_solver_par *solver_par,
+    magma_c_preconditioner *precond_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cpbicgstab_cpu(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_matrix *x, magma_c_solver_par *solver_par,
+    magma_c_preconditioner *precond_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cpgmres_cpu(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_matrix *x, magma_c_solver_par *solver_par,
+    magma_c_preconditioner *precond_par,
+    magma_queue_t queue );
+
 
 /* ////////////////////////////////////////////////////////////////////////////
  -- MAGMA_SPARSE supernodal and RCM reordering
 */
+magma_int_t
+magma_cmrowblocks(
+    magma_c_matrix A,
+    magma_int_t max_bs,
+    magma_int_t *num_blocks,
+    magma_index_t **start,
+    magma_queue_t queue );
+
 magma_int_t
 magma_cmsupernodal(
     magma_int_t *max_bs,
@@ -1628,6 +2305,51 @@ magma_cmvarsizeblockstruct(
     magma_c_matrix *A,
     magma_queue_t queue );
 
+magma_int_t
+magma_cmreorder(
+    magma_c_matrix A,
+    magma_reorder_t order,
+    magma_index_t **perm,
+    magma_c_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmtune_analyze(
+    magma_c_matrix A,
+    magma_location_t location,
+    magma_c_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmtune_benchmark(
+    magma_c_matrix A,
+    magma_location_t location,
+    magma_c_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmtune(
+    magma_c_matrix A,
+    magma_location_t location,
+    magma_tune_t mode,
+    magma_c_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cmpermute(
+    magma_c_matrix A,
+    magma_index_t *perm,
+    magma_c_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cvpermute(
+    magma_trans_t trans,
+    magma_index_t *perm,
+    magma_c_matrix x,
+    magma_c_matrix *y,
+    magma_queue_t queue );
+
 
 
 /* ////////////////////////////////////////////////////////////////////////////
@@ -2346,6 +3068,13 @@ magma_c_precondsetup(
     magma_c_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_c_precond_refactor(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_solver_par *solver,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue );
+
 magma_int_t
 magma_c_applyprecond(
     magma_c_matrix A, magma_c_matrix b, 
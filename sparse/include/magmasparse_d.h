@@ -5,7 +5,7 @@
  Univ. of Colorado, Denver
  @date
 
- @generated from sparse/include/magmasparse_z.h, normal z -> d, Sat Mar 27 20:33:22 2021
+ @generated from sparse/include/magmasparse_z.h, normal z -> d, Fri Oct 16 22:49:24 2026
  @author Hartwig Anzt
 */
 
@@ -97,6 +97,17 @@ magma_d_csr_mtx(
     const char *filename,
     magma_queue_t queue );
 
+magma_int_t
+magma_d_csr_bin(
+    magma_d_matrix *A,
+    const char *filename,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmfree_bin(
+    magma_d_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t 
 magma_dcsrset( 
     magma_int_t m, 
@@ -368,6 +379,14 @@ magma_dindexsortval(
     magma_int_t last,
     magma_queue_t queue );
 
+magma_int_t
+magma_dindexsortval_segments(
+    magma_int_t num_segments,
+    magma_index_t *ptr,
+    magma_index_t *x,
+    double *y,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dorderstatistics(
     double *val,
@@ -424,6 +443,15 @@ magma_dselectrandom(
     magma_int_t k,
     magma_queue_t queue );
 
+magma_int_t
+magma_dsampleselect_cpu(
+    double *a,
+    magma_int_t size,
+    magma_int_t k,
+    double tol,
+    double *thrs,
+    magma_queue_t queue );
+
 magma_int_t
 magma_ddomainoverlap(
     magma_index_t num_rows,
@@ -461,6 +489,12 @@ magma_dwrite_csrtomtx(
     const char *filename,
     magma_queue_t queue );
 
+magma_int_t
+magma_dwrite_csr_bin(
+    magma_d_matrix A,
+    const char *filename,
+    magma_queue_t queue );
+
 magma_int_t 
 magma_dprint_csr( 
     magma_int_t n_row, 
@@ -635,6 +669,13 @@ magma_dm_5stencil(
     magma_d_matrix *A,
     magma_queue_t queue );
 
+magma_int_t
+magma_dm_stencil(
+    magma_int_t points,
+    magma_int_t n,
+    magma_d_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dsolverinfo(
     magma_d_solver_par *solver_par, 
@@ -694,6 +735,24 @@ magma_dparilu_cpu(
     magma_d_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_dparilu_keepsymbolic(
+    magma_d_matrix hA0,
+    magma_d_matrix hA,
+    magma_d_matrix hAL,
+    magma_d_matrix hAU,
+    magma_d_matrix *ACOO,
+    magma_d_matrix *L,
+    magma_d_matrix *UT,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dparilu_refactor(
+    magma_d_matrix A,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dparic_gpu( 
     magma_d_matrix A, 
@@ -844,6 +903,20 @@ magma_dmatrix_cup(
     magma_d_matrix *U,
     magma_queue_t queue );
 
+magma_int_t
+magma_dmatrix_cup_ws(
+    magma_d_matrix A,
+    magma_d_matrix B,
+    magma_d_matrix *U,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmatrix_reserve(
+    magma_int_t num_rows,
+    magma_int_t nnz,
+    magma_d_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dmatrix_cup_gpu(
     magma_d_matrix A,
@@ -897,6 +970,14 @@ magma_dparilut_thrsrm(
     double *thrs,
     magma_queue_t queue );
 
+magma_int_t
+magma_dparilut_thrsrm_ws(
+    magma_int_t order,
+    magma_d_matrix *A,
+    double *thrs,
+    magma_d_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dparilut_thrsrm_semilinked(
     magma_d_matrix *U,
@@ -961,6 +1042,13 @@ magma_dcsrcoo_transpose(
     magma_d_matrix *B,
     magma_queue_t queue );
 
+magma_int_t
+magma_dcsrcoo_transpose_ws(
+    magma_d_matrix A,
+    magma_d_matrix *B,
+    magma_d_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dparilut_transpose_select_one(
     magma_d_matrix A,
@@ -1015,6 +1103,15 @@ magma_dparilut_set_thrs_randomselect_approx(
     double *thrs,
     magma_queue_t queue );
 
+magma_int_t
+magma_dparilut_set_thrs_randomselect_approx_ws(
+    magma_int_t num_rm,
+    magma_d_matrix *LU,
+    magma_int_t order,
+    double *thrs,
+    magma_d_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dparilut_set_thrs_randomselect_factors(
     magma_int_t num_rm,
@@ -1104,6 +1201,14 @@ magma_dparilut_sweep_sync(
     magma_d_matrix *U,
     magma_queue_t queue );
 
+magma_int_t
+magma_dparilut_sweep_sync_ws(
+    magma_d_matrix *A,
+    magma_d_matrix *L,
+    magma_d_matrix *U,
+    magma_d_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dparilut_sweep_gpu( 
     magma_d_matrix *A,
@@ -1271,6 +1376,14 @@ magma_dparilut_cpu(
     magma_d_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_dparilut_cpu_ws(
+    magma_d_matrix A,
+    magma_d_matrix b,
+    magma_d_preconditioner *precond,
+    magma_d_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dparilut_gpu(
     magma_d_matrix A,
@@ -1314,6 +1427,29 @@ magma_dparilut_candidates(
     magma_d_matrix *U_new,
     magma_queue_t queue );
 
+magma_int_t
+magma_dparilut_candidates_ws(
+    magma_d_matrix L0,
+    magma_d_matrix U0,
+    magma_d_matrix L,
+    magma_d_matrix U,
+    magma_d_matrix *L_new,
+    magma_d_matrix *U_new,
+    magma_d_parilut_workspace *ws,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dparilut_workspace_scratch(
+    magma_int_t index_len,
+    magma_int_t val_len,
+    magma_d_parilut_workspace *ws,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dparilut_workspace_free(
+    magma_d_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dparilut_candidates_gpu(
     magma_d_matrix L0,
@@ -1395,6 +1531,13 @@ magma_dparilut_preselect(
     magma_d_matrix *oneA,
     magma_queue_t queue );
 
+magma_int_t
+magma_dparilut_preselect_ws(
+    magma_int_t order,
+    magma_d_matrix *A,
+    magma_d_matrix *oneA,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dpreselect_gpu(
     magma_int_t order,
@@ -1608,10 +1751,544 @@ magma_dcsr_sort_gpu(
  -- MAGMA_SPARSE function definitions / Data on CPU
 */
 
+magma_int_t
+magma_d_spmv_cpu(
+    double alpha,
+    magma_d_matrix A,
+    magma_d_matrix x,
+    double beta,
+    magma_d_matrix y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgecsrmv_cpu(
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    const double *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmgecsrmv_cpu(
+    magma_order_t major,
+    magma_int_t m, magma_int_t n,
+    magma_int_t num_vecs,
+    double alpha,
+    const double *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgeellmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    double alpha,
+    const double *val,
+    const magma_index_t *col,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgeelltmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    double alpha,
+    const double *val,
+    const magma_index_t *col,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgeellrtmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    double alpha,
+    const double *val,
+    const magma_index_t *col,
+    const magma_index_t *rowlength,
+    const double *x,
+    double beta,
+    double *y,
+    magma_int_t alignment,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgesellpmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t blocksize,
+    magma_int_t slices,
+    double alpha,
+    const double *val,
+    const magma_index_t *col,
+    const magma_index_t *rowptr,
+    const magma_index_t *perm,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmgesellpmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t num_vecs,
+    magma_int_t blocksize,
+    magma_int_t slices,
+    double alpha,
+    const double *val,
+    const magma_index_t *col,
+    const magma_index_t *rowptr,
+    const magma_index_t *perm,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgecsr5mv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t p,
+    double alpha,
+    magma_int_t sigma,
+    const magma_uindex_t *tile_ptr,
+    const double *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgecoomv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz,
+    double alpha,
+    const double *val,
+    const magma_index_t *rowidx,
+    const magma_index_t *col,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgebcsrmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t blocksize,
+    double alpha,
+    const double *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgestencilmv_cpu(
+    magma_int_t points,
+    magma_int_t n,
+    double alpha,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgevbcsrmv_cpu(
+    magma_int_t m,
+    magma_int_t numblocks,
+    double alpha,
+    const double *val,
+    const magma_index_t *valptr,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magma_index_t *part,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmvbcsr(
+    magma_d_matrix A,
+    magma_int_t max_bs,
+    magma_d_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmvbcsrtocsr(
+    magma_d_matrix A,
+    magma_d_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dvbcsr_bjacobi_setup_cpu(
+    magma_d_matrix A,
+    magma_d_matrix *D,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dvbcsr_bjacobi_apply_cpu(
+    magma_d_matrix D,
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dspgemm_symbolic_cpu(
+    magma_d_matrix A,
+    magma_d_matrix B,
+    magma_d_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dspgemm_numeric_cpu(
+    double alpha,
+    magma_d_matrix A,
+    magma_d_matrix B,
+    magma_d_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dspgemm_cpu(
+    double alpha,
+    magma_d_matrix A,
+    magma_d_matrix B,
+    magma_d_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dsptrsv_analysis_cpu(
+    magma_uplo_t uplo,
+    magma_d_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dsptrsv_free_cpu(
+    magma_sptrsv_info *analysis,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dsptrsv_levels_cpu(
+    magma_d_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dsptrsv_syncfree_cpu(
+    magma_d_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dsptrsv_cpu(
+    magma_d_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_solver_type trisolver,
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_queue_t queue );
+
+double
+magma_ddot_cpu(
+    magma_int_t n,
+    const double *x,
+    const double *y,
+    magma_queue_t queue );
+
+double
+magma_dnrm2_cpu(
+    magma_int_t n,
+    const double *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmdotc_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const double *V,
+    magma_int_t ldv,
+    const double *w,
+    double *h,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmaxpy_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const double *V,
+    magma_int_t ldv,
+    const double *h,
+    double *w,
+    double *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dcgmerge_spmv1_cpu(
+    magma_d_matrix A,
+    const double *d,
+    double *z,
+    double *dz,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dcgmerge_xrbeta_cpu(
+    magma_int_t n,
+    double alpha,
+    double *x,
+    double *r,
+    double *d,
+    const double *z,
+    double *rr,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbicgstab_1_cpu(
+    magma_int_t n,
+    double beta,
+    double omega,
+    const double *r,
+    const double *v,
+    double *p,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbicgmerge_spmv1_cpu(
+    magma_d_matrix A,
+    const double *rr,
+    const double *p,
+    double *v,
+    double *rrv,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbicgstab_2_cpu(
+    magma_int_t n,
+    double alpha,
+    const double *r,
+    const double *v,
+    double *s,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbicgmerge_spmv2_cpu(
+    magma_d_matrix A,
+    const double *s,
+    double *t,
+    double *ts,
+    double *tt,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbicgstab_3_cpu(
+    magma_int_t n,
+    double alpha,
+    double omega,
+    const double *p,
+    const double *s,
+    const double *t,
+    const double *rr,
+    double *x,
+    double *r,
+    double *rho,
+    double *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dcacg_spmv_cpu(
+    magma_d_matrix A,
+    const double *r,
+    double *w,
+    double *rr,
+    double *rw,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dcacg_update_cpu(
+    magma_int_t n,
+    double alpha,
+    double beta,
+    double *x,
+    double *r,
+    double *p,
+    double *s,
+    const double *w,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dpipegmres_spmv_cpu(
+    magma_d_matrix A,
+    magma_int_t k,
+    const double *V,
+    magma_int_t ldv,
+    const double *z,
+    double *w,
+    double *h,
+    double *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dpipegmres_update_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const double *V,
+    const double *Z,
+    magma_int_t ldv,
+    const double *h,
+    double eta,
+    const double *z,
+    const double *w,
+    double *v,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbcgmerge_spmv_cpu(
+    magma_d_matrix A,
+    magma_int_t nv,
+    const double *P,
+    double *Q,
+    double *den,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbcgmerge_xr_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    const double *alpha,
+    double *X,
+    double *R,
+    const double *P,
+    const double *Q,
+    double *rr,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbmdotc_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const double *V,
+    magma_int_t ldv,
+    const double *W,
+    double *h,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbmaxpy_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const double *V,
+    magma_int_t ldv,
+    const double *h,
+    double *W,
+    double *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbcompact_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t nk,
+    const magma_int_t *keep,
+    double *X,
+    double *work,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dcg_cpu(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_matrix *x, magma_d_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbicgstab_cpu(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_matrix *x, magma_d_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgmres_cpu(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_matrix *x, magma_d_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dcacg_cpu(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_matrix *x, magma_d_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dpipegmres_cpu(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_matrix *x, magma_d_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbcg_cpu(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_matrix *x, magma_d_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dbgmres_cpu(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_matrix *x, magma_d_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dpcg_cpu(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_matrix *x, magma_d_solver_par *solver_par,
+    magma_d_preconditioner *precond_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dpbicgstab_cpu(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_matrix *x, magma_d_solver_par *solver_par,
+    magma_d_preconditioner *precond_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dpgmres_cpu(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_matrix *x, magma_d_solver_par *solver_par,
+    magma_d_preconditioner *precond_par,
+    magma_queue_t queue );
+
 
 /* ////////////////////////////////////////////////////////////////////////////
  -- MAGMA_SPARSE supernodal and RCM reordering
 */
+magma_int_t
+magma_dmrowblocks(
+    magma_d_matrix A,
+    magma_int_t max_bs,
+    magma_int_t *num_blocks,
+    magma_index_t **start,
+    magma_queue_t queue );
+
 magma_int_t
 magma_dmsupernodal(
     magma_int_t *max_bs,
@@ -1628,6 +2305,51 @@ magma_dmvarsizeblockstruct(
     magma_d_matrix *A,
     magma_queue_t queue );
 
+magma_int_t
+magma_dmreorder(
+    magma_d_matrix A,
+    magma_reorder_t order,
+    magma_index_t **perm,
+    magma_d_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmtune_analyze(
+    magma_d_matrix A,
+    magma_location_t location,
+    magma_d_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmtune_benchmark(
+    magma_d_matrix A,
+    magma_location_t location,
+    magma_d_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmtune(
+    magma_d_matrix A,
+    magma_location_t location,
+    magma_tune_t mode,
+    magma_d_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dmpermute(
+    magma_d_matrix A,
+    magma_index_t *perm,
+    magma_d_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dvpermute(
+    magma_trans_t trans,
+    magma_index_t *perm,
+    magma_d_matrix x,
+    magma_d_matrix *y,
+    magma_queue_t queue );
+
 
 
 /* ////////////////////////////////////////////////////////////////////////////
@@ -2346,6 +3068,13 @@ magma_d_precondsetup(
     magma_d_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_d_precond_refactor(
+    magma_d_matrix A, magma_d_matrix b,
+    magma_d_solver_par *solver,
+    magma_d_preconditioner *precond,
+    magma_queue_t queue );
+
 magma_int_t
 magma_d_applyprecond(
     magma_d_matrix A, magma_d_matrix b, 
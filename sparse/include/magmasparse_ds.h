@@ -5,7 +5,7 @@
  Univ. of Colorado, Denver
  @date
 
- @generated from sparse/include/magmasparse_zc.h, mixed zc -> ds, Sat Mar 27 20:33:23 2021
+ @generated from sparse/include/magmasparse_zc.h, mixed zc -> ds, Fri Oct 16 19:08:42 2026
  @author Hartwig Anzt
 */
 
@@ -99,6 +99,31 @@ magma_dlag2s_CSR_DENSE_convert(
  -- MAGMA_SPARSE function definitions / Data on CPU
 */
 
+magma_int_t
+magma_dmcsrmp(
+    magma_d_matrix A,
+    magma_precision format,
+    magma_d_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dgecsrmpmv_cpu(
+    double alpha,
+    magma_d_matrix A,
+    const double *x,
+    double beta,
+    double *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dsir_cpu(
+    magma_d_matrix A,
+    magma_d_matrix b,
+    magma_d_matrix *x,
+    magma_d_solver_par *solver_par,
+    magma_d_preconditioner *precond_par,
+    magma_queue_t queue );
+
 
 /* ////////////////////////////////////////////////////////////////////////////
  -- MAGMA_SPARSE function definitions / Data on CPU / Multi-GPU
@@ -6,6 +6,7 @@
 *
 */
 #include <stdio.h>
+#include <stdint.h>
 
 #include "magma_v2.h"
 #include "magmasparse.h"
@@ -31,6 +32,9 @@ int mm_write_mtx_crd_size(FILE *f, magma_index_t M, magma_index_t N,
                                                     magma_index_t nz);
 int mm_write_mtx_array_size(FILE *f, magma_index_t M, magma_index_t N);
 
+const char* mm_parse_index(const char *p, const char *end, magma_index_t *value);
+const char* mm_parse_real(const char *p, const char *end, double *value);
+
 
 /********************* MM_typecode query fucntions ***************************/
 
@@ -141,5 +145,57 @@ int mm_read_unsymmetric_sparse(const char *fname, magma_index_t *M_,
         double **val_, magma_index_t **I_, magma_index_t **J_);
 
 
+/******************** MAGMA binary matrix container ************************
+
+   Written by magma_[sdcz]write_csr_bin, loaded by magma_[sdcz]_csr_bin.
+   The file starts with a header of MAGMA_BIN_ALIGNMENT bytes, followed by
+   the arrays of the matrix (val first, then the index arrays of the storage
+   format), each starting at a multiple of MAGMA_BIN_ALIGNMENT, such that
+   the arrays of a memory-mapped file are page-aligned.
+
+ ***********************************************************************/
+
+#define MAGMA_BIN_MAGIC         "MAGMABIN"
+#define MAGMA_BIN_VERSION       1
+#define MAGMA_BIN_BYTE_ORDER    0x01020304
+#define MAGMA_BIN_ALIGNMENT     4096
+#define MAGMA_BIN_MAX_SECTIONS  8
+
+typedef struct magma_bin_header
+{
+    char     magic[8];                      // MAGMA_BIN_MAGIC, not terminated
+    int32_t  version;                       // MAGMA_BIN_VERSION
+    int32_t  byte_order;                    // MAGMA_BIN_BYTE_ORDER as written
+    int32_t  value_size;                    // sizeof of one value
+    int32_t  num_components;                // 2 for complex, 1 for real values
+    int32_t  index_size;                    // sizeof(magma_index_t)
+    int32_t  storage_type;
+    int32_t  sym;
+    int32_t  diagorder_type;
+    int32_t  fill_mode;
+    int32_t  num_sections;
+    int64_t  num_rows;
+    int64_t  num_cols;
+    int64_t  nnz;
+    int64_t  true_nnz;
+    int64_t  max_nnz_row;
+    int64_t  diameter;
+    int64_t  blocksize;
+    int64_t  numblocks;
+    int64_t  alignment;
+    int64_t  csr5_sigma;
+    int64_t  csr5_bit_y_offset;
+    int64_t  csr5_bit_scansum_offset;
+    int64_t  csr5_num_packets;
+    int64_t  csr5_p;
+    int64_t  csr5_num_offsets;
+    int64_t  csr5_tail_tile_start;
+    int64_t  file_size;                     // total size in bytes
+    int64_t  offset[ MAGMA_BIN_MAX_SECTIONS ];  // section offsets in bytes
+    int64_t  size[ MAGMA_BIN_MAX_SECTIONS ];    // section sizes in bytes
+} magma_bin_header;
+
+int mm_is_magma_bin(const char *fname);
+
 
 #endif
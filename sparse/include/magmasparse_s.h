@@ -5,7 +5,7 @@
  Univ. of Colorado, Denver
  @date
 
- @generated from sparse/include/magmasparse_z.h, normal z -> s, Sat Mar 27 20:33:22 2021
+ @generated from sparse/include/magmasparse_z.h, normal z -> s, Fri Oct 16 22:49:24 2026
  @author Hartwig Anzt
 */
 
@@ -97,6 +97,17 @@ magma_s_csr_mtx(
     const char *filename,
     magma_queue_t queue );
 
+magma_int_t
+magma_s_csr_bin(
+    magma_s_matrix *A,
+    const char *filename,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smfree_bin(
+    magma_s_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t 
 magma_scsrset( 
     magma_int_t m, 
@@ -368,6 +379,14 @@ magma_sindexsortval(
     magma_int_t last,
     magma_queue_t queue );
 
+magma_int_t
+magma_sindexsortval_segments(
+    magma_int_t num_segments,
+    magma_index_t *ptr,
+    magma_index_t *x,
+    float *y,
+    magma_queue_t queue );
+
 magma_int_t
 magma_sorderstatistics(
     float *val,
@@ -424,6 +443,15 @@ magma_sselectrandom(
     magma_int_t k,
     magma_queue_t queue );
 
+magma_int_t
+magma_ssampleselect_cpu(
+    float *a,
+    magma_int_t size,
+    magma_int_t k,
+    float tol,
+    float *thrs,
+    magma_queue_t queue );
+
 magma_int_t
 magma_sdomainoverlap(
     magma_index_t num_rows,
@@ -461,6 +489,12 @@ magma_swrite_csrtomtx(
     const char *filename,
     magma_queue_t queue );
 
+magma_int_t
+magma_swrite_csr_bin(
+    magma_s_matrix A,
+    const char *filename,
+    magma_queue_t queue );
+
 magma_int_t 
 magma_sprint_csr( 
     magma_int_t n_row, 
@@ -635,6 +669,13 @@ magma_sm_5stencil(
     magma_s_matrix *A,
     magma_queue_t queue );
 
+magma_int_t
+magma_sm_stencil(
+    magma_int_t points,
+    magma_int_t n,
+    magma_s_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t
 magma_ssolverinfo(
     magma_s_solver_par *solver_par, 
@@ -694,6 +735,24 @@ magma_sparilu_cpu(
     magma_s_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_sparilu_keepsymbolic(
+    magma_s_matrix hA0,
+    magma_s_matrix hA,
+    magma_s_matrix hAL,
+    magma_s_matrix hAU,
+    magma_s_matrix *ACOO,
+    magma_s_matrix *L,
+    magma_s_matrix *UT,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sparilu_refactor(
+    magma_s_matrix A,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue );
+
 magma_int_t
 magma_sparic_gpu( 
     magma_s_matrix A, 
@@ -844,6 +903,20 @@ magma_smatrix_cup(
     magma_s_matrix *U,
     magma_queue_t queue );
 
+magma_int_t
+magma_smatrix_cup_ws(
+    magma_s_matrix A,
+    magma_s_matrix B,
+    magma_s_matrix *U,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smatrix_reserve(
+    magma_int_t num_rows,
+    magma_int_t nnz,
+    magma_s_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t
 magma_smatrix_cup_gpu(
     magma_s_matrix A,
@@ -897,6 +970,14 @@ magma_sparilut_thrsrm(
     float *thrs,
     magma_queue_t queue );
 
+magma_int_t
+magma_sparilut_thrsrm_ws(
+    magma_int_t order,
+    magma_s_matrix *A,
+    float *thrs,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_sparilut_thrsrm_semilinked(
     magma_s_matrix *U,
@@ -961,6 +1042,13 @@ magma_scsrcoo_transpose(
     magma_s_matrix *B,
     magma_queue_t queue );
 
+magma_int_t
+magma_scsrcoo_transpose_ws(
+    magma_s_matrix A,
+    magma_s_matrix *B,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_sparilut_transpose_select_one(
     magma_s_matrix A,
@@ -1015,6 +1103,15 @@ magma_sparilut_set_thrs_randomselect_approx(
     float *thrs,
     magma_queue_t queue );
 
+magma_int_t
+magma_sparilut_set_thrs_randomselect_approx_ws(
+    magma_int_t num_rm,
+    magma_s_matrix *LU,
+    magma_int_t order,
+    float *thrs,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_sparilut_set_thrs_randomselect_factors(
     magma_int_t num_rm,
@@ -1104,6 +1201,14 @@ magma_sparilut_sweep_sync(
     magma_s_matrix *U,
     magma_queue_t queue );
 
+magma_int_t
+magma_sparilut_sweep_sync_ws(
+    magma_s_matrix *A,
+    magma_s_matrix *L,
+    magma_s_matrix *U,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_sparilut_sweep_gpu( 
     magma_s_matrix *A,
@@ -1271,6 +1376,14 @@ magma_sparilut_cpu(
     magma_s_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_sparilut_cpu_ws(
+    magma_s_matrix A,
+    magma_s_matrix b,
+    magma_s_preconditioner *precond,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_sparilut_gpu(
     magma_s_matrix A,
@@ -1314,6 +1427,29 @@ magma_sparilut_candidates(
     magma_s_matrix *U_new,
     magma_queue_t queue );
 
+magma_int_t
+magma_sparilut_candidates_ws(
+    magma_s_matrix L0,
+    magma_s_matrix U0,
+    magma_s_matrix L,
+    magma_s_matrix U,
+    magma_s_matrix *L_new,
+    magma_s_matrix *U_new,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sparilut_workspace_scratch(
+    magma_int_t index_len,
+    magma_int_t val_len,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sparilut_workspace_free(
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_sparilut_candidates_gpu(
     magma_s_matrix L0,
@@ -1395,6 +1531,13 @@ magma_sparilut_preselect(
     magma_s_matrix *oneA,
     magma_queue_t queue );
 
+magma_int_t
+magma_sparilut_preselect_ws(
+    magma_int_t order,
+    magma_s_matrix *A,
+    magma_s_matrix *oneA,
+    magma_queue_t queue );
+
 magma_int_t
 magma_spreselect_gpu(
     magma_int_t order,
@@ -1608,10 +1751,544 @@ magma_scsr_sort_gpu(
  -- MAGMA_SPARSE function definitions / Data on CPU
 */
 
+magma_int_t
+magma_s_spmv_cpu(
+    float alpha,
+    magma_s_matrix A,
+    magma_s_matrix x,
+    float beta,
+    magma_s_matrix y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgecsrmv_cpu(
+    magma_int_t m, magma_int_t n,
+    float alpha,
+    const float *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smgecsrmv_cpu(
+    magma_order_t major,
+    magma_int_t m, magma_int_t n,
+    magma_int_t num_vecs,
+    float alpha,
+    const float *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgeellmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    float alpha,
+    const float *val,
+    const magma_index_t *col,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgeelltmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    float alpha,
+    const float *val,
+    const magma_index_t *col,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgeellrtmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    float alpha,
+    const float *val,
+    const magma_index_t *col,
+    const magma_index_t *rowlength,
+    const float *x,
+    float beta,
+    float *y,
+    magma_int_t alignment,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgesellpmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t blocksize,
+    magma_int_t slices,
+    float alpha,
+    const float *val,
+    const magma_index_t *col,
+    const magma_index_t *rowptr,
+    const magma_index_t *perm,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smgesellpmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t num_vecs,
+    magma_int_t blocksize,
+    magma_int_t slices,
+    float alpha,
+    const float *val,
+    const magma_index_t *col,
+    const magma_index_t *rowptr,
+    const magma_index_t *perm,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgecsr5mv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t p,
+    float alpha,
+    magma_int_t sigma,
+    const magma_uindex_t *tile_ptr,
+    const float *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgecoomv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz,
+    float alpha,
+    const float *val,
+    const magma_index_t *rowidx,
+    const magma_index_t *col,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgebcsrmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t blocksize,
+    float alpha,
+    const float *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgestencilmv_cpu(
+    magma_int_t points,
+    magma_int_t n,
+    float alpha,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgevbcsrmv_cpu(
+    magma_int_t m,
+    magma_int_t numblocks,
+    float alpha,
+    const float *val,
+    const magma_index_t *valptr,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magma_index_t *part,
+    const float *x,
+    float beta,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smvbcsr(
+    magma_s_matrix A,
+    magma_int_t max_bs,
+    magma_s_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smvbcsrtocsr(
+    magma_s_matrix A,
+    magma_s_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_svbcsr_bjacobi_setup_cpu(
+    magma_s_matrix A,
+    magma_s_matrix *D,
+    magma_queue_t queue );
+
+magma_int_t
+magma_svbcsr_bjacobi_apply_cpu(
+    magma_s_matrix D,
+    magma_s_matrix b,
+    magma_s_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sspgemm_symbolic_cpu(
+    magma_s_matrix A,
+    magma_s_matrix B,
+    magma_s_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sspgemm_numeric_cpu(
+    float alpha,
+    magma_s_matrix A,
+    magma_s_matrix B,
+    magma_s_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sspgemm_cpu(
+    float alpha,
+    magma_s_matrix A,
+    magma_s_matrix B,
+    magma_s_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ssptrsv_analysis_cpu(
+    magma_uplo_t uplo,
+    magma_s_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ssptrsv_free_cpu(
+    magma_sptrsv_info *analysis,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ssptrsv_levels_cpu(
+    magma_s_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_s_matrix b,
+    magma_s_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ssptrsv_syncfree_cpu(
+    magma_s_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_s_matrix b,
+    magma_s_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_ssptrsv_cpu(
+    magma_s_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_solver_type trisolver,
+    magma_s_matrix b,
+    magma_s_matrix *x,
+    magma_queue_t queue );
+
+float
+magma_sdot_cpu(
+    magma_int_t n,
+    const float *x,
+    const float *y,
+    magma_queue_t queue );
+
+float
+magma_snrm2_cpu(
+    magma_int_t n,
+    const float *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smdotc_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const float *V,
+    magma_int_t ldv,
+    const float *w,
+    float *h,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smaxpy_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const float *V,
+    magma_int_t ldv,
+    const float *h,
+    float *w,
+    float *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_scgmerge_spmv1_cpu(
+    magma_s_matrix A,
+    const float *d,
+    float *z,
+    float *dz,
+    magma_queue_t queue );
+
+magma_int_t
+magma_scgmerge_xrbeta_cpu(
+    magma_int_t n,
+    float alpha,
+    float *x,
+    float *r,
+    float *d,
+    const float *z,
+    float *rr,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbicgstab_1_cpu(
+    magma_int_t n,
+    float beta,
+    float omega,
+    const float *r,
+    const float *v,
+    float *p,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbicgmerge_spmv1_cpu(
+    magma_s_matrix A,
+    const float *rr,
+    const float *p,
+    float *v,
+    float *rrv,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbicgstab_2_cpu(
+    magma_int_t n,
+    float alpha,
+    const float *r,
+    const float *v,
+    float *s,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbicgmerge_spmv2_cpu(
+    magma_s_matrix A,
+    const float *s,
+    float *t,
+    float *ts,
+    float *tt,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbicgstab_3_cpu(
+    magma_int_t n,
+    float alpha,
+    float omega,
+    const float *p,
+    const float *s,
+    const float *t,
+    const float *rr,
+    float *x,
+    float *r,
+    float *rho,
+    float *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_scacg_spmv_cpu(
+    magma_s_matrix A,
+    const float *r,
+    float *w,
+    float *rr,
+    float *rw,
+    magma_queue_t queue );
+
+magma_int_t
+magma_scacg_update_cpu(
+    magma_int_t n,
+    float alpha,
+    float beta,
+    float *x,
+    float *r,
+    float *p,
+    float *s,
+    const float *w,
+    magma_queue_t queue );
+
+magma_int_t
+magma_spipegmres_spmv_cpu(
+    magma_s_matrix A,
+    magma_int_t k,
+    const float *V,
+    magma_int_t ldv,
+    const float *z,
+    float *w,
+    float *h,
+    float *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_spipegmres_update_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const float *V,
+    const float *Z,
+    magma_int_t ldv,
+    const float *h,
+    float eta,
+    const float *z,
+    const float *w,
+    float *v,
+    float *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbcgmerge_spmv_cpu(
+    magma_s_matrix A,
+    magma_int_t nv,
+    const float *P,
+    float *Q,
+    float *den,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbcgmerge_xr_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    const float *alpha,
+    float *X,
+    float *R,
+    const float *P,
+    const float *Q,
+    float *rr,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbmdotc_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const float *V,
+    magma_int_t ldv,
+    const float *W,
+    float *h,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbmaxpy_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const float *V,
+    magma_int_t ldv,
+    const float *h,
+    float *W,
+    float *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbcompact_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t nk,
+    const magma_int_t *keep,
+    float *X,
+    float *work,
+    magma_queue_t queue );
+
+magma_int_t
+magma_scg_cpu(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_matrix *x, magma_s_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbicgstab_cpu(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_matrix *x, magma_s_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sgmres_cpu(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_matrix *x, magma_s_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_scacg_cpu(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_matrix *x, magma_s_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_spipegmres_cpu(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_matrix *x, magma_s_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbcg_cpu(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_matrix *x, magma_s_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sbgmres_cpu(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_matrix *x, magma_s_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_spcg_cpu(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_matrix *x, magma_s_solver_par *solver_par,
+    magma_s_preconditioner *precond_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_spbicgstab_cpu(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_matrix *x, magma_s_solver_par *solver_par,
+    magma_s_preconditioner *precond_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_spgmres_cpu(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_matrix *x, magma_s_solver_par *solver_par,
+    magma_s_preconditioner *precond_par,
+    magma_queue_t queue );
+
 
 /* ////////////////////////////////////////////////////////////////////////////
  -- MAGMA_SPARSE supernodal and RCM reordering
 */
+magma_int_t
+magma_smrowblocks(
+    magma_s_matrix A,
+    magma_int_t max_bs,
+    magma_int_t *num_blocks,
+    magma_index_t **start,
+    magma_queue_t queue );
+
 magma_int_t
 magma_smsupernodal(
     magma_int_t *max_bs,
@@ -1628,6 +2305,51 @@ magma_smvarsizeblockstruct(
     magma_s_matrix *A,
     magma_queue_t queue );
 
+magma_int_t
+magma_smreorder(
+    magma_s_matrix A,
+    magma_reorder_t order,
+    magma_index_t **perm,
+    magma_s_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smtune_analyze(
+    magma_s_matrix A,
+    magma_location_t location,
+    magma_s_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smtune_benchmark(
+    magma_s_matrix A,
+    magma_location_t location,
+    magma_s_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smtune(
+    magma_s_matrix A,
+    magma_location_t location,
+    magma_tune_t mode,
+    magma_s_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_smpermute(
+    magma_s_matrix A,
+    magma_index_t *perm,
+    magma_s_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_svpermute(
+    magma_trans_t trans,
+    magma_index_t *perm,
+    magma_s_matrix x,
+    magma_s_matrix *y,
+    magma_queue_t queue );
+
 
 
 /* ////////////////////////////////////////////////////////////////////////////
@@ -2346,6 +3068,13 @@ magma_s_precondsetup(
     magma_s_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_s_precond_refactor(
+    magma_s_matrix A, magma_s_matrix b,
+    magma_s_solver_par *solver,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue );
+
 magma_int_t
 magma_s_applyprecond(
     magma_s_matrix A, magma_s_matrix b, 
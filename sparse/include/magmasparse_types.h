@@ -21,8 +21,10 @@
 #include <omp.h>
 #endif
 
-// includes CUDA
+// includes CUDA; the host backend has no cuSPARSE
+#if ! defined(HAVE_HOST)
 #include <cusparse_v2.h>
+#endif
 
 
 /* (author: Cade Brown <cbrow216@vols.utk.edu>
@@ -150,6 +152,15 @@ typedef struct magma_z_matrix
     magma_index_t      csr5_tail_tile_start;    // opt: info for CSR5
     magma_order_t      major;                   // opt: row/col major for dense matrices
     magma_int_t        ld;                      // opt: leading dimension for dense
+    magma_precision    mp_format;               // opt: value precision for CSRMP
+    void               *mp_val;                 // opt: low precision values for CSRMP
+    double             *mp_scale;               // opt: row scaling for CSRMP
+    unsigned short     *mp_col;                 // opt: 16-bit column offsets for CSRMP
+    magma_int_t        sellp_sigma;             // opt: row sorting window for SELL-C-sigma
+    magma_index_t      *sellp_perm;             // opt: row permutation for SELL-C-sigma CPU case
+    magma_int_t        stencil_points;          // opt: stencil points for matrix-free STENCIL
+    magma_int_t        stencil_grid;            // opt: grid points per dimension for STENCIL
+    magma_index_t      *vbcsr_valptr;           // opt: offsets of the blocks for VBCSR CPU case
 } magma_z_matrix;
 
 typedef struct magma_c_matrix
@@ -223,6 +234,15 @@ typedef struct magma_c_matrix
     magma_index_t      csr5_tail_tile_start;    // opt: info for CSR5
     magma_order_t      major;                   // opt: row/col major for dense matrices
     magma_int_t        ld;                      // opt: leading dimension for dense
+    magma_precision    mp_format;               // opt: value precision for CSRMP
+    void               *mp_val;                 // opt: low precision values for CSRMP
+    float              *mp_scale;               // opt: row scaling for CSRMP
+    unsigned short     *mp_col;                 // opt: 16-bit column offsets for CSRMP
+    magma_int_t        sellp_sigma;             // opt: row sorting window for SELL-C-sigma
+    magma_index_t      *sellp_perm;             // opt: row permutation for SELL-C-sigma CPU case
+    magma_int_t        stencil_points;          // opt: stencil points for matrix-free STENCIL
+    magma_int_t        stencil_grid;            // opt: grid points per dimension for STENCIL
+    magma_index_t      *vbcsr_valptr;           // opt: offsets of the blocks for VBCSR CPU case
 } magma_c_matrix;
 
 
@@ -297,6 +317,15 @@ typedef struct magma_d_matrix
     magma_index_t      csr5_tail_tile_start;    // opt: info for CSR5
     magma_order_t      major;                   // opt: row/col major for dense matrices
     magma_int_t        ld;                      // opt: leading dimension for dense
+    magma_precision    mp_format;               // opt: value precision for CSRMP
+    void               *mp_val;                 // opt: low precision values for CSRMP
+    double             *mp_scale;               // opt: row scaling for CSRMP
+    unsigned short     *mp_col;                 // opt: 16-bit column offsets for CSRMP
+    magma_int_t        sellp_sigma;             // opt: row sorting window for SELL-C-sigma
+    magma_index_t      *sellp_perm;             // opt: row permutation for SELL-C-sigma CPU case
+    magma_int_t        stencil_points;          // opt: stencil points for matrix-free STENCIL
+    magma_int_t        stencil_grid;            // opt: grid points per dimension for STENCIL
+    magma_index_t      *vbcsr_valptr;           // opt: offsets of the blocks for VBCSR CPU case
 } magma_d_matrix;
 
 
@@ -371,6 +400,15 @@ typedef struct magma_s_matrix
     magma_index_t      csr5_tail_tile_start;    // opt: info for CSR5
     magma_order_t      major;                   // opt: row/col major for dense matrices
     magma_int_t        ld;                      // opt: leading dimension for dense
+    magma_precision    mp_format;               // opt: value precision for CSRMP
+    void               *mp_val;                 // opt: low precision values for CSRMP
+    float              *mp_scale;               // opt: row scaling for CSRMP
+    unsigned short     *mp_col;                 // opt: 16-bit column offsets for CSRMP
+    magma_int_t        sellp_sigma;             // opt: row sorting window for SELL-C-sigma
+    magma_index_t      *sellp_perm;             // opt: row permutation for SELL-C-sigma CPU case
+    magma_int_t        stencil_points;          // opt: stencil points for matrix-free STENCIL
+    magma_int_t        stencil_grid;            // opt: grid points per dimension for STENCIL
+    magma_index_t      *vbcsr_valptr;           // opt: offsets of the blocks for VBCSR CPU case
 } magma_s_matrix;
 
 
@@ -455,6 +493,7 @@ typedef struct magma_z_solver_par
     magma_ortho_t      ortho;                   // for GMRES
     magma_int_t        numiter;                 // feedback: number of needed iterations
     magma_int_t        spmv_count;              // feedback: number of needed SpMV - can be different to iteration count
+    magma_int_t        reduction_count;         // feedback: number of global reductions (synchronization points)
     double             init_res;                // feedback: initial residual
     double             final_res;               // feedback: final residual
     double             iter_res;                // feedback: iteratively computed residual
@@ -494,6 +533,7 @@ typedef struct magma_c_solver_par
     magma_ortho_t      ortho;                   // for GMRES
     magma_int_t        numiter;                 // feedback: number of needed iterations
     magma_int_t        spmv_count;              // feedback: number of needed SpMV - can be different to iteration count
+    magma_int_t        reduction_count;         // feedback: number of global reductions (synchronization points)
     float              init_res;                // feedback: initial residual
     float              final_res;               // feedback: final residual
     float              iter_res;                // feedback: iteratively computed residual
@@ -533,6 +573,7 @@ typedef struct magma_d_solver_par
     magma_ortho_t      ortho;                   // for GMRES
     magma_int_t        numiter;                 // feedback: number of needed iterations
     magma_int_t        spmv_count;              // feedback: number of needed SpMV - can be different to iteration count
+    magma_int_t        reduction_count;         // feedback: number of global reductions (synchronization points)
     double             init_res;                // feedback: initial residual
     double             final_res;               // feedback: final residual
     double             iter_res;                // feedback: iteratively computed residual
@@ -572,6 +613,7 @@ typedef struct magma_s_solver_par
     magma_ortho_t      ortho;                   // for GMRES
     magma_int_t        numiter;                 // feedback: number of needed iterations
     magma_int_t        spmv_count;              // feedback: number of needed SpMV - can be different to iteration count
+    magma_int_t        reduction_count;         // feedback: number of global reductions (synchronization points)
     float              init_res;                // feedback: initial residual
     float              final_res;               // feedback: final residual
     float              iter_res;                // feedback: iteratively computed residual
@@ -602,9 +644,163 @@ typedef struct magma_s_solver_par
 
 
 
+//************            ParILUT workspace               ********************//
+
+typedef struct magma_z_parilut_workspace
+{
+    magma_int_t        num_rows;                // dimension the workspace is set up for
+    magma_z_matrix     L;                       // current factors, candidates and
+    magma_z_matrix     U;                       // temporaries of the ParILUT sweeps;
+    magma_z_matrix     UT;                      // host CSR, true_nnz holds the
+    magma_z_matrix     hL;                      // allocated length of val, col
+    magma_z_matrix     hU;                      // and rowidx
+    magma_z_matrix     oneL;
+    magma_z_matrix     oneU;
+    magma_z_matrix     L_new;
+    magma_z_matrix     U_new;
+    magma_z_matrix     B;
+    magma_index_t      *index;                  // index scratch
+    magma_int_t        index_len;
+    magmaDoubleComplex *val;                    // value scratch
+    magma_int_t        val_len;
+} magma_z_parilut_workspace;
+
+typedef struct magma_c_parilut_workspace
+{
+    magma_int_t        num_rows;                // dimension the workspace is set up for
+    magma_c_matrix     L;                       // current factors, candidates and
+    magma_c_matrix     U;                       // temporaries of the ParILUT sweeps;
+    magma_c_matrix     UT;                      // host CSR, true_nnz holds the
+    magma_c_matrix     hL;                      // allocated length of val, col
+    magma_c_matrix     hU;                      // and rowidx
+    magma_c_matrix     oneL;
+    magma_c_matrix     oneU;
+    magma_c_matrix     L_new;
+    magma_c_matrix     U_new;
+    magma_c_matrix     B;
+    magma_index_t      *index;                  // index scratch
+    magma_int_t        index_len;
+    magmaFloatComplex  *val;                    // value scratch
+    magma_int_t        val_len;
+} magma_c_parilut_workspace;
+
+typedef struct magma_d_parilut_workspace
+{
+    magma_int_t        num_rows;                // dimension the workspace is set up for
+    magma_d_matrix     L;                       // current factors, candidates and
+    magma_d_matrix     U;                       // temporaries of the ParILUT sweeps;
+    magma_d_matrix     UT;                      // host CSR, true_nnz holds the
+    magma_d_matrix     hL;                      // allocated length of val, col
+    magma_d_matrix     hU;                      // and rowidx
+    magma_d_matrix     oneL;
+    magma_d_matrix     oneU;
+    magma_d_matrix     L_new;
+    magma_d_matrix     U_new;
+    magma_d_matrix     B;
+    magma_index_t      *index;                  // index scratch
+    magma_int_t        index_len;
+    double             *val;                    // value scratch
+    magma_int_t        val_len;
+} magma_d_parilut_workspace;
+
+typedef struct magma_s_parilut_workspace
+{
+    magma_int_t        num_rows;                // dimension the workspace is set up for
+    magma_s_matrix     L;                       // current factors, candidates and
+    magma_s_matrix     U;                       // temporaries of the ParILUT sweeps;
+    magma_s_matrix     UT;                      // host CSR, true_nnz holds the
+    magma_s_matrix     hL;                      // allocated length of val, col
+    magma_s_matrix     hU;                      // and rowidx
+    magma_s_matrix     oneL;
+    magma_s_matrix     oneU;
+    magma_s_matrix     L_new;
+    magma_s_matrix     U_new;
+    magma_s_matrix     B;
+    magma_index_t      *index;                  // index scratch
+    magma_int_t        index_len;
+    float              *val;                    // value scratch
+    magma_int_t        val_len;
+} magma_s_parilut_workspace;
+
+
+
+//************     symbolic data kept for refactorization    ****************//
+
+typedef struct magma_z_refactor_info
+{
+    magma_int_t        num_rows;                // dimension and nonzeros of the
+    magma_int_t        nnz;                     // matrix the structure was kept for
+    magma_index_t      *Amap;                   // A entry -> filled pattern entry
+    magma_index_t      *Lmap;                   // filled entry -> L entry, or -1
+    magma_index_t      *Umap;                   // filled entry -> U^T entry, or -1
+    magma_index_t      *UTmap;                  // U^T entry -> U entry
+    magma_z_matrix     ACOO;                    // sweep input and iterates, kept
+    magma_z_matrix     L;                       // where the setup ran the sweeps
+    magma_z_matrix     UT;
+} magma_z_refactor_info;
+
+typedef struct magma_c_refactor_info
+{
+    magma_int_t        num_rows;                // dimension and nonzeros of the
+    magma_int_t        nnz;                     // matrix the structure was kept for
+    magma_index_t      *Amap;                   // A entry -> filled pattern entry
+    magma_index_t      *Lmap;                   // filled entry -> L entry, or -1
+    magma_index_t      *Umap;                   // filled entry -> U^T entry, or -1
+    magma_index_t      *UTmap;                  // U^T entry -> U entry
+    magma_c_matrix     ACOO;                    // sweep input and iterates, kept
+    magma_c_matrix     L;                       // where the setup ran the sweeps
+    magma_c_matrix     UT;
+} magma_c_refactor_info;
+
+typedef struct magma_d_refactor_info
+{
+    magma_int_t        num_rows;                // dimension and nonzeros of the
+    magma_int_t        nnz;                     // matrix the structure was kept for
+    magma_index_t      *Amap;                   // A entry -> filled pattern entry
+    magma_index_t      *Lmap;                   // filled entry -> L entry, or -1
+    magma_index_t      *Umap;                   // filled entry -> U^T entry, or -1
+    magma_index_t      *UTmap;                  // U^T entry -> U entry
+    magma_d_matrix     ACOO;                    // sweep input and iterates, kept
+    magma_d_matrix     L;                       // where the setup ran the sweeps
+    magma_d_matrix     UT;
+} magma_d_refactor_info;
+
+typedef struct magma_s_refactor_info
+{
+    magma_int_t        num_rows;                // dimension and nonzeros of the
+    magma_int_t        nnz;                     // matrix the structure was kept for
+    magma_index_t      *Amap;                   // A entry -> filled pattern entry
+    magma_index_t      *Lmap;                   // filled entry -> L entry, or -1
+    magma_index_t      *Umap;                   // filled entry -> U^T entry, or -1
+    magma_index_t      *UTmap;                  // U^T entry -> U entry
+    magma_s_matrix     ACOO;                    // sweep input and iterates, kept
+    magma_s_matrix     L;                       // where the setup ran the sweeps
+    magma_s_matrix     UT;
+} magma_s_refactor_info;
+
+
+
+//************        host sparse triangular solve          ****************//
+
+typedef struct magma_sptrsv_info
+{
+    magma_int_t        num_rows;                // analysis of a triangular CSR
+    magma_uplo_t       uplo;                    // matrix for the host SpTRSV
+    magma_int_t        num_levels;              // number of level sets
+    magma_index_t      *level_ptr;              // level l holds the rows
+    magma_index_t      *level_rows;             // level_rows[level_ptr[l]:level_ptr[l+1]]
+    magma_index_t      *diag;                   // position of the diagonal in each row
+    magma_int_t        *ready;                  // row completion flags (sync-free)
+    magma_int_t        epoch;                   // flag value marking "done" in this solve
+} magma_sptrsv_info;
+
+
+
 //************            preconditioner parameters       ********************//
 
-#if CUDA_VERSION < 11000
+#if defined(HAVE_HOST)
+    #define magma_solve_info_t void*
+#elif CUDA_VERSION < 11000
     #define magma_solve_info_t cusparseSolveAnalysisInfo_t
 #else
     #define magma_solve_info_t csrsm2Info_t
@@ -666,6 +862,10 @@ typedef struct magma_z_preconditioner
     magma_solve_info_t cuinfoU;
     magma_solve_info_t cuinfoUT;
     
+    magma_sptrsv_info       sptrsvL;                   // host SpTRSV analysis of L
+    magma_sptrsv_info       sptrsvU;                   // host SpTRSV analysis of U
+    magma_z_refactor_info  refactor;                  // kept by the setup for refactorization
+    
     magma_bool_t            transpose;                 // need the transpose for the solver?
 #if defined(HAVE_PASTIX)
     pastix_data_t*          pastix_data;
@@ -728,6 +928,10 @@ typedef struct magma_c_preconditioner
     magma_solve_info_t cuinfoUT;
     
     
+    magma_sptrsv_info       sptrsvL;                   // host SpTRSV analysis of L
+    magma_sptrsv_info       sptrsvU;                   // host SpTRSV analysis of U
+    magma_c_refactor_info  refactor;                  // kept by the setup for refactorization
+    
     magma_bool_t            transpose;                 // need the transpose for the solver?
 #if defined(HAVE_PASTIX)
     pastix_data_t*          pastix_data;
@@ -789,6 +993,10 @@ typedef struct magma_d_preconditioner
     magma_solve_info_t cuinfoU;
     magma_solve_info_t cuinfoUT;
     
+    magma_sptrsv_info       sptrsvL;                   // host SpTRSV analysis of L
+    magma_sptrsv_info       sptrsvU;                   // host SpTRSV analysis of U
+    magma_d_refactor_info  refactor;                  // kept by the setup for refactorization
+    
     magma_bool_t            transpose;                 // need the transpose for the solver?
 #if defined(HAVE_PASTIX)
     pastix_data_t*          pastix_data;
@@ -850,6 +1058,10 @@ typedef struct magma_s_preconditioner
     magma_solve_info_t cuinfoU;
     magma_solve_info_t cuinfoUT;
     
+    magma_sptrsv_info       sptrsvL;                   // host SpTRSV analysis of L
+    magma_sptrsv_info       sptrsvU;                   // host SpTRSV analysis of U
+    magma_s_refactor_info  refactor;                  // kept by the setup for refactorization
+    
     magma_bool_t            transpose;                 // need the transpose for the solver?
 #if defined(HAVE_PASTIX)
     pastix_data_t*          pastix_data;
@@ -875,10 +1087,14 @@ typedef struct magma_zopts
     magma_trans_t           trans;
     magma_int_t             blocksize;
     magma_int_t             alignment;
+    magma_int_t             sigma;
     magma_storage_t         output_format;
     magma_location_t        input_location;
     magma_location_t        output_location;
     magma_scale_t           scaling;
+    magma_reorder_t         reordering;
+    magma_int_t             nrhs;
+    magma_tune_t            tune;
 } magma_zopts;
 
 typedef struct magma_copts
@@ -891,10 +1107,14 @@ typedef struct magma_copts
     magma_trans_t           trans;
     magma_int_t             blocksize;
     magma_int_t             alignment;
+    magma_int_t             sigma;
     magma_storage_t         output_format;
     magma_location_t        input_location;
     magma_location_t        output_location;
     magma_scale_t           scaling;
+    magma_reorder_t         reordering;
+    magma_int_t             nrhs;
+    magma_tune_t            tune;
 } magma_copts;
 
 typedef struct magma_dopts
@@ -907,10 +1127,14 @@ typedef struct magma_dopts
     magma_trans_t           trans;
     magma_int_t             blocksize;
     magma_int_t             alignment;
+    magma_int_t             sigma;
     magma_storage_t         output_format;
     magma_location_t        input_location;
     magma_location_t        output_location;
     magma_scale_t           scaling;
+    magma_reorder_t         reordering;
+    magma_int_t             nrhs;
+    magma_tune_t            tune;
 } magma_dopts;
 
 typedef struct magma_sopts
@@ -923,10 +1147,14 @@ typedef struct magma_sopts
     magma_trans_t           trans;
     magma_int_t             blocksize;
     magma_int_t             alignment;
+    magma_int_t             sigma;
     magma_storage_t         output_format;
     magma_location_t        input_location;
     magma_location_t        output_location;
     magma_scale_t           scaling;
+    magma_reorder_t         reordering;
+    magma_int_t             nrhs;
+    magma_tune_t            tune;
 } magma_sopts;
 
 #ifdef __cplusplus
@@ -97,6 +97,17 @@ magma_z_csr_mtx(
     const char *filename,
     magma_queue_t queue );
 
+magma_int_t
+magma_z_csr_bin(
+    magma_z_matrix *A,
+    const char *filename,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmfree_bin(
+    magma_z_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t 
 magma_zcsrset( 
     magma_int_t m, 
@@ -368,6 +379,14 @@ magma_zindexsortval(
     magma_int_t last,
     magma_queue_t queue );
 
+magma_int_t
+magma_zindexsortval_segments(
+    magma_int_t num_segments,
+    magma_index_t *ptr,
+    magma_index_t *x,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zorderstatistics(
     magmaDoubleComplex *val,
@@ -424,6 +443,15 @@ magma_zselectrandom(
     magma_int_t k,
     magma_queue_t queue );
 
+magma_int_t
+magma_zsampleselect_cpu(
+    magmaDoubleComplex *a,
+    magma_int_t size,
+    magma_int_t k,
+    double tol,
+    double *thrs,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zdomainoverlap(
     magma_index_t num_rows,
@@ -461,6 +489,12 @@ magma_zwrite_csrtomtx(
     const char *filename,
     magma_queue_t queue );
 
+magma_int_t
+magma_zwrite_csr_bin(
+    magma_z_matrix A,
+    const char *filename,
+    magma_queue_t queue );
+
 magma_int_t 
 magma_zprint_csr( 
     magma_int_t n_row, 
@@ -635,6 +669,13 @@ magma_zm_5stencil(
     magma_z_matrix *A,
     magma_queue_t queue );
 
+magma_int_t
+magma_zm_stencil(
+    magma_int_t points,
+    magma_int_t n,
+    magma_z_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zsolverinfo(
     magma_z_solver_par *solver_par, 
@@ -694,6 +735,24 @@ magma_zparilu_cpu(
     magma_z_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_zparilu_keepsymbolic(
+    magma_z_matrix hA0,
+    magma_z_matrix hA,
+    magma_z_matrix hAL,
+    magma_z_matrix hAU,
+    magma_z_matrix *ACOO,
+    magma_z_matrix *L,
+    magma_z_matrix *UT,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zparilu_refactor(
+    magma_z_matrix A,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zparic_gpu( 
     magma_z_matrix A, 
@@ -844,6 +903,20 @@ magma_zmatrix_cup(
     magma_z_matrix *U,
     magma_queue_t queue );
 
+magma_int_t
+magma_zmatrix_cup_ws(
+    magma_z_matrix A,
+    magma_z_matrix B,
+    magma_z_matrix *U,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmatrix_reserve(
+    magma_int_t num_rows,
+    magma_int_t nnz,
+    magma_z_matrix *A,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zmatrix_cup_gpu(
     magma_z_matrix A,
@@ -897,6 +970,14 @@ magma_zparilut_thrsrm(
     double *thrs,
     magma_queue_t queue );
 
+magma_int_t
+magma_zparilut_thrsrm_ws(
+    magma_int_t order,
+    magma_z_matrix *A,
+    double *thrs,
+    magma_z_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zparilut_thrsrm_semilinked(
     magma_z_matrix *U,
@@ -961,6 +1042,13 @@ magma_zcsrcoo_transpose(
     magma_z_matrix *B,
     magma_queue_t queue );
 
+magma_int_t
+magma_zcsrcoo_transpose_ws(
+    magma_z_matrix A,
+    magma_z_matrix *B,
+    magma_z_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zparilut_transpose_select_one(
     magma_z_matrix A,
@@ -1015,6 +1103,15 @@ magma_zparilut_set_thrs_randomselect_approx(
     double *thrs,
     magma_queue_t queue );
 
+magma_int_t
+magma_zparilut_set_thrs_randomselect_approx_ws(
+    magma_int_t num_rm,
+    magma_z_matrix *LU,
+    magma_int_t order,
+    double *thrs,
+    magma_z_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zparilut_set_thrs_randomselect_factors(
     magma_int_t num_rm,
@@ -1104,6 +1201,14 @@ magma_zparilut_sweep_sync(
     magma_z_matrix *U,
     magma_queue_t queue );
 
+magma_int_t
+magma_zparilut_sweep_sync_ws(
+    magma_z_matrix *A,
+    magma_z_matrix *L,
+    magma_z_matrix *U,
+    magma_z_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zparilut_sweep_gpu( 
     magma_z_matrix *A,
@@ -1271,6 +1376,14 @@ magma_zparilut_cpu(
     magma_z_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_zparilut_cpu_ws(
+    magma_z_matrix A,
+    magma_z_matrix b,
+    magma_z_preconditioner *precond,
+    magma_z_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zparilut_gpu(
     magma_z_matrix A,
@@ -1314,6 +1427,29 @@ magma_zparilut_candidates(
     magma_z_matrix *U_new,
     magma_queue_t queue );
 
+magma_int_t
+magma_zparilut_candidates_ws(
+    magma_z_matrix L0,
+    magma_z_matrix U0,
+    magma_z_matrix L,
+    magma_z_matrix U,
+    magma_z_matrix *L_new,
+    magma_z_matrix *U_new,
+    magma_z_parilut_workspace *ws,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zparilut_workspace_scratch(
+    magma_int_t index_len,
+    magma_int_t val_len,
+    magma_z_parilut_workspace *ws,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zparilut_workspace_free(
+    magma_z_parilut_workspace *ws,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zparilut_candidates_gpu(
     magma_z_matrix L0,
@@ -1395,6 +1531,13 @@ magma_zparilut_preselect(
     magma_z_matrix *oneA,
     magma_queue_t queue );
 
+magma_int_t
+magma_zparilut_preselect_ws(
+    magma_int_t order,
+    magma_z_matrix *A,
+    magma_z_matrix *oneA,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zpreselect_gpu(
     magma_int_t order,
@@ -1608,10 +1751,544 @@ magma_zcsr_sort_gpu(
  -- MAGMA_SPARSE function definitions / Data on CPU
 */
 
+magma_int_t
+magma_z_spmv_cpu(
+    magmaDoubleComplex alpha,
+    magma_z_matrix A,
+    magma_z_matrix x,
+    magmaDoubleComplex beta,
+    magma_z_matrix y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgecsrmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmgecsrmv_cpu(
+    magma_order_t major,
+    magma_int_t m, magma_int_t n,
+    magma_int_t num_vecs,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgeellmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgeelltmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgeellrtmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz_per_row,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *col,
+    const magma_index_t *rowlength,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_int_t alignment,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgesellpmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t blocksize,
+    magma_int_t slices,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *col,
+    const magma_index_t *rowptr,
+    const magma_index_t *perm,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmgesellpmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t num_vecs,
+    magma_int_t blocksize,
+    magma_int_t slices,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *col,
+    const magma_index_t *rowptr,
+    const magma_index_t *perm,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgecsr5mv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t p,
+    magmaDoubleComplex alpha,
+    magma_int_t sigma,
+    const magma_uindex_t *tile_ptr,
+    const magmaDoubleComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgecoomv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t nnz,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *rowidx,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgebcsrmv_cpu(
+    magma_int_t m, magma_int_t n,
+    magma_int_t blocksize,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgestencilmv_cpu(
+    magma_int_t points,
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgevbcsrmv_cpu(
+    magma_int_t m,
+    magma_int_t numblocks,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *val,
+    const magma_index_t *valptr,
+    const magma_index_t *row,
+    const magma_index_t *col,
+    const magma_index_t *part,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmvbcsr(
+    magma_z_matrix A,
+    magma_int_t max_bs,
+    magma_z_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmvbcsrtocsr(
+    magma_z_matrix A,
+    magma_z_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zvbcsr_bjacobi_setup_cpu(
+    magma_z_matrix A,
+    magma_z_matrix *D,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zvbcsr_bjacobi_apply_cpu(
+    magma_z_matrix D,
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zspgemm_symbolic_cpu(
+    magma_z_matrix A,
+    magma_z_matrix B,
+    magma_z_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zspgemm_numeric_cpu(
+    magmaDoubleComplex alpha,
+    magma_z_matrix A,
+    magma_z_matrix B,
+    magma_z_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zspgemm_cpu(
+    magmaDoubleComplex alpha,
+    magma_z_matrix A,
+    magma_z_matrix B,
+    magma_z_matrix *C,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zsptrsv_analysis_cpu(
+    magma_uplo_t uplo,
+    magma_z_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zsptrsv_free_cpu(
+    magma_sptrsv_info *analysis,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zsptrsv_levels_cpu(
+    magma_z_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zsptrsv_syncfree_cpu(
+    magma_z_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zsptrsv_cpu(
+    magma_z_matrix T,
+    magma_sptrsv_info *analysis,
+    magma_solver_type trisolver,
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_queue_t queue );
+
+magmaDoubleComplex
+magma_zdotc_cpu(
+    magma_int_t n,
+    const magmaDoubleComplex *x,
+    const magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+double
+magma_dznrm2_cpu(
+    magma_int_t n,
+    const magmaDoubleComplex *x,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmdotc_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    magma_int_t ldv,
+    const magmaDoubleComplex *w,
+    magmaDoubleComplex *h,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmaxpy_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    magma_int_t ldv,
+    const magmaDoubleComplex *h,
+    magmaDoubleComplex *w,
+    double *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zcgmerge_spmv1_cpu(
+    magma_z_matrix A,
+    const magmaDoubleComplex *d,
+    magmaDoubleComplex *z,
+    magmaDoubleComplex *dz,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zcgmerge_xrbeta_cpu(
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex *x,
+    magmaDoubleComplex *r,
+    magmaDoubleComplex *d,
+    const magmaDoubleComplex *z,
+    double *rr,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbicgstab_1_cpu(
+    magma_int_t n,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex omega,
+    const magmaDoubleComplex *r,
+    const magmaDoubleComplex *v,
+    magmaDoubleComplex *p,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbicgmerge_spmv1_cpu(
+    magma_z_matrix A,
+    const magmaDoubleComplex *rr,
+    const magmaDoubleComplex *p,
+    magmaDoubleComplex *v,
+    magmaDoubleComplex *rrv,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbicgstab_2_cpu(
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *r,
+    const magmaDoubleComplex *v,
+    magmaDoubleComplex *s,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbicgmerge_spmv2_cpu(
+    magma_z_matrix A,
+    const magmaDoubleComplex *s,
+    magmaDoubleComplex *t,
+    magmaDoubleComplex *ts,
+    magmaDoubleComplex *tt,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbicgstab_3_cpu(
+    magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex omega,
+    const magmaDoubleComplex *p,
+    const magmaDoubleComplex *s,
+    const magmaDoubleComplex *t,
+    const magmaDoubleComplex *rr,
+    magmaDoubleComplex *x,
+    magmaDoubleComplex *r,
+    magmaDoubleComplex *rho,
+    double *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zcacg_spmv_cpu(
+    magma_z_matrix A,
+    const magmaDoubleComplex *r,
+    magmaDoubleComplex *w,
+    double *rr,
+    double *rw,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zcacg_update_cpu(
+    magma_int_t n,
+    double alpha,
+    double beta,
+    magmaDoubleComplex *x,
+    magmaDoubleComplex *r,
+    magmaDoubleComplex *p,
+    magmaDoubleComplex *s,
+    const magmaDoubleComplex *w,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zpipegmres_spmv_cpu(
+    magma_z_matrix A,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    magma_int_t ldv,
+    const magmaDoubleComplex *z,
+    magmaDoubleComplex *w,
+    magmaDoubleComplex *h,
+    double *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zpipegmres_update_cpu(
+    magma_int_t n,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    const magmaDoubleComplex *Z,
+    magma_int_t ldv,
+    const magmaDoubleComplex *h,
+    double eta,
+    const magmaDoubleComplex *z,
+    const magmaDoubleComplex *w,
+    magmaDoubleComplex *v,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbcgmerge_spmv_cpu(
+    magma_z_matrix A,
+    magma_int_t nv,
+    const magmaDoubleComplex *P,
+    magmaDoubleComplex *Q,
+    magmaDoubleComplex *den,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbcgmerge_xr_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    const magmaDoubleComplex *alpha,
+    magmaDoubleComplex *X,
+    magmaDoubleComplex *R,
+    const magmaDoubleComplex *P,
+    const magmaDoubleComplex *Q,
+    double *rr,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbmdotc_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    magma_int_t ldv,
+    const magmaDoubleComplex *W,
+    magmaDoubleComplex *h,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbmaxpy_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t k,
+    const magmaDoubleComplex *V,
+    magma_int_t ldv,
+    const magmaDoubleComplex *h,
+    magmaDoubleComplex *W,
+    double *nrm,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbcompact_cpu(
+    magma_int_t n,
+    magma_int_t nv,
+    magma_int_t nk,
+    const magma_int_t *keep,
+    magmaDoubleComplex *X,
+    magmaDoubleComplex *work,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zcg_cpu(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_matrix *x, magma_z_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbicgstab_cpu(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_matrix *x, magma_z_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgmres_cpu(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_matrix *x, magma_z_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zcacg_cpu(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_matrix *x, magma_z_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zpipegmres_cpu(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_matrix *x, magma_z_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbcg_cpu(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_matrix *x, magma_z_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zbgmres_cpu(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_matrix *x, magma_z_solver_par *solver_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zpcg_cpu(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_matrix *x, magma_z_solver_par *solver_par,
+    magma_z_preconditioner *precond_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zpbicgstab_cpu(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_matrix *x, magma_z_solver_par *solver_par,
+    magma_z_preconditioner *precond_par,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zpgmres_cpu(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_matrix *x, magma_z_solver_par *solver_par,
+    magma_z_preconditioner *precond_par,
+    magma_queue_t queue );
+
 
 /* ////////////////////////////////////////////////////////////////////////////
  -- MAGMA_SPARSE supernodal and RCM reordering
 */
+magma_int_t
+magma_zmrowblocks(
+    magma_z_matrix A,
+    magma_int_t max_bs,
+    magma_int_t *num_blocks,
+    magma_index_t **start,
+    magma_queue_t queue );
+
 magma_int_t
 magma_zmsupernodal(
     magma_int_t *max_bs,
@@ -1628,6 +2305,51 @@ magma_zmvarsizeblockstruct(
     magma_z_matrix *A,
     magma_queue_t queue );
 
+magma_int_t
+magma_zmreorder(
+    magma_z_matrix A,
+    magma_reorder_t order,
+    magma_index_t **perm,
+    magma_z_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmtune_analyze(
+    magma_z_matrix A,
+    magma_location_t location,
+    magma_z_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmtune_benchmark(
+    magma_z_matrix A,
+    magma_location_t location,
+    magma_z_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmtune(
+    magma_z_matrix A,
+    magma_location_t location,
+    magma_tune_t mode,
+    magma_z_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zmpermute(
+    magma_z_matrix A,
+    magma_index_t *perm,
+    magma_z_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zvpermute(
+    magma_trans_t trans,
+    magma_index_t *perm,
+    magma_z_matrix x,
+    magma_z_matrix *y,
+    magma_queue_t queue );
+
 
 
 /* ////////////////////////////////////////////////////////////////////////////
@@ -2346,6 +3068,13 @@ magma_z_precondsetup(
     magma_z_preconditioner *precond,
     magma_queue_t queue );
 
+magma_int_t
+magma_z_precond_refactor(
+    magma_z_matrix A, magma_z_matrix b,
+    magma_z_solver_par *solver,
+    magma_z_preconditioner *precond,
+    magma_queue_t queue );
+
 magma_int_t
 magma_z_applyprecond(
     magma_z_matrix A, magma_z_matrix b, 
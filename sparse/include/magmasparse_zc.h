@@ -99,6 +99,31 @@ magma_zlag2c_CSR_DENSE_convert(
  -- MAGMA_SPARSE function definitions / Data on CPU
 */
 
+magma_int_t
+magma_zmcsrmp(
+    magma_z_matrix A,
+    magma_precision format,
+    magma_z_matrix *B,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zgecsrmpmv_cpu(
+    magmaDoubleComplex alpha,
+    magma_z_matrix A,
+    const magmaDoubleComplex *x,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex *y,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zcir_cpu(
+    magma_z_matrix A,
+    magma_z_matrix b,
+    magma_z_matrix *x,
+    magma_z_solver_par *solver_par,
+    magma_z_preconditioner *precond_par,
+    magma_queue_t queue );
+
 
 /* ////////////////////////////////////////////////////////////////////////////
  -- MAGMA_SPARSE function definitions / Data on CPU / Multi-GPU
@@ -0,0 +1,468 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/src/zbgmres_cpu.cpp, normal z -> c, Fri Oct 16 19:00:18 2026
+*/
+#include "magmasparse_internal.h"
+
+#define PRECISION_c
+
+// simulate 2-D arrays at the cost of some arithmetic, V(j) is the row-major
+// block of the j-th basis vectors, H(a,i,j), s(a,i), cs(a,i) and sn(a,i)
+// belong to the column in slot a
+#define V(j) (V+(j)*ldv)
+#define H(a,i,j) (H[((a)*dim+(j))*m1+(i)])
+#define S(a,i) (s[(a)*m1+(i)])
+#define CS(a,i) (cs[(a)*dim+(i)])
+#define SN(a,i) (sn[(a)*dim+(i)])
+
+
+static void
+GeneratePlaneRotation(magmaFloatComplex dx, magmaFloatComplex dy, magmaFloatComplex *cs, magmaFloatComplex *sn)
+{
+#if defined(PRECISION_s) | defined(PRECISION_d)
+    if (dy == MAGMA_C_ZERO) {
+        *cs = MAGMA_C_ONE;
+        *sn = MAGMA_C_ZERO;
+    } else if (MAGMA_C_ABS((dy)) > MAGMA_C_ABS((dx))) {
+        magmaFloatComplex temp = dx / dy;
+        *sn = MAGMA_C_ONE / magma_csqrt( ( MAGMA_C_ONE + temp*temp));
+        *cs = temp * (*sn);
+    } else {
+        magmaFloatComplex temp = dy / dx;
+        *cs = MAGMA_C_ONE / magma_csqrt( ( MAGMA_C_ONE + temp*temp ));
+        *sn = temp * (*cs);
+    }
+#else
+    real_Double_t rho = sqrt(MAGMA_C_REAL(MAGMA_C_CONJ(dx)*dx + MAGMA_C_CONJ(dy)*dy));
+    *cs = dx / rho;
+    *sn = dy / rho;
+#endif
+}
+
+static void ApplyPlaneRotation(magmaFloatComplex *dx, magmaFloatComplex *dy, magmaFloatComplex cs, magmaFloatComplex sn)
+{
+#if defined(PRECISION_s) | defined(PRECISION_d)
+    magmaFloatComplex temp = (*dx);
+    *dx =  cs * (*dx) + sn * (*dy);
+    *dy = -sn * temp + cs * (*dy);
+#else
+    magmaFloatComplex temp  =  MAGMA_C_CONJ(cs) * (*dx) +  MAGMA_C_CONJ(sn) * (*dy);
+    *dy = -(sn) * (*dx) + cs * (*dy);
+    *dx = temp;
+#endif
+}
+
+
+/**
+    Solves the upper triangular system of the least squares problem of the
+    column in slot a in place.
+*/
+static void
+magma_cbgmres_backsolve(
+    magma_int_t i, magma_int_t a, magma_int_t dim,
+    const magmaFloatComplex *H, magmaFloatComplex *s )
+{
+    magma_int_t m1 = dim+1; // used inside H macro
+    for (magma_int_t j = i; j >= 0; j--)
+    {
+        S(a,j) /= H(a,j,j);
+        for (magma_int_t k = j-1; k >= 0; k--)
+            S(a,k) -= H(a,k,j) * S(a,j);
+    }
+}
+
+
+/**
+    Purpose
+    -------
+
+    Solves a system of linear equations
+       A * X = B
+    for multiple right-hand sides, where A is a complex sparse matrix. B and
+    X are blocks of nrhs vectors stored column-major in host memory, either
+    as n-by-nrhs matrices or as vectors of length n*nrhs.
+    This is a CPU implementation of the restarted GMRES method for multiple
+    right-hand sides (see magma_cgmres_cpu): every column builds its own
+    Krylov basis, but all columns share one sweep over A per iteration, and
+    the CGS2 orthogonalization of all columns is done in the same sweeps
+    over the basis (magma_cbmdotc_cpu, magma_cbmaxpy_cpu). Internally, the
+    basis vectors are kept in row-major blocks. A column reaching the
+    stopping criterion is deflated: its solution is updated and written
+    back, and it is removed from the blocks, such that the following sweeps
+    only carry the active columns.
+    A has to be stored in CSR or SELL-P. The residuals returned in
+    solver_par are the largest ones over all columns, spmv_count counts the
+    sweeps over A.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_c_matrix
+                descriptor for matrix A
+
+    @param[in]
+    b           magma_c_matrix
+                RHS block B
+
+    @param[in,out]
+    x           magma_c_matrix*
+                solution approximation, contains the initial guess on entry
+
+    @param[in,out]
+    solver_par  magma_c_solver_par*
+                solver parameters
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_cgesv
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_cbgmres_cpu(
+    magma_c_matrix A, magma_c_matrix b, magma_c_matrix *x,
+    magma_c_solver_par *solver_par,
+    magma_queue_t queue )
+{
+    magma_int_t info = MAGMA_NOTCONVERGED;
+
+    magma_int_t dofs = A.num_rows;
+
+    // prepare solver feedback
+    solver_par->solver = Magma_GMRES;
+    solver_par->numiter = 0;
+    solver_par->spmv_count = 0;
+    solver_par->reduction_count = 0;
+
+    //Chronometry
+    real_Double_t tempo1, tempo2;
+
+    magma_int_t dim = solver_par->restart;
+    magma_int_t m1 = dim+1; // used inside H macro
+    magma_int_t nrhs = 0, na = 0, nk, ldv = 0;
+    magma_int_t i, j, k;
+    bool converged = false;
+
+    float betanom = 0.0;
+
+    magmaFloatComplex *V={0}, *X={0}, *B={0}, *W={0};
+    magmaFloatComplex *H={0}, *h={0}, *h2={0}, *s={0}, *cs={0}, *sn={0};
+    magmaFloatComplex *scal={0};
+    float *nrm={0}, *nomb={0}, *res={0}, *iter_res={0}, *residual={0};
+    magma_int_t *col={0}, *keep={0};
+    magma_c_matrix r={Magma_CSR}, vx={Magma_CSR}, vy={Magma_CSR};
+
+    if ( A.memory_location != Magma_CPU || b.memory_location != Magma_CPU ||
+         dofs == 0 || (b.num_rows * b.num_cols) % dofs != 0 ||
+         x->num_rows * x->num_cols != b.num_rows * b.num_cols ||
+         ( b.num_cols > 1 && ( b.major != MagmaColMajor ||
+                               x->major != MagmaColMajor )) ) {
+        printf("error: the CPU block solver requires a column-major RHS block in host memory.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+    nrhs = b.num_rows * b.num_cols / dofs;
+    ldv = dofs * nrhs;
+
+    CHECK( magma_cmalloc_cpu( &V, ldv*(dim+1) ));
+    CHECK( magma_cmalloc_cpu( &X, ldv ));
+    CHECK( magma_cmalloc_cpu( &B, ldv ));
+    CHECK( magma_cmalloc_cpu( &W, ldv ));
+    CHECK( magma_cmalloc_cpu( &H, nrhs*(dim+1)*dim ));
+    CHECK( magma_cmalloc_cpu( &h, nrhs*(dim+1) ));
+    CHECK( magma_cmalloc_cpu( &h2, nrhs*(dim+1) ));
+    CHECK( magma_cmalloc_cpu( &s, nrhs*(dim+1) ));
+    CHECK( magma_cmalloc_cpu( &cs, nrhs*dim ));
+    CHECK( magma_cmalloc_cpu( &sn, nrhs*dim ));
+    CHECK( magma_cmalloc_cpu( &scal, nrhs ));
+    CHECK( magma_smalloc_cpu( &nrm, nrhs ));
+    CHECK( magma_smalloc_cpu( &nomb, nrhs ));
+    CHECK( magma_smalloc_cpu( &res, nrhs ));
+    CHECK( magma_smalloc_cpu( &iter_res, nrhs ));
+    CHECK( magma_smalloc_cpu( &residual, nrhs ));
+    CHECK( magma_imalloc_cpu( &col, nrhs ));
+    CHECK( magma_imalloc_cpu( &keep, nrhs ));
+
+    // X = x and B = b in row-major order
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t l = 0; l < dofs; l++) {
+        for (magma_int_t v = 0; v < nrhs; v++) {
+            X[ l*nrhs+v ] = x->val[ v*dofs+l ];
+            B[ l*nrhs+v ] = b.val[ v*dofs+l ];
+        }
+    }
+    na = nrhs;
+    for (magma_int_t v = 0; v < nrhs; v++) {
+        col[v] = v;
+    }
+    CHECK( magma_cbmaxpy_cpu( dofs, na, 0, NULL, 0, NULL, B, nomb, queue ));
+    solver_par->reduction_count++;
+    for (magma_int_t v = 0; v < nrhs; v++) {
+        nomb[v] = sqrt( nomb[v] );
+        if ( nomb[v] == 0.0 ) {
+            nomb[v] = 1.0;
+        }
+    }
+
+    tempo1 = magma_wtime();
+    do
+    {
+        // V(0) = B - A X
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t l = 0; l < dofs*na; l++) {
+            V(0)[l] = B[l];
+        }
+        CHECK( magma_cvset( dofs, na, X, &vx, queue ));
+        CHECK( magma_cvset( dofs, na, V(0), &vy, queue ));
+        vx.major = MagmaRowMajor;
+        vy.major = MagmaRowMajor;
+        CHECK( magma_c_spmv_cpu( MAGMA_C_NEG_ONE, A, vx, MAGMA_C_ONE, vy, queue ));
+        solver_par->numiter++;
+        solver_par->spmv_count++;
+        CHECK( magma_cbmaxpy_cpu( dofs, na, 0, NULL, 0, NULL, V(0), nrm, queue ));
+        solver_par->reduction_count++;
+        betanom = 0.0;
+        for (magma_int_t a = 0; a < na; a++) {
+            res[a] = sqrt( nrm[a] );
+            betanom = max( betanom, res[a] );
+        }
+        if ( magma_c_isnan_inf( MAGMA_C_MAKE( betanom, 0.0 ) ) ) {
+            info = MAGMA_DIVERGENCE;
+            break;
+        }
+        if (solver_par->numiter == 1){
+            solver_par->init_res = betanom;
+            if ( solver_par->verbose > 0 ) {
+                solver_par->res_vec[0] = (real_Double_t) betanom;
+                solver_par->timing[0] = 0.0;
+            }
+        }
+
+        // deflate the converged columns
+        nk = 0;
+        for (magma_int_t a = 0; a < na; a++) {
+            iter_res[ col[a] ] = res[a];
+            if ( res[a] < solver_par->atol ||
+                 res[a]/nomb[a] < solver_par->rtol ) {
+                magma_int_t c = col[a];
+                #pragma omp parallel for schedule(static)
+                for (magma_int_t l = 0; l < dofs; l++) {
+                    x->val[ c*dofs+l ] = X[ l*na+a ];
+                }
+            } else {
+                keep[nk] = a;
+                col[nk] = col[a];
+                nomb[nk] = nomb[a];
+                res[nk] = res[a];
+                nk++;
+            }
+        }
+        if ( nk < na ) {
+            CHECK( magma_cbcompact_cpu( dofs, na, nk, keep, X, W, queue ));
+            CHECK( magma_cbcompact_cpu( dofs, na, nk, keep, B, W, queue ));
+            CHECK( magma_cbcompact_cpu( dofs, na, nk, keep, V(0), W, queue ));
+            na = nk;
+        }
+        if ( na == 0 ) {
+            converged = true;
+            break;
+        }
+
+        // V(0) = V(0) / beta
+        for (magma_int_t a = 0; a < na; a++) {
+            scal[a] = MAGMA_C_MAKE( 1.0 / res[a], 0.0 );
+            for (i = 1; i < dim+1; i++)
+                S(a,i) = MAGMA_C_ZERO;
+            S(a,0) = MAGMA_C_MAKE( res[a], 0.0 );
+        }
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t l = 0; l < dofs; l++) {
+            for (magma_int_t a = 0; a < na; a++) {
+                V(0)[ l*na+a ] = scal[a] * V(0)[ l*na+a ];
+            }
+        }
+
+        i = -1;
+        do {
+            i++;
+
+            // V(i+1) = A V(i)
+            CHECK( magma_cvset( dofs, na, V(i), &vx, queue ));
+            CHECK( magma_cvset( dofs, na, V(i+1), &vy, queue ));
+            vx.major = MagmaRowMajor;
+            vy.major = MagmaRowMajor;
+            CHECK( magma_c_spmv_cpu( MAGMA_C_ONE, A, vx, MAGMA_C_ZERO, vy, queue ));
+            solver_par->numiter++;
+            solver_par->spmv_count++;
+
+            // CGS2 of all columns: H(a,0:i,i) = V(0:i)' V(i+1), V(i+1) -= V(0:i) H(a,0:i,i), twice
+            CHECK( magma_cbmdotc_cpu( dofs, na, i+1, V, ldv, V(i+1), h, queue ));
+            CHECK( magma_cbmaxpy_cpu( dofs, na, i+1, V, ldv, h, V(i+1), NULL, queue ));
+            CHECK( magma_cbmdotc_cpu( dofs, na, i+1, V, ldv, V(i+1), h2, queue ));
+            CHECK( magma_cbmaxpy_cpu( dofs, na, i+1, V, ldv, h2, V(i+1), nrm, queue ));
+            solver_par->reduction_count += 3;
+
+            betanom = 0.0;
+            for (magma_int_t a = 0; a < na; a++) {
+                for (k = 0; k <= i; k++) {
+                    H(a,k,i) = h[ k*na+a ] + h2[ k*na+a ];
+                }
+                H(a,i+1,i) = MAGMA_C_MAKE( sqrt( nrm[a] ), 0. );      // H(a,i+1,i) = ||r||
+                scal[a] = ( nrm[a] > 0.0 ) ? MAGMA_C_ONE / H(a,i+1,i) : MAGMA_C_ZERO;
+
+                for (k = 0; k < i; k++)
+                    ApplyPlaneRotation(&H(a,k,i), &H(a,k+1,i), CS(a,k), SN(a,k));
+
+                GeneratePlaneRotation(H(a,i,i), H(a,i+1,i), &CS(a,i), &SN(a,i));
+                ApplyPlaneRotation(&H(a,i,i), &H(a,i+1,i), CS(a,i), SN(a,i));
+                ApplyPlaneRotation(&S(a,i), &S(a,i+1), CS(a,i), SN(a,i));
+
+                res[a] = MAGMA_C_ABS( S(a,i+1) );
+                betanom = max( betanom, res[a] );
+            }
+            // V(i+1) = V(i+1) / H(a,i+1,i)
+            #pragma omp parallel for schedule(static)
+            for (magma_int_t l = 0; l < dofs; l++) {
+                for (magma_int_t a = 0; a < na; a++) {
+                    V(i+1)[ l*na+a ] = scal[a] * V(i+1)[ l*na+a ];
+                }
+            }
+
+            if ( solver_par->verbose > 0 ) {
+                tempo2 = magma_wtime();
+                if ( (solver_par->numiter)%solver_par->verbose==0 ) {
+                    solver_par->res_vec[(solver_par->numiter)/solver_par->verbose]
+                            = (real_Double_t) betanom;
+                    solver_par->timing[(solver_par->numiter)/solver_par->verbose]
+                            = (real_Double_t) tempo2-tempo1;
+                }
+            }
+
+            // deflate the converged columns: x = X + V(0:i) s(0:i)
+            nk = 0;
+            for (magma_int_t a = 0; a < na; a++) {
+                iter_res[ col[a] ] = res[a];
+                if ( res[a] <= solver_par->atol ||
+                     res[a]/nomb[a] <= solver_par->rtol ) {
+                    magma_int_t c = col[a];
+                    magma_cbgmres_backsolve( i, a, dim, H, s );
+                    #pragma omp parallel for schedule(static)
+                    for (magma_int_t l = 0; l < dofs; l++) {
+                        magmaFloatComplex tmp = X[ l*na+a ];
+                        for (magma_int_t jj = 0; jj <= i; jj++) {
+                            tmp += S(a,jj) * V(jj)[ l*na+a ];
+                        }
+                        x->val[ c*dofs+l ] = tmp;
+                    }
+                } else {
+                    if ( nk < a ) {
+                        for (k = 0; k < (dim+1)*dim; k++) {
+                            H[ nk*(dim+1)*dim+k ] = H[ a*(dim+1)*dim+k ];
+                        }
+                        for (k = 0; k < dim+1; k++) {
+                            S(nk,k) = S(a,k);
+                        }
+                        for (k = 0; k < dim; k++) {
+                            CS(nk,k) = CS(a,k);
+                            SN(nk,k) = SN(a,k);
+                        }
+                    }
+                    keep[nk] = a;
+                    col[nk] = col[a];
+                    nomb[nk] = nomb[a];
+                    nk++;
+                }
+            }
+            if ( nk < na ) {
+                CHECK( magma_cbcompact_cpu( dofs, na, nk, keep, X, W, queue ));
+                CHECK( magma_cbcompact_cpu( dofs, na, nk, keep, B, W, queue ));
+                for (j = 0; j <= i+1; j++) {
+                    CHECK( magma_cbcompact_cpu( dofs, na, nk, keep, V(j), W, queue ));
+                }
+                na = nk;
+            }
+        }
+        while ( na > 0 && i+1 < dim && solver_par->numiter+1 <= solver_par->maxiter );
+
+        // update the solution X = X + V(0:i) s(0:i) of the remaining columns
+        for (magma_int_t a = 0; a < na; a++) {
+            magma_cbgmres_backsolve( i, a, dim, H, s );
+        }
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t l = 0; l < dofs; l++) {
+            for (magma_int_t a = 0; a < na; a++) {
+                magmaFloatComplex tmp = X[ l*na+a ];
+                for (magma_int_t jj = 0; jj <= i; jj++) {
+                    tmp += S(a,jj) * V(jj)[ l*na+a ];
+                }
+                X[ l*na+a ] = tmp;
+            }
+        }
+        if ( na == 0 ) {
+            converged = true;
+        }
+    }
+    while ( na > 0 && solver_par->numiter+1 <= solver_par->maxiter );
+
+    // write back the columns that did not converge
+    for (magma_int_t a = 0; a < na; a++) {
+        magma_int_t c = col[a];
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t l = 0; l < dofs; l++) {
+            x->val[ c*dofs+l ] = X[ l*na+a ];
+        }
+    }
+
+    tempo2 = magma_wtime();
+    solver_par->runtime = (real_Double_t) tempo2-tempo1;
+    CHECK( magma_cvinit( &r, Magma_CPU, dofs, nrhs, MAGMA_C_ZERO, queue ));
+    CHECK( magma_cresidualvec( A, b, *x, &r, residual, queue ));
+    solver_par->iter_res = 0.0;
+    solver_par->final_res = 0.0;
+    for (magma_int_t v = 0; v < nrhs; v++) {
+        solver_par->iter_res = max( solver_par->iter_res, iter_res[v] );
+        solver_par->final_res = max( solver_par->final_res, residual[v] );
+    }
+
+    if ( info == MAGMA_DIVERGENCE ) {
+        // keep the error code
+    } else if ( converged ) {
+        info = MAGMA_SUCCESS;
+    } else if ( solver_par->init_res > solver_par->final_res ) {
+        info = MAGMA_SLOW_CONVERGENCE;
+    }
+    else {
+        info = MAGMA_DIVERGENCE;
+    }
+
+cleanup:
+    magma_free_cpu( V );
+    magma_free_cpu( X );
+    magma_free_cpu( B );
+    magma_free_cpu( W );
+    magma_free_cpu( H );
+    magma_free_cpu( h );
+    magma_free_cpu( h2 );
+    magma_free_cpu( s );
+    magma_free_cpu( cs );
+    magma_free_cpu( sn );
+    magma_free_cpu( scal );
+    magma_free_cpu( nrm );
+    magma_free_cpu( nomb );
+    magma_free_cpu( res );
+    magma_free_cpu( iter_res );
+    magma_free_cpu( residual );
+    magma_free_cpu( col );
+    magma_free_cpu( keep );
+    magma_cmfree( &r, queue );
+
+    solver_par->info = info;
+    return info;
+} /* magma_cbgmres_cpu */
@@ -0,0 +1,190 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/src/zcg_cpu.cpp, normal z -> c, Fri Oct 16 18:51:59 2026
+*/
+
+#include "magmasparse_internal.h"
+
+
+/**
+    Purpose
+    -------
+
+    Solves a system of linear equations
+       A * X = B
+    where A is a complex Hermitian positive definite matrix.
+    This is a CPU implementation of the merged Conjugate Gradient method
+    (see magma_ccg_merge): all linear algebra objects are expected in host
+    memory, the SpMV is fused with the dot product d' * z, and the vector
+    updates are fused with the residual norm and the direction update.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_c_matrix
+                input matrix A
+
+    @param[in]
+    b           magma_c_matrix
+                RHS b
+
+    @param[in,out]
+    x           magma_c_matrix*
+                solution approximation
+
+    @param[in,out]
+    solver_par  magma_c_solver_par*
+                solver parameters
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_cposv
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_ccg_cpu(
+    magma_c_matrix A, magma_c_matrix b, magma_c_matrix *x,
+    magma_c_solver_par *solver_par,
+    magma_queue_t queue )
+{
+    magma_int_t info = MAGMA_NOTCONVERGED;
+
+    // prepare solver feedback
+    solver_par->solver = Magma_CGMERGE;
+    solver_par->numiter = 0;
+    solver_par->spmv_count = 0;
+    solver_par->reduction_count = 0;
+
+    // solver variables
+    magmaFloatComplex alpha, den;
+    float nom, nom0, betanom, nomb, residual;
+
+    // some useful variables
+    magmaFloatComplex c_zero = MAGMA_C_ZERO;
+    magma_int_t dofs = A.num_rows;
+
+    magma_c_matrix r={Magma_CSR}, d={Magma_CSR}, z={Magma_CSR};
+
+    //Chronometry
+    real_Double_t tempo1, tempo2;
+
+    if ( A.memory_location != Magma_CPU || b.num_cols != 1 ) {
+        printf("error: the CPU solver requires one RHS in host memory.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    // CPU workspace
+    CHECK( magma_cvinit( &r, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_cvinit( &d, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_cvinit( &z, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+
+    // solver setup
+    for (magma_int_t i = 0; i < dofs; i++) {
+        x->val[i] = c_zero;                                             // x = 0
+        r.val[i] = b.val[i];                                            // r = b
+        d.val[i] = b.val[i];                                            // d = r
+    }
+    nom0 = betanom = magma_scnrm2_cpu( dofs, r.val, queue );
+    solver_par->reduction_count++;
+    nom = nom0 * nom0;                                                  // nom = r' * r
+    solver_par->init_res = nom0;
+
+    nomb = magma_scnrm2_cpu( dofs, b.val, queue );
+    solver_par->reduction_count++;
+    if ( nomb == 0.0 ){
+        nomb=1.0;
+    }
+
+    solver_par->final_res = solver_par->init_res;
+    solver_par->iter_res = solver_par->init_res;
+    if( nom0 < solver_par->atol ||
+        nom0/nomb < solver_par->rtol ){
+        info = MAGMA_SUCCESS;
+        goto cleanup;
+    }
+    if ( solver_par->verbose > 0 ) {
+        solver_par->res_vec[0] = (real_Double_t) nom0;
+        solver_par->timing[0] = 0.0;
+    }
+
+    tempo1 = magma_wtime();
+
+    // start iteration
+    do
+    {
+        solver_par->numiter++;
+
+        // z = A d, den = d' * z
+        CHECK( magma_ccgmerge_spmv1_cpu( A, d.val, z.val, &den, queue ));
+        solver_par->spmv_count++;
+        solver_par->reduction_count++;
+        // check positive definite
+        if ( MAGMA_C_REAL( den ) <= 0.0 ) {
+            info = MAGMA_NONSPD;
+            break;
+        }
+        alpha = MAGMA_C_MAKE( nom, 0.0 ) / den;
+        if( magma_c_isnan_inf( alpha ) ){
+            info = MAGMA_DIVERGENCE;
+            break;
+        }
+        // updates x, r, computes r' * r and updates d
+        CHECK( magma_ccgmerge_xrbeta_cpu( dofs, alpha, x->val, r.val, d.val,
+                                          z.val, &nom, queue ));
+        solver_par->reduction_count++;
+        betanom = sqrt( nom );
+
+        if ( solver_par->verbose > 0 ) {
+            tempo2 = magma_wtime();
+            if ( (solver_par->numiter)%solver_par->verbose==0 ) {
+                solver_par->res_vec[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) betanom;
+                solver_par->timing[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) tempo2-tempo1;
+            }
+        }
+
+        if (  betanom  < solver_par->atol ||
+              betanom/nomb < solver_par->rtol ) {
+            break;
+        }
+    }
+    while ( solver_par->numiter+1 <= solver_par->maxiter );
+
+    tempo2 = magma_wtime();
+    solver_par->runtime = (real_Double_t) tempo2-tempo1;
+    CHECK(  magma_cresidualvec( A, b, *x, &r, &residual, queue));
+    solver_par->iter_res = betanom;
+    solver_par->final_res = residual;
+
+    if ( info == MAGMA_NONSPD || info == MAGMA_DIVERGENCE ) {
+        // keep the error code
+    } else if ( solver_par->numiter < solver_par->maxiter ) {
+        info = MAGMA_SUCCESS;
+    } else if ( solver_par->init_res > solver_par->final_res ) {
+        info = MAGMA_SLOW_CONVERGENCE;
+        if( solver_par->iter_res < solver_par->atol ||
+            solver_par->iter_res/solver_par->init_res < solver_par->rtol ){
+            info = MAGMA_SUCCESS;
+        }
+    }
+    else {
+        info = MAGMA_DIVERGENCE;
+    }
+
+cleanup:
+    magma_cmfree(&r, queue );
+    magma_cmfree(&z, queue );
+    magma_cmfree(&d, queue );
+
+    solver_par->info = info;
+    return info;
+}   /* magma_ccg_cpu */
@@ -7,11 +7,13 @@
 
        @author Hartwig Anzt
 
-       @generated from sparse/src/zgeisai_upper.cpp, normal z -> c, Sat Mar 27 20:33:06 2021
+       @generated from sparse/src/zgeisai_upper.cpp, normal z -> c, Sat Oct 17 00:26:44 2026
 */
 #include "magmasparse_internal.h"
 
+#if ! defined(HAVE_HOST)
 #include <cuda.h>  // for CUDA_VERSION
+#endif
 
 #define PRECISION_c
 
@@ -7,7 +7,7 @@
 
        @author Hartwig Anzt
 
-       @generated from sparse/src/zparic_cpu.cpp, normal z -> c, Sat Mar 27 20:33:03 2021
+       @generated from sparse/src/zparic_cpu.cpp, normal z -> c, Fri Oct 16 22:50:57 2026
 */
 
 #include "magmasparse_internal.h"
@@ -27,7 +27,9 @@
     E. Chow and A. Patel: "Fine-grained Parallel Incomplete LU Factorization", 
     SIAM Journal on Scientific Computing, 37, C169-C193 (2015). 
     
-    This is the CPU implementation of the ParIC
+    This is the CPU implementation of the ParIC. If A and b are in host
+    memory, the factors are kept on the host and applied with the host
+    triangular solves (see magma_csptrsv_cpu).
 
     Arguments
     ---------
@@ -65,6 +67,9 @@ magma_cparic_cpu(
 
     magma_c_matrix hAT={Magma_CSR}, hA={Magma_CSR}, hAL={Magma_CSR}, 
     hAU={Magma_CSR}, hAUT={Magma_CSR}, hAtmp={Magma_CSR}, hACOO={Magma_CSR};
+    // with A and b in host memory, the factors stay on the host
+    magma_location_t location = (A.memory_location == Magma_CPU && 
+        b.memory_location == Magma_CPU) ? Magma_CPU : Magma_DEV;
 
     // copy original matrix as COO to device
     if (A.memory_location != Magma_CPU || A.storage_type != Magma_CSR) {
@@ -100,11 +105,17 @@ magma_cparic_cpu(
     }
     
 
-    CHECK(magma_cmtransfer(hAL, &precond->L, Magma_CPU, Magma_DEV, queue));
-    CHECK(magma_c_cucsrtranspose(precond->L, &precond->U, queue));
-    CHECK(magma_cmtransfer(precond->L, &precond->M, Magma_DEV, Magma_DEV, queue));
+    CHECK(magma_cmtransfer(hAL, &precond->L, Magma_CPU, location, queue));
+    CHECK(magma_cmtranspose(precond->L, &precond->U, queue));
+    CHECK(magma_cmtransfer(precond->L, &precond->M, location, location, queue));
     
-    if (precond->trisolver == 0 || precond->trisolver == Magma_CUSOLVE) {
+    if (location == Magma_CPU) {
+        // level sets for the host triangular solves
+        CHECK(magma_csptrsv_analysis_cpu(MagmaLower, precond->L, 
+            &precond->sptrsvL, queue));
+        CHECK(magma_csptrsv_analysis_cpu(MagmaUpper, precond->U, 
+            &precond->sptrsvU, queue));
+    } else if (precond->trisolver == 0 || precond->trisolver == Magma_CUSOLVE) {
         CHECK(magma_ccumicgeneratesolverinfo(precond, queue));
     } else {
         //prepare for iterative solves
@@ -7,7 +7,7 @@
 
        @author Hartwig Anzt
 
-       @generated from sparse/src/zparict.cpp, normal z -> c, Sat Mar 27 20:33:05 2021
+       @generated from sparse/src/zparict.cpp, normal z -> c, Fri Oct 16 18:32:16 2026
 */
 
 #include "magmasparse_internal.h"
@@ -190,10 +190,7 @@ magma_cparict(
         end = magma_sync_wtime( queue ); t_transpose1+=end-start;
         start = magma_sync_wtime( queue ); 
         magma_cparict_candidates( L0, L, LT, &hL, queue );
-        #pragma omp parallel        
-        for(int row=0; row<hL.num_rows; row++){
-            magma_cindexsort( &hL.col[hL.row[row]], 0, hL.row[row+1]-hL.row[row]-1, queue );
-        }
+        CHECK( magma_ccsr_sort( &hL, queue ) );
         end = magma_sync_wtime( queue ); t_cand=+end-start;
         
         start = magma_sync_wtime( queue );
@@ -7,7 +7,7 @@
 
        @author Hartwig Anzt
 
-       @generated from sparse/src/zparilut.cpp, normal z -> c, Sat Mar 27 20:33:04 2021
+       @generated from sparse/src/zparilut.cpp, normal z -> c, Fri Oct 16 18:32:16 2026
 */
 
 #include "magmasparse_internal.h"
@@ -317,15 +317,9 @@ magma_cparilut(
         end = magma_sync_wtime( queue ); t_selectadd+=end-start;
         
         start = magma_sync_wtime( queue );
-        #pragma omp parallel        
-        for(int row=0; row<hL.num_rows; row++){
-            magma_cindexsort( &hL.col[hL.row[row]], 0, hL.row[row+1]-hL.row[row]-1, queue );
-        }
+        CHECK( magma_ccsr_sort( &hL, queue ) );
 
-        #pragma omp parallel  
-        for(int row=0; row<hL.num_rows; row++){
-            magma_cindexsort( &hU.col[hU.row[row]], 0, hU.row[row+1]-hU.row[row]-1, queue );
-        }
+        CHECK( magma_ccsr_sort( &hU, queue ) );
         CHECK( magma_cmatrix_cup(  L, oneL, &L_new, queue ) );   
         CHECK( magma_cmatrix_cup(  U, oneU, &U_new, queue ) );
         //magma_cmatrix_addrowindex( &U, queue );
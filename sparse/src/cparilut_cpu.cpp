@@ -7,7 +7,7 @@
 
        @author Hartwig Anzt
 
-       @generated from sparse/src/zparilut_cpu.cpp, normal z -> c, Sat Mar 27 20:33:04 2021
+       @generated from sparse/src/zparilut_cpu.cpp, normal z -> c, Fri Oct 16 18:02:39 2026
 */
 
 #include "magmasparse_internal.h"
@@ -72,6 +72,105 @@ magma_cparilut_cpu(
     magma_c_matrix b,
     magma_c_preconditioner *precond,
     magma_queue_t queue)
+{
+    magma_int_t info = 0;
+    magma_c_parilut_workspace ws={0};
+    
+    info = magma_cparilut_cpu_ws(A, b, precond, &ws, queue);
+    
+    magma_cparilut_workspace_free(&ws, queue);
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+    Copies the host CSR matrix A into the workspace matrix B and adds the
+    row indices.
+*/
+static magma_int_t
+magma_cparilut_ws_copy(
+    magma_c_matrix A,
+    magma_c_matrix *B,
+    magma_queue_t queue)
+{
+    magma_int_t info = 0;
+    
+    B->num_cols = A.num_cols;
+    CHECK(magma_cmatrix_reserve(A.num_rows, A.nnz, B, queue));
+    
+    #pragma omp parallel for
+    for (magma_int_t row=0; row<A.num_rows+1; row++) {
+        B->row[row] = A.row[row];
+    }
+    #pragma omp parallel for
+    for (magma_int_t row=0; row<A.num_rows; row++) {
+        for (magma_int_t i=A.row[row]; i<A.row[row+1]; i++) {
+            B->val[i] = A.val[i];
+            B->col[i] = A.col[i];
+            B->rowidx[i] = row;
+        }
+    }
+    
+cleanup:
+    return info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+
+    Generates an incomplete threshold LU preconditioner via the ParILUT 
+    algorithm like magma_cparilut_cpu, but keeps all matrices and scratch the
+    sweeps need in the workspace ws. Once the workspace has grown to the size
+    the sweeps need, the iteration does not allocate any memory. The workspace
+    can be passed to subsequent calls generating the preconditioner for 
+    matrices of the same size (e.g. the same pattern with new values), and is
+    released with magma_cparilut_workspace_free.
+
+    This function requires OpenMP, and is only available if OpenMP is activated.
+    
+    The parameter list is:
+    
+    precond.sweeps : number of ParILUT steps
+    precond.atol   : absolute fill ratio (1.0 keeps nnz count constant)
+
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_c_matrix
+                input matrix A
+
+    @param[in]
+    b           magma_c_matrix
+                input RHS b
+
+    @param[in,out]
+    precond     magma_c_preconditioner*
+                preconditioner parameters
+
+    @param[in,out]
+    ws          magma_c_parilut_workspace*
+                workspace, empty or set up by a previous call
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_cgepr
+*******************************************************************************/
+extern "C"
+magma_int_t
+magma_cparilut_cpu_ws(
+    magma_c_matrix A,
+    magma_c_matrix b,
+    magma_c_preconditioner *precond,
+    magma_c_parilut_workspace *ws,
+    magma_queue_t queue)
 {
     magma_int_t info = 0;
     
@@ -85,9 +184,10 @@ magma_cparilut_cpu(
     float sum, sumL, sumU;
 
     magma_c_matrix hA={Magma_CSR}, hAT={Magma_CSR}, hL={Magma_CSR}, 
-        hU={Magma_CSR}, oneL={Magma_CSR}, oneU={Magma_CSR},
-        L={Magma_CSR}, U={Magma_CSR}, L_new={Magma_CSR}, U_new={Magma_CSR}, 
-        UT={Magma_CSR}, L0={Magma_CSR}, U0={Magma_CSR};
+        hU={Magma_CSR}, L0={Magma_CSR}, U0={Magma_CSR}, T={Magma_CSR};
+    magma_c_matrix *L = &ws->L, *U = &ws->U, *UT = &ws->UT,
+        *L_new = &ws->L_new, *U_new = &ws->U_new, 
+        *oneL = &ws->oneL, *oneU = &ws->oneU;
     magma_int_t num_rmL, num_rmU;
     float thrsL = 0.0;
     float thrsU = 0.0;
@@ -102,6 +202,12 @@ magma_cparilut_cpu(
     
     CHECK(magma_cmtransfer(A, &hA, A.memory_location, Magma_CPU, queue));
     
+    // the workspace is kept as long as the dimension does not change
+    if (ws->num_rows != hA.num_rows) {
+        magma_cparilut_workspace_free(ws, queue);
+        ws->num_rows = hA.num_rows;
+    }
+    
     // in case using fill-in
     if (precond->levels > 0) {
         CHECK(magma_csymbilu(&hA, precond->levels, &hL, &hU , queue));
@@ -110,17 +216,14 @@ magma_cparilut_cpu(
     }
     CHECK(magma_cmatrix_tril(hA, &L0, queue));
     CHECK(magma_cmatrix_triu(hA, &U0, queue));
-    magma_cmfree(&hU, queue);
-    magma_cmfree(&hL, queue);
-    CHECK(magma_cmatrix_tril(hA, &L, queue));
+    CHECK(magma_cparilut_ws_copy(L0, L, queue));
     CHECK(magma_cmtranspose(hA, &hAT, queue));
-    CHECK(magma_cmatrix_tril(hAT, &U, queue));
-    CHECK(magma_cmatrix_addrowindex(&L, queue)); 
-    CHECK(magma_cmatrix_addrowindex(&U, queue)); 
-    L0nnz=L.nnz;
-    U0nnz=U.nnz;
-    oneL.memory_location = Magma_CPU;
-    oneU.memory_location = Magma_CPU;
+    CHECK(magma_cmatrix_tril(hAT, &T, queue));
+    CHECK(magma_cparilut_ws_copy(T, U, queue));
+    magma_cmfree(&T, queue);
+    magma_cmfree(&hAT, queue);
+    L0nnz=L->nnz;
+    U0nnz=U->nnz;
         
     if (timing == 1) {
         printf("ilut_fill_ratio = %.6f;\n\n", precond->atol);  
@@ -137,106 +240,97 @@ magma_cparilut_cpu(
      
         // step 1: transpose U
         start = magma_sync_wtime(queue);
-        magma_cmfree(&UT, queue);
-        CHECK(magma_ccsrcoo_transpose(U, &UT, queue));
+        CHECK(magma_ccsrcoo_transpose_ws(*U, UT, ws, queue));
         end = magma_sync_wtime(queue); t_transpose1+=end-start;
         
         
         // step 2: find candidates
         start = magma_sync_wtime(queue);
-        CHECK(magma_cparilut_candidates(L0, U0, L, UT, &hL, &hU, queue));
+        CHECK(magma_cparilut_candidates_ws(L0, U0, *L, *UT, &ws->hL, &ws->hU, ws, queue));
         end = magma_sync_wtime(queue); t_cand=+end-start;
         
         
         // step 3: compute residuals (optional when adding all candidates)
         start = magma_sync_wtime(queue);
-        CHECK(magma_cparilut_residuals(hA, L, U, &hL, queue));
-        CHECK(magma_cparilut_residuals(hA, L, U, &hU, queue));
+        CHECK(magma_cparilut_residuals(hA, *L, *U, &ws->hL, queue));
+        CHECK(magma_cparilut_residuals(hA, *L, *U, &ws->hU, queue));
         end = magma_sync_wtime(queue); t_res=+end-start;
         start = magma_sync_wtime(queue);
-        CHECK(magma_cmatrix_abssum(hL, &sumL, queue));
-        CHECK(magma_cmatrix_abssum(hU, &sumU, queue));
+        CHECK(magma_cmatrix_abssum(ws->hL, &sumL, queue));
+        CHECK(magma_cmatrix_abssum(ws->hU, &sumU, queue));
         sum = sumL + sumU;
         end = magma_sync_wtime(queue); t_nrm+=end-start;
-        CHECK(magma_cmatrix_swap(&hL, &oneL, queue));
-        magma_cmfree(&hL, queue);
+        CHECK(magma_cmatrix_swap(&ws->hL, oneL, queue));
         
         
         // step 4: sort candidates
         start = magma_sync_wtime(queue);
-        CHECK(magma_ccsr_sort(&hL, queue));
-        CHECK(magma_ccsr_sort(&hU, queue));
+        CHECK(magma_ccsr_sort(&ws->hU, queue));
         end = magma_sync_wtime(queue); t_sort+=end-start;
         
         
         // step 5: transpose candidates
         start = magma_sync_wtime(queue);
-        magma_ccsrcoo_transpose(hU, &oneU, queue);
+        CHECK(magma_ccsrcoo_transpose_ws(ws->hU, oneU, ws, queue));
         end = magma_sync_wtime(queue); t_transpose2+=end-start;
         
         
         // step 6: add candidates
         start = magma_sync_wtime(queue);
-        CHECK(magma_cmatrix_cup(L, oneL, &L_new, queue));   
-        CHECK(magma_cmatrix_cup(U, oneU, &U_new, queue));
+        CHECK(magma_cmatrix_cup_ws(*L, *oneL, L_new, queue));   
+        CHECK(magma_cmatrix_cup_ws(*U, *oneU, U_new, queue));
         end = magma_sync_wtime(queue); t_add=+end-start;
-        magma_cmfree(&oneL, queue);
-        magma_cmfree(&oneU, queue);
        
         
         // step 7: sweep
         start = magma_sync_wtime(queue);
-        CHECK(magma_cparilut_sweep_sync(&hA, &L_new, &U_new, queue));
+        CHECK(magma_cparilut_sweep_sync_ws(&hA, L_new, U_new, ws, queue));
         end = magma_sync_wtime(queue); t_sweep1+=end-start;
         
         
         // step 8: select threshold to remove elements
         start = magma_sync_wtime(queue);
-        num_rmL = max((L_new.nnz-L0nnz*(1+(precond->atol-1.)
+        num_rmL = max((L_new->nnz-L0nnz*(1+(precond->atol-1.)
             *(iters+1)/precond->sweeps)), 0);
-        num_rmU = max((U_new.nnz-U0nnz*(1+(precond->atol-1.)
+        num_rmU = max((U_new->nnz-U0nnz*(1+(precond->atol-1.)
             *(iters+1)/precond->sweeps)), 0);
         // pre-select: ignore the diagonal entries
-        CHECK(magma_cparilut_preselect(0, &L_new, &oneL, queue));
-        CHECK(magma_cparilut_preselect(0, &U_new, &oneU, queue));
+        CHECK(magma_cparilut_preselect_ws(0, L_new, oneL, queue));
+        CHECK(magma_cparilut_preselect_ws(0, U_new, oneU, queue));
         if (num_rmL>0) {
-            CHECK(magma_cparilut_set_thrs_randomselect_approx(num_rmL, 
-                &oneL, 0, &thrsL, queue));
+            CHECK(magma_cparilut_set_thrs_randomselect_approx_ws(num_rmL, 
+                oneL, 0, &thrsL, ws, queue));
         } else {
             thrsL = 0.0;
         }
         if (num_rmU>0) {
-            CHECK(magma_cparilut_set_thrs_randomselect_approx(num_rmU, 
-                &oneU, 0, &thrsU, queue));
+            CHECK(magma_cparilut_set_thrs_randomselect_approx_ws(num_rmU, 
+                oneU, 0, &thrsU, ws, queue));
         } else {
             thrsU = 0.0;
         }
-        magma_cmfree(&oneL, queue);
-        magma_cmfree(&oneU, queue);
         end = magma_sync_wtime(queue); t_selectrm=end-start;
 
         
         // step 9: remove elements
         start = magma_sync_wtime(queue);
-        CHECK(magma_cparilut_thrsrm(1, &L_new, &thrsL, queue));
-        CHECK(magma_cparilut_thrsrm(1, &U_new, &thrsU, queue));
-        CHECK(magma_cmatrix_swap(&L_new, &L, queue));
-        CHECK(magma_cmatrix_swap(&U_new, &U, queue));
-        magma_cmfree(&L_new, queue);
-        magma_cmfree(&U_new, queue);
+        CHECK(magma_cparilut_thrsrm_ws(1, L_new, &thrsL, ws, queue));
+        CHECK(magma_cparilut_thrsrm_ws(1, U_new, &thrsU, ws, queue));
+        CHECK(magma_cmatrix_swap(L_new, L, queue));
+        CHECK(magma_cmatrix_swap(U_new, U, queue));
         end = magma_sync_wtime(queue); t_rm=end-start;
         
         
         // step 10: sweep
         start = magma_sync_wtime(queue);
-        CHECK(magma_cparilut_sweep_sync(&hA, &L, &U, queue));
+        CHECK(magma_cparilut_sweep_sync_ws(&hA, L, U, ws, queue));
         end = magma_sync_wtime(queue); t_sweep2+=end-start;
         
         if (timing == 1) {
             t_total = t_transpose1+ t_cand+ t_res+ t_sort+ t_transpose2+ t_add+ t_sweep1+ t_selectrm+ t_rm+ t_sweep2;
             accum = accum + t_total;
             printf("%5lld %10lld %10lld  %.4e   %.2e  %.2e  %.2e  %.2e  %.2e  %.2e  %.2e  %.2e  %.2e  %.2e  %.2e      %.2e\n",
-                (long long) iters, (long long) L.nnz, (long long) U.nnz, 
+                (long long) iters, (long long) L->nnz, (long long) U->nnz, 
                 (float) sum, 
                 t_transpose1, t_cand, t_res, t_sort, t_transpose2, t_add, t_sweep1, t_selectrm, t_rm, t_sweep2, t_total, accum);
             fflush(stdout);
@@ -250,10 +344,9 @@ magma_cparilut_cpu(
     //##########################################################################
 
     // for CUSPARSE
-    CHECK(magma_cmtransfer(L, &precond->L, Magma_CPU, Magma_DEV , queue));
-    CHECK(magma_ccsrcoo_transpose(U, &UT, queue));
-    //magma_cmtranspose(U, &UT, queue);
-    CHECK(magma_cmtransfer(UT, &precond->U, Magma_CPU, Magma_DEV , queue));
+    CHECK(magma_cmtransfer(*L, &precond->L, Magma_CPU, Magma_DEV , queue));
+    CHECK(magma_ccsrcoo_transpose_ws(*U, UT, ws, queue));
+    CHECK(magma_cmtransfer(*UT, &precond->U, Magma_CPU, Magma_DEV , queue));
     
     if (precond->trisolver == 0 || precond->trisolver == Magma_CUSOLVE) {
         CHECK(magma_ccumilugeneratesolverinfo(precond, queue));
@@ -272,13 +365,9 @@ magma_cparilut_cpu(
 cleanup:
     magma_cmfree(&hA, queue);
     magma_cmfree(&hAT, queue);
-    magma_cmfree(&L, queue);
-    magma_cmfree(&U, queue);
-    magma_cmfree(&UT, queue);
+    magma_cmfree(&T, queue);
     magma_cmfree(&L0, queue);
     magma_cmfree(&U0, queue);
-    magma_cmfree(&L_new, queue);
-    magma_cmfree(&U_new, queue);
     magma_cmfree(&hL, queue);
     magma_cmfree(&hU, queue);
 #endif
@@ -0,0 +1,221 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/src/zpcg_cpu.cpp, normal z -> c, Fri Oct 16 22:50:54 2026
+*/
+
+#include "magmasparse_internal.h"
+
+#define ATOLERANCE     lapackf77_slamch( "E" )
+
+
+/**
+    Purpose
+    -------
+
+    Solves a system of linear equations
+       A * X = B
+    where A is a complex Hermitian positive definite matrix.
+    This is a CPU implementation of the preconditioned Conjugate Gradient
+    method (see magma_cpcg): all linear algebra objects, including the
+    preconditioner, are expected in host memory. The preconditioner is
+    applied with magma_c_applyprecond_left and magma_c_applyprecond_right,
+    and the SpMV is fused with the dot product p' * q.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_c_matrix
+                input matrix A
+
+    @param[in]
+    b           magma_c_matrix
+                RHS b
+
+    @param[in,out]
+    x           magma_c_matrix*
+                solution approximation
+
+    @param[in,out]
+    solver_par  magma_c_solver_par*
+                solver parameters
+
+    @param[in]
+    precond_par magma_c_preconditioner*
+                preconditioner, set up in host memory
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_cposv
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_cpcg_cpu(
+    magma_c_matrix A, magma_c_matrix b, magma_c_matrix *x,
+    magma_c_solver_par *solver_par,
+    magma_c_preconditioner *precond_par,
+    magma_queue_t queue )
+{
+    magma_int_t info = MAGMA_NOTCONVERGED;
+
+    // prepare solver feedback
+    solver_par->solver = Magma_PCG;
+    solver_par->numiter = 0;
+    solver_par->spmv_count = 0;
+    solver_par->reduction_count = 0;
+
+    // solver variables
+    magmaFloatComplex alpha, beta, den, gammanew, gammaold = MAGMA_C_ONE;
+    float nom0, r0, res, nomb, residual;
+
+    // some useful variables
+    magmaFloatComplex c_zero = MAGMA_C_ZERO;
+    magma_int_t dofs = A.num_rows;
+
+    magma_c_matrix r={Magma_CSR}, rt={Magma_CSR}, p={Magma_CSR}, q={Magma_CSR},
+    h={Magma_CSR};
+
+    //Chronometry
+    real_Double_t tempo1, tempo2;
+
+    if ( A.memory_location != Magma_CPU || b.num_cols != 1 ) {
+        printf("error: the CPU solver requires one RHS in host memory.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    // CPU workspace
+    CHECK( magma_cvinit( &r, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_cvinit( &rt,Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_cvinit( &p, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_cvinit( &q, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_cvinit( &h, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+
+    // solver setup
+    CHECK(  magma_cresidualvec( A, b, *x, &r, &nom0, queue));
+    solver_par->reduction_count++;
+    solver_par->init_res = nom0;
+
+    nomb = magma_scnrm2_cpu( dofs, b.val, queue );
+    solver_par->reduction_count++;
+    if ( nomb == 0.0 ){
+        nomb=1.0;
+    }
+    if ( (r0 = nomb * solver_par->rtol) < ATOLERANCE ){
+        r0 = ATOLERANCE;
+    }
+    res = nom0;
+
+    solver_par->final_res = solver_par->init_res;
+    solver_par->iter_res = solver_par->init_res;
+    if ( solver_par->verbose > 0 ) {
+        solver_par->res_vec[0] = (real_Double_t) nom0;
+        solver_par->timing[0] = 0.0;
+    }
+    if ( nom0 < r0 || nom0 < solver_par->atol ) {
+        info = MAGMA_SUCCESS;
+        goto cleanup;
+    }
+
+    tempo1 = magma_wtime();
+
+    // start iteration
+    do
+    {
+        solver_par->numiter++;
+
+        // h = M^{-1} r
+        CHECK( magma_c_applyprecond_left( MagmaNoTrans, A, r, &rt, precond_par, queue ));
+        CHECK( magma_c_applyprecond_right( MagmaNoTrans, A, rt, &h, precond_par, queue ));
+
+        gammanew = magma_cdotc_cpu( dofs, r.val, h.val, queue );       // gn = < r,h>
+        solver_par->reduction_count++;
+
+        if ( solver_par->numiter == 1 ) {
+            beta = c_zero;
+        } else {
+            beta = gammanew / gammaold;                                 // beta = gn/go
+        }
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t i = 0; i < dofs; i++) {
+            p.val[i] = h.val[i] + beta * p.val[i];                      // p = h + beta*p
+        }
+
+        // q = A p, den = p' * q
+        CHECK( magma_ccgmerge_spmv1_cpu( A, p.val, q.val, &den, queue ));
+        solver_par->spmv_count++;
+        solver_par->reduction_count++;
+        // check positive definite
+        if ( MAGMA_C_REAL( den ) <= 0.0 ) {
+            info = MAGMA_NONSPD;
+            break;
+        }
+        alpha = gammanew / den;
+        if( magma_c_isnan_inf( alpha ) ){
+            info = MAGMA_DIVERGENCE;
+            break;
+        }
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t i = 0; i < dofs; i++) {
+            x->val[i] += alpha * p.val[i];                              // x = x + alpha p
+            r.val[i]  -= alpha * q.val[i];                              // r = r - alpha q
+        }
+        gammaold = gammanew;
+
+        res = magma_scnrm2_cpu( dofs, r.val, queue );
+        solver_par->reduction_count++;
+        if ( solver_par->verbose > 0 ) {
+            tempo2 = magma_wtime();
+            if ( (solver_par->numiter)%solver_par->verbose==0 ) {
+                solver_par->res_vec[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) res;
+                solver_par->timing[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) tempo2-tempo1;
+            }
+        }
+
+        if ( res < solver_par->atol ||
+             res/nomb < solver_par->rtol ) {
+            break;
+        }
+    }
+    while ( solver_par->numiter+1 <= solver_par->maxiter );
+
+    tempo2 = magma_wtime();
+    solver_par->runtime = (real_Double_t) tempo2-tempo1;
+    CHECK(  magma_cresidualvec( A, b, *x, &r, &residual, queue));
+    solver_par->iter_res = res;
+    solver_par->final_res = residual;
+
+    if ( info == MAGMA_NONSPD || info == MAGMA_DIVERGENCE ) {
+        // keep the error code
+    } else if ( solver_par->numiter < solver_par->maxiter ) {
+        info = MAGMA_SUCCESS;
+    } else if ( solver_par->init_res > solver_par->final_res ) {
+        info = MAGMA_SLOW_CONVERGENCE;
+        if( solver_par->iter_res < solver_par->rtol*nomb ||
+            solver_par->iter_res < solver_par->atol ) {
+            info = MAGMA_SUCCESS;
+        }
+    }
+    else {
+        info = MAGMA_DIVERGENCE;
+    }
+
+cleanup:
+    magma_cmfree(&r, queue );
+    magma_cmfree(&rt, queue );
+    magma_cmfree(&p, queue );
+    magma_cmfree(&q, queue );
+    magma_cmfree(&h, queue );
+
+    solver_par->info = info;
+    return info;
+}   /* magma_cpcg_cpu */
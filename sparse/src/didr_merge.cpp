@@ -9,11 +9,13 @@
        @author Eduardo Ponce
        @author Moritz Kreutzer
 
-       @generated from sparse/src/zidr_merge.cpp, normal z -> d, Sat Mar 27 20:32:55 2021
+       @generated from sparse/src/zidr_merge.cpp, normal z -> d, Sat Oct 17 00:26:41 2026
 */
 
 #include "magmasparse_internal.h"
+#if ! defined(HAVE_HOST)
 #include <cuda_profiler_api.h>
+#endif
 
 #define RTOLERANCE     lapackf77_dlamch( "E" )
 #define ATOLERANCE     lapackf77_dlamch( "E" )
@@ -293,7 +295,9 @@ magma_didr_merge(
         solver_par->timing[0] = 0.0;
     }
 
+#if ! defined(HAVE_HOST)
 cudaProfilerStart();
+#endif
 
     om = MAGMA_D_ONE;
     innerflag = 0;
@@ -546,7 +550,9 @@ cudaProfilerStart();
         magma_dcopyvector( dr.num_rows, drs.dval, 1, dr.dval, 1, queue );
     }
 
+#if ! defined(HAVE_HOST)
 cudaProfilerStop();
+#endif
 
     // get last iteration timing
     tempo2 = magma_sync_wtime( queue );
@@ -7,7 +7,7 @@
 
        @author Hartwig Anzt
 
-       @generated from sparse/src/zparict.cpp, normal z -> d, Sat Mar 27 20:33:05 2021
+       @generated from sparse/src/zparict.cpp, normal z -> d, Fri Oct 16 18:32:16 2026
 */
 
 #include "magmasparse_internal.h"
@@ -190,10 +190,7 @@ magma_dparict(
         end = magma_sync_wtime( queue ); t_transpose1+=end-start;
         start = magma_sync_wtime( queue ); 
         magma_dparict_candidates( L0, L, LT, &hL, queue );
-        #pragma omp parallel        
-        for(int row=0; row<hL.num_rows; row++){
-            magma_dindexsort( &hL.col[hL.row[row]], 0, hL.row[row+1]-hL.row[row]-1, queue );
-        }
+        CHECK( magma_dcsr_sort( &hL, queue ) );
         end = magma_sync_wtime( queue ); t_cand=+end-start;
         
         start = magma_sync_wtime( queue );
@@ -0,0 +1,318 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/src/zpgmres_cpu.cpp, normal z -> d, Fri Oct 16 22:50:55 2026
+*/
+#include "magmasparse_internal.h"
+
+#define PRECISION_d
+
+// simulate 2-D arrays at the cost of some arithmetic
+#define V(i) (V.val+(i)*dofs)
+#define H(i,j) (H[(j)*m1+(i)])
+
+#define ATOLERANCE     lapackf77_dlamch( "E" )
+
+
+static void
+GeneratePlaneRotation(double dx, double dy, double *cs, double *sn)
+{
+#if defined(PRECISION_s) | defined(PRECISION_d)
+    if (dy == MAGMA_D_ZERO) {
+        *cs = MAGMA_D_ONE;
+        *sn = MAGMA_D_ZERO;
+    } else if (MAGMA_D_ABS((dy)) > MAGMA_D_ABS((dx))) {
+        double temp = dx / dy;
+        *sn = MAGMA_D_ONE / magma_dsqrt( ( MAGMA_D_ONE + temp*temp));
+        *cs = temp * (*sn);
+    } else {
+        double temp = dy / dx;
+        *cs = MAGMA_D_ONE / magma_dsqrt( ( MAGMA_D_ONE + temp*temp ));
+        *sn = temp * (*cs);
+    }
+#else
+    real_Double_t rho = sqrt(MAGMA_D_REAL(MAGMA_D_CONJ(dx)*dx + MAGMA_D_CONJ(dy)*dy));
+    *cs = dx / rho;
+    *sn = dy / rho;
+#endif
+}
+
+static void ApplyPlaneRotation(double *dx, double *dy, double cs, double sn)
+{
+#if defined(PRECISION_s) | defined(PRECISION_d)
+    double temp = (*dx);
+    *dx =  cs * (*dx) + sn * (*dy);
+    *dy = -sn * temp + cs * (*dy);
+#else
+    double temp  =  MAGMA_D_CONJ(cs) * (*dx) +  MAGMA_D_CONJ(sn) * (*dy);
+    *dy = -(sn) * (*dx) + cs * (*dy);
+    *dx = temp;
+#endif
+}
+
+
+/**
+    Purpose
+    -------
+
+    Solves a system of linear equations
+       A * X = B
+    where A is a real sparse matrix stored in host memory.
+    X and B are real vectors stored in host memory.
+    This is a CPU implementation of the right-preconditioned restarted
+    GMRES method (see magma_dgmres_cpu for the CGS2 orthogonalization).
+    The preconditioner is expected in host memory and applied with
+    magma_d_applyprecond_left and magma_d_applyprecond_right: the Krylov
+    space is built for A M^{-1}, and the update V(0:i) s(0:i) of the
+    solution is mapped back with M^{-1} at the end of every cycle.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_d_matrix
+                descriptor for matrix A
+
+    @param[in]
+    b           magma_d_matrix
+                RHS b vector
+
+    @param[in,out]
+    x           magma_d_matrix*
+                solution approximation
+
+    @param[in,out]
+    solver_par  magma_d_solver_par*
+                solver parameters
+
+    @param[in]
+    precond_par magma_d_preconditioner*
+                preconditioner, set up in host memory
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_dgesv
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_dpgmres_cpu(
+    magma_d_matrix A, magma_d_matrix b, magma_d_matrix *x,
+    magma_d_solver_par *solver_par,
+    magma_d_preconditioner *precond_par,
+    magma_queue_t queue )
+{
+    magma_int_t info = MAGMA_NOTCONVERGED;
+
+    magma_int_t dofs = A.num_rows;
+
+    // prepare solver feedback
+    solver_par->solver = Magma_PGMRES;
+    solver_par->numiter = 0;
+    solver_par->spmv_count = 0;
+    solver_par->reduction_count = 0;
+
+    //Chronometry
+    real_Double_t tempo1, tempo2;
+
+    magma_int_t dim = solver_par->restart;
+    magma_int_t m1 = dim+1; // used inside H macro
+    magma_int_t i, j, k;
+    double beta;
+
+    double rel_resid = 1.0, r0=0.0, betanom = 0.0, nom, nomb, residual;
+
+    magma_d_matrix V={Magma_CSR}, v_t={Magma_CSR}, w_t={Magma_CSR},
+    y={Magma_CSR}, z={Magma_CSR};
+    double *H={0}, *h2={0}, *s={0}, *cs={0}, *sn={0};
+
+    if ( A.memory_location != Magma_CPU || b.num_cols != 1 ) {
+        printf("error: the CPU solver requires one RHS in host memory.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    CHECK( magma_dmalloc_cpu( &H, (dim+1)*dim ));
+    CHECK( magma_dmalloc_cpu( &h2, dim+1 ));
+    CHECK( magma_dmalloc_cpu( &s,  dim+1 ));
+    CHECK( magma_dmalloc_cpu( &cs, dim ));
+    CHECK( magma_dmalloc_cpu( &sn, dim ));
+
+    CHECK( magma_dvinit( &V, Magma_CPU, dofs*(dim+1), 1, MAGMA_D_ZERO, queue ));
+    CHECK( magma_dvinit( &y, Magma_CPU, dofs, 1, MAGMA_D_ZERO, queue ));
+    CHECK( magma_dvinit( &z, Magma_CPU, dofs, 1, MAGMA_D_ZERO, queue ));
+
+    nomb = magma_dnrm2_cpu( dofs, b.val, queue );
+    solver_par->reduction_count++;
+    if ( nomb == 0.0 ){
+        nomb=1.0;
+    }
+    if ( (r0 = nomb * solver_par->rtol) < ATOLERANCE ){
+        r0 = ATOLERANCE;
+    }
+
+    tempo1 = magma_wtime();
+    do
+    {
+        // V(0) = b - A x
+        CHECK( magma_dvset( dofs, 1, V(0), &v_t, queue ));
+        for (magma_int_t l = 0; l < dofs; l++) {
+            V(0)[l] = b.val[l];
+        }
+        CHECK( magma_d_spmv_cpu( MAGMA_D_NEG_ONE, A, *x, MAGMA_D_ONE, v_t, queue ));
+        solver_par->numiter++;
+        solver_par->spmv_count++;
+        beta = MAGMA_D_MAKE( magma_dnrm2_cpu( dofs, V(0), queue ), 0.0 );
+        solver_par->reduction_count++;
+        if( magma_d_isnan_inf( beta ) ){
+            info = MAGMA_DIVERGENCE;
+            break;
+        }
+
+        if (solver_par->numiter == 1){
+            solver_par->init_res = MAGMA_D_REAL( beta );
+            if ( solver_par->verbose > 0 ) {
+                solver_par->res_vec[0] = (real_Double_t) MAGMA_D_REAL( beta );
+                solver_par->timing[0] = 0.0;
+            }
+            if ( MAGMA_D_REAL( beta ) < r0 ||
+                 MAGMA_D_REAL( beta ) < solver_par->atol ) {
+                betanom = MAGMA_D_REAL( beta );
+                solver_par->final_res = solver_par->init_res;
+                solver_par->iter_res = solver_par->init_res;
+                info = MAGMA_SUCCESS;
+                goto cleanup;
+            }
+        }
+
+        double temp = MAGMA_D_ONE / beta;
+        for (magma_int_t l = 0; l < dofs; l++) {
+            V(0)[l] = temp * V(0)[l];                               // V(0) = V(0)/beta
+        }
+
+        for (i = 1; i < dim+1; i++)
+            s[i] = MAGMA_D_ZERO;
+        s[0] = beta;
+
+        i = -1;
+        do {
+            i++;
+
+            // V(i+1) = A M^{-1} V(i)
+            CHECK( magma_dvset( dofs, 1, V(i), &v_t, queue ));
+            CHECK( magma_dvset( dofs, 1, V(i+1), &w_t, queue ));
+            CHECK( magma_d_applyprecond_left( MagmaNoTrans, A, v_t, &y, precond_par, queue ));
+            CHECK( magma_d_applyprecond_right( MagmaNoTrans, A, y, &z, precond_par, queue ));
+            CHECK( magma_d_spmv_cpu( MAGMA_D_ONE, A, z, MAGMA_D_ZERO, w_t, queue ));
+            solver_par->numiter++;
+            solver_par->spmv_count++;
+
+            // CGS2: H(0:i,i) = V(0:i)' V(i+1), V(i+1) -= V(0:i) H(0:i,i), twice
+            CHECK( magma_dmdotc_cpu( dofs, i+1, V.val, dofs, V(i+1), &H(0,i), queue ));
+            CHECK( magma_dmaxpy_cpu( dofs, i+1, V.val, dofs, &H(0,i), V(i+1), NULL, queue ));
+            CHECK( magma_dmdotc_cpu( dofs, i+1, V.val, dofs, V(i+1), h2, queue ));
+            CHECK( magma_dmaxpy_cpu( dofs, i+1, V.val, dofs, h2, V(i+1), &nom, queue ));
+            solver_par->reduction_count += 3;
+            for (k = 0; k <= i; k++) {
+                H(k,i) += h2[k];
+            }
+
+            H(i+1, i) = MAGMA_D_MAKE( sqrt( nom ), 0. );            // H(i+1,i) = ||r||
+            temp = MAGMA_D_ONE / H(i+1, i);
+            for (magma_int_t l = 0; l < dofs; l++) {
+                V(i+1)[l] = temp * V(i+1)[l];                       // V(i+1) = V(i+1) / H(i+1, i)
+            }
+
+            for (k = 0; k < i; k++)
+                ApplyPlaneRotation(&H(k,i), &H(k+1,i), cs[k], sn[k]);
+
+            GeneratePlaneRotation(H(i,i), H(i+1,i), &cs[i], &sn[i]);
+            ApplyPlaneRotation(&H(i,i), &H(i+1,i), cs[i], sn[i]);
+            ApplyPlaneRotation(&s[i], &s[i+1], cs[i], sn[i]);
+
+            betanom = MAGMA_D_ABS( s[i+1] );
+            rel_resid = betanom / nomb;
+            if ( solver_par->verbose > 0 ) {
+                tempo2 = magma_wtime();
+                if ( (solver_par->numiter)%solver_par->verbose==0 ) {
+                    solver_par->res_vec[(solver_par->numiter)/solver_par->verbose]
+                            = (real_Double_t) betanom;
+                    solver_par->timing[(solver_par->numiter)/solver_par->verbose]
+                            = (real_Double_t) tempo2-tempo1;
+                }
+            }
+            if (rel_resid <= solver_par->rtol || betanom <= solver_par->atol ){
+                info = MAGMA_SUCCESS;
+                break;
+            }
+        }
+        while (i+1 < dim && solver_par->numiter+1 <= solver_par->maxiter);
+
+        // solve upper triangular system in place
+        for (j = i; j >= 0; j--)
+        {
+            s[j] /= H(j,j);
+            for (k = j-1; k >= 0; k--)
+                s[k] -= H(k,j) * s[j];
+        }
+
+        // update the solution x = x + M^{-1} V(0:i) s(0:i)
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t l = 0; l < dofs; l++) {
+            double tmp = MAGMA_D_ZERO;
+            for (magma_int_t jj = 0; jj <= i; jj++) {
+                tmp += s[jj] * V(jj)[l];
+            }
+            z.val[l] = tmp;
+        }
+        CHECK( magma_d_applyprecond_left( MagmaNoTrans, A, z, &y, precond_par, queue ));
+        CHECK( magma_d_applyprecond_right( MagmaNoTrans, A, y, &z, precond_par, queue ));
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t l = 0; l < dofs; l++) {
+            x->val[l] += z.val[l];
+        }
+    }
+    while (rel_resid > solver_par->rtol && betanom > solver_par->atol
+                && solver_par->numiter+1 <= solver_par->maxiter);
+
+    tempo2 = magma_wtime();
+    solver_par->runtime = (real_Double_t) tempo2-tempo1;
+    magma_dmfree( &V, queue );
+    CHECK( magma_dvinit( &V, Magma_CPU, dofs, 1, MAGMA_D_ZERO, queue ));
+    CHECK( magma_dresidualvec( A, b, *x, &V, &residual, queue ));
+    solver_par->iter_res = betanom;
+    solver_par->final_res = residual;
+
+    if ( info == MAGMA_DIVERGENCE ) {
+        // keep the error code
+    } else if ( solver_par->numiter < solver_par->maxiter && info == MAGMA_SUCCESS ) {
+        info = MAGMA_SUCCESS;
+    } else if ( solver_par->init_res > solver_par->final_res ) {
+        info = MAGMA_SLOW_CONVERGENCE;
+        if( solver_par->iter_res < solver_par->rtol*nomb ||
+            solver_par->iter_res < solver_par->atol ) {
+            info = MAGMA_SUCCESS;
+        }
+    }
+    else {
+        info = MAGMA_DIVERGENCE;
+    }
+
+cleanup:
+    magma_free_cpu(H);
+    magma_free_cpu(h2);
+    magma_free_cpu(s);
+    magma_free_cpu(cs);
+    magma_free_cpu(sn);
+    magma_dmfree( &V, queue);
+    magma_dmfree( &y, queue);
+    magma_dmfree( &z, queue);
+
+    solver_par->info = info;
+    return info;
+} /* magma_dpgmres_cpu */
@@ -0,0 +1,208 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/src/zcir_cpu.cpp, mixed zc -> ds, Fri Oct 16 19:10:20 2026
+*/
+
+#include "magmasparse_internal.h"
+
+
+/**
+    Purpose
+    -------
+
+    Solves a system of linear equations
+       A * X = B
+    where A is a real N-by-N matrix in CSR in host memory.
+    This is a CPU implementation of mixed precision Iterative Refinement:
+    the residuals and the solution updates are computed with A in the
+    working precision, the correction equations are solved by a host Krylov
+    solver operating on a copy of A in the mixed precision storage
+    Magma_CSRMP (see magma_dmcsrmp), whose values are stored in single or
+    half precision. As the inner solver is bound by the memory traffic of
+    the SpMV, this reduces its runtime, while the refinement restores the
+    accuracy of the working precision.
+
+    The inner solver and its parameters are passed via the preconditioner
+    argument: precond_par->solver selects CG, BiCGSTAB, GMRES, CACG or
+    PIPEGMRES, precond_par->rtol, maxiter and restart are used for every
+    correction solve, and precond_par->format selects the value precision
+    (Magma_HALF for half, else single precision).
+    The spmv_count in solver_par includes the SpMVs of the inner solver.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_d_matrix
+                input matrix A
+
+    @param[in]
+    b           magma_d_matrix
+                RHS b
+
+    @param[in,out]
+    x           magma_d_matrix*
+                solution approximation, contains the initial guess on entry
+
+    @param[in,out]
+    solver_par  magma_d_solver_par*
+                solver parameters
+
+    @param[in,out]
+    precond_par magma_d_preconditioner*
+                inner solver
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_dgesv
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_dsir_cpu(
+    magma_d_matrix A, magma_d_matrix b, magma_d_matrix *x,
+    magma_d_solver_par *solver_par, magma_d_preconditioner *precond_par,
+    magma_queue_t queue )
+{
+    magma_int_t info = MAGMA_NOTCONVERGED;
+
+    // prepare solver feedback
+    solver_par->solver = Magma_ITERREF;
+    solver_par->numiter = 0;
+    solver_par->spmv_count = 0;
+    solver_par->reduction_count = 0;
+
+    // solver variables
+    double nom, nomb, residual;
+    magma_int_t dofs = A.num_rows;
+    magma_dopts inner;
+
+    // workspace
+    magma_d_matrix Amp={Magma_CSR}, r={Magma_CSR}, z={Magma_CSR};
+
+    //Chronometry
+    real_Double_t tempo1, tempo2;
+
+    if ( A.memory_location != Magma_CPU || b.num_cols != 1 ) {
+        printf("error: the CPU solver requires one RHS in host memory.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+    switch( precond_par->solver ) {
+        case Magma_CG:       case Magma_CGMERGE:
+        case Magma_BICGSTAB: case Magma_BICGSTABMERGE:
+        case Magma_GMRES:
+        case Magma_CACG:
+        case Magma_PIPEGMRES:
+            break;
+        default:
+            printf("error: inner solver not supported on the CPU.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+            goto cleanup;
+    }
+
+    memset( &inner, 0, sizeof(inner) );
+    inner.solver_par.solver = precond_par->solver;
+    inner.solver_par.rtol = precond_par->rtol;
+    inner.solver_par.maxiter = precond_par->maxiter;
+    inner.solver_par.restart = precond_par->restart;
+    inner.precond_par.solver = Magma_NONE;
+
+    tempo1 = magma_wtime();
+
+    // low precision copy of A
+    CHECK( magma_dmcsrmp( A, precond_par->format, &Amp, queue ));
+    CHECK( magma_dvinit( &r, Magma_CPU, dofs, 1, MAGMA_D_ZERO, queue ));
+    CHECK( magma_dvinit( &z, Magma_CPU, dofs, 1, MAGMA_D_ZERO, queue ));
+
+    // r = b - A x
+    CHECK( magma_dresidualvec( A, b, *x, &r, &nom, queue ));
+    solver_par->spmv_count++;
+    nomb = magma_dnrm2_cpu( dofs, b.val, queue );
+    if ( nomb == 0.0 ) {
+        nomb = 1.0;
+    }
+    solver_par->init_res = nom;
+    solver_par->final_res = nom;
+    solver_par->iter_res = nom;
+    if ( solver_par->verbose > 0 ) {
+        solver_par->res_vec[0] = (real_Double_t) nom;
+        solver_par->timing[0] = 0.0;
+    }
+
+    // start iteration
+    while ( nom >= solver_par->atol && nom/nomb >= solver_par->rtol &&
+            solver_par->numiter < solver_par->maxiter )
+    {
+        solver_par->numiter++;
+
+        // inner solver on the scaled residual: Amp * z = r / nom
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t i = 0; i < dofs; i++) {
+            r.val[i] = r.val[i] / MAGMA_D_MAKE( nom, 0.0 );
+            z.val[i] = MAGMA_D_ZERO;
+        }
+        // a correction that does not meet the inner tolerance still helps,
+        // short CG runs may also end with a residual above the initial one
+        info = magma_d_solver( Amp, r, &z, &inner, queue );
+        solver_par->spmv_count += inner.solver_par.spmv_count;
+        solver_par->reduction_count += inner.solver_par.reduction_count;
+        if ( info != MAGMA_SUCCESS && info != MAGMA_SLOW_CONVERGENCE &&
+             info != MAGMA_NOTCONVERGED && info != MAGMA_DIVERGENCE ) {
+            goto cleanup;
+        }
+        info = MAGMA_NOTCONVERGED;
+
+        // x = x + nom * z, r = b - A x
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t i = 0; i < dofs; i++) {
+            x->val[i] = x->val[i] + MAGMA_D_MAKE( nom, 0.0 ) * z.val[i];
+        }
+        CHECK( magma_dresidualvec( A, b, *x, &r, &nom, queue ));
+        solver_par->spmv_count++;
+        solver_par->reduction_count++;
+        if ( magma_d_isnan_inf( MAGMA_D_MAKE( nom, 0.0 ) ) ) {
+            info = MAGMA_DIVERGENCE;
+            break;
+        }
+
+        if ( solver_par->verbose > 0 ) {
+            tempo2 = magma_wtime();
+            if ( (solver_par->numiter)%solver_par->verbose==0 ) {
+                solver_par->res_vec[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) nom;
+                solver_par->timing[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) tempo2-tempo1;
+            }
+        }
+    }
+    tempo2 = magma_wtime();
+    solver_par->runtime = (real_Double_t) tempo2-tempo1;
+    CHECK( magma_dresidualvec( A, b, *x, &r, &residual, queue ));
+    solver_par->iter_res = nom;
+    solver_par->final_res = residual;
+
+    if ( info == MAGMA_DIVERGENCE ) {
+        // keep the error code
+    } else if ( nom < solver_par->atol || nom/nomb < solver_par->rtol ) {
+        info = MAGMA_SUCCESS;
+    } else if ( solver_par->init_res > solver_par->final_res ) {
+        info = MAGMA_SLOW_CONVERGENCE;
+    }
+    else {
+        info = MAGMA_DIVERGENCE;
+    }
+
+cleanup:
+    magma_dmfree( &Amp, queue );
+    magma_dmfree( &r, queue );
+    magma_dmfree( &z, queue );
+    solver_par->info = info;
+    return info;
+}   /* magma_dsir_cpu */
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/src/magma_z_precond_wrapper.cpp, normal z -> c, Sat Mar 27 20:33:07 2021
+       @generated from sparse/src/magma_z_precond_wrapper.cpp, normal z -> c, Fri Oct 16 22:50:56 2026
        @author Hartwig Anzt
 
 */
@@ -176,6 +176,11 @@ magma_c_precondsetup(
             info = magma_ccumilusetup( A, precond, queue );
         }
     }
+    else if ( precond->solver == Magma_PARILU &&
+              A.memory_location == Magma_CPU && b.memory_location == Magma_CPU ) {
+        // host factors with host triangular solves
+        info = magma_cparilu_cpu( A, b, precond, queue );
+    }
     else if ( precond->solver == Magma_PARILU ) {
         info = magma_cparilu_gpu( A, b, precond, queue );
         if ( precond->trisolver == Magma_ISAI ||
@@ -235,6 +240,11 @@ magma_c_precondsetup(
             info = magma_ccumiccsetup( A, precond, queue );
         }
     }
+    else if ( precond->solver == Magma_PARIC &&
+              A.memory_location == Magma_CPU && b.memory_location == Magma_CPU ) {
+        // host factors with host triangular solves
+        info = magma_cparic_cpu( A, b, precond, queue );
+    }
     else if ( precond->solver == Magma_PARIC ) {
         info = magma_cparic_gpu( A, b, precond, queue );
     }
@@ -289,6 +299,91 @@ magma_c_precondsetup(
 
 
 
+/**
+    Purpose
+    -------
+
+    Refreshes a preconditioner that was set up with magma_c_precondsetup for
+    a new matrix A with the same sparsity pattern. For ParILU, the symbolic
+    structure, the index maps and the triangular solve information kept by
+    the first setup are reused: only the values are refreshed and the sweeps
+    are rerun. For the ISAI-based triangular solves the approximate inverses
+    are recomputed. All other preconditioners, and ParILU combined with a
+    solver that needs the transposed factors, fall back to a full setup.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_c_matrix
+                sparse matrix A, same pattern as at setup
+
+    @param[in]
+    b           magma_c_matrix
+                input vector b
+    
+    @param[in]
+    solver      magma_c_solver_par
+                solver structure using the preconditioner
+                
+    @param[in,out]
+    precond     magma_c_preconditioner
+                preconditioner
+                
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_caux
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_c_precond_refactor(
+    magma_c_matrix A, magma_c_matrix b,
+    magma_c_solver_par *solver,
+    magma_c_preconditioner *precond,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    
+    //Chronometry
+    real_Double_t tempo1, tempo2;
+    
+    if ( precond->solver != Magma_PARILU || 
+         precond->refactor.Lmap == NULL ||
+         solver->solver == Magma_PQMR  || 
+         solver->solver == Magma_PQMRMERGE  || 
+         solver->solver == Magma_PBICG ||
+         solver->solver == Magma_LSQR ) {
+        magma_solver_type type = precond->solver;
+        magma_cprecondfree( precond, queue );
+        precond->solver = type;
+        info = magma_c_precondsetup( A, b, solver, precond, queue );
+        return info;
+    }
+    
+    tempo1 = magma_sync_wtime( queue );
+    
+    CHECK( magma_cparilu_refactor( A, precond, queue ));
+    if ( precond->L.memory_location == Magma_DEV && 
+        ( precond->trisolver == Magma_ISAI ||
+         precond->trisolver == Magma_JACOBI ||
+         precond->trisolver == Magma_VBJACOBI ) ){
+         magma_cmfree( &precond->LD, queue );
+         magma_cmfree( &precond->UD, queue );
+         CHECK( magma_ciluisaisetup_lower( precond->L, precond->L, &precond->LD, queue ));
+         CHECK( magma_ciluisaisetup_upper( precond->U, precond->U, &precond->UD, queue ));
+    }
+    
+    tempo2 = magma_sync_wtime( queue );
+    precond->setuptime = tempo2-tempo1;
+    
+cleanup:
+    return info;
+}
+
+
+
 /**
     Purpose
     -------
@@ -431,6 +526,13 @@ magma_c_applyprecond_left(
         if ( precond->solver == Magma_JACOBI ) {
             CHECK( magma_cjacobi_diagscal( b.num_rows, precond->d, b, x, queue ));
         }
+        else if ( ( precond->solver == Magma_ILU ||
+                    precond->solver == Magma_PARILU ||
+                    precond->solver == Magma_PARIC ) && 
+                  precond->L.memory_location == Magma_CPU ){
+            CHECK( magma_csptrsv_cpu( precond->L, &precond->sptrsvL, 
+                                      precond->trisolver, b, x, queue ));
+        }
         else if ( ( precond->solver == Magma_ILU ||
                     precond->solver == Magma_PARILU ) && 
                   ( precond->trisolver == Magma_CUSOLVE ||
@@ -487,6 +589,13 @@ magma_c_applyprecond_left(
         if ( precond->solver == Magma_JACOBI ) {
             CHECK( magma_cjacobi_diagscal( b.num_rows, precond->d, b, x, queue ));
         }
+        else if ( ( precond->solver == Magma_ILU ||
+                    precond->solver == Magma_PARILU ||
+                    precond->solver == Magma_PARIC ) && 
+                  precond->L.memory_location == Magma_CPU ){
+            printf( "error: transposed host triangular solve not supported.\n" );
+            info = MAGMA_ERR_NOT_SUPPORTED;
+        }
         else if ( ( precond->solver == Magma_ILU ||
                     precond->solver == Magma_PARILU ) && 
                   ( precond->trisolver == Magma_CUSOLVE ||
@@ -601,6 +710,13 @@ magma_c_applyprecond_right(
         if ( precond->solver == Magma_JACOBI ) {
             magma_ccopy( b.num_rows*b.num_cols, b.dval, 1, x->dval, 1, queue );    // x = b
         }
+        else if ( ( precond->solver == Magma_ILU ||
+                    precond->solver == Magma_PARILU ||
+                    precond->solver == Magma_PARIC ) && 
+                  precond->U.memory_location == Magma_CPU ){
+            CHECK( magma_csptrsv_cpu( precond->U, &precond->sptrsvU, 
+                                      precond->trisolver, b, x, queue ));
+        }
         else if ( ( precond->solver == Magma_ILU ||
                     precond->solver == Magma_PARILU ) && 
                   ( precond->trisolver == Magma_CUSOLVE ||
@@ -661,6 +777,13 @@ magma_c_applyprecond_right(
         if ( precond->solver == Magma_JACOBI ) {
             magma_ccopy( b.num_rows*b.num_cols, b.dval, 1, x->dval, 1, queue );    // x = b
         }
+        else if ( ( precond->solver == Magma_ILU ||
+                    precond->solver == Magma_PARILU ||
+                    precond->solver == Magma_PARIC ) && 
+                  precond->U.memory_location == Magma_CPU ){
+            printf( "error: transposed host triangular solve not supported.\n" );
+            info = MAGMA_ERR_NOT_SUPPORTED;
+        }
         else if ( ( precond->solver == Magma_ILU ||
                     precond->solver == Magma_PARILU ) && 
                   ( precond->trisolver == Magma_CUSOLVE ||
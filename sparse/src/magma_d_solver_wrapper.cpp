@@ -5,12 +5,14 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/src/magma_z_solver_wrapper.cpp, normal z -> d, Sat Mar 27 20:33:07 2021
+       @generated from sparse/src/magma_z_solver_wrapper.cpp, normal z -> d, Fri Oct 16 22:50:55 2026
        @author Hartwig Anzt
 
 */
 #include "magmasparse_internal.h"
 
+#define PRECISION_d
+
 
 /**
     Purpose
@@ -18,7 +20,17 @@
 
     This is an interface that allows to use any iterative solver on the linear
     system Ax = b. All linear algebra objects are expected to be on the device,
-    the linear algebra objects are MAGMA-sparse specific structures 
+    or all in host memory - in this case the CPU implementations of CG,
+    BiCGSTAB and GMRES are used. PCG, PBICGSTAB and PGMRES use the
+    preconditioned CPU versions if the preconditioner factors were set up in
+    host memory (ParILU / ParIC with host A and b, see magma_d_precondsetup).
+    For a block of several right-hand sides in host memory, CG and GMRES use
+    the unpreconditioned block versions magma_dbcg_cpu and magma_dbgmres_cpu,
+    which share every sweep over A among all right-hand sides.
+    Except in single precision, ITERREF runs mixed precision iterative
+    refinement on the host (magma_dsir_cpu), with the inner solver operating
+    on a copy of A with single or half precision values.
+    The linear algebra objects are MAGMA-sparse specific structures 
     (dense matrix b, dense matrix x, sparse/dense matrix A).
     The additional parameter zopts contains information about the solver
     and the preconditioner.
@@ -68,6 +80,79 @@ magma_d_solver(
         printf( "error: sparse RHS not yet supported.\n" );
         return MAGMA_ERR_NOT_SUPPORTED;
     }
+    // host data: use the CPU implementations
+    if ( A.memory_location == Magma_CPU ) {
+        bool precond = ( zopts->precond_par.solver != Magma_NONE );
+        // only preconditioners with factors in host memory can be applied
+        bool host_precond = ( ( zopts->precond_par.solver == Magma_ILU ||
+                                zopts->precond_par.solver == Magma_PARILU ||
+                                zopts->precond_par.solver == Magma_PARIC ) &&
+                              zopts->precond_par.L.memory_location == Magma_CPU &&
+                              zopts->precond_par.U.memory_location == Magma_CPU );
+        // several right-hand sides share the sweeps over A
+        bool block = ( b.num_rows * b.num_cols > A.num_rows );
+        switch( zopts->solver_par.solver ) {
+            case  Magma_PCG:
+            case  Magma_PCGMERGE:
+                    if ( precond && ( block || ! host_precond ) ) {
+                        printf("error: preconditioner not supported on the CPU.\n");
+                        info = MAGMA_ERR_NOT_SUPPORTED; break;
+                    }
+                    if ( precond ) {
+                        CHECK( magma_dpcg_cpu( A, b, x, &zopts->solver_par, &zopts->precond_par, queue ));
+                        break;
+                    }
+            case  Magma_CG:
+            case  Magma_CGMERGE:
+                    if ( block ) {
+                        CHECK( magma_dbcg_cpu( A, b, x, &zopts->solver_par, queue ));
+                    } else {
+                        CHECK( magma_dcg_cpu( A, b, x, &zopts->solver_par, queue ));
+                    }
+                    break;
+            case  Magma_PBICGSTAB:
+            case  Magma_PBICGSTABMERGE:
+                    if ( precond && ! host_precond ) {
+                        printf("error: preconditioner not supported on the CPU.\n");
+                        info = MAGMA_ERR_NOT_SUPPORTED; break;
+                    }
+                    if ( precond ) {
+                        CHECK( magma_dpbicgstab_cpu( A, b, x, &zopts->solver_par, &zopts->precond_par, queue ));
+                        break;
+                    }
+            case  Magma_BICGSTAB:
+            case  Magma_BICGSTABMERGE:
+                    CHECK( magma_dbicgstab_cpu( A, b, x, &zopts->solver_par, queue )); break;
+            case  Magma_PGMRES:
+                    if ( precond && ( block || ! host_precond ) ) {
+                        printf("error: preconditioner not supported on the CPU.\n");
+                        info = MAGMA_ERR_NOT_SUPPORTED; break;
+                    }
+                    if ( precond ) {
+                        CHECK( magma_dpgmres_cpu( A, b, x, &zopts->solver_par, &zopts->precond_par, queue ));
+                        break;
+                    }
+            case  Magma_GMRES:
+                    if ( block ) {
+                        CHECK( magma_dbgmres_cpu( A, b, x, &zopts->solver_par, queue ));
+                    } else {
+                        CHECK( magma_dgmres_cpu( A, b, x, &zopts->solver_par, queue ));
+                    }
+                    break;
+            case  Magma_CACG:
+                    CHECK( magma_dcacg_cpu( A, b, x, &zopts->solver_par, queue )); break;
+            case  Magma_PIPEGMRES:
+                    CHECK( magma_dpipegmres_cpu( A, b, x, &zopts->solver_par, queue )); break;
+            #if defined(PRECISION_z) || defined(PRECISION_d)
+            case  Magma_ITERREF:
+                    CHECK( magma_dsir_cpu( A, b, x, &zopts->solver_par, &zopts->precond_par, queue )); break;
+            #endif
+            default:
+                    printf("error: solver not supported on the CPU.\n");
+                    info = MAGMA_ERR_NOT_SUPPORTED; break;
+        }
+        goto cleanup;
+    }
     if( b.num_cols == 1 ){
         switch( zopts->solver_par.solver ) {
             case  Magma_BICG:
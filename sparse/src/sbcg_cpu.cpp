@@ -0,0 +1,298 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/src/zbcg_cpu.cpp, normal z -> s, Fri Oct 16 19:00:17 2026
+*/
+
+#include "magmasparse_internal.h"
+
+
+/**
+    Purpose
+    -------
+
+    Solves a system of linear equations
+       A * X = B
+    for multiple right-hand sides, where A is a real symmetric positive
+    definite matrix. B and X are blocks of nrhs vectors stored column-major
+    in host memory, either as n-by-nrhs matrices or as vectors of length
+    n*nrhs.
+    This is a CPU implementation of the Conjugate Gradient method for
+    multiple right-hand sides: every column runs its own CG recurrence, but
+    all columns share one sweep over A per iteration. Internally, the
+    vectors are kept in row-major blocks, such that each entry of A is
+    applied to all right-hand sides at once (magma_sbcgmerge_spmv_cpu). A
+    column reaching the stopping criterion is deflated: its solution is
+    written back and it is removed from the blocks, such that the following
+    sweeps only carry the active columns.
+    A has to be stored in CSR or SELL-P. The residuals returned in
+    solver_par are the largest ones over all columns, spmv_count counts the
+    sweeps over A.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                input matrix A
+
+    @param[in]
+    b           magma_s_matrix
+                RHS block B
+
+    @param[in,out]
+    x           magma_s_matrix*
+                solution approximation, contains the initial guess on entry
+
+    @param[in,out]
+    solver_par  magma_s_solver_par*
+                solver parameters
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sposv
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_sbcg_cpu(
+    magma_s_matrix A, magma_s_matrix b, magma_s_matrix *x,
+    magma_s_solver_par *solver_par,
+    magma_queue_t queue )
+{
+    magma_int_t info = MAGMA_NOTCONVERGED;
+
+    // prepare solver feedback
+    solver_par->solver = Magma_CGMERGE;
+    solver_par->numiter = 0;
+    solver_par->spmv_count = 0;
+    solver_par->reduction_count = 0;
+
+    // some useful variables
+    magma_int_t dofs = A.num_rows;
+    magma_int_t nrhs = 0, na, nk;
+    bool converged = false;
+
+    // workspace: row-major blocks of the active columns
+    float *X=NULL, *R=NULL, *P=NULL, *Q=NULL, *alpha=NULL, *den=NULL;
+    float *rho=NULL, *rho_new=NULL, *nomb=NULL, *res=NULL, *iter_res=NULL, *residual=NULL;
+    magma_int_t *col=NULL, *keep=NULL;
+    magma_s_matrix r={Magma_CSR}, vx={Magma_CSR}, vr={Magma_CSR};
+
+    //Chronometry
+    real_Double_t tempo1, tempo2;
+
+    if ( A.memory_location != Magma_CPU || b.memory_location != Magma_CPU ||
+         dofs == 0 || (b.num_rows * b.num_cols) % dofs != 0 ||
+         x->num_rows * x->num_cols != b.num_rows * b.num_cols ||
+         ( b.num_cols > 1 && ( b.major != MagmaColMajor ||
+                               x->major != MagmaColMajor )) ) {
+        printf("error: the CPU block solver requires a column-major RHS block in host memory.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+    nrhs = b.num_rows * b.num_cols / dofs;
+
+    CHECK( magma_smalloc_cpu( &X, dofs*nrhs ));
+    CHECK( magma_smalloc_cpu( &R, dofs*nrhs ));
+    CHECK( magma_smalloc_cpu( &P, dofs*nrhs ));
+    CHECK( magma_smalloc_cpu( &Q, dofs*nrhs ));
+    CHECK( magma_smalloc_cpu( &alpha, nrhs ));
+    CHECK( magma_smalloc_cpu( &den, nrhs ));
+    CHECK( magma_smalloc_cpu( &rho, nrhs ));
+    CHECK( magma_smalloc_cpu( &rho_new, nrhs ));
+    CHECK( magma_smalloc_cpu( &nomb, nrhs ));
+    CHECK( magma_smalloc_cpu( &res, nrhs ));
+    CHECK( magma_smalloc_cpu( &iter_res, nrhs ));
+    CHECK( magma_smalloc_cpu( &residual, nrhs ));
+    CHECK( magma_imalloc_cpu( &col, nrhs ));
+    CHECK( magma_imalloc_cpu( &keep, nrhs ));
+
+    // solver setup: X = x, R = B - A X
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t i = 0; i < dofs; i++) {
+        for (magma_int_t v = 0; v < nrhs; v++) {
+            X[ i*nrhs+v ] = x->val[ v*dofs+i ];
+            R[ i*nrhs+v ] = b.val[ v*dofs+i ];
+        }
+    }
+    na = nrhs;
+    for (magma_int_t v = 0; v < nrhs; v++) {
+        col[v] = v;
+    }
+    CHECK( magma_sbmaxpy_cpu( dofs, na, 0, NULL, 0, NULL, R, nomb, queue ));
+    solver_par->reduction_count++;
+    CHECK( magma_svset( dofs, na, X, &vx, queue ));
+    CHECK( magma_svset( dofs, na, R, &vr, queue ));
+    vx.major = MagmaRowMajor;
+    vr.major = MagmaRowMajor;
+    CHECK( magma_s_spmv_cpu( MAGMA_S_NEG_ONE, A, vx, MAGMA_S_ONE, vr, queue ));
+    solver_par->spmv_count++;
+    CHECK( magma_sbmaxpy_cpu( dofs, na, 0, NULL, 0, NULL, R, rho, queue ));
+    solver_par->reduction_count++;
+
+    solver_par->init_res = 0.0;
+    for (magma_int_t v = 0; v < nrhs; v++) {
+        nomb[v] = sqrt( nomb[v] );
+        if ( nomb[v] == 0.0 ) {
+            nomb[v] = 1.0;
+        }
+        res[v] = iter_res[v] = sqrt( rho[v] );
+        solver_par->init_res = max( solver_par->init_res, res[v] );
+    }
+    solver_par->final_res = solver_par->init_res;
+    solver_par->iter_res = solver_par->init_res;
+    if ( solver_par->verbose > 0 ) {
+        solver_par->res_vec[0] = (real_Double_t) solver_par->init_res;
+        solver_par->timing[0] = 0.0;
+    }
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t l = 0; l < dofs*na; l++) {
+        P[l] = R[l];                                                    // P = R
+    }
+
+    tempo1 = magma_wtime();
+
+    // start iteration
+    while ( true )
+    {
+        // deflate the converged columns
+        nk = 0;
+        for (magma_int_t a = 0; a < na; a++) {
+            iter_res[ col[a] ] = res[a];
+            if ( res[a] < solver_par->atol ||
+                 res[a]/nomb[a] < solver_par->rtol ) {
+                magma_int_t c = col[a];
+                #pragma omp parallel for schedule(static)
+                for (magma_int_t i = 0; i < dofs; i++) {
+                    x->val[ c*dofs+i ] = X[ i*na+a ];
+                }
+            } else {
+                keep[nk] = a;
+                col[nk] = col[a];
+                rho[nk] = rho[a];
+                nomb[nk] = nomb[a];
+                nk++;
+            }
+        }
+        if ( nk == 0 ) {
+            na = 0;
+            converged = true;
+            break;
+        }
+        if ( nk < na ) {
+            CHECK( magma_sbcompact_cpu( dofs, na, nk, keep, X, Q, queue ));
+            CHECK( magma_sbcompact_cpu( dofs, na, nk, keep, R, Q, queue ));
+            CHECK( magma_sbcompact_cpu( dofs, na, nk, keep, P, Q, queue ));
+            na = nk;
+        }
+        if ( solver_par->numiter+1 > solver_par->maxiter ) {
+            break;
+        }
+        solver_par->numiter++;
+
+        // Q = A P, den = P' Q
+        CHECK( magma_sbcgmerge_spmv_cpu( A, na, P, Q, den, queue ));
+        solver_par->spmv_count++;
+        solver_par->reduction_count++;
+        for (magma_int_t a = 0; a < na; a++) {
+            // check positive definite
+            if ( MAGMA_S_REAL( den[a] ) <= 0.0 ) {
+                info = MAGMA_NONSPD;
+                break;
+            }
+            alpha[a] = MAGMA_S_MAKE( rho[a], 0.0 ) / den[a];
+            if ( magma_s_isnan_inf( alpha[a] ) ) {
+                info = MAGMA_DIVERGENCE;
+                break;
+            }
+        }
+        if ( info == MAGMA_NONSPD || info == MAGMA_DIVERGENCE ) {
+            break;
+        }
+
+        // X = X + alpha P, R = R - alpha Q, rho_new = R' R
+        CHECK( magma_sbcgmerge_xr_cpu( dofs, na, alpha, X, R, P, Q, rho_new, queue ));
+        solver_par->reduction_count++;
+        float betanom = 0.0;
+        for (magma_int_t a = 0; a < na; a++) {
+            alpha[a] = MAGMA_S_MAKE( rho_new[a] / rho[a], 0.0 );        // beta
+            rho[a] = rho_new[a];
+            res[a] = sqrt( rho_new[a] );
+            betanom = max( betanom, res[a] );
+        }
+
+        // P = R + beta P
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t i = 0; i < dofs; i++) {
+            for (magma_int_t a = 0; a < na; a++) {
+                P[ i*na+a ] = R[ i*na+a ] + alpha[a] * P[ i*na+a ];
+            }
+        }
+
+        if ( solver_par->verbose > 0 ) {
+            tempo2 = magma_wtime();
+            if ( (solver_par->numiter)%solver_par->verbose==0 ) {
+                solver_par->res_vec[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) betanom;
+                solver_par->timing[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) tempo2-tempo1;
+            }
+        }
+    }
+
+    // write back the columns that did not converge
+    for (magma_int_t a = 0; a < na; a++) {
+        magma_int_t c = col[a];
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t i = 0; i < dofs; i++) {
+            x->val[ c*dofs+i ] = X[ i*na+a ];
+        }
+    }
+
+    tempo2 = magma_wtime();
+    solver_par->runtime = (real_Double_t) tempo2-tempo1;
+    CHECK( magma_svinit( &r, Magma_CPU, dofs, nrhs, MAGMA_S_ZERO, queue ));
+    CHECK( magma_sresidualvec( A, b, *x, &r, residual, queue ));
+    solver_par->iter_res = 0.0;
+    solver_par->final_res = 0.0;
+    for (magma_int_t v = 0; v < nrhs; v++) {
+        solver_par->iter_res = max( solver_par->iter_res, iter_res[v] );
+        solver_par->final_res = max( solver_par->final_res, residual[v] );
+    }
+
+    if ( info == MAGMA_NONSPD || info == MAGMA_DIVERGENCE ) {
+        // keep the error code
+    } else if ( converged ) {
+        info = MAGMA_SUCCESS;
+    } else if ( solver_par->init_res > solver_par->final_res ) {
+        info = MAGMA_SLOW_CONVERGENCE;
+    }
+    else {
+        info = MAGMA_DIVERGENCE;
+    }
+
+cleanup:
+    magma_free_cpu( X );
+    magma_free_cpu( R );
+    magma_free_cpu( P );
+    magma_free_cpu( Q );
+    magma_free_cpu( alpha );
+    magma_free_cpu( den );
+    magma_free_cpu( rho );
+    magma_free_cpu( rho_new );
+    magma_free_cpu( nomb );
+    magma_free_cpu( res );
+    magma_free_cpu( iter_res );
+    magma_free_cpu( residual );
+    magma_free_cpu( col );
+    magma_free_cpu( keep );
+    magma_smfree( &r, queue );
+
+    solver_par->info = info;
+    return info;
+}   /* magma_sbcg_cpu */
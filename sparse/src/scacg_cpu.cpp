@@ -0,0 +1,206 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/src/zcacg_cpu.cpp, normal z -> s, Fri Oct 16 18:52:12 2026
+*/
+
+#include "magmasparse_internal.h"
+
+
+/**
+    Purpose
+    -------
+
+    Solves a system of linear equations
+       A * X = B
+    where A is a real symmetric positive definite matrix.
+    This is a CPU implementation of the Conjugate Gradient method in the
+    formulation of Chronopoulos and Gear: the step length is computed from
+    r' * r and r' * A r, which are formed in the same sweep as the SpMV
+    w = A r. Every iteration hence needs one SpMV with one global
+    reduction and one vector update without any, compared to two
+    reductions in the classical formulation (see magma_scg_cpu).
+    The number of global reductions is returned in
+    solver_par->reduction_count.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                input matrix A
+
+    @param[in]
+    b           magma_s_matrix
+                RHS b
+
+    @param[in,out]
+    x           magma_s_matrix*
+                solution approximation
+
+    @param[in,out]
+    solver_par  magma_s_solver_par*
+                solver parameters
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sposv
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_scacg_cpu(
+    magma_s_matrix A, magma_s_matrix b, magma_s_matrix *x,
+    magma_s_solver_par *solver_par,
+    magma_queue_t queue )
+{
+    magma_int_t info = MAGMA_NOTCONVERGED;
+
+    // prepare solver feedback
+    solver_par->solver = Magma_CACG;
+    solver_par->numiter = 0;
+    solver_par->spmv_count = 0;
+    solver_par->reduction_count = 0;
+
+    // solver variables
+    float alpha = 0.0, beta, rho, rho_old = 1.0, delta, den;
+    float nom0, betanom, nomb, residual;
+
+    // some useful variables
+    float c_zero = MAGMA_S_ZERO;
+    magma_int_t dofs = A.num_rows;
+
+    magma_s_matrix r={Magma_CSR}, w={Magma_CSR}, p={Magma_CSR}, s={Magma_CSR};
+
+    //Chronometry
+    real_Double_t tempo1, tempo2;
+
+    if ( A.memory_location != Magma_CPU || b.num_cols != 1 ) {
+        printf("error: the CPU solver requires one RHS in host memory.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    // CPU workspace
+    CHECK( magma_svinit( &r, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &w, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &p, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &s, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+
+    // solver setup
+    for (magma_int_t i = 0; i < dofs; i++) {
+        x->val[i] = c_zero;                                             // x = 0
+        r.val[i] = b.val[i];                                            // r = b
+    }
+    nomb = magma_snrm2_cpu( dofs, b.val, queue );
+    solver_par->reduction_count++;
+    if ( nomb == 0.0 ){
+        nomb=1.0;
+    }
+
+    // w = A r, rho = r' * r, delta = r' * w
+    CHECK( magma_scacg_spmv_cpu( A, r.val, w.val, &rho, &delta, queue ));
+    solver_par->spmv_count++;
+    solver_par->reduction_count++;
+    nom0 = betanom = sqrt( rho );
+    solver_par->init_res = nom0;
+
+    solver_par->final_res = solver_par->init_res;
+    solver_par->iter_res = solver_par->init_res;
+    if( nom0 < solver_par->atol ||
+        nom0/nomb < solver_par->rtol ){
+        info = MAGMA_SUCCESS;
+        goto cleanup;
+    }
+    if ( solver_par->verbose > 0 ) {
+        solver_par->res_vec[0] = (real_Double_t) nom0;
+        solver_par->timing[0] = 0.0;
+    }
+
+    tempo1 = magma_wtime();
+
+    // start iteration
+    do
+    {
+        solver_par->numiter++;
+
+        // den = p' * A p, obtained from the recurrences
+        if ( solver_par->numiter == 1 ) {
+            beta = 0.0;
+            den = delta;
+        } else {
+            beta = rho / rho_old;
+            den = delta - beta * rho / alpha;
+        }
+        // check positive definite
+        if ( den <= 0.0 ) {
+            info = MAGMA_NONSPD;
+            break;
+        }
+        alpha = rho / den;
+        if( isnan( alpha ) || isinf( alpha ) ){
+            info = MAGMA_DIVERGENCE;
+            break;
+        }
+
+        // p = r + beta p, s = w + beta s, x = x + alpha p, r = r - alpha s
+        CHECK( magma_scacg_update_cpu( dofs, alpha, beta, x->val, r.val,
+                                       p.val, s.val, w.val, queue ));
+        // w = A r together with the inner products of the next iteration
+        rho_old = rho;
+        CHECK( magma_scacg_spmv_cpu( A, r.val, w.val, &rho, &delta, queue ));
+        solver_par->spmv_count++;
+        solver_par->reduction_count++;
+        betanom = sqrt( rho );
+
+        if ( solver_par->verbose > 0 ) {
+            tempo2 = magma_wtime();
+            if ( (solver_par->numiter)%solver_par->verbose==0 ) {
+                solver_par->res_vec[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) betanom;
+                solver_par->timing[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) tempo2-tempo1;
+            }
+        }
+
+        if (  betanom  < solver_par->atol ||
+              betanom/nomb < solver_par->rtol ) {
+            break;
+        }
+    }
+    while ( solver_par->numiter+1 <= solver_par->maxiter );
+
+    tempo2 = magma_wtime();
+    solver_par->runtime = (real_Double_t) tempo2-tempo1;
+    CHECK(  magma_sresidualvec( A, b, *x, &r, &residual, queue));
+    solver_par->iter_res = betanom;
+    solver_par->final_res = residual;
+
+    if ( info == MAGMA_NONSPD || info == MAGMA_DIVERGENCE ) {
+        // keep the error code
+    } else if ( solver_par->numiter < solver_par->maxiter ) {
+        info = MAGMA_SUCCESS;
+    } else if ( solver_par->init_res > solver_par->final_res ) {
+        info = MAGMA_SLOW_CONVERGENCE;
+        if( solver_par->iter_res < solver_par->atol ||
+            solver_par->iter_res/solver_par->init_res < solver_par->rtol ){
+            info = MAGMA_SUCCESS;
+        }
+    }
+    else {
+        info = MAGMA_DIVERGENCE;
+    }
+
+cleanup:
+    magma_smfree(&r, queue );
+    magma_smfree(&w, queue );
+    magma_smfree(&p, queue );
+    magma_smfree(&s, queue );
+
+    solver_par->info = info;
+    return info;
+}   /* magma_scacg_cpu */
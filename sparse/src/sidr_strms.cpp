@@ -9,11 +9,13 @@
        @author Eduardo Ponce
        @author Moritz Kreutzer
 
-       @generated from sparse/src/zidr_strms.cpp, normal z -> s, Sat Mar 27 20:32:55 2021
+       @generated from sparse/src/zidr_strms.cpp, normal z -> s, Sat Oct 17 00:26:41 2026
 */
 
 #include "magmasparse_internal.h"
+#if ! defined(HAVE_HOST)
 #include <cuda_profiler_api.h>
+#endif
 
 #define RTOLERANCE     lapackf77_slamch( "E" )
 #define ATOLERANCE     lapackf77_slamch( "E" )
@@ -307,7 +309,9 @@ magma_sidr_strms(
         solver_par->timing[0] = 0.0;
     }
 
+#if ! defined(HAVE_HOST)
 cudaProfilerStart();
+#endif
 
     om = MAGMA_S_ONE;
     gamma = MAGMA_S_ZERO;
@@ -696,7 +700,9 @@ cudaProfilerStart();
         magma_scopyvector_async( dr.num_rows, drs.dval, 1, dr.dval, 1, queue );
     }
 
+#if ! defined(HAVE_HOST)
 cudaProfilerStop();
+#endif
 
     // get last iteration timing
     tempo2 = magma_sync_wtime( queue );
@@ -7,7 +7,7 @@
 
        @author Hartwig Anzt
 
-       @generated from sparse/src/zparilu_cpu.cpp, normal z -> s, Sat Mar 27 20:33:02 2021
+       @generated from sparse/src/zparilu_cpu.cpp, normal z -> s, Fri Oct 16 22:51:20 2026
 */
 
 #include "magmasparse_internal.h"
@@ -27,7 +27,9 @@
     E. Chow and A. Patel: "Fine-grained Parallel Incomplete LU Factorization", 
     SIAM Journal on Scientific Computing, 37, C169-C193 (2015). 
     
-    This is the CPU implementation of the ParILU
+    This is the CPU implementation of the ParILU. If A and b are in host
+    memory, the factors are kept on the host and analyzed for the host
+    triangular solves (magma_ssptrsv_cpu).
 
     Arguments
     ---------
@@ -65,7 +67,11 @@ magma_sparilu_cpu(
     info = 0;
 
     magma_s_matrix hAT={Magma_CSR}, hA={Magma_CSR}, hAL={Magma_CSR}, 
-    hAU={Magma_CSR}, hAUT={Magma_CSR}, hAtmp={Magma_CSR}, hACOO={Magma_CSR};
+    hAU={Magma_CSR}, hAUT={Magma_CSR}, hAtmp={Magma_CSR}, hACOO={Magma_CSR},
+    hA0={Magma_CSR};
+    // with A and b in host memory, the factors stay on the host
+    magma_location_t location = (A.memory_location == Magma_CPU && 
+        b.memory_location == Magma_CPU) ? Magma_CPU : Magma_DEV;
 
     // copy original matrix as COO to device
     if (A.memory_location != Magma_CPU || A.storage_type != Magma_CSR) {
@@ -78,6 +84,7 @@ magma_sparilu_cpu(
 
     // in case using fill-in
     if (precond->levels > 0) {
+        CHECK(magma_smtransfer(hA, &hA0, Magma_CPU, Magma_CPU, queue));
         CHECK(magma_ssymbilu(&hA, precond->levels, &hAL, &hAUT,  queue));
         magma_smfree(&hAL, queue);
         magma_smfree(&hAUT, queue);
@@ -107,12 +114,22 @@ magma_sparilu_cpu(
     for (int i=0; i<precond->sweeps; i++) {
         CHECK(magma_sparilu_sweep(hACOO, &hAL, &hAU, queue));
     }
-    CHECK(magma_s_cucsrtranspose(hAU, &hAUT, queue));
+    CHECK(magma_smtranspose(hAU, &hAUT, queue));
 
-    CHECK(magma_smtransfer(hAL, &precond->L, Magma_CPU, Magma_DEV, queue));
-    CHECK(magma_smtransfer(hAUT, &precond->U, Magma_CPU, Magma_DEV, queue));
+    CHECK(magma_smtransfer(hAL, &precond->L, Magma_CPU, location, queue));
+    CHECK(magma_smtransfer(hAUT, &precond->U, Magma_CPU, location, queue));
+
+    // keep the symbolic structure and the sweep matrices for the refactorization
+    CHECK(magma_sparilu_keepsymbolic((precond->levels > 0) ? hA0 : hA, hA, 
+        hAL, hAU, &hACOO, &hAL, &hAU, precond, queue));
     
-    if (precond->trisolver == 0 || precond->trisolver == Magma_CUSOLVE) {
+    if (location == Magma_CPU) {
+        // level sets for the host triangular solves
+        CHECK(magma_ssptrsv_analysis_cpu(MagmaLower, precond->L, 
+            &precond->sptrsvL, queue));
+        CHECK(magma_ssptrsv_analysis_cpu(MagmaUpper, precond->U, 
+            &precond->sptrsvU, queue));
+    } else if (precond->trisolver == 0 || precond->trisolver == Magma_CUSOLVE) {
         CHECK(magma_scumilugeneratesolverinfo(precond, queue));
     } else {
         //prepare for iterative solves
@@ -136,6 +153,7 @@ cleanup:
     magma_smfree(&hAUT, queue);
     magma_smfree(&hAtmp, queue);
     magma_smfree(&hACOO, queue);
+    magma_smfree(&hA0, queue);
 
 #endif
     return info;
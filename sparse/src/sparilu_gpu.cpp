@@ -7,7 +7,7 @@
 
        @author Hartwig Anzt
 
-       @generated from sparse/src/zparilu_gpu.cpp, normal z -> s, Sat Mar 27 20:33:02 2021
+       @generated from sparse/src/zparilu_gpu.cpp, normal z -> s, Fri Oct 16 18:11:08 2026
 */
 
 #include "magmasparse_internal.h"
@@ -59,7 +59,8 @@ magma_sparilu_gpu(
 
     magma_s_matrix hAT={Magma_CSR}, hA={Magma_CSR}, hAL={Magma_CSR}, 
     hAU={Magma_CSR}, hAUT={Magma_CSR}, hAtmp={Magma_CSR}, hACOO={Magma_CSR},
-    dAL={Magma_CSR}, dAU={Magma_CSR}, dAUT={Magma_CSR}, dACOO={Magma_CSR};
+    dAL={Magma_CSR}, dAU={Magma_CSR}, dAUT={Magma_CSR}, dACOO={Magma_CSR},
+    hA0={Magma_CSR};
 
     // copy original matrix as COO to device
     if (A.memory_location != Magma_CPU || A.storage_type != Magma_CSR) {
@@ -72,6 +73,7 @@ magma_sparilu_gpu(
 
     // in case using fill-in
     if (precond->levels > 0) {
+        CHECK(magma_smtransfer(hA, &hA0, Magma_CPU, Magma_CPU, queue));
         CHECK(magma_ssymbilu(&hA, precond->levels, &hAL, &hAUT,  queue));
         magma_smfree(&hAL, queue);
         magma_smfree(&hAUT, queue);
@@ -109,6 +111,10 @@ magma_sparilu_gpu(
 
     CHECK(magma_smtransfer(dAL, &precond->L, Magma_DEV, Magma_DEV, queue));
     CHECK(magma_smtransfer(dAUT, &precond->U, Magma_DEV, Magma_DEV, queue));
+
+    // keep the symbolic structure and the sweep matrices for the refactorization
+    CHECK(magma_sparilu_keepsymbolic((precond->levels > 0) ? hA0 : hA, hA, 
+        hAL, hAU, &dACOO, &dAL, &dAU, precond, queue));
     
     if (precond->trisolver == 0 || precond->trisolver == Magma_CUSOLVE) {
         CHECK(magma_scumilugeneratesolverinfo(precond, queue));
@@ -138,6 +144,7 @@ cleanup:
     magma_smfree(&hAUT, queue);
     magma_smfree(&hAtmp, queue);
     magma_smfree(&hACOO, queue);
+    magma_smfree(&hA0, queue);
 
     
     return info;
@@ -0,0 +1,360 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/src/zparilu_refactor.cpp, normal z -> s, Fri Oct 16 18:15:13 2026
+*/
+
+#include "magmasparse_internal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define PRECISION_s
+
+
+/**
+    Purpose
+    -------
+    Copies n values between two matrices of the same pattern, whatever memory
+    location either of them lives in.
+*/
+static magma_int_t
+magma_sparilu_refactor_copyval(
+    magma_int_t n,
+    magma_s_matrix src,
+    magma_s_matrix *dst,
+    magma_queue_t queue )
+{
+    if ( src.memory_location == Magma_CPU && dst->memory_location == Magma_CPU ) {
+        memcpy( dst->val, src.val, n * sizeof(float) );
+    } else if ( src.memory_location == Magma_CPU ) {
+        magma_ssetvector( n, src.val, 1, dst->dval, 1, queue );
+    } else if ( dst->memory_location == Magma_CPU ) {
+        magma_sgetvector( n, src.dval, 1, dst->val, 1, queue );
+    } else {
+        magma_scopyvector( n, src.dval, 1, dst->dval, 1, queue );
+    }
+    return MAGMA_SUCCESS;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+
+    Keeps the symbolic part of a ParILU setup in precond->refactor so that
+    magma_sparilu_refactor can later refresh the factors of a matrix with the
+    same sparsity pattern without redoing the symbolic fill-in, the tril/triu
+    split, the transpose or the COO conversion.
+
+    The index maps are computed from the host copies of the patterns, the
+    sweep matrices ACOO, L and UT are moved into precond->refactor (wherever
+    they are located) and are left empty on return.
+
+    Arguments
+    ---------
+
+    @param[in]
+    hA0         magma_s_matrix
+                input matrix in CSR on the CPU as passed to the setup
+
+    @param[in]
+    hA          magma_s_matrix
+                hA0 including the symbolic fill-in, CSR on the CPU; may share
+                its arrays with hA0 if no fill-in was computed
+
+    @param[in]
+    hAL         magma_s_matrix
+                lower triangular part of hA, CSR on the CPU
+
+    @param[in]
+    hAU         magma_s_matrix
+                upper triangular part of hA in CSC (U^T in CSR) on the CPU
+
+    @param[in,out]
+    ACOO        magma_s_matrix*
+                hA in CSRCOO as used by the sweeps
+
+    @param[in,out]
+    L           magma_s_matrix*
+                lower triangular factor as used by the sweeps
+
+    @param[in,out]
+    UT          magma_s_matrix*
+                upper triangular factor in CSC as used by the sweeps
+
+    @param[in,out]
+    precond     magma_s_preconditioner*
+                preconditioner parameters
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgepr
+*******************************************************************************/
+
+extern "C"
+magma_int_t
+magma_sparilu_keepsymbolic(
+    magma_s_matrix hA0,
+    magma_s_matrix hA,
+    magma_s_matrix hAL,
+    magma_s_matrix hAU,
+    magma_s_matrix *ACOO,
+    magma_s_matrix *L,
+    magma_s_matrix *UT,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    magma_s_matrix empty={Magma_CSR};
+    magma_s_refactor_info rf;
+    magma_index_t *ptr = NULL;
+
+    rf.num_rows = hA0.num_rows;
+    rf.nnz = hA0.nnz;
+    rf.Amap = NULL;
+    rf.Lmap = NULL;
+    rf.Umap = NULL;
+    rf.UTmap = NULL;
+
+    CHECK( magma_index_malloc_cpu( &rf.Lmap, hA.nnz ));
+    CHECK( magma_index_malloc_cpu( &rf.Umap, hA.nnz ));
+    CHECK( magma_index_malloc_cpu( &rf.UTmap, hAU.nnz ));
+    CHECK( magma_index_malloc_cpu( &ptr, hA.num_rows+1 ));
+
+    // position of every entry of A in the filled pattern
+    if ( hA0.col != hA.col ) {
+        CHECK( magma_index_malloc_cpu( &rf.Amap, hA0.nnz ));
+        #pragma omp parallel for
+        for (magma_int_t row=0; row < hA0.num_rows; row++) {
+            for (magma_int_t k=hA0.row[row]; k < hA0.row[row+1]; k++) {
+                rf.Amap[k] = -1;
+                for (magma_int_t f=hA.row[row]; f < hA.row[row+1]; f++) {
+                    if ( hA.col[f] == hA0.col[k] ) {
+                        rf.Amap[k] = f;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // position of every filled entry in L and in U^T; the unit diagonal of L
+    // is never touched by the sweeps, diagonal positions are stored as -2-pos
+    #pragma omp parallel for
+    for (magma_int_t row=0; row < hA.num_rows; row++) {
+        for (magma_int_t f=hA.row[row]; f < hA.row[row+1]; f++) {
+            magma_index_t col = hA.col[f];
+            rf.Lmap[f] = -1;
+            rf.Umap[f] = -1;
+            if ( col <= row ) {
+                for (magma_int_t k=hAL.row[row]; k < hAL.row[row+1]; k++) {
+                    if ( hAL.col[k] == col ) {
+                        rf.Lmap[f] = ( col == row ) ? -2-k : k;
+                        break;
+                    }
+                }
+            }
+            if ( col >= row ) {
+                for (magma_int_t k=hAU.row[col]; k < hAU.row[col+1]; k++) {
+                    if ( hAU.col[k] == row ) {
+                        rf.Umap[f] = k;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // position of every entry of U^T in U, the transpose is column-sorted
+    for (magma_int_t i=0; i < hA.num_rows+1; i++) {
+        ptr[i] = 0;
+    }
+    for (magma_int_t k=0; k < hAU.nnz; k++) {
+        ptr[hAU.col[k]+1]++;
+    }
+    for (magma_int_t i=0; i < hA.num_rows; i++) {
+        ptr[i+1] += ptr[i];
+    }
+    for (magma_int_t row=0; row < hAU.num_rows; row++) {
+        for (magma_int_t k=hAU.row[row]; k < hAU.row[row+1]; k++) {
+            rf.UTmap[k] = ptr[hAU.col[k]]++;
+        }
+    }
+
+    rf.ACOO = *ACOO;
+    rf.L = *L;
+    rf.UT = *UT;
+    *ACOO = empty;
+    *L = empty;
+    *UT = empty;
+    precond->refactor = rf;
+
+cleanup:
+    if ( info != 0 ) {
+        magma_free_cpu( rf.Amap );
+        magma_free_cpu( rf.Lmap );
+        magma_free_cpu( rf.Umap );
+        magma_free_cpu( rf.UTmap );
+    }
+    magma_free_cpu( ptr );
+    return info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+
+    Numeric-only refactorization of a ParILU preconditioner. The values of A
+    are scattered into the sweep matrices kept by magma_sparilu_keepsymbolic,
+    the fixed-point sweeps are rerun and the new factors are written into
+    precond->L and precond->U in place. A must have the same sparsity pattern
+    as the matrix the preconditioner was set up for. The triangular solve
+    information (cuSPARSE or host level sets) is kept; for the iterative
+    triangular solves only the diagonal scaling is refreshed.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                input matrix A, same pattern as at setup
+
+    @param[in,out]
+    precond     magma_s_preconditioner*
+                preconditioner parameters
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgepr
+*******************************************************************************/
+
+extern "C"
+magma_int_t
+magma_sparilu_refactor(
+    magma_s_matrix A,
+    magma_s_preconditioner *precond,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+
+    magma_s_refactor_info *rf = &precond->refactor;
+    magma_s_matrix hAT={Magma_CSR}, hA={Magma_CSR};
+    magma_s_matrix hACOO={Magma_CSR}, hL={Magma_CSR}, hUT={Magma_CSR},
+        hU={Magma_CSR};
+    magma_int_t onhost = MagmaTrue;
+
+    if ( rf->Lmap == NULL || A.num_rows != rf->num_rows || A.nnz != rf->nnz ) {
+        info = MAGMA_ERR_ILLEGAL_VALUE;
+        goto cleanup;
+    }
+    onhost = ( rf->ACOO.memory_location == Magma_CPU );
+
+    // values of A in CSR on the CPU
+    if ( A.memory_location == Magma_CPU && A.storage_type == Magma_CSR ) {
+        hA = A;
+        hA.ownership = MagmaFalse;
+    } else if ( A.storage_type != Magma_CSR ) {
+        CHECK( magma_smtransfer( A, &hAT, A.memory_location, Magma_CPU, queue ));
+        CHECK( magma_smconvert( hAT, &hA, hAT.storage_type, Magma_CSR, queue ));
+    } else {
+        CHECK( magma_smtransfer( A, &hA, A.memory_location, Magma_CPU, queue ));
+    }
+
+    // host staging of the sweep matrices if the sweeps run on the device
+    hACOO = rf->ACOO;
+    hL = rf->L;
+    hUT = rf->UT;
+    if ( ! onhost ) {
+        hACOO.memory_location = Magma_CPU;
+        hL.memory_location = Magma_CPU;
+        hUT.memory_location = Magma_CPU;
+        hACOO.val = NULL;
+        hL.val = NULL;
+        hUT.val = NULL;
+        CHECK( magma_smalloc_cpu( &hACOO.val, rf->ACOO.nnz ));
+        CHECK( magma_smalloc_cpu( &hL.val, rf->L.nnz ));
+        CHECK( magma_smalloc_cpu( &hUT.val, rf->UT.nnz ));
+    }
+    hU.memory_location = Magma_CPU;
+    CHECK( magma_smalloc_cpu( &hU.val, rf->UT.nnz ));
+
+    // refresh the values: A -> filled pattern -> L and U^T
+    if ( rf->Amap != NULL ) {
+        #pragma omp parallel for
+        for (magma_int_t f=0; f < rf->ACOO.nnz; f++) {
+            hACOO.val[f] = MAGMA_S_ZERO;
+        }
+        #pragma omp parallel for
+        for (magma_int_t k=0; k < hA.nnz; k++) {
+            hACOO.val[rf->Amap[k]] = hA.val[k];
+        }
+    } else {
+        memcpy( hACOO.val, hA.val, hA.nnz * sizeof(float) );
+    }
+    #pragma omp parallel for
+    for (magma_int_t f=0; f < rf->ACOO.nnz; f++) {
+        magma_index_t l = rf->Lmap[f];
+        if ( l >= 0 ) {
+            hL.val[l] = hACOO.val[f];
+        } else if ( l < -1 ) {
+            hL.val[-2-l] = MAGMA_S_ONE;
+        }
+        if ( rf->Umap[f] >= 0 ) {
+            hUT.val[rf->Umap[f]] = hACOO.val[f];
+        }
+    }
+    if ( ! onhost ) {
+        magma_sparilu_refactor_copyval( rf->ACOO.nnz, hACOO, &rf->ACOO, queue );
+        magma_sparilu_refactor_copyval( rf->L.nnz, hL, &rf->L, queue );
+        magma_sparilu_refactor_copyval( rf->UT.nnz, hUT, &rf->UT, queue );
+    }
+
+    for (int i=0; i<precond->sweeps; i++) {
+        if ( onhost ) {
+            CHECK( magma_sparilu_sweep( rf->ACOO, &rf->L, &rf->UT, queue ));
+        } else {
+            CHECK( magma_sparilu_csr( rf->ACOO, rf->L, rf->UT, queue ));
+        }
+    }
+
+    // new factors into the preconditioner, U^T -> U by the kept permutation
+    magma_sparilu_refactor_copyval( rf->L.nnz, rf->L, &precond->L, queue );
+    if ( ! onhost ) {
+        magma_sparilu_refactor_copyval( rf->UT.nnz, rf->UT, &hUT, queue );
+    }
+    #pragma omp parallel for
+    for (magma_int_t k=0; k < rf->UT.nnz; k++) {
+        hU.val[rf->UTmap[k]] = hUT.val[k];
+    }
+    magma_sparilu_refactor_copyval( rf->UT.nnz, hU, &precond->U, queue );
+
+    if ( precond->L.memory_location == Magma_DEV &&
+         precond->trisolver != 0 && precond->trisolver != Magma_CUSOLVE ) {
+        magma_smfree( &precond->d, queue );
+        magma_smfree( &precond->d2, queue );
+        CHECK( magma_sjacobisetup_diagscal( precond->L, &precond->d, queue ));
+        CHECK( magma_sjacobisetup_diagscal( precond->U, &precond->d2, queue ));
+    }
+
+cleanup:
+    if ( ! onhost ) {
+        magma_free_cpu( hACOO.val );
+        magma_free_cpu( hL.val );
+        magma_free_cpu( hUT.val );
+    }
+    magma_free_cpu( hU.val );
+    magma_smfree( &hAT, queue );
+    magma_smfree( &hA, queue );
+    return info;
+}
@@ -7,7 +7,7 @@
 
        @author Hartwig Anzt
 
-       @generated from sparse/src/zparilut.cpp, normal z -> s, Sat Mar 27 20:33:04 2021
+       @generated from sparse/src/zparilut.cpp, normal z -> s, Fri Oct 16 18:32:16 2026
 */
 
 #include "magmasparse_internal.h"
@@ -317,15 +317,9 @@ magma_sparilut(
         end = magma_sync_wtime( queue ); t_selectadd+=end-start;
         
         start = magma_sync_wtime( queue );
-        #pragma omp parallel        
-        for(int row=0; row<hL.num_rows; row++){
-            magma_sindexsort( &hL.col[hL.row[row]], 0, hL.row[row+1]-hL.row[row]-1, queue );
-        }
+        CHECK( magma_scsr_sort( &hL, queue ) );
 
-        #pragma omp parallel  
-        for(int row=0; row<hL.num_rows; row++){
-            magma_sindexsort( &hU.col[hU.row[row]], 0, hU.row[row+1]-hU.row[row]-1, queue );
-        }
+        CHECK( magma_scsr_sort( &hU, queue ) );
         CHECK( magma_smatrix_cup(  L, oneL, &L_new, queue ) );   
         CHECK( magma_smatrix_cup(  U, oneU, &U_new, queue ) );
         //magma_smatrix_addrowindex( &U, queue );
@@ -7,7 +7,7 @@
 
        @author Hartwig Anzt
 
-       @generated from sparse/src/zparilut_cpu.cpp, normal z -> s, Sat Mar 27 20:33:04 2021
+       @generated from sparse/src/zparilut_cpu.cpp, normal z -> s, Fri Oct 16 18:02:39 2026
 */
 
 #include "magmasparse_internal.h"
@@ -72,6 +72,105 @@ magma_sparilut_cpu(
     magma_s_matrix b,
     magma_s_preconditioner *precond,
     magma_queue_t queue)
+{
+    magma_int_t info = 0;
+    magma_s_parilut_workspace ws={0};
+    
+    info = magma_sparilut_cpu_ws(A, b, precond, &ws, queue);
+    
+    magma_sparilut_workspace_free(&ws, queue);
+    return info;
+}
+
+
+/**
+    Purpose
+    -------
+    Copies the host CSR matrix A into the workspace matrix B and adds the
+    row indices.
+*/
+static magma_int_t
+magma_sparilut_ws_copy(
+    magma_s_matrix A,
+    magma_s_matrix *B,
+    magma_queue_t queue)
+{
+    magma_int_t info = 0;
+    
+    B->num_cols = A.num_cols;
+    CHECK(magma_smatrix_reserve(A.num_rows, A.nnz, B, queue));
+    
+    #pragma omp parallel for
+    for (magma_int_t row=0; row<A.num_rows+1; row++) {
+        B->row[row] = A.row[row];
+    }
+    #pragma omp parallel for
+    for (magma_int_t row=0; row<A.num_rows; row++) {
+        for (magma_int_t i=A.row[row]; i<A.row[row+1]; i++) {
+            B->val[i] = A.val[i];
+            B->col[i] = A.col[i];
+            B->rowidx[i] = row;
+        }
+    }
+    
+cleanup:
+    return info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+
+    Generates an incomplete threshold LU preconditioner via the ParILUT 
+    algorithm like magma_sparilut_cpu, but keeps all matrices and scratch the
+    sweeps need in the workspace ws. Once the workspace has grown to the size
+    the sweeps need, the iteration does not allocate any memory. The workspace
+    can be passed to subsequent calls generating the preconditioner for 
+    matrices of the same size (e.g. the same pattern with new values), and is
+    released with magma_sparilut_workspace_free.
+
+    This function requires OpenMP, and is only available if OpenMP is activated.
+    
+    The parameter list is:
+    
+    precond.sweeps : number of ParILUT steps
+    precond.atol   : absolute fill ratio (1.0 keeps nnz count constant)
+
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                input matrix A
+
+    @param[in]
+    b           magma_s_matrix
+                input RHS b
+
+    @param[in,out]
+    precond     magma_s_preconditioner*
+                preconditioner parameters
+
+    @param[in,out]
+    ws          magma_s_parilut_workspace*
+                workspace, empty or set up by a previous call
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgepr
+*******************************************************************************/
+extern "C"
+magma_int_t
+magma_sparilut_cpu_ws(
+    magma_s_matrix A,
+    magma_s_matrix b,
+    magma_s_preconditioner *precond,
+    magma_s_parilut_workspace *ws,
+    magma_queue_t queue)
 {
     magma_int_t info = 0;
     
@@ -85,9 +184,10 @@ magma_sparilut_cpu(
     float sum, sumL, sumU;
 
     magma_s_matrix hA={Magma_CSR}, hAT={Magma_CSR}, hL={Magma_CSR}, 
-        hU={Magma_CSR}, oneL={Magma_CSR}, oneU={Magma_CSR},
-        L={Magma_CSR}, U={Magma_CSR}, L_new={Magma_CSR}, U_new={Magma_CSR}, 
-        UT={Magma_CSR}, L0={Magma_CSR}, U0={Magma_CSR};
+        hU={Magma_CSR}, L0={Magma_CSR}, U0={Magma_CSR}, T={Magma_CSR};
+    magma_s_matrix *L = &ws->L, *U = &ws->U, *UT = &ws->UT,
+        *L_new = &ws->L_new, *U_new = &ws->U_new, 
+        *oneL = &ws->oneL, *oneU = &ws->oneU;
     magma_int_t num_rmL, num_rmU;
     float thrsL = 0.0;
     float thrsU = 0.0;
@@ -102,6 +202,12 @@ magma_sparilut_cpu(
     
     CHECK(magma_smtransfer(A, &hA, A.memory_location, Magma_CPU, queue));
     
+    // the workspace is kept as long as the dimension does not change
+    if (ws->num_rows != hA.num_rows) {
+        magma_sparilut_workspace_free(ws, queue);
+        ws->num_rows = hA.num_rows;
+    }
+    
     // in case using fill-in
     if (precond->levels > 0) {
         CHECK(magma_ssymbilu(&hA, precond->levels, &hL, &hU , queue));
@@ -110,17 +216,14 @@ magma_sparilut_cpu(
     }
     CHECK(magma_smatrix_tril(hA, &L0, queue));
     CHECK(magma_smatrix_triu(hA, &U0, queue));
-    magma_smfree(&hU, queue);
-    magma_smfree(&hL, queue);
-    CHECK(magma_smatrix_tril(hA, &L, queue));
+    CHECK(magma_sparilut_ws_copy(L0, L, queue));
     CHECK(magma_smtranspose(hA, &hAT, queue));
-    CHECK(magma_smatrix_tril(hAT, &U, queue));
-    CHECK(magma_smatrix_addrowindex(&L, queue)); 
-    CHECK(magma_smatrix_addrowindex(&U, queue)); 
-    L0nnz=L.nnz;
-    U0nnz=U.nnz;
-    oneL.memory_location = Magma_CPU;
-    oneU.memory_location = Magma_CPU;
+    CHECK(magma_smatrix_tril(hAT, &T, queue));
+    CHECK(magma_sparilut_ws_copy(T, U, queue));
+    magma_smfree(&T, queue);
+    magma_smfree(&hAT, queue);
+    L0nnz=L->nnz;
+    U0nnz=U->nnz;
         
     if (timing == 1) {
         printf("ilut_fill_ratio = %.6f;\n\n", precond->atol);  
@@ -137,106 +240,97 @@ magma_sparilut_cpu(
      
         // step 1: transpose U
         start = magma_sync_wtime(queue);
-        magma_smfree(&UT, queue);
-        CHECK(magma_scsrcoo_transpose(U, &UT, queue));
+        CHECK(magma_scsrcoo_transpose_ws(*U, UT, ws, queue));
         end = magma_sync_wtime(queue); t_transpose1+=end-start;
         
         
         // step 2: find candidates
         start = magma_sync_wtime(queue);
-        CHECK(magma_sparilut_candidates(L0, U0, L, UT, &hL, &hU, queue));
+        CHECK(magma_sparilut_candidates_ws(L0, U0, *L, *UT, &ws->hL, &ws->hU, ws, queue));
         end = magma_sync_wtime(queue); t_cand=+end-start;
         
         
         // step 3: compute residuals (optional when adding all candidates)
         start = magma_sync_wtime(queue);
-        CHECK(magma_sparilut_residuals(hA, L, U, &hL, queue));
-        CHECK(magma_sparilut_residuals(hA, L, U, &hU, queue));
+        CHECK(magma_sparilut_residuals(hA, *L, *U, &ws->hL, queue));
+        CHECK(magma_sparilut_residuals(hA, *L, *U, &ws->hU, queue));
         end = magma_sync_wtime(queue); t_res=+end-start;
         start = magma_sync_wtime(queue);
-        CHECK(magma_smatrix_abssum(hL, &sumL, queue));
-        CHECK(magma_smatrix_abssum(hU, &sumU, queue));
+        CHECK(magma_smatrix_abssum(ws->hL, &sumL, queue));
+        CHECK(magma_smatrix_abssum(ws->hU, &sumU, queue));
         sum = sumL + sumU;
         end = magma_sync_wtime(queue); t_nrm+=end-start;
-        CHECK(magma_smatrix_swap(&hL, &oneL, queue));
-        magma_smfree(&hL, queue);
+        CHECK(magma_smatrix_swap(&ws->hL, oneL, queue));
         
         
         // step 4: sort candidates
         start = magma_sync_wtime(queue);
-        CHECK(magma_scsr_sort(&hL, queue));
-        CHECK(magma_scsr_sort(&hU, queue));
+        CHECK(magma_scsr_sort(&ws->hU, queue));
         end = magma_sync_wtime(queue); t_sort+=end-start;
         
         
         // step 5: transpose candidates
         start = magma_sync_wtime(queue);
-        magma_scsrcoo_transpose(hU, &oneU, queue);
+        CHECK(magma_scsrcoo_transpose_ws(ws->hU, oneU, ws, queue));
         end = magma_sync_wtime(queue); t_transpose2+=end-start;
         
         
         // step 6: add candidates
         start = magma_sync_wtime(queue);
-        CHECK(magma_smatrix_cup(L, oneL, &L_new, queue));   
-        CHECK(magma_smatrix_cup(U, oneU, &U_new, queue));
+        CHECK(magma_smatrix_cup_ws(*L, *oneL, L_new, queue));   
+        CHECK(magma_smatrix_cup_ws(*U, *oneU, U_new, queue));
         end = magma_sync_wtime(queue); t_add=+end-start;
-        magma_smfree(&oneL, queue);
-        magma_smfree(&oneU, queue);
        
         
         // step 7: sweep
         start = magma_sync_wtime(queue);
-        CHECK(magma_sparilut_sweep_sync(&hA, &L_new, &U_new, queue));
+        CHECK(magma_sparilut_sweep_sync_ws(&hA, L_new, U_new, ws, queue));
         end = magma_sync_wtime(queue); t_sweep1+=end-start;
         
         
         // step 8: select threshold to remove elements
         start = magma_sync_wtime(queue);
-        num_rmL = max((L_new.nnz-L0nnz*(1+(precond->atol-1.)
+        num_rmL = max((L_new->nnz-L0nnz*(1+(precond->atol-1.)
             *(iters+1)/precond->sweeps)), 0);
-        num_rmU = max((U_new.nnz-U0nnz*(1+(precond->atol-1.)
+        num_rmU = max((U_new->nnz-U0nnz*(1+(precond->atol-1.)
             *(iters+1)/precond->sweeps)), 0);
         // pre-select: ignore the diagonal entries
-        CHECK(magma_sparilut_preselect(0, &L_new, &oneL, queue));
-        CHECK(magma_sparilut_preselect(0, &U_new, &oneU, queue));
+        CHECK(magma_sparilut_preselect_ws(0, L_new, oneL, queue));
+        CHECK(magma_sparilut_preselect_ws(0, U_new, oneU, queue));
         if (num_rmL>0) {
-            CHECK(magma_sparilut_set_thrs_randomselect_approx(num_rmL, 
-                &oneL, 0, &thrsL, queue));
+            CHECK(magma_sparilut_set_thrs_randomselect_approx_ws(num_rmL, 
+                oneL, 0, &thrsL, ws, queue));
         } else {
             thrsL = 0.0;
         }
         if (num_rmU>0) {
-            CHECK(magma_sparilut_set_thrs_randomselect_approx(num_rmU, 
-                &oneU, 0, &thrsU, queue));
+            CHECK(magma_sparilut_set_thrs_randomselect_approx_ws(num_rmU, 
+                oneU, 0, &thrsU, ws, queue));
         } else {
             thrsU = 0.0;
         }
-        magma_smfree(&oneL, queue);
-        magma_smfree(&oneU, queue);
         end = magma_sync_wtime(queue); t_selectrm=end-start;
 
         
         // step 9: remove elements
         start = magma_sync_wtime(queue);
-        CHECK(magma_sparilut_thrsrm(1, &L_new, &thrsL, queue));
-        CHECK(magma_sparilut_thrsrm(1, &U_new, &thrsU, queue));
-        CHECK(magma_smatrix_swap(&L_new, &L, queue));
-        CHECK(magma_smatrix_swap(&U_new, &U, queue));
-        magma_smfree(&L_new, queue);
-        magma_smfree(&U_new, queue);
+        CHECK(magma_sparilut_thrsrm_ws(1, L_new, &thrsL, ws, queue));
+        CHECK(magma_sparilut_thrsrm_ws(1, U_new, &thrsU, ws, queue));
+        CHECK(magma_smatrix_swap(L_new, L, queue));
+        CHECK(magma_smatrix_swap(U_new, U, queue));
         end = magma_sync_wtime(queue); t_rm=end-start;
         
         
         // step 10: sweep
         start = magma_sync_wtime(queue);
-        CHECK(magma_sparilut_sweep_sync(&hA, &L, &U, queue));
+        CHECK(magma_sparilut_sweep_sync_ws(&hA, L, U, ws, queue));
         end = magma_sync_wtime(queue); t_sweep2+=end-start;
         
         if (timing == 1) {
             t_total = t_transpose1+ t_cand+ t_res+ t_sort+ t_transpose2+ t_add+ t_sweep1+ t_selectrm+ t_rm+ t_sweep2;
             accum = accum + t_total;
             printf("%5lld %10lld %10lld  %.4e   %.2e  %.2e  %.2e  %.2e  %.2e  %.2e  %.2e  %.2e  %.2e  %.2e  %.2e      %.2e\n",
-                (long long) iters, (long long) L.nnz, (long long) U.nnz, 
+                (long long) iters, (long long) L->nnz, (long long) U->nnz, 
                 (float) sum, 
                 t_transpose1, t_cand, t_res, t_sort, t_transpose2, t_add, t_sweep1, t_selectrm, t_rm, t_sweep2, t_total, accum);
             fflush(stdout);
@@ -250,10 +344,9 @@ magma_sparilut_cpu(
     //##########################################################################
 
     // for CUSPARSE
-    CHECK(magma_smtransfer(L, &precond->L, Magma_CPU, Magma_DEV , queue));
-    CHECK(magma_scsrcoo_transpose(U, &UT, queue));
-    //magma_smtranspose(U, &UT, queue);
-    CHECK(magma_smtransfer(UT, &precond->U, Magma_CPU, Magma_DEV , queue));
+    CHECK(magma_smtransfer(*L, &precond->L, Magma_CPU, Magma_DEV , queue));
+    CHECK(magma_scsrcoo_transpose_ws(*U, UT, ws, queue));
+    CHECK(magma_smtransfer(*UT, &precond->U, Magma_CPU, Magma_DEV , queue));
     
     if (precond->trisolver == 0 || precond->trisolver == Magma_CUSOLVE) {
         CHECK(magma_scumilugeneratesolverinfo(precond, queue));
@@ -272,13 +365,9 @@ magma_sparilut_cpu(
 cleanup:
     magma_smfree(&hA, queue);
     magma_smfree(&hAT, queue);
-    magma_smfree(&L, queue);
-    magma_smfree(&U, queue);
-    magma_smfree(&UT, queue);
+    magma_smfree(&T, queue);
     magma_smfree(&L0, queue);
     magma_smfree(&U0, queue);
-    magma_smfree(&L_new, queue);
-    magma_smfree(&U_new, queue);
     magma_smfree(&hL, queue);
     magma_smfree(&hU, queue);
 #endif
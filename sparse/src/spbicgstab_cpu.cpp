@@ -0,0 +1,250 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/src/zpbicgstab_cpu.cpp, normal z -> s, Fri Oct 16 22:50:54 2026
+*/
+
+#include "magmasparse_internal.h"
+
+#define ATOLERANCE     lapackf77_slamch( "E" )
+
+
+/**
+    Purpose
+    -------
+
+    Solves a system of linear equations
+       A * X = B
+    where A is a general real matrix.
+    This is a CPU implementation of the right-preconditioned Biconjugate
+    Gradient Stabilized method (see magma_spbicgstab): all linear algebra
+    objects, including the preconditioner, are expected in host memory.
+    The preconditioner is applied with magma_s_applyprecond_left and
+    magma_s_applyprecond_right, and the SpMV producing v is fused with the
+    dot product <rr,v>.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                input matrix A
+
+    @param[in]
+    b           magma_s_matrix
+                RHS b
+
+    @param[in,out]
+    x           magma_s_matrix*
+                solution approximation
+
+    @param[in,out]
+    solver_par  magma_s_solver_par*
+                solver parameters
+
+    @param[in]
+    precond_par magma_s_preconditioner*
+                preconditioner, set up in host memory
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgesv
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_spbicgstab_cpu(
+    magma_s_matrix A, magma_s_matrix b, magma_s_matrix *x,
+    magma_s_solver_par *solver_par,
+    magma_s_preconditioner *precond_par,
+    magma_queue_t queue )
+{
+    magma_int_t info = MAGMA_NOTCONVERGED;
+
+    // prepare solver feedback
+    solver_par->solver = Magma_PBICGSTAB;
+    solver_par->numiter = 0;
+    solver_par->spmv_count = 0;
+    solver_par->reduction_count = 0;
+
+    // some useful variables
+    float c_zero = MAGMA_S_ZERO;
+    magma_int_t dofs = A.num_rows;
+
+    // workspace
+    magma_s_matrix r={Magma_CSR}, rr={Magma_CSR}, p={Magma_CSR}, v={Magma_CSR},
+    s={Magma_CSR}, t={Magma_CSR}, ms={Magma_CSR}, mt={Magma_CSR}, y={Magma_CSR},
+    z={Magma_CSR};
+
+    // solver variables
+    float alpha, beta, omega, rho_old, rho_new, rrv, ts, tt;
+    float betanom, nom0, r0, nomb, residual;
+
+    //Chronometry
+    real_Double_t tempo1, tempo2;
+
+    if ( A.memory_location != Magma_CPU || b.num_cols != 1 ) {
+        printf("error: the CPU solver requires one RHS in host memory.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    CHECK( magma_svinit( &r, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &rr,Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &p, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &v, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &s, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &t, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &ms,Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &mt,Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &y, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+    CHECK( magma_svinit( &z, Magma_CPU, A.num_rows, 1, c_zero, queue ));
+
+    // solver setup
+    CHECK(  magma_sresidualvec( A, b, *x, &r, &nom0, queue));
+    solver_par->reduction_count++;
+    for (magma_int_t i = 0; i < dofs; i++) {
+        rr.val[i] = r.val[i];                                           // rr = r
+    }
+    betanom = nom0;
+    rho_new = MAGMA_S_MAKE( nom0 * nom0, 0.0 );                         // rho=<rr,r>
+    rho_old = omega = alpha = MAGMA_S_MAKE( 1.0, 0. );
+    solver_par->init_res = nom0;
+
+    nomb = magma_snrm2_cpu( dofs, b.val, queue );
+    solver_par->reduction_count++;
+    if ( nomb == 0.0 ){
+        nomb=1.0;
+    }
+    if ( (r0 = nomb * solver_par->rtol) < ATOLERANCE ){
+        r0 = ATOLERANCE;
+    }
+
+    solver_par->final_res = solver_par->init_res;
+    solver_par->iter_res = solver_par->init_res;
+    if ( solver_par->verbose > 0 ) {
+        solver_par->res_vec[0] = nom0;
+        solver_par->timing[0] = 0.0;
+    }
+    if ( nom0 < r0 || nom0 < solver_par->atol ) {
+        info = MAGMA_SUCCESS;
+        goto cleanup;
+    }
+
+    tempo1 = magma_wtime();
+
+    // start iteration
+    do
+    {
+        solver_par->numiter++;
+
+        beta = rho_new/rho_old * alpha/omega;   // beta=rho/rho_old *alpha/omega
+        if( magma_s_isnan_inf( beta ) ){
+            info = MAGMA_DIVERGENCE;
+            break;
+        }
+        rho_old = rho_new;
+
+        // p = r + beta * ( p - omega * v )
+        CHECK( magma_sbicgstab_1_cpu( dofs, beta, omega, r.val, v.val, p.val, queue ));
+
+        // y = M^{-1} p
+        CHECK( magma_s_applyprecond_left( MagmaNoTrans, A, p, &mt, precond_par, queue ));
+        CHECK( magma_s_applyprecond_right( MagmaNoTrans, A, mt, &y, precond_par, queue ));
+
+        // v = Ay, rrv = <rr,v>
+        CHECK( magma_sbicgmerge_spmv1_cpu( A, rr.val, y.val, v.val, &rrv, queue ));
+        solver_par->spmv_count++;
+        solver_par->reduction_count++;
+        alpha = rho_new / rrv;
+        if( magma_s_isnan_inf( alpha ) ){
+            info = MAGMA_DIVERGENCE;
+            break;
+        }
+
+        // s = r - alpha v
+        CHECK( magma_sbicgstab_2_cpu( dofs, alpha, r.val, v.val, s.val, queue ));
+
+        // z = M^{-1} s
+        CHECK( magma_s_applyprecond_left( MagmaNoTrans, A, s, &ms, precond_par, queue ));
+        CHECK( magma_s_applyprecond_right( MagmaNoTrans, A, ms, &z, precond_par, queue ));
+
+        // t = Az, omega = <t,s>/<t,t>
+        CHECK( magma_s_spmv_cpu( MAGMA_S_ONE, A, z, c_zero, t, queue ));
+        solver_par->spmv_count++;
+        ts = magma_sdot_cpu( dofs, t.val, s.val, queue );
+        tt = magma_sdot_cpu( dofs, t.val, t.val, queue );
+        solver_par->reduction_count += 2;
+        omega = ts / tt;
+        if( magma_s_isnan_inf( omega ) ){
+            info = MAGMA_DIVERGENCE;
+            break;
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t i = 0; i < dofs; i++) {
+            x->val[i] += alpha * y.val[i] + omega * z.val[i];           // x = x + alpha y + omega z
+            r.val[i] = s.val[i] - omega * t.val[i];                     // r = s - omega t
+        }
+        rho_new = magma_sdot_cpu( dofs, rr.val, r.val, queue );        // rho=<rr,r>
+        betanom = magma_snrm2_cpu( dofs, r.val, queue );
+        solver_par->reduction_count += 2;
+
+        if ( solver_par->verbose > 0 ) {
+            tempo2 = magma_wtime();
+            if ( (solver_par->numiter)%solver_par->verbose==0 ) {
+                solver_par->res_vec[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) betanom;
+                solver_par->timing[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) tempo2-tempo1;
+            }
+        }
+
+        if ( betanom  < solver_par->atol ||
+             betanom/nomb < solver_par->rtol ) {
+            break;
+        }
+    }
+    while ( solver_par->numiter+1 <= solver_par->maxiter );
+
+    tempo2 = magma_wtime();
+    solver_par->runtime = (real_Double_t) tempo2-tempo1;
+    CHECK(  magma_sresidualvec( A, b, *x, &r, &residual, queue));
+    solver_par->iter_res = betanom;
+    solver_par->final_res = residual;
+
+    if ( info == MAGMA_DIVERGENCE ) {
+        // keep the error code
+    } else if ( solver_par->numiter < solver_par->maxiter ) {
+        info = MAGMA_SUCCESS;
+    } else if ( solver_par->init_res > solver_par->final_res ) {
+        info = MAGMA_SLOW_CONVERGENCE;
+        if( solver_par->iter_res < solver_par->rtol*nomb ||
+            solver_par->iter_res < solver_par->atol ) {
+            info = MAGMA_SUCCESS;
+        }
+    }
+    else {
+        info = MAGMA_DIVERGENCE;
+    }
+
+cleanup:
+    magma_smfree(&r, queue );
+    magma_smfree(&rr, queue );
+    magma_smfree(&p, queue );
+    magma_smfree(&v, queue );
+    magma_smfree(&s, queue );
+    magma_smfree(&t, queue );
+    magma_smfree(&ms, queue );
+    magma_smfree(&mt, queue );
+    magma_smfree(&y, queue );
+    magma_smfree(&z, queue );
+
+    solver_par->info = info;
+    return info;
+}   /* magma_spbicgstab_cpu */
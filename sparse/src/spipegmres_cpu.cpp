@@ -0,0 +1,412 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from sparse/src/zpipegmres_cpu.cpp, normal z -> s, Sat Oct 17 01:16:03 2026
+*/
+#include "magmasparse_internal.h"
+
+#define PRECISION_s
+
+// simulate 2-D arrays at the cost of some arithmetic
+#define V(i) (V.val+(i)*dofs)
+#define Z(i) (Z.val+(i)*dofs)
+#define H(i,j) (H[(j)*m1+(i)])
+
+#define ATOLERANCE     lapackf77_slamch( "E" )
+
+// once the residual estimate decreased by less than STAGNATION_TOL (relative)
+// in STAGNATION_STEPS consecutive steps, it is compared with the true residual;
+// the cycle is restarted if they differ by more than STAGNATION_DRIFT (relative)
+#define STAGNATION_TOL    1.e-3
+#define STAGNATION_STEPS  3
+#define STAGNATION_DRIFT  1.e-1
+
+
+static void
+GeneratePlaneRotation(float dx, float dy, float *cs, float *sn)
+{
+#if defined(PRECISION_s) | defined(PRECISION_d)
+    if (dy == MAGMA_S_ZERO) {
+        *cs = MAGMA_S_ONE;
+        *sn = MAGMA_S_ZERO;
+    } else if (MAGMA_S_ABS((dy)) > MAGMA_S_ABS((dx))) {
+        float temp = dx / dy;
+        *sn = MAGMA_S_ONE / magma_ssqrt( ( MAGMA_S_ONE + temp*temp));
+        *cs = temp * (*sn);
+    } else {
+        float temp = dy / dx;
+        *cs = MAGMA_S_ONE / magma_ssqrt( ( MAGMA_S_ONE + temp*temp ));
+        *sn = temp * (*cs);
+    }
+#else
+    real_Double_t rho = sqrt(MAGMA_S_REAL(MAGMA_S_CONJ(dx)*dx + MAGMA_S_CONJ(dy)*dy));
+    *cs = dx / rho;
+    *sn = dy / rho;
+#endif
+}
+
+static void ApplyPlaneRotation(float *dx, float *dy, float cs, float sn)
+{
+#if defined(PRECISION_s) | defined(PRECISION_d)
+    float temp = (*dx);
+    *dx =  cs * (*dx) + sn * (*dy);
+    *dy = -sn * temp + cs * (*dy);
+#else
+    float temp  =  MAGMA_S_CONJ(cs) * (*dx) +  MAGMA_S_CONJ(sn) * (*dy);
+    *dy = -(sn) * (*dx) + cs * (*dy);
+    *dx = temp;
+#endif
+}
+
+
+/**
+    Purpose
+    -------
+
+    Solves a system of linear equations
+       A * X = B
+    where A is a real sparse matrix stored in host memory.
+    X and B are real vectors stored in host memory.
+    This is a CPU implementation of the restarted pipelined GMRES method
+    p(1)-GMRES of Ghysels, Ashby, Meerbergen and Vanroose. Next to the
+    orthonormal basis V, the vectors Z(j) = A V(j) are kept. The Arnoldi
+    step for column i orthogonalizes Z(i) against V(0:i) by classical
+    Gram-Schmidt, with the norm obtained from ||Z(i)||^2 - ||h||^2. These
+    inner products only depend on Z(i), so they are computed in the same
+    sweep as the SpMV A Z(i) of the next step, and V(i+1) as well as
+    Z(i+1) = A V(i+1) follow from vector updates. Every step hence needs
+    one SpMV with one global reduction, compared to three reductions with
+    CGS2 (see magma_sgmres_cpu). If cancellation makes the norm estimate
+    inaccurate, the vectors are formed unscaled and the norm is computed
+    explicitly, at the cost of one more reduction.
+    If the residual estimate stagnates, the true residual of the current
+    iterate is computed (one SpMV and one reduction). The cycle is restarted
+    early only if the two differ, i.e., the basis has lost orthogonality.
+    Otherwise the stagnation is genuine and the cycle continues, with the
+    next check after twice as many stagnating steps.
+    The number of global reductions is returned in
+    solver_par->reduction_count.
+
+    Arguments
+    ---------
+
+    @param[in]
+    A           magma_s_matrix
+                descriptor for matrix A
+
+    @param[in]
+    b           magma_s_matrix
+                RHS b vector
+
+    @param[in,out]
+    x           magma_s_matrix*
+                solution approximation
+
+    @param[in,out]
+    solver_par  magma_s_solver_par*
+                solver parameters
+
+    @param[in]
+    queue       magma_queue_t
+                Queue to execute in.
+
+    @ingroup magmasparse_sgesv
+    ********************************************************************/
+
+extern "C" magma_int_t
+magma_spipegmres_cpu(
+    magma_s_matrix A, magma_s_matrix b, magma_s_matrix *x,
+    magma_s_solver_par *solver_par,
+    magma_queue_t queue )
+{
+    magma_int_t info = MAGMA_NOTCONVERGED;
+
+    magma_int_t dofs = A.num_rows;
+
+    // prepare solver feedback
+    solver_par->solver = Magma_PIPEGMRES;
+    solver_par->numiter = 0;
+    solver_par->spmv_count = 0;
+    solver_par->reduction_count = 0;
+
+    //Chronometry
+    real_Double_t tempo1, tempo2;
+
+    magma_int_t dim = solver_par->restart;
+    magma_int_t m1 = dim+1; // used inside H macro
+    magma_int_t i, j, k, nstag, nstag_max;
+    float beta;
+    bool last;
+
+    float rel_resid = 1.0, r0=0.0, betanom = 0.0, betanom_old, nom, eta, nomb, residual;
+    float rtrue;
+
+    magma_s_matrix V={Magma_CSR}, Z={Magma_CSR}, v_t={Magma_CSR}, w_t={Magma_CSR};
+    magma_s_matrix xt={Magma_CSR}, rt={Magma_CSR};
+    float *H={0}, *s={0}, *y={0}, *cs={0}, *sn={0};
+
+    if ( A.memory_location != Magma_CPU || b.num_cols != 1 ) {
+        printf("error: the CPU solver requires one RHS in host memory.\n");
+        info = MAGMA_ERR_NOT_SUPPORTED;
+        goto cleanup;
+    }
+
+    CHECK( magma_smalloc_cpu( &H, (dim+1)*dim ));
+    CHECK( magma_smalloc_cpu( &s,  dim+1 ));
+    CHECK( magma_smalloc_cpu( &y,  dim ));
+    CHECK( magma_smalloc_cpu( &cs, dim ));
+    CHECK( magma_smalloc_cpu( &sn, dim ));
+
+    CHECK( magma_svinit( &V, Magma_CPU, dofs*(dim+1), 1, MAGMA_S_ZERO, queue ));
+    CHECK( magma_svinit( &Z, Magma_CPU, dofs*(dim+1), 1, MAGMA_S_ZERO, queue ));
+    CHECK( magma_svinit( &xt, Magma_CPU, dofs, 1, MAGMA_S_ZERO, queue ));
+    CHECK( magma_svinit( &rt, Magma_CPU, dofs, 1, MAGMA_S_ZERO, queue ));
+
+    nomb = magma_snrm2_cpu( dofs, b.val, queue );
+    solver_par->reduction_count++;
+    if ( nomb == 0.0 ){
+        nomb=1.0;
+    }
+    if ( (r0 = nomb * solver_par->rtol) < ATOLERANCE ){
+        r0 = ATOLERANCE;
+    }
+
+    tempo1 = magma_wtime();
+    do
+    {
+        // V(0) = b - A x
+        CHECK( magma_svset( dofs, 1, V(0), &v_t, queue ));
+        for (magma_int_t l = 0; l < dofs; l++) {
+            V(0)[l] = b.val[l];
+        }
+        CHECK( magma_s_spmv_cpu( MAGMA_S_NEG_ONE, A, *x, MAGMA_S_ONE, v_t, queue ));
+        solver_par->numiter++;
+        solver_par->spmv_count++;
+        beta = MAGMA_S_MAKE( magma_snrm2_cpu( dofs, V(0), queue ), 0.0 );
+        solver_par->reduction_count++;
+        if( magma_s_isnan_inf( beta ) ){
+            info = MAGMA_DIVERGENCE;
+            break;
+        }
+
+        if (solver_par->numiter == 1){
+            solver_par->init_res = MAGMA_S_REAL( beta );
+            if ( solver_par->verbose > 0 ) {
+                solver_par->res_vec[0] = (real_Double_t) MAGMA_S_REAL( beta );
+                solver_par->timing[0] = 0.0;
+            }
+            if ( MAGMA_S_REAL( beta ) < r0 ||
+                 MAGMA_S_REAL( beta ) < solver_par->atol ) {
+                betanom = MAGMA_S_REAL( beta );
+                solver_par->final_res = solver_par->init_res;
+                solver_par->iter_res = solver_par->init_res;
+                info = MAGMA_SUCCESS;
+                goto cleanup;
+            }
+        }
+        else if ( MAGMA_S_REAL( beta ) < r0 ||
+                  MAGMA_S_REAL( beta ) < solver_par->atol ) {
+            // the true residual converged, e.g., after a restart
+            // due to a drifting estimate
+            betanom = MAGMA_S_REAL( beta );
+            rel_resid = betanom / nomb;
+            if ( solver_par->verbose > 0 &&
+                 (solver_par->numiter)%solver_par->verbose==0 ) {
+                solver_par->res_vec[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) betanom;
+                solver_par->timing[(solver_par->numiter)/solver_par->verbose]
+                        = (real_Double_t) magma_wtime()-tempo1;
+            }
+            info = MAGMA_SUCCESS;
+            break;
+        }
+
+        float temp = MAGMA_S_ONE / beta;
+        for (magma_int_t l = 0; l < dofs; l++) {
+            V(0)[l] = temp * V(0)[l];                               // V(0) = V(0)/beta
+        }
+
+        for (i = 1; i < dim+1; i++)
+            s[i] = MAGMA_S_ZERO;
+        s[0] = beta;
+
+        // Z(0) = A V(0)
+        CHECK( magma_svset( dofs, 1, Z(0), &w_t, queue ));
+        CHECK( magma_s_spmv_cpu( MAGMA_S_ONE, A, v_t, MAGMA_S_ZERO, w_t, queue ));
+        solver_par->spmv_count++;
+
+        i = -1;
+        nstag = 0;
+        nstag_max = STAGNATION_STEPS;
+        betanom_old = MAGMA_S_REAL( beta );
+        do {
+            i++;
+            solver_par->numiter++;
+            // the SpMV for the next step is skipped if there is none
+            last = ( i+1 == dim || solver_par->numiter+1 > solver_par->maxiter );
+
+            // Z(i+1) = A Z(i), H(0:i,i) = V(0:i)' Z(i), nom = Z(i)' Z(i)
+            CHECK( magma_spipegmres_spmv_cpu( A, i+1, V.val, dofs, Z(i),
+                        last ? NULL : Z(i+1), &H(0,i), &nom, queue ));
+            solver_par->reduction_count++;
+            if ( ! last ) {
+                solver_par->spmv_count++;
+            }
+
+            // H(i+1,i) = || Z(i) - V(0:i) H(0:i,i) ||
+            eta = nom;
+            for (k = 0; k <= i; k++) {
+                eta -= MAGMA_S_REAL( MAGMA_S_CONJ( H(k,i) ) * H(k,i) );
+            }
+            if ( eta > sqrt( ATOLERANCE ) * nom ) {
+                eta = sqrt( eta );
+                // V(i+1) = ( Z(i) - V(0:i) H(0:i,i) ) / H(i+1,i),
+                // Z(i+1) = ( Z(i+1) - Z(0:i) H(0:i,i) ) / H(i+1,i)
+                CHECK( magma_spipegmres_update_cpu( dofs, i+1, V.val, Z.val, dofs,
+                            &H(0,i), eta, Z(i), last ? NULL : Z(i+1),
+                            V(i+1), Z(i+1), queue ));
+            } else {
+                // cancellation in the norm estimate: form the vectors
+                // unscaled and compute the norm explicitly
+                CHECK( magma_spipegmres_update_cpu( dofs, i+1, V.val, Z.val, dofs,
+                            &H(0,i), 1.0, Z(i), last ? NULL : Z(i+1),
+                            V(i+1), Z(i+1), queue ));
+                eta = magma_snrm2_cpu( dofs, V(i+1), queue );
+                solver_par->reduction_count++;
+                if ( eta <= ATOLERANCE * sqrt( nom ) ) {
+                    // lucky breakdown
+                    eta = 0.0;
+                    last = true;
+                } else if ( ! last ) {
+                    temp = MAGMA_S_MAKE( 1.0 / eta, 0.0 );
+                    for (magma_int_t l = 0; l < dofs; l++) {
+                        V(i+1)[l] = temp * V(i+1)[l];
+                        Z(i+1)[l] = temp * Z(i+1)[l];
+                    }
+                }
+            }
+            H(i+1, i) = MAGMA_S_MAKE( eta, 0. );
+
+            for (k = 0; k < i; k++)
+                ApplyPlaneRotation(&H(k,i), &H(k+1,i), cs[k], sn[k]);
+
+            GeneratePlaneRotation(H(i,i), H(i+1,i), &cs[i], &sn[i]);
+            ApplyPlaneRotation(&H(i,i), &H(i+1,i), cs[i], sn[i]);
+            ApplyPlaneRotation(&s[i], &s[i+1], cs[i], sn[i]);
+
+            betanom = MAGMA_S_ABS( s[i+1] );
+            rel_resid = betanom / nomb;
+            if ( solver_par->verbose > 0 ) {
+                tempo2 = magma_wtime();
+                if ( (solver_par->numiter)%solver_par->verbose==0 ) {
+                    solver_par->res_vec[(solver_par->numiter)/solver_par->verbose]
+                            = (real_Double_t) betanom;
+                    solver_par->timing[(solver_par->numiter)/solver_par->verbose]
+                            = (real_Double_t) tempo2-tempo1;
+                }
+            }
+            if (rel_resid <= solver_par->rtol || betanom <= solver_par->atol ){
+                info = MAGMA_SUCCESS;
+                break;
+            }
+
+            // if the estimate stagnates, restart only if it drifted
+            // from the true residual b - A ( x + V(0:i) y )
+            if ( betanom > (1.0 - STAGNATION_TOL) * betanom_old ) {
+                nstag++;
+            } else {
+                nstag = 0;
+            }
+            betanom_old = betanom;
+            if ( nstag >= nstag_max && ! last ) {
+                for (j = i; j >= 0; j--) {
+                    y[j] = s[j];
+                    for (k = j+1; k <= i; k++)
+                        y[j] -= H(j,k) * y[k];
+                    y[j] /= H(j,j);
+                }
+                #pragma omp parallel for schedule(static)
+                for (magma_int_t l = 0; l < dofs; l++) {
+                    float tmp = x->val[l];
+                    for (magma_int_t jj = 0; jj <= i; jj++) {
+                        tmp += y[jj] * V(jj)[l];
+                    }
+                    xt.val[l] = tmp;
+                    rt.val[l] = b.val[l];
+                }
+                CHECK( magma_s_spmv_cpu( MAGMA_S_NEG_ONE, A, xt, MAGMA_S_ONE, rt, queue ));
+                solver_par->spmv_count++;
+                rtrue = magma_snrm2_cpu( dofs, rt.val, queue );
+                solver_par->reduction_count++;
+                if ( fabs( rtrue - betanom ) > STAGNATION_DRIFT * rtrue ) {
+                    last = true;
+                } else {
+                    nstag = 0;
+                    nstag_max *= 2;
+                }
+            }
+        }
+        while ( ! last );
+
+        // solve upper triangular system in place
+        for (j = i; j >= 0; j--)
+        {
+            s[j] /= H(j,j);
+            for (k = j-1; k >= 0; k--)
+                s[k] -= H(k,j) * s[j];
+        }
+
+        // update the solution x = x + V(0:i) s(0:i)
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t l = 0; l < dofs; l++) {
+            float tmp = x->val[l];
+            for (magma_int_t jj = 0; jj <= i; jj++) {
+                tmp += s[jj] * V(jj)[l];
+            }
+            x->val[l] = tmp;
+        }
+    }
+    while (rel_resid > solver_par->rtol && betanom > solver_par->atol
+                && solver_par->numiter+1 <= solver_par->maxiter);
+
+    tempo2 = magma_wtime();
+    solver_par->runtime = (real_Double_t) tempo2-tempo1;
+    magma_smfree( &V, queue );
+    CHECK( magma_svinit( &V, Magma_CPU, dofs, 1, MAGMA_S_ZERO, queue ));
+    CHECK( magma_sresidualvec( A, b, *x, &V, &residual, queue ));
+    solver_par->iter_res = betanom;
+    solver_par->final_res = residual;
+
+    if ( info == MAGMA_DIVERGENCE ) {
+        // keep the error code
+    } else if ( solver_par->numiter < solver_par->maxiter && info == MAGMA_SUCCESS ) {
+        info = MAGMA_SUCCESS;
+    } else if ( solver_par->init_res > solver_par->final_res ) {
+        info = MAGMA_SLOW_CONVERGENCE;
+        if( solver_par->iter_res < solver_par->rtol*nomb ||
+            solver_par->iter_res < solver_par->atol ) {
+            info = MAGMA_SUCCESS;
+        }
+    }
+    else {
+        info = MAGMA_DIVERGENCE;
+    }
+
+cleanup:
+    magma_free_cpu(H);
+    magma_free_cpu(s);
+    magma_free_cpu(y);
+    magma_free_cpu(cs);
+    magma_free_cpu(sn);
+    magma_smfree( &V, queue);
+    magma_smfree( &Z, queue);
+    magma_smfree( &xt, queue);
+    magma_smfree( &rt, queue);
+
+    solver_par->info = info;
+    return info;
+} /* magma_spipegmres_cpu */
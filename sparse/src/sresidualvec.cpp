@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/src/zresidualvec.cpp, normal z -> s, Sat Mar 27 20:33:08 2021
+       @generated from sparse/src/zresidualvec.cpp, normal z -> s, Fri Oct 16 17:35:53 2026
        @author Hartwig Anzt
 
 */
@@ -64,7 +64,22 @@ magma_sresidualvec(
                                             mone = MAGMA_S_NEG_ONE;
     magma_int_t dofs = A.num_rows;
     
-    if ( A.num_rows == b.num_rows ) {
+    if ( A.memory_location == Magma_CPU ) {
+        // host data: r = b - A x on the CPU
+        if ( (b.num_rows*b.num_cols)%A.num_rows != 0 ) {
+            printf("%%error: dimensions do not match.\n");
+            info = MAGMA_ERR_NOT_SUPPORTED;
+            goto cleanup;
+        }
+        magma_int_t num_vecs = b.num_rows*b.num_cols/A.num_rows;
+        for( magma_int_t i=0; i<dofs*num_vecs; i++) {
+            r->val[i] = b.val[i];
+        }
+        CHECK( magma_s_spmv( mone, A, x, one, *r, queue ));           // r = b - A x
+        for( magma_int_t i=0; i<num_vecs; i++) {
+            res[i] = magma_snrm2_cpu( dofs, r->val+i*dofs, queue );   // res = ||r||
+        }
+    } else if ( A.num_rows == b.num_rows ) {
         CHECK( magma_s_spmv( mone, A, x, zero, *r, queue ));      // r = A x
         magma_saxpy( dofs, one, b.dval, 1, r->dval, 1, queue );          // r = r - b
         *res =  magma_snrm2( dofs, r->dval, 1, queue );            // res = ||r||
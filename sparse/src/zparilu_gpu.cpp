@@ -59,7 +59,8 @@ magma_zparilu_gpu(
 
     magma_z_matrix hAT={Magma_CSR}, hA={Magma_CSR}, hAL={Magma_CSR}, 
     hAU={Magma_CSR}, hAUT={Magma_CSR}, hAtmp={Magma_CSR}, hACOO={Magma_CSR},
-    dAL={Magma_CSR}, dAU={Magma_CSR}, dAUT={Magma_CSR}, dACOO={Magma_CSR};
+    dAL={Magma_CSR}, dAU={Magma_CSR}, dAUT={Magma_CSR}, dACOO={Magma_CSR},
+    hA0={Magma_CSR};
 
     // copy original matrix as COO to device
     if (A.memory_location != Magma_CPU || A.storage_type != Magma_CSR) {
@@ -72,6 +73,7 @@ magma_zparilu_gpu(
 
     // in case using fill-in
     if (precond->levels > 0) {
+        CHECK(magma_zmtransfer(hA, &hA0, Magma_CPU, Magma_CPU, queue));
         CHECK(magma_zsymbilu(&hA, precond->levels, &hAL, &hAUT,  queue));
         magma_zmfree(&hAL, queue);
         magma_zmfree(&hAUT, queue);
@@ -109,6 +111,10 @@ magma_zparilu_gpu(
 
     CHECK(magma_zmtransfer(dAL, &precond->L, Magma_DEV, Magma_DEV, queue));
     CHECK(magma_zmtransfer(dAUT, &precond->U, Magma_DEV, Magma_DEV, queue));
+
+    // keep the symbolic structure and the sweep matrices for the refactorization
+    CHECK(magma_zparilu_keepsymbolic((precond->levels > 0) ? hA0 : hA, hA, 
+        hAL, hAU, &dACOO, &dAL, &dAU, precond, queue));
     
     if (precond->trisolver == 0 || precond->trisolver == Magma_CUSOLVE) {
         CHECK(magma_zcumilugeneratesolverinfo(precond, queue));
@@ -138,6 +144,7 @@ cleanup:
     magma_zmfree(&hAUT, queue);
     magma_zmfree(&hAtmp, queue);
     magma_zmfree(&hACOO, queue);
+    magma_zmfree(&hA0, queue);
 
     
     return info;
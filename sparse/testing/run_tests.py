@@ -156,6 +156,7 @@ parser.add_option('-n', '--nonsym',      action='store_true', dest='nonsym',
 parser.add_option(      '--sparse-blas', action='store_true', dest='sparse_blas', help='run sparse BLAS tests')
 parser.add_option(      '--solver',      action='store_true', dest='solver',      help='run sparse solvers')
 parser.add_option(      '--control',     action='store_true', dest='control',     help='run sparse IO, copy, etc.')
+parser.add_option(      '--host',        action='store_true', dest='host',        help='run host solvers (--location CPU)')
 
 parser.add_option(      '--csr',         action='store_true', dest='csr',         help='run CSR matrix format')
 parser.add_option(      '--ell',         action='store_true', dest='ell',         help='run ELL matrix format')
@@ -213,12 +214,14 @@ if ( not opts.small and not opts.med and not opts.large and not opts.nonsym ):
 if (     not opts.sparse_blas
      and not opts.solver
      and not opts.control
+     and not opts.host
      and not opts.csr
      and not opts.ell
      and not opts.sellp ):
     opts.sparse_blas = True
     opts.solver      = True
     opts.control     = True
+    opts.host        = True
     opts.csr         = True
     opts.ell         = True
     opts.sellp       = True
@@ -416,6 +419,22 @@ if ( opts.lsqr ):
 
 
 
+# looping over host solvers, which solve on Magma_CPU data
+hostsolvers = []
+if ( opts.host ):
+    hostsolvers += ['--location CPU --solver CG ']
+    hostsolvers += ['--location CPU --solver BICGSTAB ']
+    hostsolvers += ['--location CPU --solver GMRES ']
+    hostsolvers += ['--location CPU --solver CACG ']
+    hostsolvers += ['--location CPU --solver PIPEGMRES ']
+    hostsolvers += ['--location CPU --solver PCG --precond PARIC ']
+    hostsolvers += ['--location CPU --solver PCG --precond PARILU ']
+    hostsolvers += ['--location CPU --solver PBICGSTAB --precond PARILU ']
+    hostsolvers += ['--location CPU --solver PGMRES --precond PARILU ']
+# end
+
+
+
 # looping over eigensolvers
 IR = []
 if ( opts.iterref ):
@@ -624,6 +643,24 @@ for solver in precsolvers:
                 tests.append( [cmd, solver + ' ' + precond, size, ''] )
 
 
+# ----------------------------------------------------------------------
+for solver in hostsolvers:
+    for size in sizes:
+        for precision in opts.precisions:
+            # precision generation
+            cmd = substitute( 'testing_zsolver', 'z', precision )
+            tests.append( [cmd, solver, size, ''] )
+
+# the residual of GMRES on a cyclic shift decreases slowly until the Krylov
+# space is complete, the pipelined GMRES must not restart on this stagnation
+if ( opts.host and opts.nonsym ):
+    for precision in opts.precisions:
+        # precision generation
+        cmd = substitute( 'testing_zsolver', 'z', precision )
+        tests.append( [cmd, '--location CPU --solver PIPEGMRES --restart 1000 --maxiter 2000',
+                       'test_matrices/shift_1000.mtx', ''] )
+
+
 # ----------------------------------------------------------------------
 for solver in IR:
     for precond in IRprecs:
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/testing/testing_zpreconditioner.cpp, normal z -> c, Sat Mar 27 20:33:14 2021
+       @generated from sparse/testing/testing_zpreconditioner.cpp, normal z -> c, Fri Oct 16 18:12:08 2026
        @author Hartwig Anzt
 */
 
@@ -120,7 +120,19 @@ int main(  int argc, char** argv )
                 
         TESTING_CHECK( magma_cresidual( dB, b, x, &residual, queue ));
         zopts.solver_par.final_res = residual;
-        
+
+        // numeric refactorization for the same values has to give the same result
+        real_Double_t setuptime = zopts.precond_par.setuptime;
+        TESTING_CHECK( magma_c_precond_refactor( dB, b, &zopts.solver_par, &zopts.precond_par, queue ) );
+        info = magma_c_applyprecond_left( MagmaNoTrans, dB, b, &t, &zopts.precond_par, queue );
+        info = magma_c_applyprecond_right( MagmaNoTrans, dB, t, &x2, &zopts.precond_par, queue );
+        TESTING_CHECK( magma_cresidual( dB, b, x2, &residual, queue ));
+        printf("%% refactorization: setup %.4e sec, residual %.8e (%s)\n",
+                zopts.precond_par.setuptime, residual,
+                ( fabs( residual - zopts.solver_par.final_res )
+                    <= 1e-3 * zopts.solver_par.final_res ) ? "ok" : "failed" );
+        zopts.precond_par.setuptime = setuptime;
+
         magma_csolverinfo( &zopts.solver_par, &zopts.precond_par, queue );
 
         magma_cmfree(&dB, queue );
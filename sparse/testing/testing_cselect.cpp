@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/testing/testing_zselect.cpp, normal z -> c, Sat Mar 27 20:33:15 2021
+       @generated from sparse/testing/testing_zselect.cpp, normal z -> c, Sat Oct 17 01:14:31 2026
        @author Hartwig Anzt
 */
 
@@ -44,6 +44,8 @@ int main(  int argc, char** argv )
     magma_queue_create( 0, &queue );
     // using std::swap;
     real_Double_t start, end, t_select, t_selectrandom, t_selectbitonic;
+    real_Double_t t_sampleselect, t_sampleselect_approx;
+    float sampleResult, sampleApproxResult;
     
     int size = atoi(argv[1]);
     int selectset = atoi(argv[2]);
@@ -113,10 +115,48 @@ int main(  int argc, char** argv )
         printf(" Inconsistent result.\n");
     }
     
+    // reference: the full sort has to be ordered by magnitude and agree with
+    // the selected value
+    makeRandomArray(a, size);
+    TESTING_CHECK( magma_csort(a, 0, size-1, queue) );
+    for (int i=1; i<size; i++) {
+        if ( MAGMA_C_ABS(a[i-1]) > MAGMA_C_ABS(a[i]) ) {
+            printf(" Unordered sort result at %d.\n", i);
+            info = -1;
+            break;
+        }
+    }
+    float sortResult = MAGMA_C_ABS(a[selectset]);
+    printf("\n selected by sort: %.2f\n\n", sortResult );
+    if (!(sortResult == MAGMA_C_ABS(selectResult)) ){
+        printf(" Inconsistent result.\n");
+        info = -1;
+    }
+    
+    // sample-select works in place and does not modify the array
+    makeRandomArray(a, size);
+    start = magma_sync_wtime( queue );
+    TESTING_CHECK( magma_csampleselect_cpu(a, size, selectset, 0.0, &sampleResult, queue) );
+    end = magma_sync_wtime( queue );
+    t_sampleselect = end-start;
+    printf("\n selected by sample-select: %.2f\n\n", sampleResult );
+    if (!(sampleResult == MAGMA_C_ABS(selectRandomResult)) ){
+        printf(" Inconsistent result.\n");
+    }
+    
+    start = magma_sync_wtime( queue );
+    TESTING_CHECK( magma_csampleselect_cpu(a, size, selectset, 1e-2, &sampleApproxResult, queue) );
+    end = magma_sync_wtime( queue );
+    t_sampleselect_approx = end-start;
+    printf("\n selected by approximate sample-select (1%% rank accuracy): %.2f\n\n",
+           sampleApproxResult );
+    
     
     printf(" Select time (ms): %.4f\n", float(t_select)*1000 );
     printf(" Randomized select time (ms): %.4f\n", float(t_selectrandom)*1000 );
     printf(" Bitonicsort time (ms): %.4f\n", float(t_selectbitonic)*1000 );
+    printf(" Sample-select time (ms): %.4f\n", float(t_sampleselect)*1000 );
+    printf(" Approximate sample-select time (ms): %.4f\n", float(t_sampleselect_approx)*1000 );
 
     // magma_free_cpu( &a );
     
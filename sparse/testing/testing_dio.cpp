@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/testing/testing_zio.cpp, normal z -> d, Sat Mar 27 20:33:09 2021
+       @generated from sparse/testing/testing_zio.cpp, normal z -> d, Fri Oct 16 17:49:27 2026
        @author Hartwig Anzt
 */
 
@@ -41,7 +41,7 @@ int main(  int argc, char** argv )
     
     real_Double_t res;
     magma_d_matrix A={Magma_CSR}, A2={Magma_CSR}, 
-    A3={Magma_CSR}, A4={Magma_CSR}, A5={Magma_CSR};
+    A3={Magma_CSR}, A4={Magma_CSR}, A5={Magma_CSR}, A6={Magma_CSR};
     
     int i=1;
     TESTING_CHECK( magma_dparse_opts( argc, argv, &zopts, &i, queue ));
@@ -68,6 +68,19 @@ int main(  int argc, char** argv )
 
         // delete temporary matrix
         unlink( filename );
+
+        // same for the binary container, loaded zero-copy
+        const char *binname = "testmatrix.bin";
+        TESTING_CHECK( magma_dwrite_csr_bin( A, binname, queue ));
+        TESTING_CHECK( magma_d_csr_bin( &A6, binname, queue ));
+        unlink( binname );
+        TESTING_CHECK( magma_dmdiff( A, A6, &res, queue ));
+        printf("%% ||A-B||_F = %8.2e\n", res);
+        if ( res < .000001 )
+            printf("%% tester binary IO:  ok\n");
+        else
+            printf("%% tester binary IO:  failed\n");
+        TESTING_CHECK( magma_dmfree_bin( &A6, queue ));
                 
         //visualize
         printf("A2:\n");
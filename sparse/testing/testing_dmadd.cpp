@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/testing/testing_zmadd.cpp, normal z -> d, Sat Mar 27 20:33:13 2021
+       @generated from sparse/testing/testing_zmadd.cpp, normal z -> d, Fri Oct 16 18:47:11 2026
        @author Hartwig Anzt
 */
 
@@ -35,7 +35,7 @@ int main(  int argc, char** argv )
 
     real_Double_t res;
     magma_d_matrix A={Magma_CSR}, B={Magma_CSR}, B2={Magma_CSR}, 
-    dA={Magma_CSR}, dB={Magma_CSR}, dC={Magma_CSR};
+    dA={Magma_CSR}, dB={Magma_CSR}, dC={Magma_CSR}, C={Magma_CSR}, C2={Magma_CSR};
 
     double one = MAGMA_D_MAKE(1.0, 0.0);
     double mone = MAGMA_D_MAKE(-1.0, 0.0);
@@ -87,6 +87,29 @@ int main(  int argc, char** argv )
     else
         printf("%% tester matrix add:  failed\n");
 
+    // sparse matrix product on the host, the numeric phase is run twice
+    // reusing the pattern, and on the device
+    if ( A.num_cols == B.num_rows ) {
+        TESTING_CHECK( magma_dspgemm_symbolic_cpu( A, B, &C, queue ));
+        TESTING_CHECK( magma_dspgemm_numeric_cpu( mone, A, B, &C, queue ));
+        TESTING_CHECK( magma_dspgemm_numeric_cpu( one, A, B, &C, queue ));
+        TESTING_CHECK( magma_dmtransfer( A, &dA, Magma_CPU, Magma_DEV, queue ));
+        TESTING_CHECK( magma_dmtransfer( B, &dB, Magma_CPU, Magma_DEV, queue ));
+        TESTING_CHECK( magma_d_spmm( one, dA, dB, &dC, queue ));
+        TESTING_CHECK( magma_dmtransfer( dC, &C2, Magma_DEV, Magma_CPU, queue ));
+        TESTING_CHECK( magma_dmdiff( C, C2, &res, queue ));
+        printf("%% ||AB_host-AB_dev||_F = %8.2e\n", res);
+        if ( res < .000001 && C.nnz == C2.nnz )
+            printf("%% tester matrix product:  ok\n");
+        else
+            printf("%% tester matrix product:  failed\n");
+        magma_dmfree(&dA, queue );
+        magma_dmfree(&dB, queue );
+        magma_dmfree(&dC, queue );
+        magma_dmfree(&C, queue );
+        magma_dmfree(&C2, queue );
+    }
+
     magma_dmfree(&A, queue );
     magma_dmfree(&B, queue );
     magma_dmfree(&B2, queue );
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/testing/testing_zmatrixcapcup.cpp, normal z -> d, Sat Mar 27 20:33:15 2021
+       @generated from sparse/testing/testing_zmatrixcapcup.cpp, normal z -> d, Fri Oct 16 18:44:46 2026
        @author Hartwig Anzt
 */
 
@@ -41,6 +41,8 @@ int main(  int argc, char** argv )
     magma_d_matrix Z3={Magma_CSR};
     magma_d_matrix Z4={Magma_CSR};
     magma_d_matrix Z5={Magma_CSR};
+    magma_d_parilut_workspace ws={0};
+    real_Double_t res;
     
     int i=1;
     TESTING_CHECK( magma_dparse_opts( argc, argv, &zopts, &i, queue ));
@@ -72,6 +74,16 @@ int main(  int argc, char** argv )
         TESTING_CHECK( magma_dmatrix_cup( Z1, Z2, &Z3, queue ));
         magma_dprint_matrix( Z3, queue );
         
+        // the same into reused workspace storage, twice
+        TESTING_CHECK( magma_dmatrix_cup_ws( Z1, Z2, &ws.L_new, queue ));
+        TESTING_CHECK( magma_dmatrix_cup_ws( Z1, Z2, &ws.L_new, queue ));
+        TESTING_CHECK( magma_dmdiff( Z3, ws.L_new, &res, queue ));
+        if ( res == 0.0 && ws.L_new.nnz == Z3.nnz )
+            printf("%% tester reused cup:  ok\n");
+        else
+            printf("%% tester reused cup:  failed\n");
+        magma_dparilut_workspace_free( &ws, queue );
+        
         // now the negcap:
         printf("C = B cap B^T :\n");
         TESTING_CHECK( magma_dmatrix_cap( Z1, Z2, &Z4, queue ));
@@ -82,7 +94,13 @@ int main(  int argc, char** argv )
         printf("C = B negcap B^T :\n");
         TESTING_CHECK( magma_dmatrix_negcap( Z1, Z2, &Z5, queue ));
         magma_dprint_matrix( Z5, queue );
-        
+
+        // the element counts have to be consistent
+        if ( Z1.nnz + Z2.nnz == Z3.nnz + Z4.nnz && Z5.nnz == Z1.nnz - Z4.nnz )
+            printf("%% tester cup/cap/negcap counts:  ok\n");
+        else
+            printf("%% tester cup/cap/negcap counts:  failed\n");
+
         magma_dmfree(&Z, queue );
         magma_dmfree(&Z1, queue );
         magma_dmfree(&Z2, queue );
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/testing/testing_zcspmv_mixed.cpp, mixed zc -> ds, Sat Mar 27 20:33:13 2021
+       @generated from sparse/testing/testing_zcspmv_mixed.cpp, mixed zc -> ds, Fri Oct 16 19:10:55 2026
        @author Hartwig Anzt
 */
 
@@ -18,6 +18,7 @@
 // includes, project
 #include "magma_v2.h"
 #include "magmasparse.h"
+#include "magma_operators.h"
 #include "magma_lapack.h"
 #include "testings.h"
 
@@ -39,6 +40,8 @@ int main(  int argc, char** argv )
     magma_s_matrix cA={Magma_CSR}, dcB={Magma_CSR};
     magma_d_matrix diag={Magma_CSR}, ddiag={Magma_CSR};
     magma_d_matrix x={Magma_CSR}, b={Magma_CSR};
+    magma_d_matrix mpA={Magma_CSR}, ref={Magma_CSR};
+    magma_precision mpformat[2] = { Magma_FLOAT, Magma_HALF };
     real_Double_t start, end;
 
     int i=1;
@@ -128,6 +131,34 @@ int main(  int argc, char** argv )
                                         (end-start)/10, FLOPS*10/(end-start) );
         
         magma_smfree(&dcB, queue );
+        magma_dmfree(&x, queue );
+        magma_dmfree(&b, queue );
+
+        
+        // host SpMV with the values stored in single and half precision
+        printf("\n\nhost mixed precision storage:\n");
+        TESTING_CHECK( magma_dvinit( &x, Magma_CPU, A.num_cols, 1, one, queue ));
+        TESTING_CHECK( magma_dvinit( &b, Magma_CPU, A.num_rows, 1, zero, queue ));
+        TESTING_CHECK( magma_dvinit( &ref, Magma_CPU, A.num_rows, 1, zero, queue ));
+        TESTING_CHECK( magma_d_spmv_cpu( one, A, x, zero, ref, queue ));
+        for (int f=0; f<2; f++) {
+            TESTING_CHECK( magma_dmcsrmp( A, mpformat[f], &mpA, queue ));
+            start = magma_wtime();
+            for (int z=0; z<10; z++) {
+                TESTING_CHECK( magma_d_spmv_cpu( one, mpA, x, zero, b, queue ));
+            }
+            end = magma_wtime();
+            double err = 0.0, nrm = 0.0;
+            for (magma_int_t k=0; k<A.num_rows; k++) {
+                err += MAGMA_D_ABS( b.val[k] - ref.val[k] ) * MAGMA_D_ABS( b.val[k] - ref.val[k] );
+                nrm += MAGMA_D_ABS( ref.val[k] ) * MAGMA_D_ABS( ref.val[k] );
+            }
+            printf( " > host SpMV, values in %s : %.2e seconds %.2e GFLOP/s, relative error %.2e\n",
+                    (f == 0 ? "FP32" : "FP16"), (end-start)/10, FLOPS*10/(end-start),
+                    sqrt( err / nrm ) );
+            magma_dmfree(&mpA, queue );
+        }
+        magma_dmfree(&ref, queue );
 
         magma_smfree(&cA, queue );
         
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/testing/testing_zmadd.cpp, normal z -> s, Sat Mar 27 20:33:13 2021
+       @generated from sparse/testing/testing_zmadd.cpp, normal z -> s, Fri Oct 16 18:47:11 2026
        @author Hartwig Anzt
 */
 
@@ -35,7 +35,7 @@ int main(  int argc, char** argv )
 
     real_Double_t res;
     magma_s_matrix A={Magma_CSR}, B={Magma_CSR}, B2={Magma_CSR}, 
-    dA={Magma_CSR}, dB={Magma_CSR}, dC={Magma_CSR};
+    dA={Magma_CSR}, dB={Magma_CSR}, dC={Magma_CSR}, C={Magma_CSR}, C2={Magma_CSR};
 
     float one = MAGMA_S_MAKE(1.0, 0.0);
     float mone = MAGMA_S_MAKE(-1.0, 0.0);
@@ -87,6 +87,29 @@ int main(  int argc, char** argv )
     else
         printf("%% tester matrix add:  failed\n");
 
+    // sparse matrix product on the host, the numeric phase is run twice
+    // reusing the pattern, and on the device
+    if ( A.num_cols == B.num_rows ) {
+        TESTING_CHECK( magma_sspgemm_symbolic_cpu( A, B, &C, queue ));
+        TESTING_CHECK( magma_sspgemm_numeric_cpu( mone, A, B, &C, queue ));
+        TESTING_CHECK( magma_sspgemm_numeric_cpu( one, A, B, &C, queue ));
+        TESTING_CHECK( magma_smtransfer( A, &dA, Magma_CPU, Magma_DEV, queue ));
+        TESTING_CHECK( magma_smtransfer( B, &dB, Magma_CPU, Magma_DEV, queue ));
+        TESTING_CHECK( magma_s_spmm( one, dA, dB, &dC, queue ));
+        TESTING_CHECK( magma_smtransfer( dC, &C2, Magma_DEV, Magma_CPU, queue ));
+        TESTING_CHECK( magma_smdiff( C, C2, &res, queue ));
+        printf("%% ||AB_host-AB_dev||_F = %8.2e\n", res);
+        if ( res < .000001 && C.nnz == C2.nnz )
+            printf("%% tester matrix product:  ok\n");
+        else
+            printf("%% tester matrix product:  failed\n");
+        magma_smfree(&dA, queue );
+        magma_smfree(&dB, queue );
+        magma_smfree(&dC, queue );
+        magma_smfree(&C, queue );
+        magma_smfree(&C2, queue );
+    }
+
     magma_smfree(&A, queue );
     magma_smfree(&B, queue );
     magma_smfree(&B2, queue );
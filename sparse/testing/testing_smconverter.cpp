@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/testing/testing_zmconverter.cpp, normal z -> s, Sat Mar 27 20:33:10 2021
+       @generated from sparse/testing/testing_zmconverter.cpp, normal z -> s, Sat Oct 17 01:18:15 2026
        @author Hartwig Anzt
 */
 
@@ -36,7 +36,7 @@ int main(  int argc, char** argv )
 
     real_Double_t res;
     magma_s_matrix Z={Magma_CSR}, Z2={Magma_CSR}, A={Magma_CSR}, A2={Magma_CSR}, 
-    AT={Magma_CSR}, AT2={Magma_CSR}, B={Magma_CSR};
+    AT={Magma_CSR}, AT2={Magma_CSR}, AT3={Magma_CSR}, B={Magma_CSR};
     int i=1;
     TESTING_CHECK( magma_sparse_opts( argc, argv, &zopts, &i, queue ));
 
@@ -108,6 +108,24 @@ int main(  int argc, char** argv )
         magma_smfree(&AT, queue );
         TESTING_CHECK( magma_smconvert( AT2, &AT, Magma_CSRD, Magma_CSR, queue ));
         magma_smfree(&AT2, queue );
+        //BCSR, the blocks are stored with their zeros
+        AT2.blocksize = 4;
+        TESTING_CHECK( magma_smconvert( AT, &AT2, Magma_CSR, Magma_BCSR, queue ));
+        TESTING_CHECK( magma_smconvert( AT2, &AT3, Magma_BCSR, Magma_CSR, queue ));
+        magma_smfree(&AT2, queue );
+        TESTING_CHECK( magma_smdiff( AT, AT3, &res, queue));
+        magma_int_t nnz3 = 0;
+        for( magma_int_t k=0; k < AT3.nnz; k++ ) {
+            if ( MAGMA_S_REAL( AT3.val[k] ) != 0 || MAGMA_S_IMAG( AT3.val[k] ) != 0 )
+                nnz3++;
+        }
+        printf("%% ||AT-AT3||_F = %8.2e, nonzeros %lld / %lld\n",
+                res, (long long) nnz3, (long long) AT.nnz );
+        if ( res < .000001 && nnz3 == AT.nnz )
+            printf("%% BCSR conversion tester:  ok\n");
+        else
+            printf("%% BCSR conversion tester:  failed\n");
+        magma_smfree(&AT3, queue );
         
         // transpose
         TESTING_CHECK( magma_smtranspose( AT, &A2, queue ));
@@ -131,6 +149,7 @@ int main(  int argc, char** argv )
         magma_smfree(&A2, queue );
         magma_smfree(&AT, queue );
         magma_smfree(&AT2, queue );
+        magma_smfree(&AT3, queue );
         magma_smfree(&B, queue );
         magma_smfree(&Z2, queue );
         magma_smfree(&Z, queue );
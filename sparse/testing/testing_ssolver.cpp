@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/testing/testing_zsolver.cpp, normal z -> s, Sat Mar 27 20:33:13 2021
+       @generated from sparse/testing/testing_zsolver.cpp, normal z -> s, Fri Oct 16 22:49:24 2026
        @author Hartwig Anzt
 */
 
@@ -37,11 +37,14 @@ int main(  int argc, char** argv )
     // float zero = MAGMA_S_MAKE(0.0, 0.0);
     magma_s_matrix A={Magma_CSR}, B={Magma_CSR}, dB={Magma_CSR};
     magma_s_matrix x={Magma_CSR}, b={Magma_CSR};
+    magma_s_matrix Ar={Magma_CSR}, xr={Magma_CSR};
+    magma_index_t *perm = NULL;
     
     int i=1;
     TESTING_CHECK( magma_sparse_opts( argc, argv, &zopts, &i, queue ));
     B.blocksize = zopts.blocksize;
     B.alignment = zopts.alignment;
+    B.sellp_sigma = zopts.sigma;
 
     TESTING_CHECK( magma_ssolverinfo_init( &zopts.solver_par, &zopts.precond_par, queue ));
 
@@ -60,13 +63,43 @@ int main(  int argc, char** argv )
 
         // scale matrix
         TESTING_CHECK( magma_smscale( &A, zopts.scaling, queue ));
+
+        // reorder matrix, the solution is mapped back after the solve
+        if ( zopts.reordering != Magma_NOREORDER ) {
+            TESTING_CHECK( magma_sdiameter( &A, queue ));
+            magma_int_t diameter = A.diameter;
+            TESTING_CHECK( magma_smreorder( A, zopts.reordering, &perm, &Ar, queue ));
+            printf( "%% reordering: diameter %lld -> %lld\n",
+                    (long long) diameter, (long long) Ar.diameter );
+            magma_smfree( &A, queue );
+            TESTING_CHECK( magma_smtransfer( Ar, &A, Magma_CPU, Magma_CPU, queue ));
+            magma_smfree( &Ar, queue );
+        }
         
+        // solve on the device unless a host solve was requested
+        magma_location_t location = ( zopts.compute_location == Magma_CPU ) ?
+                                    Magma_CPU : Magma_DEV;
+
+        // right-hand side; it is allocated before the preconditioner setup,
+        // which keeps the factors in host memory for a host solve
+        TESTING_CHECK( magma_svinit_rand( &b, location, A.num_rows, zopts.nrhs, queue ));
+
         // preconditioner
         if ( zopts.solver_par.solver != Magma_ITERREF ) {
             TESTING_CHECK( magma_s_precondsetup( A, b, &zopts.solver_par, &zopts.precond_par, queue ) );
         }
 
-        TESTING_CHECK( magma_smconvert( A, &B, Magma_CSR, zopts.output_format, queue ));
+        if ( zopts.output_format == Magma_AUTO ) {
+            TESTING_CHECK( magma_smtune( A, location, zopts.tune, &B, queue ));
+            printf( "%% format: %s, blocksize %lld, alignment %lld, sigma %lld\n",
+                    B.storage_type == Magma_SELLP ? "SELLP" :
+                    B.storage_type == Magma_ELL   ? "ELL"   :
+                    B.storage_type == Magma_CSR5  ? "CSR5"  : "CSR",
+                    (long long) B.blocksize, (long long) B.alignment,
+                    (long long) B.sellp_sigma );
+        } else {
+            TESTING_CHECK( magma_smconvert( A, &B, Magma_CSR, zopts.output_format, queue ));
+        }
         
         printf( "\n%% matrix info: %lld-by-%lld with %lld nonzeros\n\n",
                             (long long) A.num_rows, (long long) A.num_cols, (long long) A.nnz );
@@ -80,20 +113,27 @@ int main(  int argc, char** argv )
         printf("%%============================================================================%%\n");
         printf("];\n");
 
-        TESTING_CHECK( magma_smtransfer( B, &dB, Magma_CPU, Magma_DEV, queue ));
+        TESTING_CHECK( magma_smtransfer( B, &dB, Magma_CPU, location, queue ));
 
-        // vectors and initial guess
-        TESTING_CHECK( magma_svinit_rand( &b, Magma_DEV, A.num_rows, 1, queue ));
+        // initial guess
         //magma_svinit( &x, Magma_DEV, A.num_cols, 1, one, queue );
         //magma_s_spmv( one, dB, x, zero, b, queue );                 //  b = A x
         //magma_smfree(&x, queue );
-        TESTING_CHECK( magma_svinit_rand( &x, Magma_DEV, A.num_cols, 1, queue ));
+        TESTING_CHECK( magma_svinit_rand( &x, location, A.num_cols, zopts.nrhs, queue ));
         
         info = magma_s_solver( dB, b, &x, &zopts, queue );
         if( info != 0 ) {
             printf("%%error: solver returned: %s (%lld).\n",
                     magma_strerror( info ), (long long) info );
         }
+        if ( perm != NULL ) {
+            TESTING_CHECK( magma_svpermute( MagmaTrans, perm, x, &xr, queue ));
+            magma_smfree( &x, queue );
+            TESTING_CHECK( magma_smtransfer( xr, &x, location, location, queue ));
+            magma_smfree( &xr, queue );
+            magma_free_cpu( perm );
+            perm = NULL;
+        }
         printf("convergence = [\n");
         magma_ssolverinfo( &zopts.solver_par, &zopts.precond_par, queue );
         printf("];\n\n");
@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date
 
-       @generated from sparse/testing/testing_zspmv.cpp, normal z -> s, Sat Mar 27 20:33:12 2021
+       @generated from sparse/testing/testing_zspmv.cpp, normal z -> s, Sat Oct 17 00:51:15 2026
        @author Hartwig Anzt
 */
 
@@ -75,9 +75,11 @@ int main(  int argc, char** argv )
     magma_print_environment();
     magma_queue_t queue=NULL;
     magma_queue_create( 0, &queue );
-    magma_s_matrix hA={Magma_CSR}, hA_SELLP={Magma_CSR}, hA_ELL={Magma_CSR}, 
-    dA={Magma_CSR}, dA_SELLP={Magma_CSR}, dA_ELL={Magma_CSR},
+    magma_s_matrix hA={Magma_CSR}, hA_SELLP={Magma_CSR}, dA={Magma_CSR};
+    #if ! defined(HAVE_HOST)
+    magma_s_matrix hA_ELL={Magma_CSR}, dA_SELLP={Magma_CSR}, dA_ELL={Magma_CSR},
     hA_CSR5={Magma_CSR}, dA_CSR5={Magma_CSR};
+    #endif
     
     magma_s_matrix hx={Magma_CSR}, hy={Magma_CSR}, dx={Magma_CSR}, 
     dy={Magma_CSR}, hrefvec={Magma_CSR}, hcheck={Magma_CSR};
@@ -103,9 +105,11 @@ int main(  int argc, char** argv )
         accuracy = 1e-4;
     #endif
     
+    #if ! defined(HAVE_HOST)
     cusparseMatDescr_t descrA=NULL;
     cusparseHandle_t cusparseHandle = NULL;
     cusparseMatDescr_t descr = NULL;
+    #endif
     
     #ifdef MAGMA_WITH_MKL
         magma_int_t *pntre=NULL;
@@ -125,10 +129,17 @@ int main(  int argc, char** argv )
             (long long) hA_SELLP.blocksize, (long long) hA_SELLP.alignment );
 
     while( i < argc ) {
+        magma_int_t laplace_size = 0, stencil_points = 0;
         if ( strcmp("LAPLACE2D", argv[i]) == 0 && i+1 < argc ) {   // Laplace test
             i++;
-            magma_int_t laplace_size = atoi( argv[i] );
+            laplace_size = atoi( argv[i] );
+            stencil_points = 5;
             TESTING_CHECK( magma_sm_5stencil(  laplace_size, &hA, queue ));
+        } else if ( strcmp("LAPLACE3D", argv[i]) == 0 && i+1 < argc ) {   // Laplace test
+            i++;
+            laplace_size = atoi( argv[i] );
+            stencil_points = 27;
+            TESTING_CHECK( magma_sm_27stencil(  laplace_size, &hA, queue ));
         } else {                        // file-matrix test
             TESTING_CHECK( magma_s_csr_mtx( &hA,  argv[i], queue ));
         }
@@ -189,6 +200,20 @@ int main(  int argc, char** argv )
         #endif // MAGMA_WITH_MKL
 
 
+        #if defined(HAVE_HOST)
+        // the host backend has no device SpMV;
+        // the reference is the serial CSR product with x = 1
+        TESTING_CHECK( magma_svinit( &hrefvec, Magma_CPU, hA.num_rows, 1, c_zero, queue ));
+        for(magma_int_t k=0; k < hA.num_rows; k++ ){
+            for(magma_int_t l=hA.row[k]; l < hA.row[k+1]; l++ ){
+                hrefvec.val[k] = hrefvec.val[k] + hA.val[l];
+            }
+        }
+        ref = 0.0;
+        for(magma_int_t k=0; k < hA.num_rows; k++ ){
+            ref = ref + MAGMA_S_ABS(hrefvec.val[k]);
+        }
+        #else
         // copy matrix to GPU
         TESTING_CHECK( magma_smtransfer( hA, &dA, Magma_CPU, Magma_DEV, queue ));
         
@@ -321,8 +346,63 @@ int main(  int argc, char** argv )
         magma_smfree( &hcheck, queue );
 
         magma_smfree(&dA_CSR5, queue );
+        #endif
+
+        // SpMV on CPU (CSR, ELL, SELLP, SELL-C-sigma, CSR5, tuned format,
+        // matrix-free stencil for the Laplace tests, variable block CSR)
+        magma_smfree( &hx, queue );
+        TESTING_CHECK( magma_svinit( &hx, Magma_CPU, hA.num_rows, 1, c_one, queue ));
+        magma_storage_t host_formats[8] = { Magma_CSR, Magma_ELL, Magma_SELLP,
+                                            Magma_SELLP, Magma_CSR5, Magma_AUTO,
+                                            Magma_STENCIL, Magma_VBCSR };
+        const char *host_names[8] = { "CSR", "ELL", "SELL-P", "SELL-C-sigma", "CSR5", "AUTO",
+                                      "STENCIL", "VBCSR" };
+        for (magma_int_t f=0; f < 8; f++) {
+            magma_s_matrix hA_host={Magma_CSR};
+            if ( host_formats[f] == Magma_STENCIL &&
+                 ( stencil_points == 0 || ( stencil_points == 27 && laplace_size < 3 ))) {
+                continue;
+            }
+            if ( host_formats[f] == Magma_VBCSR && hA.num_rows != hA.num_cols ) {
+                continue;
+            }
+            hA_host.blocksize = hA_SELLP.blocksize;
+            hA_host.alignment = hA_SELLP.alignment;
+            hA_host.sellp_sigma = ( f == 3 ) ? 256 : 1;
+            if ( host_formats[f] == Magma_VBCSR ) {
+                hA_host.blocksize = 8;
+            }
+            if ( host_formats[f] == Magma_AUTO ) {
+                TESTING_CHECK( magma_smtune( hA, Magma_CPU, Magma_TUNE_ANALYZE, &hA_host, queue ));
+            } else if ( host_formats[f] == Magma_STENCIL ) {
+                TESTING_CHECK( magma_sm_stencil( stencil_points, laplace_size, &hA_host, queue ));
+            } else {
+                TESTING_CHECK( magma_smconvert(  hA, &hA_host, Magma_CSR, host_formats[f], queue ));
+            }
+            TESTING_CHECK( magma_svinit( &hcheck, Magma_CPU, hA.num_rows, 1, c_zero, queue ));
+            start = magma_wtime();
+            for (j=0; j < 20; j++) {
+                TESTING_CHECK( magma_s_spmv( c_one, hA_host, hx, c_zero, hcheck, queue ));
+            }
+            end = magma_wtime();
+            res = 0.0;
+            for(magma_int_t k=0; k < hA.num_rows; k++ ){
+                res = res + MAGMA_S_ABS(hcheck.val[k] - hrefvec.val[k]);
+            }
+            res = ref == 0 ? res : res / ref;
+            printf( "%% > MAGMA: %.2e seconds %.2e GFLOP/s    (CPU %s).\n",
+                (end-start)/20, FLOPS*20/(end-start), host_names[f] );
+            if ( res < accuracy ) {
+                printf("%% |x-y|_F/|y| = %8.2e Tester spmv CPU %s:  ok\n", res, host_names[f] );
+            } else {
+                printf("%% |x-y|_F/|y| = %8.2e Tester spmv CPU %s:  failed\n", res, host_names[f] );
+            }
+            magma_smfree( &hcheck, queue );
+            magma_smfree( &hA_host, queue );
+        }
 
 
+        #if ! defined(HAVE_HOST)
         // SpMV on GPU (CUSPARSE - CSR)
         // CUSPARSE context
         cusparseHandle = magma_queue_get_cusparse_handle( queue );
@@ -418,6 +498,7 @@ int main(  int argc, char** argv )
 
         cusparseDestroyMatDescr( descr  );
         descr = NULL;
+        #endif
         
         // print everything in matlab-readable output
         // cuSPARSE-CSR cuSPARSE-HYB  SELLP  CSR5
@@ -18,6 +18,7 @@
 // includes, project
 #include "magma_v2.h"
 #include "magmasparse.h"
+#include "magma_operators.h"
 #include "magma_lapack.h"
 #include "testings.h"
 
@@ -39,6 +40,8 @@ int main(  int argc, char** argv )
     magma_c_matrix cA={Magma_CSR}, dcB={Magma_CSR};
     magma_z_matrix diag={Magma_CSR}, ddiag={Magma_CSR};
     magma_z_matrix x={Magma_CSR}, b={Magma_CSR};
+    magma_z_matrix mpA={Magma_CSR}, ref={Magma_CSR};
+    magma_precision mpformat[2] = { Magma_FLOAT, Magma_HALF };
     real_Double_t start, end;
 
     int i=1;
@@ -128,6 +131,34 @@ int main(  int argc, char** argv )
                                         (end-start)/10, FLOPS*10/(end-start) );
         
         magma_cmfree(&dcB, queue );
+        magma_zmfree(&x, queue );
+        magma_zmfree(&b, queue );
+
+        
+        // host SpMV with the values stored in single and half precision
+        printf("\n\nhost mixed precision storage:\n");
+        TESTING_CHECK( magma_zvinit( &x, Magma_CPU, A.num_cols, 1, one, queue ));
+        TESTING_CHECK( magma_zvinit( &b, Magma_CPU, A.num_rows, 1, zero, queue ));
+        TESTING_CHECK( magma_zvinit( &ref, Magma_CPU, A.num_rows, 1, zero, queue ));
+        TESTING_CHECK( magma_z_spmv_cpu( one, A, x, zero, ref, queue ));
+        for (int f=0; f<2; f++) {
+            TESTING_CHECK( magma_zmcsrmp( A, mpformat[f], &mpA, queue ));
+            start = magma_wtime();
+            for (int z=0; z<10; z++) {
+                TESTING_CHECK( magma_z_spmv_cpu( one, mpA, x, zero, b, queue ));
+            }
+            end = magma_wtime();
+            double err = 0.0, nrm = 0.0;
+            for (magma_int_t k=0; k<A.num_rows; k++) {
+                err += MAGMA_Z_ABS( b.val[k] - ref.val[k] ) * MAGMA_Z_ABS( b.val[k] - ref.val[k] );
+                nrm += MAGMA_Z_ABS( ref.val[k] ) * MAGMA_Z_ABS( ref.val[k] );
+            }
+            printf( " > host SpMV, values in %s : %.2e seconds %.2e GFLOP/s, relative error %.2e\n",
+                    (f == 0 ? "FP32" : "FP16"), (end-start)/10, FLOPS*10/(end-start),
+                    sqrt( err / nrm ) );
+            magma_zmfree(&mpA, queue );
+        }
+        magma_zmfree(&ref, queue );
 
         magma_cmfree(&cA, queue );
         
@@ -41,7 +41,7 @@ int main(  int argc, char** argv )
     
     real_Double_t res;
     magma_z_matrix A={Magma_CSR}, A2={Magma_CSR}, 
-    A3={Magma_CSR}, A4={Magma_CSR}, A5={Magma_CSR};
+    A3={Magma_CSR}, A4={Magma_CSR}, A5={Magma_CSR}, A6={Magma_CSR};
     
     int i=1;
     TESTING_CHECK( magma_zparse_opts( argc, argv, &zopts, &i, queue ));
@@ -68,6 +68,19 @@ int main(  int argc, char** argv )
 
         // delete temporary matrix
         unlink( filename );
+
+        // same for the binary container, loaded zero-copy
+        const char *binname = "testmatrix.bin";
+        TESTING_CHECK( magma_zwrite_csr_bin( A, binname, queue ));
+        TESTING_CHECK( magma_z_csr_bin( &A6, binname, queue ));
+        unlink( binname );
+        TESTING_CHECK( magma_zmdiff( A, A6, &res, queue ));
+        printf("%% ||A-B||_F = %8.2e\n", res);
+        if ( res < .000001 )
+            printf("%% tester binary IO:  ok\n");
+        else
+            printf("%% tester binary IO:  failed\n");
+        TESTING_CHECK( magma_zmfree_bin( &A6, queue ));
                 
         //visualize
         printf("A2:\n");
@@ -35,7 +35,7 @@ int main(  int argc, char** argv )
 
     real_Double_t res;
     magma_z_matrix A={Magma_CSR}, B={Magma_CSR}, B2={Magma_CSR}, 
-    dA={Magma_CSR}, dB={Magma_CSR}, dC={Magma_CSR};
+    dA={Magma_CSR}, dB={Magma_CSR}, dC={Magma_CSR}, C={Magma_CSR}, C2={Magma_CSR};
 
     magmaDoubleComplex one = MAGMA_Z_MAKE(1.0, 0.0);
     magmaDoubleComplex mone = MAGMA_Z_MAKE(-1.0, 0.0);
@@ -87,6 +87,29 @@ int main(  int argc, char** argv )
     else
         printf("%% tester matrix add:  failed\n");
 
+    // sparse matrix product on the host, the numeric phase is run twice
+    // reusing the pattern, and on the device
+    if ( A.num_cols == B.num_rows ) {
+        TESTING_CHECK( magma_zspgemm_symbolic_cpu( A, B, &C, queue ));
+        TESTING_CHECK( magma_zspgemm_numeric_cpu( mone, A, B, &C, queue ));
+        TESTING_CHECK( magma_zspgemm_numeric_cpu( one, A, B, &C, queue ));
+        TESTING_CHECK( magma_zmtransfer( A, &dA, Magma_CPU, Magma_DEV, queue ));
+        TESTING_CHECK( magma_zmtransfer( B, &dB, Magma_CPU, Magma_DEV, queue ));
+        TESTING_CHECK( magma_z_spmm( one, dA, dB, &dC, queue ));
+        TESTING_CHECK( magma_zmtransfer( dC, &C2, Magma_DEV, Magma_CPU, queue ));
+        TESTING_CHECK( magma_zmdiff( C, C2, &res, queue ));
+        printf("%% ||AB_host-AB_dev||_F = %8.2e\n", res);
+        if ( res < .000001 && C.nnz == C2.nnz )
+            printf("%% tester matrix product:  ok\n");
+        else
+            printf("%% tester matrix product:  failed\n");
+        magma_zmfree(&dA, queue );
+        magma_zmfree(&dB, queue );
+        magma_zmfree(&dC, queue );
+        magma_zmfree(&C, queue );
+        magma_zmfree(&C2, queue );
+    }
+
     magma_zmfree(&A, queue );
     magma_zmfree(&B, queue );
     magma_zmfree(&B2, queue );
@@ -41,6 +41,8 @@ int main(  int argc, char** argv )
     magma_z_matrix Z3={Magma_CSR};
     magma_z_matrix Z4={Magma_CSR};
     magma_z_matrix Z5={Magma_CSR};
+    magma_z_parilut_workspace ws={0};
+    real_Double_t res;
     
     int i=1;
     TESTING_CHECK( magma_zparse_opts( argc, argv, &zopts, &i, queue ));
@@ -72,6 +74,16 @@ int main(  int argc, char** argv )
         TESTING_CHECK( magma_zmatrix_cup( Z1, Z2, &Z3, queue ));
         magma_zprint_matrix( Z3, queue );
         
+        // the same into reused workspace storage, twice
+        TESTING_CHECK( magma_zmatrix_cup_ws( Z1, Z2, &ws.L_new, queue ));
+        TESTING_CHECK( magma_zmatrix_cup_ws( Z1, Z2, &ws.L_new, queue ));
+        TESTING_CHECK( magma_zmdiff( Z3, ws.L_new, &res, queue ));
+        if ( res == 0.0 && ws.L_new.nnz == Z3.nnz )
+            printf("%% tester reused cup:  ok\n");
+        else
+            printf("%% tester reused cup:  failed\n");
+        magma_zparilut_workspace_free( &ws, queue );
+        
         // now the negcap:
         printf("C = B cap B^T :\n");
         TESTING_CHECK( magma_zmatrix_cap( Z1, Z2, &Z4, queue ));
@@ -82,7 +94,13 @@ int main(  int argc, char** argv )
         printf("C = B negcap B^T :\n");
         TESTING_CHECK( magma_zmatrix_negcap( Z1, Z2, &Z5, queue ));
         magma_zprint_matrix( Z5, queue );
-        
+
+        // the element counts have to be consistent
+        if ( Z1.nnz + Z2.nnz == Z3.nnz + Z4.nnz && Z5.nnz == Z1.nnz - Z4.nnz )
+            printf("%% tester cup/cap/negcap counts:  ok\n");
+        else
+            printf("%% tester cup/cap/negcap counts:  failed\n");
+
         magma_zmfree(&Z, queue );
         magma_zmfree(&Z1, queue );
         magma_zmfree(&Z2, queue );
@@ -120,7 +120,19 @@ int main(  int argc, char** argv )
                 
         TESTING_CHECK( magma_zresidual( dB, b, x, &residual, queue ));
         zopts.solver_par.final_res = residual;
-        
+
+        // numeric refactorization for the same values has to give the same result
+        real_Double_t setuptime = zopts.precond_par.setuptime;
+        TESTING_CHECK( magma_z_precond_refactor( dB, b, &zopts.solver_par, &zopts.precond_par, queue ) );
+        info = magma_z_applyprecond_left( MagmaNoTrans, dB, b, &t, &zopts.precond_par, queue );
+        info = magma_z_applyprecond_right( MagmaNoTrans, dB, t, &x2, &zopts.precond_par, queue );
+        TESTING_CHECK( magma_zresidual( dB, b, x2, &residual, queue ));
+        printf("%% refactorization: setup %.4e sec, residual %.8e (%s)\n",
+                zopts.precond_par.setuptime, residual,
+                ( fabs( residual - zopts.solver_par.final_res )
+                    <= 1e-3 * zopts.solver_par.final_res ) ? "ok" : "failed" );
+        zopts.precond_par.setuptime = setuptime;
+
         magma_zsolverinfo( &zopts.solver_par, &zopts.precond_par, queue );
 
         magma_zmfree(&dB, queue );
@@ -88,6 +88,41 @@ int main(  int argc, char** argv )
 
     magma_free_cpu( y );
     
+    // sorted, reversed and equal-magnitude input, large enough for the
+    // parallel sort
+    magma_int_t nl = 100000, ok = 1;
+    magma_index_t *col=NULL, *row=NULL;
+    TESTING_CHECK( magma_zmalloc_cpu( &y, nl ));
+    TESTING_CHECK( magma_index_malloc_cpu( &col, nl ));
+    TESTING_CHECK( magma_index_malloc_cpu( &row, nl ));
+    for( magma_int_t pattern = 0; pattern < 3; pattern++ ) {
+        for(i = 0; i < nl; i++ ){
+            double r = ( pattern == 0 ) ? (double) i :
+                       ( pattern == 1 ) ? (double) (nl-i) : 1.0;
+            y[i] = MAGMA_Z_MAKE( ( i % 2 == 0 ) ? r : -r, 0.0 );
+            col[i] = i;
+            row[i] = i;
+        }
+        TESTING_CHECK( magma_zmsort( y, col, row, 0, nl-1, queue ));
+        for(i = 1; i < nl; i++ ){
+            double r = ( pattern == 0 ) ? (double) col[i] :
+                       ( pattern == 1 ) ? (double) (nl-col[i]) : 1.0;
+            if ( MAGMA_Z_ABS( y[i-1] ) > MAGMA_Z_ABS( y[i] ) ||
+                 MAGMA_Z_ABS( y[i] ) != r ||
+                 ( pattern == 2 && col[i-1] > col[i] ) ||
+                 row[i] != col[i] ) {
+                ok = 0;
+            }
+        }
+    }
+    printf("sorting sorted/reversed/equal input: %s\n\n", ok ? "ok" : "failed");
+    if ( ! ok ) {
+        info = -1;
+    }
+    magma_free_cpu( y );
+    magma_free_cpu( col );
+    magma_free_cpu( row );
+    
     i=1;
     while( i < argc ) {
         if ( strcmp("LAPLACE2D", argv[i]) == 0 && i+1 < argc ) {   // Laplace test
@@ -15,8 +15,6 @@
 #include <string.h>
 #include <math.h>
 
-#include <cuda_runtime.h>
-
 // includes, project
 #include "magma_v2.h"
 #include "magmasparse.h"
@@ -37,7 +35,9 @@ int main(  int argc, char** argv )
     
     magmaDoubleComplex one = MAGMA_Z_MAKE(1.0, 0.0);
     magmaDoubleComplex zero = MAGMA_Z_MAKE(0.0, 0.0);
+    #if ! defined(HAVE_HOST)
     magmaDoubleComplex mone = MAGMA_Z_MAKE(-1.0, 0.0);
+    #endif
     magma_z_matrix A={Magma_CSR}, a={Magma_CSR}, b={Magma_CSR};
     magma_z_matrix c={Magma_CSR}, d={Magma_CSR};
     magma_int_t dofs;
@@ -79,9 +79,10 @@ int main(  int argc, char** argv )
         
         if(debug)printf("%% --- debug mode ---");
         else { printf("prec_info = [\n");
-               printf("%% row-wise: cuSOLVE, sync-free, BJ(1)-3, BJ(1)-5, BJ(12)-3, BJ(12)-5, BJ(24)-3, BJ(24)-5, ISAI(1)-0, ISAI(2)-0, ISAI(3)-0\n");
+               printf("%% row-wise: cuSOLVE, sync-free, BJ(1)-3, BJ(1)-5, BJ(12)-3, BJ(12)-5, BJ(24)-3, BJ(24)-5, ISAI(1)-0, ISAI(2)-0, ISAI(3)-0, host-levels, host-sync-free\n");
                printf("%% col-wise: prec-setup res_L time_L res_U time_U\n");
         }
+        #if ! defined(HAVE_HOST)
         // preconditioner with cusparse trisolve
         printf("%% --- Now use cuSPARSE trisolve ---\n");
         zopts.precond_par.solver = Magma_ILU;
@@ -733,7 +734,69 @@ int main(  int argc, char** argv )
         magma_zmfree(&c, queue );
         magma_zmfree(&d, queue );
         magma_zprecondfree( &zopts.precond_par , queue );
+        #endif
+
+
+        // host preconditioner with level-scheduled and sync-free trisolve
+        for( magma_int_t k=0; k<2; k++ ){
+        printf("\n%% --- Now use host %s trisolve ---\n",
+                ( k == 0 ) ? "level-scheduled" : "sync-free" );
+        zopts.precond_par.solver = Magma_PARILU;
+        zopts.precond_par.trisolver = ( k == 0 ) ? Magma_CUSOLVE : Magma_SYNCFREESOLVE;
+        zopts.precond_par.levels = 0;
+        zopts.precond_par.sweeps = 5;
 
+        // vectors and initial guess in host memory
+        TESTING_CHECK( magma_zvinit( &a, Magma_CPU, A.num_rows, 1, one, queue ));
+        TESTING_CHECK( magma_zvinit( &b, Magma_CPU, A.num_rows, 1, zero, queue ));
+        TESTING_CHECK( magma_zvinit( &c, Magma_CPU, A.num_rows, 1, zero, queue ));
+        
+        tempo1 = magma_sync_wtime( queue );
+        TESTING_CHECK( magma_z_precondsetup( A, a, &zopts.solver_par, &zopts.precond_par, queue ) );
+        tempo2 = magma_sync_wtime( queue );
+        if(debug)printf("%% time_magma_z_precondsetup = %.6e\n",tempo2-tempo1 );
+        else printf("%.6e\t",tempo2-tempo1 );
+        
+        // b = sptrsv(L,a)
+        // c = L*b
+        // res = norm(a-c)
+        tempo1 = magma_sync_wtime( queue );
+        TESTING_CHECK( magma_z_applyprecond_left( MagmaNoTrans, A, a, &b, &zopts.precond_par, queue ));
+        tempo2 = magma_sync_wtime( queue );
+        TESTING_CHECK( magma_z_spmv( one, zopts.precond_par.L, b, zero, c, queue ));   
+        res = 0.0;
+        for( magma_int_t j=0; j<dofs; j++ ){
+            res += MAGMA_Z_ABS( MAGMA_Z_SUB( a.val[j], c.val[j] ) )
+                 * MAGMA_Z_ABS( MAGMA_Z_SUB( a.val[j], c.val[j] ) );
+        }
+        res = sqrt( res );
+        if(debug)printf("%% residual_L = %.6e\n", res );
+        else printf("%.6e\t", res );
+        if(debug)printf("%% time_L = %.6e\n",tempo2-tempo1 );
+        else printf("%.6e\t",tempo2-tempo1 );
+        
+        // b = sptrsv(U,a)
+        // c = U*b
+        // res = norm(a-c)
+        tempo1 = magma_sync_wtime( queue );
+        TESTING_CHECK( magma_z_applyprecond_right( MagmaNoTrans, A, a, &b, &zopts.precond_par, queue ));
+        tempo2 = magma_sync_wtime( queue );
+        TESTING_CHECK( magma_z_spmv( one, zopts.precond_par.U, b, zero, c, queue ));   
+        res = 0.0;
+        for( magma_int_t j=0; j<dofs; j++ ){
+            res += MAGMA_Z_ABS( MAGMA_Z_SUB( a.val[j], c.val[j] ) )
+                 * MAGMA_Z_ABS( MAGMA_Z_SUB( a.val[j], c.val[j] ) );
+        }
+        res = sqrt( res );
+        if(debug)printf("%% residual_U = %.6e\n", res );
+        else printf("%.6e\t", res );
+        if(debug)printf("%% time_U = %.6e\n",tempo2-tempo1 );
+        else printf("%.6e\n",tempo2-tempo1 );
+        magma_zmfree(&a, queue );
+        magma_zmfree(&b, queue );
+        magma_zmfree(&c, queue );
+        magma_zprecondfree( &zopts.precond_par , queue );
+        }
         
         if(debug)printf("%% --- completed ---");
         else printf("];\n");
@@ -8,7 +8,7 @@
        @author Mark Gates
        @author Azzam Haidar
        
-       @generated from src/ztrevc3_mt.cpp, normal z -> c, Sat Mar 27 20:31:03 2021
+       @generated from src/ztrevc3_mt.cpp, normal z -> c, Fri Oct 16 19:47:14 2026
 */
 #include "thread_queue.hpp"
 #include "magma_timer.h"
@@ -130,6 +130,46 @@ private:
 };
 
 
+// ---------------------------------------------
+// stores arguments and executes normalization of a block of eigenvectors,
+// then copies them to V (on CPU)
+class magma_cnormalize_task: public magma_task
+{
+public:
+    magma_cnormalize_task(
+        magma_int_t in_n, magma_int_t in_nv,
+        magmaFloatComplex *in_X, magma_int_t in_ldx,
+        magmaFloatComplex *in_V, magma_int_t in_ldv
+    ):
+        n  ( in_n   ),
+        nv ( in_nv  ),
+        X  ( in_X   ),
+        ldx( in_ldx ),
+        V  ( in_V   ),
+        ldv( in_ldv )
+    {}
+    
+    virtual void run()
+    {
+        const magma_int_t ione = 1;
+        for( magma_int_t k=0; k < nv; ++k ) {
+            magma_int_t ii = blasf77_icamax( &n, &X[k*ldx], &ione ) - 1;
+            float remax = 1. / MAGMA_C_ABS1( X[ii + k*ldx] );
+            blasf77_csscal( &n, &remax, &X[k*ldx], &ione );
+        }
+        lapackf77_clacpy( "F", &n, &nv, X, &ldx, V, &ldv );
+    }
+    
+private:
+    magma_int_t   n;
+    magma_int_t   nv;
+    magmaFloatComplex *X;
+    magma_int_t   ldx;
+    magmaFloatComplex *V;
+    magma_int_t   ldv;
+};
+
+
 /***************************************************************************//**
     Purpose
     -------
@@ -155,6 +195,10 @@ private:
 
     This uses a Level 3 BLAS version of the back transformation.
     This uses a multi-threaded (mt) implementation.
+    In the blocked version, the back transformation of a block of vectors
+    and the triangular solves of the next block overlap: tasks wait only
+    for the tasks they depend on, and two buffers for the vectors are used
+    if the extra n*nb workspace can be allocated.
 
     Arguments
     ---------
@@ -288,6 +332,7 @@ magma_int_t magma_ctrevc3_mt(
     #define VL(i,j)  (VL + (i) + (j)*ldvl)
     #define VR(i,j)  (VR + (i) + (j)*ldvr)
     #define work(i,j) (work + (i) + (j)*n)
+    #define X(i,j)    (xbuf[ib] + (i) + (j)*n)
 
     // .. Parameters ..
     const magmaFloatComplex c_zero = MAGMA_C_ZERO;
@@ -300,6 +345,15 @@ magma_int_t magma_ctrevc3_mt(
     magma_int_t            i, ii, is, j, k, ki, iv, n2, nb, nb2, version;
     float                 ovfl, remax, unfl;  //smlnum, smin, ulp
     
+    // In the blocked version, vectors alternate between nbuf buffers for x:
+    // xbuf[0] is columns 1:nb of work, xbuf[1] is allocated if possible.
+    // buf_id[ib] is the task that last read buffer ib;
+    // the gemm tasks of a block depend on the solves in dep.
+    magmaFloatComplex    *xbuf[2] = { work, NULL };
+    magma_int_t            ib = 0, nbuf = 1;
+    magma_task_id_t        buf_id[2] = { 0, 0 }, norm_id = 0;
+    std::vector< magma_task_id_t > dep, gemm_id;
+    
     // Decode and test the input parameters
     bothv  = (side == MagmaBothSides);
     rightv = (side == MagmaRight) || bothv;
@@ -362,6 +416,13 @@ magma_int_t magma_ctrevc3_mt(
         nb = min( nb, nbmax );
         nb2 = 1 + 2*nb;
         lapackf77_claset( "F", &n, &nb2, &c_zero, &c_zero, work, &n );
+        
+        // second buffer for x (column 0 is unused, like in work)
+        nb2 = 1 + nb;
+        if ( magma_cmalloc_cpu( &xbuf[1], n*nb2 ) == MAGMA_SUCCESS ) {
+            lapackf77_claset( "F", &n, &nb2, &c_zero, &c_zero, xbuf[1], &n );
+            nbuf = 2;
+        }
     }
     else {
         version = 1;
@@ -391,7 +452,7 @@ magma_int_t magma_ctrevc3_mt(
     magma_int_t lapack_nthread = magma_get_lapack_numthreads();
     magma_set_lapack_numthreads( 1 );
     magma_thread_queue queue;
-    queue.launch( nthread );
+    queue.launch( nthread, true );
     //printf( "nthread %lld, %lld\n", (long long) nthread, (long long) lapack_nthread );
     
     // gemm_nb = N/thread, rounded up to multiple of 16,
@@ -428,20 +489,24 @@ magma_int_t magma_ctrevc3_mt(
 
             // --------------------------------------------------------
             // Complex right eigenvector
-            *work(ki,iv) = c_one;
+            // Starting a block, wait for the gemm that last read this buffer.
+            if ( version == 2 && iv == nb ) {
+                queue.wait( buf_id[ib] );
+            }
+            *X(ki,iv) = c_one;
 
             // Form right-hand side.
             for( k=0; k < ki; ++k ) {
-                *work(k,iv) = -(*T(k,ki));
+                *X(k,iv) = -(*T(k,ki));
             }
 
             // Solve upper triangular system:
             // [ T(1:ki-1,1:ki-1) - T(ki,ki) ]*X = scale*work.
             if ( ki > 0 ) {
-                queue.push_task( new magma_clatrsd_task(
+                dep.push_back( queue.push_task( new magma_clatrsd_task(
                     MagmaUpper, MagmaNoTrans, MagmaNonUnit, MagmaTrue,
                     ki, T, ldt, *T(ki,ki),
-                    work(0,iv), work(ki,iv), rwork ));
+                    X(0,iv), X(ki,iv), rwork ), 0, NULL ));
             }
 
             // Copy the vector x or Q*x to VR and normalize.
@@ -449,8 +514,9 @@ magma_int_t magma_ctrevc3_mt(
                 // ------------------------------
                 // no back-transform: copy x to VR and normalize
                 queue.sync();
+                dep.clear();
                 n2 = ki+1;
-                blasf77_ccopy( &n2, work(0,iv), &ione, VR(0,is), &ione );
+                blasf77_ccopy( &n2, X(0,iv), &ione, VR(0,is), &ione );
 
                 ii = blasf77_icamax( &n2, VR(0,is), &ione ) - 1;
                 remax = 1. / MAGMA_C_ABS1( *VR(ii,is) );
@@ -464,13 +530,14 @@ magma_int_t magma_ctrevc3_mt(
                 // ------------------------------
                 // version 1: back-transform each vector with GEMV, Q*x.
                 queue.sync();
+                dep.clear();
                 time_trsv_sum += timer_stop( time_trsv );
                 timer_start( time_gemv );
                 if ( ki > 0 ) {
                     blasf77_cgemv( "n", &n, &ki, &c_one,
                                    VR, &ldvr,
-                                   work(0, iv), &ione,
-                                   work(ki,iv), VR(0,ki), &ione );
+                                   X(0, iv), &ione,
+                                   X(ki,iv), VR(0,ki), &ione );
                 }
                 time_gemv_sum += timer_stop( time_gemv );
                 ii = blasf77_icamax( &n, VR(0,ki), &ione ) - 1;
@@ -483,39 +550,41 @@ magma_int_t magma_ctrevc3_mt(
                 // version 2: back-transform block of vectors with GEMM
                 // zero out below vector
                 for( k=ki+1; k < n; ++k ) {
-                    *work(k,iv) = c_zero;
+                    *X(k,iv) = c_zero;
                 }
 
-                // Columns iv:nb of work are valid vectors.
+                // Columns iv:nb of X are valid vectors.
                 // When the number of vectors stored reaches nb,
                 // or if this was last vector, do the GEMM
                 if ( (iv == 1) || (ki == 0) ) {
-                    queue.sync();
                     time_trsv_sum += timer_stop( time_trsv );
                     timer_start( time_gemm );
                     nb2 = nb-iv+1;
                     n2  = ki+nb-iv+1;
                     
-                    // split gemm into multiple tasks, each doing one block row
+                    // split gemm into multiple tasks, each doing one block row.
+                    // gemm waits for the solves of this block, and for the
+                    // previous block's normalize to be done with work(:,nb+1:2nb).
+                    dep.push_back( norm_id );
+                    gemm_id.clear();
                     for( i=0; i < n; i += gemm_nb ) {
-                        magma_int_t ib = min( gemm_nb, n-i );
-                        queue.push_task( new cgemm_task(
-                            MagmaNoTrans, MagmaNoTrans, ib, nb2, n2, c_one,
+                        magma_int_t ib_ = min( gemm_nb, n-i );
+                        gemm_id.push_back( queue.push_task( new cgemm_task(
+                            MagmaNoTrans, MagmaNoTrans, ib_, nb2, n2, c_one,
                             VR(i,0), ldvr,
-                            work(0,iv   ), n, c_zero,
-                            work(i,nb+iv), n ));
+                            X(0,iv), n, c_zero,
+                            work(i,nb+iv), n ), dep.size(), &dep[0] ));
                     }
-                    queue.sync();
+                    dep.clear();
                     time_gemm_sum += timer_stop( time_gemm );
                     
                     // normalize vectors
                     // TODO if somev, should copy vectors individually to correct location.
-                    for( k = iv; k <= nb; ++k ) {
-                        ii = blasf77_icamax( &n, work(0,nb+k), &ione ) - 1;
-                        remax = 1. / MAGMA_C_ABS1( *work(ii,nb+k) );
-                        blasf77_csscal( &n, &remax, work(0,nb+k), &ione );
-                    }
-                    lapackf77_clacpy( "F", &n, &nb2, work(0,nb+iv), &n, VR(0,ki), &ldvr );
+                    norm_id = queue.push_task( new magma_cnormalize_task(
+                        n, nb2, work(0,nb+iv), n, VR(0,ki), ldvr ),
+                        gemm_id.size(), &gemm_id[0] );
+                    buf_id[ib] = norm_id;
+                    ib = (ib + 1) % nbuf;
                     iv = nb;
                     timer_start( time_trsv );
                 }
@@ -526,6 +595,7 @@ magma_int_t magma_ctrevc3_mt(
 
             is -= 1;
         }
+        queue.sync();
     }
     timer_stop( time_trsv );
     
@@ -552,11 +622,15 @@ magma_int_t magma_ctrevc3_mt(
         
             // --------------------------------------------------------
             // Complex left eigenvector
-            *work(ki,iv) = c_one;
+            // Starting a block, wait for the gemm that last read this buffer.
+            if ( version == 2 && iv == 1 ) {
+                queue.wait( buf_id[ib] );
+            }
+            *X(ki,iv) = c_one;
         
             // Form right-hand side.
             for( k = ki + 1; k < n; ++k ) {
-                *work(k,iv) = -MAGMA_C_CONJ( *T(ki,k) );
+                *X(k,iv) = -MAGMA_C_CONJ( *T(ki,k) );
             }
             
             // Solve conjugate-transposed triangular system:
@@ -564,10 +638,10 @@ magma_int_t magma_ctrevc3_mt(
             // TODO what happens with T(k,k) - lambda is small? Used to have < smin test.
             if ( ki < n-1 ) {
                 n2 = n-ki-1;
-                queue.push_task( new magma_clatrsd_task(
+                dep.push_back( queue.push_task( new magma_clatrsd_task(
                     MagmaUpper, MagmaConjTrans, MagmaNonUnit, MagmaTrue,
                     n2, T(ki+1,ki+1), ldt, *T(ki,ki),
-                    work(ki+1,iv), work(ki,iv), rwork ));
+                    X(ki+1,iv), X(ki,iv), rwork ), 0, NULL ));
             }
             
             // Copy the vector x or Q*x to VL and normalize.
@@ -575,8 +649,9 @@ magma_int_t magma_ctrevc3_mt(
                 // ------------------------------
                 // no back-transform: copy x to VL and normalize
                 queue.sync();
+                dep.clear();
                 n2 = n-ki;
-                blasf77_ccopy( &n2, work(ki,iv), &ione, VL(ki,is), &ione );
+                blasf77_ccopy( &n2, X(ki,iv), &ione, VL(ki,is), &ione );
         
                 ii = blasf77_icamax( &n2, VL(ki,is), &ione ) + ki - 1;
                 remax = 1. / MAGMA_C_ABS1( *VL(ii,is) );
@@ -590,12 +665,13 @@ magma_int_t magma_ctrevc3_mt(
                 // ------------------------------
                 // version 1: back-transform each vector with GEMV, Q*x.
                 queue.sync();
+                dep.clear();
                 if ( ki < n-1 ) {
                     n2 = n-ki-1;
                     blasf77_cgemv( "n", &n, &n2, &c_one,
                                    VL(0,ki+1), &ldvl,
-                                   work(ki+1,iv), &ione,
-                                   work(ki,  iv), VL(0,ki), &ione );
+                                   X(ki+1,iv), &ione,
+                                   X(ki,  iv), VL(0,ki), &ione );
                 }
                 ii = blasf77_icamax( &n, VL(0,ki), &ione ) - 1;
                 remax = 1. / MAGMA_C_ABS1( *VL(ii,ki) );
@@ -607,33 +683,35 @@ magma_int_t magma_ctrevc3_mt(
                 // zero out above vector
                 // could go from (ki+1)-NV+1 to ki
                 for( k=0; k < ki; ++k ) {
-                    *work(k,iv) = c_zero;
+                    *X(k,iv) = c_zero;
                 }
         
-                // Columns 1:iv of work are valid vectors.
+                // Columns 1:iv of X are valid vectors.
                 // When the number of vectors stored reaches nb,
                 // or if this was last vector, do the GEMM
                 if ( (iv == nb) || (ki == n-1) ) {
-                    queue.sync();
                     n2 = n-(ki+1)+iv;
                     
-                    // split gemm into multiple tasks, each doing one block row
+                    // split gemm into multiple tasks, each doing one block row.
+                    // gemm waits for the solves of this block, and for the
+                    // previous block's normalize to be done with work(:,nb+1:2nb).
+                    dep.push_back( norm_id );
+                    gemm_id.clear();
                     for( i=0; i < n; i += gemm_nb ) {
-                        magma_int_t ib = min( gemm_nb, n-i );
-                        queue.push_task( new cgemm_task(
-                            MagmaNoTrans, MagmaNoTrans, ib, iv, n2, c_one,
+                        magma_int_t ib_ = min( gemm_nb, n-i );
+                        gemm_id.push_back( queue.push_task( new cgemm_task(
+                            MagmaNoTrans, MagmaNoTrans, ib_, iv, n2, c_one,
                             VL(i,ki-iv+1), ldvl,
-                            work(ki-iv+1,1), n, c_zero,
-                            work(i,nb+1), n ));
+                            X(ki-iv+1,1), n, c_zero,
+                            work(i,nb+1), n ), dep.size(), &dep[0] ));
                     }
-                    queue.sync();
+                    dep.clear();
                     // normalize vectors
-                    for( k=1; k <= iv; ++k ) {
-                        ii = blasf77_icamax( &n, work(0,nb+k), &ione ) - 1;
-                        remax = 1. / MAGMA_C_ABS1( *work(ii,nb+k) );
-                        blasf77_csscal( &n, &remax, work(0,nb+k), &ione );
-                    }
-                    lapackf77_clacpy( "F", &n, &iv, work(0,nb+1), &n, VL(0,ki-iv+1), &ldvl );
+                    norm_id = queue.push_task( new magma_cnormalize_task(
+                        n, iv, work(0,nb+1), n, VL(0,ki-iv+1), ldvl ),
+                        gemm_id.size(), &gemm_id[0] );
+                    buf_id[ib] = norm_id;
+                    ib = (ib + 1) % nbuf;
                     iv = 1;
                 }
                 else {
@@ -643,11 +721,13 @@ magma_int_t magma_ctrevc3_mt(
         
             is += 1;
         }
+        queue.sync();
     }
     
     // close down threads
     queue.quit();
     magma_set_lapack_numthreads( lapack_nthread );
+    magma_free_cpu( xbuf[1] );
     
     return *info;
 }  // End of CTREVC
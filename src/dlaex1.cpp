@@ -82,8 +82,10 @@
     @param
     work    (workspace) DOUBLE PRECISION array, dimension (4*N + N**2)
             
-    @param
+    @param[out]
     iwork   (workspace) INTEGER array, dimension (4*N)
+            On exit, IWORK(1) is K, the number of eigenvalues that were
+            not deflated.
             
     @param
     dwork   (workspace) DOUBLE PRECISION array, dimension (3*N*N/2+3*N)
@@ -207,6 +209,7 @@ magma_dlaex1(
         for (i = 0; i < n; ++i)
             indxq[i] = i+1;
     }
+    iwork[0] = k;
 
     return *info;
 } /* magma_dlaex1 */
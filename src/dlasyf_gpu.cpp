@@ -8,7 +8,7 @@
        @author Ichi Yamazaki
        @author Stan Tomov
 
-       @generated from src/zlahef_gpu.cpp, normal z -> d, Sat Mar 27 20:30:49 2021
+       @generated from zlahef_gpu.cpp, normal z -> d, Fri Oct 16 23:24:59 2026
 */
 #include "magma_internal.h"
 #include "trace.h"
@@ -587,8 +587,8 @@ magma_dlasyf_gpu(
 
                     if ( k < n-1 ) {
                         magma_dgetvector_async( 1, &dA( k, k ), 1, &Z, 1, queues[0] );
-                        R1 = d_one / MAGMA_D_REAL( Z );
                         magma_queue_sync( queues[0] );
+                        R1 = d_one / MAGMA_D_REAL( Z );
                         trace_gpu_start( 0, 0, "scal", "scal-1" );
                         magma_dscal((n-1)-k, R1, &dA( k+1, k ), 1, queues[0]);
                         trace_gpu_end( 0, 0 );
@@ -9,9 +9,12 @@
        @author Stan Tomov
        @author Raffaele Solca
 
-       @generated from src/zhetrd_hb2st.cpp, normal z -> d, Sat Mar 27 20:30:55 2021
+       @generated from src/zhetrd_hb2st.cpp, normal z -> d, Fri Oct 16 19:52:27 2026
 
 */
+#include <atomic>
+#include <time.h>
+
 #include "magma_internal.h"
 #include "magma_bulge.h"
 #include "magma_dbulge.h"
@@ -30,7 +33,8 @@ static void magma_dtile_bulge_parallel(
     double *V, magma_int_t ldv,
     double *TAU, magma_int_t n, magma_int_t nb, magma_int_t nbtiles,
     magma_int_t grsiz, magma_int_t Vblksiz, magma_int_t wantz, 
-    volatile magma_int_t *prog, pthread_barrier_t* myptbarrier);
+    std::atomic< magma_int_t > *prog, std::atomic< magma_int_t > *ticket,
+    double *timewait, magma_int_t *ngroup);
 
 static void magma_dtile_bulge_computeT_parallel(
     magma_int_t my_core_id, magma_int_t cores_num,
@@ -55,7 +59,10 @@ typedef struct magma_dbulge_data_s {
     double* TAU;
     double* T;
     magma_int_t ldt;
-    volatile magma_int_t *prog;
+    std::atomic< magma_int_t > *prog;
+    std::atomic< magma_int_t > ticket;  // next group of bulge chasing steps to claim
+    double *timewait;                   // per thread, time waiting in bulge chasing (ENABLE_TIMER)
+    magma_int_t *ngroup;                // per thread, number of groups executed
     pthread_barrier_t myptbarrier;
 } magma_dbulge_data;
 
@@ -68,7 +75,7 @@ void magma_dbulge_data_init(
     double *A, magma_int_t lda,
     double *V, magma_int_t ldv, double *TAU,
     double *T, magma_int_t ldt,
-    volatile magma_int_t* prog)
+    std::atomic< magma_int_t >* prog, double *timewait, magma_int_t *ngroup)
 {
     dbulge_data_S->threads_num = threads_num;
     dbulge_data_S->n = n;
@@ -85,6 +92,9 @@ void magma_dbulge_data_init(
     dbulge_data_S->T = T;
     dbulge_data_S->ldt = ldt;
     dbulge_data_S->prog = prog;
+    dbulge_data_S->ticket.store( 0 );
+    dbulge_data_S->timewait = timewait;
+    dbulge_data_S->ngroup = ngroup;
 
     pthread_barrier_init(&(dbulge_data_S->myptbarrier), NULL, (unsigned) dbulge_data_S->threads_num);
 }
@@ -211,11 +221,19 @@ magma_dsytrd_sb2st(
     memset(TAU, 0, sizTAU2*sizeof(double));
     memset(V,   0, sizV2*sizeof(double));
 
-    magma_int_t INgrsiz=1;
     magma_int_t nbtiles = magma_ceildiv(n, nb);
-    volatile magma_int_t* prog;
-    magma_malloc_cpu((void**) &prog, (2*nbtiles+parallel_threads+10)*sizeof(magma_int_t));
-    memset((void *) prog, 0, (2*nbtiles+parallel_threads+10)*sizeof(magma_int_t));
+    magma_int_t INgrsiz = magma_bulge_get_grsiz(n, nb, lda, sizeof(double), parallel_threads);
+    magma_int_t nprog   = 2*nbtiles + parallel_threads + 10;
+    std::atomic< magma_int_t >* prog = new std::atomic< magma_int_t >[ nprog ];
+    for (magma_int_t i = 0; i < nprog; i++) {
+        prog[i].store( 0 );
+    }
+    double* timewait;
+    magma_int_t* ngroup;
+    magma_dmalloc_cpu(&timewait, parallel_threads);
+    magma_imalloc_cpu(&ngroup, parallel_threads);
+    memset(timewait, 0, parallel_threads*sizeof(double));
+    memset(ngroup,   0, parallel_threads*sizeof(magma_int_t));
 
     magma_dbulge_id_data* arg;
     magma_malloc_cpu((void**) &arg, parallel_threads*sizeof(magma_dbulge_id_data));
@@ -226,7 +244,7 @@ magma_dsytrd_sb2st(
 
     magma_dbulge_data data_bulge;
     magma_dbulge_data_init(&data_bulge, parallel_threads, n, nb, nbtiles, INgrsiz, Vblksiz, wantz,
-                                 A, lda, V, ldv, TAU, T, ldt, prog);
+                                 A, lda, V, ldv, TAU, T, ldt, prog, timewait, ngroup);
 
     // Set one thread per core
     pthread_attr_init(&thread_attr);
@@ -260,7 +278,9 @@ magma_dsytrd_sb2st(
 
     magma_free_cpu(thread_id);
     magma_free_cpu(arg);
-    magma_free_cpu((void *) prog);
+    delete[] prog;
+    magma_free_cpu(timewait);
+    magma_free_cpu(ngroup);
     magma_dbulge_data_destroy(&data_bulge);
 
     magma_set_omp_numthreads(ompth);
@@ -336,7 +356,8 @@ static void *magma_dsytrd_sb2st_parallel_section(void *arg)
     double *TAU    = data -> TAU;
     double *T      = data -> T;
     magma_int_t ldt            = data -> ldt;
-    volatile magma_int_t* prog = data -> prog;
+    std::atomic< magma_int_t >* prog   = data -> prog;
+    std::atomic< magma_int_t >* ticket = &(data -> ticket);
 
     pthread_barrier_t* myptbarrier = &(data -> myptbarrier);
 
@@ -372,12 +393,13 @@ static void *magma_dsytrd_sb2st_parallel_section(void *arg)
     print_set.print_affinity(my_core_id, "starting affinity");
 #endif
     affinity_set original_set;
-    affinity_set new_set(my_core_id);
     magma_int_t check  = 0;
     magma_int_t check2 = 0;
-    // bind threads
+    // bind threads, compactly: thread i on the i-th CPU this process may use,
+    // so threads working on neighboring tiles share a socket
     check = original_set.get_affinity();
     if (check == 0) {
+        affinity_set new_set(original_set.get_cpu(my_core_id));
         check2 = new_set.set_affinity();
         if (check2 != 0)
             printf("Error in sched_setaffinity (single cpu)\n");
@@ -403,13 +425,25 @@ static void *magma_dsytrd_sb2st_parallel_section(void *arg)
         timeB = magma_wtime();
     #endif
 
-    magma_dtile_bulge_parallel(my_core_id, allcores_num, A, lda, V, ldv, TAU, n, nb, nbtiles, grsiz, Vblksiz, wantz, prog, myptbarrier);
+    magma_dtile_bulge_parallel(my_core_id, allcores_num, A, lda, V, ldv, TAU, n, nb, nbtiles, grsiz, Vblksiz, wantz,
+                               prog, ticket, &(data->timewait[my_core_id]), &(data->ngroup[my_core_id]));
     if (allcores_num > 1) pthread_barrier_wait(myptbarrier);
 
     #ifdef ENABLE_TIMER
     if (my_core_id == 0) {
         timeB = magma_wtime()-timeB;
         printf("  Finish BULGE   timing= %f\n", timeB);
+        double wait_sum = 0, wait_max = 0;
+        magma_int_t ngroup_sum = 0, nused = 0;
+        for (magma_int_t t = 0; t < allcores_num; t++) {
+            wait_sum   += data->timewait[t];
+            wait_max    = max( wait_max, data->timewait[t] );
+            ngroup_sum += data->ngroup[t];
+            nused      += (data->ngroup[t] > 0);
+        }
+        printf("  BULGE groups %lld of %lld steps on %lld threads, wait avg %f max %f\n",
+               (long long) ngroup_sum, (long long) grsiz, (long long) nused,
+               wait_sum/allcores_num, wait_max);
     }
     #endif
 
@@ -450,78 +484,40 @@ static void *magma_dsytrd_sb2st_parallel_section(void *arg)
 
 
 /******************************************************************************/
-#define expertmyss_cond_wait(m, n, val) \
-do { \
-    while (prog[(m)] != (val)) { \
-        magma_yield(); \
-    } \
-    for (kk=0; kk < 100; kk++) { \
-        __asm__ volatile ("nop;" :::); \
-    } \
-} while(0)
-
-// __asm__ volatile ("" ::: "memory") is a compiler fence (but not a hardware memory fence),
-// to prohibit load/store reordering across that point.
-// However, inline assemble (asm) isn't available on Microsoft VS x64.
-#define expertmyss_cond_set(m, n, val) \
-do { \
-    prog[(m)*(64/sizeof(magma_int_t))] = (val); \
-    __asm__ volatile ("" ::: "memory"); \
-} while(0)
-
-#define expertmyss_init(m, n, init_val) \
-do { \
-    if (my_core_id == 0) { \
-        magma_malloc_cpu((void**) &prog, ( (m)*(64/sizeof(int)) ) * sizeof(magma_int_t)); \
-        memset((magma_int_t*)prog, 0, (m)*(64/sizeof(magma_int_t))); \
-    } \
-    pthread_barrier_init(&myptbarrier, NULL, cores_num); \
-    pthread_barrier_wait(&myptbarrier); \
-    barrier(my_core_id, cores_num); \
-} while(0)
-
-#define expertmyss_finalize() \
-do { \
-    pthread_barrier_wait(&myptbarrier); \
-    pthread_barrier_destroy(&myptbarrier); \
-    barrier(my_core_id, cores_num); \
-    if (my_core_id == 0) { \
-        magma_free_cpu((void *) prog); \
-    } \
-} while(0)
-
-
-
-// see also __asm__ volatile ("" ::: "memory") in expertmyss_cond_set above
-#define myss_cond_set(m, n, val) \
-do { \
-    prog[(m)] = (val); \
-} while(0)
-
-#define myss_cond_wait(m, n, val) \
-do { \
-    while (prog[(m)] != (val)) \
-    { \
-        magma_yield(); \
-    } \
-} while(0)
-
-#define myss_init(m, n, init_val) \
-do { \
-    if (my_core_id == 0) { \
-        magma_malloc_cpu((void**) &prog,  (m) * sizeof(magma_int_t)); \
-        memset((magma_int_t*)prog, 0, (m)); \
-    } \
-    pthread_barrier_wait(myptbarrier); \
-} while(0)
-
-#define myss_finalize() \
-do { \
-    pthread_barrier_wait(myptbarrier); \
-    if (my_core_id == 0) { \
-        magma_free_cpu((void *) prog); \
-    } \
-} while(0)
+// Waits until step m of the bulge chasing has finished sweep val.
+// Spins briefly, then yields, then sleeps with exponential backoff up to
+// 64 us, so a waiting thread does not take the core from a working thread
+// under SMT or oversubscription.
+static inline void magma_dbulge_wait(
+    std::atomic< magma_int_t > *prog, magma_int_t m, magma_int_t val)
+{
+    magma_int_t iter = 0;
+    long nsec = 1000;
+    while (prog[m].load( std::memory_order_acquire ) != val) {
+        iter++;
+        if (iter <= 64) {
+            continue;
+        }
+        else if (iter <= 128) {
+            magma_yield();
+        }
+        else {
+            struct timespec ts = { 0, nsec };
+            nanosleep( &ts, NULL );
+            nsec = min( 2*nsec, 64000L );
+        }
+    }
+}
+
+
+/******************************************************************************/
+// Marks step m of the bulge chasing as finished for sweep val; the release
+// makes the kernel's updates visible to a thread that then sees val.
+static inline void magma_dbulge_set(
+    std::atomic< magma_int_t > *prog, magma_int_t m, magma_int_t val)
+{
+    prog[m].store( val, std::memory_order_release );
+}
 
 
 /******************************************************************************/
@@ -531,16 +527,28 @@ static void magma_dtile_bulge_parallel(
     double *V, magma_int_t ldv,
     double *TAU, magma_int_t n, magma_int_t nb, magma_int_t nbtiles,
     magma_int_t grsiz, magma_int_t Vblksiz, magma_int_t wantz, 
-    volatile magma_int_t *prog, pthread_barrier_t* myptbarrier)
+    std::atomic< magma_int_t > *prog, std::atomic< magma_int_t > *ticket,
+    double *timewait, magma_int_t *ngroup)
 {
     magma_int_t sweepid, myid, shift, stt, st, ed, stind, edind;
     magma_int_t blklastind, colpt;
     magma_int_t stepercol;
     magma_int_t i, j, m, k;
     magma_int_t thgrsiz, thgrnb, thgrid, thed;
-    magma_int_t coreid;
-    magma_int_t colblktile, maxrequiredcores, colpercore, allcoresnb;
+    magma_int_t group, mygroup;
+    magma_int_t colblktile, maxrequiredcores, allcoresnb;
     double *work;
+    #ifdef ENABLE_TIMER
+    real_Double_t timew;
+    #define wait_timed(m, val) \
+        do { \
+            timew = magma_wtime(); \
+            magma_dbulge_wait( prog, (m), (val) ); \
+            *timewait += magma_wtime() - timew; \
+        } while(0)
+    #else
+    #define wait_timed(m, val) magma_dbulge_wait( prog, (m), (val) )
+    #endif
 
     if (n <= 0)
         return;
@@ -559,7 +567,6 @@ static void magma_dtile_bulge_parallel(
      * However, when storing V in A, shift could be back to 3.
      * */
 
-    magma_dmalloc_cpu(&work, nb);
     /* Some tunning for the bulge chasing code
      * see technical report for details */
     /* grsiz   = 2; */
@@ -575,7 +582,6 @@ static void magma_dtile_bulge_parallel(
         colblktile = grsiz/2;
 
     maxrequiredcores = max( nbtiles/colblktile, 1 );
-    colpercore = colblktile*nb;
     allcoresnb = min( cores_num, maxrequiredcores );
     thgrsiz = n;
     #if defined (ENABLE_DEBUG)
@@ -586,15 +592,27 @@ static void magma_dtile_bulge_parallel(
             printf("  WARNING only %3lld threads are required to run this test optimizing cache reuse\n", (long long) maxrequiredcores );
             printf("==================================================================================\n");
         }
-        printf("  SS_COND Static bulgechasing version v9_9col threads  %4lld   threads_used  %4lld   n %5lld      nb %5lld    grs %4lld thgrsiz %4lld  wantz %4lld\n",
+        printf("  SS_COND Dynamic bulgechasing version v9_9col threads  %4lld   threads_used  %4lld   n %5lld      nb %5lld    grs %4lld thgrsiz %4lld  wantz %4lld\n",
                (long long) cores_num, (long long) allcoresnb, (long long) n,
                (long long) nb, (long long) grsiz, (long long) thgrsiz, (long long) wantz );
     }
     #endif
 
-    /* Initialize static scheduler progress table */
-    //myss_init(2*nbtiles+shift+cores_num+10, 1, 0); // already initialized at top level
+    /* threads beyond the number that can be kept busy do not take part */
+    if (my_core_id >= allcoresnb)
+        return;
+    magma_dmalloc_cpu(&work, nb);
+
+    /* Dynamic scheduler: the loops below enumerate the groups of grsiz
+     * consecutive steps of a sweep in an order that is valid sequentially,
+     * i.e., a step waits only on steps of earlier groups.
+     * Every thread walks the enumeration; the next free thread claims the
+     * next group by taking a ticket, and waits on the progress table prog
+     * for the steps the group depends on. Since all earlier groups are
+     * claimed, the earliest unfinished group can always proceed. */
     /* main bulge chasing code */
+    group   = 0;
+    mygroup = ticket->fetch_add( 1 );
     i = shift/grsiz;
     stepercol =  i*grsiz == shift ? i:i+1;
     i       = (n-1)/thgrsiz;
@@ -609,6 +627,8 @@ static void magma_dtile_bulge_parallel(
                 st = stt;
                 for (sweepid = st; sweepid <= ed; sweepid++)
                 {
+                    bool mine = (group == mygroup);
+                    group++;
                     for (k = 1; k <= grsiz; k++) {
                         myid = (i-sweepid)*(stepercol*grsiz) +(m-1)*grsiz + k;
                         if (myid%2 == 0) {
@@ -625,48 +645,49 @@ static void magma_dtile_bulge_parallel(
                             else
                                 blklastind=0;
                         }
-                        coreid = (stind/colpercore)%allcoresnb;
 
-                        if (my_core_id == coreid) {
+                        if (mine) {
                             if (myid == 1) {
-                                myss_cond_wait(myid+shift-1, 0, sweepid-1);
+                                wait_timed(myid+shift-1, sweepid-1);
                                 magma_dsbtype1cb(n, nb, A, lda, V, ldv, TAU, stind-1, edind-1, sweepid-1, Vblksiz, wantz, work);
-                                myss_cond_set(myid, 0, sweepid);
+                                magma_dbulge_set(prog, myid, sweepid);
 
                                 if (blklastind >= (n-1)) {
                                     for (j = 1; j <= shift; j++)
-                                        myss_cond_set(myid+j, 0, sweepid);
+                                        magma_dbulge_set(prog, myid+j, sweepid);
                                 }
                             } else {
-                                myss_cond_wait(myid-1,       0, sweepid);
-                                myss_cond_wait(myid+shift-1, 0, sweepid-1);
+                                wait_timed(myid-1,       sweepid);
+                                wait_timed(myid+shift-1, sweepid-1);
                                 if (myid%2 == 0) {
                                     magma_dsbtype2cb(n, nb, A, lda, V, ldv, TAU, stind-1, edind-1, sweepid-1, Vblksiz, wantz, work);
                                 } else {
                                     magma_dsbtype3cb(n, nb, A, lda, V, ldv, TAU, stind-1, edind-1, sweepid-1, Vblksiz, wantz, work);
                                 }
-                                myss_cond_set(myid, 0, sweepid);
+                                magma_dbulge_set(prog, myid, sweepid);
                                 if (blklastind >= (n-1)) {
                                     for (j = 1; j <= shift+allcoresnb; j++)
-                                        myss_cond_set(myid+j, 0, sweepid);
+                                        magma_dbulge_set(prog, myid+j, sweepid);
                                 }
                             } /* END if myid == 1 */
-                        } /* END if my_core_id == coreid */
+                        } /* END if mine */
 
                         if (blklastind >= (n-1)) {
                             stt++;
                             break;
                         }
                     } /* END for k=1:grsiz */
+                    if (mine) {
+                        *ngroup += 1;
+                        mygroup = ticket->fetch_add( 1 );
+                    }
                 } /* END for sweepid=st:ed */
             } /* END for m=1:stepercol */
         } /* END for i=1:n-1 */
     } /* END for thgrid=1:thgrnb */
 
-    /* finalize static sched */
-    //myss_finalize(); // initialized at top level so freed there
-
     magma_free_cpu(work);
+    #undef wait_timed
 } // END FUNCTION
 
 
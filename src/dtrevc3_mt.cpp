@@ -111,6 +111,66 @@ private:
 };
 
 
+// ---------------------------------------------
+// stores arguments and executes normalization of a block of eigenvectors,
+// then copies them to V (on CPU).
+// iscomplex is copied, as the caller reuses it for the next block.
+class magma_dnormalize_task: public magma_task
+{
+public:
+    magma_dnormalize_task(
+        magma_int_t in_n, magma_int_t in_nv,
+        const magma_int_t *in_iscomplex,
+        double *in_X, magma_int_t in_ldx,
+        double *in_V, magma_int_t in_ldv
+    ):
+        n  ( in_n   ),
+        nv ( in_nv  ),
+        iscomplex( in_iscomplex, in_iscomplex + in_nv ),
+        X  ( in_X   ),
+        ldx( in_ldx ),
+        V  ( in_V   ),
+        ldv( in_ldv )
+    {}
+    
+    virtual void run()
+    {
+        const magma_int_t ione = 1;
+        double emax, remax = 1.;
+        for( magma_int_t k=0; k < nv; ++k ) {
+            if ( iscomplex[k] == 0 ) {
+                // real eigenvector
+                magma_int_t ii = blasf77_idamax( &n, &X[k*ldx], &ione ) - 1;
+                remax = 1. / fabs( X[ii + k*ldx] );
+            }
+            else if ( iscomplex[k] == 1 ) {
+                // first eigenvector of conjugate pair
+                emax = 0.;
+                for( magma_int_t ii=0; ii < n; ++ii ) {
+                    emax = max( emax, fabs( X[ii + k*ldx] )
+                                    + fabs( X[ii + (k+1)*ldx] ) );
+                }
+                remax = 1. / emax;
+            // else if iscomplex[k] == -1
+            //     second eigenvector of conjugate pair
+            //     reuse same remax as previous k
+            }
+            blasf77_dscal( &n, &remax, &X[k*ldx], &ione );
+        }
+        lapackf77_dlacpy( "F", &n, &nv, X, &ldx, V, &ldv );
+    }
+    
+private:
+    magma_int_t   n;
+    magma_int_t   nv;
+    std::vector< magma_int_t > iscomplex;
+    double       *X;
+    magma_int_t   ldx;
+    double       *V;
+    magma_int_t   ldv;
+};
+
+
 /***************************************************************************//**
     Purpose
     -------
@@ -136,6 +196,10 @@ private:
 
     This uses a Level 3 BLAS version of the back transformation.
     This uses a multi-threaded (mt) implementation.
+    In the blocked version, the back transformation of a block of vectors
+    and the triangular solves of the next block overlap: tasks wait only
+    for the tasks they depend on, and two buffers for the vectors are used
+    if the extra n*nb workspace can be allocated.
 
     Arguments
     ---------
@@ -278,8 +342,8 @@ magma_int_t magma_dtrevc3_mt(
 #define T(i,j)  (T  + (i) + (j)*ldt)
 #define VL(i,j) (VL + (i) + (j)*ldvl)
 #define VR(i,j) (VR + (i) + (j)*ldvr)
-#define X(i,j)  (X  + (i)-1 + ((j)-1)*2)  // still as 1-based indices
 #define work(i,j) (work + (i) + (j)*n)
+#define X(i,j)    (xbuf[ib] + (i) + (j)*n)
 
     // constants
     const magma_int_t ione = 1;
@@ -296,6 +360,15 @@ magma_int_t magma_dtrevc3_mt(
     // .. Local Arrays ..
     // since iv is a 1-based index, allocate one extra here
     magma_int_t iscomplex[ nbmax+1 ];
+    
+    // In the blocked version, vectors alternate between nbuf buffers for x:
+    // xbuf[0] is columns 1:nb of work, xbuf[1] is allocated if possible.
+    // buf_id[ib] is the task that last read buffer ib;
+    // the gemm tasks of a block depend on the solves in dep.
+    double                *xbuf[2] = { work, NULL };
+    magma_int_t            ib = 0, nbuf = 1;
+    magma_task_id_t        buf_id[2] = { 0, 0 }, norm_id = 0;
+    std::vector< magma_task_id_t > dep, gemm_id;
 
     // Decode and test the input parameters
     bothv  = (side == MagmaBothSides);
@@ -382,6 +455,13 @@ magma_int_t magma_dtrevc3_mt(
         nb = min( nb, nbmax );
         nb2 = 1 + 2*nb;
         lapackf77_dlaset( "F", &n, &nb2, &c_zero, &c_zero, work, &n );
+        
+        // second buffer for x (column 0 is unused, like in work)
+        nb2 = 1 + nb;
+        if ( magma_dmalloc_cpu( &xbuf[1], n*nb2 ) == MAGMA_SUCCESS ) {
+            lapackf77_dlaset( "F", &n, &nb2, &c_zero, &c_zero, xbuf[1], &n );
+            nbuf = 2;
+        }
     }
     else {
         version = 1;
@@ -402,7 +482,7 @@ magma_int_t magma_dtrevc3_mt(
     magma_int_t lapack_nthread = magma_get_lapack_numthreads();
     magma_set_lapack_numthreads( 1 );
     magma_thread_queue queue;
-    queue.launch( nthread );
+    queue.launch( nthread, true );
     //printf( "nthread %lld, %lld\n", (long long) nthread, (long long) lapack_nthread );
     
     // gemm_nb = N/thread, rounded up to multiple of 16,
@@ -469,21 +549,28 @@ magma_int_t magma_dtrevc3_mt(
                 }
             }
 
+            // Starting a block, wait for the gemm that last read this buffer.
+            if ( version == 2 && iv == nb ) {
+                queue.wait( buf_id[ib] );
+            }
+            
             if ( ip == 0 ) {
                 // ------------------------------------------------------------
                 // Real right eigenvector
                 // Solve upper quasi-triangular system:
                 // [ T(0:ki-1,0:ki-1) - wr ]*X = -T(0:ki-1,ki)
-                queue.push_task( new magma_dlaqtrsd_task(
-                    MagmaNoTrans, ki+1, T(0,0), ldt, work(0,iv), n, work(0,0) ));
+                dep.push_back( queue.push_task( new magma_dlaqtrsd_task(
+                    MagmaNoTrans, ki+1, T(0,0), ldt, X(0,iv), n, work(0,0) ),
+                    0, NULL ));
                 
                 // Copy the vector x or Q*x to VR and normalize.
                 if ( ! over ) {
                     // ------------------------------
                     // no back-transform: copy x to VR and normalize.
                     queue.sync();
+                    dep.clear();
                     n2 = ki+1;
-                    blasf77_dcopy( &n2, work(0,iv), &ione, VR(0,is), &ione );
+                    blasf77_dcopy( &n2, X(0,iv), &ione, VR(0,is), &ione );
 
                     ii = blasf77_idamax( &n2, VR(0,is), &ione ) - 1;  // subtract 1; ii is 0-based
                     remax = c_one / fabs( *VR(ii,is) );
@@ -497,14 +584,15 @@ magma_int_t magma_dtrevc3_mt(
                     // ------------------------------
                     // version 1: back-transform each vector with GEMV, Q*x.
                     queue.sync();
+                    dep.clear();
                     time_trsv_sum += timer_stop( time_trsv );
                     timer_start( time_gemv );
                     if ( ki > 0 ) {
                         n2 = ki;
                         blasf77_dgemv( "n", &n, &n2, &c_one,
                                        VR, &ldvr,
-                                       work(0, iv), &ione,
-                                       work(ki,iv), VR(0,ki), &ione );
+                                       X(0, iv), &ione,
+                                       X(ki,iv), VR(0,ki), &ione );
                     }
                     time_gemv_sum += timer_stop( time_gemv );
                     ii = blasf77_idamax( &n, VR(0,ki), &ione ) - 1;  // subtract 1; ii is 0-based
@@ -517,7 +605,7 @@ magma_int_t magma_dtrevc3_mt(
                     // version 2: back-transform block of vectors with GEMM
                     // zero out below vector
                     for( k=ki + 1; k < n; ++k ) {
-                        *work(k,iv) = c_zero;
+                        *X(k,iv) = c_zero;
                     }
                     iscomplex[ iv ] = ip;
                     // back-transform and normalization is done below
@@ -528,17 +616,19 @@ magma_int_t magma_dtrevc3_mt(
                 // Complex right eigenvector
                 // Solve upper quasi-triangular system:
                 // [ T(0:ki-2,0:ki-2) - (wr+i*wi) ]*x = u
-                queue.push_task( new magma_dlaqtrsd_task(
-                    MagmaNoTrans, ki+1, T(0,0), ldt, work(0,iv-1), n, work(0,0) ));
+                dep.push_back( queue.push_task( new magma_dlaqtrsd_task(
+                    MagmaNoTrans, ki+1, T(0,0), ldt, X(0,iv-1), n, work(0,0) ),
+                    0, NULL ));
 
                 // Copy the vector x or Q*x to VR and normalize.
                 if ( ! over ) {
                     // ------------------------------
                     // no back-transform: copy x to VR and normalize.
                     queue.sync();
+                    dep.clear();
                     n2 = ki+1;
-                    blasf77_dcopy( &n2, work(0,iv-1), &ione, VR(0,is-1), &ione );
-                    blasf77_dcopy( &n2, work(0,iv  ), &ione, VR(0,is  ), &ione );
+                    blasf77_dcopy( &n2, X(0,iv-1), &ione, VR(0,is-1), &ione );
+                    blasf77_dcopy( &n2, X(0,iv  ), &ione, VR(0,is  ), &ione );
 
                     emax = c_zero;
                     for( k=0; k <= ki; ++k ) {
@@ -557,22 +647,23 @@ magma_int_t magma_dtrevc3_mt(
                     // ------------------------------
                     // version 1: back-transform each vector with GEMV, Q*x.
                     queue.sync();
+                    dep.clear();
                     time_trsv_sum += timer_stop( time_trsv );
                     timer_start( time_gemv );
                     if ( ki > 1 ) {
                         n2 = ki-1;
                         blasf77_dgemv( "n", &n, &n2, &c_one,
                                        VR, &ldvr,
-                                       work(0,   iv-1), &ione,
-                                       work(ki-1,iv-1), VR(0,ki-1), &ione );
+                                       X(0,   iv-1), &ione,
+                                       X(ki-1,iv-1), VR(0,ki-1), &ione );
                         blasf77_dgemv( "n", &n, &n2, &c_one,
                                        VR, &ldvr,
-                                       work(0, iv), &ione,
-                                       work(ki,iv), VR(0,ki), &ione );
+                                       X(0, iv), &ione,
+                                       X(ki,iv), VR(0,ki), &ione );
                     }
                     else {
-                        blasf77_dscal( &n, work(ki-1,iv-1), VR(0,ki-1), &ione );
-                        blasf77_dscal( &n, work(ki,  iv  ), VR(0,ki  ), &ione );
+                        blasf77_dscal( &n, X(ki-1,iv-1), VR(0,ki-1), &ione );
+                        blasf77_dscal( &n, X(ki,  iv  ), VR(0,ki  ), &ione );
                     }
                     time_gemv_sum += timer_stop( time_gemv );
 
@@ -590,8 +681,8 @@ magma_int_t magma_dtrevc3_mt(
                     // version 2: back-transform block of vectors with GEMM
                     // zero out below vector
                     for( k=ki + 1; k < n; ++k ) {
-                        *work(k,iv-1) = c_zero;
-                        *work(k,iv  ) = c_zero;
+                        *X(k,iv-1) = c_zero;
+                        *X(k,iv  ) = c_zero;
                     }
                     iscomplex[ iv-1 ] = -ip;
                     iscomplex[ iv   ] =  ip;
@@ -611,54 +702,38 @@ magma_int_t magma_dtrevc3_mt(
                     ki2 = ki - 1;
                 }
 
-                // Columns iv:nb of work are valid vectors.
+                // Columns iv:nb of X are valid vectors.
                 // When the number of vectors stored reaches nb-1 or nb,
                 // or if this was last vector, do the GEMM
                 if ( (iv <= 2) || (ki2 == 0) ) {
-                    queue.sync();
                     time_trsv_sum += timer_stop( time_trsv );
                     timer_start( time_gemm );
                     nb2 = nb-iv+1;
                     n2  = ki2+nb-iv+1;
                     
-                    // split gemm into multiple tasks, each doing one block row
+                    // split gemm into multiple tasks, each doing one block row.
+                    // gemm waits for the solves of this block, and for the
+                    // previous block's normalize to be done with work(:,nb+1:2nb).
+                    dep.push_back( norm_id );
+                    gemm_id.clear();
                     for( i=0; i < n; i += gemm_nb ) {
-                        magma_int_t ib = min( gemm_nb, n-i );
-                        queue.push_task( new dgemm_task(
-                            MagmaNoTrans, MagmaNoTrans, ib, nb2, n2, c_one,
+                        magma_int_t ib_ = min( gemm_nb, n-i );
+                        gemm_id.push_back( queue.push_task( new dgemm_task(
+                            MagmaNoTrans, MagmaNoTrans, ib_, nb2, n2, c_one,
                             VR(i,0), ldvr,
-                            work(0,iv), n, c_zero,
-                            work(i,nb+iv), n ));
+                            X(0,iv), n, c_zero,
+                            work(i,nb+iv), n ), dep.size(), &dep[0] ));
                     }
-                    queue.sync();
+                    dep.clear();
                     time_gemm_sum += timer_stop( time_gemm );
 
                     // normalize vectors
                     // TODO if somev, should copy vectors individually to correct location.
-                    for( k=iv; k <= nb; ++k ) {
-                        if ( iscomplex[k] == 0 ) {
-                            // real eigenvector
-                            ii = blasf77_idamax( &n, work(0,nb+k), &ione ) - 1;  // subtract 1; ii is 0-based
-                            remax = c_one / fabs( *work(ii,nb+k) );
-                        }
-                        else if ( iscomplex[k] == 1 ) {
-                            // first eigenvector of conjugate pair
-                            emax = c_zero;
-                            for( ii=0; ii < n; ++ii ) {
-                                emax = max( emax, fabs( *work(ii,nb+k  ) )
-                                                + fabs( *work(ii,nb+k+1) ) );
-                            }
-                            remax = c_one / emax;
-                        // else if iscomplex[k] == -1
-                        //     second eigenvector of conjugate pair
-                        //     reuse same remax as previous k
-                        }
-                        blasf77_dscal( &n, &remax, work(0,nb+k), &ione );
-                    }
-                    nb2 = nb-iv+1;
-                    lapackf77_dlacpy( "F", &n, &nb2,
-                                      work(0,nb+iv), &n,
-                                      VR(0,ki2), &ldvr );
+                    norm_id = queue.push_task( new magma_dnormalize_task(
+                        n, nb2, &iscomplex[iv], work(0,nb+iv), n, VR(0,ki2), ldvr ),
+                        gemm_id.size(), &gemm_id[0] );
+                    buf_id[ib] = norm_id;
+                    ib = (ib + 1) % nbuf;
                     iv = nb;
                     timer_start( time_trsv );
                 }
@@ -672,6 +747,7 @@ magma_int_t magma_dtrevc3_mt(
                 is -= 1;
             }
         }
+        queue.sync();
     }
     timer_stop( time_trsv );
     
@@ -716,21 +792,28 @@ magma_int_t magma_dtrevc3_mt(
                 }
             }
     
+            // Starting a block, wait for the gemm that last read this buffer.
+            if ( version == 2 && iv == 1 ) {
+                queue.wait( buf_id[ib] );
+            }
+    
             if ( ip == 0 ) {
                 // ------------------------------------------------------------
                 // Real left eigenvector
                 // Solve transposed quasi-triangular system:
                 // [ T(ki+1:n,ki+1:n) - wr ]**T * X = -T(ki+1:n,ki)
-                queue.push_task( new magma_dlaqtrsd_task(
-                    MagmaTrans, n-ki, T(ki,ki), ldt, work(ki,iv), n, work(ki,0) ));
+                dep.push_back( queue.push_task( new magma_dlaqtrsd_task(
+                    MagmaTrans, n-ki, T(ki,ki), ldt, X(ki,iv), n, work(ki,0) ),
+                    0, NULL ));
     
                 // Copy the vector x or Q*x to VL and normalize.
                 if ( ! over ) {
                     // ------------------------------
                     // no back-transform: copy x to VL and normalize.
                     queue.sync();
+                    dep.clear();
                     n2 = n-ki;
-                    blasf77_dcopy( &n2, work(ki,iv), &ione, VL(ki,is), &ione );
+                    blasf77_dcopy( &n2, X(ki,iv), &ione, VL(ki,is), &ione );
     
                     ii = blasf77_idamax( &n2, VL(ki,is), &ione ) + ki - 1;  // subtract 1; ii is 0-based
                     remax = c_one / fabs( *VL(ii,is) );
@@ -744,12 +827,13 @@ magma_int_t magma_dtrevc3_mt(
                     // ------------------------------
                     // version 1: back-transform each vector with GEMV, Q*x.
                     queue.sync();
+                    dep.clear();
                     if ( ki < n-1 ) {
                         n2 = n-ki-1;
                         blasf77_dgemv( "n", &n, &n2, &c_one,
                                        VL(0,ki+1), &ldvl,
-                                       work(ki+1,iv), &ione,
-                                       work(ki,  iv), VL(0,ki), &ione );
+                                       X(ki+1,iv), &ione,
+                                       X(ki,  iv), VL(0,ki), &ione );
                     }
                     ii = blasf77_idamax( &n, VL(0,ki), &ione ) - 1;  // subtract 1; ii is 0-based
                     remax = c_one / fabs( *VL(ii,ki) );
@@ -761,7 +845,7 @@ magma_int_t magma_dtrevc3_mt(
                     // zero out above vector
                     // could go from (ki+1)-NV+1 to ki
                     for( k=0; k < ki; ++k ) {
-                        *work(k,iv) = c_zero;
+                        *X(k,iv) = c_zero;
                     }
                     iscomplex[ iv ] = ip;
                     // back-transform and normalization is done below
@@ -772,17 +856,19 @@ magma_int_t magma_dtrevc3_mt(
                 // Complex left eigenvector
                 // Solve transposed quasi-triangular system:
                 // [ T(ki+2:n,ki+2:n)**T - (wr-i*wi) ]*X = V
-                queue.push_task( new magma_dlaqtrsd_task(
-                    MagmaTrans, n-ki, T(ki,ki), ldt, work(ki,iv), n, work(ki,0) ));
+                dep.push_back( queue.push_task( new magma_dlaqtrsd_task(
+                    MagmaTrans, n-ki, T(ki,ki), ldt, X(ki,iv), n, work(ki,0) ),
+                    0, NULL ));
     
                 // Copy the vector x or Q*x to VL and normalize.
                 if ( ! over ) {
                     // ------------------------------
                     // no back-transform: copy x to VL and normalize.
                     queue.sync();
+                    dep.clear();
                     n2 = n-ki;
-                    blasf77_dcopy( &n2, work(ki,iv  ), &ione, VL(ki,is  ), &ione );
-                    blasf77_dcopy( &n2, work(ki,iv+1), &ione, VL(ki,is+1), &ione );
+                    blasf77_dcopy( &n2, X(ki,iv  ), &ione, VL(ki,is  ), &ione );
+                    blasf77_dcopy( &n2, X(ki,iv+1), &ione, VL(ki,is+1), &ione );
     
                     emax = c_zero;
                     for( k=ki; k < n; ++k ) {
@@ -801,20 +887,21 @@ magma_int_t magma_dtrevc3_mt(
                     // ------------------------------
                     // version 1: back-transform each vector with GEMV, Q*x.
                     queue.sync();
+                    dep.clear();
                     if ( ki < n-2 ) {
                         n2 = n-ki-2;
                         blasf77_dgemv( "n", &n, &n2, &c_one,
                                        VL(0,ki+2), &ldvl,
-                                       work(ki+2,iv), &ione,
-                                       work(ki,  iv), VL(0,ki), &ione );
+                                       X(ki+2,iv), &ione,
+                                       X(ki,  iv), VL(0,ki), &ione );
                         blasf77_dgemv( "n", &n, &n2, &c_one,
                                        VL(0,ki+2), &ldvl,
-                                       work(ki+2,iv+1), &ione,
-                                       work(ki+1,iv+1), VL(0,ki+1), &ione );
+                                       X(ki+2,iv+1), &ione,
+                                       X(ki+1,iv+1), VL(0,ki+1), &ione );
                     }
                     else {
-                        blasf77_dscal( &n, work(ki,  iv  ), VL(0, ki  ), &ione );
-                        blasf77_dscal( &n, work(ki+1,iv+1), VL(0, ki+1), &ione );
+                        blasf77_dscal( &n, X(ki,  iv  ), VL(0, ki  ), &ione );
+                        blasf77_dscal( &n, X(ki+1,iv+1), VL(0, ki+1), &ione );
                     }
     
                     emax = c_zero;
@@ -831,8 +918,8 @@ magma_int_t magma_dtrevc3_mt(
                     // zero out above vector
                     // could go from (ki+1)-NV+1 to ki
                     for( k=0; k < ki; ++k ) {
-                        *work(k,iv  ) = c_zero;
-                        *work(k,iv+1) = c_zero;
+                        *X(k,iv  ) = c_zero;
+                        *X(k,iv+1) = c_zero;
                     }
                     iscomplex[ iv   ] =  ip;
                     iscomplex[ iv+1 ] = -ip;
@@ -852,47 +939,32 @@ magma_int_t magma_dtrevc3_mt(
                     ki2 = ki + 1;
                 }
     
-                // Columns 1:iv of work are valid vectors.
+                // Columns 1:iv of X are valid vectors.
                 // When the number of vectors stored reaches nb-1 or nb,
                 // or if this was last vector, do the GEMM
                 if ( (iv >= nb-1) || (ki2 == n-1) ) {
-                    queue.sync();
                     n2 = n-(ki2+1)+iv;
                     
-                    // split gemm into multiple tasks, each doing one block row
+                    // split gemm into multiple tasks, each doing one block row.
+                    // gemm waits for the solves of this block, and for the
+                    // previous block's normalize to be done with work(:,nb+1:2nb).
+                    dep.push_back( norm_id );
+                    gemm_id.clear();
                     for( i=0; i < n; i += gemm_nb ) {
-                        magma_int_t ib = min( gemm_nb, n-i );
-                        queue.push_task( new dgemm_task(
-                            MagmaNoTrans, MagmaNoTrans, ib, iv, n2, c_one,
+                        magma_int_t ib_ = min( gemm_nb, n-i );
+                        gemm_id.push_back( queue.push_task( new dgemm_task(
+                            MagmaNoTrans, MagmaNoTrans, ib_, iv, n2, c_one,
                             VL(i,ki2-iv+1), ldvl,
-                            work(ki2-iv+1,1), n, c_zero,
-                            work(i,nb+1), n ));
+                            X(ki2-iv+1,1), n, c_zero,
+                            work(i,nb+1), n ), dep.size(), &dep[0] ));
                     }
-                    queue.sync();
+                    dep.clear();
                     // normalize vectors
-                    for( k=1; k <= iv; ++k ) {
-                        if ( iscomplex[k] == 0 ) {
-                            // real eigenvector
-                            ii = blasf77_idamax( &n, work(0,nb+k), &ione ) - 1;  // subtract 1; ii is 0-based
-                            remax = c_one / fabs( *work(ii,nb+k) );
-                        }
-                        else if ( iscomplex[k] == 1) {
-                            // first eigenvector of conjugate pair
-                            emax = c_zero;
-                            for( ii=0; ii < n; ++ii ) {
-                                emax = max( emax, fabs( *work(ii,nb+k  ) )
-                                                + fabs( *work(ii,nb+k+1) ) );
-                            }
-                            remax = c_one / emax;
-                        // else if iscomplex[k] == -1
-                        //     second eigenvector of conjugate pair
-                        //     reuse same remax as previous k
-                        }
-                        blasf77_dscal( &n, &remax, work(0,nb+k), &ione );
-                    }
-                    lapackf77_dlacpy( "F", &n, &iv,
-                                      work(0,nb+1), &n,
-                                      VL(0,ki2-iv+1), &ldvl );
+                    norm_id = queue.push_task( new magma_dnormalize_task(
+                        n, iv, &iscomplex[1], work(0,nb+1), n, VL(0,ki2-iv+1), ldvl ),
+                        gemm_id.size(), &gemm_id[0] );
+                    buf_id[ib] = norm_id;
+                    ib = (ib + 1) % nbuf;
                     iv = 1;
                 }
                 else {
@@ -905,11 +977,13 @@ magma_int_t magma_dtrevc3_mt(
                 is += 1;
             }
         }
+        queue.sync();
     }
     
     // close down threads
     queue.quit();
     magma_set_lapack_numthreads( lapack_nthread );
+    magma_free_cpu( xbuf[1] );
     
     return *info;
 }  // end of DTREVC3
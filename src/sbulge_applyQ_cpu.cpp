@@ -0,0 +1,417 @@
+/*
+    -- MAGMA (version 2.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date
+
+       @generated from src/zbulge_applyQ_cpu.cpp, normal z -> s, Fri Oct 16 20:07:42 2026
+*/
+#include <vector>
+
+#include "thread_queue.hpp"
+#include "magma_internal.h"  // after thread_queue.hpp, so max, min are defined
+#include "magma_bulge.h"
+
+// =============================================================================
+// Householder blocks (V_i, T_i) produced by the bulge chasing are grouped
+// into compact-WY panels Q_p = I - Vp*Tp*Vp^H. A panel holds consecutive
+// blocks of the same block row in the order they are applied (version 114),
+// which lie diagonally one Vblksiz below the other, so Vp is unit lower
+// trapezoidal and Q_p can be applied with three level 3 BLAS calls.
+
+// one Householder block, as located by magma_bulge_findVTpos
+typedef struct {
+    magma_int_t row;       // first row of E it applies to
+    magma_int_t m, n;      // V is m-by-n, T is n-by-n
+    magma_int_t vpos, tpos;
+} magma_sbulge_tile_t;
+
+// a compact-WY panel of ntile consecutive blocks
+typedef struct {
+    magma_int_t row;       // first row of E it applies to
+    magma_int_t m, k;      // Vp is m-by-k, Tp is k-by-k, both with leading dimension m, k
+    magma_int_t first, ntile;
+    magma_int_t vpos, tpos;
+} magma_sbulge_panel_t;
+
+
+// ---------------------------------------------
+// copies the blocks of a panel into Vp, with explicit ones on the diagonal
+// and zeros above, and merges their T's into Tp:
+// for blocks a (so far) and b, T = [ Ta, -Ta*Va^H*Vb*Tb; 0, Tb ].
+class magma_sbulge_panel_task: public magma_task
+{
+public:
+    magma_sbulge_panel_task(
+        const magma_sbulge_panel_t *in_panel,
+        const magma_sbulge_tile_t  *in_tiles,
+        const float *in_V, magma_int_t in_ldv,
+        const float *in_T, magma_int_t in_ldt,
+        float *in_Vp, float *in_Tp
+    ):
+        panel( in_panel ),
+        tiles( in_tiles ),
+        V    ( in_V     ),
+        ldv  ( in_ldv   ),
+        T    ( in_T     ),
+        ldt  ( in_ldt   ),
+        Vp   ( in_Vp    ),
+        Tp   ( in_Tp    )
+    {}
+
+    virtual void run()
+    {
+        const float c_zero = MAGMA_S_ZERO;
+        const float c_one  = MAGMA_S_ONE;
+        const float c_neg_one = MAGMA_S_NEG_ONE;
+        magma_int_t m = panel->m, k = panel->k;
+
+        lapackf77_slaset( "F", &m, &k, &c_zero, &c_zero, Vp, &m );
+        lapackf77_slaset( "F", &k, &k, &c_zero, &c_zero, Tp, &k );
+        magma_int_t col = 0;
+        for (magma_int_t t = panel->first; t < panel->first + panel->ntile; ++t) {
+            const magma_sbulge_tile_t *tile = &tiles[t];
+            magma_int_t ro = tile->row - panel->row;
+            magma_int_t vm = tile->m, vn = tile->n;
+            float *Vb = &Vp[ ro + col*m ];
+            float *Tb = &Tp[ col + col*k ];
+
+            lapackf77_slacpy( "L", &vm, &vn, &V[ tile->vpos ], &ldv, Vb, &m );
+            for (magma_int_t j = 0; j < vn; ++j) {
+                Vb[ j + j*m ] = c_one;
+            }
+            lapackf77_slacpy( "U", &vn, &vn, &T[ tile->tpos ], &ldt, Tb, &k );
+            if (col > 0) {
+                // only rows ro:ro+vm of Vb are nonzero
+                blasf77_sgemm( lapack_trans_const(MagmaConjTrans), lapack_trans_const(MagmaNoTrans),
+                               &col, &vn, &vm,
+                               &c_one,  &Vp[ ro ], &m,
+                                        Vb, &m,
+                               &c_zero, &Tp[ col*k ], &k );
+                blasf77_strmm( "L", "U", "N", "N", &col, &vn, &c_neg_one, Tp, &k, &Tp[ col*k ], &k );
+                blasf77_strmm( "R", "U", "N", "N", &col, &vn, &c_one,     Tb, &k, &Tp[ col*k ], &k );
+            }
+            col += vn;
+        }
+    }
+
+private:
+    const magma_sbulge_panel_t *panel;
+    const magma_sbulge_tile_t  *tiles;
+    const float *V;
+    magma_int_t ldv;
+    const float *T;
+    magma_int_t ldt;
+    float *Vp;
+    float *Tp;
+};
+
+
+// ---------------------------------------------
+// applies all panels to a slice of E: for side = Left, columns j:j+nj of E,
+// in order; for side = Right, rows j:j+nj of E, in reverse order.
+class magma_sbulge_applyQ_task: public magma_task
+{
+public:
+    magma_sbulge_applyQ_task(
+        magma_side_t in_side,
+        magma_int_t in_npanel, const magma_sbulge_panel_t *in_panels,
+        const float *in_Vp, const float *in_Tp,
+        magma_int_t in_kmax,
+        magma_int_t in_nj, float *in_E, magma_int_t in_lde
+    ):
+        side  ( in_side   ),
+        npanel( in_npanel ),
+        panels( in_panels ),
+        Vp    ( in_Vp     ),
+        Tp    ( in_Tp     ),
+        kmax  ( in_kmax   ),
+        nj    ( in_nj     ),
+        E     ( in_E      ),
+        lde   ( in_lde    )
+    {}
+
+    virtual void run()
+    {
+        const float c_zero = MAGMA_S_ZERO;
+        const float c_one  = MAGMA_S_ONE;
+        const float c_neg_one = MAGMA_S_NEG_ONE;
+
+        float *W;
+        if (MAGMA_SUCCESS != magma_smalloc_cpu( &W, kmax*nj )) {
+            fprintf( stderr, "magma_sbulge_applyQ_cpu: cannot allocate workspace\n" );
+            return;
+        }
+        if (side == MagmaLeft) {
+            // E = (I - Vp Tp Vp^H) E
+            for (magma_int_t p = 0; p < npanel; ++p) {
+                const magma_sbulge_panel_t *pl = &panels[p];
+                magma_int_t m = pl->m, k = pl->k;
+                const float *Vpp = &Vp[ pl->vpos ];
+                const float *Tpp = &Tp[ pl->tpos ];
+                float *Ep = &E[ pl->row ];
+                blasf77_sgemm( lapack_trans_const(MagmaConjTrans), lapack_trans_const(MagmaNoTrans),
+                               &k, &nj, &m,
+                               &c_one,  Vpp, &m,
+                                        Ep,  &lde,
+                               &c_zero, W,   &k );
+                blasf77_strmm( "L", "U", "N", "N", &k, &nj, &c_one, Tpp, &k, W, &k );
+                blasf77_sgemm( lapack_trans_const(MagmaNoTrans), lapack_trans_const(MagmaNoTrans),
+                               &m, &nj, &k,
+                               &c_neg_one, Vpp, &m,
+                                           W,   &k,
+                               &c_one,     Ep,  &lde );
+            }
+        }
+        else {
+            // E = E (I - Vp Tp Vp^H)
+            for (magma_int_t p = npanel-1; p >= 0; --p) {
+                const magma_sbulge_panel_t *pl = &panels[p];
+                magma_int_t m = pl->m, k = pl->k;
+                const float *Vpp = &Vp[ pl->vpos ];
+                const float *Tpp = &Tp[ pl->tpos ];
+                float *Ep = &E[ pl->row*lde ];
+                blasf77_sgemm( lapack_trans_const(MagmaNoTrans), lapack_trans_const(MagmaNoTrans),
+                               &nj, &k, &m,
+                               &c_one,  Ep,  &lde,
+                                        Vpp, &m,
+                               &c_zero, W,   &nj );
+                blasf77_strmm( "R", "U", "N", "N", &nj, &k, &c_one, Tpp, &k, W, &nj );
+                blasf77_sgemm( lapack_trans_const(MagmaNoTrans), lapack_trans_const(MagmaConjTrans),
+                               &nj, &m, &k,
+                               &c_neg_one, W,   &nj,
+                                           Vpp, &m,
+                               &c_one,     Ep,  &lde );
+            }
+        }
+        magma_free_cpu( W );
+    }
+
+private:
+    magma_side_t side;
+    magma_int_t  npanel;
+    const magma_sbulge_panel_t *panels;
+    const float *Vp;
+    const float *Tp;
+    magma_int_t  kmax;
+    magma_int_t  nj;
+    float *E;
+    magma_int_t  lde;
+};
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SBULGE_APPLYQ_CPU applies the orthogonal matrix Q2 from the bulge chasing
+    (magma_ssytrd_sb2st) to the matrix E on the CPU, using multiple threads.
+
+    The Householder blocks of Q2 are grouped into compact-WY panels of up to
+    nb/2 columns, which are built once in parallel. Then E is split into
+    slices of columns (side = MagmaLeft) or rows (side = MagmaRight), and
+    each thread applies all panels to a slice with GEMM.
+
+    Arguments
+    ---------
+    @param[in]
+    side    magma_side_t
+      -     = MagmaLeft:  E = Q2*E
+      -     = MagmaRight: E = E*Q2
+
+    @param[in]
+    NE      INTEGER
+            The number of columns (side = MagmaLeft) or rows
+            (side = MagmaRight) of E. NE >= 0.
+
+    @param[in]
+    N       INTEGER
+            The order of Q2. N >= 0.
+
+    @param[in]
+    NB      INTEGER
+            The bandwidth used in the bulge chasing. NB >= 1.
+
+    @param[in]
+    Vblksiz INTEGER
+            The number of Householder vectors in each block of V.
+
+    @param[in,out]
+    E       REAL array, dimension (LDE,NE) if side = MagmaLeft,
+            (LDE,N) if side = MagmaRight.
+            On exit, E is overwritten by Q2*E or E*Q2.
+
+    @param[in]
+    lde     INTEGER
+            The leading dimension of the array E.
+            LDE >= max(1,N) if side = MagmaLeft, LDE >= max(1,NE) otherwise.
+
+    @param[in]
+    V       REAL array, Householder vectors from magma_ssytrd_sb2st.
+
+    @param[in]
+    ldv     INTEGER
+            The leading dimension of the array V.
+
+    @param[in]
+    T       REAL array, triangular factors from magma_ssytrd_sb2st.
+
+    @param[in]
+    ldt     INTEGER
+            The leading dimension of the array T.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_hetrd
+*******************************************************************************/
+extern "C" magma_int_t
+magma_sbulge_applyQ_cpu(
+    magma_side_t side,
+    magma_int_t NE, magma_int_t N,
+    magma_int_t NB, magma_int_t Vblksiz,
+    float *E, magma_int_t lde,
+    float *V, magma_int_t ldv,
+    float *T, magma_int_t ldt,
+    magma_int_t *info)
+{
+    magma_int_t blki, blkj, mt, nt, myrow, mycol, firstrow, nbcolinvolvd;
+    magma_int_t Vm, Vn, vpos, tpos;
+
+    *info = 0;
+    if (side != MagmaLeft && side != MagmaRight) {
+        *info = -1;
+    } else if (NE < 0) {
+        *info = -2;
+    } else if (N < 0) {
+        *info = -3;
+    } else if (NB < 1) {
+        *info = -4;
+    } else if (Vblksiz < 1) {
+        *info = -5;
+    } else if (lde < max(1, (side == MagmaLeft ? N : NE))) {
+        *info = -7;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return */
+    if (NE == 0 || N <= 1) {
+        return *info;
+    }
+
+    // list the blocks in the order they are applied for side = Left
+    // (version 114 of magma_sbulge_applyQ_v2), and group them into panels
+    // of at most maxtile consecutive blocks of the same block row.
+    // A block can be put before the ones already in a panel only if it has
+    // Vblksiz columns, so the diagonal of Vp stays aligned.
+    // A panel of k columns has NB+k-1 rows, so applying it costs about
+    // (NB+k)/(NB+Vblksiz) times the flops of its blocks; k <= NB/2 keeps
+    // that overhead small while the GEMMs get wider.
+    magma_int_t maxtile = max( 1, NB / (2*Vblksiz) );
+    std::vector< magma_sbulge_tile_t  > tiles;
+    std::vector< magma_sbulge_panel_t > panels;
+    mt = magma_ceildiv( N-1, NB );
+    for (blki = mt; blki > 0; blki--) {
+        nbcolinvolvd = min( N-1, blki*NB );
+        nt = magma_ceildiv( nbcolinvolvd, Vblksiz );
+        firstrow = (mt-blki)*NB + 1;
+        magma_int_t first = (magma_int_t) tiles.size();
+        for (blkj = nt-1; blkj >= 0; blkj--) {
+            myrow = firstrow + blkj*Vblksiz;
+            mycol = blkj*Vblksiz;
+            Vm = min( NB+Vblksiz-1, N-myrow );
+            if ( ( blkj == nt-1 ) && ( blki == mt ) ) {
+                Vn = min( Vblksiz, Vm );
+            } else {
+                Vn = min( Vblksiz, Vm-1 );
+            }
+            if ((Vm > 0) && (Vn > 0)) {
+                magma_bulge_findVTpos( N, NB, Vblksiz, mycol, myrow, ldv, ldt, &vpos, &tpos );
+                magma_sbulge_tile_t tile = { myrow, Vm, Vn, vpos, tpos };
+                tiles.push_back( tile );
+            }
+        }
+        // tiles[first:] are in order of decreasing row; each panel stores its
+        // blocks in order of increasing row, so its first block is applied last
+        magma_int_t last = (magma_int_t) tiles.size();
+        std::vector< magma_sbulge_tile_t > blkrow( tiles.begin() + first, tiles.end() );
+        magma_int_t t = 0;
+        while (t < last - first) {
+            magma_int_t t2 = t + 1;
+            while (t2 < last - first && t2 - t < maxtile && blkrow[t2].n == Vblksiz) {
+                t2++;
+            }
+            // blocks t:t2 of this block row form a panel; store them reversed
+            magma_sbulge_panel_t panel;
+            panel.first = first + t;
+            panel.ntile = t2 - t;
+            panel.row   = blkrow[t2-1].row;
+            panel.m     = blkrow[t].row + blkrow[t].m - panel.row;
+            panel.k     = 0;
+            for (magma_int_t i = 0; i < t2 - t; ++i) {
+                tiles[ panel.first + i ] = blkrow[ t2-1-i ];
+                panel.k += blkrow[ t2-1-i ].n;
+            }
+            panels.push_back( panel );
+            t = t2;
+        }
+    }
+
+    magma_int_t npanel = (magma_int_t) panels.size();
+    magma_int_t lvp = 0, ltp = 0, kmax = 0;
+    for (magma_int_t p = 0; p < npanel; ++p) {
+        panels[p].vpos = lvp;
+        panels[p].tpos = ltp;
+        lvp += panels[p].m * panels[p].k;
+        ltp += panels[p].k * panels[p].k;
+        kmax = max( kmax, panels[p].k );
+    }
+
+    float *Vp = NULL, *Tp = NULL;
+    if (MAGMA_SUCCESS != magma_smalloc_cpu( &Vp, lvp ) ||
+        MAGMA_SUCCESS != magma_smalloc_cpu( &Tp, ltp )) {
+        magma_free_cpu( Vp );
+        magma_free_cpu( Tp );
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+
+    // launch threads -- each single-threaded MKL
+    magma_int_t nthread = magma_get_parallel_numthreads();
+    magma_int_t lapack_nthread = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads( 1 );
+    magma_thread_queue queue;
+    queue.launch( nthread, true );
+
+    for (magma_int_t p = 0; p < npanel; ++p) {
+        queue.push_task( new magma_sbulge_panel_task(
+            &panels[p], &tiles[0], V, ldv, T, ldt,
+            &Vp[ panels[p].vpos ], &Tp[ panels[p].tpos ] ));
+    }
+    queue.sync();
+
+    // slices of at most 128 columns (or rows), and at least one per thread,
+    // rounded up to multiple of 16
+    magma_int_t slice = magma_roundup( min( 128, magma_ceildiv( NE, nthread )), 16 );
+    for (magma_int_t j = 0; j < NE; j += slice) {
+        magma_int_t nj = min( slice, NE-j );
+        float *Ej = (side == MagmaLeft ? &E[ j*lde ] : &E[ j ]);
+        queue.push_task( new magma_sbulge_applyQ_task(
+            side, npanel, &panels[0], Vp, Tp, kmax, nj, Ej, lde ));
+    }
+    queue.sync();
+
+    // close down threads
+    queue.quit();
+    magma_set_lapack_numthreads( lapack_nthread );
+
+    magma_free_cpu( Vp );
+    magma_free_cpu( Tp );
+
+    return *info;
+}
@@ -9,7 +9,7 @@
        @author Stan Tomov
        @author Raffaele Solca
        
-       @generated from src/zbulge_back.cpp, normal z -> s, Sat Mar 27 20:30:55 2021
+       @generated from src/zbulge_back.cpp, normal z -> s, Fri Oct 16 19:59:21 2026
 
  */
 #include "magma_internal.h"
@@ -216,8 +216,15 @@ magma_sbulge_back(
          *  use only GPU
          *==========================*/
     } else {
+        #ifdef HAVE_HOST
+        // the device is the host: apply V2 with all threads, using
+        // compact-WY panels of the Householder blocks
+        magma_sbulge_applyQ_cpu(MagmaLeft, ne, n, nb, Vblksiz, Z, ldz, V, ldv, T, ldt, info);
+        magma_ssetmatrix( n, ne, Z, ldz, dZ, lddz, queue );
+        #else
         magma_ssetmatrix( n, ne, Z, ldz, dZ, lddz, queue );
         magma_sbulge_applyQ_v2(MagmaLeft, ne, n, nb, Vblksiz, dZ, lddz, V, ldv, T, ldt, info);
+        #endif
     }
 
     timeaplQ2 = magma_wtime()-timeaplQ2;
@@ -7,8 +7,12 @@
        
        @author Raffaele Solca
        
-       @generated from src/dlaex0.cpp, normal d -> s, Sat Mar 27 20:30:51 2021
+       @generated from src/dlaex0.cpp, normal d -> s, Fri Oct 16 20:13:03 2026
 */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "magma_internal.h"
 #include "magma_timer.h"
 
@@ -18,6 +22,16 @@
     SLAEX0 computes all eigenvalues and the choosen eigenvectors of a
     symmetric tridiagonal matrix using the divide and conquer method.
 
+    The subproblems at the bottom of the tree are solved in parallel.
+    Each level of merges runs on magma_get_parallel_numthreads() threads:
+    if it has at least half as many merges as threads, the merges run
+    concurrently, one per thread, in disjoint parts of the workspaces;
+    otherwise they run one after the other, each solving the secular
+    equation with all threads (see SLAEX3) and updating the eigenvectors
+    with multithreaded BLAS.
+    If ENABLE_TIMER is defined, the time, the number of merges and the
+    number of deflated eigenvalues of each level are printed.
+
     Arguments
     ---------
     @param[in]
@@ -110,11 +124,13 @@ magma_slaex0(
 #define Q(i_,j_) (Q + (i_) + (j_)*ldq)
 
     magma_int_t ione = 1;
-    magma_range_t range2;
     magma_int_t curlvl, i, indxq;
-    magma_int_t j, k, matsiz, msd2, smlsiz;
+    magma_int_t j, maxsiz, nmerge, smlsiz;
     magma_int_t submat, subpbs, tlvls;
-
+    magma_int_t nthread, lapack_nthread;
+    magma_int_t *part = NULL;
+    magma_queue_t *queues = NULL;
+    bool concurrent;
 
     // Test the input parameters.
     *info = 0;
@@ -132,33 +148,53 @@ magma_slaex0(
     if (n == 0)
         return *info;
 
-    magma_queue_t queue;
+    // the placement of the submatrices, at most n of them
+    if (MAGMA_SUCCESS != magma_imalloc_cpu( &part, n )) {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+
+    // one queue per thread, for the merges that run concurrently
+    nthread = magma_get_parallel_numthreads();
+    lapack_nthread = magma_get_lapack_numthreads();
+    if (MAGMA_SUCCESS != magma_malloc_cpu( (void**) &queues, nthread*sizeof(magma_queue_t) )) {
+        magma_free_cpu( part );
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+    for (i = 0; i < nthread; ++i) {
+        queues[i] = NULL;
+    }
+
     magma_device_t cdev;
     magma_getdevice( &cdev );
-    magma_queue_create( cdev, &queue );
+    magma_queue_create( cdev, &queues[0] );
+
+    magma_timer_t time = 0;
+    magma_int_t ndefl = 0;
 
     smlsiz = magma_get_smlsize_divideconquer();
 
     // Determine the size and placement of the submatrices, and save in
-    // the leading elements of IWORK.
-    iwork[0] = n;
+    // the leading elements of PART.
+    part[0] = n;
     subpbs= 1;
     tlvls = 0;
-    while (iwork[subpbs - 1] > smlsiz) {
+    while (part[subpbs - 1] > smlsiz) {
         for (j = subpbs; j > 0; --j) {
-            iwork[2*j - 1] = (iwork[j-1]+1)/2;
-            iwork[2*j - 2] = iwork[j-1]/2;
+            part[2*j - 1] = (part[j-1]+1)/2;
+            part[2*j - 2] = part[j-1]/2;
         }
         ++tlvls;
         subpbs *= 2;
     }
     for (j=1; j < subpbs; ++j)
-        iwork[j] += iwork[j-1];
+        part[j] += part[j-1];
 
     // Divide the matrix into SUBPBS submatrices of size at most SMLSIZ+1
     // using rank-1 modifications (cuts).
     for (i=0; i < subpbs-1; ++i) {
-        submat = iwork[i];
+        submat = part[i];
         d[submat-1] -= MAGMA_S_ABS(e[submat-1]);
         d[submat] -= MAGMA_S_ABS(e[submat-1]);
     }
@@ -166,79 +202,127 @@ magma_slaex0(
     indxq = 4*n + 3;
 
     // Solve each submatrix eigenproblem at the bottom of the divide and
-    // conquer tree.
-    //magma_timer_t time=0;
-    //timer_start( time );
-
-    for (i = 0; i < subpbs; ++i) {
-        if (i == 0) {
-            submat = 0;
-            matsiz = iwork[0];
-        } else {
-            submat = iwork[i-1];
-            matsiz = iwork[i] - iwork[i-1];
-        }
-        lapackf77_ssteqr("I", &matsiz, &d[submat], &e[submat],
-                         Q(submat, submat), &ldq, work, info);  // change to edc?
-        if (*info != 0) {
-            printf("info: %lld\n, submat: %lld\n", (long long) *info, (long long) submat );
-            *info = (submat+1)*(n+1) + submat + matsiz;
-            printf("info: %lld\n", (long long) *info );
-            return *info;
+    // conquer tree. They are independent, so each thread solves some of
+    // them, with WORK( 2*SUBMAT ) as workspace.
+    timer_start( time );
+    magma_set_lapack_numthreads( 1 );
+
+    #pragma omp parallel for schedule(dynamic) num_threads( nthread )
+    for (magma_int_t ip = 0; ip < subpbs; ++ip) {
+        magma_int_t lsubmat = (ip == 0 ? 0 : part[ip-1]);
+        magma_int_t lmatsiz = part[ip] - lsubmat;
+        magma_int_t linfo = 0;
+        lapackf77_ssteqr("I", &lmatsiz, &d[lsubmat], &e[lsubmat],
+                         Q(lsubmat, lsubmat), &ldq, &work[2*lsubmat], &linfo);  // change to edc?
+        if (linfo != 0) {
+            #pragma omp critical (magma_slaex0)
+            *info = (lsubmat+1)*(n+1) + lsubmat + lmatsiz;
         }
-        k = 1;
-        for (j = submat; j < iwork[i]; ++j) {
-            iwork[indxq+j] = k;
-            ++k;
+        for (magma_int_t jp = lsubmat; jp < part[ip]; ++jp) {
+            iwork[indxq+jp] = jp - lsubmat + 1;
         }
     }
 
-    //timer_stop( time );
-    //timer_printf( "  for: ssteqr = %6.2f\n", time );
-    
+    magma_set_lapack_numthreads( lapack_nthread );
+    timer_stop( time );
+    timer_printf( "  slaex0: %lld subproblems, ssteqr = %6.2f\n", (long long) subpbs, time );
+    if (*info != 0)
+        goto cleanup;
+
     // Successively merge eigensystems of adjacent submatrices
     // into eigensystem for the corresponding larger matrix.
+    // Merge ip uses WORK( SUBMAT*(4 + MAXSIZ) ), IWORK( 4*SUBMAT ), and
+    // DWORK( 3*SUBMAT*(MAXSIZ/2 + 1) ), which do not overlap since its
+    // workspaces take 4*MATSIZ + MATSIZ**2, 4*MATSIZ, and 3*MATSIZ*(MATSIZ/2 + 1)
+    // elements, with MATSIZ <= MAXSIZ.
+    // On exit of SLAEX1, IWORK( 4*SUBMAT ) holds the number of non-deflated
+    // eigenvalues, for the statistics.
     curlvl = 1;
     while (subpbs > 1) {
-        //timer_start( time );
-        
-        for (i=0; i < subpbs-1; i += 2) {
-            if (i == 0) {
-                submat = 0;
-                matsiz = iwork[1];
-                msd2 = iwork[0];
-            } else {
-                submat = iwork[i-1];
-                matsiz = iwork[i+1] - iwork[i-1];
-                msd2 = matsiz / 2;
+        timer_start( time );
+
+        nmerge = subpbs / 2;
+        maxsiz = part[1];
+        for (i=2; i < subpbs-1; i += 2) {
+            maxsiz = max( maxsiz, part[i+1] - part[i-1] );
+        }
+
+        // run the merges concurrently if they keep at least half the threads busy
+        concurrent = (nthread > 1 && 2*nmerge >= nthread);
+        if (concurrent) {
+            for (i = 1; i < min( nmerge, nthread ); ++i) {
+                if (queues[i] == NULL)
+                    magma_queue_create( cdev, &queues[i] );
             }
+            magma_set_lapack_numthreads( 1 );
+        }
+
+        ndefl = 0;
+        #pragma omp parallel num_threads( concurrent ? min( nmerge, nthread ) : 1 ) reduction(+:ndefl)
+        {
+            magma_int_t tid = 0;
+            #ifdef _OPENMP
+            tid = omp_get_thread_num();
+            // each merge runs on a single thread
+            if (concurrent)
+                omp_set_num_threads( 1 );
+            #endif
+
+            #pragma omp for schedule(dynamic, 1)
+            for (magma_int_t ip = 0; ip < nmerge; ++ip) {
+                magma_int_t lsubmat, lmatsiz, lmsd2, linfo = 0;
+                magma_range_t range2;
+                if (ip == 0) {
+                    lsubmat = 0;
+                    lmatsiz = part[1];
+                    lmsd2 = part[0];
+                } else {
+                    lsubmat = part[2*ip-1];
+                    lmatsiz = part[2*ip+1] - part[2*ip-1];
+                    lmsd2 = lmatsiz / 2;
+                }
 
-            // Merge lower order eigensystems (of size MSD2 and MATSIZ - MSD2)
-            // into an eigensystem of size MATSIZ.
-            // SLAEX1 is used only for the full eigensystem of a tridiagonal
-            // matrix.
-            if (matsiz == n)
-                range2 = range;
-            else
-                // We need all the eigenvectors if it is not last step
-                range2 = MagmaRangeAll;
-
-            magma_slaex1(matsiz, &d[submat], Q(submat, submat), ldq,
-                         &iwork[indxq+submat], e[submat+msd2-1], msd2,
-                         work, &iwork[subpbs], dwork, queue,
-                         range2, vl, vu, il, iu, info);
-
-            if (*info != 0) {
-                *info = (submat+1)*(n+1) + submat + matsiz;
-                return *info;
+                // Merge lower order eigensystems (of size MSD2 and MATSIZ - MSD2)
+                // into an eigensystem of size MATSIZ.
+                // SLAEX1 is used only for the full eigensystem of a tridiagonal
+                // matrix.
+                if (lmatsiz == n)
+                    range2 = range;
+                else
+                    // We need all the eigenvectors if it is not last step
+                    range2 = MagmaRangeAll;
+
+                magma_slaex1(lmatsiz, &d[lsubmat], Q(lsubmat, lsubmat), ldq,
+                             &iwork[indxq+lsubmat], e[lsubmat+lmsd2-1], lmsd2,
+                             &work[lsubmat*(4 + maxsiz)], &iwork[4*lsubmat],
+                             dwork + 3*lsubmat*(maxsiz/2 + 1), queues[tid],
+                             range2, vl, vu, il, iu, &linfo);
+
+                if (linfo != 0) {
+                    #pragma omp critical (magma_slaex0)
+                    *info = (lsubmat+1)*(n+1) + lsubmat + lmatsiz;
+                }
+                else {
+                    ndefl += lmatsiz - iwork[4*lsubmat];
+                }
             }
-            iwork[i/2]= iwork[i+1];
         }
+
+        if (concurrent)
+            magma_set_lapack_numthreads( lapack_nthread );
+        if (*info != 0)
+            goto cleanup;
+
+        for (i=0; i < nmerge; ++i)
+            part[i] = part[2*i+1];
         subpbs /= 2;
+
+        timer_stop( time );
+        timer_printf( "  slaex0: level %lld, %5lld merges (%s) of size <= %6lld, deflated %6lld of %6lld, time = %6.2f\n",
+                      (long long) curlvl, (long long) nmerge,
+                      (concurrent ? "concurrent" : "sequential"),
+                      (long long) maxsiz, (long long) ndefl, (long long) n, time );
         ++curlvl;
-        
-        //timer_stop( time );
-        //timer_printf("%lld: time: %6.2f\n", (long long) curlvl, time );
     }
 
     // Re-merge the eigenvalues/vectors which were deflated at the final
@@ -251,7 +335,12 @@ magma_slaex0(
     blasf77_scopy(&n, work, &ione, d, &ione);
     lapackf77_slacpy( "A", &n, &n, &work[n], &n, Q, &ldq );
 
-    magma_queue_destroy( queue );
+cleanup:
+    for (i = 0; i < nthread; ++i) {
+        magma_queue_destroy( queues[i] );
+    }
+    magma_free_cpu( queues );
+    magma_free_cpu( part );
 
     return *info;
 } /* magma_slaex0 */
@@ -7,7 +7,7 @@
        
        @author Raffaele Solca
        
-       @generated from src/dlaex1.cpp, normal d -> s, Sat Mar 27 20:30:51 2021
+       @generated from src/dlaex1.cpp, normal d -> s, Fri Oct 16 20:12:58 2026
 */
 #include "magma_internal.h"
 
@@ -82,8 +82,10 @@
     @param
     work    (workspace) REAL array, dimension (4*N + N**2)
             
-    @param
+    @param[out]
     iwork   (workspace) INTEGER array, dimension (4*N)
+            On exit, IWORK(1) is K, the number of eigenvalues that were
+            not deflated.
             
     @param
     dwork   (workspace) REAL array, dimension (3*N*N/2+3*N)
@@ -207,6 +209,7 @@ magma_slaex1(
         for (i = 0; i < n; ++i)
             indxq[i] = i+1;
     }
+    iwork[0] = k;
 
     return *info;
 } /* magma_slaex1 */
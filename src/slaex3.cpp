@@ -7,7 +7,7 @@
        
        @author Raffaele Solca
        
-       @generated from src/dlaex3.cpp, normal d -> s, Sat Mar 27 20:30:51 2021
+       @generated from src/dlaex3.cpp, normal d -> s, Fri Oct 16 20:24:33 2026
 */
 
 #ifdef _OPENMP
@@ -429,8 +429,10 @@ magma_slaex3(
             }
         }
     }  // end omp parallel
-    if (*info != 0)
+    if (*info != 0) {
+        magma_queue_sync( queue );  // Q2 is the caller's workspace
         return *info;
+    }
 
     //timer_stop( time );
     //timer_printf( "eigenvalues/vector D+zzT = %6.2f\n", time );
@@ -453,8 +455,10 @@ magma_slaex3(
         if (iinfo != 0)
             *info = iinfo;
     }
-    if (*info != 0)
+    if (*info != 0) {
+        magma_queue_sync( queue );  // Q2 is the caller's workspace
         return *info;
+    }
 
     // Prepare the INDXQ sorting permutation.
     magma_int_t nk = n - k;
@@ -565,5 +569,9 @@ magma_slaex3(
     //timer_stop( time );
     //timer_printf( "gemms = %6.2f\n", time );
 
+    // the copy of Q2 to dQ2 may still be pending if the GEMMs ran on the CPU;
+    // Q2 is the caller's workspace, which the next merge overwrites
+    magma_queue_sync( queue );
+
     return *info;
 } /* magma_slaex3 */
@@ -8,7 +8,7 @@
        @author Azzam Haidar
        @author Ahmad Abdelfattah
        
-       @generated from src/zlarft_batched.cpp, normal z -> s, Sat Mar 27 20:31:12 2021
+       @generated from src/zlarft_batched.cpp, normal z -> s, Fri Oct 16 22:42:06 2026
 */
 #include "magma_internal.h"
 
@@ -161,8 +161,6 @@ magma_slarft_batched(magma_int_t n, magma_int_t k, magma_int_t stair_T,
     //    shared memory to nb, this nb column 
     //    are split vertically by chunk of nb rows
 
-    dim3 grid(1, 1, batchCount);
-
     for (j=0; j < k; j += nb)
     {
         prev_n =  j;
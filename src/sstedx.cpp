@@ -7,7 +7,7 @@
        
        @author Raffaele Solca
        
-       @generated from src/dstedx.cpp, normal d -> s, Sat Mar 27 20:30:51 2021
+       @generated from src/dstedx.cpp, normal d -> s, Fri Oct 16 20:12:58 2026
 */
 #include "magma_internal.h"
 
@@ -16,6 +16,8 @@
     -------
     SSTEDX computes some eigenvalues and, optionally, eigenvectors of a
     symmetric tridiagonal matrix using the divide and conquer method.
+    The independent subproblems of each level of the divide and conquer
+    tree are solved concurrently on the CPU; see SLAEX0.
 
     This code makes very mild assumptions about floating point
     arithmetic. It will work on machines with a guard digit in
@@ -217,13 +219,9 @@ magma_sstedx(
         return *info;
     }
 
-    /* determine the number of threads *///not needed here to be checked Azzam
-    //magma_int_t threads = magma_get_parallel_numthreads();
-    //magma_int_t mklth   = magma_get_lapack_numthreads();
-    //magma_set_lapack_numthreads(mklth);
-
+    // the threads are managed by SLAEX0
 #ifdef ENABLE_DEBUG
-    //printf("  D&C is using %lld threads\n", (long long) threads );
+    printf("  D&C is using %lld threads\n", (long long) magma_get_parallel_numthreads() );
 #endif
 
     // If N is smaller than the minimum divide size (SMLSIZ+1), then
@@ -216,8 +216,15 @@ magma_zbulge_back(
          *  use only GPU
          *==========================*/
     } else {
+        #ifdef HAVE_HOST
+        // the device is the host: apply V2 with all threads, using
+        // compact-WY panels of the Householder blocks
+        magma_zbulge_applyQ_cpu(MagmaLeft, ne, n, nb, Vblksiz, Z, ldz, V, ldv, T, ldt, info);
+        magma_zsetmatrix( n, ne, Z, ldz, dZ, lddz, queue );
+        #else
         magma_zsetmatrix( n, ne, Z, ldz, dZ, lddz, queue );
         magma_zbulge_applyQ_v2(MagmaLeft, ne, n, nb, Vblksiz, dZ, lddz, V, ldv, T, ldt, info);
+        #endif
     }
 
     timeaplQ2 = magma_wtime()-timeaplQ2;
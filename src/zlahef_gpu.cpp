@@ -587,8 +587,8 @@ magma_zlahef_gpu(
 
                     if ( k < n-1 ) {
                         magma_zgetvector_async( 1, &dA( k, k ), 1, &Z, 1, queues[0] );
-                        R1 = d_one / MAGMA_Z_REAL( Z );
                         magma_queue_sync( queues[0] );
+                        R1 = d_one / MAGMA_Z_REAL( Z );
                         trace_gpu_start( 0, 0, "scal", "scal-1" );
                         magma_zdscal((n-1)-k, R1, &dA( k+1, k ), 1, queues[0]);
                         trace_gpu_end( 0, 0 );
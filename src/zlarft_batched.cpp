@@ -161,8 +161,6 @@ magma_zlarft_batched(magma_int_t n, magma_int_t k, magma_int_t stair_T,
     //    shared memory to nb, this nb column 
     //    are split vertically by chunk of nb rows
 
-    dim3 grid(1, 1, batchCount);
-
     for (j=0; j < k; j += nb)
     {
         prev_n =  j;
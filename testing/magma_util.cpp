@@ -37,6 +37,9 @@
 #elif defined(HAVE_HIP)
     const char* g_platform_str = "HIP";
 
+#elif defined(HAVE_HOST)
+    const char* g_platform_str = "host";
+
 #else
     #error "unknown platform"
 #endif
@@ -650,6 +653,8 @@ void magma_opts::parse_opts( int argc, char** argv )
     #elif defined(HAVE_CUBLAS)
         // handle for directly calling cublas
         this->handle = magma_queue_get_cublas_handle( this->queue );
+    #elif defined(HAVE_HOST)
+        // no vendor BLAS handle; testers call the CPU BLAS directly
     #else
         #error "unknown platform"
     #endif
@@ -630,9 +630,14 @@ subs = {
     ('sidr',           'didr',           'cidr',           'zidr'            ),
     ('spidr',          'dpidr',          'cpidr',          'zpidr'           ),
     ('sp1gmres',       'dp1gmres',       'cp1gmres',       'zp1gmres'        ),
+    ('spipegmres',     'dpipegmres',     'cpipegmres',     'zpipegmres'      ),
+    ('scacg',          'dcacg',          'ccacg',          'zcacg'           ),
+    ('sbcg',           'dbcg',           'cbcg',           'zbcg'            ),
+    ('sbgmres',        'dbgmres',        'cbgmres',        'zbgmres'         ),
     ('sjacobi',        'djacobi',        'cjacobi',        'zjacobi'         ),
     ('sftjacobi',      'dftjacobi',      'cftjacobi',      'zftjacobi'       ),
     ('siterref',       'diterref',       'citerref',       'ziterref'        ),
+    ('scir',           'dsir',           'ccir',           'zcir'            ),
     ('silu',           'dilu',           'cilu',           'zilu'            ),
     ('sailu',          'dailu',          'cailu',          'zailu'           ),
     ('scuilu',         'dcuilu',         'ccuilu',         'zcuilu'          ),